@@ -1,15 +1,178 @@
 //===----------------------------------------------------------------------===//
 //
-//        OpenSees - Open System for Earthquake Engineering Simulation    
+//        OpenSees - Open System for Earthquake Engineering Simulation
 //
 //===----------------------------------------------------------------------===//
 //
-#include <math.h>                                                                        
+// The CBDI influence matrix maps the curvatures at a set of integration
+// points to the deflections at a set of points. Column k of the unscaled
+// matrix holds F_k at the points, where F_k'' is the Lagrange polynomial
+// of integration point k and F_k(0) = F_k(1) = 0:
+//
+//   F_k(x) = int_0^x (x - s) L_k(s) ds - x int_0^1 (1 - s) L_k(s) ds
+//
+// The integrals are evaluated exactly by Gauss-Legendre quadrature with
+// the Lagrange polynomials in barycentric form, which avoids inverting
+// the ill-conditioned Vandermonde matrix of the integration points. The
+// unscaled matrices are cached by point set and scaled by L*L at use.
+//
+#include <math.h>
 #include <stdlib.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 #include <Vector.h>
 #include <Matrix.h>
 #include "cbdi.h"
 
+namespace {
+
+// Cached matrices beyond this count are dropped, for models in which the
+// integration points change continuously
+constexpr std::size_t maxCachedInfluence = 1024;
+
+typedef std::pair<std::vector<double>, std::vector<double>> InfluenceKey;
+
+std::mutex influenceMutex;
+std::map<InfluenceKey, std::shared_ptr<const std::vector<double>>> influenceCache;
+
+// Gauss-Legendre points and weights on [-1, 1]
+void
+gaussLegendre(int n, std::vector<double>& x, std::vector<double>& w)
+{
+  x.resize(n);
+  w.resize(n);
+  for (int i = 0; i < (n + 1)/2; i++) {
+    double z = cos(M_PI*(i + 0.75)/(n + 0.5));
+    double dp = 0.0;
+    for (int iter = 0; iter < 100; iter++) {
+      // Legendre polynomial of degree n and its derivative at z
+      double p0 = 1.0, p1 = z;
+      for (int k = 2; k <= n; k++) {
+        double p2 = ((2*k - 1)*z*p1 - (k - 1)*p0)/k;
+        p0 = p1;
+        p1 = p2;
+      }
+      if (n == 1)
+        p0 = 1.0;
+      dp = n*(z*p1 - p0)/(z*z - 1.0);
+      double dz = p1/dp;
+      z -= dz;
+      if (fabs(dz) < 1.0e-15)
+        break;
+    }
+    x[i]         = -z;
+    x[n - 1 - i] =  z;
+    w[i] = w[n - 1 - i] = 2.0/((1.0 - z*z)*dp*dp);
+  }
+}
+
+// Values of the Lagrange polynomials of the points xi at s, in barycentric
+// form with the weights bw
+void
+lagrangeBasis(int n, const double* xi, const double* bw, double s, double* L)
+{
+  for (int k = 0; k < n; k++)
+    if (s == xi[k]) {
+      for (int m = 0; m < n; m++)
+        L[m] = 0.0;
+      L[k] = 1.0;
+      return;
+    }
+
+  double sum = 0.0;
+  for (int k = 0; k < n; k++) {
+    L[k] = bw[k]/(s - xi[k]);
+    sum += L[k];
+  }
+  for (int k = 0; k < n; k++)
+    L[k] /= sum;
+}
+
+// Unscaled influence matrix of the points x for the integration points xi,
+// stored by rows
+std::vector<double>
+computeInfluence(const std::vector<double>& x, const std::vector<double>& xi)
+{
+  const int nPts = x.size();
+  const int n    = xi.size();
+
+  // Barycentric weights
+  std::vector<double> bw(n, 1.0);
+  for (int k = 0; k < n; k++)
+    for (int m = 0; m < n; m++)
+      if (m != k)
+        bw[k] /= (xi[k] - xi[m]);
+
+  // The integrands are polynomials of degree n
+  std::vector<double> gx, gw;
+  gaussLegendre(n/2 + 1, gx, gw);
+  const int ng = gx.size();
+
+  std::vector<double> L(n);
+
+  // B_k = int_0^1 (1 - s) L_k(s) ds
+  std::vector<double> B(n, 0.0);
+  for (int g = 0; g < ng; g++) {
+    double s = 0.5*(1.0 + gx[g]);
+    lagrangeBasis(n, &xi[0], &bw[0], s, &L[0]);
+    for (int k = 0; k < n; k++)
+      B[k] += 0.5*gw[g]*(1.0 - s)*L[k];
+  }
+
+  std::vector<double> ls(nPts*n, 0.0);
+  for (int i = 0; i < nPts; i++) {
+    double xp = x[i];
+    double* row = &ls[i*n];
+    for (int g = 0; g < ng; g++) {
+      double s = 0.5*xp*(1.0 + gx[g]);
+      lagrangeBasis(n, &xi[0], &bw[0], s, &L[0]);
+      double f = 0.5*xp*gw[g]*(xp - s);
+      for (int k = 0; k < n; k++)
+        row[k] += f*L[k];
+    }
+    for (int k = 0; k < n; k++)
+      row[k] -= xp*B[k];
+  }
+
+  return ls;
+}
+
+std::shared_ptr<const std::vector<double>>
+getInfluence(int nPts, const double* pts, int nIntegrPts, const double* integrPts)
+{
+  InfluenceKey key(std::vector<double>(pts, pts + nPts),
+                   std::vector<double>(integrPts, integrPts + nIntegrPts));
+  {
+    std::lock_guard<std::mutex> lock(influenceMutex);
+    auto found = influenceCache.find(key);
+    if (found != influenceCache.end())
+      return found->second;
+  }
+
+  auto ls = std::make_shared<const std::vector<double>>(computeInfluence(key.first, key.second));
+
+  std::lock_guard<std::mutex> lock(influenceMutex);
+  if (influenceCache.size() >= maxCachedInfluence)
+    influenceCache.clear();
+  influenceCache.emplace(std::move(key), ls);
+  return ls;
+}
+
+void
+scaleInfluence(int nPts, int nIntegrPts, const std::vector<double>& l0, double L, Matrix& ls)
+{
+  const double L2 = L*L;
+  for (int i = 0; i < nPts; i++)
+    for (int j = 0; j < nIntegrPts; j++)
+      ls(i,j) = l0[i*nIntegrPts + j]*L2;
+}
+
+} // namespace
+
+
 void
 vandermonde(int numSections, const double xi[], Matrix& G)
 {
@@ -25,85 +188,61 @@ vandermonde(int numSections, const double xi[], Matrix& G)
 void
 vandermonde_inverse(int numSections, const double xi[], Matrix& Ginv)
 {
-  Matrix G(numSections, numSections);
-  vandermonde(numSections, xi, G);
+  // Column k of the inverse holds the monomial coefficients of the
+  // Lagrange polynomial of point k, which are obtained by dividing the
+  // master polynomial prod_m (x - xi[m]) by (x - xi[k])
+  const int n = numSections;
+  std::vector<double> master(n + 1, 0.0), q(n);
+  master[0] = 1.0;
+  for (int m = 0; m < n; m++) {
+    for (int j = m + 1; j > 0; j--)
+      master[j] = master[j - 1] - xi[m]*master[j];
+    master[0] *= -xi[m];
+  }
+
+  for (int k = 0; k < n; k++) {
+    // synthetic division, highest power first
+    q[n - 1] = master[n];
+    for (int j = n - 1; j > 0; j--)
+      q[j - 1] = master[j] + xi[k]*q[j];
 
-  Matrix I(numSections, numSections);
-  for (int i = 0; i < numSections; i++)
-    I(i, i) = 1.0;
+    double w = 1.0;
+    for (int m = 0; m < n; m++)
+      if (m != k)
+        w *= (xi[k] - xi[m]);
 
-  G.Solve(I, Ginv);
+    for (int j = 0; j < n; j++)
+      Ginv(j, k) = q[j]/w;
+  }
 }
 
-void 
+void
 getCBDIinfluenceMatrix(int nIntegrPts, const Matrix &xi_pt, double L, Matrix &ls)
 {
-   // setup Vandermode and CBDI influence matrices
-   Matrix G(nIntegrPts, nIntegrPts); 
-   Matrix Ginv(nIntegrPts, nIntegrPts);
-   Matrix l(nIntegrPts, nIntegrPts);
-
-   for (int i = 1; i <= nIntegrPts; i++)
-      for (int j = 1; j <= nIntegrPts; j++) {
-         int i0 = i - 1;
-         int j0 = j - 1;
-         double xi = xi_pt(i0,0);
-         G(i0,j0) =  pow(xi,j-1);
-         l(i0,j0) = (pow(xi,j+1)-xi)/(j*(j+1));
-      }
+   std::vector<double> pts(nIntegrPts);
+   for (int i = 0; i < nIntegrPts; i++)
+     pts[i] = xi_pt(i,0);
 
-   G.Invert(Ginv);
-
-   // ls = l * Ginv * (L*L);
-   ls.addMatrixProduct(0.0, l, Ginv, L*L);
+   auto l0 = getInfluence(nIntegrPts, &pts[0], nIntegrPts, &pts[0]);
+   scaleInfluence(nIntegrPts, nIntegrPts, *l0, L, ls);
 }
 
 void getCBDIinfluenceMatrix(int nIntegrPts, const double *pts, double L, Matrix &ls)
 {
-   // setup Vandermode and CBDI influence matrices
-   Matrix G(nIntegrPts, nIntegrPts); 
-   Matrix Ginv(nIntegrPts, nIntegrPts);
-   Matrix l(nIntegrPts, nIntegrPts);
-
-   for (int i = 0; i < nIntegrPts; i++) {
-     double xi = pts[i];
-     for (int j = 1; j <= nIntegrPts; j++) {
-       int j0 = j - 1;
-       G(i,j0) =  pow(xi,j-1);
-       l(i,j0) = (pow(xi,j+1)-xi)/(j*(j+1));
-     }
-   }
-
-   G.Invert(Ginv);
-
-   // ls = l * Ginv * (L*L);
-   ls.addMatrixProduct(0.0, l, Ginv, L*L);
+   auto l0 = getInfluence(nIntegrPts, pts, nIntegrPts, pts);
+   scaleInfluence(nIntegrPts, nIntegrPts, *l0, L, ls);
 }
 
-void 
+void
 getCBDIinfluenceMatrix(int nPts, const double *pts, int nIntegrPts, const double *integrPts, double L, Matrix &ls)
 {
-   // setup Vandermode and CBDI influence matrices
-   double xi;
-   Matrix G(nIntegrPts, nIntegrPts); 
-   Matrix Ginv(nIntegrPts, nIntegrPts);
-   Matrix l(nPts, nIntegrPts);
-
-   // Loop over columns
-   for (int j = 1; j <= nIntegrPts; j++) {
-     int j0 = j - 1;
-     for (int i = 0; i < nIntegrPts; i++) {
-       xi = integrPts[i];
-       G(i,j0) =  pow(xi,j-1);
-     }
-     for (int i = 0; i < nPts; i++) {
-       xi = pts[i];
-       l(i,j0) = (pow(xi,j+1)-xi)/(j*(j+1));
-     }
-   }
-
-   G.Invert(Ginv);
-      
-   // ls = l * Ginv * (L*L);
-   ls.addMatrixProduct(0.0, l, Ginv, L*L);
+   auto l0 = getInfluence(nPts, pts, nIntegrPts, integrPts);
+   scaleInfluence(nPts, nIntegrPts, *l0, L, ls);
+}
+
+int
+getCBDIinfluenceCacheSize(void)
+{
+   std::lock_guard<std::mutex> lock(influenceMutex);
+   return influenceCache.size();
 }
@@ -13,6 +13,10 @@ void   getCBDIinfluenceMatrix(int nIntegrPts, const Matrix &xi_pt, double L, Mat
 void   getCBDIinfluenceMatrix(int nIntegrPts, const double *pts, double L, Matrix &ls);
 void   getCBDIinfluenceMatrix(int npts, const double *pts, int nIntegrPts, const double *ipts, double L, Matrix &ls);
 
+// Number of point sets in the cache of influence matrices, which is
+// cleared once it holds 1024 of them
+int    getCBDIinfluenceCacheSize(void);
+
 
 void vandermonde(int numSections, const double xi[], Matrix& G);
 void vandermonde_inverse(int numSections, const double xi[], Matrix& Ginv);
@@ -12,6 +12,7 @@
 #include <math.h>
 #include <float.h>
 #include <stdlib.h>
+#include <vector>
 
 #include "nurbs.h"
 #include <Vector.h>
@@ -38,6 +39,9 @@ free2Darray(double **array, int x) {
   free(array);
 }
 
+// Degrees up to this keep their scratch on the stack
+static constexpr int maxStackDegree = 10;
+
 int FindSpan(int n, int p, double u, Vector& U)
 {
   /* 
@@ -47,159 +51,52 @@ int FindSpan(int n, int p, double u, Vector& U)
      Note that: u_i <= u < (not equal) u_{i+1}!!!
      If we have knot = [0,0.5,1] then u=0.5 has span=1 not 0!!!
   */
-
-  if ( u >= U[n + 1] )
-    return n;
-
-  if ( u <= U[p] )
-    return p;
-
-  int low  = p,
-      high = n + 1, 
-      mid  = (low + high) / 2;
-
-  while ( u < U[mid] || u >= U[mid + 1] )
-  {
-    if ( u < U[mid] )
-      high = mid;
-    else
-      low = mid;
-    mid = (low + high) / 2;
-  }
-  return mid;
+  return OpenSees::Nurbs::findSpan(n, p, u, &U[0]);
 }
 
 void 
 BasisFuns( int i, double u, int p, Vector& U, Vector& N)
 {
-
   /*
    we can compute the non zero basis functions
      at point u, there are p+1 non zero basis functions
   */
-
-  N[0] = 1.0;
-
-  // double *left  = (double *)malloc(sizeof(double) * (p + 1));
-  // double *right = (double *)malloc(sizeof(double) * (p + 1));
-
-  Vector left(p+1);
-  Vector right(p+1);
-
-  double saved, temp;
-
-  for (int j = 1; j <= p; ++j) {
-    left[j]  = u - U[i + 1 - j];
-    right[j] = U[i + j] - u;
-    saved = 0.0;
-    for (int r = 0; r < j; ++r) {
-      temp  = N[r] / ( right[r + 1] + left[j - r] );
-      N[r]  = saved + right[r + 1] * temp;
-      saved = left[j - r] * temp;
-    }
-    N[j] = saved;
+  if (p <= maxStackDegree) {
+    double left[maxStackDegree + 1], right[maxStackDegree + 1];
+    OpenSees::Nurbs::basisFuns(i, u, p, &U[0], left, right, &N[0]);
+  }
+  else {
+    std::vector<double> left(p + 1), right(p + 1);
+    OpenSees::Nurbs::basisFuns(i, u, p, &U[0], left.data(), right.data(), &N[0]);
   }
-
-  // free(left);
-  // free(right);
-
 }
 
-// void dersBasisFuns(int i, double u, int p, int order, Vector knot, double **ders)
 void dersBasisFuns(int i, double u, int p, int order, Vector& knot, Matrix& ders)
 {
   /*
    * Calculate the non-zero derivatives of the b-spline functions
    */
-
-  double saved, temp;
-  int j, j1, j2, r;
-
-  // double *left  = (double *)malloc(sizeof(double) * (p + 1));
-  // double *right = (double *)malloc(sizeof(double) * (p + 1));
-
-  static Vector right(p+1);
-  static Vector left(p+1);
-  right.resize(p+1);
-  left.resize(p+1);
-
-  // double **ndu  = init2DArray(p + 1, p + 1);
-  // double **a    = init2DArray(p + 1, p + 1);
-
-  static Matrix ndu(p+1,p+1);
-  static Matrix a(p+1,p+1);
-  ndu.resize(p+1,p+1);
-  a.resize(p+1,p+1);
-
-  ndu(0,0) = 1.0;
-  for ( j = 1; j <= p; j++ ) {
-    left[j] = u - knot[i + 1 - j];
-    right[j] = knot[i + j] - u;
-
-    saved = 0.0;
-    for ( r = 0; r < j; r++ ) {
-      ndu(j,r) = right[r + 1] + left[j - r];
-      temp = ndu(r,j - 1) / ndu(j,r);
-
-      ndu(r,j) = saved + right[r + 1] * temp;
-      saved = left[j - r] * temp;
-    }
-    ndu(j,j) = saved;
-  }
-
-  for (int j = 0; j <= p; j++ )
-    ders(0,j) = ndu(j,p);
-
-  if ( order == 0 )
-    return;
-
-  for (int r = 0; r <= p; r++ ) {
-    int s1 = 0, 
-        s2 = 1;
-
-    a(0,0) = 1.0;
-
-    for (int k = 1; k <= order; k++ ) {
-      double d = 0.;
-      int rk = r - k, 
-          pk = p - k;
-
-      if ( r >= k ) {
-        a(s2,0) = a(s1,0) / ndu(pk + 1,rk);
-        d = a(s2,0) * ndu(rk,pk);
-      }
-
-      j1 = rk >= -1 ? 1 : -rk;
-      j2 = (r - 1 <= pk) ? k - 1 : p - r;
-
-      for ( j = j1; j <= j2; j++ ) {
-        a(s2,j) = (a(s1,j) - a(s1,j - 1)) / ndu(pk + 1,rk + j);
-        d += a(s2,j) * ndu(rk + j,pk);
-      }
-      if ( r <= pk ) {
-        a(s2,k) = -a(s1,k - 1) / ndu(pk + 1,r);
-        d += a(s2,k) * ndu(r,pk);
-      }
-      ders(k,r) = d;
-      j  = s1; 
-      s1 = s2; 
-      s2 = j;
-    }
+  const int np = p + 1;
+  const int size = (order + 1)*np;
+
+  if (p <= maxStackDegree && order <= maxStackDegree) {
+    double left[maxStackDegree + 1], right[maxStackDegree + 1];
+    double ndu[(maxStackDegree + 1)*(maxStackDegree + 1)];
+    double a[2*(maxStackDegree + 1)];
+    double d[(maxStackDegree + 1)*(maxStackDegree + 1)];
+    OpenSees::Nurbs::dersBasisFuns(i, u, p, order, &knot[0], left, right, ndu, a, d);
+    for (int k = 0; k <= order; k++)
+      for (int j = 0; j <= p; j++)
+        ders(k,j) = d[k*np + j];
   }
-
-  r = p;
-  for (int k = 1; k <= order; k++ ) {
-    for (int j = 0; j <= p; j++ )
-      ders(k,j) *= r;
-    r *= (p - k);
+  else {
+    std::vector<double> left(np), right(np), ndu(np*np), a(2*np), d(size);
+    OpenSees::Nurbs::dersBasisFuns(i, u, p, order, &knot[0], left.data(), right.data(),
+                                   ndu.data(), a.data(), d.data());
+    for (int k = 0; k <= order; k++)
+      for (int j = 0; j <= p; j++)
+        ders(k,j) = d[k*np + j];
   }
-
-  // free(left);
-  // free(right);
-
-  // free2Darray(ndu, p + 1);
-  // free2Darray(a, p + 1);
-
 }
 
 
@@ -265,9 +162,6 @@ void dersOneBasisFuns(int p, int m, Vector U, int i, double u, int order, double
     Compute the derivatives for basis function Nip
   */
 
-  double **N = init2DArray(order + 1, order + 1);
-  double *ND = (double*)malloc((order + 1) * sizeof(double));
-
   double saved, temp;
 
   if (u < U[i] || u >= U[i + p + 1]) {
@@ -276,6 +170,9 @@ void dersOneBasisFuns(int p, int m, Vector U, int i, double u, int order, double
     return;
   }
 
+  double **N = init2DArray(p + 1, p + 1);
+  double *ND = (double*)malloc((order + 1) * sizeof(double));
+
   for (int j = 0; j <= p; j++) {
     if (u >= U[i + j] && u < U[i + j + 1])
       N[j][0] = 1.0;
@@ -319,7 +216,7 @@ void dersOneBasisFuns(int p, int m, Vector U, int i, double u, int order, double
 
       for (int j = 0; j < (k - jj + 1); j++) {
         double Uleft = U[i + j + 1];
-        double Uright = U[i + j + p + jj];
+        double Uright = U[i + j + p - k + jj + 1];
 
         if (ND[j + 1] == 0.0) {
           ND[j] = (p - k + jj) * saved; 
@@ -334,7 +231,7 @@ void dersOneBasisFuns(int p, int m, Vector U, int i, double u, int order, double
     ders[k] = ND[0];
   }
 
-  free2Darray(N, order + 1);
+  free2Darray(N, p + 1);
   free(ND);
 }
 
@@ -19,4 +19,28 @@ void     dersBasisFuns(int i, double u, int p, int order, Vector& knot, Matrix&
 double   OneBasisFun(int p, int m, Vector U, int i, double u);
 void     dersOneBasisFuns(int p, int m, Vector U, int i, double u, int n, double* ders);
 
+//
+// Fixed degree versions on raw knot arrays, which keep their scratch on the
+// stack and can be tabulated at the quadrature points of each knot span
+//
+namespace OpenSees {
+namespace Nurbs {
+
+template <int p>
+int  FindSpan(int n, double u, const double* U);
+
+template <int p>
+void BasisFuns(int i, double u, const double* U, double (&N)[p+1]);
+
+template <int p, int order>
+void DersBasisFuns(int i, double u, const double* U, double (&ders)[order+1][p+1]);
+
+template <int p, int order, int nq>
+class BasisTable;
+
+} // namespace Nurbs
+} // namespace OpenSees
+
+#include "nurbs.tpp"
+
 #endif
@@ -0,0 +1,216 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Fixed degree B-spline basis functions. The kernels take the degree as an
+// argument and their scratch from the caller; the templates call them with
+// stack arrays and a compile-time degree so that the loops can be unrolled.
+//
+// Algorithms A2.1, A2.2 and A2.3 of Piegl and Tiller, The NURBS Book.
+//
+#include <vector>
+#include <algorithm>
+
+namespace OpenSees {
+namespace Nurbs {
+
+//
+// Knot span i of u, with U[i] <= u < U[i+1], for the n+1 basis functions
+// of degree p of the knot vector U
+//
+inline int
+findSpan(int n, int p, double u, const double* U)
+{
+  if (u >= U[n + 1])
+    return n;
+
+  if (u <= U[p])
+    return p;
+
+  // last knot of U[p+1..n+1] that is <= u
+  return int(std::upper_bound(U + p + 1, U + n + 1, u) - U) - 1;
+}
+
+//
+// Non-zero basis functions N[0..p] at u in span i; left and right hold p+1
+// values each
+//
+inline void
+basisFuns(int i, double u, int p, const double* U,
+          double* left, double* right, double* N)
+{
+  N[0] = 1.0;
+  for (int j = 1; j <= p; ++j) {
+    left[j]  = u - U[i + 1 - j];
+    right[j] = U[i + j] - u;
+    double saved = 0.0;
+    for (int r = 0; r < j; ++r) {
+      double temp = N[r] / (right[r + 1] + left[j - r]);
+      N[r]  = saved + right[r + 1] * temp;
+      saved = left[j - r] * temp;
+    }
+    N[j] = saved;
+  }
+}
+
+//
+// Non-zero basis functions and their derivatives up to order at u in span
+// i, stored by rows in ders[k*(p+1) + j]. The scratch ndu holds (p+1)^2
+// values and a holds 2*(p+1). Derivatives above the degree are zero.
+//
+inline void
+dersBasisFuns(int i, double u, int p, int order, const double* U,
+              double* left, double* right, double* ndu, double* a,
+              double* ders)
+{
+  const int np = p + 1;
+  auto NDU = [ndu, np](int r, int c) -> double& { return ndu[r*np + c]; };
+  auto A   = [a,   np](int r, int c) -> double& { return a[r*np + c]; };
+
+  NDU(0,0) = 1.0;
+  for (int j = 1; j <= p; j++) {
+    left[j]  = u - U[i + 1 - j];
+    right[j] = U[i + j] - u;
+
+    double saved = 0.0;
+    for (int r = 0; r < j; r++) {
+      NDU(j,r) = right[r + 1] + left[j - r];
+      double temp = NDU(r,j - 1) / NDU(j,r);
+
+      NDU(r,j) = saved + right[r + 1] * temp;
+      saved = left[j - r] * temp;
+    }
+    NDU(j,j) = saved;
+  }
+
+  for (int j = 0; j <= p; j++)
+    ders[j] = NDU(j,p);
+
+  for (int k = p + 1; k <= order; k++)
+    for (int j = 0; j <= p; j++)
+      ders[k*np + j] = 0.0;
+
+  const int n = order < p ? order : p;
+  if (n == 0)
+    return;
+
+  for (int r = 0; r <= p; r++) {
+    int s1 = 0,
+        s2 = 1;
+
+    A(0,0) = 1.0;
+
+    for (int k = 1; k <= n; k++) {
+      double d = 0.;
+      int rk = r - k,
+          pk = p - k;
+
+      if (r >= k) {
+        A(s2,0) = A(s1,0) / NDU(pk + 1,rk);
+        d = A(s2,0) * NDU(rk,pk);
+      }
+
+      int j1 = rk >= -1 ? 1 : -rk;
+      int j2 = (r - 1 <= pk) ? k - 1 : p - r;
+
+      for (int j = j1; j <= j2; j++) {
+        A(s2,j) = (A(s1,j) - A(s1,j - 1)) / NDU(pk + 1,rk + j);
+        d += A(s2,j) * NDU(rk + j,pk);
+      }
+      if (r <= pk) {
+        A(s2,k) = -A(s1,k - 1) / NDU(pk + 1,r);
+        d += A(s2,k) * NDU(r,pk);
+      }
+      ders[k*np + r] = d;
+      std::swap(s1, s2);
+    }
+  }
+
+  int r = p;
+  for (int k = 1; k <= n; k++) {
+    for (int j = 0; j <= p; j++)
+      ders[k*np + j] *= r;
+    r *= (p - k);
+  }
+}
+
+
+template <int p>
+inline int
+FindSpan(int n, double u, const double* U)
+{
+  return findSpan(n, p, u, U);
+}
+
+template <int p>
+inline void
+BasisFuns(int i, double u, const double* U, double (&N)[p+1])
+{
+  double left[p+1], right[p+1];
+  basisFuns(i, u, p, U, left, right, N);
+}
+
+template <int p, int order>
+inline void
+DersBasisFuns(int i, double u, const double* U, double (&ders)[order+1][p+1])
+{
+  double left[p+1], right[p+1];
+  double ndu[(p+1)*(p+1)], a[2*(p+1)];
+  dersBasisFuns(i, u, p, order, U, left, right, ndu, a, &ders[0][0]);
+}
+
+
+//
+// Basis functions and derivatives of a knot vector tabulated at nq
+// quadrature points, given on [-1, 1], of each knot span of non-zero
+// length. Elements that integrate over fixed spans look the values up
+// instead of evaluating the recurrences at every iteration.
+//
+template <int p, int order, int nq>
+class BasisTable {
+public:
+  struct Span {
+    int    index;                      // knot span, first basis is index - p
+    double jacobian;                   // du/dxi of the span
+    double u[nq];                      // parametric coordinates
+    double ders[nq][order+1][p+1];     // ders[q][k][j]
+  };
+
+  BasisTable(int numKnots, const double* U, const double* xi)
+  {
+    const int n = numKnots - p - 2;
+    for (int i = p; i <= n; i++) {
+      if (U[i + 1] <= U[i])
+        continue;
+
+      Span span;
+      span.index    = i;
+      span.jacobian = 0.5 * (U[i + 1] - U[i]);
+      for (int q = 0; q < nq; q++) {
+        span.u[q] = 0.5 * (U[i + 1] + U[i]) + span.jacobian * xi[q];
+        DersBasisFuns<p, order>(i, span.u[q], U, span.ders[q]);
+      }
+      spans.push_back(span);
+    }
+  }
+
+  int
+  numSpans() const
+  {
+    return spans.size();
+  }
+
+  const Span&
+  operator[](int e) const
+  {
+    return spans[e];
+  }
+
+private:
+  std::vector<Span> spans;
+};
+
+} // namespace Nurbs
+} // namespace OpenSees
@@ -3,35 +3,16 @@
 //
 
 
-// 3D isoparametric 8-node element shape function
-//
-// 
-//    Purpose: Compute 3-d isoparametric 8-node element shape
-//             functions and their derivatives w/r x,y,z
+#include "shp3d.h"
 
-//    Inputs:
-//       xn[3]     - Natural coordinates of point
-//       xl[3][8]  - Nodal coordinates for element
+// Elements processed together by the batched routine
+static constexpr int batch = 8;
 
-//    Outputs:
-//       xsj        - Jacobian determinant at point
-//       shp[4][8]  - Shape functions and derivatives at point
-//                    shp[0][i] = dN_i/dx
-//                    shp[1][i] = dN_i/dy
-//                    shp[2][i] = dN_i/dzc
-//                    shp[3][i] =  N_i
-//
-void  shp3d( const double xn[3],
-	     double &xsj,
-	     double shp[4][8],
-             const double xl[3][8])
+// Shape functions and their natural derivatives at xn, in the layout of shp3d
+static void
+shp3n( const double xn[3], double shp[4][8] )
 {
-
-    double rxsj, ap1, am1, ap2, am2, ap3, am3, c1, c2, c3;
-
-    /* static */ double xs[3][3] ; 
-    /* static */ double ad[3][3] ;
-
+    double ap1, am1, ap2, am2, ap3, am3, c1, c2, c3;
 
       // Compute shape functions and their natural coord. derivatives
 
@@ -97,6 +78,38 @@ void  shp3d( const double xn[3],
       shp[2][5] =  c1 ;
       shp[3][1] =  c1*am3 ;
       shp[3][5] =  c1*ap3 ;
+}
+
+// 3D isoparametric 8-node element shape function
+//
+// 
+//    Purpose: Compute 3-d isoparametric 8-node element shape
+//             functions and their derivatives w/r x,y,z
+
+//    Inputs:
+//       xn[3]     - Natural coordinates of point
+//       xl[3][8]  - Nodal coordinates for element
+
+//    Outputs:
+//       xsj        - Jacobian determinant at point
+//       shp[4][8]  - Shape functions and derivatives at point
+//                    shp[0][i] = dN_i/dx
+//                    shp[1][i] = dN_i/dy
+//                    shp[2][i] = dN_i/dzc
+//                    shp[3][i] =  N_i
+//
+void  shp3d( const double xn[3],
+	     double &xsj,
+	     double shp[4][8],
+             const double xl[3][8])
+{
+
+    double rxsj, c1, c2, c3;
+
+    /* static */ double xs[3][3] ; 
+    /* static */ double ad[3][3] ;
+
+      shp3n( xn, shp ) ;
 
       // Compute jacobian transformation
 
@@ -151,11 +164,131 @@ void  shp3d( const double xn[3],
 
       for (int k=0; k<8; k++) {
 
-        shp[0][k] = shp[0][k]*xs[0][0] + shp[1][k]*xs[1][0] + shp[2][k]*xs[2][0] ;
-        shp[1][k] = shp[0][k]*xs[0][1] + shp[1][k]*xs[1][1] + shp[2][k]*xs[2][1] ;
-        shp[2][k] = shp[0][k]*xs[0][2] + shp[1][k]*xs[1][2] + shp[2][k]*xs[2][2] ;
+        c1 = shp[0][k]*xs[0][0] + shp[1][k]*xs[1][0] + shp[2][k]*xs[2][0] ;
+        c2 = shp[0][k]*xs[0][1] + shp[1][k]*xs[1][1] + shp[2][k]*xs[2][1] ;
+        c3 = shp[0][k]*xs[0][2] + shp[1][k]*xs[1][2] + shp[2][k]*xs[2][2] ;
+
+        shp[0][k] = c1 ;
+        shp[1][k] = c2 ;
+        shp[2][k] = c3 ;
 
       }
 
    return ;
 }
+
+
+void  shp3d( int nip, const double xi[][3], const double w[], Shp3dTable &table )
+{
+    double shp[4][8] ;
+
+    table.nen = 8 ;
+    table.nip = nip ;
+
+    for (int ip=0; ip<nip; ip++) {
+      shp3n( xi[ip], shp ) ;
+      for (int i=0; i<4; i++)
+        for (int a=0; a<8; a++)
+          table.shl[ip][i][a] = shp[i][a] ;
+      table.w[ip] = w[ip] ;
+    }
+}
+
+
+//
+// The elements are processed in groups of batch, with the element index
+// innermost in the local arrays so that the loops over a group vectorize.
+// A partial group is padded with copies of its last element.
+//
+void  shp3d( const Shp3dTable &table,
+	     int numElements,
+	     const double *xl,
+	     double *xsj,
+	     double *shp )
+{
+    const int nen = table.nen ;
+    const int nip = table.nip ;
+
+    alignas(64) double x[3][27][batch] ;
+    alignas(64) double xs[3][3][batch] ;
+    alignas(64) double ad[3][3][batch] ;
+    alignas(64) double rxsj[batch] ;
+    alignas(64) double g[3][batch] ;
+
+    for (int e0=0; e0<numElements; e0+=batch) {
+
+      const int nb = numElements - e0 < batch ? numElements - e0 : batch ;
+
+      for (int b=0; b<batch; b++) {
+        const double *xe = xl + (e0 + (b < nb ? b : nb-1))*3*nen ;
+        for (int i=0; i<3; i++)
+          for (int a=0; a<nen; a++)
+            x[i][a][b] = xe[i*nen + a] ;
+      }
+
+      for (int ip=0; ip<nip; ip++) {
+
+        const double (*shl)[27] = table.shl[ip] ;
+
+        // Compute jacobian transformation
+
+        for (int i=0; i<3; i++)
+          for (int j=0; j<3; j++) {
+            for (int b=0; b<batch; b++)
+              xs[i][j][b] = 0.0 ;
+            for (int a=0; a<nen; a++) {
+              const double c = shl[j][a] ;
+              for (int b=0; b<batch; b++)
+                xs[i][j][b] += x[i][a][b]*c ;
+            }
+          }
+
+        // Compute adjoint, determinant and inverse of jacobian
+
+        for (int b=0; b<batch; b++) {
+          ad[0][0][b] = xs[1][1][b]*xs[2][2][b] - xs[1][2][b]*xs[2][1][b] ;
+          ad[0][1][b] = xs[2][1][b]*xs[0][2][b] - xs[2][2][b]*xs[0][1][b] ;
+          ad[0][2][b] = xs[0][1][b]*xs[1][2][b] - xs[0][2][b]*xs[1][1][b] ;
+
+          ad[1][0][b] = xs[1][2][b]*xs[2][0][b] - xs[1][0][b]*xs[2][2][b] ;
+          ad[1][1][b] = xs[2][2][b]*xs[0][0][b] - xs[2][0][b]*xs[0][2][b] ;
+          ad[1][2][b] = xs[0][2][b]*xs[1][0][b] - xs[0][0][b]*xs[1][2][b] ;
+
+          ad[2][0][b] = xs[1][0][b]*xs[2][1][b] - xs[1][1][b]*xs[2][0][b] ;
+          ad[2][1][b] = xs[2][0][b]*xs[0][1][b] - xs[2][1][b]*xs[0][0][b] ;
+          ad[2][2][b] = xs[0][0][b]*xs[1][1][b] - xs[0][1][b]*xs[1][0][b] ;
+
+          rxsj[b] = xs[0][0][b]*ad[0][0][b] + xs[0][1][b]*ad[1][0][b]
+                  + xs[0][2][b]*ad[2][0][b] ;
+        }
+
+        for (int b=0; b<nb; b++)
+          xsj[(e0 + b)*nip + ip] = rxsj[b] ;
+
+        for (int b=0; b<batch; b++)
+          rxsj[b] = 1.0/rxsj[b] ;
+
+        for (int i=0; i<3; i++)
+          for (int j=0; j<3; j++)
+            for (int b=0; b<batch; b++)
+              ad[i][j][b] *= rxsj[b] ;
+
+        // Compute derivatives with respect to global coords.
+
+        for (int a=0; a<nen; a++) {
+          for (int j=0; j<3; j++)
+            for (int b=0; b<batch; b++)
+              g[j][b] = shl[0][a]*ad[0][j][b] + shl[1][a]*ad[1][j][b]
+                      + shl[2][a]*ad[2][j][b] ;
+
+          for (int b=0; b<nb; b++) {
+            double *se = shp + (e0 + b)*nip*4*nen + ip*4*nen ;
+            se[0*nen + a] = g[0][b] ;
+            se[1*nen + a] = g[1][b] ;
+            se[2*nen + a] = g[2][b] ;
+            se[3*nen + a] = shl[3][a] ;
+          }
+        }
+      }
+    }
+}
@@ -1,6 +1,38 @@
+#ifndef shp3d_h
+#define shp3d_h
 
 void  shp3d( const double ss[3],
 	     double &xsj,
 	     double shp[4][8],
 	     const double xl[3][8]  ) ;
 
+//
+// Shape functions of a brick and their natural derivatives tabulated at
+// the points of a quadrature rule, shl[ip][i][a] laid out as the shp
+// argument of shp3d. They are the same for every element that uses the
+// rule, so they are computed once and shared.
+//
+struct Shp3dTable {
+  int nen;                          // nodes per element, up to 27
+  int nip;                          // quadrature points, up to 27
+  alignas(64) double shl[27][4][27];
+  double w[27];
+};
+
+// Tabulate the 8-node brick at the natural coordinates xi[ip] with weights w
+void  shp3d( int nip, const double xi[][3], const double w[], Shp3dTable &table ) ;
+
+//
+// Jacobian determinants and global derivatives of numElements elements at
+// all points of a table. The nodal coordinates of element e are stored in
+// xl[e*3*nen + i*nen + a], the determinants are returned in xsj[e*nip + ip]
+// and the shape functions in shp[((e*nip + ip)*4 + i)*nen + a], laid out
+// as the output of shp3d.
+//
+void  shp3d( const Shp3dTable &table,
+	     int numElements,
+	     const double *xl,
+	     double *xsj,
+	     double *shp ) ;
+
+#endif
@@ -7,6 +7,7 @@
 //
 #include <stdio.h>
 #include <math.h>
+#include "shp3dv.h"
 
 void shap3dv(double *R, int *NP, double Q[27][4]){
 //
@@ -117,53 +118,33 @@ void shap3dv(double *R, int *NP, double Q[27][4]){
 
 
 
-int brcshl(double shl[4][20][27], double w[27], int nint, int nen) {
-/*
-
-     PROGRAM TO CALCULATE INTEGRATION-RULE WEIGHTS, SHAPE FUNCTIONS
-        AND LOCAL DERIVATIVES FOR A EIGHT-NODE BRICK ELEMENT
-
-
-             R,S,T = LOCAL ELEMENT COORD ("XI", "ETA", "ZETA" RESP.)
-
-        SHL(1,I,L) = LOCAL ("XI") DERIVATIVE OF SHAPE FUNCTION
-
-        SHL(2,I,L) = LOCAL ("ETA") DERIVATIVE OF SHAPE FUNCTION
-
-        SHL(3,I,L) = LOCAL ("ZETA") DERIVATIVE OF SHAPE FUNCTION
-
-        SHL(4,I,L) = LOCAL  SHAPE FUNCTION
-              W(L) = INTEGRATION-RULE WEIGHT
-                 I = LOCAL NODE NUMBER
-                 L = INTEGRATION POINT NUMBER
-
-              NINT = NUMBER OF INTEGRATION POINTS, EQ. 1, 8 OR 27
-
-*/
-
-
+//
+// Natural coordinates of the Gauss points in units of the rule spacing
+//
+static const double RA[27] = {-0.50, 0.50, 0.50,-0.50,-0.50, 0.50, 0.50,-0.50,
+                              0.00, 0.50, 0.00,-0.50, 0.00, 0.50, 0.00,-0.50,
+                             -0.50, 0.50, 0.50,-0.50, 0.50, 0.00, 0.00,-0.50,
+                              0.00, 0.00, 0.00};
 
-    double RA[27] = {-0.50, 0.50, 0.50,-0.50,-0.50, 0.50, 0.50,-0.50,
-                      0.00, 0.50, 0.00,-0.50, 0.00, 0.50, 0.00,-0.50,
-                     -0.50, 0.50, 0.50,-0.50, 0.50, 0.00, 0.00,-0.50,
-                      0.00, 0.00, 0.00};
+static const double SA[27] = {-0.50,-0.50, 0.50, 0.50,-0.50,-0.50, 0.50, 0.50,
+                             -0.50, 0.00, 0.50, 0.00,-0.50, 0.00, 0.50, 0.00,
+                             -0.50,-0.50, 0.50, 0.50, 0.00, 0.50, 0.00, 0.00,
+                             -0.50, 0.00, 0.00};
 
-    double SA[27] = {-0.50,-0.50, 0.50, 0.50,-0.50,-0.50, 0.50, 0.50,
-                     -0.50, 0.00, 0.50, 0.00,-0.50, 0.00, 0.50, 0.00,
-                     -0.50,-0.50, 0.50, 0.50, 0.00, 0.50, 0.00, 0.00,
-                     -0.50, 0.00, 0.00};     
+static const double TA[27] = {-0.50,-0.50,-0.50,-0.50, 0.50, 0.50, 0.50, 0.50,
+                             -0.50,-0.50,-0.50,-0.50, 0.50, 0.50, 0.50, 0.50,
+                              0.00, 0.00, 0.00, 0.00, 0.00, 0.00, 0.50, 0.00,
+                              0.00,-0.50, 0.00};
 
-    double TA[27] = {-0.50,-0.50,-0.50,-0.50, 0.50, 0.50, 0.50, 0.50,
-                     -0.50,-0.50,-0.50,-0.50, 0.50, 0.50, 0.50, 0.50,
-                      0.00, 0.00, 0.00, 0.00, 0.00, 0.00, 0.50, 0.00,
-                      0.00,-0.50, 0.00};        
+//
+// Weights, spacing and node flags of the 8 or 27 point Gauss rule
+//
+static int brcrule(double w[27], double &G, int nint, int nen, int NP[27]) {
 
     const double five9 = 0.5555555555555556, 
                 eight9 = 0.8888888888888889;
 
-    double G = 0., R[3], Q[27][4];
-
-    int NP[27];
+    G = 0.;
 
     w[0] = 8;
 
@@ -198,19 +179,46 @@ int brcshl(double shl[4][20][27], double w[27], int nint, int nen) {
         return -1;
     }
 
-
+    if ( nen < 8 || nen > 27 )
+        return -1;
 
     for (int i = 0; i < 27; i ++ )
-        NP[i] = 1;
+        NP[i] = i < nen ? 1 : 0;
+
+    return 0;
+}
 
-    if ( nen < 27) {
-        for (int i = nen; i < 27; i++ )
-            NP[i] = 0;
-    }
 
-    else if ( nen < 8 ) {
+int brcshl(double shl[4][20][27], double w[27], int nint, int nen) {
+/*
+
+     PROGRAM TO CALCULATE INTEGRATION-RULE WEIGHTS, SHAPE FUNCTIONS
+        AND LOCAL DERIVATIVES FOR A EIGHT-NODE BRICK ELEMENT
+
+
+             R,S,T = LOCAL ELEMENT COORD ("XI", "ETA", "ZETA" RESP.)
+
+        SHL(1,I,L) = LOCAL ("XI") DERIVATIVE OF SHAPE FUNCTION
+
+        SHL(2,I,L) = LOCAL ("ETA") DERIVATIVE OF SHAPE FUNCTION
+
+        SHL(3,I,L) = LOCAL ("ZETA") DERIVATIVE OF SHAPE FUNCTION
+
+        SHL(4,I,L) = LOCAL  SHAPE FUNCTION
+              W(L) = INTEGRATION-RULE WEIGHT
+                 I = LOCAL NODE NUMBER
+                 L = INTEGRATION POINT NUMBER
+
+              NINT = NUMBER OF INTEGRATION POINTS, EQ. 1, 8 OR 27
+
+*/
+    double G, R[3], Q[27][4];
+
+    int NP[27];
+
+    // shl holds at most 20 nodes
+    if ( nen > 20 || brcrule(w, G, nint, nen, NP) != 0 )
         return -1;
-    }
 
     for (int L = 0; L < nint; L++ ) {
 
@@ -229,3 +237,30 @@ int brcshl(double shl[4][20][27], double w[27], int nint, int nen) {
     return 0;
 }
 
+
+int brcshl(Shp3dTable &table, int nint, int nen) {
+
+    double G, R[3], Q[27][4];
+
+    int NP[27];
+
+    if ( brcrule(table.w, G, nint, nen, NP) != 0 )
+        return -1;
+
+    table.nen = nen;
+    table.nip = nint;
+
+    for (int L = 0; L < nint; L++ ) {
+
+        R[0] = G * RA[L];
+        R[1] = G * SA[L];
+        R[2] = G * TA[L];
+
+        shap3dv(R, NP, Q);
+
+        for (int i = 0; i < 4; i++ )
+            for (int j = 0; j < nen; j++)
+                table.shl[L][i][j] = Q[j][i];
+    }
+    return 0;
+}
@@ -2,6 +2,10 @@
 //          double &xsj,
 //          double shp[4][8],
 //          const double xl[3][8]  ) ;
+#include "shp3d.h"
 
+// Tabulate the 8 to 20 node brick at the 8 or 27 point Gauss rule
 int brcshl(double shl[4][20][27], double w[27], int nint, int nen);
 
+// Tabulate the 8 to 27 node brick at the 8 or 27 point Gauss rule
+int brcshl(Shp3dTable &table, int nint, int nen);
@@ -34,7 +34,7 @@ static int layout_array[] = {
     FrameStress::Qz
 };
 
-ID ElasticLinearFrameSection3d::layout(layout_array, nr);
+const ID ElasticLinearFrameSection3d::layout(layout_array, nr);
 
 
 ElasticLinearFrameSection3d::ElasticLinearFrameSection3d()
@@ -344,8 +344,8 @@ ElasticLinearFrameSection3d::getStressResultant()
 {
   #ifdef THREAD_SAFE 
   #else 
-  static VectorND<nr> s;
-  static Vector s_wrap(s);
+  thread_local VectorND<nr> s;
+  thread_local Vector s_wrap(s);
   #endif
   s = (*Ks)*e;
   return s_wrap;
@@ -407,7 +407,7 @@ ElasticLinearFrameSection3d::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(7);
+    Vector data(7);
 
     int dataTag = this->getDbTag();
 
@@ -435,7 +435,7 @@ ElasticLinearFrameSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
     int res = 0;
 
-      static Vector data(7);
+      Vector data(7);
 
     int dataTag = this->getDbTag();
 
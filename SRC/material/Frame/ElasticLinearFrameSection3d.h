@@ -152,7 +152,7 @@ class ElasticLinearFrameSection3d : public FrameSection
 
   int parameterID;
 
-  static ID layout;
+  static const ID layout;
   std::array<double, 2> centroid;
 };
 
@@ -32,14 +32,42 @@
 #include <FEM_ObjectBroker.h>
 #include <string.h>
 #include <elementAPI.h>
-
-Vector BeamFiberMaterial::stress(3);
-Matrix BeamFiberMaterial::tangent(3,3);
+#include <VectorND.h>
+#include <Vector3D.h>
+#include <Matrix3D.h>
+using namespace OpenSees;
 
 //      0  1  2  3  4  5
 // ND: 11 22 33 12 23 31
 // BF: 11 12 31 22 33 23
 
+// ND components of the beam and of the condensed strains
+static constexpr int inBeam[3]    = {0, 3, 5};
+static constexpr int condensed[3] = {1, 2, 4};
+
+// statically condense the condensed components out of a three dimensional tangent,
+// tangent = dd11 - dd12*dd22^-1*dd21
+static void
+condenseTangent(const Matrix &threeDtangent, Matrix &tangent)
+{
+  Matrix3D dd22;
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      dd22(i,j) = threeDtangent(condensed[i], condensed[j]);
+
+  for (int j = 0; j < 3; j++) {
+    Vector3D dd21, dd22invdd21;
+    for (int i = 0; i < 3; i++)
+      dd21[i] = threeDtangent(condensed[i], inBeam[j]);
+    dd22.solve(dd21, dd22invdd21);
+
+    for (int i = 0; i < 3; i++) {
+      tangent(i,j) = threeDtangent(inBeam[i], inBeam[j]);
+      for (int k = 0; k < 3; k++)
+        tangent(i,j) -= threeDtangent(inBeam[i], condensed[k])*dd22invdd21[k];
+    }
+  }
+}
 
 void * OPS_ADD_RUNTIME_VPV(OPS_BeamFiberMaterial)
 {
@@ -75,7 +103,7 @@ BeamFiberMaterial::BeamFiberMaterial(void)
 : NDMaterial(0, ND_TAG_BeamFiberMaterial),
 Tstrain22(0.0), Tstrain33(0.0), Tgamma23(0.0),
 Cstrain22(0.0), Cstrain33(0.0), Cgamma23(0.0),
-theMaterial(0), strain(3)
+theMaterial(0), strain(3), Cstrain(3), stress(3), tangent(3,3)
 {
         // Nothing to do
 }
@@ -84,7 +112,7 @@ BeamFiberMaterial::BeamFiberMaterial(int tag, NDMaterial &theMat)
 : NDMaterial(tag, ND_TAG_BeamFiberMaterial),
 Tstrain22(0.0), Tstrain33(0.0), Tgamma23(0.0),
 Cstrain22(0.0), Cstrain33(0.0), Cgamma23(0.0),
-theMaterial(0), strain(3)
+theMaterial(0), strain(3), Cstrain(3), stress(3), tangent(3,3)
 
 {
   // Get a copy of the material
@@ -114,6 +142,9 @@ BeamFiberMaterial::getCopy()
   theCopy->Cstrain22 = this->Cstrain22;
   theCopy->Cstrain33 = this->Cstrain33;
   theCopy->Cgamma23  = this->Cgamma23;
+  theCopy->strain    = this->strain;
+  theCopy->Cstrain   = this->Cstrain;
+  theCopy->predictor = this->predictor;
   
   return theCopy;
 }
@@ -145,6 +176,8 @@ BeamFiberMaterial::commitState(void)
   Cstrain22 = Tstrain22;
   Cstrain33 = Tstrain33;
   Cgamma23 = Tgamma23;
+  Cstrain  = strain;
+  predictor.commit();
 
   return theMaterial->commitState();
 }
@@ -155,7 +188,9 @@ BeamFiberMaterial::revertToLastCommit(void)
   Tstrain22 = Cstrain22;
   Tstrain33 = Cstrain33;
   Tgamma23 = Cgamma23;
-  
+  strain   = Cstrain;
+  predictor.revert();
+
   return theMaterial->revertToLastCommit();
 }
 
@@ -169,6 +204,10 @@ BeamFiberMaterial::revertToStart()
   this->Cstrain33 = 0.0;
   this->Cgamma23  = 0.0;
 
+  strain.Zero();
+  Cstrain.Zero();
+  predictor.zero();
+
   return theMaterial->revertToStart();
 }
 
@@ -185,34 +224,40 @@ BeamFiberMaterial::setTrialStrain(const Vector &strainFromElement)
 {
   static const double tolerance = 1.0e-08;
 
-  strain(0) = strainFromElement(0);
-  strain(1) = strainFromElement(1);
-  strain(2) = strainFromElement(2);
+  // Predict the condensed strains from the beam strain increment
+  double dstrain[3], dcondensed[3];
+  for (int j = 0; j < 3; j++) {
+    dstrain[j] = strainFromElement(j) - strain(j);
+    strain(j) = strainFromElement(j);
+  }
+  predictor.predict(dstrain, dcondensed);
+  this->Tstrain22 += dcondensed[0];
+  this->Tstrain33 += dcondensed[1];
+  this->Tgamma23  += dcondensed[2];
 
   //newton loop to solve for out-of-plane strains
 
   double norm;
-  static Vector condensedStress(3);
-  static Vector strainIncrement(3);
-  static Vector threeDstrain(6);
-  static Matrix dd22(3,3);
+  Vector3D condensedStress;
+  Vector3D strainIncrement;
+  VectorND<6> threeDstrain;
+  Matrix3D dd22;
 
   int count = 0;
   const int maxCount = 20;
-  double norm0;
 
   do {
 
     //set three dimensional strain
-    threeDstrain(0) = this->strain(0);
-    threeDstrain(1) = this->Tstrain22;
-    threeDstrain(2) = this->Tstrain33;
-    threeDstrain(3) = this->strain(1); 
-    threeDstrain(4) = this->Tgamma23;
-    threeDstrain(5) = this->strain(2);
+    threeDstrain[0] = this->strain(0);
+    threeDstrain[1] = this->Tstrain22;
+    threeDstrain[2] = this->Tstrain33;
+    threeDstrain[3] = this->strain(1); 
+    threeDstrain[4] = this->Tgamma23;
+    threeDstrain[5] = this->strain(2);
 
     if (theMaterial->setTrialStrain(threeDstrain) < 0) {
-      opserr << "BeamFiberMaterial::setTrialStrain - setStrain failed in material with strain " << threeDstrain;
+      opserr << "BeamFiberMaterial::setTrialStrain - setStrain failed in material with strain " << Vector(&threeDstrain[0], 6);
       return -1;   
     }
 
@@ -225,36 +270,30 @@ BeamFiberMaterial::setTrialStrain(const Vector &strainFromElement)
     //NDmaterial strain order        = 11, 22, 33, 12, 23, 31  
     //BeamFiberMaterial strain order = 11, 12, 31, 22, 33, 23
 
-    condensedStress(0) = threeDstress(1);
-    condensedStress(1) = threeDstress(2);
-    condensedStress(2) = threeDstress(4);
-
-    dd22(0,0) = threeDtangent(1,1);
-    dd22(1,0) = threeDtangent(2,1);
-    dd22(2,0) = threeDtangent(4,1);
-
-    dd22(0,1) = threeDtangent(1,2);
-    dd22(1,1) = threeDtangent(2,2);
-    dd22(2,1) = threeDtangent(4,2);
-
-    dd22(0,2) = threeDtangent(1,4);
-    dd22(1,2) = threeDtangent(2,4);
-    dd22(2,2) = threeDtangent(4,4);
+    for (int i = 0; i < 3; i++) {
+      condensedStress[i] = threeDstress(condensed[i]);
+      for (int j = 0; j < 3; j++)
+        dd22(i,j) = threeDtangent(condensed[i], condensed[j]);
+    }
 
     //set norm
-    norm = condensedStress.Norm();
-    if (count == 0)
-      norm0 = norm;
+    norm = condensedStress.norm();
+
+    // The material is left in the state of the accepted strain
+    if (norm <= tolerance) {
+      predictor.update(threeDtangent, condensed, inBeam);
+      break;
+    }
 
     //condensation 
-    dd22.Solve(condensedStress, strainIncrement);
+    dd22.solve(condensedStress, strainIncrement);
 
     //update out of plane strains
-    this->Tstrain22 -= strainIncrement(0);
-    this->Tstrain33 -= strainIncrement(1);
-    this->Tgamma23  -= strainIncrement(2);
+    this->Tstrain22 -= strainIncrement[0];
+    this->Tstrain33 -= strainIncrement[1];
+    this->Tgamma23  -= strainIncrement[2];
 
-  } while (count++ < maxCount && norm > tolerance);
+  } while (count++ < maxCount);
 
   return 0;
 }
@@ -289,7 +328,7 @@ BeamFiberMaterial::getStressSensitivity(int gradIndex,
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd12(3,3);
+  Matrix3D dd12;
   dd12(0,0) = threeDtangent(0,1);
   dd12(1,0) = threeDtangent(3,1);
   dd12(2,0) = threeDtangent(5,1);
@@ -303,7 +342,7 @@ BeamFiberMaterial::getStressSensitivity(int gradIndex,
   dd12(2,2) = threeDtangent(5,4);
 
 
-  static Matrix dd22(3,3);
+  Matrix3D dd22;
   dd22(0,0) = threeDtangent(1,1);
   dd22(1,0) = threeDtangent(2,1);
   dd22(2,0) = threeDtangent(4,1);
@@ -317,15 +356,17 @@ BeamFiberMaterial::getStressSensitivity(int gradIndex,
   dd22(2,2) = threeDtangent(4,4);
 
   
-  static Vector sigma2(3);
-  sigma2(0) = threeDstress(1);
-  sigma2(1) = threeDstress(2);
-  sigma2(2) = threeDstress(4);
+  Vector3D sigma2;
+  sigma2[0] = threeDstress(1);
+  sigma2[1] = threeDstress(2);
+  sigma2[2] = threeDstress(4);
 
-  static Vector dd22sigma2(3);
-  dd22.Solve(sigma2,dd22sigma2);
+  Vector3D dd22sigma2;
+  dd22.solve(sigma2, dd22sigma2);
 
-  stress.addMatrixVector(1.0, dd12, dd22sigma2, -1.0);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      stress(i) -= dd12(i,j)*dd22sigma2[j];
 
   return stress;
 }
@@ -335,70 +376,7 @@ BeamFiberMaterial::getTangent()
 {
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd11(3,3);
-  dd11(0,0) = threeDtangent(0,0);
-  dd11(1,0) = threeDtangent(3,0);
-  dd11(2,0) = threeDtangent(5,0);
-
-  dd11(0,1) = threeDtangent(0,3);
-  dd11(1,1) = threeDtangent(3,3);
-  dd11(2,1) = threeDtangent(5,3);
-
-  dd11(0,2) = threeDtangent(0,5);
-  dd11(1,2) = threeDtangent(3,5);
-  dd11(2,2) = threeDtangent(5,5);
-
-
-  static Matrix dd12(3,3);
-  dd12(0,0) = threeDtangent(0,1);
-  dd12(1,0) = threeDtangent(3,1);
-  dd12(2,0) = threeDtangent(5,1);
-
-  dd12(0,1) = threeDtangent(0,2);
-  dd12(1,1) = threeDtangent(3,2);
-  dd12(2,1) = threeDtangent(5,2);
-
-  dd12(0,2) = threeDtangent(0,4);
-  dd12(1,2) = threeDtangent(3,4);
-  dd12(2,2) = threeDtangent(5,4);
-
-  static Matrix dd21(3,3);
-  dd21(0,0) = threeDtangent(1,0);
-  dd21(1,0) = threeDtangent(2,0);
-  dd21(2,0) = threeDtangent(4,0);
-
-  dd21(0,1) = threeDtangent(1,3);
-  dd21(1,1) = threeDtangent(2,3);
-  dd21(2,1) = threeDtangent(4,3);
-
-  dd21(0,2) = threeDtangent(1,5);
-  dd21(1,2) = threeDtangent(2,5);
-  dd21(2,2) = threeDtangent(4,5);
-
-  static Matrix dd22(3,3);
-  dd22(0,0) = threeDtangent(1,1);
-  dd22(1,0) = threeDtangent(2,1);
-  dd22(2,0) = threeDtangent(4,1);
-
-  dd22(0,1) = threeDtangent(1,2);
-  dd22(1,1) = threeDtangent(2,2);
-  dd22(2,1) = threeDtangent(4,2);
-
-  dd22(0,2) = threeDtangent(1,4);
-  dd22(1,2) = threeDtangent(2,4);
-  dd22(2,2) = threeDtangent(4,4);
-
-
-  //int Solve(const Vector &V, Vector &res) const;
-  //int Solve(const Matrix &M, Matrix &res) const;
-  //condensation 
-  static Matrix dd22invdd21(3,3);
-  dd22.Solve(dd21, dd22invdd21);
-
-  //this->tangent   = dd11; 
-  //this->tangent  -= (dd12*dd22invdd21);
-  dd11.addMatrixProduct(1.0, dd12, dd22invdd21, -1.0);
-  tangent = dd11; 
+  condenseTangent(threeDtangent, tangent);
 
   return tangent;
 }
@@ -408,70 +386,7 @@ BeamFiberMaterial::getInitialTangent()
 {
   const Matrix &threeDtangent = theMaterial->getInitialTangent();
 
-  static Matrix dd11(3,3);
-  dd11(0,0) = threeDtangent(0,0);
-  dd11(1,0) = threeDtangent(3,0);
-  dd11(2,0) = threeDtangent(5,0);
-
-  dd11(0,1) = threeDtangent(0,3);
-  dd11(1,1) = threeDtangent(3,3);
-  dd11(2,1) = threeDtangent(5,3);
-
-  dd11(0,2) = threeDtangent(0,5);
-  dd11(1,2) = threeDtangent(3,5);
-  dd11(2,2) = threeDtangent(5,5);
-
-
-  static Matrix dd12(3,3);
-  dd12(0,0) = threeDtangent(0,1);
-  dd12(1,0) = threeDtangent(3,1);
-  dd12(2,0) = threeDtangent(5,1);
-
-  dd12(0,1) = threeDtangent(0,2);
-  dd12(1,1) = threeDtangent(3,2);
-  dd12(2,1) = threeDtangent(5,2);
-
-  dd12(0,2) = threeDtangent(0,4);
-  dd12(1,2) = threeDtangent(3,4);
-  dd12(2,2) = threeDtangent(5,4);
-
-  static Matrix dd21(3,3);
-  dd21(0,0) = threeDtangent(1,0);
-  dd21(1,0) = threeDtangent(2,0);
-  dd21(2,0) = threeDtangent(4,0);
-
-  dd21(0,1) = threeDtangent(1,3);
-  dd21(1,1) = threeDtangent(2,3);
-  dd21(2,1) = threeDtangent(4,3);
-
-  dd21(0,2) = threeDtangent(1,5);
-  dd21(1,2) = threeDtangent(2,5);
-  dd21(2,2) = threeDtangent(4,5);
-
-  static Matrix dd22(3,3);
-  dd22(0,0) = threeDtangent(1,1);
-  dd22(1,0) = threeDtangent(2,1);
-  dd22(2,0) = threeDtangent(4,1);
-
-  dd22(0,1) = threeDtangent(1,2);
-  dd22(1,1) = threeDtangent(2,2);
-  dd22(2,1) = threeDtangent(4,2);
-
-  dd22(0,2) = threeDtangent(1,4);
-  dd22(1,2) = threeDtangent(2,4);
-  dd22(2,2) = threeDtangent(4,4);
-
-
-  //int Solve(const Vector &V, Vector &res) const;
-  //int Solve(const Matrix &M, Matrix &res) const;
-  //condensation 
-  static Matrix dd22invdd21(3,3);
-  dd22.Solve(dd21, dd22invdd21);
-
-  //this->tangent   = dd11; 
-  //this->tangent  -= (dd12*dd22invdd21);
-  dd11.addMatrixProduct(1.0, dd12, dd22invdd21, -1.0);
-  tangent = dd11; 
+  condenseTangent(threeDtangent, tangent);
 
   return tangent;
 }
@@ -491,7 +406,7 @@ BeamFiberMaterial::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and associated materials class and database tags into an id and send it
-  static ID idData(3);
+  ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -508,7 +423,7 @@ BeamFiberMaterial::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(3);
+  Vector vecData(3);
   vecData(0) = Cstrain22;
   vecData(1) = Cstrain33;
   vecData(2) = Cgamma23;
@@ -533,7 +448,7 @@ BeamFiberMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   int res = 0;
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  ID idData(3);
   res = theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "BeamFiberMaterial::sendSelf() - failed to send id data\n";
@@ -557,7 +472,7 @@ BeamFiberMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(3);
+  Vector vecData(3);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     opserr << "BeamFiberMaterial::sendSelf() - failed to send vector data\n";
@@ -572,6 +487,9 @@ BeamFiberMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   Tstrain33 = Cstrain33;
   Tgamma23  = Cgamma23;
 
+  // The beam strains are not sent, so the prediction starts over
+  predictor.zero();
+
   // now receive the materials data
   res = theMaterial->recvSelf(commitTag, theChannel, theBroker);
   if (res < 0) 
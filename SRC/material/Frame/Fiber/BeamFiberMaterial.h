@@ -35,6 +35,7 @@
 #include <Matrix.h>
 #include <ID.h> 
 #include <NDMaterial.h>
+#include <CondensedStrainPredictor.h>
 
 class BeamFiberMaterial: public NDMaterial {
 
@@ -78,12 +79,16 @@ class BeamFiberMaterial: public NDMaterial {
     double Cstrain33;
     double Cgamma23;
 
+    // Predictor of the condensed strains from the beam strains
+    CondensedStrainPredictor<3,3> predictor;
+
     NDMaterial *theMaterial;
 
     Vector strain;
+    Vector Cstrain;
 
-    static Vector stress;
-    static Matrix tangent;
+    Vector stress;
+    Matrix tangent;
 };
 
 
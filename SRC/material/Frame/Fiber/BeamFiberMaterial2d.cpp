@@ -32,8 +32,8 @@
 #include <string.h>
 #include <elementAPI.h>
 
-Vector BeamFiberMaterial2d::stress(2);
-Matrix BeamFiberMaterial2d::tangent(2,2);
+thread_local Vector BeamFiberMaterial2d::stress(2);
+thread_local Matrix BeamFiberMaterial2d::tangent(2,2);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_BeamFiberMaterial2d)
 {
@@ -197,10 +197,10 @@ BeamFiberMaterial2d::setTrialStrain(const Vector &strainFromElement)
   //newton loop to solve for out-of-plane strains
 
   double norm;
-  static Vector condensedStress(4);
-  static Vector strainIncrement(4);
-  static Vector threeDstrain(6);
-  static Matrix dd22(4,4);
+  thread_local Vector condensedStress(4);
+  thread_local Vector strainIncrement(4);
+  thread_local Vector threeDstrain(6);
+  thread_local Matrix dd22(4,4);
 
   int count = 0;
   const int maxCount = 20;
@@ -299,7 +299,7 @@ BeamFiberMaterial2d::getStressSensitivity(int gradIndex,
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd12(2,4);
+  thread_local Matrix dd12(2,4);
   dd12(0,0) = threeDtangent(0,1);
   dd12(1,0) = threeDtangent(3,1);
 
@@ -313,7 +313,7 @@ BeamFiberMaterial2d::getStressSensitivity(int gradIndex,
   dd12(1,3) = threeDtangent(3,5);
 
 
-  static Matrix dd22(4,4);
+  thread_local Matrix dd22(4,4);
   dd22(0,0) = threeDtangent(1,1);
   dd22(1,0) = threeDtangent(2,1);
   dd22(2,0) = threeDtangent(4,1);
@@ -334,13 +334,13 @@ BeamFiberMaterial2d::getStressSensitivity(int gradIndex,
   dd22(2,3) = threeDtangent(4,5);
   dd22(3,3) = threeDtangent(5,5);
   
-  static Vector sigma2(4);
+  thread_local Vector sigma2(4);
   sigma2(0) = threeDstress(1);
   sigma2(1) = threeDstress(2);
   sigma2(2) = threeDstress(4);
   sigma2(3) = threeDstress(5);
 
-  static Vector dd22sigma2(4);
+  thread_local Vector dd22sigma2(4);
   dd22.Solve(sigma2,dd22sigma2);
 
   stress.addMatrixVector(1.0, dd12, dd22sigma2, -1.0);
@@ -352,11 +352,11 @@ int
 BeamFiberMaterial2d::commitSensitivity(const Vector &depsdh, int gradIndex,
                                        int numGrads)
 {
-  static Vector dstraindh(6);
+  thread_local Vector dstraindh(6);
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd22(4,4);
+  thread_local Matrix dd22(4,4);
   dd22(0,0) = threeDtangent(1,1);
   dd22(1,0) = threeDtangent(2,1);
   dd22(2,0) = threeDtangent(4,1);
@@ -377,7 +377,7 @@ BeamFiberMaterial2d::commitSensitivity(const Vector &depsdh, int gradIndex,
   dd22(2,3) = threeDtangent(4,5);
   dd22(3,3) = threeDtangent(5,5);
 
-  static Matrix dd21(4,2);
+  thread_local Matrix dd21(4,2);
   dd21(0,0) = threeDtangent(1,0);
   dd21(1,0) = threeDtangent(2,0);
   dd21(2,0) = threeDtangent(4,0);
@@ -388,7 +388,7 @@ BeamFiberMaterial2d::commitSensitivity(const Vector &depsdh, int gradIndex,
   dd21(2,1) = threeDtangent(4,3);
   dd21(3,1) = threeDtangent(5,3);
   
-  static Vector sigma2(4);
+  thread_local Vector sigma2(4);
   sigma2.addMatrixVector(0.0, dd21, depsdh, -1.0);
 
   const Vector &threeDstress = theMaterial->getStressSensitivity(gradIndex, true);
@@ -406,7 +406,7 @@ BeamFiberMaterial2d::commitSensitivity(const Vector &depsdh, int gradIndex,
   //sigma2(3) += threeDstress2(5);
 
 
-  static Vector strain2(4);
+  thread_local Vector strain2(4);
   dd22.Solve(sigma2,strain2);
 
 
@@ -425,7 +425,7 @@ BeamFiberMaterial2d::getTangent()
 {
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd11(2,2);
+  thread_local Matrix dd11(2,2);
   dd11(0,0) = threeDtangent(0,0);
   dd11(1,0) = threeDtangent(3,0);
 
@@ -433,7 +433,7 @@ BeamFiberMaterial2d::getTangent()
   dd11(1,1) = threeDtangent(3,3);
 
 
-  static Matrix dd12(2,4);
+  thread_local Matrix dd12(2,4);
   dd12(0,0) = threeDtangent(0,1);
   dd12(1,0) = threeDtangent(3,1);
 
@@ -447,7 +447,7 @@ BeamFiberMaterial2d::getTangent()
   dd12(1,3) = threeDtangent(3,5);
 
 
-  static Matrix dd21(4,2);
+  thread_local Matrix dd21(4,2);
   dd21(0,0) = threeDtangent(1,0);
   dd21(1,0) = threeDtangent(2,0);
   dd21(2,0) = threeDtangent(4,0);
@@ -459,7 +459,7 @@ BeamFiberMaterial2d::getTangent()
   dd21(3,1) = threeDtangent(5,3);
 
 
-  static Matrix dd22(4,4);
+  thread_local Matrix dd22(4,4);
   dd22(0,0) = threeDtangent(1,1);
   dd22(1,0) = threeDtangent(2,1);
   dd22(2,0) = threeDtangent(4,1);
@@ -484,7 +484,7 @@ BeamFiberMaterial2d::getTangent()
   //int Solve(const Vector &V, Vector &res) const;
   //int Solve(const Matrix &M, Matrix &res) const;
   //condensation 
-  static Matrix dd22invdd21(4,2);
+  thread_local Matrix dd22invdd21(4,2);
   dd22.Solve(dd21, dd22invdd21);
 
   //this->tangent   = dd11; 
@@ -500,7 +500,7 @@ BeamFiberMaterial2d::getInitialTangent()
 {
   const Matrix &threeDtangent = theMaterial->getInitialTangent();
 
-  static Matrix dd11(2,2);
+  thread_local Matrix dd11(2,2);
   dd11(0,0) = threeDtangent(0,0);
   dd11(1,0) = threeDtangent(3,0);
 
@@ -508,7 +508,7 @@ BeamFiberMaterial2d::getInitialTangent()
   dd11(1,1) = threeDtangent(3,3);
 
 
-  static Matrix dd12(2,4);
+  thread_local Matrix dd12(2,4);
   dd12(0,0) = threeDtangent(0,1);
   dd12(1,0) = threeDtangent(3,1);
 
@@ -522,7 +522,7 @@ BeamFiberMaterial2d::getInitialTangent()
   dd12(1,3) = threeDtangent(3,5);
 
 
-  static Matrix dd21(4,2);
+  thread_local Matrix dd21(4,2);
   dd21(0,0) = threeDtangent(1,0);
   dd21(1,0) = threeDtangent(2,0);
   dd21(2,0) = threeDtangent(4,0);
@@ -534,7 +534,7 @@ BeamFiberMaterial2d::getInitialTangent()
   dd21(3,1) = threeDtangent(5,3);
 
 
-  static Matrix dd22(4,4);
+  thread_local Matrix dd22(4,4);
   dd22(0,0) = threeDtangent(1,1);
   dd22(1,0) = threeDtangent(2,1);
   dd22(2,0) = threeDtangent(4,1);
@@ -558,7 +558,7 @@ BeamFiberMaterial2d::getInitialTangent()
   //int Solve(const Vector &V, Vector &res) const;
   //int Solve(const Matrix &M, Matrix &res) const;
   //condensation 
-  static Matrix dd22invdd21(4,2);
+  thread_local Matrix dd22invdd21(4,2);
   dd22.Solve(dd21, dd22invdd21);
 
   //this->tangent   = dd11; 
@@ -584,7 +584,7 @@ BeamFiberMaterial2d::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and associated materials class and database tags into an id and send it
-  static ID idData(3);
+  ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -601,7 +601,7 @@ BeamFiberMaterial2d::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(4);
+  Vector vecData(4);
   vecData(0) = Cstrain22;
   vecData(1) = Cstrain33;
   vecData(2) = Cgamma31;
@@ -627,7 +627,7 @@ BeamFiberMaterial2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   int res = 0;
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  ID idData(3);
   res = theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "BeamFiberMaterial2d::sendSelf() - failed to send id data\n";
@@ -651,7 +651,7 @@ BeamFiberMaterial2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(4);
+  Vector vecData(4);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     opserr << "BeamFiberMaterial2d::sendSelf() - failed to send vector data\n";
@@ -84,8 +84,8 @@ class BeamFiberMaterial2dPS: public NDMaterial {
 
     Vector strain;
 
-    static Vector stress;
-    static Matrix tangent;
+    static thread_local Vector stress;
+    static thread_local Matrix tangent;
 };
 
 
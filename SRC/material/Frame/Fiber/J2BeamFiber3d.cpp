@@ -39,8 +39,8 @@
 #include <string.h>
 #include <stdlib.h>
 
-Vector J2BeamFiber3d::sigma(3);
-Matrix J2BeamFiber3d::D(3,3);
+thread_local Vector J2BeamFiber3d::sigma(3);
+thread_local Matrix J2BeamFiber3d::D(3,3);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_J2BeamFiber3dMaterial)
 {
@@ -188,13 +188,13 @@ J2BeamFiber3d::getTangent (void)
     // Solve for dg
     double dg = 0.0;
 
-    static Vector R(4);
+    thread_local Vector R(4);
     R(0) = 0.0; R(1) = 0.0; R(2) = 0.0; R(3) = F;
-    static Vector x(4);
+    thread_local Vector x(4);
     x(0) = xsi[0]; x(1) = xsi[1]; x(2) = xsi[2]; x(3) = dg;
 
-    static Matrix J(4,4);
-    static Vector dx(4);
+    thread_local Matrix J(4,4);
+    thread_local Vector dx(4);
 
     int iter = 0; int maxIter = 25;
     while (iter < maxIter && R.Norm() > sigmaY*1.0e-14) {
@@ -264,7 +264,7 @@ J2BeamFiber3d::getTangent (void)
     //J(2,2) = -q*two3Hkin/(1.0+dg*two3Hkin) - root23*Hiso;
     J(3,3) = -q*two3Hkin/(1.0+dg*two3Hkin) - two3*Hiso*q;
 
-    static Matrix invJ(4,4);
+    thread_local Matrix invJ(4,4);
     J.Invert(invJ);
 
     D(0,0) = invJ(0,0)*E;
@@ -330,13 +330,13 @@ J2BeamFiber3d::getStress (void)
     // Solve for dg
     double dg = 0.0;
 
-    static Vector R(4);
+    thread_local Vector R(4);
     R(0) = 0.0; R(1) = 0.0; R(2) = 0.0; R(3) = F;
-    static Vector x(4);
+    thread_local Vector x(4);
     x(0) = xsi[0]; x(1) = xsi[1]; x(2) = xsi[2]; x(3) = dg;
 
-    static Matrix J(4,4);
-    static Vector dx(4);
+    thread_local Matrix J(4,4);
+    thread_local Vector dx(4);
 
     int iter = 0; int maxIter = 25;
     while (iter < maxIter && R.Norm() > sigmaY*1.0e-14) {
@@ -479,7 +479,7 @@ J2BeamFiber3d::getOrder (void) const
 const Vector&
 J2BeamFiber3d::getStressSensitivity(int gradIndex, bool conditional)
 {
-  static Vector sigma(3);
+  thread_local Vector sigma(3);
 
   sigma(0) = 0.0;
   sigma(1) = 0.0;
@@ -537,9 +537,9 @@ J2BeamFiber3d::getStressSensitivity(int gradIndex, bool conditional)
     sigma(2) = dGdh*(Tepsilon(2)-epsPn1[2]) - G*depsPdh[2];
   }
   else {
-    static Matrix J(4,4);
-    static Vector b(4);
-    static Vector dx(4);
+    thread_local Matrix J(4,4);
+    thread_local Vector b(4);
+    thread_local Vector dx(4);
 
     double dg = dg_n1;
 
@@ -642,9 +642,9 @@ J2BeamFiber3d::commitSensitivity(const Vector &depsdh, int gradIndex, int numGra
     // Do nothing
   }
   else {
-    static Matrix J(4,4);
-    static Vector b(4);
-    static Vector dx(4);
+    thread_local Matrix J(4,4);
+    thread_local Vector b(4);
+    thread_local Vector dx(4);
 
     double dg = dg_n1;
 
@@ -691,7 +691,7 @@ J2BeamFiber3d::sendSelf (int commitTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(6);
+  Vector data(6);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -715,7 +715,7 @@ J2BeamFiber3d::recvSelf (int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(6);
+  Vector data(6);
   
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -13,6 +13,7 @@
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
+#include <vector>
 
 #include <Channel.h>
 #include <Vector.h>
@@ -32,7 +33,14 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 // #include <threads/thread_pool.hpp>
 // #define N_FIBER_THREADS 6
 
-ID FrameFiberSection3d::code(4);
+static int code_array[] = {
+  SECTION_RESPONSE_P,	// 0  0
+  SECTION_RESPONSE_MZ,	// 1  5
+  SECTION_RESPONSE_MY,	// 2  4
+  SECTION_RESPONSE_T	// 3  3
+};
+
+const ID FrameFiberSection3d::code(code_array, 4);
 
 FrameFiberSection3d::FrameFiberSection3d(int tag, int num, UniaxialMaterial &torsion, bool compCentroid, 
                                          double mass, bool use_mass)
@@ -59,11 +67,6 @@ FrameFiberSection3d::FrameFiberSection3d(int tag, int num, UniaxialMaterial &tor
     es.zero();
     sr.zero();
     ks.zero();
-
-    code(0) = SECTION_RESPONSE_P;  // 0  0
-    code(1) = SECTION_RESPONSE_MZ; // 1  5
-    code(2) = SECTION_RESPONSE_MY; // 2  4
-    code(3) = SECTION_RESPONSE_T;  // 3  3
 }
 
 
@@ -84,11 +87,6 @@ FrameFiberSection3d::FrameFiberSection3d():
   es.zero();
   sr.zero();
   ks.zero();
-
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_T;
 }
 
 
@@ -311,14 +309,69 @@ int
 FrameFiberSection3d::setTrialSectionDeformation(const Vector &deforms)
 {
   e = deforms;
- 
-  sr.zero();
-  ks.zero();
 
-  const double e0 = deforms(0), // u'
-               k1 = deforms(1),
-               k2 = deforms(2),
-               e3 = deforms(3);
+  return this->stateDetermination<nsr, FrameLayouts::NMMT>(es, sr, ks);
+}
+#endif
+
+// The resultants of the section are ordered as N-Mz-My-T, so the element
+// state is that of the section
+int
+FrameFiberSection3d::setTrialLayout(NMMT, const OpenSees::VectorND<nsr>& deforms)
+{
+  es = deforms;
+  return this->FrameFiberSection3d::setTrialSectionDeformation(e);
+}
+
+OpenSees::VectorND<4>
+FrameFiberSection3d::getLayoutResultant(NMMT)
+{
+  return sr;
+}
+
+OpenSees::MatrixND<4,4>
+FrameFiberSection3d::getLayoutTangent(NMMT, State state)
+{
+  if (state != State::Init)
+    return ks;
+
+  const Matrix &k0 = this->FrameFiberSection3d::getInitialTangent();
+  OpenSees::MatrixND<nsr,nsr> ki;
+  for (int i=0; i<nsr; i++)
+    for (int j=0; j<nsr; j++)
+      ki(i,j) = k0(i,j);
+  return ki;
+}
+
+template <int n, const FrameStressLayout& layout>
+int
+FrameFiberSection3d::stateDetermination(const OpenSees::VectorND<n>& deforms,
+                                        OpenSees::VectorND<n>& sl,
+                                        OpenSees::MatrixND<n,n>& kl)
+{
+  // Positions of the resultants, -1 for those the layout omits
+  constexpr int iN = LayoutIndex(layout, FrameStress::N),
+                iz = LayoutIndex(layout, FrameStress::Mz),
+                iy = LayoutIndex(layout, FrameStress::My),
+                iT = LayoutIndex(layout, FrameStress::T);
+
+  double e0 = 0.0, // u'
+         k1 = 0.0,
+         k2 = 0.0,
+         e3 = 0.0;
+  if constexpr (iN != -1) e0 = deforms[iN];
+  if constexpr (iz != -1) k1 = deforms[iz];
+  if constexpr (iy != -1) k2 = deforms[iy];
+  if constexpr (iT != -1) e3 = deforms[iT];
+
+  // Keep the N-Mz-My-T deformations for the sensitivity computations
+  es[0] = e0;
+  es[1] = k1;
+  es[2] = k2;
+  es[3] = e3;
+
+  sl.zero();
+  kl.zero();
 
   int res = 0;
   for (int i = 0; i < numFibers; i++) {
@@ -333,44 +386,174 @@ FrameFiberSection3d::setTrialSectionDeformation(const Vector &deforms)
     res += theMaterials[i]->setTrial(strain, stress, tangent);
 
     double EA     = tangent * A;
+    double fs0    = stress * A;
 
-    ks( 0, 0) +=     EA;
-    ks( 0, 1) +=  -y*EA;
-    ks( 0, 2) +=   z*EA;
-//  ks( 0, 2) +=   z*EA;
-
-    ks( 1, 1) +=  y*y*EA; // 5
-    ks( 2, 2) +=  z*z*EA; // 10
-    ks( 1, 2) += -y*z*EA;
-
-    double fs0 = stress * A;
-    sr[0] +=    fs0;  // N
-    sr[1] += -y*fs0;  // Mz
-    sr[2] +=  z*fs0;  // My
+    if constexpr (iN != -1) {
+      kl(iN, iN) +=     EA;
+      sl[iN]     +=    fs0;  // N
+    }
+    if constexpr (iN != -1 && iz != -1)
+      kl(iN, iz) +=  -y*EA;
+    if constexpr (iN != -1 && iy != -1)
+      kl(iN, iy) +=   z*EA;
+
+    if constexpr (iz != -1) {
+      kl(iz, iz) +=  y*y*EA;
+      sl[iz]     += -y*fs0;  // Mz
+    }
+    if constexpr (iy != -1) {
+      kl(iy, iy) +=  z*z*EA;
+      sl[iy]     +=  z*fs0;  // My
+    }
+    if constexpr (iz != -1 && iy != -1)
+      kl(iz, iy) += -y*z*EA;
   }
 
-  ks(1, 0) = ks(0, 1);
-  ks(2, 0) = ks(0, 2);
-  ks(2, 1) = ks(1, 2);
- 
-  if (theTorsion != nullptr) {
-    double stress, tangent;
-    res += theTorsion->setTrial(e3, stress, tangent);
-    sr[ 3] = stress;
-    ks(3, 3) = tangent;
+  if constexpr (iN != -1 && iz != -1)
+    kl(iz, iN) = kl(iN, iz);
+  if constexpr (iN != -1 && iy != -1)
+    kl(iy, iN) = kl(iN, iy);
+  if constexpr (iz != -1 && iy != -1)
+    kl(iy, iz) = kl(iz, iy);
+
+  if constexpr (iT != -1) {
+    if (theTorsion != nullptr) {
+      double stress, tangent;
+      res += theTorsion->setTrial(e3, stress, tangent);
+      sl[iT]     = stress;
+      kl(iT, iT) = tangent;
+    }
   }
 
   return res;
 }
-#endif
+
+namespace {
+//
+// FrameFiberSection3d with its resultants ordered by the layout of an
+// element, so that the fiber loop accumulates directly into fixed
+// positions and the entry points of FrameSection for the layout need no
+// index matching.
+//
+template <const FrameStressLayout& layout>
+class LayoutFiberSection3d : public FrameFiberSection3d
+{
+  public:
+    constexpr static int nr = LayoutSize(layout);
+
+    LayoutFiberSection3d()
+    : FrameFiberSection3d(),
+      code(nr),
+      ew(el), sw(sl), kw(kl), kiw(ki),
+      dsw(dsl), dkw(dkl), dew(del)
+    {
+      el.zero();
+      sl.zero();
+      kl.zero();
+      ki.zero();
+      dsl.zero();
+      dkl.zero();
+      del.zero();
+      for (int i=0; i<nr; i++)
+        code(i) = layout[i];
+    }
+
+    int setTrialSectionDeformation(const Vector &deforms) {
+      for (int i=0; i<nr; i++)
+        el[i] = deforms(i);
+      return this->stateDetermination<nr, layout>(el, sl, kl);
+    }
+
+    const Vector &getSectionDeformation() {return ew;}
+    const Vector &getStressResultant() {return sw;}
+    const Matrix &getSectionTangent() {return kw;}
+
+    const Matrix &getInitialTangent() {
+      constexpr int index[nsr] = {
+        LayoutIndex(layout, FrameStress::N),
+        LayoutIndex(layout, FrameStress::Mz),
+        LayoutIndex(layout, FrameStress::My),
+        LayoutIndex(layout, FrameStress::T)
+      };
+      const Matrix &k0 = FrameFiberSection3d::getInitialTangent();
+      ki.zero();
+      for (int i=0; i<nsr; i++)
+        for (int j=0; j<nsr; j++)
+          if (index[i] != -1 && index[j] != -1)
+            ki(index[i], index[j]) = k0(i, j);
+      return kiw;
+    }
+
+    const ID &getType() {return code;}
+    int getOrder() const {return nr;}
+
+    // Sensitivities in the order of the layout
+    const Vector &getStressResultantSensitivity(int gradIndex, bool conditional) {
+      this->stressSensitivity<nr, layout>(gradIndex, conditional, dsl);
+      return dsw;
+    }
+
+    const Matrix &getSectionTangentSensitivity(int gradIndex) {
+      this->tangentSensitivity<nr, layout>(gradIndex, dkl);
+      return dkw;
+    }
+
+    int commitSensitivity(const Vector& defSens, int gradIndex, int numGrads) {
+      return this->commitLayoutSensitivity<nr, layout>(defSens, gradIndex, numGrads);
+    }
+
+    const Vector &getSectionDeformationSensitivity(int gradIndex) {
+      return dew;
+    }
+
+    FrameSection *getFrameCopy() {
+      LayoutFiberSection3d *theCopy = new LayoutFiberSection3d();
+      if (this->copyInto(theCopy) == nullptr)
+        return nullptr;
+      theCopy->el = el;
+      theCopy->sl = sl;
+      theCopy->kl = kl;
+      return theCopy;
+    }
+
+  protected:
+    using FrameSection::setTrialLayout;
+    using FrameSection::getLayoutResultant;
+    using FrameSection::getLayoutTangent;
+
+    int setTrialLayout(FrameLayouts::Tag<layout>, const OpenSees::VectorND<nr>& deforms) override {
+      el = deforms;
+      return this->stateDetermination<nr, layout>(el, sl, kl);
+    }
+
+    OpenSees::VectorND<nr> getLayoutResultant(FrameLayouts::Tag<layout>) override {
+      return sl;
+    }
+
+    OpenSees::MatrixND<nr,nr> getLayoutTangent(FrameLayouts::Tag<layout>, State state) override {
+      if (state == State::Init) {
+        this->getInitialTangent();
+        return ki;
+      }
+      return kl;
+    }
+
+  private:
+    ID code;
+    OpenSees::VectorND<nr> el, sl, dsl, del;
+    OpenSees::MatrixND<nr,nr> kl, ki, dkl;
+    Vector ew, sw, dsw, dew;
+    Matrix kw, kiw, dkw;
+};
+} // namespace
 
 
 
 const Matrix&
 FrameFiberSection3d::getInitialTangent()
 {
-  static double kInitialData[16];
-  static Matrix kInitial(kInitialData, 4, 4);
+  thread_local double kInitialData[16];
+  thread_local Matrix kInitial(kInitialData, 4, 4);
   
   kInitial.Zero();
 
@@ -427,7 +610,30 @@ FrameFiberSection3d::getStressResultant()
 FrameSection*
 FrameFiberSection3d::getFrameCopy()
 {
-  FrameFiberSection3d *theCopy = new FrameFiberSection3d();
+  return this->copyInto(new FrameFiberSection3d());
+}
+
+FrameSection*
+FrameFiberSection3d::getFrameCopy(const FrameStressLayout& layout)
+{
+  FrameFiberSection3d *theCopy = nullptr;
+
+  if (SameLayout(layout, FrameLayouts::NMM))
+    theCopy = new LayoutFiberSection3d<FrameLayouts::NMM>();
+  else if (SameLayout(layout, FrameLayouts::NMMVVT))
+    theCopy = new LayoutFiberSection3d<FrameLayouts::NMMVVT>();
+  else if (SameLayout(layout, FrameLayouts::NMMTB))
+    theCopy = new LayoutFiberSection3d<FrameLayouts::NMMTB>();
+  else
+    // including N-Mz-My-T, the order of the section itself
+    return this->getFrameCopy();
+
+  return this->copyInto(theCopy);
+}
+
+FrameFiberSection3d*
+FrameFiberSection3d::copyInto(FrameFiberSection3d *theCopy)
+{
   theCopy->setTag(this->getTag());
   theCopy->numFibers  = numFibers;
   theCopy->sizeFibers = numFibers;
@@ -534,7 +740,7 @@ FrameFiberSection3d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   // size 5 so no conflict with matData below if just 2 fibers
-  static ID data(5);
+  ID data(5);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = (theTorsion != 0) ? 1 : 0;
@@ -597,7 +803,7 @@ FrameFiberSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(5);
+  ID data(5);
 
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -1050,7 +1256,7 @@ FrameFiberSection3d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FrameFiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(4);
+  thread_local Vector dummy(4);
   
   dummy.Zero();
   
@@ -1061,17 +1267,31 @@ FrameFiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FrameFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(4);
-  
-  ds.Zero();
-  
+  thread_local Vector ds(4);
+
+  OpenSees::VectorND<nsr> dsl;
+  this->stressSensitivity<nsr, FrameLayouts::NMMT>(gradIndex, conditional, dsl);
+  for (int i = 0; i < nsr; i++)
+    ds(i) = dsl[i];
+
+  return ds;
+}
+
+template <int n, const FrameStressLayout& layout>
+void
+FrameFiberSection3d::stressSensitivity(int gradIndex, bool conditional,
+                                       OpenSees::VectorND<n>& dsl)
+{
+  // N-Mz-My-T sensitivities
+  double ds[nsr] {};
+
   double stress = 0;
   double dsigdh = 0;
   double sig_dAdh = 0;
   double tangent = 0;
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  std::vector<double> dydh(numFibers);
+  std::vector<double> dzdh(numFibers);
+  std::vector<double> areaDeriv(numFibers);
 #if 0
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, dydh, dzdh);  
@@ -1092,9 +1312,9 @@ FrameFiberSection3d::getStressResultantSensitivity(int gradIndex, bool condition
     
     dsigdh = theMaterials[i]->getStressSensitivity(gradIndex, conditional);
 
-    ds(0) += dsigdh*A;
-    ds(1) += -y*dsigdh*A;
-    ds(2) +=  z*dsigdh*A;
+    ds[0] += dsigdh*A;
+    ds[1] += -y*dsigdh*A;
+    ds[2] +=  z*dsigdh*A;
 
     if (areaDeriv[i] != 0.0 || dydh[i] != 0.0 ||  dzdh[i] != 0.0)
       stress = theMaterials[i]->getStress();
@@ -1105,66 +1325,105 @@ FrameFiberSection3d::getStressResultantSensitivity(int gradIndex, bool condition
     if (areaDeriv[i] != 0.0) {
       sig_dAdh = stress*areaDeriv[i];
       
-      ds(0) += sig_dAdh;
-      ds(1) += -y*sig_dAdh;
-      ds(2) +=  z*sig_dAdh;
+      ds[0] += sig_dAdh;
+      ds[1] += -y*sig_dAdh;
+      ds[2] +=  z*sig_dAdh;
     }
 
     if (dydh[i] != 0.0)
-      ds(1) += -dydh[i] * (stress*A);
+      ds[1] += -dydh[i] * (stress*A);
 
     if (dzdh[i] != 0.0)
-      ds(2) +=  dzdh[i] * (stress*A);
+      ds[2] +=  dzdh[i] * (stress*A);
 
-    static Matrix as(1,3);
+    thread_local Matrix as(1,3);
     as(0,0) = 1;
     as(0,1) = -y;
     as(0,2) = z;
     
-    static Matrix dasdh(1,3);
+    thread_local Matrix dasdh(1,3);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     
-    static Matrix tmpMatrix(3,3);
+    thread_local Matrix tmpMatrix(3,3);
     tmpMatrix.addMatrixTransposeProduct(0.0, as, dasdh, tangent);
     
     //ds.addMatrixVector(1.0, tmpMatrix, e, A);
-    ds(0) += (tmpMatrix(0,0)*e(0) + tmpMatrix(0,1)*e(1) + tmpMatrix(0,2)*e(2))*A;
-    ds(1) += (tmpMatrix(1,0)*e(0) + tmpMatrix(1,1)*e(1) + tmpMatrix(1,2)*e(2))*A;
-    ds(2) += (tmpMatrix(2,0)*e(0) + tmpMatrix(2,1)*e(1) + tmpMatrix(2,2)*e(2))*A;
+    ds[0] += (tmpMatrix(0,0)*es[0] + tmpMatrix(0,1)*es[1] + tmpMatrix(0,2)*es[2])*A;
+    ds[1] += (tmpMatrix(1,0)*es[0] + tmpMatrix(1,1)*es[1] + tmpMatrix(1,2)*es[2])*A;
+    ds[2] += (tmpMatrix(2,0)*es[0] + tmpMatrix(2,1)*es[1] + tmpMatrix(2,2)*es[2])*A;
   }
 
-  ds(3) = theTorsion->getStressSensitivity(gradIndex, conditional);
-
-  return ds;
+  if (theTorsion != nullptr)
+    ds[3] = theTorsion->getStressSensitivity(gradIndex, conditional);
+
+  // Order them by the layout
+  constexpr int index[nsr] = {
+    LayoutIndex(layout, FrameStress::N),
+    LayoutIndex(layout, FrameStress::Mz),
+    LayoutIndex(layout, FrameStress::My),
+    LayoutIndex(layout, FrameStress::T)
+  };
+  dsl.zero();
+  for (int i = 0; i < nsr; i++)
+    if (index[i] != -1)
+      dsl[index[i]] = ds[i];
 }
 
 const Matrix &
 FrameFiberSection3d::getSectionTangentSensitivity(int gradIndex)
 {
-  static Matrix something(nsr,nsr);
-  
-  something.Zero();
+  thread_local Matrix something(nsr,nsr);
 
-  something(3,3) = theTorsion->getTangentSensitivity(gradIndex);
+  OpenSees::MatrixND<nsr,nsr> dkl;
+  this->tangentSensitivity<nsr, FrameLayouts::NMMT>(gradIndex, dkl);
+  for (int i = 0; i < nsr; i++)
+    for (int j = 0; j < nsr; j++)
+      something(i,j) = dkl(i,j);
   
   return something;
 }
 
+template <int n, const FrameStressLayout& layout>
+void
+FrameFiberSection3d::tangentSensitivity(int gradIndex, OpenSees::MatrixND<n,n>& dkl)
+{
+  constexpr int iT = LayoutIndex(layout, FrameStress::T);
+
+  dkl.zero();
+
+  if constexpr (iT != -1)
+    if (theTorsion != nullptr)
+      dkl(iT,iT) = theTorsion->getTangentSensitivity(gradIndex);
+}
+
 
 int
 FrameFiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numGrads)
 {
+  return this->commitLayoutSensitivity<nsr, FrameLayouts::NMMT>(defSens, gradIndex, numGrads);
+}
 
-  double d0 = defSens(0);
-  double d1 = defSens(1);
-  double d2 = defSens(2);
-  double d3 = defSens(3);
+template <int n, const FrameStressLayout& layout>
+int
+FrameFiberSection3d::commitLayoutSensitivity(const Vector& defSens, int gradIndex, int numGrads)
+{
+  // Positions of the deformations, -1 for those the layout omits
+  constexpr int iN = LayoutIndex(layout, FrameStress::N),
+                iz = LayoutIndex(layout, FrameStress::Mz),
+                iy = LayoutIndex(layout, FrameStress::My),
+                iT = LayoutIndex(layout, FrameStress::T);
+
+  double d0 = 0.0, d1 = 0.0, d2 = 0.0, d3 = 0.0;
+  if constexpr (iN != -1) d0 = defSens(iN);
+  if constexpr (iz != -1) d1 = defSens(iz);
+  if constexpr (iy != -1) d2 = defSens(iy);
+  if constexpr (iT != -1) d3 = defSens(iT);
 
   //dedh = defSens;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  std::vector<double> yLocs(numFibers);
+  std::vector<double> zLocs(numFibers);
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1173,8 +1432,8 @@ FrameFiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
+  std::vector<double> dydh(numFibers);
+  std::vector<double> dzdh(numFibers);
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1191,12 +1450,14 @@ FrameFiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int
     double z = zLocs[i] - zBar;
 
     // determine material strain and set it
-    depsdh = d0 - y*d1 + z*d2 - dydh[i]*e(1) + dzdh[i]*e(2);
+    depsdh = d0 - y*d1 + z*d2 - dydh[i]*es[1] + dzdh[i]*es[2];
 
     theMaterials[i]->commitSensitivity(depsdh,gradIndex,numGrads);
   }
 
-  theTorsion->commitSensitivity(d3, gradIndex, numGrads);
+  if constexpr (iT != -1)
+    if (theTorsion != nullptr)
+      theTorsion->commitSensitivity(d3, gradIndex, numGrads);
 
   return 0;
 }
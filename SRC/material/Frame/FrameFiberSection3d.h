@@ -52,6 +52,7 @@ class FrameFiberSection3d : public FrameSection
     int   revertToStart();
  
     FrameSection *getFrameCopy();
+    FrameSection *getFrameCopy(const FrameStressLayout& layout);
     const ID &getType();
     int getOrder () const; //  {return 4;};
  
@@ -81,6 +82,33 @@ class FrameFiberSection3d : public FrameSection
     constexpr static int nsr = 4;
     constexpr static int nwm = 3;
 
+    // Sum the fiber contributions to the resultants and tangent, which
+    // are ordered by a layout of the section deformations
+    template <int n, const FrameStressLayout& layout>
+    int stateDetermination(const OpenSees::VectorND<n>& deforms,
+                           OpenSees::VectorND<n>& sl,
+                           OpenSees::MatrixND<n,n>& kl);
+
+    // Sensitivities of the resultants and tangent, and commit of the
+    // sensitivities of the deformations, in the order of a layout
+    template <int n, const FrameStressLayout& layout>
+    void stressSensitivity(int gradIndex, bool conditional, OpenSees::VectorND<n>& dsl);
+    template <int n, const FrameStressLayout& layout>
+    void tangentSensitivity(int gradIndex, OpenSees::MatrixND<n,n>& dkl);
+    template <int n, const FrameStressLayout& layout>
+    int commitLayoutSensitivity(const Vector& defSens, int gradIndex, int numGrads);
+
+    // The section is ordered as N-Mz-My-T
+    using FrameSection::setTrialLayout;
+    using FrameSection::getLayoutResultant;
+    using FrameSection::getLayoutTangent;
+    int setTrialLayout(NMMT, const OpenSees::VectorND<nsr>& deforms) override;
+    OpenSees::VectorND<nsr> getLayoutResultant(NMMT) override;
+    OpenSees::MatrixND<nsr,nsr> getLayoutTangent(NMMT, State state) override;
+
+    // Copy the fibers and state of this section into a blank section
+    FrameFiberSection3d *copyInto(FrameFiberSection3d *theCopy);
+
   private:
     struct FiberData {
       double y;
@@ -102,7 +130,7 @@ class FrameFiberSection3d : public FrameSection
     double zBar;
     bool computeCentroid;
 
-    static ID code;
+    static const ID code;
 
     OpenSees::VectorND<nsr> es, sr;
     Vector  e;         // trial section deformations 
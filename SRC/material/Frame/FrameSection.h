@@ -5,6 +5,7 @@
 //===----------------------------------------------------------------------===//
 //
 #pragma once
+#include <type_traits>
 #include <State.h>
 #include <Field.h>
 #include <material/section/SectionForceDeformation.h>
@@ -85,6 +86,69 @@ WarpIndex(const int n, const FrameStressLayout& layout) {
   return L;
 }
 
+// Number of stress resultants in a layout, which is terminated by
+// FrameStress::End
+static inline constexpr int
+LayoutSize(const FrameStressLayout& layout) {
+  int n = 0;
+  while (n < FrameStress::Max && layout[n] != FrameStress::End)
+    n++;
+  return n;
+}
+
+// Position of a stress resultant in a layout, or -1 if it is absent
+static inline constexpr int
+LayoutIndex(const FrameStressLayout& layout, int stress) {
+  for (int i=0; i<LayoutSize(layout); i++)
+    if (layout[i] == stress)
+      return i;
+  return -1;
+}
+
+static inline constexpr bool
+SameLayout(const FrameStressLayout& a, const FrameStressLayout& b) {
+  for (int i=0; i<FrameStress::Max; i++) {
+    if (a[i] != b[i])
+      return false;
+    if (a[i] == FrameStress::End)
+      break;
+  }
+  return true;
+}
+
+// Layouts of the common frame elements. Sections may return copies that
+// are specialized for these from getFrameCopy(layout), which override the
+// entry points of FrameSection for their layout.
+namespace FrameLayouts {
+  inline constexpr FrameStressLayout NMM {
+    FrameStress::N, FrameStress::Mz, FrameStress::My
+  };
+  inline constexpr FrameStressLayout NMMT {
+    FrameStress::N, FrameStress::Mz, FrameStress::My, FrameStress::T
+  };
+  // with shear
+  inline constexpr FrameStressLayout NMMVVT {
+    FrameStress::N,  FrameStress::Mz, FrameStress::My,
+    FrameStress::Vy, FrameStress::Vz, FrameStress::T
+  };
+  // with warping
+  inline constexpr FrameStressLayout NMMTB {
+    FrameStress::N, FrameStress::Mz, FrameStress::My, FrameStress::T,
+    FrameStress::Bimoment, FrameStress::Bishear
+  };
+
+  template <const FrameStressLayout& layout>
+  struct Tag {};
+
+  // Tag of the common layout equal to scheme, void for any other layout
+  template <const FrameStressLayout& scheme>
+  using TagOf =
+    std::conditional_t<SameLayout(scheme, NMM),    Tag<NMM>,
+    std::conditional_t<SameLayout(scheme, NMMT),   Tag<NMMT>,
+    std::conditional_t<SameLayout(scheme, NMMVVT), Tag<NMMVVT>,
+    std::conditional_t<SameLayout(scheme, NMMTB),  Tag<NMMTB>, void>>>>;
+}
+
 class FrameSection : public SectionForceDeformation {
 
 public:
@@ -94,6 +158,8 @@ public:
   {}
 
   virtual FrameSection* getFrameCopy() =0;
+  // Copies returned for a layout may order their resultants by that
+  // layout and override its entry points below
   virtual FrameSection* getFrameCopy(const FrameStressLayout& layout) {
     return getFrameCopy();
   }
@@ -114,13 +180,95 @@ public:
     return -1;
   }
 
+  // State in the order of the element layout scheme. The common layouts
+  // are dispatched at compile time to their entry points, any other is
+  // matched against getType()
   template <int n, const FrameStressLayout& scheme>
-  int setTrialState(OpenSees::VectorND<n, double> e);
-
+  int setTrialState(OpenSees::VectorND<n, double> e) {
+    using Tag = FrameLayouts::TagOf<scheme>;
+    if constexpr (!std::is_void_v<Tag> && LayoutSize(scheme) == n)
+      return this->setTrialLayout(Tag{}, e);
+    else
+      return this->setTrialMatched<n,scheme>(e);
+  }
 
   template <int n, const FrameStressLayout& scheme>
   OpenSees::VectorND<n> 
   getResultant() {
+    using Tag = FrameLayouts::TagOf<scheme>;
+    if constexpr (!std::is_void_v<Tag> && LayoutSize(scheme) == n)
+      return this->getLayoutResultant(Tag{});
+    else
+      return this->getResultantMatched<n,scheme>();
+  }
+
+  template <int n, const FrameStressLayout& scheme>
+  OpenSees::MatrixND<n,n> getTangent(State state) {
+    using Tag = FrameLayouts::TagOf<scheme>;
+    if constexpr (!std::is_void_v<Tag> && LayoutSize(scheme) == n)
+      return this->getLayoutTangent(Tag{}, state);
+    else
+      return this->getTangentMatched<n,scheme>(state);
+  }
+
+  template <int n, const FrameStressLayout& scheme>
+  OpenSees::MatrixND<n,n, double> getFlexibility(State state=State::Pres);
+
+protected:
+  using NMM    = FrameLayouts::Tag<FrameLayouts::NMM>;
+  using NMMT   = FrameLayouts::Tag<FrameLayouts::NMMT>;
+  using NMMVVT = FrameLayouts::Tag<FrameLayouts::NMMVVT>;
+  using NMMTB  = FrameLayouts::Tag<FrameLayouts::NMMTB>;
+
+  // Entry points for the common layouts. A section whose resultants are
+  // ordered by one of them, and which condenses any resultants that the
+  // layout omits, overrides those of the layout.
+  virtual int setTrialLayout(NMM, const OpenSees::VectorND<3>& e) {
+    return this->setTrialMatched<3,FrameLayouts::NMM>(e);
+  }
+  virtual int setTrialLayout(NMMT, const OpenSees::VectorND<4>& e) {
+    return this->setTrialMatched<4,FrameLayouts::NMMT>(e);
+  }
+  virtual int setTrialLayout(NMMVVT, const OpenSees::VectorND<6>& e) {
+    return this->setTrialMatched<6,FrameLayouts::NMMVVT>(e);
+  }
+  virtual int setTrialLayout(NMMTB, const OpenSees::VectorND<6>& e) {
+    return this->setTrialMatched<6,FrameLayouts::NMMTB>(e);
+  }
+
+  virtual OpenSees::VectorND<3> getLayoutResultant(NMM) {
+    return this->getResultantMatched<3,FrameLayouts::NMM>();
+  }
+  virtual OpenSees::VectorND<4> getLayoutResultant(NMMT) {
+    return this->getResultantMatched<4,FrameLayouts::NMMT>();
+  }
+  virtual OpenSees::VectorND<6> getLayoutResultant(NMMVVT) {
+    return this->getResultantMatched<6,FrameLayouts::NMMVVT>();
+  }
+  virtual OpenSees::VectorND<6> getLayoutResultant(NMMTB) {
+    return this->getResultantMatched<6,FrameLayouts::NMMTB>();
+  }
+
+  virtual OpenSees::MatrixND<3,3> getLayoutTangent(NMM, State state) {
+    return this->getTangentMatched<3,FrameLayouts::NMM>(state);
+  }
+  virtual OpenSees::MatrixND<4,4> getLayoutTangent(NMMT, State state) {
+    return this->getTangentMatched<4,FrameLayouts::NMMT>(state);
+  }
+  virtual OpenSees::MatrixND<6,6> getLayoutTangent(NMMVVT, State state) {
+    return this->getTangentMatched<6,FrameLayouts::NMMVVT>(state);
+  }
+  virtual OpenSees::MatrixND<6,6> getLayoutTangent(NMMTB, State state) {
+    return this->getTangentMatched<6,FrameLayouts::NMMTB>(state);
+  }
+
+  // State in the order of a layout, matched by the codes of getType()
+  template <int n, const FrameStressLayout& scheme>
+  int setTrialMatched(OpenSees::VectorND<n, double> e);
+
+  template <int n, const FrameStressLayout& scheme>
+  OpenSees::VectorND<n> 
+  getResultantMatched() {
 
     OpenSees::VectorND<n> sout;
 
@@ -140,7 +288,7 @@ public:
   }
 
   template <int n, const FrameStressLayout& scheme>
-  OpenSees::MatrixND<n,n> getTangent(State state) {
+  OpenSees::MatrixND<n,n> getTangentMatched(State state) {
 
     OpenSees::MatrixND<n,n> kout;
 
@@ -225,9 +373,6 @@ public:
     return kout;
   }
 
-  template <int n, const FrameStressLayout& scheme>
-  OpenSees::MatrixND<n,n, double> getFlexibility(State state=State::Pres);
-
 private:
   double density;
   bool has_mass;
@@ -235,7 +380,7 @@ private:
 
 template <int n, const FrameStressLayout& scheme>
 int 
-FrameSection::setTrialState(OpenSees::VectorND<n, double> e) {
+FrameSection::setTrialMatched(OpenSees::VectorND<n, double> e) {
   double strain_data[FrameStress::Max]{};
 
   const int m = this->getOrder();
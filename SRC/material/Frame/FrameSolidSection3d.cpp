@@ -34,7 +34,22 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 
 using namespace OpenSees;
 
-ID FrameSolidSection3d::code(nsr);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_VY,
+  SECTION_RESPONSE_VZ,
+  SECTION_RESPONSE_T,
+  SECTION_RESPONSE_MY,
+  SECTION_RESPONSE_MZ,
+  FrameStress::Bimoment,
+  FrameStress::By,
+  FrameStress::Bz,
+  FrameStress::Bishear,
+  FrameStress::Qy,
+  FrameStress::Qz
+};
+
+const ID FrameSolidSection3d::code(code_array, nsr);
 
 FrameSolidSection3d::FrameSolidSection3d(int tag, int num): 
     FrameSection(tag, SEC_TAG_FrameSolidSection3d),
@@ -43,18 +58,6 @@ FrameSolidSection3d::FrameSolidSection3d(int tag, int num):
     fibers(new std::vector<FiberData>),
     K_init(new Tangent)
 {
-  code(inx) = SECTION_RESPONSE_P;
-  code(iny) = SECTION_RESPONSE_VY;
-  code(inz) = SECTION_RESPONSE_VZ;
-  code(imx) = SECTION_RESPONSE_T;
-  code(imy) = SECTION_RESPONSE_MY;
-  code(imz) = SECTION_RESPONSE_MZ;
-  code(iwx) = FrameStress::Bimoment;
-  code(iwy) = FrameStress::By;
-  code(iwz) = FrameStress::Bz;
-  code(ivx) = FrameStress::Bishear;
-  code(ivy) = FrameStress::Qy;
-  code(ivz) = FrameStress::Qz;
 }
 
 // constructor for blank object that recvSelf needs to be invoked upon
@@ -64,18 +67,6 @@ FrameSolidSection3d::FrameSolidSection3d():
   parameterID(0), dedh(nsr),
   fibers(new std::vector<FiberData>)
 {
-  code(inx) = SECTION_RESPONSE_P;
-  code(iny) = SECTION_RESPONSE_VY;
-  code(inz) = SECTION_RESPONSE_VZ;
-  code(imx) = SECTION_RESPONSE_T;
-  code(imy) = SECTION_RESPONSE_MY;
-  code(imz) = SECTION_RESPONSE_MZ;
-  code(iwx) = FrameStress::Bimoment;
-  code(iwy) = FrameStress::By;
-  code(iwz) = FrameStress::Bz;
-  code(ivx) = FrameStress::Bishear;
-  code(ivy) = FrameStress::Qy;
-  code(ivz) = FrameStress::Qz;
 }
 
 int
@@ -335,8 +326,8 @@ FrameSolidSection3d::getSectionDeformation()
 const Matrix&
 FrameSolidSection3d::getInitialTangent()
 {
-  static double kInitial[nsr*nsr];
-  static Matrix ksi(kInitial, nsr, nsr);
+  thread_local double kInitial[nsr*nsr];
+  thread_local Matrix ksi(kInitial, nsr, nsr);
 
   ksi.Zero();
   this->stateDetermination(*K_init, nullptr, nullptr, InitialTangent);
@@ -364,7 +355,7 @@ const Matrix&
 FrameSolidSection3d::getSectionTangent()
 {
 #ifndef SEES_SECTION_THREADS
-  static Matrix K_wrap(nsr, nsr);
+  thread_local Matrix K_wrap(nsr, nsr);
 #endif
   K_wrap.Zero();
   K_wrap.Assemble(K_pres.nn, 0, 0, 1.0);
@@ -761,19 +752,19 @@ FrameSolidSection3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FrameSolidSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(nsr);
+  thread_local Vector ds(nsr);
   
   ds.Zero();
   
-  static Vector stress(3);
-  static Vector dsigdh(3);
-  static Vector sig_dAdh(3);
-  static Matrix tangent(3,3);
-
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  thread_local Vector stress(3);
+  thread_local Vector dsigdh(3);
+  thread_local Vector sig_dAdh(3);
+  thread_local Matrix tangent(3,3);
+
   const int nf = fibers->size();
+  std::vector<double> dydh(nf);
+  std::vector<double> dzdh(nf);
+  std::vector<double> areaDeriv(nf);
 
   for (int i = 0; i < nf; i++) {
     const double y = (*fibers)[i].r[1]; // - yBar;
@@ -832,7 +823,7 @@ FrameSolidSection3d::getStressResultantSensitivity(int gradIndex, bool condition
     as(1,5) = -z;
     as(2,5) =  y;
     
-    static Matrix dasdh(3,nsr);
+    thread_local Matrix dasdh(3,nsr);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     dasdh(1,3) = 0;
@@ -840,7 +831,7 @@ FrameSolidSection3d::getStressResultantSensitivity(int gradIndex, bool condition
     dasdh(1,5) = -dzdh[i];
     dasdh(2,5) = dydh[i];
     
-    static Matrix tmpMatrix(nsr,nsr);
+    thread_local Matrix tmpMatrix(nsr,nsr);
     tmpMatrix.addMatrixTripleProduct(0.0, as, tangent, dasdh, 1.0);
     
     ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -852,7 +843,7 @@ FrameSolidSection3d::getStressResultantSensitivity(int gradIndex, bool condition
 const Matrix &
 FrameSolidSection3d::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(6,6);
+  thread_local Matrix dksdh(6,6);
   
   dksdh.Zero();
   return dksdh;
@@ -871,9 +862,9 @@ FrameSolidSection3d::commitSensitivity(const Vector& defSens,
 
   dedh = defSens;
 
-  static double dydh[10000];
-  static double dzdh[10000];
   const int nf = fibers->size();
+  std::vector<double> dydh(nf);
+  std::vector<double> dzdh(nf);
   
   { // TODO
     for (int i = 0; i < nf; i++) {
@@ -882,7 +873,7 @@ FrameSolidSection3d::commitSensitivity(const Vector& defSens,
     }
   }
 
-  static Vector depsdh(3);
+  thread_local Vector depsdh(3);
 
 
   for (int i = 0; i < nf; i++) {
@@ -156,7 +156,7 @@ class FrameSolidSection3d : public FrameSection
     double zBar;                      // Section centroid
 
 
-    static ID code;
+    static const ID code;
 
     int parameterID;
     Vector dedh;
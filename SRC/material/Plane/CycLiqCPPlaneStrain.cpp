@@ -40,9 +40,9 @@
 
 
 //static vectors and matrices
-Vector CycLiqCPPlaneStrain :: strain_vec(3) ;
-Vector CycLiqCPPlaneStrain :: stress_vec(3) ;
-Matrix CycLiqCPPlaneStrain :: tangent_matrix(3,3) ;
+thread_local Vector CycLiqCPPlaneStrain :: strain_vec(3) ;
+thread_local Vector CycLiqCPPlaneStrain :: stress_vec(3) ;
+thread_local Matrix CycLiqCPPlaneStrain :: tangent_matrix(3,3) ;
 
 //null constructor
 CycLiqCPPlaneStrain :: CycLiqCPPlaneStrain() :
@@ -120,7 +120,7 @@ int CycLiqCPPlaneStrain :: setTrialStrain( const Vector &v, const Vector &r )
 
 int CycLiqCPPlaneStrain :: setTrialStrainIncr( const Vector &v ) 
 {
-  static Vector newStrain(3);
+  thread_local Vector newStrain(3);
   newStrain(0) = strain_nplus1(0,0) + v(0);
   newStrain(1) = strain_nplus1(1,1) + v(1);
   newStrain(2) = 2.0*strain_nplus1(0,1) + v(2);
@@ -219,7 +219,7 @@ CycLiqCPPlaneStrain::sendSelf(int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(20+9*3);
+  Vector data(20+9*3);
   int cnt = 0;
   data(cnt++) = this->getTag();
 
@@ -269,7 +269,7 @@ CycLiqCPPlaneStrain::recvSelf (int commitTag, Channel &theChannel,
 {
 
   // recv the vector object from the channel which defines material param and state
-  static Vector data(20+9*3);
+  Vector data(20+9*3);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "CycLiqCP::recvSelf - failed to recv vector from channel\n";
     return -1;
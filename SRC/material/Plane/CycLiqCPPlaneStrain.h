@@ -107,9 +107,9 @@ class CycLiqCPPlaneStrain : public CycLiqCP {
   private:
 
   //static vectors and matrices sent back in get functions
-  static Vector strain_vec ;     //strain in vector notation
-  static Vector stress_vec ;     //stress in vector notation
-  static Matrix tangent_matrix ; //material tangent in matrix notation
+  static thread_local Vector strain_vec ;     //strain in vector notation
+  static thread_local Vector stress_vec ;     //stress in vector notation
+  static thread_local Matrix tangent_matrix ; //material tangent in matrix notation
 
 } ; //end of CycLiqCPPlaneStrain declarations
 
@@ -49,9 +49,9 @@
 #include <FEM_ObjectBroker.h>
 #include <Logging.h>
 //static vectors and matrices
-Vector J2PlaneStrain :: strain_vec(3) ;
-Vector J2PlaneStrain :: stress_vec(3) ;
-Matrix J2PlaneStrain :: tangent_matrix(3,3) ;
+thread_local Vector J2PlaneStrain :: strain_vec(3) ;
+thread_local Vector J2PlaneStrain :: stress_vec(3) ;
+thread_local Matrix J2PlaneStrain :: tangent_matrix(3,3) ;
 
 
 //null constructor
@@ -146,7 +146,7 @@ int J2PlaneStrain :: setTrialStrain( const Vector &v, const Vector &r )
 
 int J2PlaneStrain :: setTrialStrainIncr( const Vector &v ) 
 {
-  static Vector newStrain(3);
+  thread_local Vector newStrain(3);
   newStrain(0) = strain(0,0) + v(0);
   newStrain(1) = strain(1,1) + v(1);
   newStrain(2) = 2.0 * strain(0,1) + v(2);
@@ -267,7 +267,7 @@ J2PlaneStrain::sendSelf (int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(19);
+  Vector data(19);
   int cnt = 0;
   data(cnt++) = this->getTag();
   data(cnt++) = bulk;
@@ -300,7 +300,7 @@ J2PlaneStrain::recvSelf (int commitTag, Channel &theChannel,
 {
 
   // recv the vector object from the channel which defines material param and state
-  static Vector data(19);
+  Vector data(19);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "J2PlaneStrain::recvSelf - failed to sned vectorto channel\n";
     return -1;
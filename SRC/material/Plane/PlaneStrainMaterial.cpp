@@ -71,14 +71,10 @@ void * OPS_ADD_RUNTIME_VPV(OPS_PlaneStrain)
     return mat;
 }
 
-//static vector and matrices
-Vector  PlaneStrainMaterial::stress(3) ;
-Matrix  PlaneStrainMaterial::tangent(3,3) ;
-
 //null constructor
 PlaneStrainMaterial::PlaneStrainMaterial( ) : 
 NDMaterial(0, ND_TAG_PlaneStrainMaterial ), 
-strain(3) 
+strain(3), stress(3), tangent(3,3)
 {
 }
 
@@ -87,7 +83,7 @@ strain(3)
 PlaneStrainMaterial::PlaneStrainMaterial(    
 				   int tag, NDMaterial &the3DMaterial ) :
 NDMaterial( tag, ND_TAG_PlaneStrainMaterial ),
-strain(3)
+strain(3), stress(3), tangent(3,3)
 {
   theMaterial = the3DMaterial.getCopy("ThreeDimensional");
   if (theMaterial == 0) {
@@ -307,7 +303,7 @@ PlaneStrainMaterial::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and associated materials class and database tags into an id and send it
-  static ID idData(3);
+  ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -337,7 +333,7 @@ PlaneStrainMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   int res = 0;
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  ID idData(3);
   res = theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "PlaneStrainMaterial::sendSelf() - failed to send id data\n";
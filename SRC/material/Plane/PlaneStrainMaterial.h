@@ -96,8 +96,8 @@ private :
     NDMaterial *theMaterial ;  //pointer to three dimensional material
 
     Vector strain ;
-    static Vector stress ;
-    static Matrix tangent ;
+    Vector stress ;
+    Matrix tangent ;
 
 } ;
 
@@ -87,9 +87,9 @@ class PlaneStressLayeredMaterial : public NDMaterial {
     NDMaterial **theFibers;  //pointers to the materials (fibers)
 
     Vector strain;
-    static Vector stress;
-    static Matrix tangent ;
-    static ID array ;  
+    static thread_local Vector stress;
+    static thread_local Matrix tangent ;
+    static const ID array;  
 
 } ; //end of PlaneStressLayeredMaterial declarations
 
@@ -36,19 +36,45 @@
 #include <Vector.h>
 #include <Vector3D.h>
 #include <Matrix3D.h>
+#include <VectorND.h>
 using namespace OpenSees;
-//static vector and matrices
-Vector  PlaneStressMaterial::stress(3) ;
-Matrix  PlaneStressMaterial::tangent(3,3) ;
 
 //      0  1  2  3  4  5
 // ND: 11 22 33 12 23 31
 // PS: 11 22 12 33 23 31
 
+// ND components of the in plane and of the condensed strains
+static constexpr int inPlane[3]   = {0, 1, 3};
+static constexpr int condensed[3] = {2, 4, 5};
+
+// statically condense the out of plane components out of a three dimensional tangent,
+// tangent = dd11 - dd12*dd22^-1*dd21
+static void
+condenseTangent(const Matrix &threeDtangent, Matrix &tangent)
+{
+  Matrix3D dd22;
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      dd22(i,j) = threeDtangent(condensed[i], condensed[j]);
+
+  for (int j = 0; j < 3; j++) {
+    Vector3D dd21, dd22invdd21;
+    for (int i = 0; i < 3; i++)
+      dd21[i] = threeDtangent(condensed[i], inPlane[j]);
+    dd22.solve(dd21, dd22invdd21);
+
+    for (int i = 0; i < 3; i++) {
+      tangent(i,j) = threeDtangent(inPlane[i], inPlane[j]);
+      for (int k = 0; k < 3; k++)
+        tangent(i,j) -= threeDtangent(inPlane[i], condensed[k])*dd22invdd21[k];
+    }
+  }
+}
+
 //null constructor
 PlaneStressMaterial::PlaneStressMaterial( ) : 
 NDMaterial(0, ND_TAG_PlaneStressMaterial ), 
-strain(3) 
+strain(3), Cstrain(3), stress(3), tangent(3,3)
 { }
 
 void * OPS_ADD_RUNTIME_VPV(OPS_PlaneStress)
@@ -90,7 +116,7 @@ PlaneStressMaterial::PlaneStressMaterial(
 				   int tag, 
                                    NDMaterial &the3DMaterial ) :
 NDMaterial( tag, ND_TAG_PlaneStressMaterial ),
-strain(3)
+strain(3), Cstrain(3), stress(3), tangent(3,3)
 {
   theMaterial = the3DMaterial.getCopy("ThreeDimensional") ;
 
@@ -127,6 +153,9 @@ PlaneStressMaterial::getCopy( )
   clone->Cstrain22 = this->Cstrain22 ;
   clone->Cgamma02  = this->Cgamma02 ;
   clone->Cgamma12  = this->Cgamma12 ;
+  clone->strain    = this->strain ;
+  clone->Cstrain   = this->Cstrain ;
+  clone->predictor = this->predictor;
 
   return clone ;
 }
@@ -163,6 +192,8 @@ PlaneStressMaterial::commitState( )
   Cstrain22 = Tstrain22;
   Cgamma02 = Tgamma02;
   Cgamma12 = Tgamma12;
+  Cstrain  = strain;
+  predictor.commit();
 
   return theMaterial->commitState( ) ;
 }
@@ -176,6 +207,8 @@ PlaneStressMaterial::revertToLastCommit( )
   Tstrain22 = Cstrain22;
   Tgamma02 = Cgamma02;
   Tgamma12 = Cgamma12;
+  strain   = Cstrain;
+  predictor.revert();
 
   return theMaterial->revertToLastCommit( )  ;
 }
@@ -193,6 +226,8 @@ PlaneStressMaterial::revertToStart( )
   this->Cgamma02  = 0.0 ;
   
   strain.Zero();
+  Cstrain.Zero();
+  predictor.zero();
 
   return theMaterial->revertToStart( ) ;
 }
@@ -212,33 +247,39 @@ PlaneStressMaterial::setTrialStrain( const Vector &strainFromElement )
 {
   static const double tolerance = 1.0e-08 ;
 
-  this->strain(0) = strainFromElement(0) ;
-  this->strain(1) = strainFromElement(1) ;
-  this->strain(2) = strainFromElement(2) ;
+  //predict the out of plane strains from the in plane strain increment
+  double dstrain[3], dcondensed[3];
+  for (int j = 0; j < 3; j++) {
+    dstrain[j] = strainFromElement(j) - this->strain(j) ;
+    this->strain(j) = strainFromElement(j) ;
+  }
+  predictor.predict(dstrain, dcondensed);
+  this->Tstrain22 += dcondensed[0] ;
+  this->Tgamma12  += dcondensed[1] ;
+  this->Tgamma02  += dcondensed[2] ;
 
   double norm ;
   Vector3D condensedStress;
   Vector3D strainIncrement;
-  Vector threeDstrain(6);
+  VectorND<6> threeDstrain;
   Matrix3D dd22;
 
   int count = 0;
   const int maxCount = 20;
-  double norm0;
 
   //newton loop to solve for out-of-plane strains
   do {
 
     //set three dimensional strain
-    threeDstrain(0) = this->strain(0) ;
-    threeDstrain(1) = this->strain(1) ;
-    threeDstrain(2) = this->Tstrain22 ;
-    threeDstrain(3) = this->strain(2) ; 
-    threeDstrain(4) = this->Tgamma12 ;
-    threeDstrain(5) = this->Tgamma02 ;
+    threeDstrain[0] = this->strain(0) ;
+    threeDstrain[1] = this->strain(1) ;
+    threeDstrain[2] = this->Tstrain22 ;
+    threeDstrain[3] = this->strain(2) ; 
+    threeDstrain[4] = this->Tgamma12 ;
+    threeDstrain[5] = this->Tgamma02 ;
 
     if (theMaterial->setTrialStrain( threeDstrain ) < 0) {
-      opserr << "PlaneStressMaterial::setTrialStrain() - setTrialStrain in material failed with strain " << threeDstrain;
+      opserr << "PlaneStressMaterial::setTrialStrain() - setTrialStrain in material failed with strain " << Vector(&threeDstrain[0], 6);
       return -1;
     }
 
@@ -251,26 +292,20 @@ PlaneStressMaterial::setTrialStrain( const Vector &strainFromElement )
     //NDmaterial strain order          = 11, 22, 33, 12, 23, 31 
     //PlaneStressMaterial strain order = 11, 22, 12, 33, 23, 31 
 
-    condensedStress[0] = threeDstress(2);
-    condensedStress[1] = threeDstress(4);
-    condensedStress[2] = threeDstress(5);
-
-    dd22(0,0) = threeDtangent(2,2);
-    dd22(1,0) = threeDtangent(4,2);
-    dd22(2,0) = threeDtangent(5,2);
-
-    dd22(0,1) = threeDtangent(2,4);
-    dd22(1,1) = threeDtangent(4,4);
-    dd22(2,1) = threeDtangent(5,4);
-
-    dd22(0,2) = threeDtangent(2,5);
-    dd22(1,2) = threeDtangent(4,5);
-    dd22(2,2) = threeDtangent(5,5);
+    for (int i = 0; i < 3; i++) {
+      condensedStress[i] = threeDstress(condensed[i]);
+      for (int j = 0; j < 3; j++)
+        dd22(i,j) = threeDtangent(condensed[i], condensed[j]);
+    }
 
     //set norm
     norm = condensedStress.norm();
-    if (count == 0)
-      norm0 = norm;
+
+    //the material is left in the state of the accepted strain
+    if (norm <= tolerance) {
+      predictor.update(threeDtangent, condensed, inPlane);
+      break;
+    }
 
     //condensation 
     dd22.solve(condensedStress, strainIncrement);
@@ -280,7 +315,7 @@ PlaneStressMaterial::setTrialStrain( const Vector &strainFromElement )
     this->Tgamma12  -= strainIncrement[1];
     this->Tgamma02  -= strainIncrement[2];
 
-  } while (count++ < maxCount && norm > tolerance);
+  } while (count++ < maxCount);
 
   return 0;
 }
@@ -320,8 +355,8 @@ PlaneStressMaterial::getStressSensitivity(int gradIndex,
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd12(3,3);
-  static Matrix dd22(3,3);
+  Matrix3D dd12;
+  Matrix3D dd22;
   //
   dd12(0,0) = threeDtangent(0,2);
   dd12(1,0) = threeDtangent(1,2);
@@ -349,15 +384,17 @@ PlaneStressMaterial::getStressSensitivity(int gradIndex,
   dd22(2,2) = threeDtangent(5,5);
 
   
-  static Vector sigma2(3);
-  sigma2(0) = threeDstress(2);
-  sigma2(1) = threeDstress(4);
-  sigma2(2) = threeDstress(5);
+  Vector3D sigma2;
+  sigma2[0] = threeDstress(2);
+  sigma2[1] = threeDstress(4);
+  sigma2[2] = threeDstress(5);
 
-  static Vector dd22sigma2(3);
-  dd22.Solve(sigma2,dd22sigma2);
+  Vector3D dd22sigma2;
+  dd22.solve(sigma2, dd22sigma2);
 
-  stress.addMatrixVector(1.0, dd12, dd22sigma2, -1.0);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      stress(i) -= dd12(i,j)*dd22sigma2[j];
 
   return stress;
 }
@@ -368,75 +405,7 @@ PlaneStressMaterial::getTangent( )
 {
   const Matrix &C = theMaterial->getTangent();
 
-//Matrix3D dd11, dd12, dd21, dd22;
-  static Matrix dd11(3,3);
-  static Matrix dd12(3,3);
-  static Matrix dd21(3,3);
-  static Matrix dd22(3,3);
-  //
-  dd11(0,0) = C(0,0);
-  dd11(1,0) = C(1,0);
-  dd11(2,0) = C(3,0);
-
-  dd11(0,1) = C(0,1);
-  dd11(1,1) = C(1,1);
-  dd11(2,1) = C(3,1);
-
-  dd11(0,2) = C(0,3);
-  dd11(1,2) = C(1,3);
-  dd11(2,2) = C(3,3);
-
-  //
-  dd12(0,0) = C(0,2);
-  dd12(1,0) = C(1,2);
-  dd12(2,0) = C(3,2);
-
-  dd12(0,1) = C(0,4);
-  dd12(1,1) = C(1,4);
-  dd12(2,1) = C(3,4);
-
-  dd12(0,2) = C(0,5);
-  dd12(1,2) = C(1,5);
-  dd12(2,2) = C(3,5);
-
-  //
-  dd21(0,0) = C(2,0);
-  dd21(1,0) = C(4,0);
-  dd21(2,0) = C(5,0);
-
-  dd21(0,1) = C(2,1);
-  dd21(1,1) = C(4,1);
-  dd21(2,1) = C(5,1);
-
-  dd21(0,2) = C(2,3);
-  dd21(1,2) = C(4,3);
-  dd21(2,2) = C(5,3);
-
-  //
-  dd22(0,0) = C(2,2);
-  dd22(1,0) = C(4,2);
-  dd22(2,0) = C(5,2);
-
-  dd22(0,1) = C(2,4);
-  dd22(1,1) = C(4,4);
-  dd22(2,1) = C(5,4);
-
-  dd22(0,2) = C(2,5);
-  dd22(1,2) = C(4,5);
-  dd22(2,2) = C(5,5);
-
-
-  //int Solve(const Vector &V, Vector &res) const;
-  //int Solve(const Matrix &M, Matrix &res) const;
-  //condensation 
-  static Matrix dd22invdd21(3,3);
-  dd22.Solve(dd21, dd22invdd21);
-
-  //this->tangent   = dd11 ; 
-  //this->tangent  -= ( dd12*dd22invdd21 ) ;
-
-  dd11.addMatrixProduct(1.0, dd12, dd22invdd21, -1.0);
-  tangent = dd11;  
+  condenseTangent(C, tangent);
 
   return tangent;
 }
@@ -448,71 +417,7 @@ PlaneStressMaterial::getInitialTangent( )
 {
   const Matrix &threeDtangent = theMaterial->getInitialTangent();
 
-  static Matrix dd11(3,3);
-  static Matrix dd12(3,3);
-  static Matrix dd21(3,3);
-  static Matrix dd22(3,3);
-
-  dd11(0,0) = threeDtangent(0,0);
-  dd11(1,0) = threeDtangent(1,0);
-  dd11(2,0) = threeDtangent(3,0);
-
-  dd11(0,1) = threeDtangent(0,1);
-  dd11(1,1) = threeDtangent(1,1);
-  dd11(2,1) = threeDtangent(3,1);
-
-  dd11(0,2) = threeDtangent(0,3);
-  dd11(1,2) = threeDtangent(1,3);
-  dd11(2,2) = threeDtangent(3,3);
-
-  //
-  dd12(0,0) = threeDtangent(0,2);
-  dd12(1,0) = threeDtangent(1,2);
-  dd12(2,0) = threeDtangent(3,2);
-
-  dd12(0,1) = threeDtangent(0,4);
-  dd12(1,1) = threeDtangent(1,4);
-  dd12(2,1) = threeDtangent(3,4);
-
-  dd12(0,2) = threeDtangent(0,5);
-  dd12(1,2) = threeDtangent(1,5);
-  dd12(2,2) = threeDtangent(3,5);
-
-  //
-  dd21(0,0) = threeDtangent(2,0);
-  dd21(1,0) = threeDtangent(4,0);
-  dd21(2,0) = threeDtangent(5,0);
-
-  dd21(0,1) = threeDtangent(2,1);
-  dd21(1,1) = threeDtangent(4,1);
-  dd21(2,1) = threeDtangent(5,1);
-
-  dd21(0,2) = threeDtangent(2,3);
-  dd21(1,2) = threeDtangent(4,3);
-  dd21(2,2) = threeDtangent(5,3);
-
-  //
-  dd22(0,0) = threeDtangent(2,2);
-  dd22(1,0) = threeDtangent(4,2);
-  dd22(2,0) = threeDtangent(5,2);
-
-  dd22(0,1) = threeDtangent(2,4);
-  dd22(1,1) = threeDtangent(4,4);
-  dd22(2,1) = threeDtangent(5,4);
-
-  dd22(0,2) = threeDtangent(2,5);
-  dd22(1,2) = threeDtangent(4,5);
-  dd22(2,2) = threeDtangent(5,5);
-
-
-  // condensation 
-  static Matrix dd22invdd21(3,3);
-  dd22.Solve(dd21, dd22invdd21);
-
-  //this->tangent   = dd11 ; 
-  //this->tangent  -= ( dd12*dd22invdd21 ) ;
-  dd11.addMatrixProduct(1.0, dd12, dd22invdd21, -1.0);
-  tangent = dd11;
+  condenseTangent(threeDtangent, tangent);
 
   return tangent;
 }
@@ -547,7 +452,7 @@ PlaneStressMaterial::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and associated materials class and database tags into an id and send it
-  static ID idData(3);
+  ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -564,7 +469,7 @@ PlaneStressMaterial::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(3);
+  Vector vecData(3);
   vecData(0) = Cstrain22;
   vecData(1) = Cgamma02;
   vecData(2) = Cgamma12;
@@ -589,7 +494,7 @@ PlaneStressMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   int res = 0;
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  ID idData(3);
   res = theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "PlaneStressMaterial::sendSelf() - failed to send id data\n";
@@ -613,7 +518,7 @@ PlaneStressMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(3);
+  Vector vecData(3);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     opserr << "PlaneStressMaterial::sendSelf() - failed to send vector data\n";
@@ -628,6 +533,9 @@ PlaneStressMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   Tgamma02 = Cgamma02;
   Tgamma12  = Cgamma12;
 
+  //the in plane strains are not sent, so the prediction starts over
+  predictor.zero();
+
   // now receive the materials data
   res = theMaterial->recvSelf(commitTag, theChannel, theBroker);
   if (res < 0) 
@@ -36,6 +36,7 @@
 #include <Matrix.h>
 #include <ID.h> 
 #include <NDMaterial.h>
+#include <CondensedStrainPredictor.h>
 
 
 
@@ -113,13 +114,17 @@ class PlaneStressMaterial: public NDMaterial{
     double Cgamma02 ;
     double Cgamma12 ; 
 
+    //predictor of the out of plane strains from the in plane strains
+    CondensedStrainPredictor<3,3> predictor ;
+
     NDMaterial *theMaterial ;  //pointer to three dimensional material
 
     Vector strain ;
+    Vector Cstrain ;  //committed in plane strains
 
-    static Vector stress ;
+    Vector stress ;
 
-    static Matrix tangent ;
+    Matrix tangent ;
 } ; //end of PlaneStressMaterial declarations
 
 
@@ -71,8 +71,8 @@ private :
     double angle, c, s;
 
     Vector strain ;
-    static Vector stress ;
-    static Matrix tangent ;
+    static thread_local Vector stress ;
+    static thread_local Matrix tangent ;
 
 } ;
 
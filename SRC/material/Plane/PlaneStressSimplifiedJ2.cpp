@@ -24,8 +24,8 @@ using namespace OpenSees::Hash::literals;
 #define ND_TAG_PlaneStress   3452
 
 
-Matrix PlaneStressSimplifiedJ2::tmpMatrix(3,3);
-Vector PlaneStressSimplifiedJ2::tmpVector(3);
+thread_local Matrix PlaneStressSimplifiedJ2::tmpMatrix(3,3);
+thread_local Vector PlaneStressSimplifiedJ2::tmpVector(3);
 
 // --- element: eps(1,1),eps(2,2),eps(3,3),2*eps(1,2),2*eps(2,3),2*eps(1,3) ----
 // --- material strain: eps(1,1),eps(2,2),eps(3,3),eps(1,2),eps(2,3),eps(1,3) , same sign ----
@@ -121,7 +121,7 @@ int PlaneStressSimplifiedJ2::plastIntegrator(){
 	double e33 = CsavedStrain33;
 
 	int debugFlag =0;
-	static int counter =0;
+	thread_local int counter =0;
 	counter++;
 //	opserr<<"counter:"<<counter<<endln;
 
@@ -130,9 +130,9 @@ int PlaneStressSimplifiedJ2::plastIntegrator(){
 	//  debugFlag =1;
 	}
 
-	static Vector strain3D(6);
-	static Vector stress3D(6);
-	static Matrix tangent3D(6,6);
+	thread_local Vector strain3D(6);
+	thread_local Vector stress3D(6);
+	thread_local Matrix tangent3D(6,6);
 	
 	strain3D(0) = strain(0);
 	strain3D(1) = strain(1);
@@ -204,9 +204,9 @@ int PlaneStressSimplifiedJ2::plastIntegrator(){
    
 
    double D22 = tangent3D(2,2);
-   static Vector D12(3);
-   static Vector D21(3);
-   static Matrix D11(3,3);
+   thread_local Vector D12(3);
+   thread_local Vector D21(3);
+   thread_local Matrix D11(3,3);
 
  D11(0,0)=tangent3D(0,0);
  D11(0,1)=tangent3D(0,1);
@@ -28,12 +28,6 @@
 
 //#define _DEBUG_PDC_PlaneStress 1
 
- static Vector Iv6(6); 
- static Matrix Ivp(6,6); 
- static Matrix Idp(6,6); 
- static Matrix I(6,6);
- static Matrix Id(6,6); 
-
 static const signed char b_A[3] = { -1, 1, 0 };
 static const signed char c_a[9] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
 static const signed char iv1[3] = { 0, 0, 1 };
@@ -551,7 +545,7 @@ void * OPS_ADD_RUNTIME_VPV(OPS_NewPlasticDamageConcretePlaneStress)
    //                  (sin(fi))^2 (cos(fi))^2 -2*cos(fi)*sin(fi)];   
 
    //FMK
-   static Matrix dsigp_ds(2,3); // 2X3
+   thread_local Matrix dsigp_ds(2,3); // 2X3
    c = cos(fi);
    s = sin(fi);
 #ifdef _DEBUG_PDC_PlaneStress
@@ -573,7 +567,7 @@ void * OPS_ADD_RUNTIME_VPV(OPS_NewPlasticDamageConcretePlaneStress)
    opserr << "sige_tr: " << SIGE_TR;
 #endif
 
-   static Vector dsigp_dfi(2); // 2X1
+   thread_local Vector dsigp_dfi(2); // 2X1
    dsigp_dfi(0) = 2*(sige_tr[1]-sige_tr[0])*c*s+2*sige_tr[2]*(c*c-s*s);
    dsigp_dfi(1) = 2*(sige_tr[0]-sige_tr[1])*c*s+2*sige_tr[2]*(s*s-c*c);
 
@@ -595,8 +589,8 @@ void * OPS_ADD_RUNTIME_VPV(OPS_NewPlasticDamageConcretePlaneStress)
    opserr << "dsigp_ds: " << dsigp_ds;
 #endif
    //  dsigpn_dD, dsigpp_dD := der. of positive and negative principal stresses w.r.t. effective stresses 
-   static Matrix dsigpn_dsigp(2,2); dsigpn_dsigp.Zero();
-   static Matrix dsigpp_dsigp(2,2); dsigpp_dsigp.Zero();
+   thread_local Matrix dsigpn_dsigp(2,2); dsigpn_dsigp.Zero();
+   thread_local Matrix dsigpp_dsigp(2,2); dsigpp_dsigp.Zero();
 
 #ifdef _DEBUG_PDC_PlaneStress
    opserr << "sigpe: " << sigPE;   
@@ -615,8 +609,8 @@ void * OPS_ADD_RUNTIME_VPV(OPS_NewPlasticDamageConcretePlaneStress)
    }
 
    //  dsigpn_ds, dsigpp_ds := der. of positive and negative principal stresses w.r.t. effective stresses     
-   static Matrix dsigpn_ds(2,3);
-   static Matrix dsigpp_ds(2,3);
+   thread_local Matrix dsigpn_ds(2,3);
+   thread_local Matrix dsigpp_ds(2,3);
 
    dsigpn_ds = dsigpn_dsigp*dsigp_ds;
    dsigpp_ds = dsigpp_dsigp*dsigp_ds;
@@ -749,7 +743,7 @@ void * OPS_ADD_RUNTIME_VPV(OPS_NewPlasticDamageConcretePlaneStress)
 #endif
 
      if (fabs(nrm) >= 1.0E-14) {
-       static Matrix dL_ds(3,3); 
+       thread_local Matrix dL_ds(3,3); 
        dL_ds.Zero(); 
        double *dDeps_ds = invCe; 
 
@@ -887,8 +881,8 @@ void * OPS_ADD_RUNTIME_VPV(OPS_NewPlasticDamageConcretePlaneStress)
    Vector DDN_DS(ddn_ds,3);
    opserr << "DDN_DS: " << DDN_DS;
 #endif
-   static Matrix dDpp_ds(2,3);
-   static Matrix dDnp_ds(2,3);
+   thread_local Matrix dDpp_ds(2,3);
+   thread_local Matrix dDnp_ds(2,3);
 
    dDpp_ds.Zero();
    dDnp_ds.Zero();
@@ -977,7 +971,7 @@ void * OPS_ADD_RUNTIME_VPV(OPS_NewPlasticDamageConcretePlaneStress)
 #endif
     
    // compute tangent
-   static Matrix dsig_ds(3,3);
+   thread_local Matrix dsig_ds(3,3);
    for (int i=0; i<3; i++) {
      dsig_ds(0,i) = dsig1_ds[i];
      dsig_ds(1,i) = dsig2_ds[i];
@@ -1127,7 +1121,7 @@ PlasticDamageConcretePlaneStress::getOrder (void) const
 int 
 PlasticDamageConcretePlaneStress::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(10);
+  Vector data(10);
 
   int res = theChannel.sendVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -1142,7 +1136,7 @@ int
 PlasticDamageConcretePlaneStress::recvSelf(int commitTag, Channel &theChannel, 
 					FEM_ObjectBroker &theBroker)
 {
-  static Vector data(10);
+  Vector data(10);
   
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -978,7 +978,7 @@ UniaxialMaterial* ConcreteL01::getCopy ()
 int ConcreteL01::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(21);
+   Vector data(21);
    data(0) = this->getTag();
 
    // Material properties
@@ -1023,7 +1023,7 @@ int ConcreteL01::recvSelf (int commitTag, Channel& theChannel,
                                  FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(21);
+   Vector data(21);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
@@ -922,7 +922,7 @@ UniaxialMaterial* ConcreteZ01::getCopy ()
 int ConcreteZ01::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(21);
+   Vector data(21);
    data(0) = this->getTag();
 
    // Material properties
@@ -967,7 +967,7 @@ int ConcreteZ01::recvSelf (int commitTag, Channel& theChannel,
                                  FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(21);
+   Vector data(21);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
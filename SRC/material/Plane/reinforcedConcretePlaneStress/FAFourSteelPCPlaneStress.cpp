@@ -701,7 +701,7 @@ int FAFourSteelPCPlaneStress::sendSelf(int commitTag, Channel &theChannel)
 	int dataTag = this->getDbTag();
 
 	// Packs its data into a Vector and sends this to theChannel
-	static Vector data(16);
+	Vector data(16);
 	data(0) = this->getTag();
 	data(1) = rho;
 	data(2) = angle1;
@@ -729,7 +729,7 @@ int FAFourSteelPCPlaneStress::sendSelf(int commitTag, Channel &theChannel)
 	// Now sends the IDs of its materials
     int matDbTag;
  
-    static ID idData(12);
+    ID idData(12);
 
 	// NOTE: to ensure that the material has a database
     // tag if sending to a database channel.
@@ -773,7 +773,7 @@ int FAFourSteelPCPlaneStress::recvSelf(int commitTag, Channel &theChannel, FEM_O
 
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(16);
+  Vector data(16);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING FAFourSteelPCPlaneStress::recvSelf() - failed to receive Vector\n";
@@ -797,7 +797,7 @@ int FAFourSteelPCPlaneStress::recvSelf(int commitTag, Channel &theChannel, FEM_O
   fy2 = data(14);
   E0 = data(15);
 
-  static ID idData(12);
+  ID idData(12);
   
   // now receives the tags of its materials
   res += theChannel.recvID(dataTag, commitTag, idData);
@@ -1547,7 +1547,7 @@ double FAFourSteelPCPlaneStress::getPrincipalStressAngle(double inputAngle)
     Information &theInfoC02 = theResponses[4]->getInformation();
     Information &theInfoC03 = theResponses[5]->getInformation();
     
-    static Vector theData(5);
+    thread_local Vector theData(5);
     theData(0) = xx;
     theData(1) = kk;
     theData(2) = DOne;
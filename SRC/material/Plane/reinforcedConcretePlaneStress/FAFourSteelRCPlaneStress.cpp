@@ -693,7 +693,7 @@ int FAFourSteelRCPlaneStress::sendSelf(int commitTag, Channel &theChannel)
 	int dataTag = this->getDbTag();
 
 	// Packs its data into a Vector and sends this to theChannel
-	static Vector data(13);
+	Vector data(13);
 	data(0) = this->getTag();
 	data(1) = rho;
 	data(2) = angle1;
@@ -718,7 +718,7 @@ int FAFourSteelRCPlaneStress::sendSelf(int commitTag, Channel &theChannel)
 	// Now sends the IDs of its materials
     int matDbTag;
  
-    static ID idData(12);
+    ID idData(12);
 
 	// NOTE: to ensure that the material has a database
     // tag if sending to a database channel.
@@ -763,7 +763,7 @@ int FAFourSteelRCPlaneStress::recvSelf(int commitTag, Channel &theChannel, FEM_O
 
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(13);
+  Vector data(13);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING FAFourSteelRCPlaneStress::recvSelf() - failed to receive Vector\n";
@@ -784,7 +784,7 @@ int FAFourSteelRCPlaneStress::recvSelf(int commitTag, Channel &theChannel, FEM_O
   fy = data(11);
   E0 = data(12);
 
-  static ID idData(12);
+  ID idData(12);
   
   // now receives the tags of its materials
   res += theChannel.recvID(dataTag, commitTag, idData);
@@ -1522,7 +1522,7 @@ double FAFourSteelRCPlaneStress::getPrincipalStressAngle(double inputAngle)
 	Information &theInfoC02 = theResponses[4]->getInformation();
 	Information &theInfoC03 = theResponses[5]->getInformation();
     
-	static Vector theData(5);
+	thread_local Vector theData(5);
 	theData(0) = xx;
 	theData(1) = kk;
 	theData(2) = DOne;
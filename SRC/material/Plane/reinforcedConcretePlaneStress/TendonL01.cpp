@@ -1154,7 +1154,7 @@ UniaxialMaterial* TendonL01::getCopy ()
 int TendonL01::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(151);
+   Vector data(151);
    data(0) = this->getTag();
 
    // Material properties
@@ -1223,7 +1223,7 @@ int TendonL01::recvSelf (int commitTag, Channel& theChannel,
                                 FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(65);
+   Vector data(65);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
    if (res < 0) {
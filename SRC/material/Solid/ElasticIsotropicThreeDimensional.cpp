@@ -23,8 +23,6 @@
 
 #include <elementAPI.h>
 
-Vector ElasticIsotropicThreeDimensional::sigma(6);
-Matrix ElasticIsotropicThreeDimensional::D(6,6);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ElasticIsotropic3D)
 {
@@ -65,7 +63,7 @@ void * OPS_ADD_RUNTIME_VPV(OPS_ElasticIsotropic3D)
 ElasticIsotropicThreeDimensional::ElasticIsotropicThreeDimensional
 (int tag, double E, double nu, double rho) :
  ElasticIsotropicMaterial (tag, ND_TAG_ElasticIsotropicThreeDimensional, E, nu, rho),
- epsilon(6), Cepsilon(6)
+ sigma(6), D(6,6), epsilon(6), Cepsilon(6)
 {
   epsilon.Zero();
   Cepsilon.Zero();
@@ -73,7 +71,7 @@ ElasticIsotropicThreeDimensional::ElasticIsotropicThreeDimensional
 
 ElasticIsotropicThreeDimensional::ElasticIsotropicThreeDimensional():
  ElasticIsotropicMaterial (0, ND_TAG_ElasticIsotropicThreeDimensional, 0.0, 0.0),
- epsilon(6), Cepsilon(6)
+ sigma(6), D(6,6), epsilon(6), Cepsilon(6)
 {
   epsilon.Zero();
   Cepsilon.Zero();
@@ -231,7 +229,7 @@ ElasticIsotropicThreeDimensional::getOrder (void) const
 int 
 ElasticIsotropicThreeDimensional::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(10);
+  Vector data(10);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -257,7 +255,7 @@ int
 ElasticIsotropicThreeDimensional::recvSelf(int commitTag, Channel &theChannel, 
 					FEM_ObjectBroker &theBroker)
 {
-  static Vector data(10);
+  Vector data(10);
   
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -75,8 +75,8 @@ class ElasticIsotropicThreeDimensional : public ElasticIsotropicMaterial
  protected:
 
   private:
-    static Vector sigma;	// Stress vector ... class-wide for returns
-    static Matrix D;		// Elastic constants
+    Vector sigma;	// Stress vector returned by reference
+    Matrix D;		// Elastic constants
     Vector epsilon;	        // Trial strains
     Vector Cepsilon;	        // Committed strain
 };
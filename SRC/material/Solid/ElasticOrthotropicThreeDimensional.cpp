@@ -21,8 +21,8 @@
 #include <ElasticOrthotropicThreeDimensional.h>           
 #include <Channel.h>
 
-Vector ElasticOrthotropicThreeDimensional::sigma(6);
-Matrix ElasticOrthotropicThreeDimensional::D(6,6);
+thread_local Vector ElasticOrthotropicThreeDimensional::sigma(6);
+thread_local Matrix ElasticOrthotropicThreeDimensional::D(6,6);
 
 ElasticOrthotropicThreeDimensional::ElasticOrthotropicThreeDimensional
 (int tag, double Ex, double Ey, double Ez,
@@ -206,7 +206,7 @@ ElasticOrthotropicThreeDimensional::getOrder (void) const
 int 
 ElasticOrthotropicThreeDimensional::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(17);
+  Vector data(17);
   
   data(0) = this->getTag();
   data(1) = Ex;
@@ -239,7 +239,7 @@ int
 ElasticOrthotropicThreeDimensional::recvSelf(int commitTag, Channel &theChannel, 
 					FEM_ObjectBroker &theBroker)
 {
-  static Vector data(17);
+  Vector data(17);
   
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
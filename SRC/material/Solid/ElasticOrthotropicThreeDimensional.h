@@ -77,8 +77,8 @@ double Gzx, double rho = 0.0);
  protected:
 
   private:
-    static Vector sigma;	// Stress vector ... class-wide for returns
-    static Matrix D;		// Elastic constants
+    static thread_local Vector sigma;	// Stress vector ... class-wide for returns
+    static thread_local Matrix D;		// Elastic constants
     Vector epsilon;	        // Trial strains
     Vector Cepsilon;	        // Committed strain
 };
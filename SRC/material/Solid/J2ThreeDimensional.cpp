@@ -56,16 +56,13 @@
 #include <J2ThreeDimensional.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
-
-//static vectors and matrices
-Vector J2ThreeDimensional :: strain_vec(6) ;
-Vector J2ThreeDimensional :: stress_vec(6) ;
-Matrix J2ThreeDimensional :: tangent_matrix(6,6) ;
+#include <VectorND.h>
 
 
 //null constructor
 J2ThreeDimensional ::  J2ThreeDimensional( ) : 
-J2Plasticity(0, ND_TAG_J2ThreeDimensional, 0.0, 0.0) 
+J2Plasticity(0, ND_TAG_J2ThreeDimensional, 0.0, 0.0),
+strain_vec(6), stress_vec(6), tangent_matrix(6,6)
 { }
 
 
@@ -81,7 +78,8 @@ J2ThreeDimensional(   int    tag,
 		      double viscosity,
 		      double rho) : 
   J2Plasticity( tag, ND_TAG_J2ThreeDimensional, 
-		K, G, yield0, yield_infty, d, H, viscosity, rho)
+		K, G, yield0, yield_infty, d, H, viscosity, rho),
+  strain_vec(6), stress_vec(6), tangent_matrix(6,6)
 { 
 }
 
@@ -91,7 +89,8 @@ J2ThreeDimensional ::
 J2ThreeDimensional(   int    tag, 
                  double K, 
                  double G ) :
-J2Plasticity( tag, ND_TAG_J2ThreeDimensional, K, G )
+J2Plasticity( tag, ND_TAG_J2ThreeDimensional, K, G ),
+strain_vec(6), stress_vec(6), tangent_matrix(6,6)
 { 
 }
 
@@ -158,13 +157,13 @@ int J2ThreeDimensional :: setTrialStrain( const Vector &v, const Vector &r )
 
 int J2ThreeDimensional :: setTrialStrainIncr( const Vector &v ) 
 {
-  static Vector newStrain(6);
-  newStrain(0) = strain(0,0) + v(0);
-  newStrain(1) = strain(1,1) + v(1);
-  newStrain(2) = strain(2,2) + v(2);
-  newStrain(3) = 2.0*strain(0,1) + v(3);
-  newStrain(4) = 2.0*strain(1,2) + v(4);
-  newStrain(5) = 2.0*strain(2,0) + v(5);
+  OpenSees::VectorND<6> newStrain;
+  newStrain[0] = strain(0,0) + v(0);
+  newStrain[1] = strain(1,1) + v(1);
+  newStrain[2] = strain(2,2) + v(2);
+  newStrain[3] = 2.0*strain(0,1) + v(3);
+  newStrain[4] = 2.0*strain(1,2) + v(4);
+  newStrain[5] = 2.0*strain(2,0) + v(5);
   
   return this->setTrialStrain(newStrain);
 }
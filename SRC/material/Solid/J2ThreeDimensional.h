@@ -120,10 +120,10 @@ class J2ThreeDimensional : public J2Plasticity {
 
   private :
 
-  //static vectors and matrices
-  static Vector strain_vec ;     //strain in vector notation
-  static Vector stress_vec ;     //stress in vector notation
-  static Matrix tangent_matrix ; //material tangent in matrix notation
+  //vectors and matrices
+  Vector strain_vec ;     //strain in vector notation
+  Vector stress_vec ;     //stress in vector notation
+  Matrix tangent_matrix ; //material tangent in matrix notation
 
 } ; //end of J2ThreeDimensional declarations
 
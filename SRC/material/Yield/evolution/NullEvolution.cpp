@@ -14,9 +14,9 @@
 #include "NullEvolution.h"
 #define NULL_EVOL_CLASS_TAG -1
 
-Vector NullEvolution::vec_dim_1(1);
-Vector NullEvolution::vec_dim_2(2);
-Vector NullEvolution::vec_dim_3(3);
+const Vector NullEvolution::vec_dim_1(1);
+const Vector NullEvolution::vec_dim_2(2);
+const Vector NullEvolution::vec_dim_3(3);
 
 NullEvolution::NullEvolution(int tag, double isox)
 :YS_Evolution(tag, NULL_EVOL_CLASS_TAG, 0.0, 0.0, 1, 0.0, 0.0)
@@ -5,9 +5,9 @@
 #include "YS_Evolution.h"
 #include <Logging.h>
 
-Vector YS_Evolution::crd1(1);
-Vector YS_Evolution::crd2(2);
-Vector YS_Evolution::crd3(3);
+thread_local Vector YS_Evolution::crd1(1);
+thread_local Vector YS_Evolution::crd2(2);
+thread_local Vector YS_Evolution::crd3(3);
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
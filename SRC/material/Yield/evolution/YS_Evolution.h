@@ -86,7 +86,7 @@ protected:
 	double	isotropicRatio_orig,  isotropicRatio, isotropicRatio_shrink;
 	double	kinematicRatio_orig,  kinematicRatio, kinematicRatio_shrink;
 	int    dimension;
-static Vector crd1, crd2, crd3;
+static thread_local Vector crd1, crd2, crd3;
 };
 
 #endif
@@ -11,7 +11,7 @@
 #define modifDebug 0
 #define transDebug 0
 
-Vector YS_Evolution2D::v2(2);
+thread_local Vector YS_Evolution2D::v2(2);
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
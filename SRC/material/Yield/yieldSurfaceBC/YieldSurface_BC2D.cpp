@@ -13,13 +13,13 @@
 #include <MaterialResponse.h>
 #include <math.h>
 
-double YieldSurface_BC2D::error(1.0e-6);
-Vector YieldSurface_BC2D::v6(6);
-Vector YieldSurface_BC2D::T2(2);
-Vector YieldSurface_BC2D::F2(2);
-Vector YieldSurface_BC2D::g2(2);
-Vector YieldSurface_BC2D::v2(2);
-Vector YieldSurface_BC2D::v4(4);
+const double YieldSurface_BC2D::error(1.0e-6);
+thread_local Vector YieldSurface_BC2D::v6(6);
+thread_local Vector YieldSurface_BC2D::T2(2);
+thread_local Vector YieldSurface_BC2D::F2(2);
+thread_local Vector YieldSurface_BC2D::g2(2);
+thread_local Vector YieldSurface_BC2D::v2(2);
+thread_local Vector YieldSurface_BC2D::v4(4);
 
 
 //////////////////////////////////////////////////////////////////////
@@ -103,13 +103,13 @@ protected:
     double fx_hist, fy_hist, gx_hist, gy_hist;
     double fx_trial, fy_trial, gx_trial, gy_trial;
 
-    static Vector v6;
-	static double  error;
-	static Vector v2;
-	static Vector g2;
-	static Vector v4;
-	static Vector T2;
-	static Vector F2;
+    static thread_local Vector v6;
+	static const double  error;
+	static thread_local Vector v2;
+	static thread_local Vector g2;
+	static thread_local Vector v4;
+	static thread_local Vector T2;
+	static thread_local Vector F2;
 public:
 //	const  static int dFReturn, RadialReturn, ConstantXReturn, ConstantYReturn;
 
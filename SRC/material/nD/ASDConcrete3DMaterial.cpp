@@ -117,9 +117,9 @@ namespace {
 		int     rot, its, i, j, k;
 		double  g, h, aij, sm, thresh, t, c, s, tau;
 
-		static Vector  a(3);
-		static Vector  b(3);
-		static Vector  z(3);
+		thread_local Vector  a(3);
+		thread_local Vector  b(3);
+		thread_local Vector  z(3);
 
 		static const double tol = 1.0e-08;
 
@@ -793,7 +793,7 @@ int ASDConcrete3DMaterial::StressDecomposition::compute(const Vector& S, double
 		return EC_Eigen_Error;
 
 	// construct matrices PT and PC
-	static Matrix pjj(6, 6);
+	thread_local Matrix pjj(6, 6);
 	PT.Zero();
 	PC.Zero();
 
@@ -822,7 +822,7 @@ int ASDConcrete3DMaterial::StressDecomposition::compute(const Vector& S, double
 			PC.addMatrix(1.0, pjj, hsj);
 	}
 
-	static Matrix PO(6, 6); // PO = I - PT - PC
+	thread_local Matrix PO(6, 6); // PO = I - PT - PC
 	PO.addMatrix(0.0, PT, -1.0);
 	PO.addMatrix(1.0, PC, -1.0);
 	for (int i = 0; i < 6; ++i)
@@ -1409,7 +1409,7 @@ void ASDConcrete3DMaterial::CrackPlanes::setEquivalentStrainAtNormal(std::size_t
 
 const ASDConcrete3DMaterial::Vector3& ASDConcrete3DMaterial::CrackPlanes::getNormal(std::size_t i) const
 {
-	static Vector3 dummy;
+	thread_local Vector3 dummy;
 	if (m_normals && i < m_normals->size())
 		return m_normals->operator[](i);
 	return dummy;
@@ -1633,7 +1633,7 @@ int ASDConcrete3DMaterial::setTrialStrain(const Vector& v)
 	// and not the IMPL-EX (in IMPL-EX the tangent coincides with the secant) ...
 	if (tangent && !implex) {
 		// numerical tangent tensor
-		static Matrix Cnum(6, 6);
+		thread_local Matrix Cnum(6, 6);
 		// strain perturbation parameter
 		double PERT = (ht.strainTolerance() + hc.strainTolerance()) / 2.0;
 		// compute the forward perturbed solution and store in Cnum columns
@@ -1661,7 +1661,7 @@ int ASDConcrete3DMaterial::setTrialStrain(const Vector& v)
 		if (implex) {
 			if (implex_control) {
 				// implicit solution
-				static Matrix aux = Matrix(6, 6);
+				thread_local Matrix aux = Matrix(6, 6);
 				aux = PT_commit;
 				double R_aux = R_commit;
 				retval = compute(false, false);
@@ -1704,7 +1704,7 @@ int ASDConcrete3DMaterial::setTrialStrain(const Vector& v, const Vector& /*r*/)
 
 int ASDConcrete3DMaterial::setTrialStrainIncr(const Vector& v)
 {
-	static Vector aux(6);
+	thread_local Vector aux(6);
 	aux = strain;
 	aux.addVector(1.0, v, 1.0);
 	return setTrialStrain(aux);
@@ -1732,7 +1732,7 @@ const Matrix &ASDConcrete3DMaterial::getTangent(void)
 
 const Matrix &ASDConcrete3DMaterial::getInitialTangent(void)
 {
-	static Matrix D(6, 6);
+	thread_local Matrix D(6, 6);
 	D.Zero();
 	double mu2 = E / (1.0 + v);
 	double lam = v * mu2 / (1.0 - 2.0 * v);
@@ -1885,7 +1885,7 @@ int ASDConcrete3DMaterial::sendSelf(int commitTag, Channel &theChannel)
 		svc_commit_old.serializationDataSize();
 
 	// send INT data
-	static ID idata(11);
+	ID idata(11);
 	counter = 0;
 	idata(counter++) = getTag();
 	idata(counter++) = static_cast<int>(implex);
@@ -1965,7 +1965,7 @@ int ASDConcrete3DMaterial::recvSelf(int commitTag, Channel & theChannel, FEM_Obj
 	int counter;
 
 	// recv INT data
-	static ID idata(11);
+	ID idata(11);
 	if (theChannel.recvID(getDbTag(), commitTag, idata) < 0) {
 		opserr << "ASDConcrete3DMaterial::recvSelf() - failed to receive INT data\n";
 		return -1;
@@ -2150,7 +2150,7 @@ Response* ASDConcrete3DMaterial::setResponse(const char** argv, int argc, OPS_St
 	static std::vector<std::string> lb_time = { "dTime", "dTimeCommit", "dTimeInitial" };
 	static std::vector<std::string> lb_crack_strain = { "CS+", "LchRef" };
 	static std::vector<std::string> lb_crush_strain = { "CS-", "LchRef" };
-	static Vector Cinfo(2);
+	thread_local Vector Cinfo(2);
 
 	// check specific responses
 	if (argc > 0) {
@@ -2342,13 +2342,13 @@ int ASDConcrete3DMaterial::compute(bool do_implex, bool do_tangent)
 	}
 
 	// compute elastic effective stress: SEFFn = C0 : (En - En-1)
-	static Vector dStrain(6);
+	thread_local Vector dStrain(6);
 	dStrain = strain;
 	dStrain.addVector(1.0, strain_commit, -1.0);
 	stress_eff.addMatrixVector(1.0, getInitialTangent(), dStrain, 1.0);
 
 	// compute stress split
-	static StressDecomposition D;
+	thread_local StressDecomposition D;
 	if (implex && do_implex) {
 		// explicit: PT and R from committed
 		D.R = R_commit;
@@ -2460,7 +2460,7 @@ int ASDConcrete3DMaterial::compute(bool do_implex, bool do_tangent)
 
 	// tangent matrix
 	if (do_tangent) {
-		static Matrix W(6, 6);
+		thread_local Matrix W(6, 6);
 		W.Zero();
 		for (int i = 0; i < 6; ++i)
 			W(i, i) = 1.0;
@@ -2549,7 +2549,7 @@ Vector ASDConcrete3DMaterial::getHardeningLawVector(HardeningLawType ltype, Hard
 
 const Vector& ASDConcrete3DMaterial::getMaxStrainMeasure() const
 {
-	static Vector d(2);
+	thread_local Vector d(2);
 	double xt_max = 0.0;
 	double xc_max = 0.0;
 	for (std::size_t i = 0; i < svt.count(); ++i)
@@ -2563,7 +2563,7 @@ const Vector& ASDConcrete3DMaterial::getMaxStrainMeasure() const
 
 const Vector& ASDConcrete3DMaterial::getAvgStrainMeasure() const
 {
-	static Vector d(2);
+	thread_local Vector d(2);
 	double xt = 0.0;
 	double xc = 0.0;
 	if (svt.count() > 0) {
@@ -2583,7 +2583,7 @@ const Vector& ASDConcrete3DMaterial::getAvgStrainMeasure() const
 
 const Vector& ASDConcrete3DMaterial::getMaxDamage() const
 {
-	static Vector d(2);
+	thread_local Vector d(2);
 	const Vector& x = getMaxStrainMeasure();
 	d(0) = ht.evaluateAt(x(0)).crackingDamage();
 	d(1) = hc.evaluateAt(x(1)).crackingDamage();
@@ -2592,7 +2592,7 @@ const Vector& ASDConcrete3DMaterial::getMaxDamage() const
 
 const Vector& ASDConcrete3DMaterial::getAvgDamage() const
 {
-	static Vector d(2);
+	thread_local Vector d(2);
 	const Vector& x = getAvgStrainMeasure();
 	d(0) = ht.evaluateAt(x(0)).crackingDamage();
 	d(1) = hc.evaluateAt(x(1)).crackingDamage();
@@ -2601,7 +2601,7 @@ const Vector& ASDConcrete3DMaterial::getAvgDamage() const
 
 const Vector& ASDConcrete3DMaterial::getMaxEquivalentPlasticStrain() const
 {
-	static Vector d(2);
+	thread_local Vector d(2);
 	const Vector& x = getMaxStrainMeasure();
 	d(0) = ht.evaluateAt(x(0)).plasticStrain(E);
 	d(1) = hc.evaluateAt(x(1)).plasticStrain(E);
@@ -2610,7 +2610,7 @@ const Vector& ASDConcrete3DMaterial::getMaxEquivalentPlasticStrain() const
 
 const Vector& ASDConcrete3DMaterial::getAvgEquivalentPlasticStrain() const
 {
-	static Vector d(2);
+	thread_local Vector d(2);
 	const Vector& x = getAvgStrainMeasure();
 	d(0) = ht.evaluateAt(x(0)).plasticStrain(E);
 	d(1) = hc.evaluateAt(x(1)).plasticStrain(E);
@@ -2619,7 +2619,7 @@ const Vector& ASDConcrete3DMaterial::getAvgEquivalentPlasticStrain() const
 
 const Vector& ASDConcrete3DMaterial::getMaxCrackWidth() const
 {
-	static Vector d(1);
+	thread_local Vector d(1);
 	d.Zero();
 	if (ht.hasStrainSoftening()) {
 		double e0 = ht.strainAtOnsetOfCrack();
@@ -2631,7 +2631,7 @@ const Vector& ASDConcrete3DMaterial::getMaxCrackWidth() const
 
 const Vector& ASDConcrete3DMaterial::getAvgCrackWidth() const
 {
-	static Vector d(1);
+	thread_local Vector d(1);
 	d.Zero();
 	if (ht.hasStrainSoftening()) {
 		double e0 = ht.strainAtOnsetOfCrack();
@@ -2643,7 +2643,7 @@ const Vector& ASDConcrete3DMaterial::getAvgCrackWidth() const
 
 const Vector& ASDConcrete3DMaterial::getMaxCrushWidth() const
 {
-	static Vector d(1);
+	thread_local Vector d(1);
 	d.Zero();
 	if (hc.hasStrainSoftening()) {
 		double e0 = hc.strainAtOnsetOfCrack();
@@ -2655,7 +2655,7 @@ const Vector& ASDConcrete3DMaterial::getMaxCrushWidth() const
 
 const Vector& ASDConcrete3DMaterial::getAvgCrushWidth() const
 {
-	static Vector d(1);
+	thread_local Vector d(1);
 	d.Zero();
 	if (hc.hasStrainSoftening()) {
 		double e0 = hc.strainAtOnsetOfCrack();
@@ -2667,7 +2667,7 @@ const Vector& ASDConcrete3DMaterial::getAvgCrushWidth() const
 
 const Vector& ASDConcrete3DMaterial::getCrackPattern() const
 {
-	static Vector d(9);
+	thread_local Vector d(9);
 	d.Zero();
 	if (ht.hasStrainSoftening()) {
 		double e0 = ht.strainAtOnsetOfCrack();
@@ -2697,7 +2697,7 @@ const Vector& ASDConcrete3DMaterial::getCrackPattern() const
 
 const Vector& ASDConcrete3DMaterial::getCrushPattern() const
 {
-	static Vector d(9);
+	thread_local Vector d(9);
 	d.Zero();
 	if (hc.hasStrainSoftening()) {
 		double e0 = hc.strainAtOnsetOfCrack();
@@ -2727,14 +2727,14 @@ const Vector& ASDConcrete3DMaterial::getCrushPattern() const
 
 const Vector& ASDConcrete3DMaterial::getImplexError() const
 {
-	static Vector d(1);
+	thread_local Vector d(1);
 	d(0) = implex_error;
 	return d;
 }
 
 const Vector& ASDConcrete3DMaterial::getTimeIncrements() const
 {
-	static Vector d(3);
+	thread_local Vector d(3);
 	d(0) = dtime_n;
 	d(1) = dtime_n_commit;
 	d(2) = dtime_0;
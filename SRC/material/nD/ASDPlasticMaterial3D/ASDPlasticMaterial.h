@@ -393,28 +393,28 @@ public:
 
     const Vector &getStress(void)
     {
-        static Vector result(6);
+        thread_local Vector result(6);
         TrialStress.toStress(result);
         return result;
     }
 
     const Vector &getStrain(void)
     {
-        static Vector result(6);
+        thread_local Vector result(6);
         TrialStrain.toStrain(result);
         return result;
     }
 
     const Vector &getPstrain(void)
     {
-        static Vector result(6);
+        thread_local Vector result(6);
         TrialPlastic_Strain.toStress(result);
         return result;
     }
 
     const Vector &getInternalVariableByPos(int pos)
     {
-        static Vector return_vector(6);
+        thread_local Vector return_vector(6);
         int find_pos = 0;
 
         // Note by J. Abell on Wed 06 Dec 2023 11:44:24
@@ -519,7 +519,7 @@ public:
 
     const Matrix& getTangent()
     {
-        static Matrix return_matrix(6, 6);
+        thread_local Matrix return_matrix(6, 6);
 
         copyToMatrixReference(Stiffness, return_matrix);
 
@@ -529,7 +529,7 @@ public:
 
     const Matrix& getInitialTangent()
     {
-        static Matrix return_matrix(6, 6);
+        thread_local Matrix return_matrix(6, 6);
 
         VoigtMatrix Eelastic = et(CommitStress, parameters_storage);
         Stiffness = Eelastic;
@@ -655,7 +655,7 @@ public:
                            OPS_Stream & s)
     {
 
-        static Vector return_vector(6);
+        thread_local Vector return_vector(6);
 
         if (strcmp(argv[0], "stress") == 0 || strcmp(argv[0], "stresses") == 0)
             return new MaterialResponse(this, 1, this->getStress());
@@ -872,7 +872,7 @@ private:
 
         int errorcode = -1;
 
-        static VoigtVector depsilon;
+        thread_local VoigtVector depsilon;
         depsilon *= 0;
         depsilon = strain_incr;
 
@@ -1121,7 +1121,7 @@ private:
 
         int errorcode = -1;
 
-        static VoigtVector depsilon;
+        thread_local VoigtVector depsilon;
         depsilon *= 0;
         depsilon = strain_incr;
 
@@ -3067,11 +3067,11 @@ protected:
 
     bool first_step;
 
-    static VoigtVector dsigma;
-    static VoigtVector depsilon_elpl;    //Elastoplastic strain increment : For a strain increment that causes first yield, the step is divided into an elastic one (until yield) and an elastoplastic one.
-    static VoigtVector intersection_stress;
-    static VoigtVector intersection_strain;
-    static VoigtMatrix Stiffness;
+    static thread_local VoigtVector dsigma;
+    static thread_local VoigtVector depsilon_elpl;    //Elastoplastic strain increment : For a strain increment that causes first yield, the step is divided into an elastic one (until yield) and an elastoplastic one.
+    static thread_local VoigtVector intersection_stress;
+    static thread_local VoigtVector intersection_strain;
+    static thread_local VoigtMatrix Stiffness;
 
 
 };
@@ -3091,19 +3091,19 @@ std::map<int, int> ASDPlasticMaterial< E,  Y,  P,  tag>::INT_OPT_return_to_yield
 
 
 template < class E, class Y, class P, int tag>
-VoigtVector ASDPlasticMaterial< E,  Y,  P,  tag>::dsigma;
+thread_local VoigtVector ASDPlasticMaterial< E,  Y,  P,  tag>::dsigma;
 
 template < class E, class Y, class P, int tag>
-VoigtVector ASDPlasticMaterial< E,  Y,  P,  tag>::depsilon_elpl;  //Used to compute the yield surface intersection.
+thread_local VoigtVector ASDPlasticMaterial< E,  Y,  P,  tag>::depsilon_elpl;  //Used to compute the yield surface intersection.
 
 template < class E, class Y, class P, int tag>
-VoigtVector ASDPlasticMaterial< E,  Y,  P,  tag >::intersection_stress;  //Used to compute the yield surface intersection.
+thread_local VoigtVector ASDPlasticMaterial< E,  Y,  P,  tag >::intersection_stress;  //Used to compute the yield surface intersection.
 
 template < class E, class Y, class P, int tag>
-VoigtVector ASDPlasticMaterial< E,  Y,  P,  tag>::intersection_strain;  //Used to compute the yield surface intersection.
+thread_local VoigtVector ASDPlasticMaterial< E,  Y,  P,  tag>::intersection_strain;  //Used to compute the yield surface intersection.
 
 template < class E, class Y, class P, int tag>
-VoigtMatrix ASDPlasticMaterial< E,  Y,  P,  tag>::Stiffness;  //Used to compute the yield surface intersection.
+thread_local VoigtMatrix ASDPlasticMaterial< E,  Y,  P,  tag>::Stiffness;  //Used to compute the yield surface intersection.
 
 
 #endif
@@ -81,9 +81,9 @@ int DruckerPragerArmstrongFrederickLE::pre_integration_callback(const VoigtVecto
         bool & returns)
 {
     using namespace ASDPlasticMaterialGlobals;
-    static VoigtVector stress(3, 3, 0);
-    static VoigtVector plasticstrain(3, 3, 0);
-    static VoigtMatrix stiff(3, 3, 3, 3, 0);
+    thread_local VoigtVector stress(3, 3, 0);
+    thread_local VoigtVector plasticstrain(3, 3, 0);
+    thread_local VoigtMatrix stiff(3, 3, 3, 3, 0);
     double p = -(TrialStress(0, 0) + TrialStress(1, 1) + TrialStress(2, 2)) / 3;
     if (p < 0)
     {
@@ -81,8 +81,8 @@ int DruckerPragerLinearHardening::pre_integration_callback(const VoigtVector &de
         bool & returns)
 {
     using namespace ASDPlasticMaterialGlobals;
-    static VoigtVector str(3, 3, 0);
-    static VoigtMatrix stiff(3, 3, 3, 3, 0);
+    thread_local VoigtVector str(3, 3, 0);
+    thread_local VoigtMatrix stiff(3, 3, 3, 3, 0);
     double p = -(TrialStress(0, 0) + TrialStress(1, 1) + TrialStress(2, 2)) / 3;
     if (p < 0)
     {
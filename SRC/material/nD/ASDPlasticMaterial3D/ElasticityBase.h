@@ -60,11 +60,11 @@ public:
 
 protected:
 
-    static VoigtMatrix EE_MATRIX; 
+    static thread_local VoigtMatrix EE_MATRIX; 
 };
 
 template <class T>
-VoigtMatrix ElasticityBase<T>::EE_MATRIX;
+thread_local VoigtMatrix ElasticityBase<T>::EE_MATRIX;
 
 
 #endif
@@ -49,7 +49,7 @@ private:
     double e0;
     double kappa;
     double nu;
-    static VoigtMatrix Ee;  //Provides class-wide storage, which avoids mallocs and allows const returning a const & to this object.
+    static thread_local VoigtMatrix Ee;  //Provides class-wide storage, which avoids mallocs and allows const returning a const & to this object.
 
 };
 
@@ -84,11 +84,11 @@ public:
 
 private:
 
-    static VoigtMatrix Ee;  //Provides class-wide storage, which avoids mallocs and allows const returning a const & to this object.
+    static thread_local VoigtMatrix Ee;  //Provides class-wide storage, which avoids mallocs and allows const returning a const & to this object.
 
 };
 
-VoigtMatrix DuncanChang_EL::Ee;
+thread_local VoigtMatrix DuncanChang_EL::Ee;
 
 #endif
 
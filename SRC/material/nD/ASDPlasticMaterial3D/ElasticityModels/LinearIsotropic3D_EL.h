@@ -68,10 +68,10 @@ public:
 
 private:
 
-    static VoigtMatrix Ee;  //Provides class-wide storage, which avoids mallocs and allows const returning a const & to this object.
+    static thread_local VoigtMatrix Ee;  //Provides class-wide storage, which avoids mallocs and allows const returning a const & to this object.
 
 };
 
-VoigtMatrix LinearIsotropic3D_EL::Ee;
+thread_local VoigtMatrix LinearIsotropic3D_EL::Ee;
 
 #endif
@@ -27,7 +27,7 @@
 #include "NoTensionLinearIsotropic3D_EL.h"
 #include "Vector.h"
 
-VoigtMatrix NoTensionLinearIsotropic3D_EL::Ee(3, 3, 3, 3, 0.0);
+thread_local VoigtMatrix NoTensionLinearIsotropic3D_EL::Ee(3, 3, 3, 3, 0.0);
 
 
 NoTensionLinearIsotropic3D_EL::NoTensionLinearIsotropic3D_EL(double E, double nu) : ElasticityBase<NoTensionLinearIsotropic3D_EL>::ElasticityBase()  // Note the full-qualification of ElasticityBase through the scope resolution operator (::)
@@ -77,7 +77,7 @@ VoigtMatrix& NoTensionLinearIsotropic3D_EL::operator()(const VoigtVector& stress
 
 int NoTensionLinearIsotropic3D_EL::sendSelf(int commitTag, Channel &theChannel)
 {
-    static Vector data(2);
+    Vector data(2);
     data(0) = lambda;
     data(1) = mu;
 
@@ -92,7 +92,7 @@ int NoTensionLinearIsotropic3D_EL::sendSelf(int commitTag, Channel &theChannel)
 
 int NoTensionLinearIsotropic3D_EL::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-    static Vector data(2);
+    Vector data(2);
 
     if (theChannel.receiveVector(0, commitTag, data) != 0)
     {
@@ -71,9 +71,9 @@ public:
 
     VoigtMatrix const& dm_over_dsigma(VoigtVector const& sigma)
     {
-        static VoigtMatrix dm__dsigma(3, 3, 3, 3, 0.0);
-        static VoigtMatrix delta_imjn(3, 3, 3, 3, 0.0)        ;
-        static VoigtMatrix delta_ijmn(3, 3, 3, 3, 0.0)        ;
+        thread_local VoigtMatrix dm__dsigma(3, 3, 3, 3, 0.0);
+        thread_local VoigtMatrix delta_imjn(3, 3, 3, 3, 0.0)        ;
+        thread_local VoigtMatrix delta_ijmn(3, 3, 3, 3, 0.0)        ;
         delta_imjn(i, j, m, n) = kronecker_delta(i, m) * kronecker_delta(j, n);
         delta_ijmn(i, j, m, n) = kronecker_delta(i, j) * kronecker_delta(m, n);
 
@@ -103,16 +103,16 @@ private:
     double M;
     p0Type &p0_;
 
-    static VoigtVector s; //sigma deviator
-    static VoigtVector result; //For returning VoigtVectors
+    static thread_local VoigtVector s; //sigma deviator
+    static thread_local VoigtVector result; //For returning VoigtVectors
     // static VoigtMatrix dm__dsigma; //For returning dm_over_dsigma
     // static VoigtMatrix dm__dalpha; //For returning dm_over_dsigma
 
 };
 
 template<class p0HardeningType>
-VoigtVector CamClay_PF<p0HardeningType >::s(3, 3, 0.0);
+thread_local VoigtVector CamClay_PF<p0HardeningType >::s(3, 3, 0.0);
 template<class p0HardeningType>
-VoigtVector CamClay_PF<p0HardeningType >::result(3, 3, 0.0);
+thread_local VoigtVector CamClay_PF<p0HardeningType >::result(3, 3, 0.0);
 
 #endif
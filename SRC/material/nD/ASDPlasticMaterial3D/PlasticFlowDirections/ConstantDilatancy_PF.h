@@ -80,12 +80,12 @@ public:
 
 private:
 
-    static VoigtVector result; //For returning VoigtVectors
+    static thread_local VoigtVector result; //For returning VoigtVectors
 
 };
 
 
 template<class AlphaHardeningType>
-VoigtVector ConstantDilatancy_PF<AlphaHardeningType  >::result;
+thread_local VoigtVector ConstantDilatancy_PF<AlphaHardeningType  >::result;
 
 #endif
@@ -96,7 +96,7 @@ public:
         return result;
     }
     VoigtMatrix const& dm_over_dsigma(VoigtVector const& sigma){
-        static VoigtVector s(3, 3, 0.0);
+        thread_local VoigtVector s(3, 3, 0.0);
         const VoigtVector &alpha = alpha_.getVariableConstReference();
         // const double &k = k_.getVariableConstReference();
         double p=0.0;
@@ -105,7 +105,7 @@ public:
         // if(p<MACHINE_EPSILON){
         //     cout<<"DruckerPragerNonAssociate_PF:: pressuse < 0 ! The Drucker-Prager has tensile force.\n";
         // }
-        static VoigtVector s_minus_palpha(3,3,0.0);
+        thread_local VoigtVector s_minus_palpha(3,3,0.0);
         s_minus_palpha(i,j) = s(i,j) - p*alpha(i,j);
         double s_minus_p_alpha_square = s_minus_palpha(i,j) * s_minus_palpha(i,j) ; 
         double s_square = s(i,j) * s(i,j) ; 
@@ -117,7 +117,7 @@ public:
         double alpha_volume = alpha(i,i);
         double alpha_times_s= alpha(i,j) * s(i,j);
         // =========================================
-        static VoigtMatrix dm__dsigma(3,3,3,3,0.0);
+        thread_local VoigtMatrix dm__dsigma(3,3,3,3,0.0);
         dm__dsigma*=0;
         // Four free indices
         for (int ig = 0; ig < 3; ++ig)
@@ -158,22 +158,22 @@ public:
     
 
     VoigtVector const& dm_over_dq_start_h_star(VoigtVector const& depsilon, VoigtVector const& pf_m, const VoigtVector& stress){
-        static VoigtVector s(3, 3, 0.0);
+        thread_local VoigtVector s(3, 3, 0.0);
         const VoigtVector &alpha = alpha_.getVariableConstReference();
         const double &k = k_.getVariableConstReference();
         double p=0;
         stress.compute_deviatoric_tensor(s, p); // here p is positive if in tension
         p=-p;
 
-        static VoigtMatrix IdentityTensor4(3,3,3,3, 0); 
+        thread_local VoigtMatrix IdentityTensor4(3,3,3,3, 0); 
         IdentityTensor4(i,j,k,l)=kronecker_delta(i, j)*kronecker_delta(k,l);
         // (1) isotropic hardening part. 
-        static VoigtVector dm_dk(3,3,0.0);
+        thread_local VoigtVector dm_dk(3,3,0.0);
         dm_dk(i,j) = SQRT_2_over_27 * kronecker_delta(i, j) ; 
 
         // (2) kinematic hardening part
-        static VoigtMatrix dm_dalpha(3,3,3,3,0.0);
-        static VoigtVector s_minus_p_alpha(3,3,0.0);
+        thread_local VoigtMatrix dm_dalpha(3,3,3,3,0.0);
+        thread_local VoigtVector s_minus_p_alpha(3,3,0.0);
         s_minus_p_alpha(i,j) = s(i,j) - p * alpha(i,j);
         double s_minus_p_alpha_square = s_minus_p_alpha(i,j) * s_minus_p_alpha(i,j) ; 
 
@@ -193,7 +193,7 @@ public:
                             );
                         }
 
-        static VoigtVector ret(3,3,0.0);
+        thread_local VoigtVector ret(3,3,0.0);
         ret(i,j) = dm_dalpha(i,j,m,n) * alpha_.getDerivative(depsilon, pf_m, stress)(m,n);
         ret(i,j) += dm_dk(i,j) * k_.getDerivative(depsilon, pf_m, stress) ;
                 
@@ -204,16 +204,16 @@ private:
     AlphaType &alpha_;
     KType &k_;
 
-    static VoigtVector s; //sigma deviator
-    static VoigtVector result; //For returning VoigtVectors
+    static thread_local VoigtVector s; //sigma deviator
+    static thread_local VoigtVector result; //For returning VoigtVectors
 
 };
 
 
 template<class AlphaHardeningType, class KHardeningType>
-VoigtVector DruckerPragerDeviatoric_PF<AlphaHardeningType , KHardeningType >::s(3, 3, 0.0);
+thread_local VoigtVector DruckerPragerDeviatoric_PF<AlphaHardeningType , KHardeningType >::s(3, 3, 0.0);
 template<class AlphaHardeningType, class KHardeningType>
-VoigtVector DruckerPragerDeviatoric_PF<AlphaHardeningType , KHardeningType >::result(3, 3, 0.0);
+thread_local VoigtVector DruckerPragerDeviatoric_PF<AlphaHardeningType , KHardeningType >::result(3, 3, 0.0);
 
 #endif
 
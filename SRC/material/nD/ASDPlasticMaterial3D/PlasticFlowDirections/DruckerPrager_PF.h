@@ -69,12 +69,12 @@ public:
 
 private:
 
-    static VoigtVector result; //For returning VoigtVectors
+    static thread_local VoigtVector result; //For returning VoigtVectors
 
 };
 
 
 template<class AlphaHardeningType, class KHardeningType>
-VoigtVector DruckerPrager_PF<AlphaHardeningType, KHardeningType  >::result;
+thread_local VoigtVector DruckerPrager_PF<AlphaHardeningType, KHardeningType  >::result;
 
 #endif
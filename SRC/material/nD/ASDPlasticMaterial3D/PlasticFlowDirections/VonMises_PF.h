@@ -66,11 +66,11 @@ public:
 
 private:
 
-    static VoigtVector result; //For returning VoigtVectors
+    static thread_local VoigtVector result; //For returning VoigtVectors
 };
 
 template<class AlphaHardeningType>
-VoigtVector VonMises_PF<AlphaHardeningType  >::result;
+thread_local VoigtVector VonMises_PF<AlphaHardeningType  >::result;
 
 
 #endif
\ No newline at end of file
@@ -124,14 +124,14 @@ private:
 
     double M;
     p0Type &p0_;
-    static VoigtVector s; //Stress deviator
-    static VoigtVector result; //For returning VoigtVector's
+    static thread_local VoigtVector s; //Stress deviator
+    static thread_local VoigtVector result; //For returning VoigtVector's
 };
 
 template <class p0HardeningType>
-VoigtVector CamClay_YF<p0HardeningType>::s(3, 3, 0.0);
+thread_local VoigtVector CamClay_YF<p0HardeningType>::s(3, 3, 0.0);
 template <class p0HardeningType>
-VoigtVector CamClay_YF<p0HardeningType>::result(3, 3, 0.0);
+thread_local VoigtVector CamClay_YF<p0HardeningType>::result(3, 3, 0.0);
 
 
 #endif
\ No newline at end of file
@@ -107,11 +107,11 @@ public:
 
 private:
 
-    static VoigtVector result; //For returning VoigtVector's
+    static thread_local VoigtVector result; //For returning VoigtVector's
 };
 
 template <class AlphaHardeningType,  class KHardeningType>
-VoigtVector DruckerPrager_YF<AlphaHardeningType, KHardeningType>::result;
+thread_local VoigtVector DruckerPrager_YF<AlphaHardeningType, KHardeningType>::result;
 
 //Declares this YF as featuring an apex
 template<class AlphaHardeningType, class KHardeningType>
@@ -167,11 +167,11 @@ private:
         return dg;
     }
 
-    static VoigtVector result; //For returning VoigtVector's
+    static thread_local VoigtVector result; //For returning VoigtVector's
 };
 
 template <class EtaHardeningType>
-VoigtVector RoundedMohrCoulomb_YF<EtaHardeningType>::result;
+thread_local VoigtVector RoundedMohrCoulomb_YF<EtaHardeningType>::result;
 
 //Declares this YF as featuring an apex
 template<class EtaHardeningType>
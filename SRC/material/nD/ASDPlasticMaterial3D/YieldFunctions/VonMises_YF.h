@@ -121,12 +121,12 @@ public:
 
 private:
 
-    static VoigtVector result; //For returning VoigtVector's
+    static thread_local VoigtVector result; //For returning VoigtVector's
 
 };
 
 template <class AlphaHardeningType,  class KHardeningType>
-VoigtVector VonMises_YF<AlphaHardeningType, KHardeningType>::result;
+thread_local VoigtVector VonMises_YF<AlphaHardeningType, KHardeningType>::result;
 
 
 #endif
\ No newline at end of file
@@ -17,9 +17,9 @@
 #include <elementAPI.h>
 #include <MaterialResponse.h>
 
-Matrix AcousticMedium::D(1,1);	  // global for AcousticMedium only
-Vector AcousticMedium::sigma(3);	// global for AcousticMedium only
-Matrix AcousticMedium::DSensitivity(1,1);	  // global for AcousticMedium only
+thread_local Matrix AcousticMedium::D(1,1);	  // global for AcousticMedium only
+thread_local Vector AcousticMedium::sigma(3);	// global for AcousticMedium only
+thread_local Matrix AcousticMedium::DSensitivity(1,1);	  // global for AcousticMedium only
 
 void * OPS_ADD_RUNTIME_VPV(OPS_AcousticMedium)
 {
@@ -235,7 +235,7 @@ AcousticMedium::sendSelf (int commitTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(4);
+  Vector data(4);
   
   data(0) = this->getTag();
   data(1) = Kf;
@@ -261,7 +261,7 @@ AcousticMedium::recvSelf (int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(4);
+  Vector data(4);
   
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -397,10 +397,10 @@ const Vector &  AcousticMedium::getStressSensitivity (int gradNumber, bool condi
 	}
 
   // --- define history variables -----------
-	static Vector CepsilonSensitivity(3);	CepsilonSensitivity.Zero();
-	static Vector CsigmaSensitivity(3);   	CsigmaSensitivity.Zero();
+	thread_local Vector CepsilonSensitivity(3);	CepsilonSensitivity.Zero();
+	thread_local Vector CsigmaSensitivity(3);   	CsigmaSensitivity.Zero();
 
-	static Vector sigmaSensitivity(3);
+	thread_local Vector sigmaSensitivity(3);
     sigmaSensitivity.Zero();
 
 	Vector epsilonSensitivity(3);   epsilonSensitivity.Zero();   // conditional sensitivity
@@ -420,8 +420,8 @@ int AcousticMedium::commitSensitivity(const Vector & strainGradient, int gradNum
 	double rhoSensitivity = 0.0;
 	double GammaSensitivity = 0.0;  
  
-	static Vector epsilonSensitivity(3);	epsilonSensitivity.Zero();
-	static Vector sigmaSensitivity(3);   	sigmaSensitivity.Zero();
+	thread_local Vector epsilonSensitivity(3);	epsilonSensitivity.Zero();
+	thread_local Vector sigmaSensitivity(3);   	sigmaSensitivity.Zero();
 
 		epsilonSensitivity[0] = strainGradient[0];
 		epsilonSensitivity[1] = strainGradient[1];
@@ -443,8 +443,8 @@ if (parameterID == 1) {
 
 	}
   // --- define history variables -----------
-	static Vector CepsilonSensitivity(3);	CepsilonSensitivity.Zero();
-	static Vector CsigmaSensitivity(3);   	CsigmaSensitivity.Zero();
+	thread_local Vector CepsilonSensitivity(3);	CepsilonSensitivity.Zero();
+	thread_local Vector CsigmaSensitivity(3);   	CsigmaSensitivity.Zero();
 
 
 	sigmaSensitivity.addVector(0.0, epsilonSensitivity, rho); 
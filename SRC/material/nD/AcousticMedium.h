@@ -86,10 +86,10 @@ class AcousticMedium : public NDMaterial
     double Gamma;	// volumetric drag, force per unit volume per velocity
 
   private:
-    static Vector sigma;        // Stress vector
-    static Matrix D;            // Elastic constantsVector sigma;
+    static thread_local Vector sigma;        // Stress vector
+    static thread_local Matrix D;            // Elastic constantsVector sigma;
     Vector epsilon;		// Strain vector
-    static Matrix DSensitivity;            // Elastic constantsVector sigma;
+    static thread_local Matrix DSensitivity;            // Elastic constantsVector sigma;
 
 
 
@@ -37,8 +37,8 @@ using std::ofstream;          // Quan Gu   2013 March   HK
 using std::ios;               // Quan Gu   2013 March   HK
   
 
-Vector CapPlasticity::tempVector(6);
-Matrix CapPlasticity::tempMatrix(6,6);  
+thread_local Vector CapPlasticity::tempVector(6);
+thread_local Matrix CapPlasticity::tempMatrix(6,6);  
 
 void * OPS_ADD_RUNTIME_VPV(OPS_CapPlasticity) {
   int tag;
@@ -303,7 +303,7 @@ const Vector & CapPlasticity::getStrain(void) {
   }
   
   else {
-    static Vector workV(3);//, temp6(6);
+    thread_local Vector workV(3);//, temp6(6);
     workV[0] = -1.0*strain[0];
     workV[1] = -1.0*strain[1];
     workV[2] = -1.0*strain[3];
@@ -397,7 +397,7 @@ CapPlasticity::setResponse (const char **argv, int argc, OPS_Stream &output) {
     return new MaterialResponse(this, 5, hardening_k);
   
   else if (strcmp(argv[0],"stress_and_k") == 0 ){
-    static Vector dummy(7); 
+    thread_local Vector dummy(7); 
     return new MaterialResponse(this, 6, dummy);
   }
   
@@ -437,7 +437,7 @@ int CapPlasticity::getResponse (int responseID, Information &matInfo)  {
     return 0;
     
   case 6:
-    static Vector dummy(7); 
+    thread_local Vector dummy(7); 
     for (int i=0; i<6; i++)
       dummy(i) = stress(i);
     dummy(6) = this->hardening_k;
@@ -853,7 +853,7 @@ const Matrix & CapPlasticity::getTangent(void) {
   if (ndm==3) 
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -1038,7 +1038,7 @@ const Vector & CapPlasticity::getStress(void) {
   }
   
   else {
-    static Vector workV(3);//, temp6(6);
+    thread_local Vector workV(3);//, temp6(6);
     workV[0] = -1.0*stress[0];
     workV[1] = -1.0*stress[1];
     workV[2] = -1.0*stress[3];
@@ -1244,7 +1244,7 @@ CapPlasticity::tripleTensorProduct (Vector &A, Matrix &B, Vector &C){ // result
 		exit(-1);
 	}
 
-	static Vector tmp(6);
+	thread_local Vector tmp(6);
 	double result = 0.0;
 
 	tmp.addMatrixVector(0.0, B, C, 1.0);
@@ -1348,7 +1348,7 @@ CapPlasticity::computeConsistentTangent(double deltaGammar1, double deltaGammar2
 	   a(0,1) = tripleTensorProduct (thedFdSigma,Zig,thedF2dSigmadk)-1.0/deltaGammar2*dFdk(1);
 
 // ---
-	 static Vector stressDev(6);
+	 thread_local Vector stressDev(6);
 		stressDev = stress;
 	 double I1 = stress(0)+stress(1)+stress(2);
 	    
@@ -1366,15 +1366,15 @@ CapPlasticity::computeConsistentTangent(double deltaGammar1, double deltaGammar2
 
 	 a(1,1) = tripleTensorProduct(thedF2dSigmadk, Zig, thedF2dSigmadk) + 1.0/deltaGammar2*dFdIdk()-1.0/3.0/deltaGammar2/deltaGammar2*dHdk(hardening_k);
 
-	 static Matrix invA(2,2);
+	 thread_local Matrix invA(2,2);
 
      // invA = inverse(a);	   
 	 a.Invert(invA);
 
 
 	
-	 static Vector N0(6);
-	 static Vector N1(6);
+	 thread_local Vector N0(6);
+	 thread_local Vector N1(6);
 
 	 N0.addMatrixVector(0.0, Zig, thedFdSigma,1.0); 
 	 N1.addMatrixVector(0.0, Zig, thedF2dSigmadk,1.0); 
@@ -1424,8 +1424,8 @@ CapPlasticity::computeConsistentTangent(double deltaGammar1, double deltaGammar2
 	   Zig.Invert(tempMatrix);
 	   Zig = tempMatrix;
 
-	   static Vector N3(6);	
-	   static Vector thedFdSigma(6);
+	   thread_local Vector N3(6);	
+	   thread_local Vector thedFdSigma(6);
 
 	   thedFdSigma = dFdSigma(mode);
 	   
@@ -1456,8 +1456,8 @@ CapPlasticity::computeConsistentTangent(double deltaGammar1, double deltaGammar2
 	   Zig.Invert(tempMatrix);
 	   Zig = tempMatrix;
 
-	   static Vector N1(6);	
-	   static Vector thedFdSigma(6);
+	   thread_local Vector N1(6);	
+	   thread_local Vector thedFdSigma(6);
 
 	   thedFdSigma = dFdSigma(mode);
 	   
@@ -1480,8 +1480,8 @@ CapPlasticity::computeConsistentTangent(double deltaGammar1, double deltaGammar2
 //----------------------------------
    else if (mode ==2){
 
-	   static Vector thedFdSigma1(6);
-	   static Vector thedFdSigma3(6);
+	   thread_local Vector thedFdSigma1(6);
+	   thread_local Vector thedFdSigma3(6);
 
 	   thedFdSigma1 = dFdSigma(5);     // dF1/dSigma  --- mode 5
 	   thedFdSigma3 = dFdSigma(1);     // dF3/dSigma  --- mode 1
@@ -1516,8 +1516,8 @@ CapPlasticity::computeConsistentTangent(double deltaGammar1, double deltaGammar2
 
 
 
-   static Vector N1(6);   
-   static Vector N3(6);   
+   thread_local Vector N1(6);   
+   thread_local Vector N3(6);   
 
    N1.addMatrixVector(0.0, Zig, thedFdSigma1,1.0); 
    N3.addMatrixVector(0.0, Zig, thedFdSigma3,1.0); 
@@ -1557,8 +1557,8 @@ CapPlasticity::computeConsistentTangent(double deltaGammar1, double deltaGammar2
 //----------------------------------
    else if (mode ==4){
 
-	   static Vector thedFdSigma1(6);
-	   static Vector thedFdSigma2(6);
+	   thread_local Vector thedFdSigma1(6);
+	   thread_local Vector thedFdSigma2(6);
 
 	   thedFdSigma1 = dFdSigma(5);     // dF1/dSigma  --- mode 5
 	   thedFdSigma2 = dFdSigma(3);     // dF2/dSigma  --- mode 3
@@ -1593,8 +1593,8 @@ CapPlasticity::computeConsistentTangent(double deltaGammar1, double deltaGammar2
 
 
 
-	   static Vector N1(6);   
-	   static Vector N2(6);   
+	   thread_local Vector N1(6);   
+	   thread_local Vector N2(6);   
 
 	   N1.addMatrixVector(0.0, Zig, thedFdSigma1,1.0); 
 	   N2.addMatrixVector(0.0, Zig, thedFdSigma2,1.0); 
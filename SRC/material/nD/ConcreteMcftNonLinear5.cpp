@@ -808,7 +808,7 @@ ConcreteMcftNonLinear5::activateParameter(int passedParameterID)
 const Vector&
 ConcreteMcftNonLinear5::getStressSensitivity(int gradNumber, bool conditional)
 {
-  static Vector zerodsigdh(2);
+  thread_local Vector zerodsigdh(2);
 
   if (  parameterID == 1 ) {
     //opserr << " check25 " << endln;
@@ -846,7 +846,7 @@ int
 ConcreteMcftNonLinear5::getResponse (int responseID, Information &matInformation)
 {
 //opserr << " check28 " << endln;
-	static Vector crackInfo(5);
+	thread_local Vector crackInfo(5);
 	if (responseID == 10) {
 		
 		crackInfo(0) = epsf(0);
@@ -859,7 +859,7 @@ ConcreteMcftNonLinear5::getResponse (int responseID, Information &matInformation
 
 		matInformation.setVector(crackInfo);
 	} 
-	static Vector prinStress(8);
+	thread_local Vector prinStress(8);
 	if (responseID == 11) {
 		
 		prinStress(0) = Sigma1;
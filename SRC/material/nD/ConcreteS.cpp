@@ -186,8 +186,8 @@ ConcreteS::revertToStart( )
 int 
 ConcreteS::setTrialStrain( const Vector &strainFromElement )
 {
-  static Matrix CfCf(3,3);
-  static Vector flow(3), Cf(3);
+  thread_local Matrix CfCf(3,3);
+  thread_local Vector flow(3), Cf(3);
   double vStress, vStress1, yieldFunc;
   double fCf, sigm, sigd, theta;
   double ps1, ps2, psmax, tStrain, eps;
@@ -336,7 +336,7 @@ ConcreteS::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0, cnt = 0;
 
-  static Vector data(13);
+  Vector data(13);
 
   data(cnt++) = this->getTag();
   data(cnt++) = E;
@@ -365,7 +365,7 @@ ConcreteS::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBro
 {
   int res = 0, cnt = 0;
 
-  static Vector data(13);
+  Vector data(13);
 
   res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Predictor for the condensed strains of a wrapper that condenses nc
+// components out of a three dimensional material, given the ne strains it
+// receives from the element. It keeps the sensitivity -dd22^-1 dd21 of the
+// condensed strains at the last converged condensation, as trial and
+// committed state, and predicts the condensed strains of the next trial
+// strain from it. The prediction is exact when the wrapped material is
+// linear in the condensed directions, so the Newton loop of the wrapper
+// then converges with a single three dimensional evaluation.
+//
+#ifndef CondensedStrainPredictor_h
+#define CondensedStrainPredictor_h
+
+#include <math.h>
+#include <Matrix.h>
+
+template <int nc, int ne>
+class CondensedStrainPredictor {
+public:
+  CondensedStrainPredictor() { this->zero(); }
+
+  void
+  zero()
+  {
+    for (int i = 0; i < nc; i++)
+      for (int j = 0; j < ne; j++)
+        Tsens[i][j] = Csens[i][j] = 0.0;
+  }
+
+  void
+  commit()
+  {
+    for (int i = 0; i < nc; i++)
+      for (int j = 0; j < ne; j++)
+        Csens[i][j] = Tsens[i][j];
+  }
+
+  void
+  revert()
+  {
+    for (int i = 0; i < nc; i++)
+      for (int j = 0; j < ne; j++)
+        Tsens[i][j] = Csens[i][j];
+  }
+
+  // Increments dc of the condensed strains for the increments de of the
+  // element strains
+  void
+  predict(const double (&de)[ne], double (&dc)[nc]) const
+  {
+    for (int i = 0; i < nc; i++) {
+      dc[i] = 0.0;
+      for (int j = 0; j < ne; j++)
+        dc[i] += Tsens[i][j]*de[j];
+    }
+  }
+
+  // Sensitivity from the three dimensional tangent of a converged
+  // condensation; condensed and retained are the components of the
+  // condensed and of the element strains in the tangent
+  void
+  update(const Matrix &tangent, const int (&condensed)[nc], const int (&retained)[ne])
+  {
+    double dd22[nc][nc];
+    for (int i = 0; i < nc; i++) {
+      for (int k = 0; k < nc; k++)
+        dd22[i][k] = tangent(condensed[i], condensed[k]);
+      for (int j = 0; j < ne; j++)
+        Tsens[i][j] = -tangent(condensed[i], retained[j]);
+    }
+
+    // Gauss elimination with partial pivoting, all columns at once
+    for (int k = 0; k < nc; k++) {
+      int p = k;
+      for (int i = k + 1; i < nc; i++)
+        if (fabs(dd22[i][k]) > fabs(dd22[p][k]))
+          p = i;
+      // Singular trial, no prediction; the committed sensitivity is kept
+      // for a revert
+      if (dd22[p][k] == 0.0) {
+        for (int i = 0; i < nc; i++)
+          for (int j = 0; j < ne; j++)
+            Tsens[i][j] = 0.0;
+        return;
+      }
+      if (p != k) {
+        for (int c = 0; c < nc; c++) {
+          double t = dd22[k][c]; dd22[k][c] = dd22[p][c]; dd22[p][c] = t;
+        }
+        for (int j = 0; j < ne; j++) {
+          double t = Tsens[k][j]; Tsens[k][j] = Tsens[p][j]; Tsens[p][j] = t;
+        }
+      }
+      for (int i = k + 1; i < nc; i++) {
+        const double f = dd22[i][k]/dd22[k][k];
+        for (int c = k; c < nc; c++)
+          dd22[i][c] -= f*dd22[k][c];
+        for (int j = 0; j < ne; j++)
+          Tsens[i][j] -= f*Tsens[k][j];
+      }
+    }
+    for (int i = nc - 1; i >= 0; i--)
+      for (int j = 0; j < ne; j++) {
+        double s = Tsens[i][j];
+        for (int c = i + 1; c < nc; c++)
+          s -= dd22[i][c]*Tsens[c][j];
+        Tsens[i][j] = s/dd22[i][i];
+      }
+  }
+
+private:
+  double Tsens[nc][ne];
+  double Csens[nc][ne];
+};
+
+#endif
@@ -33,6 +33,7 @@
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <matrix/identity.h> // IbunI, IIdev
 
 #include <Information.h>
 #include <MaterialResponse.h>
@@ -51,9 +52,6 @@ const double CycLiqCP :: pat=101.0;
 const double CycLiqCP :: pcut=0.5;    // cut off confining stress
 const double CycLiqCP :: pmin=0.5;    // cut off confining stress
 
-double CycLiqCP::initialTangent[3][3][3][3] ;   //material tangent
-double CycLiqCP::IIdev[3][3][3][3] ; //rank 4 deviatoric 
-double CycLiqCP::IbunI[3][3][3][3] ; //rank 4 I bun I 
 double CycLiqCP::mElastFlag = 0;
 
 #include <elementAPI.h>
@@ -113,10 +111,19 @@ void * OPS_ADD_RUNTIME_VPV(OPS_CycLiqCPMaterial)
 }
 
 //static vectors and matrices
-Vector CycLiqCP :: strain_vec(6) ;
-Vector CycLiqCP :: stress_vec(6) ;
-Matrix CycLiqCP :: tangent_matrix(6,6) ;
-Matrix CycLiqCP :: I(6,6);
+thread_local Vector CycLiqCP :: strain_vec(6) ;
+thread_local Vector CycLiqCP :: stress_vec(6) ;
+thread_local Matrix CycLiqCP :: tangent_matrix(6,6) ;
+// rank 2 identity
+static Matrix
+identityTensor2()
+{
+  Matrix I(6,6);
+  I(0,0) = I(1,1) = I(2,2) = 1.0;
+  return I;
+}
+
+const Matrix CycLiqCP :: I = identityTensor2();
 
 
 //zero internal variables
@@ -176,63 +183,6 @@ stress_nplus1(3,3)
 
   this->zero( ) ;     // or (*this).zero( ) 
 
-  int i, j, k, l ;
-
-  //zero rank4 IIdev and IbunI 
-  for ( i = 0; i < 3; i++ ) {
-    for ( j = 0; j < 3; j++ )  {
-      for ( k = 0; k < 3; k++ ) {
-	for ( l = 0; l < 3; l++)  { 
-
-	  IbunI[i][j][k][l] = 0.0 ;
-
-	  IIdev[i][j][k][l] = 0.0 ;
-
-	} // end for l
-      } // end for k
-    } // end for j
-  } // end for i
-
-
-  //form rank4 IbunI 
-
-  IbunI [0][0] [0][0] = 1.0 ;
-  IbunI [0][0] [1][1] = 1.0 ;
-  IbunI [0][0] [2][2] = 1.0 ;
-  IbunI [1][1] [0][0] = 1.0 ;
-  IbunI [1][1] [1][1] = 1.0 ;
-  IbunI [1][1] [2][2] = 1.0 ;
-  IbunI [2][2] [0][0] = 1.0 ;
-  IbunI [2][2] [1][1] = 1.0 ;
-  IbunI [2][2] [2][2] = 1.0 ;
-
-  //form rank4 IIdev
-
-  IIdev [0][0] [0][0] =  two3 ; // 0.666667 
-  IIdev [0][0] [1][1] = -one3 ; //-0.333333 
-  IIdev [0][0] [2][2] = -one3 ; //-0.333333 
-  IIdev [0][1] [0][1] = 0.5 ;
-  IIdev [0][1] [1][0] = 0.5 ;
-  IIdev [0][2] [0][2] = 0.5 ;
-  IIdev [0][2] [2][0] = 0.5 ;
-  IIdev [1][0] [0][1] = 0.5 ;
-  IIdev [1][0] [1][0] = 0.5 ;
-  IIdev [1][1] [0][0] = -one3 ; //-0.333333 
-  IIdev [1][1] [1][1] =  two3 ; // 0.666667 
-  IIdev [1][1] [2][2] = -one3 ; //-0.333333 
-  IIdev [1][2] [1][2] = 0.5 ;
-  IIdev [1][2] [2][1] = 0.5 ;
-  IIdev [2][0] [0][2] = 0.5 ;
-  IIdev [2][0] [2][0] = 0.5 ;
-  IIdev [2][1] [1][2] = 0.5 ;
-  IIdev [2][1] [2][1] = 0.5 ;
-  IIdev [2][2] [0][0] = -one3 ; //-0.333333 
-  IIdev [2][2] [1][1] = -one3 ; //-0.333333 
-  IIdev [2][2] [2][2] =  two3 ; // 0.666667 
-
-  I.Zero();
-  I(0,0)=I(1,1)=I(2,2)=1.0;
-
   plastic_integrator();
 }
 
@@ -279,63 +229,6 @@ stress_nplus1(3,3)
 
   this->zero( ) ;
 
-  int i, j, k, l ;
-
-  //zero rank4 IIdev and IbunI 
-  for ( i = 0; i < 3; i++ ) {
-    for ( j = 0; j < 3; j++ )  {
-      for ( k = 0; k < 3; k++ ) {
-	for ( l = 0; l < 3; l++)  { 
-
-	  IbunI[i][j][k][l] = 0.0 ;
-
-	  IIdev[i][j][k][l] = 0.0 ;
-
-	} // end for l
-      } // end for k
-    } // end for j
-  } // end for i
-
-
-  //form rank4 IbunI 
-
-  IbunI [0][0] [0][0] = 1.0 ;
-  IbunI [0][0] [1][1] = 1.0 ;
-  IbunI [0][0] [2][2] = 1.0 ;
-  IbunI [1][1] [0][0] = 1.0 ;
-  IbunI [1][1] [1][1] = 1.0 ;
-  IbunI [1][1] [2][2] = 1.0 ;
-  IbunI [2][2] [0][0] = 1.0 ;
-  IbunI [2][2] [1][1] = 1.0 ;
-  IbunI [2][2] [2][2] = 1.0 ;
-
-  //form rank4 IIdev
-
-  IIdev [0][0] [0][0] =  two3 ; // 0.666667 
-  IIdev [0][0] [1][1] = -one3 ; //-0.333333 
-  IIdev [0][0] [2][2] = -one3 ; //-0.333333 
-  IIdev [0][1] [0][1] = 0.5 ;
-  IIdev [0][1] [1][0] = 0.5 ;
-  IIdev [0][2] [0][2] = 0.5 ;
-  IIdev [0][2] [2][0] = 0.5 ;
-  IIdev [1][0] [0][1] = 0.5 ;
-  IIdev [1][0] [1][0] = 0.5 ;
-  IIdev [1][1] [0][0] = -one3 ; //-0.333333 
-  IIdev [1][1] [1][1] =  two3 ; // 0.666667 
-  IIdev [1][1] [2][2] = -one3 ; //-0.333333 
-  IIdev [1][2] [1][2] = 0.5 ;
-  IIdev [1][2] [2][1] = 0.5 ;
-  IIdev [2][0] [0][2] = 0.5 ;
-  IIdev [2][0] [2][0] = 0.5 ;
-  IIdev [2][1] [1][2] = 0.5 ;
-  IIdev [2][1] [2][1] = 0.5 ;
-  IIdev [2][2] [0][0] = -one3 ; //-0.333333 
-  IIdev [2][2] [1][1] = -one3 ; //-0.333333 
-  IIdev [2][2] [2][2] =  two3 ; // 0.666667 
-
-  I.Zero();
-  I(0,0)=I(1,1)=I(2,2)=1.0;
-
     plastic_integrator();
 }
 
@@ -402,17 +295,17 @@ void CycLiqCP :: plastic_integrator( )
   const double tole = 1.0e-6*pcut ; //tolerance
   const double dt = ops_Dt ; //time step
 
-  static Matrix dev_strain(3,3) ; //deviatoric strain
+  thread_local Matrix dev_strain(3,3) ; //deviatoric strain
 
-  static Matrix dev_strain_n(3,3) ; //deviatoric strain of last step
+  thread_local Matrix dev_strain_n(3,3) ; //deviatoric strain of last step
 
-  static Matrix ddev_strain_p(3,3); //plastic deviatoric strain increment
+  thread_local Matrix ddev_strain_p(3,3); //plastic deviatoric strain increment
 
-  static Matrix dev_stress(3,3) ; //deviatoric stress
+  thread_local Matrix dev_stress(3,3) ; //deviatoric stress
 
-  static Matrix dev_stress_n(3,3) ; //deviatoric stress of last step
+  thread_local Matrix dev_stress_n(3,3) ; //deviatoric stress of last step
  
-  static Matrix normal(3,3) ;     //(dev_stress-alpha_n)/p_n/sqrt(2/3)/m
+  thread_local Matrix normal(3,3) ;     //(dev_stress-alpha_n)/p_n/sqrt(2/3)/m
 
   Matrix pass(3,3); //matrix to pass on values
   double G0ep;
@@ -1040,7 +933,7 @@ CycLiqCP::sendSelf(int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(20+9*3);
+  Vector data(20+9*3);
   int cnt = 0;
   data(cnt++) = this->getTag();
 
@@ -1091,7 +984,7 @@ CycLiqCP::recvSelf (int commitTag, Channel &theChannel,
 {
 
   // recv the vector object from the channel which defines material param and state
-  static Vector data(20+9*3);
+  Vector data(20+9*3);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "CycLiqCP::recvSelf - failed to recv vector from channel\n";
     return -1;
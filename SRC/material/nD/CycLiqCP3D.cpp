@@ -40,9 +40,9 @@
 
 
 //static vectors and matrices
-Vector CycLiqCP3D :: strain_vec(6) ;
-Vector CycLiqCP3D :: stress_vec(6) ;
-Matrix CycLiqCP3D :: tangent_matrix(6,6) ;
+thread_local Vector CycLiqCP3D :: strain_vec(6) ;
+thread_local Vector CycLiqCP3D :: stress_vec(6) ;
+thread_local Matrix CycLiqCP3D :: tangent_matrix(6,6) ;
 
 //null constructor
 CycLiqCP3D :: CycLiqCP3D() :
@@ -127,7 +127,7 @@ int CycLiqCP3D :: setTrialStrain( const Vector &v, const Vector &r )
 
 int CycLiqCP3D :: setTrialStrainIncr( const Vector &v ) 
 {
-  static Vector newStrain(6);
+  thread_local Vector newStrain(6);
   newStrain(0) = strain_nplus1(0,0) + v(0);
   newStrain(1) = strain_nplus1(1,1) + v(1);
   newStrain(2) = strain_nplus1(2,2) + v(2);
@@ -245,7 +245,7 @@ CycLiqCP3D::sendSelf(int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(20+9*3);
+  Vector data(20+9*3);
   int cnt = 0;
   data(cnt++) = this->getTag();
 
@@ -295,7 +295,7 @@ CycLiqCP3D::recvSelf (int commitTag, Channel &theChannel,
 {
 
   // recv the vector object from the channel which defines material param and state
-  static Vector data(20+9*3);
+  Vector data(20+9*3);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "CycLiqCP::recvSelf - failed to recv vector from channel\n";
     return -1;
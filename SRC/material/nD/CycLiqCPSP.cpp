@@ -31,6 +31,7 @@
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <matrix/identity.h> // IbunI, IIdev
 
 #include <Information.h>
 #include <MaterialResponse.h>
@@ -49,9 +50,6 @@ const double CycLiqCPSP :: pat=101.0;
 const double CycLiqCPSP :: pcut=0.5;    // cut off confining stress
 const double CycLiqCPSP :: pmin=0.5;    // cut off confining stress
 
-double CycLiqCPSP::initialTangent[3][3][3][3] ;   //material tangent
-double CycLiqCPSP::IIdev[3][3][3][3] ; //rank 4 deviatoric 
-double CycLiqCPSP::IbunI[3][3][3][3] ; //rank 4 I bun I 
 double CycLiqCPSP::mElastFlag = 0;
 
 #include <elementAPI.h>
@@ -112,10 +110,19 @@ OPS_Export void * OPS_ADD_RUNTIME_VPV(OPS_CycLiqCPSPMaterial)
 
 
 //static vectors and matrices
-Vector CycLiqCPSP :: strain_vec(6) ;
-Vector CycLiqCPSP :: stress_vec(6) ;
-Matrix CycLiqCPSP :: tangent_matrix(6,6) ;
-Matrix CycLiqCPSP :: I(6,6);
+thread_local Vector CycLiqCPSP :: strain_vec(6) ;
+thread_local Vector CycLiqCPSP :: stress_vec(6) ;
+thread_local Matrix CycLiqCPSP :: tangent_matrix(6,6) ;
+// rank 2 identity
+static Matrix
+identityTensor2()
+{
+  Matrix I(6,6);
+  I(0,0) = I(1,1) = I(2,2) = 1.0;
+  return I;
+}
+
+const Matrix CycLiqCPSP :: I = identityTensor2();
 
 
 //zero internal variables
@@ -183,63 +190,6 @@ stress_nplus1(3,3)
 
   this->zero( ) ;     // or (*this).zero( ) 
 
-  int i, j, k, l ;
-
-  //zero rank4 IIdev and IbunI 
-  for ( i = 0; i < 3; i++ ) {
-    for ( j = 0; j < 3; j++ )  {
-      for ( k = 0; k < 3; k++ ) {
-	for ( l = 0; l < 3; l++)  { 
-
-	  IbunI[i][j][k][l] = 0.0 ;
-
-	  IIdev[i][j][k][l] = 0.0 ;
-
-	} // end for l
-      } // end for k
-    } // end for j
-  } // end for i
-
-
-  //form rank4 IbunI 
-
-  IbunI [0][0] [0][0] = 1.0 ;
-  IbunI [0][0] [1][1] = 1.0 ;
-  IbunI [0][0] [2][2] = 1.0 ;
-  IbunI [1][1] [0][0] = 1.0 ;
-  IbunI [1][1] [1][1] = 1.0 ;
-  IbunI [1][1] [2][2] = 1.0 ;
-  IbunI [2][2] [0][0] = 1.0 ;
-  IbunI [2][2] [1][1] = 1.0 ;
-  IbunI [2][2] [2][2] = 1.0 ;
-
-  //form rank4 IIdev
-
-  IIdev [0][0] [0][0] =  two3 ; // 0.666667 
-  IIdev [0][0] [1][1] = -one3 ; //-0.333333 
-  IIdev [0][0] [2][2] = -one3 ; //-0.333333 
-  IIdev [0][1] [0][1] = 0.5 ;
-  IIdev [0][1] [1][0] = 0.5 ;
-  IIdev [0][2] [0][2] = 0.5 ;
-  IIdev [0][2] [2][0] = 0.5 ;
-  IIdev [1][0] [0][1] = 0.5 ;
-  IIdev [1][0] [1][0] = 0.5 ;
-  IIdev [1][1] [0][0] = -one3 ; //-0.333333 
-  IIdev [1][1] [1][1] =  two3 ; // 0.666667 
-  IIdev [1][1] [2][2] = -one3 ; //-0.333333 
-  IIdev [1][2] [1][2] = 0.5 ;
-  IIdev [1][2] [2][1] = 0.5 ;
-  IIdev [2][0] [0][2] = 0.5 ;
-  IIdev [2][0] [2][0] = 0.5 ;
-  IIdev [2][1] [1][2] = 0.5 ;
-  IIdev [2][1] [2][1] = 0.5 ;
-  IIdev [2][2] [0][0] = -one3 ; //-0.333333 
-  IIdev [2][2] [1][1] = -one3 ; //-0.333333 
-  IIdev [2][2] [2][2] =  two3 ; // 0.666667 
-
-  I.Zero();
-  I(0,0)=I(1,1)=I(2,2)=1.0;
-
   plastic_integrator();
 }
 
@@ -299,63 +249,6 @@ stress_nplus1(3,3)
 
   this->zero( ) ;
 
-  int i, j, k, l ;
-
-  //zero rank4 IIdev and IbunI 
-  for ( i = 0; i < 3; i++ ) {
-    for ( j = 0; j < 3; j++ )  {
-      for ( k = 0; k < 3; k++ ) {
-	for ( l = 0; l < 3; l++)  { 
-
-	  IbunI[i][j][k][l] = 0.0 ;
-
-	  IIdev[i][j][k][l] = 0.0 ;
-
-	} // end for l
-      } // end for k
-    } // end for j
-  } // end for i
-
-
-  //form rank4 IbunI 
-
-  IbunI [0][0] [0][0] = 1.0 ;
-  IbunI [0][0] [1][1] = 1.0 ;
-  IbunI [0][0] [2][2] = 1.0 ;
-  IbunI [1][1] [0][0] = 1.0 ;
-  IbunI [1][1] [1][1] = 1.0 ;
-  IbunI [1][1] [2][2] = 1.0 ;
-  IbunI [2][2] [0][0] = 1.0 ;
-  IbunI [2][2] [1][1] = 1.0 ;
-  IbunI [2][2] [2][2] = 1.0 ;
-
-  //form rank4 IIdev
-
-  IIdev [0][0] [0][0] =  two3 ; // 0.666667 
-  IIdev [0][0] [1][1] = -one3 ; //-0.333333 
-  IIdev [0][0] [2][2] = -one3 ; //-0.333333 
-  IIdev [0][1] [0][1] = 0.5 ;
-  IIdev [0][1] [1][0] = 0.5 ;
-  IIdev [0][2] [0][2] = 0.5 ;
-  IIdev [0][2] [2][0] = 0.5 ;
-  IIdev [1][0] [0][1] = 0.5 ;
-  IIdev [1][0] [1][0] = 0.5 ;
-  IIdev [1][1] [0][0] = -one3 ; //-0.333333 
-  IIdev [1][1] [1][1] =  two3 ; // 0.666667 
-  IIdev [1][1] [2][2] = -one3 ; //-0.333333 
-  IIdev [1][2] [1][2] = 0.5 ;
-  IIdev [1][2] [2][1] = 0.5 ;
-  IIdev [2][0] [0][2] = 0.5 ;
-  IIdev [2][0] [2][0] = 0.5 ;
-  IIdev [2][1] [1][2] = 0.5 ;
-  IIdev [2][1] [2][1] = 0.5 ;
-  IIdev [2][2] [0][0] = -one3 ; //-0.333333 
-  IIdev [2][2] [1][1] = -one3 ; //-0.333333 
-  IIdev [2][2] [2][2] =  two3 ; // 0.666667 
-
-  I.Zero();
-  I(0,0)=I(1,1)=I(2,2)=1.0;
-
     plastic_integrator();
 }
 
@@ -422,17 +315,17 @@ void CycLiqCPSP :: plastic_integrator( )
   const double tole = 1.0e-6*pcut ; //tolerance
   const double dt = ops_Dt ; //time step
 
-  static Matrix dev_strain(3,3) ; //deviatoric strain
+  thread_local Matrix dev_strain(3,3) ; //deviatoric strain
 
-  static Matrix dev_strain_n(3,3) ; //deviatoric strain of last step
+  thread_local Matrix dev_strain_n(3,3) ; //deviatoric strain of last step
 
-  static Matrix ddev_strain_p(3,3); //plastic deviatoric strain increment
+  thread_local Matrix ddev_strain_p(3,3); //plastic deviatoric strain increment
 
-  static Matrix dev_stress(3,3) ; //deviatoric stress
+  thread_local Matrix dev_stress(3,3) ; //deviatoric stress
 
-  static Matrix dev_stress_n(3,3) ; //deviatoric stress of last step
+  thread_local Matrix dev_stress_n(3,3) ; //deviatoric stress of last step
  
-  static Matrix normal(3,3) ;     //(dev_stress-alpha_n)/p_n/sqrt(2/3)/m
+  thread_local Matrix normal(3,3) ;     //(dev_stress-alpha_n)/p_n/sqrt(2/3)/m
 
   Matrix pass(3,3); //matrix to pass on values
 
@@ -1409,7 +1302,7 @@ CycLiqCPSP::sendSelf(int commitTag, Channel &theChannel)
   // we place all the data needed to define material and it's state
   // int a vector object
 	int res = 0;
-  static Vector data(23+9*3);
+  Vector data(23+9*3);
   int cnt = 0;
   data(cnt++) = this->getTag();
 
@@ -1464,7 +1357,7 @@ CycLiqCPSP::recvSelf (int commitTag, Channel &theChannel,
 {
 	int res = 0;
   // recv the vector object from the channel which defines material param and state
-  static Vector data(23+9*3);
+  Vector data(23+9*3);
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
     opserr << "CycLiqCPSP::recvSelf - failed to recv vector from channel\n";
@@ -38,9 +38,9 @@
 
 
 //static vectors and matrices
-Vector CycLiqCPSP3D :: strain_vec(6) ;
-Vector CycLiqCPSP3D :: stress_vec(6) ;
-Matrix CycLiqCPSP3D :: tangent_matrix(6,6) ;
+thread_local Vector CycLiqCPSP3D :: strain_vec(6) ;
+thread_local Vector CycLiqCPSP3D :: stress_vec(6) ;
+thread_local Matrix CycLiqCPSP3D :: tangent_matrix(6,6) ;
 
 //null constructor
 CycLiqCPSP3D :: CycLiqCPSP3D() :
@@ -130,7 +130,7 @@ int CycLiqCPSP3D :: setTrialStrain( const Vector &v, const Vector &r )
 
 int CycLiqCPSP3D :: setTrialStrainIncr( const Vector &v ) 
 {
-  static Vector newStrain(6);
+  thread_local Vector newStrain(6);
   newStrain(0) = strain_nplus1(0,0) + v(0);
   newStrain(1) = strain_nplus1(1,1) + v(1);
   newStrain(2) = strain_nplus1(2,2) + v(2);
@@ -258,7 +258,7 @@ CycLiqCPSP3D::sendSelf(int commitTag, Channel &theChannel)
   // we place all the data needed to define material and it's state
   // int a vector object
 	int res = 0;
-  static Vector data(22+9*3);
+  Vector data(22+9*3);
   int cnt = 0;
   data(cnt++) = this->getTag();
 
@@ -312,7 +312,7 @@ CycLiqCPSP3D::recvSelf (int commitTag, Channel &theChannel,
 {
 	int res = 0;
   // recv the vector object from the channel which defines material param and state
-  static Vector data(22+9*3);
+  Vector data(22+9*3);
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
     opserr << "CycLiqCPSP::recvSelf - failed to recv vector from channel\n";
@@ -1118,7 +1118,7 @@ int DruckerPragerThermal::sendSelf(int commitTag, Channel &theChannel)
 	int res = 0;
 
 	// place data in a vector
-	static Vector data(45);
+	Vector data(45);
 	data(0) = this->getTag();
 	data(1) = mKref;
 	data(2) = mGref;
@@ -1183,7 +1183,7 @@ int DruckerPragerThermal::recvSelf(int commitTag, Channel &theChannel, FEM_Objec
 	int res = 0;
 
 	// receive data
-	static Vector data(45);
+	Vector data(45);
 	res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
 		opserr << "WARNING: DruckerPragerThermal::recvSelf - failed to receive vector from channel" << endln;
@@ -29,8 +29,8 @@
 
 #include <ElasticCrossAnisotropic.h>
 
-Tensor ElasticCrossAnisotropic::Dt(4, def_dim_4, 0.0 );
-stresstensor ElasticCrossAnisotropic::Stress;
+thread_local Tensor ElasticCrossAnisotropic::Dt(4, def_dim_4, 0.0 );
+thread_local stresstensor ElasticCrossAnisotropic::Stress;
 
 
 ///////////////////////////////////////////////////////////////////////////////
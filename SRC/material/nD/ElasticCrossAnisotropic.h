@@ -83,8 +83,8 @@ public:
 protected:
 
 private:
-    static stresstensor Stress;   // Stress tensor
-    static Tensor Dt;         // Elastic constants tensor
+    static thread_local stresstensor Stress;   // Stress tensor
+    static thread_local Tensor Dt;         // Elastic constants tensor
     straintensor Strain;   // Strain tensor
 
 // all the directions are relative so we call them "horizontal" and "vertical", take that
@@ -274,7 +274,7 @@ ElasticIsotropicMaterialThermal::sendSelf(int commitTag, Channel &theChannel)
 {
 	int res = 0;
 
-	static Vector data(4);
+	Vector data(4);
 
 	data(0) = this->getTag();
 	data(1) = E;
@@ -296,7 +296,7 @@ ElasticIsotropicMaterialThermal::recvSelf(int commitTag, Channel &theChannel,
 {
 	int res = 0;
 
-	static Vector data(4);
+	Vector data(4);
 
 	res += theChannel.recvVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
@@ -270,7 +270,7 @@ ElasticOrthotropicMaterial::sendSelf (int commitTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(11);
+  Vector data(11);
   
   data(0) = this->getTag();
   data(1) = Ex;
@@ -299,7 +299,7 @@ ElasticOrthotropicMaterial::recvSelf (int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(11);
+  Vector data(11);
   
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -50,8 +50,8 @@
 #include <elementAPI.h>
 
 // Vector ElasticOrthotropicPlaneStress :: strain_vec(3) ;
-Vector ElasticOrthotropicPlaneStress :: stress_vec(3) ;
-Matrix ElasticOrthotropicPlaneStress :: tangent_matrix(3,3) ;
+thread_local Vector ElasticOrthotropicPlaneStress :: stress_vec(3) ;
+thread_local Matrix ElasticOrthotropicPlaneStress :: tangent_matrix(3,3) ;
 
 
 void* OPS_ADD_RUNTIME_VPV(OPS_ElasticOrthotropicPlaneStress)
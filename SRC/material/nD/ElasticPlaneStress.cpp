@@ -55,8 +55,8 @@
 #include <elementAPI.h>
 
 // Vector ElasticPlaneStress :: strain_vec(3) ;
-Vector ElasticPlaneStress :: stress_vec(3) ;
-Matrix ElasticPlaneStress :: tangent_matrix(3,3) ;
+thread_local Vector ElasticPlaneStress :: stress_vec(3) ;
+thread_local Matrix ElasticPlaneStress :: tangent_matrix(3,3) ;
 
 
 void* OPS_ElasticPlaneStress(void) 
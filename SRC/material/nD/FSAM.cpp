@@ -598,7 +598,7 @@ int FSAM::sendSelf(int commitTag, Channel &theChannel)
 	int dataTag = this->getDbTag();
 
 	// Packs its data into a Vector and sends this to theChannel
-	static Vector data(6);
+	Vector data(6);
 
 	data(0) = this->getTag();
 	data(1) = rho;
@@ -616,7 +616,7 @@ int FSAM::sendSelf(int commitTag, Channel &theChannel)
 	// Sends the IDs of its materials
 	int matDbTag;
 
-	static ID idData(16); // 2 x # of materials
+	ID idData(16); // 2 x # of materials
 
 	// NOTE: to ensure that the material has a database tag if sending to a database channel.
 
@@ -658,7 +658,7 @@ int FSAM::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBrok
 	int dataTag = this->getDbTag();
 
 	// Quad creates a Vector, receives the Vector and then sets the internal data with the data in the Vector
-	static Vector data(16);
+	Vector data(16);
 	res += theChannel.recvVector(dataTag, commitTag, data);
 	if (res < 0) {
 		opserr << "WARNING FSAM::recvSelf() - failed to receive Vector\n";
@@ -672,7 +672,7 @@ int FSAM::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBrok
 	nu		= data(4);
 	alfadow = data(5);
 
-	static ID idData(16); // idData(2 x # of uniaxial materials)
+	ID idData(16); // idData(2 x # of uniaxial materials)
 
 	// Receives the tags of its materials
 	res += theChannel.recvID(dataTag, commitTag, idData);
@@ -2691,7 +2691,7 @@ int FSAM::getResponse(int responseID, Information &matInfo)
 		return matInfo.setVector(this->getInputParameters());
 
 	} else if (responseID == 113) {
-		static Vector aux(3);
+		thread_local Vector aux(3);
 		aux.Zero();
 		if (crackA > 0) {
 			double v2 = cos(CCrackingAngles[0]);
@@ -156,7 +156,7 @@ InitStrainNDMaterial::~InitStrainNDMaterial()
 int
 InitStrainNDMaterial::setTrialStrain(const Vector& strain)
 {
-    static Vector total_strain(6);
+    thread_local Vector total_strain(6);
     total_strain = strain;
     total_strain.addVector(1.0, epsInit, 1.0);
     return theMaterial->setTrialStrain(total_strain);
@@ -171,7 +171,7 @@ InitStrainNDMaterial::setTrialStrain(const Vector& strain, const Vector& /*strai
 int
 InitStrainNDMaterial::setTrialStrainIncr(const Vector& strain)
 {
-    static Vector strain_from_ele(6);
+    thread_local Vector strain_from_ele(6);
     strain_from_ele = theMaterial->getStrain();
     strain_from_ele.addVector(1.0, epsInit, -1.0);
     strain_from_ele.addVector(1.0, strain, 1.0);
@@ -268,7 +268,7 @@ InitStrainNDMaterial::sendSelf(int cTag, Channel& theChannel)
 
     int dbTag = this->getDbTag();
 
-    static ID dataID(3);
+    ID dataID(3);
     dataID(0) = this->getTag();
     dataID(1) = theMaterial->getClassTag();
     int matDbTag = theMaterial->getDbTag();
@@ -301,7 +301,7 @@ InitStrainNDMaterial::recvSelf(int cTag, Channel& theChannel,
 {
     int dbTag = this->getDbTag();
 
-    static ID dataID(3);
+    ID dataID(3);
     if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
         opserr << "InitStrainNDMaterial::recvSelf() - failed to get the ID\n";
         return -1;
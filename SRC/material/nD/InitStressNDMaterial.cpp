@@ -288,7 +288,7 @@ InitStressNDMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -302,7 +302,7 @@ InitStressNDMaterial::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dataVec(1);
+  Vector dataVec(1);
   //dataVec(0) = epsInit;
 
   if (theChannel.sendVector(dbTag, cTag, dataVec) < 0) {
@@ -324,7 +324,7 @@ InitStressNDMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << "InitStressNDMaterial::recvSelf() - failed to get the ID\n";
     return -1;
@@ -343,7 +343,7 @@ InitStressNDMaterial::recvSelf(int cTag, Channel &theChannel,
   }
   theMaterial->setDbTag(dataID(2));
 
-  static Vector dataVec(1);
+  Vector dataVec(1);
   if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
     opserr << "InitStressNDMaterial::recvSelf() - failed to get the Vector\n";
     return -3;
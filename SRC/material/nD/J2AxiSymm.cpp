@@ -51,9 +51,9 @@
 #include <FEM_ObjectBroker.h>
 
 //static vectors and matrices
-Vector J2AxiSymm :: strain_vec(4) ;
-Vector J2AxiSymm :: stress_vec(4) ;
-Matrix J2AxiSymm :: tangent_matrix(4,4) ;
+thread_local Vector J2AxiSymm :: strain_vec(4) ;
+thread_local Vector J2AxiSymm :: stress_vec(4) ;
+thread_local Matrix J2AxiSymm :: tangent_matrix(4,4) ;
 
 
 //null constructor
@@ -269,7 +269,7 @@ J2AxiSymm::sendSelf (int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(10+9);
+  Vector data(10+9);
   int cnt = 0;
   data(cnt++) = this->getTag();
   data(cnt++) = bulk;
@@ -301,7 +301,7 @@ J2AxiSymm::recvSelf (int commitTag, Channel &theChannel,
 {
 
   // recv the vector object from the channel which defines material param and state
-  static Vector data(10+9);
+  Vector data(10+9);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "J2AxiSymm::recvSelf - failed to recv vector from channel\n";
     return -1;
@@ -61,7 +61,6 @@
 const double J2Plasticity :: four3  = 4.0 / 3.0 ;
 const double J2Plasticity :: root23 = sqrt( 2.0 / 3.0 ) ;
 
-double J2Plasticity::initialTangent[3][3][3][3] ;   //material tangent
 // double J2Plasticity::IIdev[3][3][3][3] ; //rank 4 deviatoric 
 // double J2Plasticity::IbunI[3][3][3][3] ; //rank 4 I bun I
 
@@ -280,11 +279,11 @@ void J2Plasticity :: plastic_integrator( )
 
   const double dt = ops_Dt ; //time step
 
-  static Matrix dev_strain(3,3) ; //deviatoric strain
+  thread_local Matrix dev_strain(3,3) ; //deviatoric strain
 
-  static Matrix dev_stress(3,3) ; //deviatoric stress
+  thread_local Matrix dev_stress(3,3) ; //deviatoric stress
  
-  static Matrix normal(3,3) ;     //normal to yield surface
+  thread_local Matrix normal(3,3) ;     //normal to yield surface
 
   double NbunN ; //normal bun normal 
   double norm_tau = 0.0 ;   //norm of deviatoric stress 
@@ -659,7 +658,7 @@ J2Plasticity::sendSelf(int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(10+9);
+  Vector data(10+9);
   int cnt = 0;
   data(cnt++) = this->getTag();
   data(cnt++) = bulk;
@@ -692,7 +691,7 @@ J2Plasticity::recvSelf (int commitTag, Channel &theChannel,
                          FEM_ObjectBroker &theBroker)
 {
   // recv the vector object from the channel which defines material param and state
-  static Vector data(10+9);
+  Vector data(10+9);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "J2Plasticity::recvSelf - failed to recv vector from channel\n";
     return -1;
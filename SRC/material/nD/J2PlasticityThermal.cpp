@@ -52,6 +52,7 @@
 #include <string.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <matrix/identity.h> // IbunI, IIdev
 
 //parameters
 const double J2PlasticityThermal :: one3   = 1.0 / 3.0 ;
@@ -59,9 +60,6 @@ const double J2PlasticityThermal :: two3   = 2.0 / 3.0 ;
 const double J2PlasticityThermal :: four3  = 4.0 / 3.0 ;
 const double J2PlasticityThermal :: root23 = sqrt( 2.0 / 3.0 ) ;
 
-double J2PlasticityThermal::initialTangent[3][3][3][3] ;   //material tangent
-double J2PlasticityThermal::IIdev[3][3][3][3] ; //rank 4 deviatoric 
-double J2PlasticityThermal::IbunI[3][3][3][3] ; //rank 4 I bun I 
 
 //zero internal variables
 void J2PlasticityThermal :: zero ( ) 
@@ -101,60 +99,6 @@ TempAndElong(2)
 
   this->zero( ) ;     // or (*this).zero( ) 
 
-  int i, j, k, l ;
-
-  //zero rank4 IIdev and IbunI 
-  for ( i = 0; i < 3; i++ ) {
-    for ( j = 0; j < 3; j++ )  {
-      for ( k = 0; k < 3; k++ ) {
-	for ( l = 0; l < 3; l++)  { 
-
-	  IbunI[i][j][k][l] = 0.0 ;
-
-	  IIdev[i][j][k][l] = 0.0 ;
-
-	} // end for l
-      } // end for k
-    } // end for j
-  } // end for i
-
-
-  //form rank4 IbunI 
-
-  IbunI [0][0] [0][0] = 1.0 ;
-  IbunI [0][0] [1][1] = 1.0 ;
-  IbunI [0][0] [2][2] = 1.0 ;
-  IbunI [1][1] [0][0] = 1.0 ;
-  IbunI [1][1] [1][1] = 1.0 ;
-  IbunI [1][1] [2][2] = 1.0 ;
-  IbunI [2][2] [0][0] = 1.0 ;
-  IbunI [2][2] [1][1] = 1.0 ;
-  IbunI [2][2] [2][2] = 1.0 ;
-
-  //form rank4 IIdev
-
-  IIdev [0][0] [0][0] =  two3 ; // 0.666667 
-  IIdev [0][0] [1][1] = -one3 ; //-0.333333 
-  IIdev [0][0] [2][2] = -one3 ; //-0.333333 
-  IIdev [0][1] [0][1] = 0.5 ;
-  IIdev [0][1] [1][0] = 0.5 ;
-  IIdev [0][2] [0][2] = 0.5 ;
-  IIdev [0][2] [2][0] = 0.5 ;
-  IIdev [1][0] [0][1] = 0.5 ;
-  IIdev [1][0] [1][0] = 0.5 ;
-  IIdev [1][1] [0][0] = -one3 ; //-0.333333 
-  IIdev [1][1] [1][1] =  two3 ; // 0.666667 
-  IIdev [1][1] [2][2] = -one3 ; //-0.333333 
-  IIdev [1][2] [1][2] = 0.5 ;
-  IIdev [1][2] [2][1] = 0.5 ;
-  IIdev [2][0] [0][2] = 0.5 ;
-  IIdev [2][0] [2][0] = 0.5 ;
-  IIdev [2][1] [1][2] = 0.5 ;
-  IIdev [2][1] [2][1] = 0.5 ;
-  IIdev [2][2] [0][0] = -one3 ; //-0.333333 
-  IIdev [2][2] [1][1] = -one3 ; //-0.333333 
-  IIdev [2][2] [2][2] =  two3 ; // 0.666667 
-
   ThermalElongation = 0.0;
   plastic_integrator();
 }
@@ -194,60 +138,6 @@ J2PlasticityThermal :: J2PlasticityThermal(int    tag,
 
   this->zero( ) ;
 
-  int i, j, k, l ;
-
-  //zero rank4 IIdev and IbunI 
-  for ( i = 0; i < 3; i++ ) {
-    for ( j = 0; j < 3; j++ )  {
-      for ( k = 0; k < 3; k++ ) {
-	for ( l = 0; l < 3; l++)  { 
-
-	  IbunI[i][j][k][l] = 0.0 ;
-
-	  IIdev[i][j][k][l] = 0.0 ;
-
-	} // end for l
-      } // end for k
-    } // end for j
-  } // end for i
-
-
-  //form rank4 IbunI 
-
-  IbunI [0][0] [0][0] = 1.0 ;
-  IbunI [0][0] [1][1] = 1.0 ;
-  IbunI [0][0] [2][2] = 1.0 ;
-  IbunI [1][1] [0][0] = 1.0 ;
-  IbunI [1][1] [1][1] = 1.0 ;
-  IbunI [1][1] [2][2] = 1.0 ;
-  IbunI [2][2] [0][0] = 1.0 ;
-  IbunI [2][2] [1][1] = 1.0 ;
-  IbunI [2][2] [2][2] = 1.0 ;
-
-  //form rank4 IIdev
-
-  IIdev [0][0] [0][0] =  two3 ; // 0.666667 
-  IIdev [0][0] [1][1] = -one3 ; //-0.333333 
-  IIdev [0][0] [2][2] = -one3 ; //-0.333333 
-  IIdev [0][1] [0][1] = 0.5 ;
-  IIdev [0][1] [1][0] = 0.5 ;
-  IIdev [0][2] [0][2] = 0.5 ;
-  IIdev [0][2] [2][0] = 0.5 ;
-  IIdev [1][0] [0][1] = 0.5 ;
-  IIdev [1][0] [1][0] = 0.5 ;
-  IIdev [1][1] [0][0] = -one3 ; //-0.333333 
-  IIdev [1][1] [1][1] =  two3 ; // 0.666667 
-  IIdev [1][1] [2][2] = -one3 ; //-0.333333 
-  IIdev [1][2] [1][2] = 0.5 ;
-  IIdev [1][2] [2][1] = 0.5 ;
-  IIdev [2][0] [0][2] = 0.5 ;
-  IIdev [2][0] [2][0] = 0.5 ;
-  IIdev [2][1] [1][2] = 0.5 ;
-  IIdev [2][1] [2][1] = 0.5 ;
-  IIdev [2][2] [0][0] = -one3 ; //-0.333333 
-  IIdev [2][2] [1][1] = -one3 ; //-0.333333 
-  IIdev [2][2] [2][2] =  two3 ; // 0.666667 
-
   ThermalElongation = 0;
   plastic_integrator();
 }
@@ -279,60 +169,6 @@ TempAndElong(2)
 
   this->zero( ) ;
 
-  int i, j, k, l ;
-
-  //zero rank4 IIdev and IbunI 
-  for ( i = 0; i < 3; i++ ) {
-    for ( j = 0; j < 3; j++ )  {
-      for ( k = 0; k < 3; k++ ) {
-	for ( l = 0; l < 3; l++)  { 
-
-	  IbunI[i][j][k][l] = 0.0 ;
-
-	  IIdev[i][j][k][l] = 0.0 ;
-
-	} // end for l
-      } // end for k
-    } // end for j
-  } // end for i
-
-
-  //form rank4 IbunI 
-
-  IbunI [0][0] [0][0] = 1.0 ;
-  IbunI [0][0] [1][1] = 1.0 ;
-  IbunI [0][0] [2][2] = 1.0 ;
-  IbunI [1][1] [0][0] = 1.0 ;
-  IbunI [1][1] [1][1] = 1.0 ;
-  IbunI [1][1] [2][2] = 1.0 ;
-  IbunI [2][2] [0][0] = 1.0 ;
-  IbunI [2][2] [1][1] = 1.0 ;
-  IbunI [2][2] [2][2] = 1.0 ;
-
-  //form rank4 IIdev
-
-  IIdev [0][0] [0][0] =  two3 ; // 0.666667 
-  IIdev [0][0] [1][1] = -one3 ; //-0.333333 
-  IIdev [0][0] [2][2] = -one3 ; //-0.333333 
-  IIdev [0][1] [0][1] = 0.5 ;
-  IIdev [0][1] [1][0] = 0.5 ;
-  IIdev [0][2] [0][2] = 0.5 ;
-  IIdev [0][2] [2][0] = 0.5 ;
-  IIdev [1][0] [0][1] = 0.5 ;
-  IIdev [1][0] [1][0] = 0.5 ;
-  IIdev [1][1] [0][0] = -one3 ; //-0.333333 
-  IIdev [1][1] [1][1] =  two3 ; // 0.666667 
-  IIdev [1][1] [2][2] = -one3 ; //-0.333333 
-  IIdev [1][2] [1][2] = 0.5 ;
-  IIdev [1][2] [2][1] = 0.5 ;
-  IIdev [2][0] [0][2] = 0.5 ;
-  IIdev [2][0] [2][0] = 0.5 ;
-  IIdev [2][1] [1][2] = 0.5 ;
-  IIdev [2][1] [2][1] = 0.5 ;
-  IIdev [2][2] [0][0] = -one3 ; //-0.333333 
-  IIdev [2][2] [1][1] = -one3 ; //-0.333333 
-  IIdev [2][2] [2][2] =  two3 ; // 0.666667 
-
   ThermalElongation = 0.0;
 }
 
@@ -403,11 +239,11 @@ void J2PlasticityThermal :: plastic_integrator( )
 
   const double dt = ops_Dt ; //time step
 
-  static Matrix dev_strain(3,3) ; //deviatoric strain
+  thread_local Matrix dev_strain(3,3) ; //deviatoric strain
 
-  static Matrix dev_stress(3,3) ; //deviatoric stress
+  thread_local Matrix dev_stress(3,3) ; //deviatoric stress
  
-  static Matrix normal(3,3) ;     //normal to yield surface
+  thread_local Matrix normal(3,3) ;     //normal to yield surface
 
   double NbunN ; //normal bun normal   
 
@@ -875,7 +711,7 @@ J2PlasticityThermal::sendSelf(int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(10+9);
+  Vector data(10+9);
   int cnt = 0;
   data(cnt++) = this->getTag();
   data(cnt++) = bulk;
@@ -908,7 +744,7 @@ J2PlasticityThermal::recvSelf (int commitTag, Channel &theChannel,
 			 FEM_ObjectBroker &theBroker)
 {
   // recv the vector object from the channel which defines material param and state
-  static Vector data(10+9);
+  Vector data(10+9);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "J2PlasticityThermal::recvSelf - failed to recv vector from channel\n";
     return -1;
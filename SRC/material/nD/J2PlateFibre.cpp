@@ -39,8 +39,8 @@
 #include <string.h>
 #include <stdlib.h>
 
-Vector J2PlateFibre::sigma(5);
-Matrix J2PlateFibre::D(5,5);
+thread_local Vector J2PlateFibre::sigma(5);
+thread_local Matrix J2PlateFibre::D(5,5);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_J2PlateFibreMaterial)
 {
@@ -206,8 +206,8 @@ J2PlateFibre::getTangent (void)
     // Solve for dg
     double dg = 0.0;
 
-    static Vector R(6);
-    static Vector x(6);
+    thread_local Vector R(6);
+    thread_local Vector x(6);
     x(0) = xsi[0]; R(0) = 0.0;
     x(1) = xsi[1]; R(1) = 0.0;
     x(2) = xsi[2]; R(2) = 0.0;
@@ -215,8 +215,8 @@ J2PlateFibre::getTangent (void)
     x(4) = xsi[4]; R(4) = 0.0;
     x(5) = dg;     R(5) = F;
 
-    static Matrix J(6,6);
-    static Vector dx(6);
+    thread_local Matrix J(6,6);
+    thread_local Vector dx(6);
 
     int iter = 0; int maxIter = 25;
     while (iter < maxIter && R.Norm() > 1.0e-14) {
@@ -297,7 +297,7 @@ J2PlateFibre::getTangent (void)
 
     J(5,5) = -q*two3Hkin/beta - two3*Hiso*q;
 
-    static Matrix invJ(6,6);
+    thread_local Matrix invJ(6,6);
     J.Invert(invJ);
 
     D(0,0) = invJ(0,0)*C00 + invJ(0,1)*C10;
@@ -393,8 +393,8 @@ J2PlateFibre::getStress (void)
     // Solve for dg
     double dg = 0.0;
 
-    static Vector R(6);
-    static Vector x(6);
+    thread_local Vector R(6);
+    thread_local Vector x(6);
     x(0) = xsi[0]; R(0) = 0.0;
     x(1) = xsi[1]; R(1) = 0.0;
     x(2) = xsi[2]; R(2) = 0.0;
@@ -402,8 +402,8 @@ J2PlateFibre::getStress (void)
     x(4) = xsi[4]; R(4) = 0.0;
     x(5) = dg;     R(5) = F;
 
-    static Matrix J(6,6);
-    static Vector dx(6);
+    thread_local Matrix J(6,6);
+    thread_local Vector dx(6);
 
     int iter = 0; int maxIter = 25;
     while (iter < maxIter && R.Norm() > 1.0e-14) {
@@ -667,9 +667,9 @@ J2PlateFibre::getStressSensitivity(int gradIndex, bool conditional)
     sigma(4) = dGdh*(Tepsilon(4)-epsPn1[4]) - G*depsPdh[4];
   }
   else {
-    static Matrix J(6,6);
-    static Vector b(6);
-    static Vector dx(6);
+    thread_local Matrix J(6,6);
+    thread_local Vector b(6);
+    thread_local Vector dx(6);
 
     double dg = dg_n1;
 
@@ -793,9 +793,9 @@ J2PlateFibre::commitSensitivity(const Vector &depsdh, int gradIndex, int numGrad
     // Do nothing
   }
   else {
-    static Matrix J(6,6);
-    static Vector b(6);
-    static Vector dx(6);
+    thread_local Matrix J(6,6);
+    thread_local Vector b(6);
+    thread_local Vector dx(6);
     
     double dg = dg_n1;
 
@@ -831,7 +831,7 @@ J2PlateFibre::sendSelf (int commitTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(6);
+  Vector data(6);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -855,7 +855,7 @@ J2PlateFibre::recvSelf (int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(6);
+  Vector data(6);
   
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -24,8 +24,8 @@ using std::ofstream;          // Quan Gu   2013 March   HK
 using std::ios;               // Quan Gu   2013 March   HK
 
 
-Vector LinearCap::tempVector(6);
-Matrix LinearCap::tempMatrix(6,6);
+thread_local Vector LinearCap::tempVector(6);
+thread_local Matrix LinearCap::tempMatrix(6,6);
 
 static int numLinearCap = 0;
 
@@ -248,7 +248,7 @@ const Vector & LinearCap::getStrain(void) {
     }
 
   else {
-    static Vector workV(3);   //, temp6(6);
+    thread_local Vector workV(3);   //, temp6(6);
     workV[0] = -1.0*strain[0];
     workV[1] = -1.0*strain[1];
     workV[2] = -1.0*strain[3];
@@ -652,7 +652,7 @@ const Vector & LinearCap::getStress(void) {
     }
 
   else {
-    static Vector workV(3);//, temp6(6);
+    thread_local Vector workV(3);//, temp6(6);
     workV[0] = -1.0*stress[0];
     workV[1] = -1.0*stress[1];
     workV[2] = -1.0*stress[3];
@@ -730,7 +730,7 @@ const Matrix & LinearCap::getTangent(void) {
   if (ndm==3) 
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -879,12 +879,12 @@ LinearCap::getStressSensitivity (int gradNumber, bool conditional) {
 
 
 // --- define history variables -----------
-    static Vector CStrainSensitivity(6);    CStrainSensitivity.Zero();
-    static Vector CStressSensitivity(6);       CStressSensitivity.Zero();
+    thread_local Vector CStrainSensitivity(6);    CStrainSensitivity.Zero();
+    thread_local Vector CStressSensitivity(6);       CStressSensitivity.Zero();
     Vector CPlastStrainSensitivity(6);      CPlastStrainSensitivity.Zero();
     Vector deltPlastStrainDev(6);
 
-    static Vector stressSensitivity(6);
+    thread_local Vector stressSensitivity(6);
     stressSensitivity.Zero(); 
 
     if (SHVs !=0) {
@@ -1094,7 +1094,7 @@ LinearCap::getStressSensitivity (int gradNumber, bool conditional) {
     }
 
   else {
-    static Vector workV(3);//, temp6(6);
+    thread_local Vector workV(3);//, temp6(6);
     workV[0] = -1.0*stressSensitivity[0];
     workV[1] = -1.0*stressSensitivity[1];
     workV[2] = -1.0*stressSensitivity[3];
@@ -1115,10 +1115,10 @@ LinearCap::commitSensitivity(const Vector & strainGradient, int gradNumber, int
     double alphaSensitivity = 0.0;
     double TSensitivity = 0.0;
 
-    static Vector stressSensitivity(6);
+    thread_local Vector stressSensitivity(6);
     stressSensitivity.Zero();
 
-    static Vector strainSensitivity(6);
+    thread_local Vector strainSensitivity(6);
 
     if (ndm==3 && strainGradient.Size()==6) 
          strainSensitivity = strainGradient;
@@ -1170,9 +1170,9 @@ LinearCap::commitSensitivity(const Vector & strainGradient, int gradNumber, int
     }
 
 // --- define history variables -----------
-    static Vector CStrainSensitivity(6);        CStrainSensitivity.Zero();
-    static Vector CStressSensitivity(6);           CStressSensitivity.Zero();
-    static Vector CPlastStrainSensitivity(6);   CPlastStrainSensitivity.Zero();
+    thread_local Vector CStrainSensitivity(6);        CStrainSensitivity.Zero();
+    thread_local Vector CStressSensitivity(6);           CStressSensitivity.Zero();
+    thread_local Vector CPlastStrainSensitivity(6);   CPlastStrainSensitivity.Zero();
 
     if (SHVs ==0) {
 
@@ -186,7 +186,7 @@ MinMaxNDMaterial::setTrialStrainIncr(const Vector& strain)
   }
   else {
     Tfailed = false;
-    static Vector strain_from_ele(6);
+    thread_local Vector strain_from_ele(6);
     strain_from_ele = theMaterial->getStrain();
     strain_from_ele.addVector(1.0, strain, 1.0);
     return setTrialStrain(strain_from_ele);
@@ -203,7 +203,7 @@ const Vector&
 MinMaxNDMaterial::getStress()
 {
   if (Tfailed) {
-    static Vector zeroStress(6);
+    thread_local Vector zeroStress(6);
     return zeroStress;
   }
   else
@@ -214,7 +214,7 @@ const Matrix&
 MinMaxNDMaterial::getTangent()
 {
   if (Tfailed) {
-    static Matrix zeroTangent(6,6);
+    thread_local Matrix zeroTangent(6,6);
     zeroTangent = theMaterial->getInitialTangent();
     zeroTangent *= 1e-8;
     return zeroTangent;
@@ -333,7 +333,7 @@ MinMaxNDMaterial::sendSelf(int cTag, Channel& theChannel)
 
   int dbTag = this->getDbTag();
   
-  static ID dataID(3);
+  ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -347,7 +347,7 @@ MinMaxNDMaterial::sendSelf(int cTag, Channel& theChannel)
     return -1;
   }
 
-  static Vector dataVec(3);
+  Vector dataVec(3);
   dataVec(0) = minStrain;
   dataVec(1) = maxStrain;
   if (Cfailed == true)
@@ -374,7 +374,7 @@ MinMaxNDMaterial::recvSelf(int cTag, Channel& theChannel,
 {
   int dbTag = this->getDbTag();
   
-  static ID dataID(3);
+  ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << "MinMaxNDMaterial::recvSelf() - failed to get the ID\n";
     return -1;
@@ -393,7 +393,7 @@ MinMaxNDMaterial::recvSelf(int cTag, Channel& theChannel,
   }
   theMaterial->setDbTag(dataID(2));
 
-  static Vector dataVec(3);
+  Vector dataVec(3);
   if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
     opserr << "MinMaxNDMaterial::recvSelf() - failed to get the Vector\n";
     return -3;
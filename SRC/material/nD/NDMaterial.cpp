@@ -47,8 +47,8 @@
 #include <string.h>
 #include <api/runtimeAPI.h>
 
-Matrix NDMaterial::errMatrix(1,1);
-Vector NDMaterial::errVector(1);
+const Matrix NDMaterial::errMatrix(1,1);
+const Vector NDMaterial::errVector(1);
 
 
 NDMaterial::NDMaterial(int tag, int classTag)
@@ -167,6 +167,28 @@ NDMaterial::getStrain(void)
 }
 #endif
 
+int
+NDMaterial::setTrialStrains(int count, NDMaterial *const *materials, int order,
+                            const double *strains, double *stresses, double *tangents)
+{
+  int res = 0;
+  for (int m = 0; m < count; m++) {
+    Vector strain(const_cast<double *>(strains) + m*order, order);
+    res += materials[m]->setTrialStrain(strain);
+
+    const Vector &stress = materials[m]->getStress();
+    const Matrix &tangent = materials[m]->getTangent();
+    double *sm = stresses + m*order;
+    double *tm = tangents + m*order*order;
+    for (int i = 0; i < order; i++) {
+      sm[i] = stress(i);
+      for (int j = 0; j < order; j++)
+        tm[i*order + j] = tangent(i,j);
+    }
+  }
+  return res;
+}
+
 //Functions for obtaining and updating temperature-dependent information Added by L.Jiang [SIF]
 double
 NDMaterial::getThermalTangentAndElongation(double &TempT, double &ET, double &Elong)
@@ -300,14 +322,14 @@ NDMaterial::getResponse (int responseID, Information &matInfo)
 const Vector &
 NDMaterial::getStressSensitivity(int gradIndex, bool conditional)
 {
-	static Vector dummy(1);
+	thread_local Vector dummy(1);
 	return dummy;
 }
 
 const Vector &
 NDMaterial::getStrainSensitivity(int gradIndex)
 {
-	static Vector dummy(1);
+	thread_local Vector dummy(1);
 	return dummy;
 }
 
@@ -320,21 +342,21 @@ NDMaterial::getRhoSensitivity(int gradIndex)
 const Matrix &
 NDMaterial::getDampTangentSensitivity(int gradIndex)
 {
-	static Matrix dummy(1,1);
+	thread_local Matrix dummy(1,1);
 	return dummy;
 }
 
 const Matrix &
 NDMaterial::getTangentSensitivity(int gradIndex)
 {
-	static Matrix dummy(1,1);
+	thread_local Matrix dummy(1,1);
 	return dummy;
 }
 
 const Matrix &
 NDMaterial::getInitialTangentSensitivity(int gradIndex)
 {
-	static Matrix dummy(1,1);
+	thread_local Matrix dummy(1,1);
 	return dummy;
 }
 
@@ -76,6 +76,12 @@ class NDMaterial : // public Material
     virtual const Vector &getStress(void);
     virtual const Vector &getStrain(void);
 
+    // Batched state determination of count materials of the same class as
+    // this one, with strains, stresses and row-major tangents packed by
+    // material in vectors of size order
+    virtual int setTrialStrains(int count, NDMaterial *const *materials, int order,
+                                const double *strains, double *stresses, double *tangents);
+
     virtual int commitState(void) = 0;
     virtual int revertToLastCommit(void) = 0;
     virtual int revertToStart(void) = 0;
@@ -102,8 +108,8 @@ class NDMaterial : // public Material
   protected:
 
   private:
-    static Matrix errMatrix;
-    static Vector errVector;
+    static const Matrix errMatrix;
+    static const Vector errVector;
 };
 
 // extern bool OPS_addNDMaterial(NDMaterial *newComponent);
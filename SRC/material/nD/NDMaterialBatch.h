@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Packed state of the layers of a section for batched state determination.
+// The layers are grouped by class, each group is evaluated through one call
+// to NDMaterial::setTrialStrains, and the strains, stresses and tangents of
+// all layers are kept in arrays that are allocated once.
+//
+#ifndef NDMaterialBatch_h
+#define NDMaterialBatch_h
+
+#include <vector>
+#include <typeindex>
+#include <typeinfo>
+#include <algorithm>
+#include <NDMaterial.h>
+#include <Vector.h>
+#include <Matrix.h>
+
+class NDMaterialBatch {
+public:
+  NDMaterialBatch() : order(0) {}
+
+  // Group the layers, which stay owned by the caller
+  void
+  setLayers(int numLayers, NDMaterial *const *layers, int strainOrder)
+  {
+    order = strainOrder;
+
+    std::vector<int> sorted(numLayers);
+    for (int i = 0; i < numLayers; i++)
+      sorted[i] = i;
+    std::stable_sort(sorted.begin(), sorted.end(), [layers](int a, int b) {
+      return std::type_index(typeid(*layers[a])) < std::type_index(typeid(*layers[b]));
+    });
+
+    materials.resize(numLayers);
+    position.resize(numLayers);
+    groups.clear();
+    for (int k = 0; k < numLayers; k++) {
+      materials[k] = layers[sorted[k]];
+      position[sorted[k]] = k;
+      if (k == 0 || typeid(*materials[k]) != typeid(*materials[k-1]))
+        groups.push_back(k);
+    }
+    groups.push_back(numLayers);
+
+    strains.assign(numLayers*order, 0.0);
+    stresses.assign(numLayers*order, 0.0);
+    tangents.assign(numLayers*order*order, 0.0);
+  }
+
+  // Trial strain of layer i, to be filled in before setTrialStrains
+  double *
+  strain(int i)
+  {
+    return &strains[position[i]*order];
+  }
+
+  // Stress and row-major tangent of layer i
+  const double *
+  stress(int i) const
+  {
+    return &stresses[position[i]*order];
+  }
+
+  const double *
+  tangent(int i) const
+  {
+    return &tangents[position[i]*order*order];
+  }
+
+  // Set the trial strains of all layers, one call per group
+  int
+  setTrialStrains()
+  {
+    int res = 0;
+    for (std::size_t g = 0; g + 1 < groups.size(); g++) {
+      const int k = groups[g];
+      res += materials[k]->setTrialStrains(groups[g+1] - k, &materials[k], order,
+                                           &strains[k*order], &stresses[k*order],
+                                           &tangents[k*order*order]);
+    }
+    return res;
+  }
+
+  // Read the stresses and tangents back after the layers changed state
+  // other than through setTrialStrains
+  void
+  update()
+  {
+    for (std::size_t k = 0; k < materials.size(); k++) {
+      const Vector &s = materials[k]->getStress();
+      const Matrix &t = materials[k]->getTangent();
+      for (int i = 0; i < order; i++) {
+        stresses[k*order + i] = s(i);
+        for (int j = 0; j < order; j++)
+          tangents[(k*order + i)*order + j] = t(i,j);
+      }
+    }
+  }
+
+private:
+  int order;
+  std::vector<NDMaterial *> materials;   // layers grouped by class
+  std::vector<int> position;             // slot of each layer in materials
+  std::vector<int> groups;               // first slot of each group, and the end
+  std::vector<double> strains;
+  std::vector<double> stresses;
+  std::vector<double> tangents;
+};
+
+#endif
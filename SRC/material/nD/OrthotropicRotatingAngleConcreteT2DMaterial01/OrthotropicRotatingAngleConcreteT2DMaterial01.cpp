@@ -309,7 +309,7 @@ int OrthotropicRotatingAngleConcreteT2DMaterial01::sendSelf(int commitTag, Chann
 
 	int dataTag = this->getDbTag();
 
-	static Vector data(6);
+	Vector data(6);
 
 	data(0) = this->getTag();
 	data(1) = ecr;
@@ -326,7 +326,7 @@ int OrthotropicRotatingAngleConcreteT2DMaterial01::sendSelf(int commitTag, Chann
 
 	int matDbTag;
 
-	static ID idData(4);
+	ID idData(4);
 	int i;
 	for (i = 0; i < 2; i++) {
 		idData(i) = theMaterial[i]->getClassTag();
@@ -362,7 +362,7 @@ int OrthotropicRotatingAngleConcreteT2DMaterial01::recvSelf(int commitTag, Chann
 
 	int dataTag = this->getDbTag();
 
-	static Vector data(6);
+	Vector data(6);
 	res += theChannel.recvVector(dataTag, commitTag, data);
 	if (res < 0) {
 		opserr << "WARNING OrthotropicRotatingAngleConcreteT2DMaterial01::recvSelf() - failed to receive Vector\n";
@@ -376,7 +376,7 @@ int OrthotropicRotatingAngleConcreteT2DMaterial01::recvSelf(int commitTag, Chann
 	damageConstant1 = data(4);
 	damageConstant2 = data(5);
 
-	static ID idData(4);
+	ID idData(4);
 
 	res += theChannel.recvID(dataTag, commitTag, idData);
 	if (res < 0) {
@@ -27,15 +27,32 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
-
-// static vector and matrices
-Vector  PlateFiberMaterial::stress(5);
-Matrix  PlateFiberMaterial::tangent(5,5);
+#include <VectorND.h>
 
 //      0  1  2  3  4  5
 // ND: 11 22 33 12 23 31
 // PF: 11 22 12 23 31 33
 
+// ND components of the PF components 11 22 12 23 31
+static constexpr int ndIndex[5] = {0, 1, 3, 4, 5};
+
+// ND component of the condensed 33 strain
+static constexpr int condensed[1] = {2};
+
+// statically condense the 33 component out of a three dimensional tangent,
+// into a Matrix or anything else indexed by (i,j)
+template <typename Tangent>
+static void
+condenseTangent(const Matrix &threeDtangent, Tangent &&tangent)
+{
+  double dd22inv = 1.0/threeDtangent(2,2);
+
+  for (int i = 0; i < 5; i++)
+    for (int j = 0; j < 5; j++)
+      tangent(i,j) = threeDtangent(ndIndex[i],ndIndex[j])
+                   - threeDtangent(ndIndex[i],2)*(threeDtangent(2,ndIndex[j])*dd22inv);
+}
+
 NDMaterial *G3_GetNDMaterial(G3_Runtime* rt, int matTag);
 void * OPS_ADD_RUNTIME_VPV(OPS_PlateFiberMaterial)
 {
@@ -76,7 +93,7 @@ void * OPS_ADD_RUNTIME_VPV(OPS_PlateFiberMaterial)
 PlateFiberMaterial::PlateFiberMaterial() : 
 NDMaterial(0, ND_TAG_PlateFiberMaterial), 
 theMaterial(0),
-strain(5) 
+strain(5), Cstrain(5), stress(5), tangent(5,5)
 { 
     Tstrain22 = 0.0;
     Cstrain22 = 0.0;
@@ -88,7 +105,7 @@ PlateFiberMaterial::PlateFiberMaterial(
 				   int tag, 
                                    NDMaterial &the3DMaterial) :
 NDMaterial(tag, ND_TAG_PlateFiberMaterial),
-strain(5)
+strain(5), Cstrain(5), stress(5), tangent(5,5)
 {
   theMaterial = the3DMaterial.getCopy("ThreeDimensional");
 
@@ -117,6 +134,9 @@ PlateFiberMaterial::getCopy()
 
   clone->Tstrain22 = this->Tstrain22;
   clone->Cstrain22 = this->Cstrain22;
+  clone->strain    = this->strain;
+  clone->Cstrain   = this->Cstrain;
+  clone->predictor = this->predictor;
 
   return clone;
 }
@@ -151,6 +171,8 @@ int
 PlateFiberMaterial::commitState() 
 {
   Cstrain22 = Tstrain22;
+  Cstrain   = strain;
+  predictor.commit();
 
   return theMaterial->commitState();
 }
@@ -162,6 +184,8 @@ int
 PlateFiberMaterial::revertToLastCommit()
 {
   Tstrain22 = Cstrain22;
+  strain    = Cstrain;
+  predictor.revert();
 
   return theMaterial->revertToLastCommit();
 }
@@ -173,6 +197,9 @@ PlateFiberMaterial::revertToStart()
 {
   this->Tstrain22 = 0.0;
   this->Cstrain22 = 0.0;
+  this->strain.Zero();
+  this->Cstrain.Zero();
+  predictor.zero();
 
   return theMaterial->revertToStart();
 }
@@ -192,35 +219,37 @@ PlateFiberMaterial::setTrialStrain(const Vector &strainFromElement)
 {
   static const double tolerance = 1.0e-08;
 
-  strain(0) = strainFromElement(0); //11
-  strain(1) = strainFromElement(1); //22
-  strain(2) = strainFromElement(2); //12
-  strain(3) = strainFromElement(3); //23
-  strain(4) = strainFromElement(4); //31
+  //predict the out of plane strain from the in plane strain increment
+  double dstrain[5], dstrain22[1];
+  for (int i = 0; i < 5; i++) {
+    dstrain[i] = strainFromElement(i) - strain(i);
+    strain(i) = strainFromElement(i);
+  }
+  predictor.predict(dstrain, dstrain22);
+  Tstrain22 += dstrain22[0];
 
   double norm;
   double condensedStress;
   double strainIncrement;
-  static Vector threeDstrain(6);
+  OpenSees::VectorND<6> threeDstrain;
   double dd22;
 
   int count = 0;
   const int maxCount = 20;
-  double norm0;
 
   //newton loop to solve for out-of-plane strains
   do {
 
     //set three dimensional strain
-    threeDstrain(0) = this->strain(0);
-    threeDstrain(1) = this->strain(1);
-    threeDstrain(2) = this->Tstrain22;
-    threeDstrain(3) = this->strain(2); 
-    threeDstrain(4) = this->strain(3);
-    threeDstrain(5) = this->strain(4);
+    threeDstrain[0] = this->strain(0);
+    threeDstrain[1] = this->strain(1);
+    threeDstrain[2] = this->Tstrain22;
+    threeDstrain[3] = this->strain(2); 
+    threeDstrain[4] = this->strain(3);
+    threeDstrain[5] = this->strain(4);
 
     if (theMaterial->setTrialStrain(threeDstrain) < 0) {
-      opserr << "PlateFiberMaterial::setTrialStrain - material failed in setTrialStrain() with strain " << threeDstrain;
+      opserr << "PlateFiberMaterial::setTrialStrain - material failed in setTrialStrain() with strain " << Vector(&threeDstrain[0], 6);
       return -1;
     }
 
@@ -239,8 +268,12 @@ PlateFiberMaterial::setTrialStrain(const Vector &strainFromElement)
 
     //set norm
     norm = fabs(condensedStress);
-    if (count == 0)
-      norm0 = norm;
+
+    //the material is left in the state of the accepted strain
+    if (norm <= tolerance) {
+      predictor.update(threeDtangent, condensed, ndIndex);
+      break;
+    }
 
     //condensation 
     strainIncrement = condensedStress/dd22;
@@ -248,7 +281,7 @@ PlateFiberMaterial::setTrialStrain(const Vector &strainFromElement)
     //update out of plane strains
     Tstrain22 -= strainIncrement;
 
-  } while (count++ < maxCount && norm > tolerance);
+  } while (count++ < maxCount);
 
   return 0;
 }
@@ -291,12 +324,12 @@ PlateFiberMaterial::getStressSensitivity(int gradIndex,
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Vector dd12(5);
-  dd12(0) = threeDtangent(0,2);
-  dd12(1) = threeDtangent(1,2);
-  dd12(2) = threeDtangent(3,2);
-  dd12(3) = threeDtangent(4,2);
-  dd12(4) = threeDtangent(5,2);
+  OpenSees::VectorND<5> dd12;
+  dd12[0] = threeDtangent(0,2);
+  dd12[1] = threeDtangent(1,2);
+  dd12[2] = threeDtangent(3,2);
+  dd12[3] = threeDtangent(4,2);
+  dd12[4] = threeDtangent(5,2);
 
   double dd22 = threeDtangent(2,2);
 
@@ -315,66 +348,41 @@ PlateFiberMaterial::getTangent()
 {
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd11(5,5);
-  dd11(0,0) = threeDtangent(0,0);
-  dd11(1,0) = threeDtangent(1,0);
-  dd11(2,0) = threeDtangent(3,0);
-  dd11(3,0) = threeDtangent(4,0);
-  dd11(4,0) = threeDtangent(5,0);
-
-  dd11(0,1) = threeDtangent(0,1);
-  dd11(1,1) = threeDtangent(1,1);
-  dd11(2,1) = threeDtangent(3,1);
-  dd11(3,1) = threeDtangent(4,1);
-  dd11(4,1) = threeDtangent(5,1);
-
-  dd11(0,2) = threeDtangent(0,3);
-  dd11(1,2) = threeDtangent(1,3);
-  dd11(2,2) = threeDtangent(3,3);
-  dd11(3,2) = threeDtangent(4,3);
-  dd11(4,2) = threeDtangent(5,3);
-
-  dd11(0,3) = threeDtangent(0,4);
-  dd11(1,3) = threeDtangent(1,4);
-  dd11(2,3) = threeDtangent(3,4);
-  dd11(3,3) = threeDtangent(4,4);
-  dd11(4,3) = threeDtangent(5,4);
-
-  dd11(0,4) = threeDtangent(0,5);
-  dd11(1,4) = threeDtangent(1,5);
-  dd11(2,4) = threeDtangent(3,5);
-  dd11(3,4) = threeDtangent(4,5);
-  dd11(4,4) = threeDtangent(5,5);
-
-  static Matrix dd12(5,1);
-  dd12(0,0) = threeDtangent(0,2);
-  dd12(1,0) = threeDtangent(1,2);
-  dd12(2,0) = threeDtangent(3,2);
-  dd12(3,0) = threeDtangent(4,2);
-  dd12(4,0) = threeDtangent(5,2);
-
-  static Matrix dd21(1,5);
-  dd21(0,0) = threeDtangent(2,0);
-  dd21(0,1) = threeDtangent(2,1);
-  dd21(0,2) = threeDtangent(2,3);
-  dd21(0,3) = threeDtangent(2,4);
-  dd21(0,4) = threeDtangent(2,5);
+  //condensation 
+  //tangent = dd11 - dd12*dd21/dd22
+  condenseTangent(threeDtangent, tangent);
 
-  double dd22 = threeDtangent(2,2);
+  return tangent;
+}
 
-  //int Solve(const Vector &V, Vector &res) const;
-  //int Solve(const Matrix &M, Matrix &res) const;
-  //condensation 
-  static Matrix dd22invdd21(1,5);
-  //dd22.Solve(dd21, dd22invdd21);
-  dd22invdd21.addMatrix(0.0, dd21, 1.0/dd22);
 
-  //this->tangent   = dd11; 
-  //this->tangent  -= (dd12*dd22invdd21);
-  dd11.addMatrixProduct(1.0, dd12, dd22invdd21, -1.0);
-  tangent = dd11;
+int
+PlateFiberMaterial::setTrialStrains(int count, NDMaterial *const *materials, int order,
+                                    const double *strains, double *stresses, double *tangents)
+{
+  if (order != 5)
+    return NDMaterial::setTrialStrains(count, materials, order, strains, stresses, tangents);
 
-  return tangent;
+  // the fibers are all PlateFiberMaterials, so call setTrialStrain
+  // directly and condense straight into the packed arrays; the wrapped
+  // 3D materials are still called through their virtual interface
+  int res = 0;
+  for (int m = 0; m < count; m++) {
+    PlateFiberMaterial *fiber = static_cast<PlateFiberMaterial *>(materials[m]);
+
+    Vector strain(const_cast<double *>(strains) + 5*m, 5);
+    res += fiber->PlateFiberMaterial::setTrialStrain(strain);
+
+    const Vector &threeDstress = fiber->theMaterial->getStress();
+    double *sm = stresses + 5*m;
+    for (int i = 0; i < 5; i++)
+      sm[i] = threeDstress(ndIndex[i]);
+
+    double *tm = tangents + 25*m;
+    condenseTangent(fiber->theMaterial->getTangent(),
+                    [tm](int i, int j) -> double & { return tm[5*i + j]; });
+  }
+  return res;
 }
 
 
@@ -383,64 +391,9 @@ PlateFiberMaterial::getInitialTangent()
 {
   const Matrix &threeDtangent = theMaterial->getInitialTangent();
 
-  static Matrix dd11(5,5);
-  dd11(0,0) = threeDtangent(0,0);
-  dd11(1,0) = threeDtangent(1,0);
-  dd11(2,0) = threeDtangent(3,0);
-  dd11(3,0) = threeDtangent(4,0);
-  dd11(4,0) = threeDtangent(5,0);
-
-  dd11(0,1) = threeDtangent(0,1);
-  dd11(1,1) = threeDtangent(1,1);
-  dd11(2,1) = threeDtangent(3,1);
-  dd11(3,1) = threeDtangent(4,1);
-  dd11(4,1) = threeDtangent(5,1);
-
-  dd11(0,2) = threeDtangent(0,3);
-  dd11(1,2) = threeDtangent(1,3);
-  dd11(2,2) = threeDtangent(3,3);
-  dd11(3,2) = threeDtangent(4,3);
-  dd11(4,2) = threeDtangent(5,3);
-
-  dd11(0,3) = threeDtangent(0,4);
-  dd11(1,3) = threeDtangent(1,4);
-  dd11(2,3) = threeDtangent(3,4);
-  dd11(3,3) = threeDtangent(4,4);
-  dd11(4,3) = threeDtangent(5,4);
-
-  dd11(0,4) = threeDtangent(0,5);
-  dd11(1,4) = threeDtangent(1,5);
-  dd11(2,4) = threeDtangent(3,5);
-  dd11(3,4) = threeDtangent(4,5);
-  dd11(4,4) = threeDtangent(5,5);
-
-  static Matrix dd12(5,1);
-  dd12(0,0) = threeDtangent(0,2);
-  dd12(1,0) = threeDtangent(1,2);
-  dd12(2,0) = threeDtangent(3,2);
-  dd12(3,0) = threeDtangent(4,2);
-  dd12(4,0) = threeDtangent(5,2);
-
-  static Matrix dd21(1,5);
-  dd21(0,0) = threeDtangent(2,0);
-  dd21(0,1) = threeDtangent(2,1);
-  dd21(0,2) = threeDtangent(2,3);
-  dd21(0,3) = threeDtangent(2,4);
-  dd21(0,4) = threeDtangent(2,5);
-
-  double dd22 = threeDtangent(2,2);
-
-  //int Solve(const Vector &V, Vector &res) const;
-  //int Solve(const Matrix &M, Matrix &res) const;
   //condensation 
-  static Matrix dd22invdd21(1,5);
-  //dd22.Solve(dd21, dd22invdd21);
-  dd22invdd21.addMatrix(0.0, dd21, 1.0/dd22);
-
-  //this->tangent   = dd11; 
-  //this->tangent  -= (dd12*dd22invdd21);
-  dd11.addMatrixProduct(1.0, dd12, dd22invdd21, -1.0);
-  tangent = dd11;
+  //tangent = dd11 - dd12*dd21/dd22
+  condenseTangent(threeDtangent, tangent);
 
   return tangent;
 }
@@ -473,7 +426,7 @@ PlateFiberMaterial::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and associated materials class and database tags into an id and send it
-  static ID idData(3);
+  ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -490,7 +443,7 @@ PlateFiberMaterial::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(1);
+  Vector vecData(1);
   vecData(0) = Cstrain22;
 
   res = theChannel.sendVector(this->getDbTag(), commitTag, vecData);
@@ -513,7 +466,7 @@ PlateFiberMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroke
   int res = 0;
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  ID idData(3);
   res = theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "PlateFiberMaterial::sendSelf() - failed to send id data\n";
@@ -537,7 +490,7 @@ PlateFiberMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroke
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(1);
+  Vector vecData(1);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     opserr << "PlateFiberMaterial::sendSelf() - failed to send vector data\n";
@@ -547,6 +500,9 @@ PlateFiberMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroke
   Cstrain22 = vecData(0);
   Tstrain22 = Cstrain22;
 
+  //the in plane strains are not sent, so the prediction starts over
+  predictor.zero();
+
   // now receive the associated materials data
   res = theMaterial->recvSelf(commitTag, theChannel, theBroker);
   if (res < 0) 
@@ -38,6 +38,7 @@
 #include <Matrix.h>
 #include <ID.h> 
 #include <NDMaterial.h>
+#include <CondensedStrainPredictor.h>
 
 class PlateFiberMaterial: public NDMaterial{
 
@@ -90,6 +91,10 @@ class PlateFiberMaterial: public NDMaterial{
     const Matrix& getTangent( ) ;
     const Matrix &getInitialTangent(void);
 
+    //batched state determination of plate fibers
+    int setTrialStrains(int count, NDMaterial *const *materials, int order,
+                        const double *strains, double *stresses, double *tangents);
+
     //density
     double getRho( ) ;
 
@@ -111,13 +116,17 @@ class PlateFiberMaterial: public NDMaterial{
     double Tstrain22 ;
     double Cstrain22 ;
 
+    //predictor of the out of plane strain from the in plane strains
+    CondensedStrainPredictor<1,5> predictor ;
+
     NDMaterial *theMaterial ;  //pointer to three dimensional material
 
     Vector strain ;
+    Vector Cstrain ;  //committed in plane strains
 
-    static Vector stress ;
+    Vector stress ;
 
-    static Matrix tangent ;
+    Matrix tangent ;
 } ; //end of PlateFiberMaterial declarations
 
 
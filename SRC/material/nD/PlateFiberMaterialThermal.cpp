@@ -30,8 +30,8 @@
 #include <Logging.h>
 
 //static vector and matrices
-Vector  PlateFiberMaterialThermal::stress(5);
-Matrix  PlateFiberMaterialThermal::tangent(5,5);
+thread_local Vector  PlateFiberMaterialThermal::stress(5);
+thread_local Matrix  PlateFiberMaterialThermal::tangent(5,5);
 
 //null constructor
 PlateFiberMaterialThermal::PlateFiberMaterialThermal() : 
@@ -170,15 +170,15 @@ PlateFiberMaterialThermal::setTrialStrain(const Vector &strainFromElement)
   strain23 = this->strain(3);
   strain31 = this->strain(4);
   double norm;
-  static Vector outOfPlaneStress(1);
-  static Vector strainIncrement(1);
-  static Vector threeDstress(6);
-  static Vector threeDstrain(6);
-  static Matrix threeDtangent(6,6);
-  static Vector threeDstressCopy(6); 
+  thread_local Vector outOfPlaneStress(1);
+  thread_local Vector strainIncrement(1);
+  thread_local Vector threeDstress(6);
+  thread_local Vector threeDstrain(6);
+  thread_local Matrix threeDtangent(6,6);
+  thread_local Vector threeDstressCopy(6); 
 
-  static Matrix threeDtangentCopy(6,6);
-  static Matrix dd22(1,1);
+  thread_local Matrix threeDtangentCopy(6,6);
+  thread_local Matrix dd22(1,1);
 
   int i, j;
   int ii, jj;
@@ -297,7 +297,7 @@ const Vector&
 PlateFiberMaterialThermal::getStress()
 {
   const Vector &threeDstress = theMaterial->getStress();
-  static Vector threeDstressCopy(6);
+  thread_local Vector threeDstressCopy(6);
 
   //swap matrix indices to sort out-of-plane components 
   int i, ii;
@@ -319,13 +319,13 @@ PlateFiberMaterialThermal::getStress()
 const Matrix&  
 PlateFiberMaterialThermal::getTangent()
 {
-  static Matrix dd11(5,5);
-  static Matrix dd12(5,1);
-  static Matrix dd21(1,5);
-  static Matrix dd22(1,1);
-  static Matrix dd22invdd21(1,5);
+  thread_local Matrix dd11(5,5);
+  thread_local Matrix dd12(5,1);
+  thread_local Matrix dd21(1,5);
+  thread_local Matrix dd22(1,1);
+  thread_local Matrix dd22invdd21(1,5);
 
-  static Matrix threeDtangentCopy(6,6);
+  thread_local Matrix threeDtangentCopy(6,6);
   const Matrix &threeDtangent = theMaterial->getTangent();
 
   //swap matrix indices to sort out-of-plane components 
@@ -378,7 +378,7 @@ const Vector&
 PlateFiberMaterialThermal::getTempAndElong()
 {
 	//return theMaterial->getTempAndElong( );
-   static Vector returnedVec = Vector(2);
+   thread_local Vector returnedVec = Vector(2);
 	returnedVec(0)= theMaterial->getTempAndElong( )(0);
 	returnedVec(1) = theMaterial->getTempAndElong( )(1);
 	return returnedVec;
@@ -457,7 +457,7 @@ PlateFiberMaterialThermal::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and associated materials class and database tags into an id and send it
-  static ID idData(3);
+  ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -474,7 +474,7 @@ PlateFiberMaterialThermal::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(1);
+  Vector vecData(1);
   vecData(0) = Cstrain22;
 
   res = theChannel.sendVector(this->getDbTag(), commitTag, vecData);
@@ -497,7 +497,7 @@ PlateFiberMaterialThermal::recvSelf(int commitTag, Channel &theChannel, FEM_Obje
   int res = 0;
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  ID idData(3);
   res = theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     // opserr << "PlateFiberMaterialThermal::sendSelf() - failed to send id data\n";
@@ -521,7 +521,7 @@ PlateFiberMaterialThermal::recvSelf(int commitTag, Channel &theChannel, FEM_Obje
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(1);
+  Vector vecData(1);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     // opserr << "PlateFiberMaterialThermal::sendSelf() - failed to send vector data\n";
@@ -103,8 +103,8 @@ private :
 	
 	double temperature;
     Vector strain ;
-    static Vector stress ;
-    static Matrix tangent ;
+    static thread_local Vector stress ;
+    static thread_local Matrix tangent ;
 
 } ;
 
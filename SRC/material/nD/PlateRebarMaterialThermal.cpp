@@ -38,8 +38,8 @@ Earthquake Engineering & Structural Dynamics, 2013, 42(5): 705-723*/
 #include <math.h>
 
 //static vector and matrices
-Vector  PlateRebarMaterialThermal::stress(5) ;
-Matrix  PlateRebarMaterialThermal::tangent(5,5) ;
+thread_local Vector  PlateRebarMaterialThermal::stress(5) ;
+thread_local Matrix  PlateRebarMaterialThermal::tangent(5,5) ;
 
 //null constructor
 PlateRebarMaterialThermal::PlateRebarMaterialThermal( ) : 
@@ -171,8 +171,8 @@ PlateRebarMaterialThermal::getThermalTangentAndElongation(double &TempT, double&
     temperature = TempT;
 	double tangent =0.0;
 	double ThermalElongation =0.0;
-    static Vector tData(4);
-    static Information iData(tData);
+    thread_local Vector tData(4);
+    thread_local Information iData(tData);
     tData(0) = temperature;
 	tData(1) = tangent;
 	tData(2) = ThermalElongation;
@@ -271,7 +271,7 @@ PlateRebarMaterialThermal::sendSelf(int commitTag, Channel &theChannel)
 
   int matDbTag;
   
-  static ID idData(3);
+  ID idData(3);
   idData(0) = dataTag;
   idData(1) = theMat->getClassTag();
   matDbTag = theMat->getDbTag();
@@ -287,7 +287,7 @@ PlateRebarMaterialThermal::sendSelf(int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector vecData(1);
+  Vector vecData(1);
   vecData(0) = angle;
 
   res = theChannel.sendVector(dataTag, commitTag, vecData);
@@ -312,7 +312,7 @@ PlateRebarMaterialThermal::recvSelf(int commitTag, Channel &theChannel, FEM_Obje
   int dataTag = this->getDbTag();
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  ID idData(3);
   res = theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
     opserr << "PlateRebarMaterialThermal::sendSelf() - failed to receive id data" << endln;
@@ -331,7 +331,7 @@ PlateRebarMaterialThermal::recvSelf(int commitTag, Channel &theChannel, FEM_Obje
   }
   theMat->setDbTag(idData(2));
 
-  static Vector vecData(1);
+  Vector vecData(1);
   res = theChannel.recvVector(dataTag, commitTag, vecData);
   if (res < 0) {
     opserr << "PlateRebarMaterialThermal::sendSelf() - failed to receive vector data" << endln;
@@ -354,8 +354,8 @@ PlateRebarMaterialThermal::recvSelf(int commitTag, Channel &theChannel, FEM_Obje
 Response*
 PlateRebarMaterialThermal::setResponse (const char **argv, int argc, OPS_Stream &output)
 {
-	static Vector tempData(2);
-	  static Information infoData(tempData);
+	thread_local Vector tempData(2);
+	  thread_local Information infoData(tempData);
 	Response *theResponse =0;
 	const char *matType = this->getType();
 
@@ -392,8 +392,8 @@ PlateRebarMaterialThermal::setResponse (const char **argv, int argc, OPS_Stream
 
 int PlateRebarMaterialThermal::getResponse (int responseID, Information &matInfo)
 {
-	  static Vector tempData(2);
-	  static Information infoData(tempData);
+	  thread_local Vector tempData(2);
+	  thread_local Information infoData(tempData);
 	switch (responseID) {
 		case -1:
 			return -1;
@@ -91,8 +91,8 @@ void * OPS_ADD_RUNTIME_VPV(OPS_PressureDependentElastic3D)
     return 0;
 }
 
-Matrix PressureDependentElastic3D::D(6,6);
-Vector PressureDependentElastic3D::sigma(6);
+thread_local Matrix PressureDependentElastic3D::D(6,6);
+thread_local Vector PressureDependentElastic3D::sigma(6);
 
 
 PressureDependentElastic3D::PressureDependentElastic3D
@@ -302,7 +302,7 @@ int PressureDependentElastic3D::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(7);
+    Vector data(7);
 
     data(0) = this->getTag();
     data(1) = E;
@@ -328,7 +328,7 @@ int PressureDependentElastic3D::recvSelf(int commitTag,
   {
     int res = 0;
 
-    static Vector data(7);
+    Vector data(7);
 
     res += theChannel.recvVector(this->getDbTag(), commitTag, data);
     if (res < 0)
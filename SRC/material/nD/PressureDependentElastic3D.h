@@ -80,8 +80,8 @@ class PressureDependentElastic3D : public ElasticIsotropicMaterial
     double p_ref;                // Reference pressure, usually atmosphere pressure, i.e. 100kPa
     double p_cutoff;             // Cutoff pressure of this material point
 
-    static Vector sigma;
-    static Matrix D;
+    static thread_local Vector sigma;
+    static thread_local Matrix D;
     Vector epsilon;
     Vector Cepsilon;
 
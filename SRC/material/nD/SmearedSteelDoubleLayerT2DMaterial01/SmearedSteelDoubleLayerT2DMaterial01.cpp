@@ -234,7 +234,7 @@ int SmearedSteelDoubleLayerT2DMaterial01::sendSelf(int commitTag, Channel& theCh
 
 	int dataTag = this->getDbTag();
 
-	static Vector data(4);
+	Vector data(4);
 
 	data(0) = this->getTag();
 	data(1) = ratioLayer1;
@@ -249,7 +249,7 @@ int SmearedSteelDoubleLayerT2DMaterial01::sendSelf(int commitTag, Channel& theCh
 
 	int matDbTag;
 
-	static ID idData(4);
+	ID idData(4);
 
 	int i;
 	for (i = 0; i < 2; i++)
@@ -287,7 +287,7 @@ int SmearedSteelDoubleLayerT2DMaterial01::recvSelf(int commitTag, Channel& theCh
 
 	int dataTag = this->getDbTag();
 
-	static Vector data(4);
+	Vector data(4);
 	res += theChannel.recvVector(dataTag, commitTag, data);
 	if (res < 0) {
 		opserr << "WARNING SmearedSteelDoubleLayerT2DMaterial01::recvSelf() - failed to receive Vector\n";
@@ -299,7 +299,7 @@ int SmearedSteelDoubleLayerT2DMaterial01::recvSelf(int commitTag, Channel& theCh
 	ratioLayer2       = data(2);
 	thetaSmearedSteel = data(3);
 
-	static ID idData(4);
+	ID idData(4);
 	res += theChannel.recvID(dataTag, commitTag, idData);
 	if (res < 0) {
 		opserr << "WARNING SmearedSteelDoubleLayerT2DMaterial01::recvSelf() - " << this->getTag() << " failed to receive ID\n";
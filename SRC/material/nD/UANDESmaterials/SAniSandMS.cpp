@@ -64,15 +64,45 @@ const bool          SAniSandMS::debugFlag = false;
 const char unsigned SAniSandMS::mMaxSubStep = 10;
 char  unsigned      SAniSandMS::mElastFlag = 1;
 
-Vector              SAniSandMS::mI1(6);
-Matrix              SAniSandMS::mIIco(6, 6);
-Matrix              SAniSandMS::mIIcon(6, 6);
-Matrix              SAniSandMS::mIImix(6, 6);
-Matrix              SAniSandMS::mIIvol(6, 6);
-Matrix              SAniSandMS::mIIdevCon(6, 6);
-Matrix              SAniSandMS::mIIdevMix(6, 6);
-Matrix              SAniSandMS::mIIdevCo(6, 6);
-SAniSandMS::initTensors SAniSandMS::initTensorOps;
+// Identity tensors in Voigt notation; the shear terms of the 4th order ones
+// are 1 mixed variant, 2 covariant and 0.5 contravariant
+static Vector
+identityTensor2()
+{
+  Vector I1(6);
+  for (int i = 0; i < 3; i++)
+    I1(i) = 1.0;
+  return I1;
+}
+
+static Matrix
+identityTensor4(double shear)
+{
+  Matrix II(6,6);
+  for (int i = 0; i < 6; i++)
+    II(i,i) = i < 3 ? 1.0 : shear;
+  return II;
+}
+
+// IIvol = I1 tensor I1
+static Matrix
+volumetricTensor4()
+{
+  Matrix IIvol(6,6);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      IIvol(i,j) = 1.0;
+  return IIvol;
+}
+
+const Vector        SAniSandMS::mI1       = identityTensor2();
+const Matrix        SAniSandMS::mIImix    = identityTensor4(1.0);
+const Matrix        SAniSandMS::mIIco     = identityTensor4(2.0);
+const Matrix        SAniSandMS::mIIcon    = identityTensor4(0.5);
+const Matrix        SAniSandMS::mIIvol    = volumetricTensor4();
+const Matrix        SAniSandMS::mIIdevCon = mIIcon - one3*mIIvol;
+const Matrix        SAniSandMS::mIIdevCo  = mIIco  - one3*mIIvol;
+const Matrix        SAniSandMS::mIIdevMix = mIImix - one3*mIIvol;
 
 static int numSAniSandMSMaterials = 0;
 
@@ -2139,8 +2169,8 @@ SAniSandMS::GetElastoPlasticTangent(const Vector& NextStress, const double& Next
 Vector
 SAniSandMS::GetNormalToYield(const Vector &stress, const Vector &alpha)
 {
-	static Vector devStress(6);
-	static Vector n(6);
+	thread_local Vector devStress(6);
+	thread_local Vector n(6);
 	devStress.Zero();
 	n.Zero();
 	devStress = GetDevPart(stress);
@@ -2406,7 +2436,7 @@ SAniSandMS::GetDevPart(const Vector& aV)
 	if (aV.Size() != 6)
 		opserr << "\n ERROR! SAniSandMS::GetDevPart requires vector of size(6)!" << endln;
 
-	static Vector result(6); result.Zero();
+	thread_local Vector result(6); result.Zero();
 
 	double p = GetTrace(aV);
 	result = aV;
@@ -203,53 +203,14 @@ class SAniSandMS : public NDMaterial
 	double	m_Pmin;			// Minimum allowable mean effective stress
 	static char unsigned mElastFlag;	// 1: enforce elastic response
 
-	static Vector mI1;			// 2nd Order Identity Tensor
-	static Matrix mIIco;		// 4th-order identity tensor, covariant
-	static Matrix mIIcon;		// 4th-order identity tensor, contravariant
-	static Matrix mIImix;		// 4th-order identity tensor, mixed variant
-	static Matrix mIIvol;		// 4th-order volumetric tensor, IIvol = I1 tensor I1 
-	static Matrix mIIdevCon;	// 4th order deviatoric tensor, contravariant
-	static Matrix mIIdevMix;	// 4th order deviatoric tensor, mixed variant
-	static Matrix mIIdevCo;		// 4th order deviatoric tensor, covariant
-	// initialize these Vector and Matrices:
-	static class initTensors {
-	public :
-		initTensors() {
-			// 2nd order identity tensor
-			mI1.Zero();
-			mI1(0) = 1.0;
-			mI1(1) = 1.0;
-			mI1(2) = 1.0;
-			// 4th order mixed variant identity tensor
-			mIImix.Zero();
-			for (int i = 0; i<6; i++) {
-				mIImix(i,i) = 1.0;
-			}
-			// 4th order covariant identity tensor
-			mIIco = mIImix;
-			mIIco(3,3) = 2.0;
-			mIIco(4,4) = 2.0;
-			mIIco(5,5) = 2.0;
-			// 4th order contravariant identity tensor
-			mIIcon = mIImix;
-			mIIcon(3,3) = 0.5;
-			mIIcon(4,4) = 0.5;
-			mIIcon(5,5) = 0.5;
-			// 4th order volumetric tensor, IIvol = I1 tensor I1
-			mIIvol.Zero();
-			for (int i = 0; i<3; i++) {
-				mIIvol(i,0) = 1.0;
-				mIIvol(i,1) = 1.0;
-				mIIvol(i,2) = 1.0;
-			}
-			// 4th order contravariant deviatoric tensor
-			mIIdevCon = mIIcon - one3*mIIvol;
-			// 4th order covariant deviatoric tensor
-			mIIdevCo  = mIIco  - one3*mIIvol;
-			// 4th order mixed variant deviatoric tensor
-			mIIdevMix = mIImix - one3*mIIvol;
-		}
-	} initTensorOps;
+	static const Vector mI1;			// 2nd Order Identity Tensor
+	static const Matrix mIIco;		// 4th-order identity tensor, covariant
+	static const Matrix mIIcon;		// 4th-order identity tensor, contravariant
+	static const Matrix mIImix;		// 4th-order identity tensor, mixed variant
+	static const Matrix mIIvol;		// 4th-order volumetric tensor, IIvol = I1 tensor I1 
+	static const Matrix mIIdevCon;	// 4th order deviatoric tensor, contravariant
+	static const Matrix mIIdevMix;	// 4th order deviatoric tensor, mixed variant
+	static const Matrix mIIdevCo;		// 4th order deviatoric tensor, covariant
 
 	// constant computation parameters
 	static const double		one3;
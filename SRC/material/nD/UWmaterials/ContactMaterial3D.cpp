@@ -516,7 +516,7 @@ int ContactMaterial3D::sendSelf(int commitTag, Channel &theChannel)
 #endif
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(29);
+  Vector data(29);
   data(0)  = this->getTag();
   data(1)  = mMu;
   data(2)  = mCo;
@@ -563,7 +563,7 @@ int ContactMaterial3D::recvSelf(int commitTag, Channel &theChannel,FEM_ObjectBro
   opserr << "ContactMaterial3D::recvSelf(...)" << endln;
 #endif
   // recv the vector object from the channel which defines material param and state
-  static Vector data(29);
+  Vector data(29);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "ContactMaterial3D::recvSelf - failed to recv vector from channel\n";
     return -1;
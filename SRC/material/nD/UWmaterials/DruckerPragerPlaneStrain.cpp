@@ -26,9 +26,9 @@
 #include <FEM_ObjectBroker.h>
 
 //static vectors and matrices
-Vector DruckerPragerPlaneStrain::strain(3);
-Vector DruckerPragerPlaneStrain::stress(3);
-Matrix DruckerPragerPlaneStrain::tangent(3,3);
+thread_local Vector DruckerPragerPlaneStrain::strain(3);
+thread_local Vector DruckerPragerPlaneStrain::stress(3);
+thread_local Matrix DruckerPragerPlaneStrain::tangent(3,3);
 
 //null constructor
 DruckerPragerPlaneStrain::DruckerPragerPlaneStrain() : 
@@ -69,9 +69,9 @@ class DruckerPragerPlaneStrain : public DruckerPrager {
   private :
 
   // static vectors and matrices
-  static Vector strain;
-  static Vector stress;
-  static Matrix tangent;
+  static thread_local Vector strain;
+  static thread_local Vector stress;
+  static thread_local Matrix tangent;
 
 
 }; 
@@ -26,7 +26,7 @@
 // Description: This file contains the implementation of the J2CyclicBoundingSurface3D class.
 #include "J2CyclicBoundingSurface3D.h"
 
-Matrix J2CyclicBoundingSurface3D::tangent(3, 3);
+thread_local Matrix J2CyclicBoundingSurface3D::tangent(3, 3);
 
 
 // full constructor
@@ -57,15 +57,45 @@ const bool          ManzariDafalias::debugFlag       = false;
 const char unsigned ManzariDafalias::mMaxSubStep     = 10;
 char  unsigned      ManzariDafalias::mElastFlag      = 1;
 
-Vector              ManzariDafalias::mI1(6);
-Matrix              ManzariDafalias::mIIco(6,6);
-Matrix              ManzariDafalias::mIIcon(6,6);
-Matrix              ManzariDafalias::mIImix(6,6);
-Matrix              ManzariDafalias::mIIvol(6,6);
-Matrix              ManzariDafalias::mIIdevCon(6,6);
-Matrix              ManzariDafalias::mIIdevMix(6,6);
-Matrix              ManzariDafalias::mIIdevCo(6,6);
-ManzariDafalias::initTensors ManzariDafalias::initTensorOps;
+// Identity tensors in Voigt notation; the shear terms of the 4th order ones
+// are 1 mixed variant, 2 covariant and 0.5 contravariant
+static Vector
+identityTensor2()
+{
+  Vector I1(6);
+  for (int i = 0; i < 3; i++)
+    I1(i) = 1.0;
+  return I1;
+}
+
+static Matrix
+identityTensor4(double shear)
+{
+  Matrix II(6,6);
+  for (int i = 0; i < 6; i++)
+    II(i,i) = i < 3 ? 1.0 : shear;
+  return II;
+}
+
+// IIvol = I1 tensor I1
+static Matrix
+volumetricTensor4()
+{
+  Matrix IIvol(6,6);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      IIvol(i,j) = 1.0;
+  return IIvol;
+}
+
+const Vector        ManzariDafalias::mI1       = identityTensor2();
+const Matrix        ManzariDafalias::mIImix    = identityTensor4(1.0);
+const Matrix        ManzariDafalias::mIIco     = identityTensor4(2.0);
+const Matrix        ManzariDafalias::mIIcon    = identityTensor4(0.5);
+const Matrix        ManzariDafalias::mIIvol    = volumetricTensor4();
+const Matrix        ManzariDafalias::mIIdevCon = mIIcon - one3*mIIvol;
+const Matrix        ManzariDafalias::mIIdevCo  = mIIco  - one3*mIIvol;
+const Matrix        ManzariDafalias::mIIdevMix = mIImix - one3*mIIvol;
 
 static int numManzariDafaliasMaterials = 0;
 
@@ -531,7 +561,7 @@ ManzariDafalias::sendSelf(int commitTag, Channel &theChannel)
     int res = 0;
 
     // place data in a vector
-    static Vector data(97);
+    Vector data(97);
 
     data(0) = this->getTag();
 
@@ -607,7 +637,7 @@ ManzariDafalias::recvSelf(int commitTag, Channel &theChannel,
     int res = 0;
 
     // receive data
-    static Vector data(97);
+    Vector data(97);
     res = theChannel.recvVector(this->getDbTag(), commitTag, data);
     if (res < 0) {
         opserr << "WARNING: ManzariDafalias::recvSelf - failed to receive vector from channel" << endln;
@@ -1712,7 +1742,7 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
         Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
         double& NextDGamma, double& NextVoidRatio,  double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent) 
 {    
-    static bool do_once = true;
+    thread_local bool do_once = true;
 
     if (do_once) {
         opserr << 
@@ -1726,15 +1756,15 @@ void ManzariDafalias::RungeKutta45(const Vector& CurStress, const Vector& CurStr
     double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0,A, B, C, D, p, Kp;
     double temp4, q;
 
-    //Static allocation so we can avoid mallocs and get maximum speed. This is not thread-safe
-    static Vector n(6), d(6), b(6), R(6), dDevStrain(6), r(6); 
-    static Vector nStress(6), nAlpha(6), nFabric(6), ndPStrain(6);
-    static Vector dSigma1(6), dSigma2(6), dSigma3(6), dSigma4(6), dSigma5(6), dSigma6(6), dSigma(6), 
+    //Allocated once per thread so we can avoid mallocs and get maximum speed
+    thread_local Vector n(6), d(6), b(6), R(6), dDevStrain(6), r(6); 
+    thread_local Vector nStress(6), nAlpha(6), nFabric(6), ndPStrain(6);
+    thread_local Vector dSigma1(6), dSigma2(6), dSigma3(6), dSigma4(6), dSigma5(6), dSigma6(6), dSigma(6), 
         dAlpha1(6), dAlpha2(6), dAlpha3(6), dAlpha4(6), dAlpha5(6), dAlpha6(6), dAlpha(6), 
         dFabric1(6), dFabric2(6), dFabric3(6), dFabric4(6), dFabric5(6), dFabric6(6), dFabric(6),
         dPStrain1(6), dPStrain2(6), dPStrain3(6), dPStrain4(6), dPStrain5(6), dPStrain6(6), dPStrain(6);
-    static Matrix aCep1(6,6), aCep2(6,6), aCep3(6,6), aCep4(6,6), aCep5(6,6), aCep6(6,6), aCep_thisStep(6,6), aD(6,6);
-    static Vector thisSigma(6), thisAlpha(6), thisFabric(6);    
+    thread_local Matrix aCep1(6,6), aCep2(6,6), aCep3(6,6), aCep4(6,6), aCep5(6,6), aCep6(6,6), aCep_thisStep(6,6), aD(6,6);
+    thread_local Vector thisSigma(6), thisAlpha(6), thisFabric(6);    
     
     // Zero everything out for good measure. 
     n.Zero(); d.Zero(); b.Zero(); R.Zero(); dDevStrain.Zero(); r.Zero();
@@ -2592,13 +2622,13 @@ ManzariDafalias::NewtonIter(const Vector& xo, const Vector& inVar, Vector& x, Ma
     bool jacoFlag = true;
     Matrix (ManzariDafalias::*jacoFunc)(const Vector&, const Vector&);
     // Declare variables to be used
-    static Vector sol(ResSize);
-    static Vector R(ResSize), R2(ResSize);
-    static Vector dX(ResSize);
-    static Vector norms(ResSize+1);
-	static Vector aux;
-    static Matrix jaco(ResSize,ResSize);
-    static Matrix jInv(ResSize,ResSize);
+    thread_local Vector sol(ResSize);
+    thread_local Vector R(ResSize), R2(ResSize);
+    thread_local Vector dX(ResSize);
+    thread_local Vector norms(ResSize+1);
+	thread_local Vector aux;
+    thread_local Matrix jaco(ResSize,ResSize);
+    thread_local Matrix jInv(ResSize,ResSize);
     double normR1, alpha;
     double aNormR1, aNormR2;
 
@@ -5166,7 +5196,7 @@ const Vector&
 ManzariDafalias::getPStrain() 
 {
     opserr << "ManzariDafalias::getPStrain - base class function called. This is an error\n ";
-    static Vector result(6);
+    thread_local Vector result(6);
     result = mEpsilon - mEpsilonE;
     return result; 
 } 
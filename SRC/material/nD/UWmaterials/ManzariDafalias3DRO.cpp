@@ -24,8 +24,8 @@
 
 #include "ManzariDafalias3DRO.h"
 
-Vector ManzariDafalias3DRO::mEpsilon_M(6);
-Vector ManzariDafalias3DRO::mSigma_M(6);
+thread_local Vector ManzariDafalias3DRO::mEpsilon_M(6);
+thread_local Vector ManzariDafalias3DRO::mSigma_M(6);
 
 // full constructor
 ManzariDafalias3DRO::ManzariDafalias3DRO(int tag, double G0, double nu, double B, double a1, double gamma1, double e_init, double Mc, double c, 
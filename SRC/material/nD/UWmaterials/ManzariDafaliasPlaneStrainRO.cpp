@@ -24,11 +24,11 @@
 
 #include "ManzariDafaliasPlaneStrainRO.h"
 
-Vector ManzariDafaliasPlaneStrainRO::mEpsilon_M(3);
-Vector ManzariDafaliasPlaneStrainRO::mSigma_M(3);
-Vector ManzariDafaliasPlaneStrainRO::rSigma(4);
-Matrix ManzariDafaliasPlaneStrainRO::mTangent(3,3);
-Matrix ManzariDafaliasPlaneStrainRO::mTangent_init(3,3);
+thread_local Vector ManzariDafaliasPlaneStrainRO::mEpsilon_M(3);
+thread_local Vector ManzariDafaliasPlaneStrainRO::mSigma_M(3);
+thread_local Vector ManzariDafaliasPlaneStrainRO::rSigma(4);
+thread_local Matrix ManzariDafaliasPlaneStrainRO::mTangent(3,3);
+thread_local Matrix ManzariDafaliasPlaneStrainRO::mTangent_init(3,3);
 
 // full constructor
 ManzariDafaliasPlaneStrainRO::ManzariDafaliasPlaneStrainRO(int tag, double G0, double nu, double B, double a1, double gamma1, double e_init, double Mc, double c, 
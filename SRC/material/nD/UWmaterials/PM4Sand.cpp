@@ -55,15 +55,45 @@ const double		PM4Sand::maxStrainInc = 1e-5;
 const bool  		PM4Sand::debugFlag = false;
 char unsigned		PM4Sand::me2p = 0;
 
-Vector 			PM4Sand::mI1(3);
-Matrix  		PM4Sand::mIIco(3, 3);
-Matrix 			PM4Sand::mIIcon(3, 3);
-Matrix 			PM4Sand::mIImix(3, 3);
-Matrix 			PM4Sand::mIIvol(3, 3);
-Matrix 			PM4Sand::mIIdevCon(3, 3);
-Matrix 			PM4Sand::mIIdevMix(3, 3);
-Matrix 			PM4Sand::mIIdevCo(3, 3);
-PM4Sand::initTensors PM4Sand::initTensorOps;
+// Identity tensors in Voigt notation; the shear terms of the 4th order ones
+// are 1 mixed variant, 2 covariant and 0.5 contravariant
+static Vector
+identityTensor2()
+{
+  Vector I1(3);
+  for (int i = 0; i < 2; i++)
+    I1(i) = 1.0;
+  return I1;
+}
+
+static Matrix
+identityTensor4(double shear)
+{
+  Matrix II(3,3);
+  for (int i = 0; i < 3; i++)
+    II(i,i) = i < 2 ? 1.0 : shear;
+  return II;
+}
+
+// IIvol = I1 tensor I1
+static Matrix
+volumetricTensor4()
+{
+  Matrix IIvol(3,3);
+  for (int i = 0; i < 2; i++)
+    for (int j = 0; j < 2; j++)
+      IIvol(i,j) = 1.0;
+  return IIvol;
+}
+
+const Vector        PM4Sand::mI1       = identityTensor2();
+const Matrix        PM4Sand::mIImix    = identityTensor4(1.0);
+const Matrix        PM4Sand::mIIco     = identityTensor4(2.0);
+const Matrix        PM4Sand::mIIcon    = identityTensor4(0.5);
+const Matrix        PM4Sand::mIIvol    = volumetricTensor4();
+const Matrix        PM4Sand::mIIdevCon = mIIcon - 0.5*mIIvol;
+const Matrix        PM4Sand::mIIdevCo  = mIIco  - 0.5*mIIvol;
+const Matrix        PM4Sand::mIIdevMix = mIImix - 0.5*mIIvol;
 
 static int numPM4SandMaterials = 0;
 
@@ -552,7 +582,7 @@ PM4Sand::sendSelf(int commitTag, Channel &theChannel)
 {
 
 	int res = 0;
-	static Vector data(101);
+	Vector data(101);
 
 	data(0) = this->getTag();
 
@@ -637,7 +667,7 @@ PM4Sand::recvSelf(int commitTag, Channel &theChannel,
 	FEM_ObjectBroker &theBroker)
 {
 	int res = 0;
-	static Vector data(101);
+	Vector data(101);
 
 	res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
@@ -56,15 +56,45 @@ const bool  		PM4Silt::debugFlag = false;
 const char unsigned	PM4Silt::mMaxSubStep = 10;
 char  unsigned		PM4Silt::me2p = 0;
 
-Vector 			PM4Silt::mI1(3);
-Matrix  		PM4Silt::mIIco(3, 3);
-Matrix 			PM4Silt::mIIcon(3, 3);
-Matrix 			PM4Silt::mIImix(3, 3);
-Matrix 			PM4Silt::mIIvol(3, 3);
-Matrix 			PM4Silt::mIIdevCon(3, 3);
-Matrix 			PM4Silt::mIIdevMix(3, 3);
-Matrix 			PM4Silt::mIIdevCo(3, 3);
-PM4Silt::initTensors PM4Silt::initTensorOps;
+// Identity tensors in Voigt notation; the shear terms of the 4th order ones
+// are 1 mixed variant, 2 covariant and 0.5 contravariant
+static Vector
+identityTensor2()
+{
+  Vector I1(3);
+  for (int i = 0; i < 2; i++)
+    I1(i) = 1.0;
+  return I1;
+}
+
+static Matrix
+identityTensor4(double shear)
+{
+  Matrix II(3,3);
+  for (int i = 0; i < 3; i++)
+    II(i,i) = i < 2 ? 1.0 : shear;
+  return II;
+}
+
+// IIvol = I1 tensor I1
+static Matrix
+volumetricTensor4()
+{
+  Matrix IIvol(3,3);
+  for (int i = 0; i < 2; i++)
+    for (int j = 0; j < 2; j++)
+      IIvol(i,j) = 1.0;
+  return IIvol;
+}
+
+const Vector        PM4Silt::mI1       = identityTensor2();
+const Matrix        PM4Silt::mIImix    = identityTensor4(1.0);
+const Matrix        PM4Silt::mIIco     = identityTensor4(2.0);
+const Matrix        PM4Silt::mIIcon    = identityTensor4(0.5);
+const Matrix        PM4Silt::mIIvol    = volumetricTensor4();
+const Matrix        PM4Silt::mIIdevCon = mIIcon - 0.5*mIIvol;
+const Matrix        PM4Silt::mIIdevCo  = mIIco  - 0.5*mIIvol;
+const Matrix        PM4Silt::mIIdevMix = mIImix - 0.5*mIIvol;
 
 static int numPM4SiltMaterials = 0;
 
@@ -540,7 +570,7 @@ PM4Silt::sendSelf(int commitTag, Channel &theChannel)
 {
 
 	int res = 0;
-	static Vector data(105);
+	Vector data(105);
 
 	data(0) = this->getTag();
 
@@ -628,7 +658,7 @@ PM4Silt::recvSelf(int commitTag, Channel &theChannel,
 	FEM_ObjectBroker &theBroker)
 {
 	int res = 0;
-	static Vector data(105);
+	Vector data(105);
 
 	res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
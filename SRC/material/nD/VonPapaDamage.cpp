@@ -67,8 +67,8 @@ using namespace::std;
 #include <limits.h>
 
 // Vector VonPapaDamage :: strain_vec(3) ;
-Vector VonPapaDamage :: stress_vec(3) ;
-Matrix VonPapaDamage :: tangent_matrix(3, 3) ;
+thread_local Vector VonPapaDamage :: stress_vec(3) ;
+thread_local Matrix VonPapaDamage :: tangent_matrix(3, 3) ;
 
 int VonPapaDamage::NVonPapaMaterials = 0;
 int VonPapaDamage::i_current_material_point = 0;
@@ -476,7 +476,7 @@ VonPapaDamage::commitState( )
   const Matrix& Q = getTangent();
 
   // Getting stresses (should remove the permament strain too)
-  static Vector stress(3);   // malloc
+  thread_local Vector stress(3);   // malloc
   stress.Zero();
 
   // Compute P.K. II stresses in the current ply in the LOCAL MATERIAL coord. system
@@ -1329,7 +1329,7 @@ VonPapaDamage::getResponse(int responseID, Information &matInfo)
 
 const Vector& VonPapaDamage :: getDamageState() const
 {
-    static Vector damage_state(9);
+    thread_local Vector damage_state(9);
     damage_state(0) = dft;
     damage_state(1) = dfc;
     damage_state(2) = dmt;
@@ -82,6 +82,7 @@
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <matrix/identity.h> // IbunI, IIdev
 #include <string.h>
 #include <elementAPI.h>
 
@@ -92,9 +93,6 @@ const double MultiaxialCyclicPlasticity :: four3  = 4.0 / 3.0 ;
 const double MultiaxialCyclicPlasticity :: root23 = sqrt( 2.0 / 3.0 ) ;
 const double MultiaxialCyclicPlasticity :: infinity  = 1.0e12;
 
-double MultiaxialCyclicPlasticity::initialTangent[3][3][3][3] ;   //material tangent
-double MultiaxialCyclicPlasticity::IIdev[3][3][3][3] ; //rank 4 deviatoric 
-double MultiaxialCyclicPlasticity::IbunI[3][3][3][3] ; //rank 4 I bun I 
 
 int MultiaxialCyclicPlasticity::MaterialStageID = 2;   // classwide load stage tag, 
                                                        // elasto-plastic by default
@@ -184,59 +182,6 @@ stress_n(3,3), strain_n(3,3), backs(3,3), backs_n(3,3), so(3,3), so_n(3,3)
 
   this->initialize( ) ;     // or (*this).zero( ) 
 
-  int i, j, k, l ;
-
-  //zero rank4 IIdev and IbunI 
-  for ( i = 0; i < 3; i++ ) {
-    for ( j = 0; j < 3; j++ )  {
-      for ( k = 0; k < 3; k++ ) {
-		for ( l = 0; l < 3; l++)  { 
-
-		  IbunI[i][j][k][l] = 0.0 ;
-
-		  IIdev[i][j][k][l] = 0.0 ;
-
-		} // end for l
-      } // end for k
-    } // end for j
-  } // end for i
-
-
-  //form rank4 IbunI 
-
-  IbunI [0][0] [0][0] = 1.0 ;
-  IbunI [0][0] [1][1] = 1.0 ;
-  IbunI [0][0] [2][2] = 1.0 ;
-  IbunI [1][1] [0][0] = 1.0 ;
-  IbunI [1][1] [1][1] = 1.0 ;
-  IbunI [1][1] [2][2] = 1.0 ;
-  IbunI [2][2] [0][0] = 1.0 ;
-  IbunI [2][2] [1][1] = 1.0 ;
-  IbunI [2][2] [2][2] = 1.0 ;
-
-  //form rank4 IIdev
-
-  IIdev [0][0] [0][0] =  two3 ; // 0.666667 
-  IIdev [0][0] [1][1] = -one3 ; //-0.333333 
-  IIdev [0][0] [2][2] = -one3 ; //-0.333333 
-  IIdev [0][1] [0][1] = 0.5 ;
-  IIdev [0][1] [1][0] = 0.5 ;
-  IIdev [0][2] [0][2] = 0.5 ;
-  IIdev [0][2] [2][0] = 0.5 ;
-  IIdev [1][0] [0][1] = 0.5 ;
-  IIdev [1][0] [1][0] = 0.5 ;
-  IIdev [1][1] [0][0] = -one3 ; //-0.333333 
-  IIdev [1][1] [1][1] =  two3 ; // 0.666667 
-  IIdev [1][1] [2][2] = -one3 ; //-0.333333 
-  IIdev [1][2] [1][2] = 0.5 ;
-  IIdev [1][2] [2][1] = 0.5 ;
-  IIdev [2][0] [0][2] = 0.5 ;
-  IIdev [2][0] [2][0] = 0.5 ;
-  IIdev [2][1] [1][2] = 0.5 ;
-  IIdev [2][1] [2][1] = 0.5 ;
-  IIdev [2][2] [0][0] = -one3 ; //-0.333333 
-  IIdev [2][2] [1][1] = -one3 ; //-0.333333 
-  IIdev [2][2] [2][2] =  two3 ; // 0.666667 
 }
 
 
@@ -286,59 +231,6 @@ MultiaxialCyclicPlasticity::MultiaxialCyclicPlasticity(int    tag,
 
   this->initialize( ) ;
 
-  int i, j, k, l ;
-
-  //zero rank4 IIdev and IbunI 
-  for ( i = 0; i < 3; i++ ) {
-    for ( j = 0; j < 3; j++ ) {
-      for ( k = 0; k < 3; k++ ) {
-		for ( l = 0; l < 3; l++)  { 
-
-		  IbunI[i][j][k][l] = 0.0 ;
-
-		  IIdev[i][j][k][l] = 0.0 ;
-
-		} // end for l
-      } // end for k
-    } // end for j
-  } // end for i
-
-
-  //form rank4 IbunI 
-
-  IbunI [0][0] [0][0] = 1.0 ;
-  IbunI [0][0] [1][1] = 1.0 ;
-  IbunI [0][0] [2][2] = 1.0 ;
-  IbunI [1][1] [0][0] = 1.0 ;
-  IbunI [1][1] [1][1] = 1.0 ;
-  IbunI [1][1] [2][2] = 1.0 ;
-  IbunI [2][2] [0][0] = 1.0 ;
-  IbunI [2][2] [1][1] = 1.0 ;
-  IbunI [2][2] [2][2] = 1.0 ;
-
-  //form rank4 IIdev
-
-  IIdev [0][0] [0][0] =  two3 ; // 0.666667 
-  IIdev [0][0] [1][1] = -one3 ; //-0.333333 
-  IIdev [0][0] [2][2] = -one3 ; //-0.333333 
-  IIdev [0][1] [0][1] = 0.5 ;
-  IIdev [0][1] [1][0] = 0.5 ;
-  IIdev [0][2] [0][2] = 0.5 ;
-  IIdev [0][2] [2][0] = 0.5 ;
-  IIdev [1][0] [0][1] = 0.5 ;
-  IIdev [1][0] [1][0] = 0.5 ;
-  IIdev [1][1] [0][0] = -one3 ; //-0.333333 
-  IIdev [1][1] [1][1] =  two3 ; // 0.666667 
-  IIdev [1][1] [2][2] = -one3 ; //-0.333333 
-  IIdev [1][2] [1][2] = 0.5 ;
-  IIdev [1][2] [2][1] = 0.5 ;
-  IIdev [2][0] [0][2] = 0.5 ;
-  IIdev [2][0] [2][0] = 0.5 ;
-  IIdev [2][1] [1][2] = 0.5 ;
-  IIdev [2][1] [2][1] = 0.5 ;
-  IIdev [2][2] [0][0] = -one3 ; //-0.333333 
-  IIdev [2][2] [1][1] = -one3 ; //-0.333333 
-  IIdev [2][2] [2][2] =  two3 ; // 0.666667 
 }
 
 
@@ -359,59 +251,6 @@ backs(3,3), backs_n(3,3), so(3,3), so_n(3,3)
 
   this->initialize( ) ;
 
-  int i, j, k, l ;
-
-  //zero rank4 IIdev and IbunI 
-  for ( i = 0; i < 3; i++ ) {
-    for ( j = 0; j < 3; j++ )  {
-      for ( k = 0; k < 3; k++ ) {
-		for ( l = 0; l < 3; l++)  { 
-
-		  IbunI[i][j][k][l] = 0.0 ;
-
-		  IIdev[i][j][k][l] = 0.0 ;
-
-		} // end for l
-      } // end for k
-    } // end for j
-  } // end for i
-
-
-  //form rank4 IbunI 
-
-  IbunI [0][0] [0][0] = 1.0 ;
-  IbunI [0][0] [1][1] = 1.0 ;
-  IbunI [0][0] [2][2] = 1.0 ;
-  IbunI [1][1] [0][0] = 1.0 ;
-  IbunI [1][1] [1][1] = 1.0 ;
-  IbunI [1][1] [2][2] = 1.0 ;
-  IbunI [2][2] [0][0] = 1.0 ;
-  IbunI [2][2] [1][1] = 1.0 ;
-  IbunI [2][2] [2][2] = 1.0 ;
-
-  //form rank4 IIdev
-
-  IIdev [0][0] [0][0] =  two3 ; // 0.666667 
-  IIdev [0][0] [1][1] = -one3 ; //-0.333333 
-  IIdev [0][0] [2][2] = -one3 ; //-0.333333 
-  IIdev [0][1] [0][1] = 0.5 ;
-  IIdev [0][1] [1][0] = 0.5 ;
-  IIdev [0][2] [0][2] = 0.5 ;
-  IIdev [0][2] [2][0] = 0.5 ;
-  IIdev [1][0] [0][1] = 0.5 ;
-  IIdev [1][0] [1][0] = 0.5 ;
-  IIdev [1][1] [0][0] = -one3 ; //-0.333333 
-  IIdev [1][1] [1][1] =  two3 ; // 0.666667 
-  IIdev [1][1] [2][2] = -one3 ; //-0.333333 
-  IIdev [1][2] [1][2] = 0.5 ;
-  IIdev [1][2] [2][1] = 0.5 ;
-  IIdev [2][0] [0][2] = 0.5 ;
-  IIdev [2][0] [2][0] = 0.5 ;
-  IIdev [2][1] [1][2] = 0.5 ;
-  IIdev [2][1] [2][1] = 0.5 ;
-  IIdev [2][2] [0][0] = -one3 ; //-0.333333 
-  IIdev [2][2] [1][1] = -one3 ; //-0.333333 
-  IIdev [2][2] [2][2] =  two3 ; // 0.666667 
 }
 
 
@@ -483,9 +322,9 @@ void MultiaxialCyclicPlasticity :: Print( OPS_Stream &s, int flag )
 
 void MultiaxialCyclicPlasticity :: elastic_integrator( )
 {
-  static Matrix dev_strain(3,3) ; //deviatoric strain  
+  thread_local Matrix dev_strain(3,3) ; //deviatoric strain  
 
-  static Matrix dev_stress(3,3) ; //deviatoric stress
+  thread_local Matrix dev_stress(3,3) ; //deviatoric stress
 
   // add
   double pressure;                // 1/3 trace(stress) 
@@ -515,11 +354,11 @@ void MultiaxialCyclicPlasticity :: elastic_integrator( )
   pressure  *= bulk_K0 ;						 
   }
 
-  static Matrix IncrStrain(3,3);
+  thread_local Matrix IncrStrain(3,3);
 
-  static Matrix DevStress_n(3,3);
+  thread_local Matrix DevStress_n(3,3);
 
-  static double pressure_n;
+  thread_local double pressure_n;
 
   if (IncrFormulationFlag==1){
    
@@ -746,7 +585,7 @@ MultiaxialCyclicPlasticity::sendSelf(int commitTag, Channel &theChannel)
 {
   // we place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(10); 
+  Vector data(10); 
   int cnt = 0;
   data(cnt++) = this->getTag();
   data(cnt++) = density;   //add
@@ -774,7 +613,7 @@ MultiaxialCyclicPlasticity::recvSelf (int commitTag, Channel &theChannel,
 {
 
   // recv the vector object from the channel which defines material param and state
-  static Vector data(10);
+  Vector data(10);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "MultiaxialCyclicPlasticity::recvSelf - failed to recv vector from channel\n";
     return -1;
@@ -826,33 +665,33 @@ void MultiaxialCyclicPlasticity::plastic_integrator()
 
   // toleraces
 
-  static double ZERO      = 1.0e-16; 
+  static const double ZERO      = 1.0e-16; 
 
-  static double zerotol   = 1.0e-10;    // tol for zeroloading...||de||<zerotol
-  static double tolforload= 1.0e-10;     // tol to determine loading/unloading
-  static double tolforX   = 1.0e-6;;       // tol for compute norm g1g2 in iteration X[1], X[2]
+  static const double zerotol   = 1.0e-10;    // tol for zeroloading...||de||<zerotol
+  static const double tolforload= 1.0e-10;     // tol to determine loading/unloading
+  static const double tolforX   = 1.0e-6;;       // tol for compute norm g1g2 in iteration X[1], X[2]
   
   double twomu; 
   int ii,jj;              // for loop iterators
   int i,j,k,l;
 
-  static Matrix de(3,3) ;   //incremental deviatoric strain  
-  static Matrix  s(3,3) ;   //deviatoric stress
+  thread_local Matrix de(3,3) ;   //incremental deviatoric strain  
+  thread_local Matrix  s(3,3) ;   //deviatoric stress
  // add
-  static double p;          // pressure, 1/3 trace(stress) 
-  static double e;          // incr. vol.strain, trace(incremental strains)
+  thread_local double p;          // pressure, 1/3 trace(stress) 
+  thread_local double e;          // incr. vol.strain, trace(incremental strains)
 
-  static Matrix IncrStrain(3,3); // Frank let all Matrix be static
-  static Matrix s_n(3,3);        // dev. stress at t_n 
-  static double p_n;             // pressure at t_n
+  thread_local Matrix IncrStrain(3,3); // Frank let all Matrix be static
+  thread_local Matrix s_n(3,3);        // dev. stress at t_n 
+  thread_local double p_n;             // pressure at t_n
   //static Matrix soinit(3,3);   // save s0_n here
   double normchi=0;
-  static Matrix strial(3,3);
-  static Matrix chitri(3,3);
-  static Matrix alpha_n(3,3); // backstress of loading surface at t_n
-  static double  Psi_split; // Psi for strain split step
-  static Matrix temp6(3,3);
-  static double dottemp6;
+  thread_local Matrix strial(3,3);
+  thread_local Matrix chitri(3,3);
+  thread_local Matrix alpha_n(3,3); // backstress of loading surface at t_n
+  thread_local double  Psi_split; // Psi for strain split step
+  thread_local Matrix temp6(3,3);
+  thread_local double dottemp6;
   double norm = 0;
 	
   double Hn =0;
@@ -1750,7 +1589,7 @@ LABEL10:
 }  // end of this subroutine
 
 
-Vector MultiaxialCyclicPlasticity::MCPparameter(10) ;
+thread_local Vector MultiaxialCyclicPlasticity::MCPparameter(10) ;
 
 
 
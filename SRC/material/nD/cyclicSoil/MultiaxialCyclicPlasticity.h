@@ -191,9 +191,7 @@ class MultiaxialCyclicPlasticity : public NDMaterial {
   Matrix so_n;                   // unload point for t=n
 
   double tangent[3][3][3][3] ;   // material tangent
-  static double initialTangent[3][3][3][3] ;   //material tangent
-  static double IIdev[3][3][3][3] ; //rank 4 deviatoric
-  static double IbunI[3][3][3][3] ; //rank 4 I bun I
+  double initialTangent[3][3][3][3] ;   //material tangent
 
 
   // element tag associated with this material; added method by Gang Wang
@@ -222,7 +220,7 @@ class MultiaxialCyclicPlasticity : public NDMaterial {
   //matrix index to tensor index mapping
   virtual void index_map( int matrix_index, int &i, int &j ) ;
 
-  static Vector MCPparameter; // debug tool
+  static thread_local Vector MCPparameter; // debug tool
 
 } ; //end of MultiaxialCyclicPlasticity declarations
 
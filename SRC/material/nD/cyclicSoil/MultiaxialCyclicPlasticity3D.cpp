@@ -35,9 +35,9 @@
 #include <FEM_ObjectBroker.h>
 
 //static vectors and matrices
-Vector MultiaxialCyclicPlasticity3D :: strain_vec(6) ;
-Vector MultiaxialCyclicPlasticity3D :: stress_vec(6) ;
-Matrix MultiaxialCyclicPlasticity3D :: tangent_matrix(6,6) ;
+thread_local Vector MultiaxialCyclicPlasticity3D :: strain_vec(6) ;
+thread_local Vector MultiaxialCyclicPlasticity3D :: stress_vec(6) ;
+thread_local Matrix MultiaxialCyclicPlasticity3D :: tangent_matrix(6,6) ;
 
 
 //null constructor
@@ -153,7 +153,7 @@ int MultiaxialCyclicPlasticity3D :: setTrialStrain( const Vector &v, const Vecto
 
 int MultiaxialCyclicPlasticity3D :: setTrialStrainIncr( const Vector &v ) 
 {
-  static Vector newStrain(6);
+  thread_local Vector newStrain(6);
   newStrain(0) = strain(0,0) + v(0);
   newStrain(1) = strain(1,1) + v(1);
   newStrain(2) = strain(2,2) + v(2);
@@ -33,9 +33,9 @@
 #include <FEM_ObjectBroker.h>
 
 //static vectors and matrices
-Vector MultiaxialCyclicPlasticityAxiSymm :: strain_vec(4) ;
-Vector MultiaxialCyclicPlasticityAxiSymm :: stress_vec(4) ;
-Matrix MultiaxialCyclicPlasticityAxiSymm :: tangent_matrix(4,4) ;
+thread_local Vector MultiaxialCyclicPlasticityAxiSymm :: strain_vec(4) ;
+thread_local Vector MultiaxialCyclicPlasticityAxiSymm :: stress_vec(4) ;
+thread_local Matrix MultiaxialCyclicPlasticityAxiSymm :: tangent_matrix(4,4) ;
 
 //null constructor
 MultiaxialCyclicPlasticityAxiSymm ::  MultiaxialCyclicPlasticityAxiSymm( ) : 
@@ -138,7 +138,7 @@ int MultiaxialCyclicPlasticityAxiSymm :: setTrialStrain( const Vector &v, const
 int MultiaxialCyclicPlasticityAxiSymm :: setTrialStrainIncr( const Vector &v ) 
 {
     // implemented Dec. 5, 2003, Gang Wang
-    static Vector newStrain(4);
+    thread_local Vector newStrain(4);
     newStrain(0) = strain(0,0) + v(0);
     newStrain(1) = strain(1,1) + v(1);
     newStrain(2) = strain(2,2) + v(2);
@@ -153,7 +153,7 @@ int MultiaxialCyclicPlasticityAxiSymm :: setTrialStrainIncr( const Vector &v, co
 	//return this->setTrialStrainIncr(v);
 
    // implemented April. 4, 2004, Gang Wang
-	static Vector newStrain(4);
+	thread_local Vector newStrain(4);
 	newStrain(0) = strain(0,0) + v(0);
 	newStrain(1) = strain(1,1) + v(1);
 	newStrain(2) = strain(2,2) + v(2);
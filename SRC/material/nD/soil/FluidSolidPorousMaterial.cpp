@@ -27,10 +27,10 @@ double* FluidSolidPorousMaterial::combinedBulkModulusx = 0;
 int FluidSolidPorousMaterial::matCount = 0;
 double FluidSolidPorousMaterial::pAtm = 101;
 
-Vector FluidSolidPorousMaterial::workV3(3);
-Vector FluidSolidPorousMaterial::workV6(6);
-Matrix FluidSolidPorousMaterial::workM3(3,3);
-Matrix FluidSolidPorousMaterial::workM6(6,6);
+thread_local Vector FluidSolidPorousMaterial::workV3(3);
+thread_local Vector FluidSolidPorousMaterial::workV6(6);
+thread_local Matrix FluidSolidPorousMaterial::workM3(3,3);
+thread_local Matrix FluidSolidPorousMaterial::workM6(6,6);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_FluidSolidPorousMaterial)
 {
@@ -342,7 +342,7 @@ const Vector & FluidSolidPorousMaterial::getCommittedPressure (void)
 {
 	int ndm = ndmx[matN];
 
-	static Vector temp(2);
+	thread_local Vector temp(2);
 	
 	temp[0] = currentExcessPressure;
 	temp[1] = temp[0]/initMaxPress;
@@ -427,7 +427,7 @@ int FluidSolidPorousMaterial::sendSelf(int commitTag, Channel &theChannel)
 
 	int res = 0;
 
-	static Vector data(7);
+	Vector data(7);
 	data(0) = this->getTag();
 	data(1) = ndm;
 	data(2) = loadStage;
@@ -481,7 +481,7 @@ int FluidSolidPorousMaterial::recvSelf(int commitTag, Channel &theChannel,
 {
 	int res = 0;
 
-	static Vector data(7);
+	Vector data(7);
 
 	res += theChannel.recvVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
@@ -116,10 +116,10 @@ class FluidSolidPorousMaterial : public NDMaterial
      Vector theSoilCommittedStress;
      Vector theSoilCommittedStrain;
 
-     static Vector workV3;
-     static Vector workV6;
-     static Matrix workM3;
-     static Matrix workM6;
+     static thread_local Vector workV3;
+     static thread_local Vector workV6;
+     static thread_local Matrix workM3;
+     static thread_local Matrix workM6;
 };
 
 #endif
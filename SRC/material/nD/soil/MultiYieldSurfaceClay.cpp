@@ -31,29 +31,29 @@
 #include <string.h>
 #include <elementAPI.h>
 
-Matrix MultiYieldSurfaceClay::theTangent(6,6);
-Matrix MultiYieldSurfaceClay::dTrialStressdStrain(6,6);    //classwide matrix
-Matrix MultiYieldSurfaceClay::dContactStressdStrain(6,6);  //classwide matrix
-Matrix MultiYieldSurfaceClay::dSurfaceNormaldStrain(6,6);  //classwide matrix
-Vector MultiYieldSurfaceClay::dXdStrain(6);                // classwide Vector
+thread_local Matrix MultiYieldSurfaceClay::theTangent(6,6);
+thread_local Matrix MultiYieldSurfaceClay::dTrialStressdStrain(6,6);    //classwide matrix
+thread_local Matrix MultiYieldSurfaceClay::dContactStressdStrain(6,6);  //classwide matrix
+thread_local Matrix MultiYieldSurfaceClay::dSurfaceNormaldStrain(6,6);  //classwide matrix
+thread_local Vector MultiYieldSurfaceClay::dXdStrain(6);                // classwide Vector
 
 
-Vector     MultiYieldSurfaceClay::temp6(6);    // classwide Vector
-Vector     MultiYieldSurfaceClay::temp(6);     // classwide Vector
-Vector     MultiYieldSurfaceClay::devia(6);    // classwide Vector
+thread_local Vector     MultiYieldSurfaceClay::temp6(6);    // classwide Vector
+thread_local Vector     MultiYieldSurfaceClay::temp(6);     // classwide Vector
+thread_local Vector     MultiYieldSurfaceClay::devia(6);    // classwide Vector
 
 
 double delta(int i,int j);
  
-T2Vector MultiYieldSurfaceClay::dCurrentStress;
-T2Vector MultiYieldSurfaceClay::dTrialStress;
-T2Vector MultiYieldSurfaceClay::dCurrentStrain;
-T2Vector MultiYieldSurfaceClay::dSubStrainRate;
-T2Vector MultiYieldSurfaceClay::dStrainRate;
-T2Vector MultiYieldSurfaceClay::dContactStress;
+thread_local T2Vector MultiYieldSurfaceClay::dCurrentStress;
+thread_local T2Vector MultiYieldSurfaceClay::dTrialStress;
+thread_local T2Vector MultiYieldSurfaceClay::dCurrentStrain;
+thread_local T2Vector MultiYieldSurfaceClay::dSubStrainRate;
+thread_local T2Vector MultiYieldSurfaceClay::dStrainRate;
+thread_local T2Vector MultiYieldSurfaceClay::dContactStress;
 
 
-T2Vector MultiYieldSurfaceClay::subStrainRate;
+thread_local T2Vector MultiYieldSurfaceClay::subStrainRate;
 int MultiYieldSurfaceClay::matCount=0;
 int* MultiYieldSurfaceClay::loadStagex=0;  //=0 if elastic; =1 if plastic
 int* MultiYieldSurfaceClay::ndmx=0;  //num of dimensions (2 or 3)
@@ -598,7 +598,7 @@ const Matrix & MultiYieldSurfaceClay::getTangent (void)
   if (ndm==3) 
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -630,7 +630,7 @@ const Matrix & MultiYieldSurfaceClay::getInitialTangent (void)
   if (ndm==3) 
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -657,7 +657,7 @@ const Vector & MultiYieldSurfaceClay::getStress (void)
   if (loadStage!=1) {  //linear elastic
     //trialStrain.setData(currentStrain.t2Vector() + strainRate.t2Vector());
     getTangent();
-    static Vector a(6);
+    thread_local Vector a(6);
     a = currentStress.t2Vector();
 	a.addMatrixVector(1.0, theTangent, strainRate.t2Vector(1), 1.0);
     trialStress.setData(a);
@@ -694,8 +694,8 @@ const Vector & MultiYieldSurfaceClay::getStress (void)
 
 	//--------- add consistent tangent part code -------------------
 	// unitTensor = I*I 
-	static Matrix unitTensor(6,6);
-	static Matrix tempTangent(6,6);
+	thread_local Matrix unitTensor(6,6);
+	thread_local Matrix tempTangent(6,6);
 	unitTensor.Zero();
 	for(int i=0;i<3;i++){
 		for(int j=0;j<3;j++){
@@ -754,7 +754,7 @@ const Vector & MultiYieldSurfaceClay::getStress (void)
 	return temp6;
 //	  return trialStress.t2Vector();
   else {
-    static Vector workV(3);
+    thread_local Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -910,7 +910,7 @@ int MultiYieldSurfaceClay::sendSelf(int commitTag, Channel &theChannel)
 
   int i, res = 0;
 
-  static ID idData(5);
+  ID idData(5);
   idData(0) = this->getTag();
   idData(1) = numOfSurfaces;
   idData(2) = loadStage;
@@ -971,7 +971,7 @@ int MultiYieldSurfaceClay::recvSelf(int commitTag, Channel &theChannel,
 {
   int i, res = 0;
 
-  static ID idData(5);
+  ID idData(5);
 
   res += theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
@@ -1063,7 +1063,7 @@ MultiYieldSurfaceClay::setResponse (const char **argv, int argc, OPS_Stream &the
     
 	else if (strcmp(argv[0],"backbone") == 0) {
 	    int numOfSurfaces = numOfSurfacesx[matN];
-        static Matrix curv(numOfSurfaces+1,(argc-1)*2);
+        thread_local Matrix curv(numOfSurfaces+1,(argc-1)*2);
 		  for (int i=1; i<argc; i++)
 		   	curv(0,(i-1)*2) = atoi(argv[i]);
 		return new MaterialResponse(this, 4, curv);
@@ -1198,7 +1198,7 @@ const Vector & MultiYieldSurfaceClay::getCommittedStress (void)
 	double scale = sqrt(3./2.)*currentStress.deviatorLength()/committedSurfaces[numOfSurfaces].size();
 	if (loadStagex[matN] != 1) scale = 0.;
 	if (ndm==3) {
-		static Vector temp7(7);
+		thread_local Vector temp7(7);
 //		static Vector temp6(6);
 		temp6 = currentStress.t2Vector();
     temp7[0] = temp6[0];
@@ -1211,7 +1211,7 @@ const Vector & MultiYieldSurfaceClay::getCommittedStress (void)
 		return temp7;
 	}
   else {
-    static Vector temp3(3);
+    thread_local Vector temp3(3);
 	//, temp6(6);
 		temp6 = currentStress.t2Vector();
     temp3[0] = temp6[0];
@@ -1231,7 +1231,7 @@ const Vector & MultiYieldSurfaceClay::getCommittedStrain (void)
   if (ndm==3)
     return currentStrain.t2Vector(1);
   else {
-    static Vector workV(3);//, temp6(6);
+    thread_local Vector workV(3);//, temp6(6);
 		temp6 = currentStrain.t2Vector(1);
     workV[0] = temp6[0];
     workV[1] = temp6[1];
@@ -1420,7 +1420,7 @@ void MultiYieldSurfaceClay::deviatorScaling(T2Vector & stress, const MultiYieldS
 	if (surfaceNum==numOfSurfaces && fabs(diff) > LOW_LIMIT) {
 		opserr <<"deviatorScaling called,bigger than bound" << endln;
 		double sz = surfaces[surfaceNum].size();
-		static Vector newDevia(6);
+		thread_local Vector newDevia(6);
 		newDevia.addVector(0.0, stress.deviator(), sz/sqrt(diff+sz*sz));
 		stress.setData(newDevia, stress.volume());
 	}
@@ -1436,7 +1436,7 @@ void MultiYieldSurfaceClay::initSurfaceUpdate()
 //	static Vector devia(6);
 	devia = currentStress.deviator();
 	double Ms = sqrt(3./2.*(devia && devia));
-	static Vector newCenter(6);
+	thread_local Vector newCenter(6);
 
 	if (activeSurfaceNum < numOfSurfaces) { // failure surface can't move
 		//newCenter = devia * (1. - committedSurfaces[activeSurfaceNum].size() / Ms); 
@@ -1540,11 +1540,11 @@ int MultiYieldSurfaceClay::setSubStrainRate(void)
 	  elast_plast_modulus = 2*refShearModulus*plast_modulus 
 	    / (2*refShearModulus+plast_modulus);
 	}
-	static Vector incre(6);
+	thread_local Vector incre(6);
 	//incre = strainRate.deviator()*elast_plast_modulus;
 	incre.addVector(0.0, strainRate.deviator(),elast_plast_modulus);
 
-	static T2Vector increStress;
+	thread_local T2Vector increStress;
 	increStress.setData(incre, 0);
 	double singleCross = theSurfaces[numOfSurfaces].size() / numOfSurfaces;
 	double totalCross = 3.*increStress.octahedralShear() / sqrt(2.);
@@ -1565,13 +1565,13 @@ int MultiYieldSurfaceClay::setSubStrainRate(void)
 void
 MultiYieldSurfaceClay::getContactStress(T2Vector &contactStress)
 {
-	static Vector center(6);
+	thread_local Vector center(6);
 	center = theSurfaces[activeSurfaceNum].center(); 
 //	static Vector devia(6);
-	static Vector tempStress(6);
+	thread_local Vector tempStress(6);
 	
-	static Vector dKdStrain(6);
-	static Matrix tempTangent(6,6);
+	thread_local Vector dKdStrain(6);
+	thread_local Matrix tempTangent(6,6);
 	
 	//devia = trialStress.deviator() - center;
 	devia = trialStress.deviator();
@@ -1613,12 +1613,12 @@ int MultiYieldSurfaceClay::isLoadReversal(void)
 {
   if(activeSurfaceNum == 0) return 0;
 
-  static Vector surfaceNormal(6);
+  thread_local Vector surfaceNormal(6);
   getSurfaceNormal(currentStress, surfaceNormal);
  
   //(((trialStress.deviator() - currentStress.deviator()) && surfaceNormal) < 0) 
   // return 1;
-  static Vector a(6);
+  thread_local Vector a(6);
   a = trialStress.deviator();
   a-= currentStress.deviator();
   if((a && surfaceNormal) < 0) 
@@ -1634,8 +1634,8 @@ MultiYieldSurfaceClay::getSurfaceNormal(const T2Vector & stress, Vector &surface
   //Q = stress.deviator() - theSurfaces[activeSurfaceNum].center();
   // return Q / sqrt(Q && Q);
 
-  static Vector tempStress(6),tempProduct(6);
-  static Matrix tempTangent(6,6);
+  thread_local Vector tempStress(6),tempProduct(6);
+  thread_local Matrix tempTangent(6,6);
 
 
   surfaceNormal = stress.deviator();
@@ -1715,9 +1715,9 @@ double MultiYieldSurfaceClay::getLoadingFunc(const T2Vector & contactStress,
 
 void MultiYieldSurfaceClay::stressCorrection(int crossedSurface)
 {
-	static T2Vector contactStress;
+	thread_local T2Vector contactStress;
 	this->getContactStress(contactStress);
-	static Vector surfaceNormal(6);
+	thread_local Vector surfaceNormal(6);
 	this->getSurfaceNormal(contactStress, surfaceNormal);
 	double loadingFunc = getLoadingFunc(contactStress, surfaceNormal, crossedSurface);
 //	static Vector devia(6);
@@ -1760,14 +1760,14 @@ void MultiYieldSurfaceClay::updateActiveSurface(void)
   if (activeSurfaceNum == numOfSurfaces) return;
 
 	double A, B, C, X;
-	static T2Vector direction;
-	static Vector t1(6);
-	static Vector t2(6);
+	thread_local T2Vector direction;
+	thread_local Vector t1(6);
+	thread_local Vector t2(6);
 //	static Vector temp(6);
-	static Vector center(6);
+	thread_local Vector center(6);
 	center = theSurfaces[activeSurfaceNum].center();
 	double size = theSurfaces[activeSurfaceNum].size();
-	static Vector outcenter(6);
+	thread_local Vector outcenter(6);
 	outcenter= theSurfaces[activeSurfaceNum+1].center();
 	double outsize = theSurfaces[activeSurfaceNum+1].size();
 
@@ -1833,10 +1833,10 @@ void MultiYieldSurfaceClay::updateInnerSurface(void)
 
 //	static Vector devia(6);
 	devia = currentStress.deviator();
-	static Vector center(6);
+	thread_local Vector center(6);
 	center = theSurfaces[activeSurfaceNum].center();
 	double size = theSurfaces[activeSurfaceNum].size();
-	static Vector newcenter(6);
+	thread_local Vector newcenter(6);
 
 	for (int i=1; i<activeSurfaceNum; i++) {
 		//newcenter = devia - (devia - center) * theSurfaces[i].size() / size;
@@ -2888,7 +2888,7 @@ opserr << "---------------------------------"<< endln;
     //return dTrialStress.t2Vector();   ~~~~~guquan ~~~~~ change by following line
 	return temp6;
   else {
-    static Vector workV(3);
+    thread_local Vector workV(3);
     workV[0] = temp6[0];
     workV[1] = temp6[1];
     workV[2] = temp6[3];
@@ -2916,7 +2916,7 @@ int MultiYieldSurfaceClay::commitSensitivity (const Vector & strainSens, int pas
 
   int ndm = ndmx[matN];
 
-  static Vector strainSensitivity(6);
+  thread_local Vector strainSensitivity(6);
   if (ndm==3 && strainSens.Size()==6) 
     strainSensitivity = strainSens;
   else if (ndm==2 && strainSens.Size()==3) {
@@ -3063,7 +3063,7 @@ int MultiYieldSurfaceClay::commitSensitivity (const Vector & strainSens, int pas
 //    opserr << "-------------------------------------------"<< endln;
 //	opserr << strainSensitivity<< endln;
  
-	static Vector tempaa(6);
+	thread_local Vector tempaa(6);
 	tempaa = currentStrain.t2Vector();
 	 tempaa += strainRate.t2Vector();
   
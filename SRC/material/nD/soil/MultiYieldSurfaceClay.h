@@ -126,7 +126,7 @@ private:
 
 	// internal
 	static double* residualPressx;
-	static Matrix theTangent;  //classwise member
+	static thread_local Matrix theTangent;  //classwise member
 	int e2p;
 	int matN;
 	double refShearModulus;
@@ -139,7 +139,7 @@ private:
 	T2Vector trialStress;
 	T2Vector currentStrain;
 	T2Vector strainRate;
-	static T2Vector subStrainRate;
+	static thread_local T2Vector subStrainRate;
 
 	void elast2Plast(void);
 	// Called by constructor
@@ -219,12 +219,12 @@ private:
 	double dLoadingFunc;
 	int debugMarks;               // NONclasswide int for debug only
 
-	static T2Vector dCurrentStress;
-	static T2Vector dTrialStress;
-	static T2Vector dCurrentStrain;
-	static T2Vector dSubStrainRate;
-	static T2Vector dStrainRate;
-	static T2Vector dContactStress;
+	static thread_local T2Vector dCurrentStress;
+	static thread_local T2Vector dTrialStress;
+	static thread_local T2Vector dCurrentStrain;
+	static thread_local T2Vector dSubStrainRate;
+	static thread_local T2Vector dStrainRate;
+	static thread_local T2Vector dContactStress;
 
 // uncommitted conditional sensitivity
 	double * dMultiSurfaceCenter;
@@ -243,15 +243,15 @@ private:
 
 //------------- for consistent tangent ----------------
 private:
-	static Matrix dTrialStressdStrain;   //classwide matrix
+	static thread_local Matrix dTrialStressdStrain;   //classwide matrix
 	Matrix consistentTangent;
-	static Matrix dContactStressdStrain;  // classwide matrix
-	static Matrix dSurfaceNormaldStrain;  // classwide matrix
-	static Vector dXdStrain;              // classwide Vector
+	static thread_local Matrix dContactStressdStrain;  // classwide matrix
+	static thread_local Matrix dSurfaceNormaldStrain;  // classwide matrix
+	static thread_local Vector dXdStrain;              // classwide Vector
 
-	static Vector     temp6;          // classwide Vector
-	static Vector     temp;           // classwide Vector
-	static Vector     devia;          // classwide Vector
+	static thread_local Vector     temp6;          // classwide Vector
+	static thread_local Vector     temp;           // classwide Vector
+	static thread_local Vector     devia;          // classwide Vector
 
 
 
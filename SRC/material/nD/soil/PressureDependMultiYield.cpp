@@ -51,11 +51,11 @@ double* PressureDependMultiYield::Hvx=0;
 double* PressureDependMultiYield::Pvx=0;
 
 double PressureDependMultiYield::pAtm = 101.;
-Matrix PressureDependMultiYield::theTangent(6,6);
-T2Vector PressureDependMultiYield::trialStrain;
-T2Vector PressureDependMultiYield::subStrainRate;
-Vector PressureDependMultiYield::workV6(6);
-T2Vector PressureDependMultiYield::workT2V;
+thread_local Matrix PressureDependMultiYield::theTangent(6,6);
+thread_local T2Vector PressureDependMultiYield::trialStrain;
+thread_local T2Vector PressureDependMultiYield::subStrainRate;
+thread_local Vector PressureDependMultiYield::workV6(6);
+thread_local T2Vector PressureDependMultiYield::workT2V;
 
 const	double pi = 3.14159265358979;
 
@@ -650,7 +650,7 @@ PressureDependMultiYield::getTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -710,7 +710,7 @@ PressureDependMultiYield::getInitialTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -814,7 +814,7 @@ PressureDependMultiYield::getStress (void)
   if (ndm==3)
     return trialStress.t2Vector();
   else {
-		static Vector workV(3);
+		thread_local Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -983,7 +983,7 @@ PressureDependMultiYield::sendSelf(int commitTag, Channel &theChannel)
 
   int i, res = 0;
 
-  static ID idData(5);
+  ID idData(5);
   idData(0) = this->getTag();
   idData(1) = numOfSurfaces;
   idData(2) = loadStage;
@@ -1078,7 +1078,7 @@ PressureDependMultiYield::recvSelf(int commitTag, Channel &theChannel,
 {
   int i, res = 0;
 
-  static ID idData(5);
+  ID idData(5);
   res += theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "PressureDependMultiYield::recvelf -- could not recv ID\n";
@@ -1439,7 +1439,7 @@ PressureDependMultiYield::getCommittedStress (void)
   double scale = currentStress.deviatorRatio(residualPress)/committedSurfaces[numOfSurfaces].size();
   if (loadStagex[matN] != 1) scale = 0.;
   if (ndm==3) {
-		static Vector temp7(7);
+		thread_local Vector temp7(7);
 		workV6 = currentStress.t2Vector();
     temp7[0] = workV6[0];
     temp7[1] = workV6[1];
@@ -1452,7 +1452,7 @@ PressureDependMultiYield::getCommittedStress (void)
 	}
 
   else {
-    static Vector temp5(5);
+    thread_local Vector temp5(5);
 		workV6 = currentStress.t2Vector();
     temp5[0] = workV6[0];
     temp5[1] = workV6[1];
@@ -1480,11 +1480,11 @@ PressureDependMultiYield::getStressToRecord (int numOutput)
     if (ndmx[matN] == 0) ndm = 2;
 
   if (ndm==3) {
-	static Vector temp7(7);
+	thread_local Vector temp7(7);
 	temp7 = this->getCommittedStress();
 	if (numOutput == 6)
 	{
-		static Vector temp6(6);
+		thread_local Vector temp6(6);
 		temp6[0] = temp7[0];
 		temp6[1] = temp7[1];
 		temp6[2] = temp7[2];
@@ -1502,18 +1502,18 @@ PressureDependMultiYield::getStressToRecord (int numOutput)
   }
 
   else {
-    static Vector temp5(5);
+    thread_local Vector temp5(5);
 	temp5 = this->getCommittedStress();
 	if (numOutput == 3)
 	{
-		static Vector temp3(3);
+		thread_local Vector temp3(3);
 		temp3[0] = temp5[0];
 		temp3[1] = temp5[1];
 		temp3[2] = temp5[3];
 		return temp3;
 	} else if (numOutput == 4) 
 	{
-		static Vector temp4(4);
+		thread_local Vector temp4(4);
 		temp4[0] = temp5[0];
 		temp4[1] = temp5[1];
 		temp4[2] = temp5[2];
@@ -1539,7 +1539,7 @@ Vector & PressureDependMultiYield::getCommittedStrain (void)
   if (ndm==3)
     return currentStrain.t2Vector(1);
   else {
-		static Vector workV(3);
+		thread_local Vector workV(3);
 		workV6 = currentStrain.t2Vector(1);
     workV[0] = workV6[0];
     workV[1] = workV6[1];
@@ -1716,7 +1716,7 @@ PressureDependMultiYield::deviatorScaling(T2Vector & stress,
   if ( surfaceNum < numOfSurfaces && diff < 0. ) {
     double sz = -surfaces[surfaceNum].size()*coneHeight;
     double deviaSz = sqrt(sz*sz + diff);
-    static Vector devia(6);
+    thread_local Vector devia(6);
     devia = stress.deviator();
     workV6 = devia;
     workV6.addVector(1.0, surfaces[surfaceNum].center(), -coneHeight);
@@ -1746,7 +1746,7 @@ PressureDependMultiYield::initSurfaceUpdate(void)
   if (committedActiveSurf == 0) return;
 
   double coneHeight = - (currentStress.volume() - residualPress);
-  static Vector devia(6);
+  thread_local Vector devia(6);
   devia = currentStress.deviator();
   double Ms = sqrt(3./2.*(devia && devia));
 
@@ -1904,7 +1904,7 @@ PressureDependMultiYield::getContactStress(T2Vector &contactStress)
     double residualPress = residualPressx[matN];
 
   double conHeig = trialStress.volume() - residualPress;
-  static Vector center(6);
+  thread_local Vector center(6);
   center = theSurfaces[activeSurfaceNum].center();
   //workV6 = trialStress.deviator() - center*conHeig;
   workV6 = trialStress.deviator();
@@ -1940,7 +1940,7 @@ PressureDependMultiYield::getSurfaceNormal(const T2Vector & stress, T2Vector &no
 
   double conHeig = stress.volume() - residualPress;
   workV6 = stress.deviator();
-  static Vector center(6);
+  thread_local Vector center(6);
   center = theSurfaces[activeSurfaceNum].center();
   double sz = theSurfaces[activeSurfaceNum].size();
   double volume = conHeig*((center && center) - 2./3.*sz*sz) - (workV6 && center);
@@ -2257,9 +2257,9 @@ PressureDependMultiYield::stressCorrection(int crossedSurface)
     double refShearModulus = refShearModulusx[matN];
 	double refBulkModulus = refBulkModulusx[matN];
 
-  static T2Vector contactStress;
+  thread_local T2Vector contactStress;
   getContactStress(contactStress);
-  static T2Vector surfNormal;
+  thread_local T2Vector surfNormal;
   getSurfaceNormal(contactStress, surfNormal);
   double plasticPotential = getPlasticPotential(contactStress,surfNormal);
   if (plasticPotential==LOCK_VALUE && (onPPZ == -1 || onPPZ == 1)) {
@@ -2311,10 +2311,10 @@ PressureDependMultiYield::updateActiveSurface(void)
   if (activeSurfaceNum == numOfSurfaces) return;
 
   double A, B, C, X;
-  static Vector t1(6);
-  static Vector t2(6);
-  static Vector center(6);
-  static Vector outcenter(6);
+  thread_local Vector t1(6);
+  thread_local Vector t2(6);
+  thread_local Vector center(6);
+  thread_local Vector outcenter(6);
   double conHeig = trialStress.volume() - residualPress;
   center = theSurfaces[activeSurfaceNum].center();
   double size = theSurfaces[activeSurfaceNum].size();
@@ -2386,8 +2386,8 @@ PressureDependMultiYield::updateInnerSurface(void)
     double residualPress = residualPressx[matN];
 
 	if (activeSurfaceNum <= 1) return;
-	static Vector devia(6);
-	static Vector center(6);
+	thread_local Vector devia(6);
+	thread_local Vector center(6);
 
 	double conHeig = currentStress.volume() - residualPress;
 	devia = currentStress.deviator();
@@ -150,7 +150,7 @@ private:
      // internal
      static double* residualPressx;
      static double* stressRatioPTx;
-     static Matrix theTangent;
+     static thread_local Matrix theTangent;
      
 	 int matN;
      int e2p;
@@ -164,7 +164,7 @@ private:
      T2Vector trialStress;
      T2Vector currentStrain;
      T2Vector strainRate;
-     static T2Vector subStrainRate;
+     static thread_local T2Vector subStrainRate;
 
      double pressureD;
      T2Vector reversalStress;
@@ -176,7 +176,7 @@ private:
      double cumuTranslateStrainOcta;
      double prePPZStrainOcta;
      double oppoPrePPZStrainOcta;
-     static T2Vector trialStrain;
+     static thread_local T2Vector trialStrain;
      T2Vector PPZPivot;
      T2Vector PPZCenter;
      T2Vector lockStress;
@@ -193,8 +193,8 @@ private:
      T2Vector PPZPivotCommitted;
      T2Vector PPZCenterCommitted;
      T2Vector lockStressCommitted;
-     static Vector workV6;
-     static T2Vector workT2V;
+     static thread_local Vector workV6;
+     static thread_local T2Vector workT2V;
 	 double maxPress;
      
      void elast2Plast(void);
@@ -158,7 +158,7 @@ private:
      // internal
      static double* residualPressx;
      static double* stressRatioPTx;
-     static Matrix theTangent;
+     static thread_local Matrix theTangent;
      double * mGredu;
 
 	 int matN;
@@ -176,7 +176,7 @@ private:
      T2Vector updatedTrialStress;
      T2Vector currentStrain;
      T2Vector strainRate;
-     static T2Vector subStrainRate;
+     static thread_local T2Vector subStrainRate;
 
      double pressureD;
      int onPPZ; //=-1 never reach PPZ before; =0 below PPZ; =1 on PPZ; =2 above PPZ
@@ -187,7 +187,7 @@ private:
      double cumuTranslateStrainOcta;
      double prePPZStrainOcta;
      double oppoPrePPZStrainOcta;
-     static T2Vector trialStrain;
+     static thread_local T2Vector trialStrain;
      T2Vector PPZPivot;
      T2Vector PPZCenter;
 	 Vector PivotStrainRate;
@@ -203,8 +203,8 @@ private:
      T2Vector PPZPivotCommitted;
      T2Vector PPZCenterCommitted;
 	 Vector PivotStrainRateCommitted;
-     static Vector workV6;
-     static T2Vector workT2V;
+     static thread_local Vector workV6;
+     static thread_local T2Vector workT2V;
 	 double maxPress;
 
      void elast2Plast(void);
@@ -58,11 +58,11 @@ double* PressureDependMultiYield03::Pvx=0;
 
 double PressureDependMultiYield03::pAtm = 101.;
 
-Matrix PressureDependMultiYield03::theTangent(6,6);
-T2Vector PressureDependMultiYield03::trialStrain;
-T2Vector PressureDependMultiYield03::subStrainRate;
-Vector PressureDependMultiYield03::workV6(6);
-T2Vector PressureDependMultiYield03::workT2V;
+thread_local Matrix PressureDependMultiYield03::theTangent(6,6);
+thread_local T2Vector PressureDependMultiYield03::trialStrain;
+thread_local T2Vector PressureDependMultiYield03::subStrainRate;
+thread_local Vector PressureDependMultiYield03::workV6(6);
+thread_local T2Vector PressureDependMultiYield03::workT2V;
 const	double pi = 3.14159265358979;
 
 void * OPS_ADD_RUNTIME_VPV(OPS_PressureDependMultiYield03)
@@ -745,7 +745,7 @@ const Matrix & PressureDependMultiYield03::getTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -815,7 +815,7 @@ const Matrix & PressureDependMultiYield03::getInitialTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -935,7 +935,7 @@ const Vector & PressureDependMultiYield03::getStress (void)
   if (ndm==3)
     return trialStress.t2Vector();
   else {
-	static Vector workV(3);
+	thread_local Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -1136,7 +1136,7 @@ int PressureDependMultiYield03::sendSelf(int commitTag, Channel &theChannel)
 
   int i, res = 0;
 
-  static ID idData(6);
+  ID idData(6);
   idData(0) = this->getTag();
   idData(1) = numOfSurfaces;
   idData(2) = loadStage;
@@ -1236,7 +1236,7 @@ int PressureDependMultiYield03::recvSelf(int commitTag, Channel &theChannel,
 {
   int i, res = 0;
 
-  static ID idData(6);
+  ID idData(6);
   res += theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "PressureDependMultiYield03::recvelf -- could not recv ID\n";
@@ -1635,7 +1635,7 @@ const Vector & PressureDependMultiYield03::getCommittedStress (void)
 	double scale = currentStress.deviatorRatio(residualPress)/committedSurfaces[numOfSurfaces].size();
 	if (loadStagex[matN] != 1) scale = 0.;
   if (ndm==3) {
-		static Vector temp7(7);
+		thread_local Vector temp7(7);
 		workV6 = currentStress.t2Vector();
     temp7[0] = workV6[0];
     temp7[1] = workV6[1];
@@ -1657,7 +1657,7 @@ const Vector & PressureDependMultiYield03::getCommittedStress (void)
 	}
 
   else {
-    static Vector temp5(5);
+    thread_local Vector temp5(5);
 	workV6 = currentStress.t2Vector();
     temp5[0] = workV6[0];
     temp5[1] = workV6[1];
@@ -1687,11 +1687,11 @@ PressureDependMultiYield03::getStressToRecord (int numOutput)
     if (ndmx[matN] == 0) ndm = 2;
 
   if (ndm==3) {
-	static Vector temp7(7);
+	thread_local Vector temp7(7);
 	temp7 = this->getCommittedStress();
 	if (numOutput == 6)
 	{
-		static Vector temp6(6);
+		thread_local Vector temp6(6);
 		temp6[0] = temp7[0];
 		temp6[1] = temp7[1];
 		temp6[2] = temp7[2];
@@ -1709,18 +1709,18 @@ PressureDependMultiYield03::getStressToRecord (int numOutput)
   }
 
   else {
-    static Vector temp5(5);
+    thread_local Vector temp5(5);
 	temp5 = this->getCommittedStress();
 	if (numOutput == 3)
 	{
-		static Vector temp3(3);
+		thread_local Vector temp3(3);
 		temp3[0] = temp5[0];
 		temp3[1] = temp5[1];
 		temp3[2] = temp5[3];
 		return temp3;
 	} else if (numOutput == 4) 
 	{
-		static Vector temp4(4);
+		thread_local Vector temp4(4);
 		temp4[0] = temp5[0];
 		temp4[1] = temp5[1];
 		temp4[2] = temp5[2];
@@ -1745,7 +1745,7 @@ const Vector & PressureDependMultiYield03::getCommittedStrain (void)
   if (ndm==3)
     return currentStrain.t2Vector(1);
   else {
-		static Vector workV(3);
+		thread_local Vector workV(3);
 		workV6 = currentStrain.t2Vector(1);
     workV[0] = workV6[0];
     workV[1] = workV6[1];
@@ -1942,7 +1942,7 @@ void PressureDependMultiYield03::deviatorScaling(T2Vector & stress,
   if ( surfaceNum < numOfSurfaces && diff < 0. ) {
     double sz = -surfaces[surfaceNum].size()*coneHeight;
     double deviaSz = sqrt(sz*sz + diff);
-    static Vector devia(6);
+    thread_local Vector devia(6);
     devia = stress.deviator();
     workV6 = devia;
     workV6.addVector(1.0, surfaces[surfaceNum].center(), -coneHeight);
@@ -1972,7 +1972,7 @@ void PressureDependMultiYield03::initSurfaceUpdate(void)
   if (committedActiveSurf == 0) return;
 
   double coneHeight = - (currentStress.volume() - residualPress);
-  static Vector devia(6);
+  thread_local Vector devia(6);
   devia = currentStress.deviator();
   double Ms = sqrt(3./2.*(devia && devia));
 
@@ -2133,7 +2133,7 @@ PressureDependMultiYield03::getContactStress(T2Vector &contactStress)
     double residualPress = residualPressx[matN];
 
   double conHeig = trialStress.volume() - residualPress;
-  static Vector center(6);
+  thread_local Vector center(6);
   center = theSurfaces[activeSurfaceNum].center();
   //workV6 = trialStress.deviator() - center*conHeig;
   workV6 = trialStress.deviator();
@@ -2170,7 +2170,7 @@ PressureDependMultiYield03::getSurfaceNormal(const T2Vector & stress, T2Vector &
 
   double conHeig = stress.volume() - residualPress;
   workV6 = stress.deviator();
-  static Vector center(6);
+  thread_local Vector center(6);
   center = theSurfaces[activeSurfaceNum].center();
   double sz = theSurfaces[activeSurfaceNum].size();
   double volume = conHeig*((center && center) - 2./3.*sz*sz) - (workV6 && center);
@@ -2269,7 +2269,7 @@ double PressureDependMultiYield03::ContractionFactorC(void)
 	double ce = contractParam5x[matN];
 
 	// Start - by Arash K.
-	static Vector stress0 = currentStress.t2Vector();
+	thread_local Vector stress0 = currentStress.t2Vector();
 	double sig110 = stress0[0];
 	double sig220 = stress0[1];
 	double sig330 = stress0[2];
@@ -2562,9 +2562,9 @@ int PressureDependMultiYield03::stressCorrection(int crossedSurface)
     double refShearModulus = refShearModulusx[matN];
 	double refBulkModulus = refBulkModulusx[matN];
 
-  static T2Vector contactStress;
+  thread_local T2Vector contactStress;
   getContactStress(contactStress);
-  static T2Vector surfNormal;
+  thread_local T2Vector surfNormal;
   getSurfaceNormal(contactStress, surfNormal);
   double plasticPotential = getPlasticPotential(contactStress,surfNormal);
   double tVolume = trialStress.volume();
@@ -2612,10 +2612,10 @@ void PressureDependMultiYield03::updateActiveSurface(void)
   if (activeSurfaceNum == numOfSurfaces) return;
 
   double A, B, C, X;
-  static Vector t1(6);
-  static Vector t2(6);
-  static Vector center(6);
-  static Vector outcenter(6);
+  thread_local Vector t1(6);
+  thread_local Vector t2(6);
+  thread_local Vector center(6);
+  thread_local Vector outcenter(6);
   double conHeig = trialStress.volume() - residualPress;
   center = theSurfaces[activeSurfaceNum].center();
   double size = theSurfaces[activeSurfaceNum].size();
@@ -2687,8 +2687,8 @@ void PressureDependMultiYield03::updateInnerSurface(void)
     double residualPress = residualPressx[matN];
 
 	if (activeSurfaceNum <= 1) return;
-	static Vector devia(6);
-	static Vector center(6);
+	thread_local Vector devia(6);
+	thread_local Vector center(6);
 
 	double conHeig = currentStress.volume() - residualPress;
 	devia = currentStress.deviator();
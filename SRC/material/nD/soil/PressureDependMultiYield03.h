@@ -159,7 +159,7 @@ private:
      // internal
      static double* residualPressx;
      static double* stressRatioPTx;
-     static Matrix theTangent;
+     static thread_local Matrix theTangent;
      double * mGredu;
 
 	 int matN;
@@ -177,7 +177,7 @@ private:
      T2Vector updatedTrialStress;
      T2Vector currentStrain;
      T2Vector strainRate;
-     static T2Vector subStrainRate;
+     static thread_local T2Vector subStrainRate;
 
      double pressureD;
      int onPPZ; //=-1 never reach PPZ before; =0 below PPZ; =1 on PPZ; =2 above PPZ
@@ -188,7 +188,7 @@ private:
      double cumuTranslateStrainOcta;
      double prePPZStrainOcta;
      double oppoPrePPZStrainOcta;
-     static T2Vector trialStrain;
+     static thread_local T2Vector trialStrain;
      T2Vector PPZPivot;
      T2Vector PPZCenter;
 	 Vector PivotStrainRate;
@@ -204,8 +204,8 @@ private:
      T2Vector PPZPivotCommitted;
      T2Vector PPZCenterCommitted;
 	 Vector PivotStrainRateCommitted;
-     static Vector workV6;
-     static T2Vector workT2V;
+     static thread_local Vector workV6;
+     static thread_local T2Vector workT2V;
 	 double maxPress;
 
      void elast2Plast(void);
@@ -18,8 +18,8 @@
 #include <MultiYieldSurface.h>
 
 
-Matrix PressureIndependMultiYield::theTangent(6,6);
-T2Vector PressureIndependMultiYield::subStrainRate;
+thread_local Matrix PressureIndependMultiYield::theTangent(6,6);
+thread_local T2Vector PressureIndependMultiYield::subStrainRate;
 int     PressureIndependMultiYield::matCount=0;
 int*    PressureIndependMultiYield::loadStagex=0;  //=0 if elastic; =1 if plastic
 int*    PressureIndependMultiYield::ndmx=0;        //num of dimensions (2 or 3)
@@ -323,7 +323,7 @@ int PressureIndependMultiYield::setTrialStrain (const Vector &strain)
   int ndm = ndmx[matN];
   if (ndmx[matN] == 0) ndm = 2;
 
-  static Vector temp(6);
+  thread_local Vector temp(6);
   if (ndm==3 && strain.Size()==6)
     temp = strain;
   else if (ndm==2 && strain.Size()==3) {
@@ -359,7 +359,7 @@ int PressureIndependMultiYield::setTrialStrainIncr (const Vector &strain)
   int ndm = ndmx[matN];
   if (ndmx[matN] == 0) ndm = 2;
 
-  static Vector temp(6);
+  thread_local Vector temp(6);
   if (ndm==3 && strain.Size()==6)
     temp = strain;
   else if (ndm==2 && strain.Size()==3) {
@@ -404,7 +404,7 @@ const Matrix & PressureIndependMultiYield::getTangent (void)
   }
   else {
     double coeff;
-    static Vector devia(6);
+    thread_local Vector devia(6);
 
     /*if (committedActiveSurf > 0) {
       //devia = currentStress.deviator()-committedSurfaces[committedActiveSurf].center();
@@ -439,7 +439,7 @@ const Matrix & PressureIndependMultiYield::getTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -470,7 +470,7 @@ const Matrix & PressureIndependMultiYield::getInitialTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    thread_local Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = theTangent(0,3);
@@ -498,7 +498,7 @@ const Vector & PressureIndependMultiYield::getStress (void)
   if (loadStage!=1) {  //linear elastic
     //trialStrain.setData(currentStrain.t2Vector() + strainRate.t2Vector());
     getTangent();
-    static Vector a(6);
+    thread_local Vector a(6);
     a = currentStress.t2Vector();
 	a.addMatrixVector(1.0, theTangent, strainRate.t2Vector(1), 1.0);
     trialStress.setData(a);
@@ -535,7 +535,7 @@ const Vector & PressureIndependMultiYield::getStress (void)
   if (ndm==3)
     return trialStress.t2Vector();
   else {
-    static Vector workV(3);
+    thread_local Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -558,7 +558,7 @@ int PressureIndependMultiYield::commitState (void)
   currentStress = trialStress;
 
   //currentStrain = T2Vector(currentStrain.t2Vector() + strainRate.t2Vector());
-  static Vector temp(6);
+  thread_local Vector temp(6);
   temp = currentStrain.t2Vector();
   temp += strainRate.t2Vector();
   currentStrain.setData(temp);
@@ -688,7 +688,7 @@ int PressureIndependMultiYield::sendSelf(int commitTag, Channel &theChannel)
 
   int i, res = 0;
 
-  static ID idData(6);
+  ID idData(6);
   idData(0) = this->getTag();
   idData(1) = numOfSurfaces;
   idData(2) = loadStage;
@@ -703,7 +703,7 @@ int PressureIndependMultiYield::sendSelf(int commitTag, Channel &theChannel)
   }
 
   Vector data(24+numOfSurfaces*8);
-  static Vector temp(6);
+  Vector temp(6);
   data(0) = rho;
   data(1) = refShearModulus;
   data(2) = refBulkModulus;
@@ -751,7 +751,7 @@ int PressureIndependMultiYield::recvSelf(int commitTag, Channel &theChannel,
 {
   int i, res = 0;
 
-  static ID idData(6);
+  ID idData(6);
 
   res += theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
@@ -768,7 +768,7 @@ int PressureIndependMultiYield::recvSelf(int commitTag, Channel &theChannel,
   int matCountSendSide = idData(5);
 
   Vector data(24+idData(1)*8);
-  static Vector temp(6);
+  Vector temp(6);
 
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -899,7 +899,7 @@ PressureIndependMultiYield::setResponse (const char **argv, int argc, OPS_Stream
 
   else if (strcmp(argv[0],"backbone") == 0) {
     int numOfSurfaces = numOfSurfacesx[matN];
-    static Matrix curv(numOfSurfaces+1,(argc-1)*2);
+    thread_local Matrix curv(numOfSurfaces+1,(argc-1)*2);
     for (int i=1; i<argc; i++)
       curv(0,(i-1)*2) = atoi(argv[i]);
     return new MaterialResponse(this, 4, curv);
@@ -1018,7 +1018,7 @@ const Vector & PressureIndependMultiYield::getCommittedStress (void)
 	double scale = sqrt(3./2.)*currentStress.deviatorLength()/committedSurfaces[numOfSurfaces].size();
 	if (loadStagex[matN] != 1) scale = 0.;
 	if (ndm==3) {
-		static Vector temp7(7), temp6(6);
+		thread_local Vector temp7(7), temp6(6);
 		temp6 = currentStress.t2Vector();
         temp7[0] = temp6[0];
         temp7[1] = temp6[1];
@@ -1030,7 +1030,7 @@ const Vector & PressureIndependMultiYield::getCommittedStress (void)
 	    return temp7;
 	}
     else {
-        static Vector temp5(5), temp6(6);
+        thread_local Vector temp5(5), temp6(6);
 		temp6 = currentStress.t2Vector();
         temp5[0] = temp6[0];
         temp5[1] = temp6[1];
@@ -1048,11 +1048,11 @@ const Vector & PressureIndependMultiYield::getStressToRecord (int numOutput)
     if (ndmx[matN] == 0) ndm = 2;
 
   if (ndm==3) {
-	static Vector temp7(7);
+	thread_local Vector temp7(7);
 	temp7 = this->getCommittedStress();
 	if (numOutput == 6)
 	{
-		static Vector temp6(6);
+		thread_local Vector temp6(6);
 		temp6[0] = temp7[0];
 		temp6[1] = temp7[1];
 		temp6[2] = temp7[2];
@@ -1070,18 +1070,18 @@ const Vector & PressureIndependMultiYield::getStressToRecord (int numOutput)
   }
 
   else {
-    static Vector temp5(5);
+    thread_local Vector temp5(5);
 	temp5 = this->getCommittedStress();
 	if (numOutput == 3)
 	{
-		static Vector temp3(3);
+		thread_local Vector temp3(3);
 		temp3[0] = temp5[0];
 		temp3[1] = temp5[1];
 		temp3[2] = temp5[3];
 		return temp3;
 	} else if (numOutput == 4) 
 	{
-		static Vector temp4(4);
+		thread_local Vector temp4(4);
 		temp4[0] = temp5[0];
 		temp4[1] = temp5[1];
 		temp4[2] = temp5[2];
@@ -1106,7 +1106,7 @@ const Vector & PressureIndependMultiYield::getCommittedStrain (void)
   if (ndm==3)
     return currentStrain.t2Vector(1);
   else {
-    static Vector workV(3), temp6(6);
+    thread_local Vector workV(3), temp6(6);
 		temp6 = currentStrain.t2Vector(1);
     workV[0] = temp6[0];
     workV[1] = temp6[1];
@@ -1170,7 +1170,7 @@ void PressureIndependMultiYield::setUpSurfaces (double * gredu)
 			if (plast_modul > UP_LIMIT) plast_modul = UP_LIMIT;
 			if (ii==numOfSurfaces) plast_modul = 0;
 
-			static Vector temp(6);
+			thread_local Vector temp(6);
 			committedSurfaces[ii] = MultiYieldSurface(temp,size,plast_modul);
 		}  // ii
 	}
@@ -1232,7 +1232,7 @@ void PressureIndependMultiYield::setUpSurfaces (double * gredu)
 			}
 			if (plast_modul > UP_LIMIT) plast_modul = UP_LIMIT;
 
-			static Vector temp(6);
+			thread_local Vector temp(6);
 			committedSurfaces[i] = MultiYieldSurface(temp,size,plast_modul);
 
 			if (i==(numOfSurfaces-1)) {
@@ -1252,7 +1252,7 @@ void PressureIndependMultiYield::setUpSurfaces (double * gredu)
 double PressureIndependMultiYield::yieldFunc(const T2Vector & stress,
 											 const MultiYieldSurface * surfaces, int surfaceNum)
 {
-	static Vector temp(6);
+	thread_local Vector temp(6);
 	//temp = stress.deviator() - surfaces[surfaceNum].center();
 	temp = stress.deviator();
 	temp -= surfaces[surfaceNum].center();
@@ -1273,9 +1273,9 @@ void PressureIndependMultiYield::deviatorScaling(T2Vector & stress, const MultiY
 	if ( surfaceNum < numOfSurfaces && diff < 0. ) {
 		double sz = surfaces[surfaceNum].size();
 		double deviaSz = sqrt(sz*sz + diff);
-		static Vector devia(6);
+		thread_local Vector devia(6);
 		devia = stress.deviator();
-		static Vector temp(6);
+		thread_local Vector temp(6);
 		temp = devia - surfaces[surfaceNum].center();
 		double coeff = (sz-deviaSz) / deviaSz;
 		if (coeff < 1.e-13) coeff = 1.e-13;
@@ -1286,7 +1286,7 @@ void PressureIndependMultiYield::deviatorScaling(T2Vector & stress, const MultiY
 
 	if (surfaceNum==numOfSurfaces && fabs(diff) > LOW_LIMIT) {
 		double sz = surfaces[surfaceNum].size();
-		static Vector newDevia(6);
+		thread_local Vector newDevia(6);
 		newDevia.addVector(0.0, stress.deviator(), sz/sqrt(diff+sz*sz));
 		stress.setData(newDevia, stress.volume());
 	}
@@ -1299,10 +1299,10 @@ void PressureIndependMultiYield::initSurfaceUpdate()
 
 	int numOfSurfaces = numOfSurfacesx[matN];
 
-	static Vector devia(6);
+	thread_local Vector devia(6);
 	devia = currentStress.deviator();
 	double Ms = sqrt(3./2.*(devia && devia));
-	static Vector newCenter(6);
+	thread_local Vector newCenter(6);
 
 	if (committedActiveSurf < numOfSurfaces) { // failure surface can't move
 		//newCenter = devia * (1. - committedSurfaces[activeSurfaceNum].size() / Ms);
@@ -1335,7 +1335,7 @@ void PressureIndependMultiYield::paramScaling(void)
    	refBulkModulus *= scale;
 
 	double plastModul, size;
-	static Vector temp(6);
+	thread_local Vector temp(6);
 	for (int i=1; i<=numOfSurfaces; i++) {
 	  plastModul = committedSurfaces[i].modulus() * scale;
 	  size = committedSurfaces[i].size() * conHeig;
@@ -1347,7 +1347,7 @@ void PressureIndependMultiYield::paramScaling(void)
 
 void PressureIndependMultiYield::setTrialStress(T2Vector & stress)
 {
-  static Vector devia(6);
+  thread_local Vector devia(6);
   //devia = stress.deviator() + subStrainRate.deviator()*2.*refShearModulus;
   devia = stress.deviator();
   devia.addVector(1.0, subStrainRate.deviator(), 2.*refShearModulus);
@@ -1373,11 +1373,11 @@ int PressureIndependMultiYield::setSubStrainRate(void)
 	  elast_plast_modulus = 2*refShearModulus*plast_modulus
 	    / (2*refShearModulus+plast_modulus);
 	}
-	static Vector incre(6);
+	thread_local Vector incre(6);
 	//incre = strainRate.deviator()*elast_plast_modulus;
 	incre.addVector(0.0, strainRate.deviator(),elast_plast_modulus);
 
-	static T2Vector increStress;
+	thread_local T2Vector increStress;
 	increStress.setData(incre, 0);
 	double singleCross = theSurfaces[numOfSurfaces].size() / numOfSurfaces;
 	double totalCross = 3.*increStress.octahedralShear() / sqrt(2.);
@@ -1395,9 +1395,9 @@ int PressureIndependMultiYield::setSubStrainRate(void)
 void
 PressureIndependMultiYield::getContactStress(T2Vector &contactStress)
 {
-	static Vector center(6);
+	thread_local Vector center(6);
 	center = theSurfaces[activeSurfaceNum].center();
-	static Vector devia(6);
+	thread_local Vector devia(6);
 	//devia = trialStress.deviator() - center;
 	devia = trialStress.deviator();
 	devia -= center;
@@ -1415,12 +1415,12 @@ int PressureIndependMultiYield::isLoadReversal(void)
 {
   if(activeSurfaceNum == 0) return 0;
 
-  static Vector surfaceNormal(6);
+  thread_local Vector surfaceNormal(6);
   getSurfaceNormal(currentStress, surfaceNormal);
 
   //(((trialStress.deviator() - currentStress.deviator()) && surfaceNormal) < 0)
   // return 1;
-  static Vector a(6);
+  thread_local Vector a(6);
   a = trialStress.deviator();
   a-= currentStress.deviator();
   if((a && surfaceNormal) < 0)
@@ -1452,7 +1452,7 @@ double PressureIndependMultiYield::getLoadingFunc(const T2Vector & contactStress
   //for crossing first surface
   double temp = temp1 + temp2;
   //loadingFunc = (surfaceNormal && (trialStress.deviator()-contactStress.deviator()))/temp;
-  static Vector tmp(6);
+  thread_local Vector tmp(6);
   tmp =trialStress.deviator();
   tmp -= contactStress.deviator();
   loadingFunc = (surfaceNormal && tmp)/temp;
@@ -1468,12 +1468,12 @@ double PressureIndependMultiYield::getLoadingFunc(const T2Vector & contactStress
 
 void PressureIndependMultiYield::stressCorrection(int crossedSurface)
 {
-	static T2Vector contactStress;
+	thread_local T2Vector contactStress;
 	this->getContactStress(contactStress);
-	static Vector surfaceNormal(6);
+	thread_local Vector surfaceNormal(6);
 	this->getSurfaceNormal(contactStress, surfaceNormal);
 	double loadingFunc = getLoadingFunc(contactStress, surfaceNormal, crossedSurface);
-	static Vector devia(6);
+	thread_local Vector devia(6);
 
 	//devia = trialStress.deviator() - surfaceNormal * 2 * refShearModulus * loadingFunc;
 	devia.addVector(0.0, surfaceNormal, -2*refShearModulus*loadingFunc);
@@ -1496,14 +1496,14 @@ void PressureIndependMultiYield::updateActiveSurface(void)
   if (activeSurfaceNum == numOfSurfaces) return;
 
 	double A, B, C, X;
-	static T2Vector direction;
-	static Vector t1(6);
-	static Vector t2(6);
-	static Vector temp(6);
-	static Vector center(6);
+	thread_local T2Vector direction;
+	thread_local Vector t1(6);
+	thread_local Vector t2(6);
+	thread_local Vector temp(6);
+	thread_local Vector center(6);
 	center = theSurfaces[activeSurfaceNum].center();
 	double size = theSurfaces[activeSurfaceNum].size();
-	static Vector outcenter(6);
+	thread_local Vector outcenter(6);
 	outcenter= theSurfaces[activeSurfaceNum+1].center();
 	double outsize = theSurfaces[activeSurfaceNum+1].size();
 
@@ -1568,12 +1568,12 @@ void PressureIndependMultiYield::updateInnerSurface(void)
 {
 	if (activeSurfaceNum <= 1) return;
 
-	static Vector devia(6);
+	thread_local Vector devia(6);
 	devia = currentStress.deviator();
-	static Vector center(6);
+	thread_local Vector center(6);
 	center = theSurfaces[activeSurfaceNum].center();
 	double size = theSurfaces[activeSurfaceNum].size();
-	static Vector newcenter(6);
+	thread_local Vector newcenter(6);
 
 	for (int i=1; i<activeSurfaceNum; i++) {
 		//newcenter = devia - (devia - center) * theSurfaces[i].size() / size;
@@ -122,7 +122,7 @@ private:
 
 	// internal
 	static double* residualPressx;
-	static Matrix theTangent;  //classwise member
+	static thread_local Matrix theTangent;  //classwise member
 	int e2p;
 	int matN;
 	double refShearModulus;
@@ -135,7 +135,7 @@ private:
 	T2Vector trialStress;
 	T2Vector currentStrain;
 	T2Vector strainRate;
-	static T2Vector subStrainRate;
+	static thread_local T2Vector subStrainRate;
     double * mGredu;
 
 	void elast2Plast(void);
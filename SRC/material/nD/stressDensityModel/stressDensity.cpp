@@ -274,7 +274,7 @@ int
 stressDensity::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
-    static Vector vData(798);
+    Vector vData(798);
 
     vData(0)  = this->getTag();
     vData(1)  = theStage;
@@ -347,7 +347,7 @@ stressDensity::recvSelf(int commitTag, Channel &theChannel,FEM_ObjectBroker &the
     int res = 0;
 
     // place data in a vector
-    static Vector vData(798);
+    Vector vData(798);
 
 	res = theChannel.recvVector(this->getDbTag(), commitTag, vData);
 	if (res < 0) {
@@ -294,7 +294,7 @@ PlasticMaterial<n,type,index>::plastic_integrator()
 
   norm_tau = std::sqrt(norm_tau);
 
-  static Matrix3D normal; // normal to yield surface
+  thread_local Matrix3D normal; // normal to yield surface
   if (norm_tau > tolerance) {
     inv_norm_tau = 1.0 / norm_tau;
     normal       = inv_norm_tau * dev_stress;
@@ -572,7 +572,7 @@ PlasticMaterial<n,type,index>::sendSelf(int commitTag, Channel& theChannel)
 {
   // place all the data needed to define material and it's state
   // int a vector object
-  static Vector data(10 + 9);
+  Vector data(10 + 9);
   int cnt     = 0;
   data(cnt++) = this->getTag();
   data(cnt++) = bulk;
@@ -606,7 +606,7 @@ int
 PlasticMaterial<n,type,index>::recvSelf(int commitTag, Channel& theChannel, FEM_ObjectBroker& theBroker)
 {
   // recv the vector object from the channel which defines material param and state
-  static Vector data(10 + 9);
+  Vector data(10 + 9);
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "PlasticMaterial<n,type,index>::recvSelf - failed to recv vector from channel\n";
     return -1;
@@ -48,6 +48,7 @@
 #include <iomanip>
 #include <vector>
 #include <array>
+#include <algorithm>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -70,6 +71,7 @@ void ASDCoupledHinge3DDomainData::setValue(int i, int j, int k, double val)
 {
     int idx = i * (numberTheta * numberData) + k * numberTheta + j;
     theVector(idx) = val;
+    indexed = false;
 }
 
 void ASDCoupledHinge3DDomainData::getRangeN(double& Nmin, double& Nmax)
@@ -98,194 +100,196 @@ void ASDCoupledHinge3DDomainData::print(void)
     }
 }
 
+void ASDCoupledHinge3DDomainData::buildIndex(void)
+{
+    sliceN.resize(numberAxial);
+    for (int i = 0; i < numberAxial; i++)
+        sliceN[i] = this->getValue(i, 0, 0);
+
+    // The directions can be searched by bisection if the points of every
+    // slice turn once around the origin, all in the same sense. Slices with
+    // all points at the origin (at Nmin and Nmax) do not count.
+    sense = 0;
+    bool monotone = true;
+    for (int i = 0; (i < numberAxial) && monotone; i++)
+    {
+        int atOrigin = 0;
+        for (int j = 0; j < numberTheta; j++)
+            if ((this->getValue(i, j, 1) == 0.0) && (this->getValue(i, j, 2) == 0.0))
+                atOrigin++;
+        if (atOrigin == numberTheta)
+            continue;
+        if (atOrigin > 0) {
+            monotone = false;
+            break;
+        }
+
+        int sliceSense = 0;
+        double turn = 0.0;
+        for (int j = 0; j < numberTheta; j++)
+        {
+            int jp1 = (j + 1) % numberTheta;
+            double y0 = this->getValue(i, j, 1);
+            double z0 = this->getValue(i, j, 2);
+            double y1 = this->getValue(i, jp1, 1);
+            double z1 = this->getValue(i, jp1, 2);
+            double step = atan2(y0 * z1 - z0 * y1, y0 * y1 + z0 * z1);
+            int stepSense = step > 0.0 ? 1 : (step < 0.0 ? -1 : 0);
+            if ((stepSense == 0) || (sliceSense != 0 && stepSense != sliceSense)) {
+                monotone = false;
+                break;
+            }
+            sliceSense = stepSense;
+            turn += step;
+        }
+        if (!monotone || (std::abs(std::abs(turn) - 2 * M_PI) > 1.0e-6) || (sense != 0 && sliceSense != sense)) {
+            monotone = false;
+            break;
+        }
+        sense = sliceSense;
+    }
+    if (!monotone)
+        sense = 0;
+
+    cachedSlice = -1;
+    cachedSector[0] = cachedSector[1] = -1;
+    nextSector = 0;
+    indexed = true;
+}
+
+void ASDCoupledHinge3DDomainData::interpolate(int j, double& My, double& Mz)
+{
+    // point j of the domain at cachedN, between slices cachedSlice and cachedSlice + 1
+    int i1 = cachedSlice;
+    int i2 = cachedSlice + 1;
+    double N1 = sliceN[i1];
+    double N2 = sliceN[i2];
+    double My1 = this->getValue(i1, j, 1);
+    double My2 = this->getValue(i2, j, 1);
+    My = (My2 - My1) / (N2 - N1) * (cachedN - N1) + My1;
+    double Mz1 = this->getValue(i1, j, 2);
+    double Mz2 = this->getValue(i2, j, 2);
+    Mz = (Mz2 - Mz1) / (N2 - N1) * (cachedN - N1) + Mz1;
+}
+
+bool ASDCoupledHinge3DDomainData::intersect(int j, double dy, double dz, double& My, double& Mz)
+{
+    int jp1 = j + 1;
+    if (jp1 >= numberTheta) jp1 = 0;
+
+    double My_j, Mz_j, My_jp1, Mz_jp1;
+    this->interpolate(j, My_j, Mz_j);
+    this->interpolate(jp1, My_jp1, Mz_jp1);
+
+    double norm_j = sqrt(My_j * My_j + Mz_j * Mz_j);
+    double norm_jp1 = sqrt(My_jp1 * My_jp1 + Mz_jp1 * Mz_jp1);
+    double dir_j[2] = { My_j / norm_j, Mz_j / norm_j };
+    double dir_jp1[2] = { My_jp1 / norm_jp1, Mz_jp1 / norm_jp1 };
+
+    double jXjp1 = dir_j[0] * dir_jp1[1] - dir_j[1] * dir_jp1[0];
+    double jXdirection = dir_j[0] * dz - dir_j[1] * dy;
+    double directionXjp1 = dy * dir_jp1[1] - dz * dir_jp1[0];
+    if (!((jXjp1 * jXdirection >= 0) && (directionXjp1 * jXjp1 >= 0)))
+        return false;
+
+    double alfa = jXdirection / jXjp1;
+    double beta = directionXjp1 / jXjp1;
+    double sum = alfa + beta;
+    alfa /= sum;
+    beta /= sum;
+    My = My_j * beta + My_jp1 * alfa;
+    Mz = Mz_j * beta + Mz_jp1 * alfa;
+    return true;
+}
+
 int ASDCoupledHinge3DDomainData::getMyMzForNAndDirection(double N, double theta, double& My, double& Mz) {
+    if (!indexed)
+        this->buildIndex();
+
     // transform theta in the range [0, 2pi[
     while (theta > 2 * M_PI)
         theta -= 2 * M_PI;
-    Vector direction(2);
-    direction(0) = cos(theta);
-    direction(1) = sin(theta);
+    double dy = cos(theta);
+    double dz = sin(theta);
 
-    // Find N first
-    int i = 0;
-    bool found = false;
 #ifdef _DBG_COUPLEDSEC3D
     opserr << "\n\ngetMyMzForNAndDirection: \n"
         "N = " << N << "\n"
         "theta = " << theta << "\n"
-        "direction = [" << direction(0) << ", " << direction(1) << "]\n";
-    opserr << "First check within the limits: " << this->getValue(0, 0, 0) << " and " << this->getValue(numberAxial - 1, 0, 0) << "\n";
+        "direction = [" << dy << ", " << dz << "]\n";
 #endif
 
-    if ((N <= this->getValue(0, 0, 0)) || (N >= this->getValue(numberAxial - 1, 0, 0))) 
+    if ((N <= sliceN.front()) || (N >= sliceN.back()))
     {
         // N is greater than Nmax or lower than Nmin -> return 0
-#ifdef _DBG_COUPLEDSEC3D
-        opserr << "N = " << N << " is greater than " << this->getValue(numberAxial - 1, 0, 0) << " or lower than " << this->getValue(0, 0, 0) << "\n";
-#endif
         My = 0;
         Mz = 0;
         return 0;
     }
-    while ((!found) && (i < numberAxial)) 
-    {
-        if (this->getValue(i, 0, 0) > N) 
-            found = true;
-        i += 1;
-    }
 
-    if (found) 
+    // Find the slices around N, unless N is the one of the last query
+    if ((cachedSlice < 0) || (N != cachedN))
     {
-#ifdef _DBG_COUPLEDSEC3D
-        opserr << "N = " << N << " found checking the domain\n";
-#endif
-    }
-    else 
-    {
-        opserr << "Not possible to find N during interpolation. An errror occurred\n";
-        return -1;
+        cachedSlice = int(std::upper_bound(sliceN.begin(), sliceN.end(), N) - sliceN.begin()) - 1;
+        cachedN = N;
     }
 
-    int i1 = i - 2;
-    int i2 = i - 1;
-
-    double N1 = this->getValue(i1, 0, 0);
-    double N2 = this->getValue(i2, 0, 0);
-
-#ifdef _DBG_COUPLEDSEC3D
-    opserr << "N = " << N << " between " << i1 << " and " << i2 << " with N1 = " << N1 << " and N2 = " << N2 << "\n";
-#endif
-
-    //opserr << "found N between " << N1 << "(" << i1 << ") and " << N2 << "(" << i2 << ")\n";
-    //opserr << "My-Mz domain for N1:\n";
-    //for (int k = 0; k < numberTheta; k++) {
-    //    opserr << "(" << this->getValue(i1, k, 1) << ", " << this->getValue(i1, k, 2) << ") ";
-    //}
-    //opserr << "\n";
-
-    // Find My and Mz for given "theta"
-    double My1_j, My2_j, My_j, Mz1_j, Mz2_j, Mz_j;
-    double My1_jp1, My2_jp1, My_jp1, Mz1_jp1, Mz2_jp1, Mz_jp1;
-    found = false;
-    double theta_j = 0;
-    double theta_jp1 = 0;
-    Vector dir_j(2);
-    Vector dir_jp1(2);
+    // Find the sector j, j+1 of the domain at N that holds the direction.
+    // If the points of every slice turn once around the origin a direction
+    // crosses a single sector: try the sectors of the last queries first,
+    // then bisect on the angles of the points. Otherwise, and if that fails,
+    // take the first sector of a scan as the unindexed lookup does
     int j = -1;
-    int jp1 = 0;
-    int inverse = 0;
-    double jXjp1, jXdirection, directionXjp1;
-    while ((!found) && (j < numberTheta)) 
-    { 
-        j += 1;
-        jp1 += 1;
-        if (jp1 >= numberTheta) jp1 = 0;
-        //opserr << "j = " << j << " - jp1 = " << jp1 << "\n";
-        My1_j = this->getValue(i1, j, 1);
-        My2_j = this->getValue(i2, j, 1);
-        My_j = (My2_j - My1_j) / (N2 - N1) * (N - N1) + My1_j;
-        Mz1_j = this->getValue(i1, j, 2);
-        Mz2_j = this->getValue(i2, j, 2);
-        Mz_j = (Mz2_j - Mz1_j) / (N2 - N1) * (N - N1) + Mz1_j;
-        My1_jp1 = this->getValue(i1, jp1, 1);
-        My2_jp1 = this->getValue(i2, jp1, 1);
-        My_jp1 = (My2_jp1 - My1_jp1) / (N2 - N1) * (N - N1) + My1_jp1;
-        Mz1_jp1 = this->getValue(i1, jp1, 2);
-        Mz2_jp1 = this->getValue(i2, jp1, 2);
-        Mz_jp1 = (Mz2_jp1 - Mz1_jp1) / (N2 - N1) * (N - N1) + Mz1_jp1;
-        dir_j(0) = My_j;
-        dir_j(1) = Mz_j;
-        dir_j.Normalize();
-        theta_j = atan2(Mz_j, My_j);
-        // transform theta in the range [0, 2pi[
-        if (theta_j < 0)
-            theta_j += 2 * M_PI;
-        dir_jp1(0) = My_jp1;
-        dir_jp1(1) = Mz_jp1;
-        dir_jp1.Normalize();
-        theta_jp1 = atan2(Mz_jp1, My_jp1);
-        if (theta_jp1 < 0)
-            theta_jp1 += 2 * M_PI;
-#ifdef _DBG_COUPLEDSEC3D
-        opserr << "j = " << j << " - jp1 = " << jp1 << "\n";
-        opserr << "theta_j = " << theta_j <<  " - theta_jp1 = " << theta_jp1 << " - theta = " << theta << "\n";
-        opserr << "direction j = [" << dir_j(0) << ", " << dir_j(1) << "]\n";
-        opserr << "direction j+1 = [" << dir_jp1(0) << ", " << dir_jp1(1) << "]\n";
+    if (sense != 0)
+    {
+        for (int c = 0; c < 2; c++)
+            if ((cachedSector[c] >= 0) && this->intersect(cachedSector[c], dy, dz, My, Mz))
+                return 0;
 
-#endif
-        jXjp1 = dir_j(0) * dir_jp1(1) - dir_j(1) * dir_jp1(0);
-        jXdirection = dir_j(0) * direction(1) - dir_j(1) * direction(0);
-        directionXjp1 = direction(0) * dir_jp1(1) - direction(1) * dir_jp1(0);
-        if ((jXjp1 * jXdirection >= 0) && (directionXjp1 * jXjp1 >= 0))
+        double My_0, Mz_0;
+        this->interpolate(0, My_0, Mz_0);
+        double theta_0 = atan2(Mz_0, My_0);
+        auto turn = [this, theta_0](double angle) {
+            double t = fmod(sense * (angle - theta_0), 2 * M_PI);
+            return t < 0 ? t + 2 * M_PI : t;
+        };
+        double target = turn(theta);
+
+        int lo = 0;
+        int hi = numberTheta - 1;
+        while (lo < hi)
         {
-#ifdef _DBG_COUPLEDSEC3D
-            opserr << "wanted direction found!";
-            opserr << " j = " << j << " - jp1 = " << jp1 << endln;
-#endif
-            found = true;
-            if (jXjp1 > 0)
-                inverse = 1;
+            int mid = (lo + hi + 1) / 2;
+            double My_mid, Mz_mid;
+            this->interpolate(mid, My_mid, Mz_mid);
+            if (turn(atan2(Mz_mid, My_mid)) <= target)
+                lo = mid;
+            else
+                hi = mid - 1;
         }
-        //if ((theta >= theta_j) && (theta < theta_jp1)) 
-        //{
-        //    //opserr << "theta_j = " << theta_j << " - theta = " << theta << " - theta_jp1 = " << theta_jp1 << "\n";
-        //    found = true;
-        //}
-        //else if ((theta <= theta_j) && (theta > theta_jp1)) 
-        //{
-        //    //opserr << "theta_jp1 = " << theta_jp1 << " - theta = " << theta << " - theta_j = " << theta_j << "\n";
-        //    found = true;
-        //    inverse = 1;
-        //}
-    }
-
-    if (found) 
-    {
-        //opserr << "found theta\n";
-        //opserr << "between: " << theta_j << "(" << j << ") and " << theta_jp1 << "(" << jp1 << ") - inverse: " << inverse << "\n";
+        if (this->intersect(lo, dy, dz, My, Mz))
+            j = lo;
     }
-    else 
+    for (int k = 0; (j < 0) && (k < numberTheta); k++)
+        if (this->intersect(k, dy, dz, My, Mz))
+            j = k;
+
+    if (j < 0)
     {
 #ifdef _DBG_COUPLEDSEC3D
         opserr << "\n\n";
-        opserr << "This is the whole domain (i1 = " << i1 << " - i2 = " << i2 << "): \n";
+        opserr << "This is the whole domain (i1 = " << cachedSlice << " - i2 = " << cachedSlice + 1 << "): \n";
         this->print();
-        opserr << "\n\n";
-        opserr << "j = " << j << " - jp1 = " << jp1 << endln;
-        opserr << "My1_j = " << My1_j << " - My2_j = " << My2_j << " - My_j (interp) = " << My_j << "\n";
-        opserr << "Mz1_j = " << Mz1_j << " - Mz2_j = " << Mz2_j << " - Mz_j (interp) = " << Mz_j << "\n";
-        opserr << "My1_jp1 = " << My1_jp1 << " - My2_jp1 = " << My2_jp1 << " - My_jp1 (interp) = " << My_jp1 << "\n";
-        opserr << "Mz1_jp1 = " << Mz1_jp1 << " - Mz2_jp1 = " << Mz2_jp1 << " - Mz_jp1 (interp) = " << Mz_jp1 << "\n";
-        opserr << "theta_j = " << theta_j << " - theta_jp1 = " << theta_jp1 << "\n";
         opserr << "Looked theta = " << theta << "\n";
 #endif
         return -1;
     }
-#ifdef _DBG_COUPLEDSEC3D
-    opserr << "Values from which interpolate:\n";
-    opserr << "My : " << My_j << " and " << My_jp1 << "\n";
-    opserr << "Mz : " << Mz_j << " and " << Mz_jp1 << "\n";
-#endif
-    double alfa = jXdirection / jXjp1;
-    double beta = directionXjp1 / jXjp1;
-    double sum = alfa + beta;
-    alfa /= sum;
-    beta /= sum;
-#ifdef _DBG_COUPLEDSEC3D
-    opserr << "Check alfa, beta\n";
-    opserr << alfa << " + " << beta << " = " << alfa+beta << "\n";
-#endif
-    My = My_j * beta + My_jp1 * alfa;
-    Mz = Mz_j * beta + Mz_jp1 * alfa;
-   /* if (inverse == 0) 
-    {
-        My = (My_jp1 - My_j) / (theta_jp1 - theta_j) * (theta - theta_j) + My_j;
-        Mz = (Mz_jp1 - Mz_j) / (theta_jp1 - theta_j) * (theta - theta_j) + Mz_j;
-    } else 
+
+    if (sense != 0)
     {
-        My = (My_j - My_jp1) / (theta_j - theta_jp1) * (theta - theta_jp1) + My_jp1;
-        Mz = (Mz_j - Mz_jp1) / (theta_j - theta_jp1) * (theta - theta_jp1) + Mz_jp1;
-    }*/
+        cachedSector[nextSector] = j;
+        nextSector = 1 - nextSector;
+    }
 
 #ifdef _DBG_COUPLEDSEC3D
     opserr << "Interpolated values:\n";
@@ -1226,7 +1230,7 @@ int ASDCoupledHinge3D::setTrialSectionDeformation (const Vector &def)
 const Vector &
 ASDCoupledHinge3D::getSectionDeformation(void)
 {
-    static Vector e(6);
+    thread_local Vector e(6);
     e(0) = axialMaterial->getStrain();
     e(1) = MyMaterial->getStrain();
     e(2) = MzMaterial->getStrain();
@@ -1239,7 +1243,7 @@ ASDCoupledHinge3D::getSectionDeformation(void)
 const Matrix &
 ASDCoupledHinge3D::getSectionTangent(void)
 {
-    static Matrix k(6, 6);
+    thread_local Matrix k(6, 6);
 #ifdef ASD_HINGE_NUM_TANG
     for (int i = 0; i < 6; ++i)
         k(i, i) = m_num_tang(i);
@@ -1258,7 +1262,7 @@ ASDCoupledHinge3D::getSectionTangent(void)
 const Matrix &
 ASDCoupledHinge3D::getInitialTangent(void)
 {
-    static Matrix k(6, 6);
+    thread_local Matrix k(6, 6);
     k(0, 0) = axialMaterial->getInitialTangent();
     k(1, 1) = MyMaterial->getInitialTangent();
     k(2, 2) = MzMaterial->getInitialTangent();
@@ -1271,7 +1275,7 @@ ASDCoupledHinge3D::getInitialTangent(void)
 const Matrix &
 ASDCoupledHinge3D::getSectionFlexibility(void)
 {
-    static Matrix f(6, 6);
+    thread_local Matrix f(6, 6);
     
 #ifdef ASD_HINGE_NUM_TANG
 
@@ -1343,7 +1347,7 @@ ASDCoupledHinge3D::getSectionFlexibility(void)
 const Matrix &
 ASDCoupledHinge3D::getInitialFlexibility(void)
 {
-    static Matrix f(6, 6);
+    thread_local Matrix f(6, 6);
 
     double k;
     k = axialMaterial->getInitialTangent();
@@ -1401,7 +1405,7 @@ ASDCoupledHinge3D::getInitialFlexibility(void)
 const Vector &
 ASDCoupledHinge3D::getStressResultant(void)
 {
-    static Vector s(6);
+    thread_local Vector s(6);
     s(0) = axialMaterial->getStress();
     s(1) = MyMaterial->getStress();
     s(2) = MzMaterial->getStress();
@@ -1439,7 +1443,7 @@ ASDCoupledHinge3D::getType ()
         x(5) = SECTION_RESPONSE_T;
         return x;
     };
-    static ID theCode = lam();
+    static const ID theCode = lam();
     return theCode;
 }
 
@@ -1977,6 +1981,7 @@ ASDCoupledHinge3D::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &the
         opserr << "ASDCoupledHinge3D::recvSelf() - failed to de-serialize data\n";
         return -1;
     }
+    strengthDomain.indexed = false;
 
     // set tag
     setTag(my_tag);
@@ -45,6 +45,7 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <string>
+#include <vector>
 #include <Parameter.h>
 
 #define STRENGTH_DOMAIN_UNDEFINED 0
@@ -71,12 +72,28 @@ public:
     void getRangeN(double& Nmin, double& Nmax);
 
 private:
+    void buildIndex(void);
+    void interpolate(int j, double& My, double& Mz);
+    bool intersect(int j, double dy, double dz, double& My, double& Mz);
+
     int size = 0;
     int numberAxial = 0;
     int numberTheta = 0;
     int numberData = 0;
     Vector theVector;
 
+    // lookup structure, built from theVector on the first query
+    bool indexed = false;
+    std::vector<double> sliceN;   // axial load of each slice, ascending
+    int sense = 0;                // +1 (-1) if the points of every slice turn
+                                  // counterclockwise (clockwise), 0 otherwise
+
+    // slice and sectors of the last queries, reused between the iterations
+    // of a step (the sectors only if sense != 0)
+    double cachedN = 0.0;
+    int cachedSlice = -1;
+    int cachedSector[2] = {-1, -1};
+    int nextSector = 0;
 };
 
 class ASDCoupledHinge3D : public SectionForceDeformation
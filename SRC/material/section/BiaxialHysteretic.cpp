@@ -44,8 +44,8 @@
 #include <elementAPI.h>
 #include <vector>
 
-double BiaxialHysteretic::sqrtpi = sqrt(3.1415926535897932384626);
-double BiaxialHysteretic::sqrttwo = sqrt(2.0);
+const double BiaxialHysteretic::sqrtpi = sqrt(3.1415926535897932384626);
+const double BiaxialHysteretic::sqrttwo = sqrt(2.0);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_BiaxialHysteretic)
 {
@@ -164,8 +164,8 @@ private:
     // tangent stiffness matrix
     Matrix Kt;
 
-    static double sqrtpi;
-    static double sqrttwo;
+    static const double sqrtpi;
+    static const double sqrttwo;
 
     ID code;
 
@@ -30,21 +30,21 @@
 
 #include <classTags.h>
 
-Vector ElasticBDShearSection2d::s(3);
-Matrix ElasticBDShearSection2d::ks(3,3);
-ID ElasticBDShearSection2d::code(3);
+thread_local Vector ElasticBDShearSection2d::s(3);
+thread_local Matrix ElasticBDShearSection2d::ks(3,3);
+static int code_array[] = {
+  SECTION_RESPONSE_P,	// P is the first quantity
+  SECTION_RESPONSE_MZ,	// Mz is the second
+  SECTION_RESPONSE_VY	// Vy is the third
+};
+
+const ID ElasticBDShearSection2d::code(code_array, 3);
 
 ElasticBDShearSection2d::ElasticBDShearSection2d()
 :SectionForceDeformation(0, SEC_TAG_ElasticBDShear2d),
  E(0.0), b(0.0), d(0.0), G(0.0), alpha(0.0),
  e(3), parameterID(0)
 {
-    if (code(0) != SECTION_RESPONSE_P)
-    {
-      code(0) = SECTION_RESPONSE_P;      // P is the first quantity
-      code(1) = SECTION_RESPONSE_MZ;     // Mz is the second
-      code(2) = SECTION_RESPONSE_VY;     // Vy is the third
-    }    
 }
 
 ElasticBDShearSection2d::ElasticBDShearSection2d
@@ -67,13 +67,6 @@ ElasticBDShearSection2d::ElasticBDShearSection2d
         opserr << "ElasticBDShearSection2d::ElasticBDShearSection2d -- Input d <= 0.0 ... setting d to 1.0\n";
         d = 1.0;
     }    
-        
-    if (code(0) != SECTION_RESPONSE_P)
-    {
-        code(0) = SECTION_RESPONSE_P;        // P is the first quantity
-        code(1) = SECTION_RESPONSE_MZ;        // Mz is the second
-        code(2) = SECTION_RESPONSE_VY;        // Vy is the third
-    }
 }
 
 ElasticBDShearSection2d::~ElasticBDShearSection2d()
@@ -206,7 +199,7 @@ ElasticBDShearSection2d::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(6);
+  Vector data(6);
   
   int dataTag = this->getDbTag();
   
@@ -232,7 +225,7 @@ ElasticBDShearSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(6);
+  Vector data(6);
   
   int dataTag = this->getDbTag();
   
@@ -323,7 +316,7 @@ const Vector&
 ElasticBDShearSection2d::getStressResultantSensitivity(int gradIndex,
                                                        bool conditional)
 {
-  static Vector dsdh(3);
+  thread_local Vector dsdh(3);
   dsdh.Zero();
 
   double A = b*d;
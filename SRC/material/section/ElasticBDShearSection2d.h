@@ -80,9 +80,9 @@ class ElasticBDShearSection2d: public SectionForceDeformation
   
   Vector e;			// section trial deformations
   
-  static Vector s;
-  static Matrix ks;
-  static ID code;
+  static thread_local Vector s;
+  static thread_local Matrix ks;
+  static const ID code;
   
   int parameterID;
 };
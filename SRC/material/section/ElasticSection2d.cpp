@@ -35,18 +35,19 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticSection2d::s(2);
-Matrix ElasticSection2d::ks(2,2);
-ID ElasticSection2d::code(2);
+thread_local Vector ElasticSection2d::s(2);
+thread_local Matrix ElasticSection2d::ks(2,2);
+static int code_array[] = {
+  SECTION_RESPONSE_P,	// P is the first quantity
+  SECTION_RESPONSE_MZ	// Mz is the second
+};
+
+const ID ElasticSection2d::code(code_array, 2);
 
 ElasticSection2d::ElasticSection2d()
 :FrameSection(0, SEC_TAG_Elastic2d),
  E(0.0), A(0.0), I(0.0), e(2)
 {
-  if (code(0) != SECTION_RESPONSE_P) {
-    code(0) = SECTION_RESPONSE_P;	// P is the first quantity
-    code(1) = SECTION_RESPONSE_MZ;	// Mz is the second
-  }
 }
 
 ElasticSection2d::ElasticSection2d
@@ -65,11 +66,6 @@ ElasticSection2d::ElasticSection2d
   if (I <= 0.0)  {
     //opserr << "ElasticSection2d::ElasticSection2d -- Input I <= 0.0\n";
   }    
-  
-  if (code(0) != SECTION_RESPONSE_P) {
-    code(0) = SECTION_RESPONSE_P;	// P is the first quantity
-    code(1) = SECTION_RESPONSE_MZ;	// Mz is the second
-  }
 }
 
 ElasticSection2d::~ElasticSection2d(void)
@@ -213,7 +209,7 @@ ElasticSection2d::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(4);
+    Vector data(4);
     
     int dataTag = this->getDbTag();
     
@@ -237,7 +233,7 @@ ElasticSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
 	int res = 0;
 
-    static Vector data(4);
+    Vector data(4);
 
     int dataTag = this->getDbTag();
 
@@ -34,9 +34,16 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticSection3d::s(4);
-Matrix ElasticSection3d::ks(4,4);
-ID ElasticSection3d::code(4);
+thread_local Vector ElasticSection3d::s(4);
+thread_local Matrix ElasticSection3d::ks(4,4);
+static int code_array[] = {
+  SECTION_RESPONSE_P,	// P is the first quantity
+  SECTION_RESPONSE_MZ,	// Mz is the second
+  SECTION_RESPONSE_MY,	// My is the third
+  SECTION_RESPONSE_T	// T is the fourth
+};
+
+const ID ElasticSection3d::code(code_array, 4);
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_ElasticSection3d)
@@ -65,12 +72,6 @@ ElasticSection3d::ElasticSection3d(void)
 :FrameSection(0, SEC_TAG_Elastic3d),
  E(0.0), A(0.0), Iz(0.0), Iy(0.0), G(0.0), J(0.0), e(4)
 {
-  if (code(0) != SECTION_RESPONSE_P) {
-    code(0) = SECTION_RESPONSE_P;	// P is the first quantity
-    code(1) = SECTION_RESPONSE_MZ;	// Mz is the second
-    code(2) = SECTION_RESPONSE_MY;	// My is the third 
-    code(3) = SECTION_RESPONSE_T;	// T is the fourth
-  }
 }
 
 ElasticSection3d::ElasticSection3d
@@ -101,13 +102,6 @@ ElasticSection3d::ElasticSection3d
   if (J <= 0.0)  {
     //opserr << "ElasticSection3d::ElasticSection3d -- Input J <= 0.0\n";
   }
-  
-  if (code(0) != SECTION_RESPONSE_P) {
-    code(0) = SECTION_RESPONSE_P;	// P is the first quantity
-    code(1) = SECTION_RESPONSE_MZ;	// Mz is the second
-    code(2) = SECTION_RESPONSE_MY;	// My is the third 
-    code(3) = SECTION_RESPONSE_T;	// T is the fourth
-  }
 }
 
 ElasticSection3d::~ElasticSection3d(void)
@@ -255,7 +249,7 @@ ElasticSection3d::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(7);
+    Vector data(7);
 
     int dataTag = this->getDbTag();
     
@@ -282,7 +276,7 @@ ElasticSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
     int res = 0;
     
-	static Vector data(7);
+	Vector data(7);
 
     int dataTag = this->getDbTag();
 
@@ -32,9 +32,15 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticShearSection2d::s(3);
-Matrix ElasticShearSection2d::ks(3,3);
-ID ElasticShearSection2d::code(3);
+thread_local Vector ElasticShearSection2d::s(3);
+thread_local Matrix ElasticShearSection2d::ks(3,3);
+static int code_array[] = {
+  SECTION_RESPONSE_P,	// P is the first quantity
+  SECTION_RESPONSE_MZ,	// Mz is the second
+  SECTION_RESPONSE_VY	// Vy is the third
+};
+
+const ID ElasticShearSection2d::code(code_array, 3);
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_ElasticShearSection2d)
@@ -63,11 +69,6 @@ ElasticShearSection2d::ElasticShearSection2d(void)
  E(0.0), A(0.0), I(0.0), G(0.0), alpha(0.0),
  e(3), parameterID(0)
 {
-  if (code(0) != SECTION_RESPONSE_P) {
-    code(0) = SECTION_RESPONSE_P;	// P is the first quantity
-    code(1) = SECTION_RESPONSE_MZ;	// Mz is the second
-    code(2) = SECTION_RESPONSE_VY;	// Vy is the third
-  }    
 }
 
 ElasticShearSection2d::ElasticShearSection2d
@@ -95,12 +96,6 @@ ElasticShearSection2d::ElasticShearSection2d
   if (alpha <= 0.0)  {
     opserr << "ElasticShearSection2d::ElasticShearSection2d -- Input alpha <= 0.0";
   }    
-  
-  if (code(0) != SECTION_RESPONSE_P) {
-    code(0) = SECTION_RESPONSE_P;	// P is the first quantity
-    code(1) = SECTION_RESPONSE_MZ;	// Mz is the second
-    code(2) = SECTION_RESPONSE_VY;	// Vy is the third
-  }
 }
 
 ElasticShearSection2d::~ElasticShearSection2d(void)
@@ -218,7 +213,7 @@ ElasticShearSection2d::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(6);
+  Vector data(6);
   
   int dataTag = this->getDbTag();
   
@@ -244,7 +239,7 @@ ElasticShearSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(6);
+  Vector data(6);
   
   int dataTag = this->getDbTag();
   
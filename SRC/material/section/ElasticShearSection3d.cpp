@@ -30,9 +30,18 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticShearSection3d::s(6);
-Matrix ElasticShearSection3d::ks(6,6);
-ID ElasticShearSection3d::code(6);
+thread_local Vector ElasticShearSection3d::s(6);
+thread_local Matrix ElasticShearSection3d::ks(6,6);
+static int code_array[] = {
+  SECTION_RESPONSE_P,	// P is the first quantity
+  SECTION_RESPONSE_MZ,	// Mz is the second
+  SECTION_RESPONSE_VY,	// Vy is the third
+  SECTION_RESPONSE_MY,	// My is the fourth
+  SECTION_RESPONSE_VZ,	// Vz is the fifth
+  SECTION_RESPONSE_T	// T is the sixth
+};
+
+const ID ElasticShearSection3d::code(code_array, 6);
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_ElasticShearSection3d)
@@ -63,14 +72,6 @@ ElasticShearSection3d::ElasticShearSection3d(void)
  E(0.0), A(0.0), Iz(0.0), Iy(0.0), G(0.0), J(0.0),
  alphaY(0.0), alphaZ(0.0), e(6)
 {
-  if (code(0) != SECTION_RESPONSE_P) {
-      code(0) = SECTION_RESPONSE_P;       // P is the first quantity
-      code(1) = SECTION_RESPONSE_MZ;      // Mz is the second
-      code(2) = SECTION_RESPONSE_VY;      // Vy is the third 
-      code(3) = SECTION_RESPONSE_MY;      // My is the fourth
-      code(4) = SECTION_RESPONSE_VZ;      // Vz is the fifth
-      code(5) = SECTION_RESPONSE_T;       // T is the sixth
-  }
 }
 
 ElasticShearSection3d::ElasticShearSection3d
@@ -111,15 +112,6 @@ ElasticShearSection3d::ElasticShearSection3d
     if (alphaZ <= 0.0)  {
       opserr << "ElasticShearSection3d::ElasticShearSection3d -- Input alphaZ <= 0.0\n";
     }
-
-    if (code(0) != SECTION_RESPONSE_P) {
-      code(0) = SECTION_RESPONSE_P;        // P is the first quantity
-      code(1) = SECTION_RESPONSE_MZ;        // Mz is the second
-      code(2) = SECTION_RESPONSE_VY;        // Vy is the third 
-      code(3) = SECTION_RESPONSE_MY;        // My is the fourth
-      code(4) = SECTION_RESPONSE_VZ;        // Vz is the fifth
-      code(5) = SECTION_RESPONSE_T;        // T is the sixth
-    }
 }
 
 ElasticShearSection3d::~ElasticShearSection3d(void)
@@ -264,7 +256,7 @@ ElasticShearSection3d::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(9);
+    Vector data(9);
 
     int dataTag = this->getDbTag();
     
@@ -293,7 +285,7 @@ ElasticShearSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
     int res = 0;
     
-    static Vector data(9);
+    Vector data(9);
 
     int dataTag = this->getDbTag();
 
@@ -82,9 +82,9 @@ class ElasticShearSection3d : public FrameSection
   
   Vector e;			// section trial deformations
   
-  static Vector s;
-  static Matrix ks;
-  static ID code;
+  static thread_local Vector s;
+  static thread_local Matrix ks;
+  static const ID code;
 
   int parameterID;
 };
@@ -71,24 +71,23 @@ OPS_ADD_RUNTIME_VPV(OPS_ElasticWarpingShearSection2d)
 
 }
 
-Vector ElasticWarpingShearSection2d::s(5);
-Matrix ElasticWarpingShearSection2d::ks(5,5);
-ID ElasticWarpingShearSection2d::code(5);
+thread_local Vector ElasticWarpingShearSection2d::s(5);
+thread_local Matrix ElasticWarpingShearSection2d::ks(5,5);
+static int code_array[] = {
+  SECTION_RESPONSE_P,	// P is the first quantity
+  SECTION_RESPONSE_MZ,	// Mz is the second
+  SECTION_RESPONSE_VY,	// Vy is the third
+  SECTION_RESPONSE_R,	// R (warping Shear) is the fourth
+  SECTION_RESPONSE_Q	// Q (warping Moment) is the fifth
+};
+
+const ID ElasticWarpingShearSection2d::code(code_array, 5);
 
 ElasticWarpingShearSection2d::ElasticWarpingShearSection2d(void)
 :SectionForceDeformation(0, SEC_TAG_ElasticWarpingShear2d),
  E(0.0), A(0.0), I(0.0), G(0.0), alpha(0.0), J(0.0), B(0.0), C(0.0),
  e(5), eCommit(5), parameterID(0)
 {
-    if (code(0) != SECTION_RESPONSE_P)
-    {
-	code(0) = SECTION_RESPONSE_P;	// P is the first quantity
-	code(1) = SECTION_RESPONSE_MZ;	// Mz is the second
-	code(2) = SECTION_RESPONSE_VY;	// Vy is the third
-	code(3) = SECTION_RESPONSE_R;	// R (warping Shear) is the fourth
-	code(4) = SECTION_RESPONSE_Q;	// Q (warping Moment) is the fifth
-
-    }    
 }
 
 ElasticWarpingShearSection2d::ElasticWarpingShearSection2d
@@ -129,15 +128,6 @@ ElasticWarpingShearSection2d::ElasticWarpingShearSection2d
 	if (C <= 0.0)  {
 		opserr << "ElasticWarpingShearSection2d::ElasticWarpingShearSection2d -- Input C <= 0.0";
     }    
-
-		if (code(0) != SECTION_RESPONSE_P)
-    {
-	code(0) = SECTION_RESPONSE_P;	// P is the first quantity
-	code(1) = SECTION_RESPONSE_MZ;	// Mz is the second
-	code(2) = SECTION_RESPONSE_VY;	// Vy is the third
-	code(3) = SECTION_RESPONSE_R;	// R (warping Shear) is the fourth
-	code(4) = SECTION_RESPONSE_Q;	// Q (warping Moment) is the fifth
-    }
 }
 
 ElasticWarpingShearSection2d::~ElasticWarpingShearSection2d(void)
@@ -287,7 +277,7 @@ ElasticWarpingShearSection2d::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(14);
+  Vector data(14);
   
   int dataTag = this->getDbTag();
   
@@ -321,7 +311,7 @@ ElasticWarpingShearSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(14);
+  Vector data(14);
   
   int dataTag = this->getDbTag();
   
@@ -82,9 +82,9 @@ class ElasticWarpingShearSection2d: public SectionForceDeformation
   Vector e;			// section trial deformations
   Vector eCommit;
   
-  static Vector s;
-  static Matrix ks;
-  static ID code;
+  static thread_local Vector s;
+  static thread_local Matrix ks;
+  static const ID code;
   
   int parameterID;
 };
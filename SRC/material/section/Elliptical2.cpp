@@ -29,9 +29,9 @@ typedef SensitiveResponse<SectionForceDeformation> SectionResponse;
 #include <Information.h>
 #include <Parameter.h>
 
-Vector Elliptical2::s(2);
-Matrix Elliptical2::ks(2,2);
-ID Elliptical2::code(2);
+thread_local Vector Elliptical2::s(2);
+thread_local Matrix Elliptical2::ks(2,2);
+thread_local ID Elliptical2::code(2);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_Elliptical2)
 {
@@ -177,7 +177,7 @@ Elliptical2::setTrialSectionDeformation(const Vector &e)
 const Matrix&
 Elliptical2::getSectionTangent(void)
 {
-  static Vector str(2);
+  thread_local Vector str(2);
 
   // Compute trial stress using elastic tangent
   str(0) = E[0]*(e_n1[0]-eP_n[0]);
@@ -205,23 +205,23 @@ Elliptical2::getSectionTangent(void)
 
   double dg = 0.0;
 
-  static Vector x(3);
+  thread_local Vector x(3);
   x(0) = xsi[0];
   x(1) = xsi[1];
   x(2) = 0.0;
 
-  static Vector dx(3);
+  thread_local Vector dx(3);
 
   double n[2];
   n[0] = Q[0]*xsi[0]/q;
   n[1] = Q[1]*xsi[1]/q;
 
-  static Vector R(3);
+  thread_local Vector R(3);
   R(0) = 0.0;
   R(1) = 0.0;
   R(2) = F;
 
-  static Matrix J(3,3);
+  thread_local Matrix J(3,3);
 
   int numIter = 0; int maxIter = 25;
   while (R.Norm() > 1.0e-14 && numIter < maxIter) {
@@ -262,9 +262,9 @@ Elliptical2::getSectionTangent(void)
   eP_n1[1] = eP_n[1] + dg*n[1];
   
 
-  static Matrix A(2,2);
-  static Matrix invA(2,2);
-  static Matrix B(2,2);
+  thread_local Matrix A(2,2);
+  thread_local Matrix invA(2,2);
+  thread_local Matrix B(2,2);
 
   A(0,0) = 1.0 + dg/q*Hkin[0]*(Q[0]-n[0]*n[0]);
   A(0,1) =       dg/q*Hkin[0]*(    -n[0]*n[1]);
@@ -296,7 +296,7 @@ Elliptical2::getSectionTangent(void)
   J(2,2) = -(n[0]*b[0]+n[1]*b[1]) - Hiso;
 
 
-  static Matrix C(3,3);
+  thread_local Matrix C(3,3);
   J.Invert(C);
 
   ks(0,0) = E[0]*C(0,0);
@@ -347,23 +347,23 @@ Elliptical2::getStressResultant(void)
 
   double dg = 0.0;
 
-  static Vector dx(3);
+  thread_local Vector dx(3);
 
   double n[2];
   n[0] = Q[0]*xsi[0]/q;
   n[1] = Q[1]*xsi[1]/q;
 
-  static Vector x(3);
+  thread_local Vector x(3);
   x(0) = xsi[0];
   x(1) = xsi[1];
   x(2) = 0.0;
 
-  static Vector R(3);
+  thread_local Vector R(3);
   R(0) = 0.0;
   R(1) = 0.0;
   R(2) = F;
 
-  static Matrix J(3,3);
+  thread_local Matrix J(3,3);
 
   int numIter = 0; int maxIter = 25;
   while (R.Norm() > 1.0e-14 && numIter < maxIter) {
@@ -416,7 +416,7 @@ Elliptical2::getStressResultant(void)
 const Vector&
 Elliptical2::getSectionDeformation(void)
 {
-  static Vector e(2);
+  thread_local Vector e(2);
 
   // Write to static variable for return
   e(0) = e_n1[0];
@@ -511,7 +511,7 @@ Elliptical2::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(13);
+  Vector data(13);
   
   data(0) = this->getTag();
   data(1) = E[0];
@@ -540,7 +540,7 @@ Elliptical2::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(13);
+  Vector data(13);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -767,7 +767,7 @@ Elliptical2::getStressResultantSensitivity(int gradIndex,
     n[0] = Q[0]*xsi[0]/q;
     n[1] = Q[1]*xsi[1]/q;
 
-    static Matrix J(3,3);
+    thread_local Matrix J(3,3);
 
     J(0,0) = 1.0 + dg/q*(E[0]+Hkin[0])*(Q[0]-n[0]*n[0]);
     J(0,1) =       dg/q*(E[0]+Hkin[0])*(    -n[0]*n[1]);
@@ -785,18 +785,18 @@ Elliptical2::getStressResultantSensitivity(int gradIndex,
     dQ[0] = -2*Q[0]/sigY[0]*dFydh[0];
     dQ[1] = -2*Q[1]/sigY[1]*dFydh[1];
 
-    static Matrix B(2,2);
+    thread_local Matrix B(2,2);
     B(0,0) = 1.0-0.5/q*n[0]*xsi[0];
     B(0,1) =    -0.5/q*n[0]*xsi[1];
     B(1,0) =    -0.5/q*n[1]*xsi[0];
     B(1,1) = 1.0-0.5/q*n[1]*xsi[1];
 
-    static Vector c(3);
+    thread_local Vector c(3);
     c(0) = dzdh[0] - (E[0]+Hkin[0])*dg/q*(B(0,0)*dQ[0]*xsi[0] + B(0,1)*dQ[1]*xsi[1]);
     c(1) = dzdh[1] - (E[1]+Hkin[1])*dg/q*(B(1,0)*dQ[0]*xsi[0] + B(1,1)*dQ[1]*xsi[1]);
     c(2) = Hiso*dalphadh + dHisodh*alpha_n1 - 0.5/q*(xsi[0]*dQ[0]*xsi[0]+xsi[1]*dQ[1]*xsi[1]);
 
-    static Vector dx(3);
+    thread_local Vector dx(3);
     J.Solve(c, dx);
 
     dzdh[0] = dx(0);
@@ -888,7 +888,7 @@ Elliptical2::commitSensitivity(const Vector &dedh, int gradIndex, int numGrads)
     n[0] = Q[0]*xsi[0]/q;
     n[1] = Q[1]*xsi[1]/q;
 
-    static Matrix J(3,3);
+    thread_local Matrix J(3,3);
 
     J(0,0) = 1.0 + dg/q*(E[0]+Hkin[0])*(Q[0]-n[0]*n[0]);
     J(0,1) =       dg/q*(E[0]+Hkin[0])*(    -n[0]*n[1]);
@@ -906,18 +906,18 @@ Elliptical2::commitSensitivity(const Vector &dedh, int gradIndex, int numGrads)
     dQ[0] = -2*Q[0]/sigY[0]*dFydh[0];
     dQ[1] = -2*Q[1]/sigY[1]*dFydh[1];
 
-    static Matrix B(2,2);
+    thread_local Matrix B(2,2);
     B(0,0) = 1.0-0.5/q*n[0]*xsi[0];
     B(0,1) =    -0.5/q*n[0]*xsi[1];
     B(1,0) =    -0.5/q*n[1]*xsi[0];
     B(1,1) = 1.0-0.5/q*n[1]*xsi[1];
 
-    static Vector c(3);
+    thread_local Vector c(3);
     c(0) = dzdh[0] - (E[0]+Hkin[0])*dg/q*(B(0,0)*dQ[0]*xsi[0] + B(0,1)*dQ[1]*xsi[1]);
     c(1) = dzdh[1] - (E[1]+Hkin[1])*dg/q*(B(1,0)*dQ[0]*xsi[0] + B(1,1)*dQ[1]*xsi[1]);
     c(2) = Hiso*dalphadh + dHisodh*alpha_n1 - 0.5/q*(xsi[0]*dQ[0]*xsi[0]+xsi[1]*dQ[1]*xsi[1]);
 
-    static Vector dx(3);
+    thread_local Vector dx(3);
     J.Solve(c, dx);
 
     double ddgdh = dx(2);
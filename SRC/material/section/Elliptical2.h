@@ -90,9 +90,9 @@ class Elliptical2 : public SectionForceDeformation
 	int parameterID;
 	Matrix *SHVs;
 
-	static Vector s;
-	static Matrix ks;
-	static ID code;
+	static thread_local Vector s;
+	static thread_local Matrix ks;
+	static thread_local ID code;
 
 	// private functions, as per Matlab implementation by E. Taciroglu
 	void isotropicHardeningRule(double H, double alpha, double &k, double &dk) {k = 1.0 + H*alpha; dk = H; return;}
@@ -26,6 +26,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <vector>
 
 #include <Channel.h>
 #include <Vector.h>
@@ -41,7 +42,12 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 
 #include "FiberResponse.h"
 
-ID FiberSection2d::code(2);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_MZ
+};
+
+const ID FiberSection2d::code(code_array, 2);
 
 
 // allocate memory for fibers
@@ -68,9 +74,6 @@ FiberSection2d::FiberSection2d(int tag, int num, bool compCentroid):
     kData[1] = 0.0;
     kData[2] = 0.0;
     kData[3] = 0.0;
-
-    code(0) = SECTION_RESPONSE_P;
-    code(1) = SECTION_RESPONSE_MZ;
 }
 
 // constructor for blank object that recvSelf needs to be invoked upon
@@ -90,9 +93,6 @@ FiberSection2d::FiberSection2d():
   kData[1] = 0.0;
   kData[2] = 0.0;
   kData[3] = 0.0;
-
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
 }
 
 int
@@ -270,8 +270,8 @@ FiberSection2d::getSectionDeformation(void)
 const Matrix&
 FiberSection2d::getInitialTangent(void)
 {
-  static double kInitial[4];
-  static Matrix kInitialMatrix(kInitial, 2, 2);
+  thread_local double kInitial[4];
+  thread_local Matrix kInitialMatrix(kInitial, 2, 2);
   kInitial[0] = 0.0; kInitial[1] = 0.0; kInitial[2] = 0.0; kInitial[3] = 0.0;
 
 
@@ -416,8 +416,8 @@ FiberSection2d::revertToStart(void)
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
   
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  std::vector<double> fiberLocs(numFibers);
+  std::vector<double> fiberArea(numFibers);
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -460,7 +460,7 @@ FiberSection2d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 3 so no conflict with matData below if just 1 fiber
-  static ID data(3);
+  ID data(3);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = computeCentroid ? 1 : 0; // Now the ID data is really 3
@@ -516,7 +516,7 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(3);
+  ID data(3);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -654,7 +654,7 @@ FiberSection2d::setResponse(const char **argv, int argc,
   
   if (argc > 2 && strcmp(argv[0],"fiber") == 0) {
 
-    static double fiberLocs[10000];
+    std::vector<double> fiberLocs(numFibers);
     { // TODO
       for (int i = 0; i < numFibers; i++) {
 	fiberLocs[i] = matData[2*i];
@@ -966,7 +966,7 @@ FiberSection2d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FiberSection2d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(2);
+  thread_local Vector dummy(2);
 
   return dummy;
 }
@@ -974,7 +974,7 @@ FiberSection2d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(2);
+  thread_local Vector ds(2);
   
   ds.Zero();
   
@@ -984,8 +984,8 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
   double tangent = 0.0;
   double sig_dAdh = 0.0;
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  std::vector<double> locsDeriv(numFibers);
+  std::vector<double> areaDeriv(numFibers);
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1032,7 +1032,7 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 FiberSection2d::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(2,2);
+  thread_local Matrix dksdh(2,2);
   
   dksdh.Zero();
 
@@ -1040,8 +1040,8 @@ FiberSection2d::getInitialTangentSensitivity(int gradIndex)
   double tangent = 0.0;
   double dtangentdh = 0.0;
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  std::vector<double> locsDeriv(numFibers);
+  std::vector<double> areaDeriv(numFibers);
 
   { // TODO; removing SectionIntegration
     for (int i = 0; i < numFibers; i++) {
@@ -1080,8 +1080,8 @@ FiberSection2d::commitSensitivity(const Vector& defSens,
 
   dedh = defSens;
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  std::vector<double> locsDeriv(numFibers);
+  std::vector<double> areaDeriv(numFibers);
 
   for (int i = 0; i < numFibers; i++) {
     locsDeriv[i] = 0.0;
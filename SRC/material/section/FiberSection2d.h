@@ -102,7 +102,7 @@ class FiberSection2d : public FrameSection
     double QzBar, ABar, yBar;       // Section centroid
     bool computeCentroid;
 
-    static ID code;
+    static const ID code;
 
     Vector  e;         // trial section deformations 
     Vector *s;         // section resisting forces  (axial force, bending moment)
@@ -102,7 +102,7 @@ class FiberSection2dInt : public FrameSection
     double   kData[9];               // data for ks matrix 
     double   sData[3];               // data for s vector 
     
-    static ID code;
+    static const ID code;
 
     int NStrip;    
     int NStrip1;
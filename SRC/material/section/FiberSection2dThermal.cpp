@@ -43,7 +43,12 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 //#include "ThermalField.h"
 //#include "ThermalField2d.h"
 
-ID FiberSection2dThermal::code(2);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_MZ
+};
+
+const ID FiberSection2dThermal::code(code_array, 2);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_FiberSection2dThermal)
 {
@@ -119,8 +124,6 @@ FiberSection2dThermal::FiberSection2dThermal(int tag, int num, Fiber **fibers, b
   kData[2] = 0.0;
   kData[3] = 0.0;
 
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
 
 //JZ 07/10 /////////////////////////////////////////////////////////////start
   sTData[0] = 0.0;
@@ -181,8 +184,6 @@ FiberSection2dThermal::FiberSection2dThermal(int tag, int num, bool compCentroid
     kData[2] = 0.0;
     kData[3] = 0.0;
 
-    code(0) = SECTION_RESPONSE_P;
-    code(1) = SECTION_RESPONSE_MZ;
 
     //JZ 07/10 /////////////////////////////////////////////////////////////start
     sTData[0] = 0.0;
@@ -221,8 +222,6 @@ FiberSection2dThermal::FiberSection2dThermal():
   kData[2] = 0.0;
   kData[3] = 0.0;
 
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
 
 //JZ 07/10 /////////////////////////////////////////////////////////////start
    sT = new Vector(sTData,2);
@@ -388,8 +387,8 @@ FiberSection2dThermal::setTrialSectionDeformation(const Vector& deforms)
               FiberTempMax= TempV(1);
       }
       // get the data from thermal material
-      static Vector tData(4);
-      static Information iData(tData);
+      thread_local Vector tData(4);
+      thread_local Information iData(tData);
       tData(0) = FiberTemperature;
       tData(1) = tangent;
       tData(2) = ThermalElongation;
@@ -440,8 +439,8 @@ FiberSection2dThermal::getSectionDeformation(void)
 const Matrix&
 FiberSection2dThermal::getInitialTangent(void)
 {
-  static double kInitial[4];
-  static Matrix kInitialMatrix(kInitial, 2, 2);
+  thread_local double kInitial[4];
+  thread_local Matrix kInitialMatrix(kInitial, 2, 2);
   kInitial[0] = 0.0; kInitial[1] = 0.0; kInitial[2] = 0.0; kInitial[3] = 0.0;
 
   double fiberLocs[10000];
@@ -536,8 +535,8 @@ FiberSection2dThermal::getTemperatureStress(const Vector &dataMixed)
     // obtaining new thermal Elongation
     double tangent =0.0;
 	double ThermalElongation =0.0;
-    static Vector tData(4);
-    static Information iData(tData);
+    thread_local Vector tData(4);
+    thread_local Information iData(tData);
     tData(0) = FiberTemperature;
 	tData(1) = tangent;
 	tData(2) = ThermalElongation;
@@ -770,7 +769,7 @@ FiberSection2dThermal::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers,
   //     size 3 so no conflict with matData below if just 1 fiber
-  static ID data(3);
+  ID data(3);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = computeCentroid ? 1 : 0; // Now the ID data is really 3  
@@ -826,7 +825,7 @@ FiberSection2dThermal::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(3);
+  ID data(3);
 
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -1098,7 +1097,7 @@ FiberSection2dThermal::setParameter(const char **argv, int argc, Parameter &para
 const Vector &
 FiberSection2dThermal::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(2);
+  thread_local Vector dummy(2);
 
   return dummy;
 }
@@ -1106,7 +1105,7 @@ FiberSection2dThermal::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSection2dThermal::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(2);
+  thread_local Vector ds(2);
 
   ds.Zero();
 
@@ -1173,7 +1172,7 @@ FiberSection2dThermal::getStressResultantSensitivity(int gradIndex, bool conditi
 const Matrix &
 FiberSection2dThermal::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(2,2);
+  thread_local Matrix dksdh(2,2);
 
   dksdh.Zero();
 
@@ -1326,7 +1325,7 @@ FiberSection2dThermal::determineFiberTemperature(const Vector& DataMixed, double
             opserr <<"FiberSection2dThermal::setTrialSectionDeformation -- fiber loc is out of the section";
     }
 
-    static Vector returnedTemperature(2);
+    thread_local Vector returnedTemperature(2);
     returnedTemperature(0)=FiberTemperature;
     returnedTemperature(1)=FiberTempMax;
     return returnedTemperature;
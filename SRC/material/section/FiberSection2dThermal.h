@@ -107,7 +107,7 @@ class FiberSection2dThermal : public FrameSection
     double QzBar, ABar, yBar;       // Section centroid
     bool computeCentroid;
     
-    static ID code;
+    static const ID code;
 
     Vector e;          // trial section deformations
     Vector eCommit;    // committed section deformations
@@ -27,6 +27,7 @@
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
+#include <vector>
 
 #include <Channel.h>
 #include <Vector.h>
@@ -46,7 +47,14 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 // #include <threads/thread_pool.hpp>
 // #define N_FIBER_THREADS 6
 
-ID FiberSection3d::code(4);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_MZ,
+  SECTION_RESPONSE_MY,
+  SECTION_RESPONSE_T
+};
+
+const ID FiberSection3d::code(code_array, 4);
 
 
 #if 0
@@ -101,11 +109,6 @@ FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers,
   eData.zero();
   sData.zero();
   ks.Zero();
-
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_T;
 }
 #endif
 
@@ -132,11 +135,6 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial &torsion, bool
     eData.zero();
     sData.zero();
     ks.Zero();
-
-    code(0) = SECTION_RESPONSE_P;
-    code(1) = SECTION_RESPONSE_MZ;
-    code(2) = SECTION_RESPONSE_MY;
-    code(3) = SECTION_RESPONSE_T;
 }
 
 #if 0
@@ -194,11 +192,6 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
   
   s->Zero();
   ks->Zero();
-  
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_T;
 }
 #endif
 
@@ -220,11 +213,6 @@ FiberSection3d::FiberSection3d():
     eData.zero();
     sData.zero();
     ks.Zero();
-
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_T;
 }
 
 // destructor:
@@ -480,8 +468,8 @@ FiberSection3d::setTrialSectionDeformation(const Vector &deforms)
 const Matrix&
 FiberSection3d::getInitialTangent(void)
 {
-  static double kInitialData[16];
-  static Matrix kInitial(kInitialData, 4, 4);
+  thread_local double kInitialData[16];
+  thread_local Matrix kInitial(kInitialData, 4, 4);
   
   kInitial.Zero();
 
@@ -734,7 +722,7 @@ FiberSection3d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   // size 5 so no conflict with matData below if just 2 fibers
-  static ID data(5);
+  ID data(5);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = (theTorsion != 0) ? 1 : 0;
@@ -797,7 +785,7 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(5);
+  ID data(5);
 
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -1251,7 +1239,7 @@ FiberSection3d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(4);
+  thread_local Vector dummy(4);
   
   dummy.Zero();
   
@@ -1262,7 +1250,7 @@ FiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(4);
+  thread_local Vector ds(4);
   
   ds.Zero();
   
@@ -1287,9 +1275,9 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     }
   }
 #endif
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  std::vector<double> dydh(numFibers);
+  std::vector<double> dzdh(numFibers);
+  std::vector<double> areaDeriv(numFibers);
 #if 0
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, dydh, dzdh);  
@@ -1339,16 +1327,16 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     if (dzdh[i] != 0.0)
       ds(2) +=  dzdh[i] * (stress*A);
 
-    static Matrix as(1,3);
+    thread_local Matrix as(1,3);
     as(0,0) = 1;
     as(0,1) = -y;
     as(0,2) = z;
     
-    static Matrix dasdh(1,3);
+    thread_local Matrix dasdh(1,3);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     
-    static Matrix tmpMatrix(3,3);
+    thread_local Matrix tmpMatrix(3,3);
     tmpMatrix.addMatrixTransposeProduct(0.0, as, dasdh, tangent);
     
     //ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -1365,7 +1353,7 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 FiberSection3d::getSectionTangentSensitivity(int gradIndex)
 {
-  static Matrix something(4,4);
+  thread_local Matrix something(4,4);
   
   something.Zero();
 
@@ -1385,8 +1373,8 @@ FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numG
 
   //dedh = defSens;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  std::vector<double> yLocs(numFibers);
+  std::vector<double> zLocs(numFibers);
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1395,8 +1383,8 @@ FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numG
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
+  std::vector<double> dydh(numFibers);
+  std::vector<double> dzdh(numFibers);
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
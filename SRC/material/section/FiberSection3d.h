@@ -107,7 +107,7 @@ class FiberSection3d : public FrameSection
     double zBar;
     bool computeCentroid;
 
-    static ID code;
+    static const ID code;
 
     Vector  e;         // trial section deformations 
     Vector  s;         // section resisting forces  (axial force, bending moment)
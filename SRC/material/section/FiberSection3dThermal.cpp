@@ -43,7 +43,14 @@
 #include <math.h>
 
 namespace OpenSees {
-ID FiberSection3dThermal::code(4);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_MZ,
+  SECTION_RESPONSE_MY,
+  SECTION_RESPONSE_T
+};
+
+const ID FiberSection3dThermal::code(code_array, 4);
 
 #if 0
 #include <elementAPI.h>
@@ -165,10 +172,6 @@ FiberSection3dThermal::FiberSection3dThermal(int tag, int num, Fiber **fibers,
   for (int i=0; i<16; i++)
     kData[i] = 0.0;
 
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_T;
 
  // AddingSensitivity:BEGIN ////////////////////////////////////
   parameterID = 0;
@@ -200,10 +203,6 @@ FiberSection3dThermal::FiberSection3dThermal(int tag, int num, UniaxialMaterial
     for (int i=0; i<16; i++)
       kData[i] = 0.0;
 
-    code(0) = SECTION_RESPONSE_P;
-    code(1) = SECTION_RESPONSE_MZ;
-    code(2) = SECTION_RESPONSE_MY;
-    code(3) = SECTION_RESPONSE_T;
 
    // AddingSensitivity:BEGIN ////////////////////////////////////
     parameterID = 0;
@@ -230,10 +229,6 @@ FiberSection3dThermal::FiberSection3dThermal():
   for (int i=0; i<16; i++)
     kData[i] = 0.0;
 
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_T;
 
  // AddingSensitivity:BEGIN ////////////////////////////////////
   parameterID = 0;
@@ -326,8 +321,8 @@ FiberSection3dThermal::setTrialSectionDeformation (const Vector &deforms)
       double tangent =0.0;
       double stress = 0.0;
       double ThermalElongation = 0.0;
-      static Vector tData(4);
-      static Information iData(tData);
+      thread_local Vector tData(4);
+      thread_local Information iData(tData);
       tData(0) = FiberTemperature;
       tData(1) = tangent;
       tData(2) = ThermalElongation;
@@ -380,8 +375,8 @@ FiberSection3dThermal::setTrialSectionDeformation (const Vector &deforms)
 const Matrix&
 FiberSection3dThermal::getInitialTangent()
 {
-  static double kInitialData[16];
-  static Matrix kInitial(kInitialData, 4, 4);
+  thread_local double kInitialData[16];
+  thread_local Matrix kInitial(kInitialData, 4, 4);
   
   kInitial.Zero();
 
@@ -463,8 +458,8 @@ FiberSection3dThermal::getTemperatureStress(const Vector& dataMixed)
     // determine material strain and set it
     double tangent =0.0;
     double ThermalElongation =0.0;
-    static Vector tData(4);
-    static Information iData(tData);
+    thread_local Vector tData(4);
+    thread_local Information iData(tData);
     tData(0) = FiberTemperature;
     tData(1) = tangent;
     tData(2) = ThermalElongation;
@@ -523,7 +518,7 @@ FiberSection3dThermal::getTemperatureStress(const Vector& dataMixed)
 const Vector&
 FiberSection3dThermal::getThermalElong()
 {
-    static Vector wrapper(4);
+    thread_local Vector wrapper(4);
     wrapper.setData(AverageThermalElong);
     return wrapper;
 }
@@ -735,7 +730,7 @@ FiberSection3dThermal::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and fibers.size(),
   //     size 3 so no conflict with matData below if just 1 fiber
-  static ID data(9);
+  ID data(9);
   data(0) = this->getTag();
   data(1) = fibers.size();
   //data(2) = computeCentroid ? 1 : 0; // Now the ID data is really 3
@@ -821,7 +816,7 @@ FiberSection3dThermal::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(9);
+  ID data(9);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -1191,7 +1186,7 @@ FiberSection3dThermal::setParameter(const char **argv, int argc, Parameter &para
 const Vector &
 FiberSection3dThermal::getSectionDeformationSensitivity(int gradIndex)
 {
-        static Vector dummy(3);
+        thread_local Vector dummy(3);
         dummy.Zero();
         if (SHVs !=0) {
                 dummy(0) = (*SHVs)(0,gradIndex);
@@ -1205,7 +1200,7 @@ FiberSection3dThermal::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSection3dThermal::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(4);
+  thread_local Vector ds(4);
   
   ds.Zero();
 
@@ -1232,7 +1227,7 @@ FiberSection3dThermal::getStressResultantSensitivity(int gradIndex, bool conditi
 const Matrix &
 FiberSection3dThermal::getSectionTangentSensitivity(int gradIndex)
 {
-  static Matrix something(4,4);
+  thread_local Matrix something(4,4);
 
   something.Zero();
 
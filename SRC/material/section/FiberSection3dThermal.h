@@ -123,7 +123,7 @@ class FiberSection3dThermal : public FrameSection
     double zBar;
     bool computeCentroid;
 
-    static ID code;
+    static const ID code;
 
     Vector e;          // trial section deformations
     Vector eCommit;    // committed section deformations
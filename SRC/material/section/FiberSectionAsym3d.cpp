@@ -35,6 +35,7 @@
 //
 #include <stdlib.h>
 #include <math.h>
+#include <vector>
 
 #include <Channel.h>
 #include <Vector.h>
@@ -51,7 +52,15 @@
 #include <SensitiveResponse.h>
 typedef SensitiveResponse<FrameSection> SectionResponse;
 
-ID FiberSectionAsym3d::code(5);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_MZ,
+  SECTION_RESPONSE_MY,
+  SECTION_RESPONSE_W,	// Wagner torque resultant
+  SECTION_RESPONSE_T	// St.-Venant torque resultant
+};
+
+const ID FiberSectionAsym3d::code(code_array, 5);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_FiberSectionAsym3d)
 {
@@ -141,12 +150,6 @@ FiberSectionAsym3d::FiberSectionAsym3d(int tag, int num, Fiber **fibers, Uniaxia
 
   for (int i=0; i<25; i++)      //Xinlong
     kData[i] = 0.0;
-
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_W;
-  code(4) = SECTION_RESPONSE_T;
 }
 #endif
 
@@ -177,12 +180,6 @@ FiberSectionAsym3d::FiberSectionAsym3d(int tag, int num, UniaxialMaterial *torsi
 
     for (int i=0; i<25; i++)  //Xinlong
         kData[i] = 0.0;
-
-    code(0) = SECTION_RESPONSE_P;
-    code(1) = SECTION_RESPONSE_MZ;
-    code(2) = SECTION_RESPONSE_MY;
-    code(3) = SECTION_RESPONSE_W;   // Wagner torque resultant
-    code(4) = SECTION_RESPONSE_T;   // St.-Venant torque resultant
 }
 
 #if 0
@@ -235,12 +232,6 @@ FiberSectionAsym3d::FiberSectionAsym3d(int tag, int num, UniaxialMaterial **mats
 
   for (int i = 0; i < 25; i++)   //Xinlong
     kData[i] = 0.0;
-  
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_W;
-  code(4) = SECTION_RESPONSE_T;
 }
 #endif
 
@@ -262,12 +253,6 @@ FiberSectionAsym3d::FiberSectionAsym3d():
 
   for (int i=0; i<25; i++)  //Xinlong
     kData[i] = 0.0;
-
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_W;
-  code(4) = SECTION_RESPONSE_T;
 }
 
 int
@@ -455,8 +440,8 @@ FiberSectionAsym3d::setTrialSectionDeformation(const Vector &deforms)
 const Matrix&
 FiberSectionAsym3d::getInitialTangent(void)
 {
-  static double kInitialData[25];
-  static Matrix kInitial(kInitialData, 5, 5);
+  thread_local double kInitialData[25];
+  thread_local Matrix kInitial(kInitialData, 5, 5);
   
   kInitial.Zero();
 
@@ -682,9 +667,9 @@ FiberSectionAsym3d::revertToStart(void)
   for (int i = 0; i < 25; i++) //Xinlong
           kData[i] = 0.0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  std::vector<double> yLocs(numFibers);
+  std::vector<double> zLocs(numFibers);
+  std::vector<double> fiberArea(numFibers);
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -762,7 +747,7 @@ FiberSectionAsym3d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 6 so no conflict with matData below if just 2 fibers
-  static Vector data(6);
+  Vector data(6);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = (theTorsion != 0) ? 1 : 0;
@@ -827,7 +812,7 @@ FiberSectionAsym3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(6);
+  Vector data(6);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvVector(dbTag, commitTag, data);
@@ -1016,8 +1001,8 @@ FiberSectionAsym3d::setResponse(const char **argv, int argc, OPS_Stream &output)
   
   if (argc > 2 && strcmp(argv[0],"fiber") == 0) {
 
-    static double yLocs[10000];
-    static double zLocs[10000];
+    std::vector<double> yLocs(numFibers);
+    std::vector<double> zLocs(numFibers);
     
 
     { // TODO
@@ -1257,7 +1242,7 @@ FiberSectionAsym3d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FiberSectionAsym3d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(4);
+  thread_local Vector dummy(4);
   
   dummy.Zero();
   
@@ -1268,7 +1253,7 @@ FiberSectionAsym3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSectionAsym3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(4);
+  thread_local Vector ds(4);
   
   ds.Zero();
   
@@ -1278,9 +1263,9 @@ FiberSectionAsym3d::getStressResultantSensitivity(int gradIndex, bool conditiona
   double sig_dAdh = 0;
   double tangent = 0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  std::vector<double> yLocs(numFibers);
+  std::vector<double> zLocs(numFibers);
+  std::vector<double> fiberArea(numFibers);
 
 
   { // TODO
@@ -1291,9 +1276,9 @@ FiberSectionAsym3d::getStressResultantSensitivity(int gradIndex, bool conditiona
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  std::vector<double> dydh(numFibers);
+  std::vector<double> dzdh(numFibers);
+  std::vector<double> areaDeriv(numFibers);
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1334,16 +1319,16 @@ FiberSectionAsym3d::getStressResultantSensitivity(int gradIndex, bool conditiona
     if (dzdh[i] != 0.0)
       ds(2) +=  dzdh[i] * (stress*A);
 
-    static Matrix as(1,3);
+    thread_local Matrix as(1,3);
     as(0,0) = 1;
     as(0,1) = -y;
     as(0,2) = z;
     
-    static Matrix dasdh(1,3);
+    thread_local Matrix dasdh(1,3);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     
-    static Matrix tmpMatrix(3,3);
+    thread_local Matrix tmpMatrix(3,3);
     tmpMatrix.addMatrixTransposeProduct(0.0, as, dasdh, tangent);
     
     //ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -1360,7 +1345,7 @@ FiberSectionAsym3d::getStressResultantSensitivity(int gradIndex, bool conditiona
 const Matrix &
 FiberSectionAsym3d::getSectionTangentSensitivity(int gradIndex)
 {
-  static Matrix something(4,4);
+  thread_local Matrix something(4,4);
   
   something.Zero();
 
@@ -1380,8 +1365,8 @@ FiberSectionAsym3d::commitSensitivity(const Vector& defSens, int gradIndex, int
 
   //dedh = defSens;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  std::vector<double> yLocs(numFibers);
+  std::vector<double> zLocs(numFibers);
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1390,8 +1375,8 @@ FiberSectionAsym3d::commitSensitivity(const Vector& defSens, int gradIndex, int
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
+  std::vector<double> dydh(numFibers);
+  std::vector<double> dzdh(numFibers);
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -115,7 +115,7 @@ class FiberSectionAsym3d : public FrameSection
     double zs;         // Xinlong: z coord of shear center relative to centroid
   
 
-    static ID code;
+    static const ID code;
 
     Vector e;          // trial section deformations 
     Vector *s;         // section resisting forces  (axial force, bending moment)
@@ -96,9 +96,9 @@ class FiberSectionGJThermal : public FrameSection
   Vector e;          // trial section deformations
   Vector eCommit;    // committed section deformations
 
-  static ID code;
-  static Vector s;         // section resisting forces
-  static Matrix ks;        // section stiffness
+  static const ID code;
+  static thread_local Vector s;         // section resisting forces
+  static thread_local Matrix ks;        // section stiffness
 
   double GJ;
 
@@ -46,7 +46,16 @@
 typedef SensitiveResponse<FrameSection> SectionResponse;
 
 
-ID FiberSectionWarping3d::code(6);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_MZ,
+  SECTION_RESPONSE_MY,
+  SECTION_RESPONSE_W,
+  SECTION_RESPONSE_B,
+  SECTION_RESPONSE_T
+};
+
+const ID FiberSectionWarping3d::code(code_array, 6);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_FiberSectionWarping3d)
 {
@@ -172,12 +181,6 @@ FiberSectionWarping3d::FiberSectionWarping3d(int tag, int num, Fiber **fibers,
   for (int i=0; i<36; i++)
     kData[i] = 0.0;
 
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_W;
-  code(4) = SECTION_RESPONSE_B;  
-  code(5) = SECTION_RESPONSE_T;  
 
  // AddingSensitivity:BEGIN ////////////////////////////////////
   parameterID = 0;
@@ -214,13 +217,6 @@ FiberSectionWarping3d::FiberSectionWarping3d(int tag, int num, UniaxialMaterial
 
     for (int i=0; i<36; i++)
         kData[i] = 0.0;
-
-    code(0) = SECTION_RESPONSE_P;
-    code(1) = SECTION_RESPONSE_MZ;
-    code(2) = SECTION_RESPONSE_MY;
-    code(3) = SECTION_RESPONSE_W;
-    code(4) = SECTION_RESPONSE_B;  
-    code(5) = SECTION_RESPONSE_T;    
 }
 
 // constructor for blank object that recvSelf needs to be invoked upon
@@ -242,12 +238,6 @@ FiberSectionWarping3d::FiberSectionWarping3d():
   for (int i=0; i<36; i++)
     kData[i] = 0.0;
 
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_W;
-  code(4) = SECTION_RESPONSE_B;  
-  code(5) = SECTION_RESPONSE_T;  
 
  // AddingSensitivity:BEGIN ////////////////////////////////////
   parameterID = 0;
@@ -465,8 +455,8 @@ FiberSectionWarping3d::setTrialSectionDeformation(const Vector &deforms)
 const Matrix&
 FiberSectionWarping3d::getInitialTangent()
 {
-  static double kInitialData[36];
-  static Matrix kInitial(kInitialData, 6, 6);
+  thread_local double kInitialData[36];
+  thread_local Matrix kInitial(kInitialData, 6, 6);
   for (int i=0; i<36; i++)
     kInitialData[i]=0.0;
 
@@ -737,7 +727,7 @@ FiberSectionWarping3d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 5 so no conflict with matData below if just 1 fiber
-  static ID data(5);
+  ID data(5);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = (theTorsion != 0) ? 1 : 0;  
@@ -799,7 +789,7 @@ FiberSectionWarping3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(5);
+  ID data(5);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -1220,7 +1210,7 @@ FiberSectionWarping3d::setParameter(const char **argv, int argc, Parameter &para
 const Vector &
 FiberSectionWarping3d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(3);
+  thread_local Vector dummy(3);
   dummy.Zero();
   if (SHVs !=0) {
     dummy(0) = (*SHVs)(0,gradIndex);
@@ -1235,7 +1225,7 @@ const Vector &
 FiberSectionWarping3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
   
-  static Vector ds(3);
+  thread_local Vector ds(3);
   
   ds.Zero();
   
@@ -1262,7 +1252,7 @@ FiberSectionWarping3d::getStressResultantSensitivity(int gradIndex, bool conditi
 const Matrix &
 FiberSectionWarping3d::getSectionTangentSensitivity(int gradIndex)
 {
-  static Matrix something(2,2);
+  thread_local Matrix something(2,2);
   
   something.Zero();
   
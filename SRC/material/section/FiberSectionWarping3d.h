@@ -102,7 +102,7 @@ class FiberSectionWarping3d : public FrameSection
     double yBar;       // Section centroid
     double zBar;
   
-    static ID code;
+    static const ID code;
 
     Vector e;          // trial section deformations 
     Vector eCommit;    // committed section deformations 
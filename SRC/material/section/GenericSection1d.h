@@ -84,9 +84,9 @@ class GenericSection1d : public SectionForceDeformation
     UniaxialMaterial *theModel;
     int code;
 
-    static Vector s;
-    static Matrix ks;
-    static ID c;
+    static thread_local Vector s;
+    static thread_local Matrix ks;
+    static thread_local ID c;
 };
 
 
@@ -71,11 +71,17 @@ void * OPS_ADD_RUNTIME_VPV(OPS_Isolator2spring)
     return new Isolator2spring(tag, tol, k1, Fy, kb, kvo, hb, Pe, Po);
 }
 
-Vector Isolator2spring::s(2);
-Vector Isolator2spring::s3(3);
-Vector Isolator2spring::f0(5);
-Matrix Isolator2spring::df(5,5);
-ID Isolator2spring::code(3);
+thread_local Vector Isolator2spring::s(2);
+thread_local Vector Isolator2spring::s3(3);
+thread_local Vector Isolator2spring::f0(5);
+thread_local Matrix Isolator2spring::df(5,5);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_VY,
+  SECTION_RESPONSE_MZ
+};
+
+const ID Isolator2spring::code(code_array, 3);
 
 Isolator2spring::Isolator2spring
 (int tag, double tol_in, double k1_in, double Fy_in, double kb_in, double kvo_in, double hb_in, double Pe_in, 
@@ -88,9 +94,6 @@ Isolator2spring::Isolator2spring
   pcr = sqrt(Pe*kbo*h);
   H = k1*kbo/(k1 - kbo);
   
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_VY;
-  code(2) = SECTION_RESPONSE_MZ;
   
 }
 
@@ -103,10 +106,6 @@ Isolator2spring::Isolator2spring():
 
 	pcr = sqrt(Pe*kbo*h);
 	H = k1*kbo/(k1 - kbo);
-
-	code(0) = SECTION_RESPONSE_P;
-	code(1) = SECTION_RESPONSE_VY;
-	code(2) = SECTION_RESPONSE_MZ;
 }
 
 Isolator2spring::~Isolator2spring()
@@ -207,7 +206,7 @@ Isolator2spring::getStressResultant(void)
   
   int iter = 0;
   double normf0 = f0.Norm();
-  static Matrix dfinverse(5,5);
+  thread_local Matrix dfinverse(5,5);
   
   // Solve nonlinear equations using Newton's method
   while (normf0 > tol) {
@@ -297,7 +296,7 @@ Isolator2spring::getStressResultant(void)
   
   // Compute stiffness matrix by three step process
   double denom = h*dfsds*(Pe - x0(1)) - x0(1)*x0(1);
-  static Matrix fkin(3,2);
+  thread_local Matrix fkin(3,2);
   fkin(0,0) = 1.0;
   fkin(1,0) = h;
   fkin(2,0) = 0.0;
@@ -305,15 +304,15 @@ Isolator2spring::getStressResultant(void)
   fkin(1,1) = -(x0(2) + h*x0(3));
   fkin(2,1) = -1.0;
   
-  static Matrix feq(3,3);
+  thread_local Matrix feq(3,3);
   feq(0,0) = (Pe-x0(1))*h/denom;
   feq(0,1) = feq(1,0) = x0(1)/denom;
   feq(1,1) = dfsds/denom;
   feq(0,2) = feq(1,2) = feq(2,0) = feq(2,1) = 0.0;
   feq(2,2) = 1.0/kvo;
   
-  static Matrix ftot(2,2);
-  static Matrix ktot(2,2);
+  thread_local Matrix ftot(2,2);
+  thread_local Matrix ktot(2,2);
   ftot.Zero();
   ftot.addMatrixTripleProduct(0.0,fkin,feq,1.0);
   ftot.Invert(ktot);
@@ -415,7 +414,7 @@ Isolator2spring::sendSelf(int cTag, Channel &theChannel)
 {
         int res = 0;
 	
-	static Vector data(13);
+	Vector data(13);
 	    
 	data(0) = this->getTag();
 	data(1) = tol;
@@ -443,7 +442,7 @@ Isolator2spring::recvSelf(int cTag, Channel &theChannel,
 {
         int res = 0;
  
-	static Vector data(13);
+	Vector data(13);
 	res = theChannel.recvVector(this->getDbTag(), cTag, data);
 	
 	if (res < 0) {
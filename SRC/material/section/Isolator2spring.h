@@ -88,11 +88,11 @@ class Isolator2spring : public SectionForceDeformation
 
 	Vector x0;
 	Matrix ks;
-	static Vector f0;
-	static Matrix df;
-	static Vector s;
-	static Vector s3;
-	static ID code;
+	static thread_local Vector f0;
+	static thread_local Matrix df;
+	static thread_local Vector s;
+	static thread_local Vector s3;
+	static const ID code;
 };
 
 #endif
@@ -65,7 +65,13 @@ void* OPS_ElasticMembraneSection()
 }
 
 //static vector and matrices
-ID ElasticMembraneSection::array(3);
+static int type_array[] = {
+  SECTION_RESPONSE_FXX,
+  SECTION_RESPONSE_FYY,
+  SECTION_RESPONSE_FXY
+};
+
+const ID ElasticMembraneSection::array(type_array, 3);
 
 // Full constructor
 ElasticMembraneSection::ElasticMembraneSection(int tag,		// section tag
@@ -223,13 +229,6 @@ SectionForceDeformation* ElasticMembraneSection::getCopy(void)
 
 const ID& ElasticMembraneSection::getType(void)
 {
-	static bool initialized = false;
-	if (!initialized) {
-		array(0) = SECTION_RESPONSE_FXX;
-		array(1) = SECTION_RESPONSE_FYY;
-		array(2) = SECTION_RESPONSE_FXY;
-		initialized = true;
-	}
 	return array;
 }
 
@@ -284,7 +283,7 @@ int ElasticMembraneSection::sendSelf(int commitTag, Channel& theChannel)
 	int res = 0;
 	int dataTag = this->getDbTag();
 
-	static Vector data(5);
+	Vector data(5);
 	data(0) = this->getTag();
 	data(1) = E;
 	data(2) = nu;
@@ -305,7 +304,7 @@ int ElasticMembraneSection::recvSelf(int commitTag, Channel& theChannel, FEM_Obj
 	int res = 0;
 	int dataTag = this->getDbTag();
 
-	static Vector data(5);
+	Vector data(5);
 
 	res += theChannel.recvVector(dataTag, commitTag, data);
 	if (res < 0) {
@@ -129,7 +129,13 @@ void* OPS_ADD_RUNTIME_VPV(OPS_LayeredMembraneSection)
 }
 
 //static vector and matrices
-ID LayeredMembraneSection::array(3);
+static int type_array[] = {
+  SECTION_RESPONSE_FXX,
+  SECTION_RESPONSE_FYY,
+  SECTION_RESPONSE_FXY
+};
+
+const ID LayeredMembraneSection::array(type_array, 3);
 
 // Full constructor
 LayeredMembraneSection::LayeredMembraneSection(int tag,		                                    // section tag
@@ -188,6 +194,8 @@ LayeredMembraneSection::LayeredMembraneSection(int tag,
 		}
 	}
 
+	// Group the layers by material class for batched state determination
+	layers.setLayers(numberLayers, The2DMaterials, 3);
 }
 
 // Blank constructor (constructor for blank object that recvSelf needs to be invoked upon) (constructor which should be invoked by an FEM_ObjectBroker only)
@@ -231,28 +239,24 @@ int LayeredMembraneSection::setTrialSectionDeformation(const Vector& newTrialSec
 	sectionTangent[2][0] = 0.0; sectionTangent[2][1] = 0.0;	sectionTangent[2][2] = 0.0;
 
 
-	// Set the strain at each layer
+	// Set the strain at each layer and evaluate the layers of each material class in one batch
 	for (int i = 0; i < numberLayers; i++) {
-		// Get nDMaterial stress and tangent stiffness
-		The2DMaterials[i]->setTrialStrain(newTrialSectionStrain);
-		const Vector& stressNDM = The2DMaterials[i]->getStress();
-		const Matrix& tangentNDM = The2DMaterials[i]->getTangent();
-
-		double sig11 = stressNDM(0);
-		double sig22 = stressNDM(1);
-		double sig12 = stressNDM(2);
-		// Calculate the layer contribution to section resultant stress
-		sectionResultantStress[0] += t[i] * sig11;
-		sectionResultantStress[1] += t[i] * sig22;
-		sectionResultantStress[2] += t[i] * sig12;
-
-		double E00 = tangentNDM(0, 0); double E01 = tangentNDM(0, 1); double E02 = tangentNDM(0, 2);
-		double E10 = tangentNDM(1, 0); double E11 = tangentNDM(1, 1); double E12 = tangentNDM(1, 2);
-		double E20 = tangentNDM(2, 0); double E21 = tangentNDM(2, 1); double E22 = tangentNDM(2, 2);
-		// Calculate the layer contribution to section tangent
-		sectionTangent[0][0] += t[i] * E00; sectionTangent[0][1] += t[i] * E01;	sectionTangent[0][2] += t[i] * E02;
-		sectionTangent[1][0] += t[i] * E10; sectionTangent[1][1] += t[i] * E11;	sectionTangent[1][2] += t[i] * E12;
-		sectionTangent[2][0] += t[i] * E20; sectionTangent[2][1] += t[i] * E21;	sectionTangent[2][2] += t[i] * E22;
+		double* strain = layers.strain(i);
+		strain[0] = newTrialSectionStrain(0);
+		strain[1] = newTrialSectionStrain(1);
+		strain[2] = newTrialSectionStrain(2);
+	}
+	layers.setTrialStrains();
+
+	// Calculate the layer contributions to section resultant stress and tangent
+	for (int i = 0; i < numberLayers; i++) {
+		const double* stressNDM = layers.stress(i);
+		const double* tangentNDM = layers.tangent(i);
+		for (int a = 0; a < 3; a++) {
+			sectionResultantStress[a] += t[i] * stressNDM[a];
+			for (int b = 0; b < 3; b++)
+				sectionTangent[a][b] += t[i] * tangentNDM[3 * a + b];
+		}
 	}
 	
 	// Set the stress and tangent
@@ -348,13 +352,6 @@ SectionForceDeformation* LayeredMembraneSection::getCopy(void)
 
 const ID& LayeredMembraneSection::getType(void)
 {
-	static bool initialized = false;
-	if (!initialized) {
-		array(0) = SECTION_RESPONSE_FXX;
-		array(1) = SECTION_RESPONSE_FYY;
-		array(2) = SECTION_RESPONSE_FXY;
-		initialized = true;
-	}
 	return array;
 }
 
@@ -424,7 +421,7 @@ int LayeredMembraneSection::sendSelf(int commitTag, Channel& theChannel)
 	int dataTag = this->getDbTag();
 
 	//static ID iData(4);
-	static Vector iData(4);
+	Vector iData(4);
 	iData(0) = this->getTag();
 	iData(1) = t_total;
 	iData(2) = numberLayers;
@@ -482,7 +479,7 @@ int LayeredMembraneSection::recvSelf(int commitTag, Channel& theChannel, FEM_Obj
 
 	int dataTag = this->getDbTag();
 
-	static Vector iData(4);
+	Vector iData(4);
 	res += theChannel.recvVector(dataTag, commitTag, iData);
 
 	if (res < 0) {
@@ -544,6 +541,8 @@ int LayeredMembraneSection::recvSelf(int commitTag, Channel& theChannel, FEM_Obj
 				return res;
 			}
 		}
+
+		layers.setLayers(numberLayers, The2DMaterials, 3);
 	}
 
 	return res;
@@ -26,6 +26,7 @@
 #include <Matrix.h>
 #include <ID.h>
 #include <NDMaterial.h>
+#include <NDMaterialBatch.h>
 
 #include <SectionForceDeformation.h>
 
@@ -87,6 +88,7 @@ private:
 
 	// Private attributes
 	NDMaterial** The2DMaterials;												    // Array of nD materials
+	NDMaterialBatch layers;															// Packed strains, stresses and tangents of the layers
 	
 	int numberLayers;																// Store the number of layers
 	double t_total;																	// Store the section total thickness
@@ -106,7 +108,7 @@ private:
 
 	double* t;																		// Store the layers thicknesses
 
-	static ID array;
+	static const ID array;
 };
 
 #endif // !LayeredMembraneSection_h
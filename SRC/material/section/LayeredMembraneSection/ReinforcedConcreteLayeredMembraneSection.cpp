@@ -26,6 +26,7 @@
 #include <SensitiveResponse.h>
 typedef SensitiveResponse<SectionForceDeformation> SectionResponse;
 #include <limits>
+#include <vector>
 // #include <algorithm>
 /*min, max*/
 #include <DummyStream.h>
@@ -142,7 +143,13 @@ void* OPS_ADD_RUNTIME_VPV(OPS_ReinforcedConcreteLayeredMembraneSection)
 }
 
 //static vector and matrices
-ID ReinforcedConcreteLayeredMembraneSection::array(3);
+static int type_array[] = {
+  SECTION_RESPONSE_FXX,
+  SECTION_RESPONSE_FYY,
+  SECTION_RESPONSE_FXY
+};
+
+const ID ReinforcedConcreteLayeredMembraneSection::array(type_array, 3);
 
 // Full constructor
 ReinforcedConcreteLayeredMembraneSection::ReinforcedConcreteLayeredMembraneSection(int tag,							// section tag
@@ -249,6 +256,7 @@ ReinforcedConcreteLayeredMembraneSection::ReinforcedConcreteLayeredMembraneSecti
 		}
 	}
 
+	this->setLayers();
 }
 
 // Blank constructor (constructor for blank object that recvSelf needs to be invoked upon) (constructor which should be invoked by an FEM_ObjectBroker only)
@@ -300,53 +308,28 @@ int ReinforcedConcreteLayeredMembraneSection::setTrialSectionDeformation(const V
 	sectionTangent[1][0] = 0.0; sectionTangent[1][1] = 0.0;	sectionTangent[1][2] = 0.0;
 	sectionTangent[2][0] = 0.0; sectionTangent[2][1] = 0.0;	sectionTangent[2][2] = 0.0;
 
-	// Set the strain at each concrete layer
-	for (int ic = 0; ic < numberConcreteLayers; ic++) {
-		// Get concrete stress and tangent stiffness
-		TheConcrete2DMaterial[ic]->setTrialStrain(newTrialSectionStrain);
-		const Vector& stressNDM = TheConcrete2DMaterial[ic]->getStress();
-		const Matrix& tangentNDM = TheConcrete2DMaterial[ic]->getTangent();
-
-		double fc11 = stressNDM(0);
-		double fc22 = stressNDM(1);
-		double fc12 = stressNDM(2);
-		// Calculate the concrete contribution to section resultant stress
-		sectionResultantStress[0] += t[ic] * fc11;
-		sectionResultantStress[1] += t[ic] * fc22;
-		sectionResultantStress[2] += t[ic] * fc12;
-
-		double Ec00 = tangentNDM(0, 0); double Ec01 = tangentNDM(0, 1); double Ec02 = tangentNDM(0, 2);
-		double Ec10 = tangentNDM(1, 0); double Ec11 = tangentNDM(1, 1); double Ec12 = tangentNDM(1, 2);
-		double Ec20 = tangentNDM(2, 0); double Ec21 = tangentNDM(2, 1); double Ec22 = tangentNDM(2, 2);
-		// Calculate the concrete contribution to section tangent
-		sectionTangent[0][0] += t[ic] * Ec00; sectionTangent[0][1] += t[ic] * Ec01;	sectionTangent[0][2] += t[ic] * Ec02;
-		sectionTangent[1][0] += t[ic] * Ec10; sectionTangent[1][1] += t[ic] * Ec11;	sectionTangent[1][2] += t[ic] * Ec12;
-		sectionTangent[2][0] += t[ic] * Ec20; sectionTangent[2][1] += t[ic] * Ec21;	sectionTangent[2][2] += t[ic] * Ec22;
+	// Set the strain at each concrete and reinforced steel layer and evaluate the layers of each material class in one batch
+	const int numberLayers = numberConcreteLayers + numberReinforcedSteelLayers;
+	for (int i = 0; i < numberLayers; i++) {
+		double* strain = layers.strain(i);
+		strain[0] = newTrialSectionStrain(0);
+		strain[1] = newTrialSectionStrain(1);
+		strain[2] = newTrialSectionStrain(2);
 	}
-
-	// Set the strain at each reinforced steel layer
-	for (int iRs = 0; iRs < numberReinforcedSteelLayers; iRs++) {
-		// Get reinforced steel stress and tangent stiffness
-		TheReinforcedSteel2DMaterial[iRs]->setTrialStrain(newTrialSectionStrain);
-		const Vector& stressNDM = TheReinforcedSteel2DMaterial[iRs]->getStress();
-		const Matrix& tangentNDM = TheReinforcedSteel2DMaterial[iRs]->getTangent();
-
-		double fs11 = stressNDM(0);
-		double fs22 = stressNDM(1);
-		double fs12 = stressNDM(2);
-		// Calculate the reinforced steel contribution to section resultant stress
-		sectionResultantStress[0] += h * fs11;
-		sectionResultantStress[1] += h * fs22;
-		sectionResultantStress[2] += h * fs12;
-
-		double Es00 = tangentNDM(0, 0); double Es01 = tangentNDM(0, 1); double Es02 = tangentNDM(0, 2);
-		double Es10 = tangentNDM(1, 0); double Es11 = tangentNDM(1, 1); double Es12 = tangentNDM(1, 2);
-		double Es20 = tangentNDM(2, 0); double Es21 = tangentNDM(2, 1); double Es22 = tangentNDM(2, 2);
-		// Calculate the reinforced steel contribution to section tangent
-		sectionTangent[0][0] += h * Es00; sectionTangent[0][1] += h * Es01; sectionTangent[0][2] += h * Es02;
-		sectionTangent[1][0] += h * Es10; sectionTangent[1][1] += h * Es11; sectionTangent[1][2] += h * Es12;
-		sectionTangent[2][0] += h * Es20; sectionTangent[2][1] += h * Es21; sectionTangent[2][2] += h * Es22;
+	layers.setTrialStrains();
+
+	// Calculate the concrete and reinforced steel contributions to section resultant stress and tangent
+	for (int i = 0; i < numberLayers; i++) {
+		const double ti = i < numberConcreteLayers ? t[i] : h;
+		const double* stressNDM = layers.stress(i);
+		const double* tangentNDM = layers.tangent(i);
+		for (int a = 0; a < 3; a++) {
+			sectionResultantStress[a] += ti * stressNDM[a];
+			for (int b = 0; b < 3; b++)
+				sectionTangent[a][b] += ti * tangentNDM[3 * a + b];
+		}
 	}
+
 	// Set the stress and tangent
 	TSectionStress(0) = sectionResultantStress[0]; TSectionStress(1) = sectionResultantStress[1]; TSectionStress(2) = sectionResultantStress[2];
 
@@ -489,13 +472,6 @@ SectionForceDeformation* ReinforcedConcreteLayeredMembraneSection::getCopy(void)
 
 const ID& ReinforcedConcreteLayeredMembraneSection::getType(void)
 {
-	static bool initialized = false;
-	if (!initialized) {
-		array(0) = SECTION_RESPONSE_FXX;
-		array(1) = SECTION_RESPONSE_FYY;
-		array(2) = SECTION_RESPONSE_FXY;
-		initialized = true;
-	}
 	return array;
 }
 
@@ -578,7 +554,7 @@ int ReinforcedConcreteLayeredMembraneSection::sendSelf(int commitTag, Channel& t
 	int res = 0;
 	int dataTag = this->getDbTag();
 
-	static ID iData(3);
+	ID iData(3);
 	iData(0) = this->getTag();
 	iData(1) = numberReinforcedSteelLayers;
 	iData(2) = numberConcreteLayers;
@@ -669,7 +645,7 @@ int ReinforcedConcreteLayeredMembraneSection::recvSelf(int commitTag, Channel& t
 
 	int dataTag = this->getDbTag();
 
-	static ID iData(3);
+	ID iData(3);
 	res += theChannel.recvID(dataTag, commitTag, iData);
 
 	if (res < 0) {
@@ -774,9 +750,23 @@ int ReinforcedConcreteLayeredMembraneSection::recvSelf(int commitTag, Channel& t
 		}
 	}
 
+	this->setLayers();
+
 	return res;
 }
 
+void ReinforcedConcreteLayeredMembraneSection::setLayers(void)
+{
+	// Concrete layers first, then reinforced steel layers
+	std::vector<NDMaterial*> materials;
+	for (int ic = 0; ic < numberConcreteLayers; ic++)
+		materials.push_back(TheConcrete2DMaterial[ic]);
+	for (int iRs = 0; iRs < numberReinforcedSteelLayers; iRs++)
+		materials.push_back(TheReinforcedSteel2DMaterial[iRs]);
+
+	layers.setLayers((int)materials.size(), materials.data(), 3);
+}
+
 void ReinforcedConcreteLayeredMembraneSection::Print(OPS_Stream& s, int flag)
 {
 	s << "ReinforcedConcreteLayeredMembraneSection tag: " << this->getTag() << endln;
@@ -26,6 +26,7 @@
 #include <Matrix.h>
 #include <ID.h>
 #include <NDMaterial.h>
+#include <NDMaterialBatch.h>
 
 #include <SectionForceDeformation.h>
 
@@ -93,9 +94,13 @@ private:
 	double getThetaPDAngle(void);													// Return the principal strain direction 
 	Vector getSectionStressAvg(void);											    // Return the average section stress
 
+	// Function used for batched state determination
+	void setLayers(void);															// Group the concrete and steel layers by material class
+
 	// Private attributes
 	NDMaterial** TheConcrete2DMaterial;												// Array of ND concrete materials
 	NDMaterial** TheReinforcedSteel2DMaterial;										// Array of ND reinforced steel materials
+	NDMaterialBatch layers;															// Packed states of the concrete layers followed by the steel layers
 
 	double thetaPrincipalDirection;													// Store the orientation of the Principal Direction in the material
 	Vector strainPrincipalDirection;												// Store the principal strains
@@ -128,7 +133,7 @@ private:
 
 	const double pi;
 
-	static ID array;
+	static const ID array;
 };
 
 #endif // !ReinforcedConcreteLayeredMembraneSection_h
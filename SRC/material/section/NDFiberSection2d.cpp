@@ -26,6 +26,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <vector>
 
 #include <Channel.h>
 #include <Vector.h>
@@ -41,8 +42,14 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 #include <Parameter.h>
 #include <elementAPI.h>
 
-ID NDFiberSection2d::code(3);
-Matrix NDFiberSection2d::fs(3,3);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_MZ,
+  SECTION_RESPONSE_VY
+};
+
+const ID NDFiberSection2d::code(code_array, 3);
+thread_local Matrix NDFiberSection2d::fs(3,3);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_NDFiberSection2d)
 {
@@ -103,10 +110,6 @@ NDFiberSection2d::NDFiberSection2d(int tag, int num, double a, bool compCentroid
     kData[6] = 0.0;
     kData[7] = 0.0;
     kData[8] = 0.0;
-
-    code(0) = SECTION_RESPONSE_P;
-    code(1) = SECTION_RESPONSE_MZ;
-    code(2) = SECTION_RESPONSE_VY;
 }
 
 #if 0
@@ -177,10 +180,6 @@ NDFiberSection2d::NDFiberSection2d(int tag, int num, NDMaterial **mats,
   kData[6] = 0.0;
   kData[7] = 0.0;
   kData[8] = 0.0;
-  
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_VY;
 }
 #endif
 
@@ -208,10 +207,6 @@ NDFiberSection2d::NDFiberSection2d():
   kData[6] = 0.0;
   kData[7] = 0.0;
   kData[8] = 0.0;
-
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_VY;
 }
 
 int
@@ -319,7 +314,7 @@ NDFiberSection2d::setTrialSectionDeformation(const Vector &deforms)
                d2 = deforms(2);
 
 
-  static Vector eps(2);
+  thread_local Vector eps(2);
 
   double rootAlpha = 1.0;
   eps(1) = d2;
@@ -392,8 +387,8 @@ NDFiberSection2d::getSectionDeformation(void)
 const Matrix&
 NDFiberSection2d::getInitialTangent(void)
 {
-  static double kInitial[9];
-  static Matrix kInitialMatrix(kInitial, 3, 3);
+  thread_local double kInitial[9];
+  thread_local Matrix kInitialMatrix(kInitial, 3, 3);
   kInitial[0] = 0.0; 
   kInitial[1] = 0.0; 
   kInitial[2] = 0.0; 
@@ -706,7 +701,7 @@ NDFiberSection2d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 3 so no conflict with matData below if just 1 fiber
-  static ID data(3);
+  ID data(3);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = computeCentroid ? 1 : 0; // Now the ID data is really 3  
@@ -762,7 +757,7 @@ NDFiberSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(3);
+  ID data(3);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -1061,17 +1056,17 @@ NDFiberSection2d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 NDFiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(3);
+  thread_local Vector ds(3);
   
   ds.Zero();
   
-  static Vector stress(2);
-  static Vector dsigdh(2);
-  static Vector sig_dAdh(2);
-  static Matrix tangent(2,2);
+  thread_local Vector stress(2);
+  thread_local Vector dsigdh(2);
+  thread_local Vector sig_dAdh(2);
+  thread_local Matrix tangent(2,2);
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  std::vector<double> locsDeriv(numFibers);
+  std::vector<double> areaDeriv(numFibers);
 
   {
     for (int i = 0; i < numFibers; i++) {
@@ -1140,7 +1135,7 @@ NDFiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 NDFiberSection2d::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(3,3);
+  thread_local Matrix dksdh(3,3);
   
   dksdh.Zero();
   /*
@@ -1205,8 +1200,8 @@ NDFiberSection2d::commitSensitivity(const Vector& defSens,
 
   dedh = defSens;
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  std::vector<double> locsDeriv(numFibers);
+  std::vector<double> areaDeriv(numFibers);
 
   for (int i = 0; i < numFibers; i++) {
     locsDeriv[i] = 0.0;
@@ -1216,7 +1211,7 @@ NDFiberSection2d::commitSensitivity(const Vector& defSens,
   double kappa = e(1);
   double gamma = e(2);
 
-  static Vector depsdh(2);
+  thread_local Vector depsdh(2);
 
   double rootAlpha = 1.0;
   if (alpha != 1.0)
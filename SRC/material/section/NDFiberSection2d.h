@@ -102,13 +102,13 @@ class NDFiberSection2d : public FrameSection
     double alpha;      // Shear shape factor
 
 
-    static ID code;
+    static const ID code;
 
     Vector e;          // trial section deformations 
     Vector *s;         // section resisting forces  (axial force, bending moment)
     Matrix *ks;        // section stiffness
 
-    static Matrix fs;
+    static thread_local Matrix fs;
 
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
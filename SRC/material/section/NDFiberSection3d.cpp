@@ -26,6 +26,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <vector>
 
 #include <Channel.h>
 #include <Vector.h>
@@ -41,7 +42,16 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 #include <Parameter.h>
 #include <elementAPI.h>
 
-ID NDFiberSection3d::code(6);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_MZ,
+  SECTION_RESPONSE_MY,
+  SECTION_RESPONSE_VY,
+  SECTION_RESPONSE_VZ,
+  SECTION_RESPONSE_T
+};
+
+const ID NDFiberSection3d::code(code_array, 6);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_NDFiberSection3d)
 {
@@ -113,13 +123,6 @@ NDFiberSection3d::NDFiberSection3d(int tag, int num, Fiber **fibers, double a, b
 
   for (int i = 0; i < 6*6; i++)
     kData[i] = 0.0;
-
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_VY;
-  code(4) = SECTION_RESPONSE_VZ;
-  code(5) = SECTION_RESPONSE_T;
 }
 #endif
 
@@ -143,13 +146,6 @@ NDFiberSection3d::NDFiberSection3d(int tag, int num, double a, bool compCentroid
 
     for (int i = 0; i < 6*6; i++)
 	kData[i] = 0.0;
-
-    code(0) = SECTION_RESPONSE_P;
-    code(1) = SECTION_RESPONSE_MZ;
-    code(2) = SECTION_RESPONSE_MY;
-    code(3) = SECTION_RESPONSE_VY;
-    code(4) = SECTION_RESPONSE_VZ;
-    code(5) = SECTION_RESPONSE_T;
 }
 
 // constructor for blank object that recvSelf needs to be invoked upon
@@ -168,13 +164,6 @@ NDFiberSection3d::NDFiberSection3d():
 
   for (int i = 0; i < 6*6; i++)
     kData[i] = 0.0;
-
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_VY;
-  code(4) = SECTION_RESPONSE_VZ;
-  code(5) = SECTION_RESPONSE_T;
 }
 
 int
@@ -287,7 +276,7 @@ NDFiberSection3d::setTrialSectionDeformation (const Vector &deforms)
     rootAlpha = sqrt(alpha);
 
   int res = 0;
-  static Vector eps(3);
+  thread_local Vector eps(3);
   for (int i = 0; i < numFibers; i++) {
     NDMaterial *theMat = theMaterials[i];
     const double y  = matData[3*i]   - yBar;
@@ -404,13 +393,13 @@ NDFiberSection3d::getSectionDeformation(void)
 const Matrix&
 NDFiberSection3d::getInitialTangent(void)
 {
-  static double kInitial[36];
-  static Matrix ki(kInitial, 6, 6);
+  thread_local double kInitial[36];
+  thread_local Matrix ki(kInitial, 6, 6);
   ki.Zero();
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  std::vector<double> yLocs(numFibers);
+  std::vector<double> zLocs(numFibers);
+  std::vector<double> fiberArea(numFibers);
 
   {
     for (int i = 0; i < numFibers; i++) {
@@ -845,7 +834,7 @@ NDFiberSection3d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 3 so no conflict with matData below if just 1 fiber
-  static ID data(3);
+  ID data(3);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = computeCentroid ? 1 : 0; // Now the ID data is really 3    
@@ -901,7 +890,7 @@ NDFiberSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(3);
+  ID data(3);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -1216,19 +1205,19 @@ NDFiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(6);
+  thread_local Vector ds(6);
   
   ds.Zero();
   
   double y, z, A;
-  static Vector stress(3);
-  static Vector dsigdh(3);
-  static Vector sig_dAdh(3);
-  static Matrix tangent(3,3);
+  thread_local Vector stress(3);
+  thread_local Vector dsigdh(3);
+  thread_local Vector sig_dAdh(3);
+  thread_local Matrix tangent(3,3);
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  std::vector<double> yLocs(numFibers);
+  std::vector<double> zLocs(numFibers);
+  std::vector<double> fiberArea(numFibers);
 
   {
     for (int i = 0; i < numFibers; i++) {
@@ -1238,9 +1227,9 @@ NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  std::vector<double> dydh(numFibers);
+  std::vector<double> dzdh(numFibers);
+  std::vector<double> areaDeriv(numFibers);
 
   {
     for (int i = 0; i < numFibers; i++) {
@@ -1306,7 +1295,7 @@ NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
       ds(4) += drootAlphadh * (stress(2)*A);
     }
 
-    static Matrix as(3,6);
+    thread_local Matrix as(3,6);
     as(0,0) =  1;
     as(0,1) = -y;
     as(0,2) =  z;
@@ -1315,7 +1304,7 @@ NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     as(1,5) = -z;
     as(2,5) =  y;
     
-    static Matrix dasdh(3,6);
+    thread_local Matrix dasdh(3,6);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     dasdh(1,3) = drootAlphadh;
@@ -1323,7 +1312,7 @@ NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     dasdh(1,5) = -dzdh[i];
     dasdh(2,5) = dydh[i];
     
-    static Matrix tmpMatrix(6,6);
+    thread_local Matrix tmpMatrix(6,6);
     tmpMatrix.addMatrixTripleProduct(0.0, as, tangent, dasdh, 1.0);
     
     ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -1335,7 +1324,7 @@ NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 NDFiberSection3d::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(6,6);
+  thread_local Matrix dksdh(6,6);
   
   dksdh.Zero();
   /*
@@ -1403,8 +1392,8 @@ NDFiberSection3d::commitSensitivity(const Vector& defSens,
 
   dedh = defSens;
 
-  static double dydh[10000];
-  static double dzdh[10000];
+  std::vector<double> dydh(numFibers);
+  std::vector<double> dzdh(numFibers);
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1413,7 +1402,7 @@ NDFiberSection3d::commitSensitivity(const Vector& defSens,
     }
   }
 
-  static Vector depsdh(3);
+  thread_local Vector depsdh(3);
 
   double rootAlpha = 1.0;
   if (alpha != 1.0)
@@ -98,7 +98,7 @@ class NDFiberSection3d : public FrameSection
     double alpha;      // Shear shape factor
 
 
-    static ID code;
+    static const ID code;
 
     Vector e;          // trial section deformations 
     Vector *s;         // section resisting forces  (axial force, bending moment)
@@ -27,6 +27,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <vector>
 
 #include <Channel.h>
 #include <Vector.h>
@@ -42,7 +43,15 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 #include <Parameter.h>
 #include <elementAPI.h>
 
-ID NDFiberSectionWarping2d::code(5);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_MZ,
+  SECTION_RESPONSE_VY,
+  SECTION_RESPONSE_R,
+  SECTION_RESPONSE_Q
+};
+
+const ID NDFiberSectionWarping2d::code(code_array, 5);
 
 void* OPS_NDFiberSectionWarping2d()
 {
@@ -113,12 +122,6 @@ NDFiberSectionWarping2d::NDFiberSectionWarping2d(int tag, int num, double a):
       for (int j = 0; j < order; j++)
 	kData[5*i + j] = 0.0;
     }
-    
-    code(0) = SECTION_RESPONSE_P;
-    code(1) = SECTION_RESPONSE_MZ;
-    code(2) = SECTION_RESPONSE_VY;
-    code(3) = SECTION_RESPONSE_R;
-    code(4) = SECTION_RESPONSE_Q;    
 }
 
 
@@ -162,12 +165,6 @@ FrameSection(0, SEC_TAG_NDFiberSectionWarping2d),
     kData[22] = 0.0;
     kData[23] = 0.0;
     kData[24] = 0.0;
-
-    code(0) = SECTION_RESPONSE_P;
-    code(1) = SECTION_RESPONSE_MZ;
-    code(2) = SECTION_RESPONSE_VY;
-    code(3) = SECTION_RESPONSE_R;
-    code(4) = SECTION_RESPONSE_Q;
 }
 
 int
@@ -290,8 +287,8 @@ NDFiberSectionWarping2d::setTrialSectionDeformation(const Vector &deforms)
                  d3 = deforms(3),
                  d4 = deforms(4);
 
-    static double fiberLocs[10000];
-    static double fiberArea[10000];
+    std::vector<double> fiberLocs(numFibers);
+    std::vector<double> fiberArea(numFibers);
 
     { // TODO
         for (int i = 0; i < numFibers; i++) {
@@ -300,7 +297,7 @@ NDFiberSectionWarping2d::setTrialSectionDeformation(const Vector &deforms)
         }
     }
 
-    static Vector eps(2);
+    thread_local Vector eps(2);
 
     // h ~ parameter equals Height/2 for symmetric cases
     double maxLoc(fiberLocs[1] - yBarZero), minLoc(fiberLocs[1] - yBarZero); 
@@ -436,8 +433,8 @@ NDFiberSectionWarping2d::getRho(void)
 const Matrix&
 NDFiberSectionWarping2d::getInitialTangent(void)
 {
-    static double kInitial[25];
-    static Matrix kInitialMatrix(kInitial, 5, 5);
+    thread_local double kInitial[25];
+    thread_local Matrix kInitialMatrix(kInitial, 5, 5);
     kInitial[0] = 0.0; 
     kInitial[1] = 0.0;
     kInitial[2] = 0.0;
@@ -464,8 +461,8 @@ NDFiberSectionWarping2d::getInitialTangent(void)
     kInitial[23] = 0.0;
     kInitial[24] = 0.0;
 
-    static double fiberLocs[10000];
-    static double fiberArea[10000];
+    std::vector<double> fiberLocs(numFibers);
+    std::vector<double> fiberArea(numFibers);
 
     { // TODO
         for (int i = 0; i < numFibers; i++) {
@@ -703,8 +700,8 @@ NDFiberSectionWarping2d::revertToLastCommit(void)
     sData[3] = 0.0;
     sData[4] = 0.0;
 
-    static double fiberLocs[10000];
-    static double fiberArea[10000];
+    std::vector<double> fiberLocs(numFibers);
+    std::vector<double> fiberArea(numFibers);
 
     { // TODO
         for (int i = 0; i < numFibers; i++) {
@@ -860,8 +857,8 @@ NDFiberSectionWarping2d::revertToStart(void)
     sData[3] = 0.0;
     sData[4] = 0.0;
 
-    static double fiberLocs[10000];
-    static double fiberArea[10000];
+    std::vector<double> fiberLocs(numFibers);
+    std::vector<double> fiberArea(numFibers);
 
     { // TODO
         for (int i = 0; i < numFibers; i++) {
@@ -977,7 +974,7 @@ NDFiberSectionWarping2d::sendSelf(int commitTag, Channel &theChannel)
 
     // create an id to send objects tag and numFibers, 
     //     size 3 so no conflict with matData below if just 1 fiber
-    static ID data(3);
+    ID data(3);
     data(0) = this->getTag();
     data(1) = numFibers;
     int dbTag = this->getDbTag();
@@ -1032,7 +1029,7 @@ NDFiberSectionWarping2d::recvSelf(int commitTag, Channel &theChannel,
 {
     int res = 0;
 
-    static ID data(3);
+    ID data(3);
 
     int dbTag = this->getDbTag();
     res += theChannel.recvID(dbTag, commitTag, data);
@@ -1330,18 +1327,18 @@ NDFiberSectionWarping2d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 NDFiberSectionWarping2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-    static Vector ds(5);
+    thread_local Vector ds(5);
 
     ds.Zero();
 
     double y, A;
-    static Vector stress(2);
-    static Vector dsigdh(2);
-    static Vector sig_dAdh(2);
-    static Matrix tangent(2,2);
+    thread_local Vector stress(2);
+    thread_local Vector dsigdh(2);
+    thread_local Vector sig_dAdh(2);
+    thread_local Matrix tangent(2,2);
 
-    static double fiberLocs[10000];
-    static double fiberArea[10000];
+    std::vector<double> fiberLocs(numFibers);
+    std::vector<double> fiberArea(numFibers);
 
     { // TODO
         for (int i = 0; i < numFibers; i++) {
@@ -1350,8 +1347,8 @@ NDFiberSectionWarping2d::getStressResultantSensitivity(int gradIndex, bool condi
         }
     }
 
-    static double locsDeriv[10000];
-    static double areaDeriv[10000];
+    std::vector<double> locsDeriv(numFibers);
+    std::vector<double> areaDeriv(numFibers);
 
     { // TODO
         for (int i = 0; i < numFibers; i++) {
@@ -1421,7 +1418,7 @@ NDFiberSectionWarping2d::getStressResultantSensitivity(int gradIndex, bool condi
 const Matrix &
 NDFiberSectionWarping2d::getInitialTangentSensitivity(int gradIndex)
 {
-    static Matrix dksdh(5,5);
+    thread_local Matrix dksdh(5,5);
 
     dksdh.Zero();
     /*
@@ -1488,14 +1485,14 @@ NDFiberSectionWarping2d::commitSensitivity(const Vector& defSens,
 
     dedh = defSens;
 
-    static double fiberLocs[10000];
+    std::vector<double> fiberLocs(numFibers);
 
     // TODO
     for (int i = 0; i < numFibers; i++)
         fiberLocs[i] = matData[2*i];
 
-    static double locsDeriv[10000];
-    static double areaDeriv[10000];
+    std::vector<double> locsDeriv(numFibers);
+    std::vector<double> areaDeriv(numFibers);
 
 
     { // TODO
@@ -1511,7 +1508,7 @@ NDFiberSectionWarping2d::commitSensitivity(const Vector& defSens,
     double phi      = e(3);
     double phiprime = e(4);
 
-    static Vector depsdh(2);
+    thread_local Vector depsdh(2);
 
     double rootAlpha = 1.0;
     if (alpha != 1.0)
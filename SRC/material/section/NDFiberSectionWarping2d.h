@@ -101,7 +101,7 @@ class NDFiberSectionWarping2d : public FrameSection
 	double DeltaYbar;
 
 
-    static ID code;
+    static const ID code;
 
     Vector e;          // trial section deformations
     Vector eCommit;    // committed section deformations 
@@ -106,8 +106,6 @@ conditional);
    
     int otherDbTag;
 
-    static double workArea[];
-    static int codeArea[];
 
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
@@ -47,9 +47,6 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 
 // Assumes section order is less than or equal to MAX_ORDER.
 // Can increase if needed!!!
-double SectionAggregator::workArea[2*MAX_ORDER*(MAX_ORDER+1)];
-int    SectionAggregator::codeArea[MAX_ORDER];
-
 
 #include <elementAPI.h>
 #if 0
@@ -258,11 +255,11 @@ SectionAggregator::SectionAggregator (int tag, FrameSection &theSec,
       exit(-1);
     }
 
-    theCode = new ID(codeArea, order);
-    e = new Vector(workArea, order);
-    s = new Vector(&workArea[MAX_ORDER], order);
-    ks = new Matrix(&workArea[2*MAX_ORDER], order, order);
-    fs = new Matrix(&workArea[MAX_ORDER*(MAX_ORDER+2)], order, order);
+    theCode = new ID(order);
+    e = new Vector(order);
+    s = new Vector(order);
+    ks = new Matrix(order, order);
+    fs = new Matrix(order, order);
     matCodes = new ID(addCodes);
 
     if (theCode == 0 || e == 0 || s == 0 || ks == 0 || fs == 0 || matCodes == 0) {
@@ -315,11 +312,11 @@ SectionAggregator::SectionAggregator (int tag, int numAdds,
       exit(-1);
     }
 
-    theCode = new ID(codeArea, order);
-    e = new Vector(workArea, order);
-    s = new Vector(&workArea[MAX_ORDER], order);
-    ks = new Matrix(&workArea[2*MAX_ORDER], order, order);
-    fs = new Matrix(&workArea[MAX_ORDER*(MAX_ORDER+2)], order, order);
+    theCode = new ID(order);
+    e = new Vector(order);
+    s = new Vector(order);
+    ks = new Matrix(order, order);
+    fs = new Matrix(order, order);
     matCodes = new ID(addCodes);
 
     if (theCode == 0 || e == 0 || s == 0 || ks == 0 || fs == 0 || matCodes == 0) {
@@ -361,11 +358,11 @@ SectionAggregator::SectionAggregator (int tag, FrameSection &theSec,
     exit(-1);
   }
   
-  theCode = new ID(codeArea, order);
-  e = new Vector(workArea, order);
-  s = new Vector(&workArea[MAX_ORDER], order);
-  ks = new Matrix(&workArea[2*MAX_ORDER], order, order);
-  fs = new Matrix(&workArea[MAX_ORDER*(MAX_ORDER+2)], order, order);
+  theCode = new ID(order);
+  e = new Vector(order);
+  s = new Vector(order);
+  ks = new Matrix(order, order);
+  fs = new Matrix(order, order);
   
   if (theCode == 0 || e == 0 || s == 0 || ks == 0 || fs == 0 || matCodes == 0) {
     opserr << "SectionAggregator::SectionAggregator   " << tag << " -- out of memory\n";
@@ -477,7 +474,8 @@ int SectionAggregator::setTrialSectionDeformation (const Vector &def)
 
   if (theSection) {
     theSectionOrder = theSection->getOrder();
-    Vector v(workArea, theSectionOrder);
+    double vData[MAX_ORDER];
+    Vector v(vData, theSectionOrder);
     
     for (i = 0; i < theSectionOrder; i++)
       v(i) = def(i);
@@ -765,7 +763,7 @@ SectionAggregator::sendSelf(int cTag, Channel &theChannel)
     otherDbTag = theChannel.getDbTag();
   
   // Create ID for tag and section order data
-  static ID data(5);
+  ID data(5);
   
   int order = this->getOrder();
   
@@ -863,7 +861,7 @@ SectionAggregator::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &the
   int res = 0;
 
   // Create an ID and receive tag and section order
-  static ID data(5);
+  ID data(5);
   res += theChannel.recvID(this->getDbTag(), cTag, data);
   if (res < 0) {
     opserr << "SectionAggregator::recvSelf -- could not receive data ID\n";
@@ -885,11 +883,11 @@ SectionAggregator::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &the
         delete fs;
         delete theCode;
       }
-      e = new Vector(workArea, order);
-      s = new Vector(&workArea[MAX_ORDER], order);
-      ks = new Matrix(&workArea[2*MAX_ORDER], order, order);
-      fs = new Matrix(&workArea[MAX_ORDER*(MAX_ORDER+2)], order, order);
-      theCode = new ID(codeArea, order);
+      e = new Vector(order);
+      s = new Vector(order);
+      ks = new Matrix(order, order);
+      fs = new Matrix(order, order);
+      theCode = new ID(order);
     }
   }
 
@@ -1283,7 +1281,8 @@ SectionAggregator::commitSensitivity(const Vector& defSens,
 
   if (theSection) {
     theSectionOrder = theSection->getOrder();
-    Vector dedh(workArea, theSectionOrder);
+    double dedhData[MAX_ORDER];
+    Vector dedh(dedhData, theSectionOrder);
     
     for (i = 0; i < theSectionOrder; i++)
       dedh(i) = defSens(i);
@@ -77,9 +77,20 @@ void * OPS_ADD_RUNTIME_VPV(OPS_DoubleMembranePlateFiberSection)
 const double DoubleMembranePlateFiberSection::root56 = sqrt(5.0/6.0) ; //shear correction
 
 //static vector and matrices
-Vector  DoubleMembranePlateFiberSection::stressResultant(8) ;
-Matrix  DoubleMembranePlateFiberSection::tangent(8,8) ;
-ID      DoubleMembranePlateFiberSection::array(8) ;
+thread_local Vector  DoubleMembranePlateFiberSection::stressResultant(8) ;
+thread_local Matrix  DoubleMembranePlateFiberSection::tangent(8,8) ;
+static int type_array[] = {
+  SECTION_RESPONSE_FXX,
+  SECTION_RESPONSE_FYY,
+  SECTION_RESPONSE_FXY,
+  SECTION_RESPONSE_MXX,
+  SECTION_RESPONSE_MYY,
+  SECTION_RESPONSE_MXY,
+  SECTION_RESPONSE_VXZ,
+  SECTION_RESPONSE_VYZ
+};
+
+const ID DoubleMembranePlateFiberSection::array(type_array, 8);
 
 
 const double  DoubleMembranePlateFiberSection::sg[] = { -1, 
@@ -179,18 +190,6 @@ int DoubleMembranePlateFiberSection::getOrder( ) const
 //send back order of strainResultant in vector form
 const ID& DoubleMembranePlateFiberSection::getType( ) 
 {
-    static bool initialized = false;
-    if (!initialized) {
-        array(0) = SECTION_RESPONSE_FXX;
-        array(1) = SECTION_RESPONSE_FYY;
-        array(2) = SECTION_RESPONSE_FXY;
-        array(3) = SECTION_RESPONSE_MXX;
-        array(4) = SECTION_RESPONSE_MYY;
-        array(5) = SECTION_RESPONSE_MXY;
-        array(6) = SECTION_RESPONSE_VXZ;
-        array(7) = SECTION_RESPONSE_VYZ;
-        initialized = true;
-    }
     return array;
 }
 
@@ -267,7 +266,7 @@ setTrialSectionDeformation( const Vector &strainResultant_from_element)
 {
   this->strainResultant = strainResultant_from_element ;
 
-  static Vector strain(numFibers) ;
+  thread_local Vector strain(numFibers) ;
 
   int success = 0 ;
 
@@ -318,7 +317,7 @@ const Vector& DoubleMembranePlateFiberSection::getSectionDeformation( )
 const Vector&  DoubleMembranePlateFiberSection::getStressResultant( )
 {
 
-  static Vector stress(numFibers) ;
+  thread_local Vector stress(numFibers) ;
 
   int i ;
 
@@ -391,11 +390,11 @@ const Vector&  DoubleMembranePlateFiberSection::getStressResultant( )
 //send back the tangent 
 const Matrix&  DoubleMembranePlateFiberSection::getSectionTangent( )
 {
-  static Matrix dd(5,5) ;
+  thread_local Matrix dd(5,5) ;
 
-  static Matrix Aeps(5,8) ;
+  thread_local Matrix Aeps(5,8) ;
 
-  static Matrix Asig(8,5) ;
+  thread_local Matrix Asig(8,5) ;
 
   int i ;
 
@@ -730,7 +729,7 @@ DoubleMembranePlateFiberSection::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(2*numFibers+1);
+  ID idData(2*numFibers+1);
   
   int i;
   for (i = 0; i < numFibers; i++) {
@@ -775,7 +774,7 @@ DoubleMembranePlateFiberSection::recvSelf(int commitTag, Channel &theChannel, FE
   
   int dataTag = this->getDbTag();
 
-  static ID idData(2*numFibers+1);
+  ID idData(2*numFibers+1);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
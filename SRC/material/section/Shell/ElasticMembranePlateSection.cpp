@@ -18,9 +18,20 @@
 
 const double ElasticMembranePlateSection::five6 = 5.0/6.0 ; // shear correction
 
-Vector  ElasticMembranePlateSection::stress(8) ;
-Matrix  ElasticMembranePlateSection::tangent(8,8) ;
-ID      ElasticMembranePlateSection::array(8) ;
+thread_local Vector  ElasticMembranePlateSection::stress(8) ;
+thread_local Matrix  ElasticMembranePlateSection::tangent(8,8) ;
+static int type_array[] = {
+  SECTION_RESPONSE_FXX,
+  SECTION_RESPONSE_FYY,
+  SECTION_RESPONSE_FXY,
+  SECTION_RESPONSE_MXX,
+  SECTION_RESPONSE_MYY,
+  SECTION_RESPONSE_MXY,
+  SECTION_RESPONSE_VXZ,
+  SECTION_RESPONSE_VYZ
+};
+
+const ID ElasticMembranePlateSection::array(type_array, 8);
 
 
 ElasticMembranePlateSection::ElasticMembranePlateSection( ) : 
@@ -87,18 +98,6 @@ ElasticMembranePlateSection::getOrder() const
 //send back order of strain in vector form
 const ID& ElasticMembranePlateSection::getType()
 {
-    static bool initialized = false;
-    if (!initialized) {
-        array(0) = SECTION_RESPONSE_FXX;
-        array(1) = SECTION_RESPONSE_FYY;
-        array(2) = SECTION_RESPONSE_FXY;
-        array(3) = SECTION_RESPONSE_MXX;
-        array(4) = SECTION_RESPONSE_MYY;
-        array(5) = SECTION_RESPONSE_MXY;
-        array(6) = SECTION_RESPONSE_VXZ;
-        array(7) = SECTION_RESPONSE_VYZ;
-        initialized = true;
-    }
     return array;
 }
 
@@ -308,7 +307,7 @@ int
 ElasticMembranePlateSection::sendSelf(int cTag, Channel &theChannel) 
 {
   int res = 0;
-  static Vector data(6);
+  Vector data(6);
   data(0) = this->getTag();
   data(1) = Em;
   data(2) = nu;
@@ -329,7 +328,7 @@ ElasticMembranePlateSection::recvSelf(int cTag, Channel &theChannel,
 				      FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(6);
+  Vector data(6);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) 
     opserr << "ElasticMembranePlateSection::recvSelf() - failed to recv data\n";
@@ -121,11 +121,11 @@ class ElasticMembranePlateSection : public SectionForceDeformation{
 
     Vector strain ;
 
-    static Vector stress ;
+    static thread_local Vector stress ;
 
-    static Matrix tangent ;
+    static thread_local Matrix tangent ;
 
-    static ID array ;  
+    static const ID array;  
 
 } ; //end of ElasticMembranePlateSection declarations
 
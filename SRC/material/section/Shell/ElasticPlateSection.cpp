@@ -68,9 +68,17 @@ OPS_ADD_RUNTIME_VPV(OPS_ElasticPlateSection)
 const double ElasticPlateSection::five6 = 5.0/6.0 ; //shear correction
 
 //static vector and matrices
-Vector ElasticPlateSection::stress(5) ;
-Matrix ElasticPlateSection::tangent(5,5) ;
-ID     ElasticPlateSection::array(5) ;
+thread_local Vector ElasticPlateSection::stress(5) ;
+thread_local Matrix ElasticPlateSection::tangent(5,5) ;
+static int type_array[] = {
+  SECTION_RESPONSE_MXX,
+  SECTION_RESPONSE_MYY,
+  SECTION_RESPONSE_MXY,
+  SECTION_RESPONSE_VXZ,
+  SECTION_RESPONSE_VYZ
+};
+
+const ID ElasticPlateSection::array(type_array, 5);
 
 
 //null constructor
@@ -126,15 +134,6 @@ int ElasticPlateSection::getOrder( ) const
 //send back order of strain in vector form
 const ID& ElasticPlateSection::getType( ) 
 {
-    static bool initialized = false;
-    if (!initialized) {
-        array(0) = SECTION_RESPONSE_MXX;
-        array(1) = SECTION_RESPONSE_MYY;
-        array(2) = SECTION_RESPONSE_MXY;
-        array(3) = SECTION_RESPONSE_VXZ;
-        array(4) = SECTION_RESPONSE_VYZ;
-        initialized = true;
-    }
     return array;
 }
 
@@ -283,7 +282,7 @@ int
 ElasticPlateSection::sendSelf(int cTag, Channel &theChannel) 
 {
   int res = 0;
-  static Vector data(4);
+  Vector data(4);
   data(0) = this->getTag();
   data(1) = E;
   data(2) = nu;
@@ -301,7 +300,7 @@ int
 ElasticPlateSection::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(4);
+  Vector data(4);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) 
     opserr << "ElasticPlateSection::recvSelf() - failed to recv data\n";
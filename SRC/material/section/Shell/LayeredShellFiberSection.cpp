@@ -137,14 +137,23 @@ void * OPS_ADD_RUNTIME_VPV(OPS_LayeredShellFiberSection)
 }
 
 //static vector and matrices
-Vector  LayeredShellFiberSection::stressResultant(8) ;
-Matrix  LayeredShellFiberSection::tangent(8,8) ;
-ID      LayeredShellFiberSection::array(8) ;
+static int type_array[] = {
+  SECTION_RESPONSE_FXX,
+  SECTION_RESPONSE_FYY,
+  SECTION_RESPONSE_FXY,
+  SECTION_RESPONSE_MXX,
+  SECTION_RESPONSE_MYY,
+  SECTION_RESPONSE_MXY,
+  SECTION_RESPONSE_VXZ,
+  SECTION_RESPONSE_VYZ
+};
+
+const ID LayeredShellFiberSection::array(type_array, 8);
 
 //null constructor
 LayeredShellFiberSection::LayeredShellFiberSection( ) : 
 SectionForceDeformation( 0, SEC_TAG_LayeredShellFiberSection ), 
-strainResultant(8), nLayers(0)
+strainResultant(8), stressResultant(8), tangent(8,8), nLayers(0)
 {
 
 }
@@ -156,7 +165,7 @@ LayeredShellFiberSection::LayeredShellFiberSection(
                                    double *thickness, 
                                    NDMaterial **fibers ) :
 SectionForceDeformation( tag, SEC_TAG_LayeredShellFiberSection ),
-strainResultant(8)
+strainResultant(8), stressResultant(8), tangent(8,8)
 {
   this->nLayers = iLayers;
   sg = new double[iLayers];
@@ -185,6 +194,10 @@ strainResultant(8)
     sg[i] = currLoc * h1 - 1.0;
     currLoc = currLoc + thickness[i];
   }
+
+  layers.setLayers(nLayers, theFibers, 5);
+  layers.update();
+  this->formResultants();
 }
 
 //destructor
@@ -237,18 +250,6 @@ int LayeredShellFiberSection::getOrder( ) const
 //send back order of strainResultant in vector form
 const ID& LayeredShellFiberSection::getType( ) 
 {
-    static bool initialized = false;
-    if (!initialized) {
-        array(0) = SECTION_RESPONSE_FXX;
-        array(1) = SECTION_RESPONSE_FYY;
-        array(2) = SECTION_RESPONSE_FXY;
-        array(3) = SECTION_RESPONSE_MXX;
-        array(4) = SECTION_RESPONSE_MYY;
-        array(5) = SECTION_RESPONSE_MXY;
-        array(6) = SECTION_RESPONSE_VXZ;
-        array(7) = SECTION_RESPONSE_VYZ;
-        initialized = true;
-    }
     return array;
 }
 
@@ -273,6 +274,9 @@ int LayeredShellFiberSection::revertToLastCommit( )
   for (int i = 0; i < nLayers; i++ )
     success += theFibers[i]->revertToLastCommit( ) ;
 
+  layers.update( ) ;
+  this->formResultants( ) ;
+
   return success ;
 }
 
@@ -284,6 +288,9 @@ int LayeredShellFiberSection::revertToStart( )
   for (int i = 0; i < nLayers; i++ )
     success += theFibers[i]->revertToStart( ) ;
 
+  layers.update( ) ;
+  this->formResultants( ) ;
+
   return success ;
 }
 
@@ -352,32 +359,31 @@ setTrialSectionDeformation( const Vector &strainResultant_from_element)
 {
   this->strainResultant = strainResultant_from_element ;
 
-  static Vector strain(5) ;
-
-  int success = 0 ;
-
-  int i ;
-
   double z ;
 
-  for ( i = 0; i < nLayers; i++ ) {
+  for ( int i = 0; i < nLayers; i++ ) {
 
       z = ( 0.5*h ) * sg[i] ;
-  
-      strain(0) =  strainResultant(0)  - z*strainResultant(3) ;
 
-      strain(1) =  strainResultant(1)  - z*strainResultant(4) ;
+      double *strain = layers.strain( i ) ;
 
-      strain(2) =  strainResultant(2)  - z*strainResultant(5) ;
+      strain[0] =  strainResultant(0)  - z*strainResultant(3) ;
 
-      strain(3) =  strainResultant(6) ;
+      strain[1] =  strainResultant(1)  - z*strainResultant(4) ;
 
-      strain(4) =  strainResultant(7) ;
-  
-      success += theFibers[i]->setTrialStrain( strain ) ;
+      strain[2] =  strainResultant(2)  - z*strainResultant(5) ;
+
+      strain[3] =  strainResultant(6) ;
+
+      strain[4] =  strainResultant(7) ;
 
   } //end for i
 
+  //evaluate the fibers of each material class in one batch
+  int success = layers.setTrialStrains( ) ;
+
+  this->formResultants( ) ;
+
   return success ;
 }
 
@@ -392,211 +398,67 @@ const Vector& LayeredShellFiberSection::getSectionDeformation( )
 //send back the stressResultant 
 const Vector&  LayeredShellFiberSection::getStressResultant( )
 {
-
-  static Vector stress(5) ;
-
-  int i ;
-
-  double z, weight ;
-
-  stressResultant.Zero( ) ;
-
-  for ( i = 0; i < nLayers; i++ ) {
-
-      z = ( 0.5*h ) * sg[i] ;
-
-      weight = ( 0.5*h ) * wg[i] ;
-
-      stress = theFibers[i]->getStress( ) ;
-  
-      //membrane
-      stressResultant(0)  +=  stress(0)*weight ;
-
-      stressResultant(1)  +=  stress(1)*weight ;
-
-      stressResultant(2)  +=  stress(2)*weight ;
-
-      //bending moments
-      stressResultant(3)  +=  ( z*stress(0) ) * weight ;
-
-      stressResultant(4)  +=  ( z*stress(1) ) * weight ;
-
-      stressResultant(5)  +=  ( z*stress(2) ) * weight ;
-
-      //shear
-      stressResultant(6)  += stress(3)*weight ;
-
-      stressResultant(7)  += stress(4)*weight ;
-  
-  } //end for i
-
-   return this->stressResultant ;
+  return this->stressResultant ;
 }
 
 
 //send back the tangent 
 const Matrix&  LayeredShellFiberSection::getSectionTangent( )
 {
-  static Matrix dd(5,5) ;
-
-//  static Matrix Aeps(5,8) ;
-
-//  static Matrix Asig(8,5) ;
-
-  int i ;
-
-  double z, weight ;
-
-  tangent.Zero( ) ;
-
-  for ( i = 0; i < nLayers; i++ ) {
-
-      z = ( 0.5*h ) * sg[i] ;
-
-      weight = (0.5*h) * wg[i] ;
+  return this->tangent ;
+}
 
-/*      //compute Aeps
 
-      Aeps.Zero( ) ;
+//accumulate the stress resultants and tangent over the layers
+//
+// Section component k takes the layer component comp[k], with the factor
+// 1 or z on the stress and 1 or -z on the strain, so that
+//
+//   stressResultant(k) = sum weight*fs[k]*stress[comp[k]]
+//   tangent(k,l)       = sum weight*fs[k]*fe[l]*dd(comp[k],comp[l])
+//
+// which is Asig * dd * Aeps
+void  LayeredShellFiberSection::formResultants( )
+{
+  static constexpr int comp[8] = {0, 1, 2, 0, 1, 2, 3, 4} ;
 
-      Aeps(0,0) = 1.0 ;
-      Aeps(0,3) = -z ;
+  double sr[8] = {0.0} ;
 
-      Aeps(1,1) = 1.0 ;
-      Aeps(1,4) = -z ;
+  double kt[8][8] = {{0.0}} ;
 
-      Aeps(2,2) = 1.0 ;
-      Aeps(2,5) = -z ;
+  for ( int i = 0; i < nLayers; i++ ) {
 
-      Aeps(3,6) = root56 ;
-      Aeps(4,7) = root56 ;
+      double z = ( 0.5*h ) * sg[i] ;
 
-      //compute Asig
+      double weight = ( 0.5*h ) * wg[i] ;
 
-      Asig.Zero( ) ;
+      const double fs[8] = {weight, weight, weight, z*weight, z*weight, z*weight, weight, weight} ;
 
-      Asig(0,0) = 1.0 ;
-      Asig(3,0) = z ;
+      const double fe[8] = {1.0, 1.0, 1.0, -z, -z, -z, 1.0, 1.0} ;
 
-      Asig(1,1) = 1.0 ;
-      Asig(4,1) = z ;
+      const double *stress = layers.stress( i ) ;
 
-      Asig(2,2) = 1.0 ;
-      Asig(5,2) = z ;
+      const double *dd = layers.tangent( i ) ;
 
-      Asig(6,3) = root56 ;
-      Asig(7,4) = root56 ;
-*/
+      for ( int k = 0; k < 8; k++ ) {
 
-      //compute the tangent
+          sr[k] += fs[k]*stress[comp[k]] ;
 
-      dd = theFibers[i]->getTangent( ) ;
+          const double *ddk = dd + 5*comp[k] ;
 
-      dd *= weight ;
+          for ( int l = 0; l < 8; l++ )
+              kt[k][l] += fs[k]*fe[l]*ddk[comp[l]] ;
+      }
 
-      //tangent +=  ( Asig * dd * Aeps ) ;   
+  } //end for i
 
-//from MATLAB : tangent = 
-//[      d11,           d12,           d13,        -z*d11,        -z*d12,        -z*d13,    d14,    d15]
-//[      d21,           d22,           d23,        -z*d21,        -z*d22,        -z*d23,    d24,    d25]
-//[      d31,           d32,           d33,        -z*d31,        -z*d32,        -z*d33,    d34,    d35]
-//[     z*d11,         z*d12,         z*d13,      -z^2*d11,      -z^2*d12,      -z^2*d13,  z*d14,  z*d15]
-//[     z*d21,         z*d22,         z*d23,      -z^2*d21,      -z^2*d22,      -z^2*d23,  z*d24,  z*d25]
-//[     z*d31,         z*d32,         z*d33,      -z^2*d31,      -z^2*d32,      -z^2*d33,  z*d34,  z*d35]
-//[       d41,           d42,           d43,        -d41*z,        -d42*z,        -d43*z,    d44,    d45]
-//[       d51,           d52,           d53,        -d51*z,        -d52*z,        -d53*z,    d54,    d55]
- 
-      //row 1
-//[      d11,           d12,           d13,        -z*d11,        -z*d12,        -z*d13,    d14,    d15]
-      tangent(0,0) +=     dd(0,0) ;
-      tangent(0,1) +=     dd(0,1) ;
-      tangent(0,2) +=     dd(0,2) ;      
-      tangent(0,3) +=  -z*dd(0,0) ;      
-      tangent(0,4) +=  -z*dd(0,1) ;
-      tangent(0,5) +=  -z*dd(0,2) ;
-      tangent(0,6) +=     dd(0,3) ;
-      tangent(0,7) +=     dd(0,4) ;
-
-      //row 2
-//[      d21,           d22,           d23,        -z*d21,        -z*d22,        -z*d23,    d24,    d25]
-      tangent(1,0) +=     dd(1,0) ;
-      tangent(1,1) +=     dd(1,1) ;
-      tangent(1,2) +=     dd(1,2) ;      
-      tangent(1,3) +=  -z*dd(1,0) ;      
-      tangent(1,4) +=  -z*dd(1,1) ;
-      tangent(1,5) +=  -z*dd(1,2) ;
-      tangent(1,6) +=     dd(1,3) ;
-      tangent(1,7) +=     dd(1,4) ;
-
-      //row 3
-//[      d31,           d32,           d33,        -z*d31,        -z*d32,        -z*d33,    d34,    d35]
-      tangent(2,0) +=     dd(2,0) ;
-      tangent(2,1) +=     dd(2,1) ;
-      tangent(2,2) +=     dd(2,2) ;      
-      tangent(2,3) +=  -z*dd(2,0) ;      
-      tangent(2,4) +=  -z*dd(2,1) ;
-      tangent(2,5) +=  -z*dd(2,2) ;
-      tangent(2,6) +=     dd(2,3) ;
-      tangent(2,7) +=     dd(2,4) ;
-
-      //row 4
-//[     z*d11,         z*d12,         z*d13,      -z^2*d11,      -z^2*d12,      -z^2*d13,  z*d14,  z*d15]
-      tangent(3,0) +=     z*dd(0,0) ;
-      tangent(3,1) +=     z*dd(0,1) ;
-      tangent(3,2) +=     z*dd(0,2) ;      
-      tangent(3,3) +=  -z*z*dd(0,0) ;      
-      tangent(3,4) +=  -z*z*dd(0,1) ;
-      tangent(3,5) +=  -z*z*dd(0,2) ;
-      tangent(3,6) +=     z*dd(0,3) ;
-      tangent(3,7) +=     z*dd(0,4) ;
-
-      //row 5
-//[     z*d21,         z*d22,         z*d23,      -z^2*d21,      -z^2*d22,      -z^2*d23,  z*d24,  z*d25]
-      tangent(4,0) +=     z*dd(1,0) ;
-      tangent(4,1) +=     z*dd(1,1) ;
-      tangent(4,2) +=     z*dd(1,2) ;      
-      tangent(4,3) +=  -z*z*dd(1,0) ;      
-      tangent(4,4) +=  -z*z*dd(1,1) ;
-      tangent(4,5) +=  -z*z*dd(1,2) ;
-      tangent(4,6) +=     z*dd(1,3) ;
-      tangent(4,7) +=     z*dd(1,4) ;
-
-      //row 6
-//[     z*d31,         z*d32,         z*d33,      -z^2*d31,      -z^2*d32,      -z^2*d33,  z*d34,  z*d35]
-      tangent(5,0) +=     z*dd(2,0) ;
-      tangent(5,1) +=     z*dd(2,1) ;
-      tangent(5,2) +=     z*dd(2,2) ;      
-      tangent(5,3) +=  -z*z*dd(2,0) ;      
-      tangent(5,4) +=  -z*z*dd(2,1) ;
-      tangent(5,5) +=  -z*z*dd(2,2) ;
-      tangent(5,6) +=     z*dd(2,3) ;
-      tangent(5,7) +=     z*dd(2,4) ;
-
-      //row 7
-//[  d41,    d42,    d43, -d41*z, -d42*z, -d43*z,  d44,  d45]
-      tangent(6,0) +=     dd(3,0) ;
-      tangent(6,1) +=     dd(3,1) ;
-      tangent(6,2) +=     dd(3,2) ;      
-      tangent(6,3) +=  -z*dd(3,0) ;      
-      tangent(6,4) +=  -z*dd(3,1) ;
-      tangent(6,5) +=  -z*dd(3,2) ;
-      tangent(6,6) +=     dd(3,3) ;
-      tangent(6,7) +=     dd(3,4) ;
-
-      //row 8 
-//[  d51,    d52,    d53, -d51*z, -d52*z, -d53*z,  d54,  d55]
-      tangent(7,0) +=     dd(4,0) ;
-      tangent(7,1) +=     dd(4,1) ;
-      tangent(7,2) +=     dd(4,2) ;      
-      tangent(7,3) +=  -z*dd(4,0) ;      
-      tangent(7,4) +=  -z*dd(4,1) ;
-      tangent(7,5) +=  -z*dd(4,2) ;
-      tangent(7,6) +=     dd(4,3) ;
-      tangent(7,7) +=     dd(4,4) ;
+  for ( int k = 0; k < 8; k++ ) {
 
-  } //end for i
+      stressResultant(k) = sr[k] ;
 
-  return this->tangent ;
+      for ( int l = 0; l < 8; l++ )
+          tangent(k,l) = kt[k][l] ;
+  }
 }
 
 
@@ -639,7 +501,7 @@ LayeredShellFiberSection::sendSelf(int commitTag, Channel &theChannel)
 
   int dataTag = this->getDbTag();
 
-  static ID iData(3);
+  ID iData(3);
   iData(0) = this->getTag();
   iData(1) = nLayers;
 
@@ -706,7 +568,7 @@ LayeredShellFiberSection::recvSelf(int commitTag, Channel &theChannel, FEM_Objec
   
   int dataTag = this->getDbTag();
 
-  static ID iData(3);
+  ID iData(3);
   res += theChannel.recvID(dataTag, commitTag, iData);
 
   if (res < 0) {
@@ -777,6 +639,10 @@ LayeredShellFiberSection::recvSelf(int commitTag, Channel &theChannel, FEM_Objec
         return res;
       }
     }
+
+    layers.setLayers(nLayers, theFibers, 5);
+    layers.update();
+    this->formResultants();
   }
     
   return res;
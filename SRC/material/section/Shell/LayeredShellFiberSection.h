@@ -38,6 +38,7 @@ Earthquake Engineering & Structural Dynamics, 2013, 42(5): 705-723*/
 #include <Matrix.h>
 #include <ID.h>
 #include <NDMaterial.h>
+#include <NDMaterialBatch.h>
 
 #include <SectionForceDeformation.h>
 
@@ -110,6 +111,9 @@ class LayeredShellFiberSection : public SectionForceDeformation{
 
   private :
 
+    //accumulate the resultants from the packed layer states
+    void formResultants( ) ;
+
     int nLayers;
     //quadrature data
     double *sg;
@@ -119,13 +123,15 @@ class LayeredShellFiberSection : public SectionForceDeformation{
 
     NDMaterial **theFibers;  //pointers to the materials (fibers)
 
+    NDMaterialBatch layers;  //packed strains, stresses and tangents of the fibers
+
     Vector strainResultant ;
 
-    static Vector stressResultant ;
+    Vector stressResultant ;
 
-    static Matrix tangent ;
+    Matrix tangent ;
 
-    static ID array ;  
+    static const ID array;  
 
 } ; //end of LayeredShellFiberSection declarations
 
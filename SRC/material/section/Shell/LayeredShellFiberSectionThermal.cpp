@@ -40,9 +40,20 @@ typedef SensitiveResponse<SectionForceDeformation> SectionResponse;
 #include <Information.h>
 
 //static vector and matrices
-Vector  LayeredShellFiberSectionThermal::stressResultant(8) ;
-Matrix  LayeredShellFiberSectionThermal::tangent(8,8) ;
-ID      LayeredShellFiberSectionThermal::array(8) ;
+thread_local Vector  LayeredShellFiberSectionThermal::stressResultant(8) ;
+thread_local Matrix  LayeredShellFiberSectionThermal::tangent(8,8) ;
+static int type_array[] = {
+  SECTION_RESPONSE_FXX,
+  SECTION_RESPONSE_FYY,
+  SECTION_RESPONSE_FXY,
+  SECTION_RESPONSE_MXX,
+  SECTION_RESPONSE_MYY,
+  SECTION_RESPONSE_MXY,
+  SECTION_RESPONSE_VXZ,
+  SECTION_RESPONSE_VYZ
+};
+
+const ID LayeredShellFiberSectionThermal::array(type_array, 8);
 //const double  LayeredShellFiberSectionThermal::root56 = sqrt(5.0/6.0) ; //shear correction
 const double  LayeredShellFiberSectionThermal::root56 = 1 ; //shear correction
 //null constructor
@@ -141,18 +152,6 @@ int LayeredShellFiberSectionThermal::getOrder( ) const
 //send back order of strainResultant in vector form
 const ID& LayeredShellFiberSectionThermal::getType( ) 
 {
-    static bool initialized = false;
-    if (!initialized) {
-        array(0) = SECTION_RESPONSE_FXX;
-        array(1) = SECTION_RESPONSE_FYY;
-        array(2) = SECTION_RESPONSE_FXY;
-        array(3) = SECTION_RESPONSE_MXX;
-        array(4) = SECTION_RESPONSE_MYY;
-        array(5) = SECTION_RESPONSE_MXY;
-        array(6) = SECTION_RESPONSE_VXZ;
-        array(7) = SECTION_RESPONSE_VYZ;
-        initialized = true;
-    }
     return array;
 }
 
@@ -257,7 +256,7 @@ setTrialSectionDeformation( const Vector &strainResultant_from_element)
  
   this->strainResultant = strainResultant_from_element ;
 
-  static Vector strain(6) ;
+  thread_local Vector strain(6) ;
 
   int success = 0 ;
 
@@ -366,7 +365,7 @@ LayeredShellFiberSectionThermal::getTemperatureStress(const Vector& dataMixed)
 const Vector&  LayeredShellFiberSectionThermal::getStressResultant( )
 {
 
-  static Vector stress(5) ;
+  thread_local Vector stress(5) ;
 
   int i ;
 
@@ -415,7 +414,7 @@ const Vector&  LayeredShellFiberSectionThermal::getStressResultant( )
 //send back the tangent 
 const Matrix&  LayeredShellFiberSectionThermal::getSectionTangent( )
 {
-  static Matrix dd(5,5) ;
+  thread_local Matrix dd(5,5) ;
 
 //  static Matrix Aeps(5,8) ;
 
@@ -599,7 +598,7 @@ LayeredShellFiberSectionThermal::sendSelf(int commitTag, Channel &theChannel)
 
   int dataTag = this->getDbTag();
 
-  static ID iData(3);
+  ID iData(3);
   iData(0) = this->getTag();
   iData(1) = nLayers;
 
@@ -666,7 +665,7 @@ LayeredShellFiberSectionThermal::recvSelf(int commitTag, Channel &theChannel, FE
   
   int dataTag = this->getDbTag();
 
-  static ID iData(3);
+  ID iData(3);
   res += theChannel.recvID(dataTag, commitTag, iData);
 
   if (res < 0) {
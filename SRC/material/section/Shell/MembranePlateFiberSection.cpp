@@ -66,9 +66,20 @@ void * OPS_ADD_RUNTIME_VPV(OPS_MembranePlateFiberSection)
 const double MembranePlateFiberSection::root56 = sqrt(5.0/6.0) ; //shear correction
 
 //static vector and matrices
-Vector  MembranePlateFiberSection::stressResultant(8) ;
-Matrix  MembranePlateFiberSection::tangent(8,8) ;
-ID      MembranePlateFiberSection::array(8) ;
+thread_local Vector  MembranePlateFiberSection::stressResultant(8) ;
+thread_local Matrix  MembranePlateFiberSection::tangent(8,8) ;
+static int type_array[] = {
+  SECTION_RESPONSE_FXX,
+  SECTION_RESPONSE_FYY,
+  SECTION_RESPONSE_FXY,
+  SECTION_RESPONSE_MXX,
+  SECTION_RESPONSE_MYY,
+  SECTION_RESPONSE_MXY,
+  SECTION_RESPONSE_VXZ,
+  SECTION_RESPONSE_VYZ
+};
+
+const ID MembranePlateFiberSection::array(type_array, 8);
 
 
 const double  MembranePlateFiberSection::sg[] = { -1, 
@@ -163,18 +174,6 @@ int MembranePlateFiberSection::getOrder( ) const
 //send back order of strainResultant in vector form
 const ID& MembranePlateFiberSection::getType( ) 
 {
-    static bool initialized = false;
-    if (!initialized) {
-        array(0) = SECTION_RESPONSE_FXX;
-        array(1) = SECTION_RESPONSE_FYY;
-        array(2) = SECTION_RESPONSE_FXY;
-        array(3) = SECTION_RESPONSE_MXX;
-        array(4) = SECTION_RESPONSE_MYY;
-        array(5) = SECTION_RESPONSE_MXY;
-        array(6) = SECTION_RESPONSE_VXZ;
-        array(7) = SECTION_RESPONSE_VYZ;
-        initialized = true;
-    }
     return array;
 }
 
@@ -247,7 +246,7 @@ setTrialSectionDeformation( const Vector &strainResultant_from_element)
 {
   this->strainResultant = strainResultant_from_element ;
 
-  static Vector strain(numFibers) ;
+  thread_local Vector strain(numFibers) ;
 
   int success = 0 ;
 
@@ -288,7 +287,7 @@ const Vector& MembranePlateFiberSection::getSectionDeformation( )
 const Vector&  MembranePlateFiberSection::getStressResultant( )
 {
 
-  static Vector stress(numFibers) ;
+  thread_local Vector stress(numFibers) ;
 
   int i ;
 
@@ -336,11 +335,11 @@ const Vector&  MembranePlateFiberSection::getStressResultant( )
 //send back the tangent 
 const Matrix&  MembranePlateFiberSection::getSectionTangent( )
 {
-  static Matrix dd(5,5) ;
+  thread_local Matrix dd(5,5) ;
 
-  static Matrix Aeps(5,8) ;
+  thread_local Matrix Aeps(5,8) ;
 
-  static Matrix Asig(8,5) ;
+  thread_local Matrix Asig(8,5) ;
 
   int i ;
 
@@ -544,7 +543,7 @@ MembranePlateFiberSection::sendSelf(int commitTag, Channel &theChannel)
   // object - don't want to have to do the check if sending data
   int dataTag = this->getDbTag();
   
-  static Vector vectData(1);
+  Vector vectData(1);
   vectData(0) = h;
 
   res += theChannel.sendVector(dataTag, commitTag, vectData);
@@ -556,7 +555,7 @@ MembranePlateFiberSection::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(2*numFibers+1);
+  ID idData(2*numFibers+1);
   
   int i;
   for (i = 0; i < numFibers; i++) {
@@ -601,7 +600,7 @@ MembranePlateFiberSection::recvSelf(int commitTag, Channel &theChannel, FEM_Obje
   
   int dataTag = this->getDbTag();
 
-  static Vector vectData(1);
+  Vector vectData(1);
   res += theChannel.recvVector(dataTag, commitTag, vectData);
 
   if (res < 0) {
@@ -611,7 +610,7 @@ MembranePlateFiberSection::recvSelf(int commitTag, Channel &theChannel, FEM_Obje
 
   h = vectData(0);
 
-  static ID idData(2*numFibers+1);
+  ID idData(2*numFibers+1);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -43,9 +43,20 @@ typedef SensitiveResponse<SectionForceDeformation> SectionResponse;
 const double MembranePlateFiberSectionThermal::root56 = sqrt(5.0/6.0) ; //shear correction
 
 //static vector and matrices
-Vector  MembranePlateFiberSectionThermal::stressResultant(8) ;
-Matrix  MembranePlateFiberSectionThermal::tangent(8,8) ;
-ID      MembranePlateFiberSectionThermal::array(8) ;
+thread_local Vector  MembranePlateFiberSectionThermal::stressResultant(8) ;
+thread_local Matrix  MembranePlateFiberSectionThermal::tangent(8,8) ;
+static int type_array[] = {
+  SECTION_RESPONSE_FXX,
+  SECTION_RESPONSE_FYY,
+  SECTION_RESPONSE_FXY,
+  SECTION_RESPONSE_MXX,
+  SECTION_RESPONSE_MYY,
+  SECTION_RESPONSE_MXY,
+  SECTION_RESPONSE_VXZ,
+  SECTION_RESPONSE_VYZ
+};
+
+const ID MembranePlateFiberSectionThermal::array(type_array, 8);
 
 
 const double  MembranePlateFiberSectionThermal::sg[] = { -1, 
@@ -150,18 +161,6 @@ int MembranePlateFiberSectionThermal::getOrder( ) const
 //send back order of strainResultant in vector form
 const ID& MembranePlateFiberSectionThermal::getType( ) 
 {
-    static bool initialized = false;
-    if (!initialized) {
-        array(0) = SECTION_RESPONSE_FXX;
-        array(1) = SECTION_RESPONSE_FYY;
-        array(2) = SECTION_RESPONSE_FXY;
-        array(3) = SECTION_RESPONSE_MXX;
-        array(4) = SECTION_RESPONSE_MYY;
-        array(5) = SECTION_RESPONSE_MXY;
-        array(6) = SECTION_RESPONSE_VXZ;
-        array(7) = SECTION_RESPONSE_VYZ;
-        initialized = true;
-    }
     return array;
 }
 
@@ -244,7 +243,7 @@ setTrialSectionDeformation( const Vector &strainResultant_from_element)
   seestrain[6] = strainResultant(6);
   seestrain[7] = strainResultant(7);
 
-  static Vector strain(5) ;
+  thread_local Vector strain(5) ;
 
   int success = 0 ;
 
@@ -300,7 +299,7 @@ const Vector& MembranePlateFiberSectionThermal::getSectionDeformation( )
 const Vector&  MembranePlateFiberSectionThermal::getStressResultant( )
 {
 
-  static Vector stress(5) ;
+  thread_local Vector stress(5) ;
 
   int i ;
 
@@ -441,11 +440,11 @@ MembranePlateFiberSectionThermal::getTemperatureStress(const Vector& dataMixed)
 //send back the tangent 
 const Matrix&  MembranePlateFiberSectionThermal::getSectionTangent( )
 {
-  static Matrix dd(5,5) ;
+  thread_local Matrix dd(5,5) ;
 
-  static Matrix Aeps(5,8) ;
+  thread_local Matrix Aeps(5,8) ;
 
-  static Matrix Asig(8,5) ;
+  thread_local Matrix Asig(8,5) ;
 
   int i ;
 
@@ -633,7 +632,7 @@ MembranePlateFiberSectionThermal::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(11);
+  ID idData(11);
   
   int i;
   for (i = 0; i < 5; i++) {
@@ -678,7 +677,7 @@ MembranePlateFiberSectionThermal::recvSelf(int commitTag, Channel &theChannel, F
   
   int dataTag = this->getDbTag();
 
-  static ID idData(11);
+  ID idData(11);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
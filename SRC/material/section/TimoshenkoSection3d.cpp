@@ -41,7 +41,16 @@ typedef SensitiveResponse<SectionForceDeformation> SectionResponse;
 
 #define SEC_TAG_TimoshenkoSection3d 1976
 
-ID TimoshenkoSection3d::code(6);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_MZ,
+  SECTION_RESPONSE_MY,
+  SECTION_RESPONSE_VZ,
+  SECTION_RESPONSE_VY,
+  SECTION_RESPONSE_T
+};
+
+const ID TimoshenkoSection3d::code(code_array, 6);
 
 // constructors:
 TimoshenkoSection3d::TimoshenkoSection3d(int tag, int num, NDMaterial **fibers,
@@ -91,13 +100,6 @@ TimoshenkoSection3d::TimoshenkoSection3d(int tag, int num, NDMaterial **fibers,
 
   for (int i=0; i<36; i++)
     kData[i] = 0.0;
-
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_VZ;
-  code(4) = SECTION_RESPONSE_VY;
-  code(5) = SECTION_RESPONSE_T;
 }
 
 // constructor for blank object that recvSelf needs to be invoked upon
@@ -118,13 +120,6 @@ TimoshenkoSection3d::TimoshenkoSection3d():
 
   for (int i=0; i<36; i++)
     kData[i] = 0.0;
-
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_VZ;
-  code(4) = SECTION_RESPONSE_VY;
-  code(5) = SECTION_RESPONSE_T;
 }
 
 // destructor:
@@ -446,7 +441,7 @@ TimoshenkoSection3d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 3 so no conflict with matData below if just 1 fiber
-  static ID data(3);
+  ID data(3);
   data(0) = this->getTag();
   data(1) = numFibers;
   int dbTag = this->getDbTag();
@@ -500,7 +495,7 @@ TimoshenkoSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(3);
+  ID data(3);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
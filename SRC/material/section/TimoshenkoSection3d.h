@@ -83,7 +83,7 @@ class TimoshenkoSection3d : public SectionForceDeformation
     double yBar;       // Section centroid
     double zBar;
   
-    static ID code;
+    static const ID code;
 
     Vector e;          // trial section deformations 
     Vector *s;         // section resisting forces  (axial force, bending moment)
@@ -41,9 +41,18 @@
 #include <FEM_ObjectBroker.h>
 #include <NDMaterial.h>
 
-ID WSection2d::code(6);
-Vector WSection2d::s(6);
-Matrix WSection2d::ks(6,6);
+static int code_array[] = {
+  SECTION_RESPONSE_P,
+  SECTION_RESPONSE_MZ,
+  SECTION_RESPONSE_MY,
+  SECTION_RESPONSE_VY,
+  SECTION_RESPONSE_VZ,
+  SECTION_RESPONSE_T
+};
+
+const ID WSection2d::code(code_array, 6);
+thread_local Vector WSection2d::s(6);
+thread_local Matrix WSection2d::ks(6,6);
 
 // constructors:
 WSection2d::WSection2d(int tag, NDMaterial &theMat,
@@ -90,13 +99,6 @@ WSection2d::WSection2d(int tag, NDMaterial &theMat,
     AFibers[loc] = a_w;
     yFibers[loc] = yStart - yIncr*count;
   }
-  
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_VY;
-  code(4) = SECTION_RESPONSE_VZ;
-  code(5) = SECTION_RESPONSE_T;
 }
 
 // constructor for blank object that recvSelf needs to be invoked upon
@@ -106,12 +108,6 @@ WSection2d::WSection2d():
   d(0.0), tw(0.0), bf(0.0), tf(0.0),
   nfdw(0), nftf(0), shapeFactor(0.0)
 {
-  code(0) = SECTION_RESPONSE_P;
-  code(1) = SECTION_RESPONSE_MZ;
-  code(2) = SECTION_RESPONSE_MY;
-  code(3) = SECTION_RESPONSE_VY;
-  code(4) = SECTION_RESPONSE_VZ;
-  code(5) = SECTION_RESPONSE_T;
 }
 
 // destructor:
@@ -145,7 +141,7 @@ int WSection2d::setTrialSectionDeformation (const Vector &deforms)
   
   e = deforms; 
   // Material strain vector
-  static Vector eps(3);
+  thread_local Vector eps(3);
 
   double root56 = sqrt(shapeFactor);
 
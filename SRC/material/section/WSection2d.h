@@ -86,10 +86,10 @@ class WSection2d : public SectionForceDeformation
   
   double shapeFactor;
 
-  static ID code;
+  static const ID code;
   
-  static Vector s;  // section resisting forces
-  static Matrix ks; // section stiffness
+  static thread_local Vector s;  // section resisting forces
+  static thread_local Matrix ks; // section stiffness
 };
 
 #endif
@@ -612,7 +612,7 @@ WideFlangeSectionIntegration::Print(OPS_Stream &s, int flag)
 int
 WideFlangeSectionIntegration::sendSelf(int cTag, Channel &theChannel)
 {
-  static Vector data(8);
+  Vector data(8);
 
   data(0) = d;
   data(1) = tw;
@@ -637,7 +637,7 @@ int
 WideFlangeSectionIntegration::recvSelf(int cTag, Channel &theChannel,
 				       FEM_ObjectBroker &theBroker)
 {
-  static Vector data(8);
+  Vector data(8);
 
   int dbTag = this->getDbTag();
 
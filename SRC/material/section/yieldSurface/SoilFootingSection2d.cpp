@@ -18,7 +18,13 @@
 
 #include <classTags.h>
 
-ID SoilFootingSection2d::code(3);
+static int code_array[] = {
+  SECTION_RESPONSE_P,	// vertical load
+  SECTION_RESPONSE_VY,	// shear
+  SECTION_RESPONSE_MZ	// moment
+};
+
+const ID SoilFootingSection2d::code(code_array, 3);
 
 
 
@@ -28,9 +34,6 @@ SoilFootingSection2d::SoilFootingSection2d(void)
    :SectionForceDeformation(0, SEC_TAG_SoilFooting2d),
     e(3), s(3),eCommit(3), sCommit(3), deModel(3), ks(3,3), ksE(3,3), ini_size(3)
 {
-   code(0) = SECTION_RESPONSE_P;   // vertical load
-   code(1) = SECTION_RESPONSE_VY;  // shear
-   code(2) = SECTION_RESPONSE_MZ;  // moment
 }
 
 
@@ -48,9 +51,6 @@ SoilFootingSection2d::SoilFootingSection2d
              <<"FS should satisfy: FS > 1.0\n";
    }
 
-   code(0) = SECTION_RESPONSE_P;   // axial load
-   code(1) = SECTION_RESPONSE_VY;  // shear
-   code(2) = SECTION_RESPONSE_MZ;  // moment
 
    V = Vult / FS;
    qult = Vult/L;
@@ -2017,7 +2017,7 @@ SoilFootingSection2d::getSectionTangent(void)
 const Matrix &
 SoilFootingSection2d::getSectionFlexibility (void)
 {
-  static Matrix fs(3,3);
+  thread_local Matrix fs(3,3);
 //  invert2by2Matrix(ks, fs);
   ks.Invert(fs); 
   return fs;
@@ -2039,7 +2039,7 @@ SoilFootingSection2d::getOrder () const
 const Matrix& 
 SoilFootingSection2d::getInitialTangent()
 {
-  static Matrix IniTan(3,3);
+  thread_local Matrix IniTan(3,3);
                  
   return IniTan;
 }
@@ -127,7 +127,7 @@ class SoilFootingSection2d: public SectionForceDeformation
       double tolerance;
       double soilFree;
 
-      static ID code;
+      static const ID code;
       int isOver, isdV;
       int isElastic;       
       double dTh, dThP;
@@ -13,11 +13,16 @@
 
 #include <classTags.h>
 
-ID      YieldSurfaceSection2d::code(2);
-Vector  YieldSurfaceSection2d::dele(2);
-Vector  YieldSurfaceSection2d::surfaceForce(2);
-Matrix  YieldSurfaceSection2d::G(2,1);
-Matrix  YieldSurfaceSection2d::Ktp(2,2);
+static int code_array[] = {
+  SECTION_RESPONSE_P,	// P is the first quantity
+  SECTION_RESPONSE_MZ	// Mz is the second
+};
+
+const ID YieldSurfaceSection2d::code(code_array, 2);
+thread_local Vector  YieldSurfaceSection2d::dele(2);
+thread_local Vector  YieldSurfaceSection2d::surfaceForce(2);
+thread_local Matrix  YieldSurfaceSection2d::G(2,1);
+thread_local Matrix  YieldSurfaceSection2d::Ktp(2,2);
 
 YieldSurfaceSection2d::YieldSurfaceSection2d(void)
   :SectionForceDeformation(0, SEC_TAG_YieldSurface2d),
@@ -25,8 +30,6 @@ YieldSurfaceSection2d::YieldSurfaceSection2d(void)
    eCommit(2), sCommit(2), ks(2,2),
    use_Kr(true), split_step(false)
 {
-  code(0) = SECTION_RESPONSE_P;	// P is the first quantity
-  code(1) = SECTION_RESPONSE_MZ;  // Mz is the second
 }
 
 YieldSurfaceSection2d::YieldSurfaceSection2d
@@ -36,8 +39,6 @@ YieldSurfaceSection2d::YieldSurfaceSection2d
    eCommit(2), sCommit(2), ks(2,2),
    use_Kr(use_kr), split_step(false)
 {
-  code(0) = SECTION_RESPONSE_P;	// P is the first quantity
-  code(1) = SECTION_RESPONSE_MZ;	// Mz is the second
   
   if(ptrys==0)
     {
@@ -211,7 +212,7 @@ YieldSurfaceSection2d::getSectionTangent(void)
 const Matrix &
 YieldSurfaceSection2d::getSectionFlexibility (void)
 {
-  static Matrix fs(2,2);
+  thread_local Matrix fs(2,2);
   // invert2by2Matrix(ks, fs);
   ks.Invert(fs); 
   return fs;
@@ -58,11 +58,11 @@ class YieldSurfaceSection2d: public SectionForceDeformation
   //    int algo;
   bool use_Kr, split_step;
   
-  static ID code;
-  static Vector dele;
-  static Vector surfaceForce;
-  static Matrix G;
-  static Matrix Ktp;
+  static const ID code;
+  static thread_local Vector dele;
+  static thread_local Vector surfaceForce;
+  static thread_local Matrix G;
+  static thread_local Matrix Ktp;
 };
 
 #endif
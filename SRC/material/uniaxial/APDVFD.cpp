@@ -531,7 +531,7 @@ int
 APDVFD::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(28);
+  Vector data(28);
   data(0) = this->getTag();
 
   // Material properties
@@ -578,7 +578,7 @@ APDVFD::recvSelf(int cTag, Channel &theChannel,
                                FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(28);
+  Vector data(28);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -28,6 +28,7 @@ extern "C" int OPS_ResetInputNoBuilder(ClientData clientData,
 #include <ReeseSandBackbone.h>
 #include <ManderBackbone.h>
 #include <RaynorBackbone.h>
+#include <TabulatedBackbone.h>
 #include <string.h>
 
 extern OPS_Routine OPS_ArctangentBackbone;
@@ -373,6 +374,70 @@ TclCommand_addHystereticBackbone(ClientData clientData,
     theBackbone = 0;
   }
 
+  else if (strcmp(argv[1], "Tabulated") == 0) {
+    if (argc < 5) {
+      opserr << "WARNING insufficient arguments\n";
+      opserr << "Want: hystereticBackbone Tabulated tag? backboneTag? "
+                "strainMax? <-tol tol?> <-maxPoints n?>"
+             << endln;
+      return TCL_ERROR;
+    }
+
+    int tag, bTag;
+    double strainMax;
+    double tol = 1.0e-4;
+    int maxPoints = 1000;
+
+    if (Tcl_GetInt(interp, argv[2], &tag) != TCL_OK) {
+      opserr << "WARNING invalid hystereticBackbone Tabulated tag" << endln;
+      return TCL_ERROR;
+    }
+
+    if (Tcl_GetInt(interp, argv[3], &bTag) != TCL_OK) {
+      opserr << "WARNING invalid hystereticBackbone Tabulated backboneTag"
+             << endln;
+      return TCL_ERROR;
+    }
+
+    if (Tcl_GetDouble(interp, argv[4], &strainMax) != TCL_OK || strainMax <= 0.0) {
+      opserr << "WARNING invalid hystereticBackbone Tabulated strainMax" << endln;
+      return TCL_ERROR;
+    }
+
+    for (int i = 5; i < argc; i++) {
+      if (strcmp(argv[i], "-tol") == 0 && i + 1 < argc) {
+        if (Tcl_GetDouble(interp, argv[++i], &tol) != TCL_OK || tol <= 0.0) {
+          opserr << "WARNING invalid hystereticBackbone Tabulated tol" << endln;
+          return TCL_ERROR;
+        }
+      }
+      else if (strcmp(argv[i], "-maxPoints") == 0 && i + 1 < argc) {
+        if (Tcl_GetInt(interp, argv[++i], &maxPoints) != TCL_OK || maxPoints < 2) {
+          opserr << "WARNING invalid hystereticBackbone Tabulated maxPoints"
+                 << endln;
+          return TCL_ERROR;
+        }
+      }
+      else {
+        opserr << "WARNING unknown hystereticBackbone Tabulated option "
+               << argv[i] << endln;
+        return TCL_ERROR;
+      }
+    }
+
+    HystereticBackbone *backbone =
+        builder->getTypedObject<HystereticBackbone>(bTag);
+
+    if (backbone == 0) {
+      opserr << "WARNING hystereticBackbone does not exist\n";
+      opserr << "hystereticBackbone: " << bTag;
+      opserr << "\nhystereticBackbone Tabulated: " << tag << endln;
+      return TCL_ERROR;
+    }
+
+    theBackbone = new TabulatedBackbone(tag, *backbone, strainMax, tol, maxPoints);
+  }
+
   else if (strcmp(argv[1], "Material") == 0) {
     if (argc < 4) {
       opserr << "WARNING insufficient arguments\n";
@@ -326,7 +326,7 @@ ManderBackbone::sendSelf(int commitTag, Channel &theChannel)
 
   
 
-  static Vector data(4);
+  Vector data(4);
 
   
 
@@ -370,7 +370,7 @@ ManderBackbone::recvSelf(int commitTag, Channel &theChannel,
 
   
 
-  static Vector data(4);
+  Vector data(4);
 
   
 
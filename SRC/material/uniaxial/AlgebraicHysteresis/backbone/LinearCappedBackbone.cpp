@@ -143,7 +143,7 @@ LinearCappedBackbone::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(6);
+  Vector data(6);
   
   data(0) = this->getTag();
   data(1) = eCap;
@@ -158,7 +158,7 @@ LinearCappedBackbone::sendSelf(int cTag, Channel &theChannel)
     return res;
   }
   
-  static ID classTags(2);
+  ID classTags(2);
   
   int clTag = theBackbone->getClassTag();
   int dbTag = theBackbone->getDbTag();
@@ -194,7 +194,7 @@ LinearCappedBackbone::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(6);
+  Vector data(6);
   
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -209,7 +209,7 @@ LinearCappedBackbone::recvSelf(int cTag, Channel &theChannel,
   eRes = data(4);
   sRes = data(5);
   
-  static ID classTags(2);
+  ID classTags(2);
   
   res += theChannel.recvID(this->getDbTag(), cTag, classTags);
   if (res < 0) {
@@ -210,7 +210,7 @@ int LiquefiedSand::getVariable(int varID, double &theValue) { return -1; }
 int LiquefiedSand::sendSelf(int commitTag, Channel &theChannel) {
   int res = 0;
 
-  static Vector data(5);
+  thread_local Vector data(5);
 
   data(0) = this->getTag();
   data(1) = X;
@@ -232,7 +232,7 @@ int LiquefiedSand::recvSelf(int commitTag, Channel &theChannel,
                             FEM_ObjectBroker &theBroker) {
   int res = 0;
 
-  static Vector data(5);
+  Vector data(5);
 
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
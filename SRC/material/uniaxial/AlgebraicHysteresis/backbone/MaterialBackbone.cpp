@@ -130,7 +130,7 @@ MaterialBackbone::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static ID classTags(3);
+  ID classTags(3);
   
   int clTag = theMaterial->getClassTag();
   int dbTag = theMaterial->getDbTag();
@@ -163,7 +163,7 @@ MaterialBackbone::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static ID classTags(3);
+  ID classTags(3);
   
   res += theChannel.recvID(this->getDbTag(), cTag, classTags);
   if (res < 0) {
@@ -167,7 +167,7 @@ int ReeseStiffClayAboveWS::getVariable(int varID, double &theValue) {
 int ReeseStiffClayAboveWS::sendSelf(int commitTag, Channel &theChannel) {
   int res = 0;
 
-  static Vector data(3);
+  Vector data(3);
 
   data(0) = this->getTag();
   data(1) = pu;
@@ -188,7 +188,7 @@ int ReeseStiffClayAboveWS::recvSelf(int commitTag, Channel &theChannel,
                                     FEM_ObjectBroker &theBroker) {
   int res = 0;
 
-  static Vector data(3);
+  Vector data(3);
 
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -234,7 +234,7 @@ int ReeseStiffClayBelowWS::getVariable(int varID, double &theValue) {
 int ReeseStiffClayBelowWS::sendSelf(int commitTag, Channel &theChannel) {
   int res = 0;
 
-  static Vector data(5);
+  Vector data(5);
 
   data(0) = this->getTag();
   data(1) = Esi;
@@ -257,7 +257,7 @@ int ReeseStiffClayBelowWS::recvSelf(int commitTag, Channel &theChannel,
                                     FEM_ObjectBroker &theBroker) {
   int res = 0;
 
-  static Vector data(5);
+  Vector data(5);
 
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
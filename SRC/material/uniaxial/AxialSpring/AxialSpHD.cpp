@@ -751,7 +751,7 @@ AxialSpHD::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(18);
+  Vector data(18);
 
   data(0)  = this->getTag();
   data(1)  = sce;
@@ -785,7 +785,7 @@ AxialSpHD::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(18);
+  Vector data(18);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
 
   if ( res < 0 ) {
@@ -281,7 +281,7 @@ BWBN::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(18);
+    Vector data(18);
     data(0) = this->getTag();
     
     data(1) = alpha;
@@ -317,7 +317,7 @@ BWBN::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
   int res = 0;
 
-  static Vector data(18);
+  Vector data(18);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
     opserr << "BWBN::recvSelf() - failed to receive Vector" << endln;
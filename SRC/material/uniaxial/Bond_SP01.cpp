@@ -725,7 +725,7 @@ UniaxialMaterial* Bond_SP01::getCopy ()
 int Bond_SP01::sendSelf (int cTag, Channel& theChannel)
 {
   int res = 0;
-  static Vector dData(26);
+  Vector dData(26);
 
   dData(0) = this->getTag();
   dData(1) =db;
@@ -765,7 +765,7 @@ int Bond_SP01::recvSelf (int cTag, Channel& theChannel,
 			 FEM_ObjectBroker& theBroker)
 {
   int res = 0;
-  static Vector dData(26);
+  Vector dData(26);
 
   res = theChannel.recvVector(this->getDbTag(), cTag, dData);
   if (res < 0) 
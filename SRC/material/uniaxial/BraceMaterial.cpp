@@ -554,7 +554,7 @@ int
 BraceMaterial::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
-static Vector data(31);
+Vector data(31);
  data(0) = this->getTag();
  data(1) = mom1p;
  data(2) = rot1p;
@@ -596,7 +596,7 @@ BraceMaterial::recvSelf(int commitTag, Channel &theChannel,
 			FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(31);
+  Vector data(31);
   res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
     opserr << "BraceMaterial::recvSelf() - failed to receive data\n";
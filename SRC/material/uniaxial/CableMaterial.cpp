@@ -253,7 +253,7 @@ int
 CableMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(5);
+  Vector data(5);
   data(0) = this->getTag();
   data(1) = Ps;
   data(2) = E;
@@ -272,7 +272,7 @@ CableMaterial::recvSelf(int cTag, Channel &theChannel,
 			       FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(5);
+  Vector data(5);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -526,7 +526,7 @@ int
 Cast::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(30);
+  Vector data(30);
 
   data(0) = this->getTag();
 	
@@ -578,7 +578,7 @@ Cast::recvSelf(int commitTag, Channel &theChannel,
 	     FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(30);
+  Vector data(30);
   res = theChannel.recvVector(this->getDbTag(),commitTag, data);
   
   if (res < 0) {
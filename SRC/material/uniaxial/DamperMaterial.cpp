@@ -228,7 +228,7 @@ DamperMaterial::sendSelf(int cTag, Channel &theChannel)
   
     int res = 0;
 
-    static ID data(3);
+    ID data(3);
 
     // send ID of size 3 so no possible conflict with classTags ID
     int dbTag = this->getDbTag();
@@ -257,7 +257,7 @@ DamperMaterial::recvSelf(int cTag, Channel &theChannel,
 				FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static ID data(3);
+    ID data(3);
     int dbTag = this->getDbTag();
 
     res = theChannel.recvID(dbTag, cTag, data);
@@ -499,27 +499,27 @@ DrainMaterial::invokeSubroutine(void)
 	double enso = 0.0;	// Change in second-order energy (not used)
 
 	// Force terms computed in RESPXX subroutine
-	static double relas[NDOF];	// Resisting force vector
-	static double rdamp[NDOF];	// Damping force vector
-	static double rinit[NDOF];	// Initial force vector (not used)
+	thread_local double relas[NDOF];	// Resisting force vector
+	thread_local double rdamp[NDOF];	// Damping force vector
+	thread_local double rinit[NDOF];	// Initial force vector (not used)
 
 	// Total displacement vector
-	static double dise[NDOF];
+	thread_local double dise[NDOF];
 	dise[0] = 0.0;
 	dise[1] = epsilon;
 
 	// Incremental displacement vector
-	static double ddise[NDOF];
+	thread_local double ddise[NDOF];
 	ddise[0] = 0.0;
 	ddise[1] = epsilon-epsilonP;
 
 	// Velocity vector
-	static double vele[NDOF];
+	thread_local double vele[NDOF];
 	vele[0] = 0.0;
 	vele[1] = epsilonDot;
 
 	// Fill in committed state array
-	static double stateP[3];
+	thread_local double stateP[3];
 	stateP[0] = epsilonP;
 	stateP[1] = sigmaP;
 	stateP[2] = tangentP;
@@ -529,7 +529,7 @@ DrainMaterial::invokeSubroutine(void)
 	int ktype = 1;			// Elastic stiffness only
 
 	// Stiffness computed in STIFXX subroutine
-	static double fk[NDOF*NDOF];
+	thread_local double fk[NDOF*NDOF];
 
 	switch (this->getClassTag()) {
 	case MAT_TAG_DrainHardening:
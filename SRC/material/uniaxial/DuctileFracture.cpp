@@ -483,7 +483,7 @@ DuctileFracture::sendSelf(int cTag, Channel &theChannel)
 {
     int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -497,7 +497,7 @@ DuctileFracture::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dataVec(25);
+  Vector dataVec(25);
   dataVec(0)  = FI;
   dataVec(1)  = FI_VGM;
   dataVec(2)  = FI_MVC;
@@ -547,7 +547,7 @@ DuctileFracture::recvSelf(int cTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << "DuctileFracture::recvSelf() - failed to get the ID\n";
     return -1;
@@ -565,7 +565,7 @@ DuctileFracture::recvSelf(int cTag, Channel &theChannel,
   }
   theMaterial->setDbTag(dataID(2));
 
-  static Vector dataVec(25);
+  Vector dataVec(25);
   if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
     opserr << "DuctileFracture::recvSelf() - failed to get the Vector\n";
     return -3;
@@ -704,7 +704,7 @@ DuctileFracture::setResponse(const char **argv, int argc, OPS_Stream &theOutput)
 int 
 DuctileFracture::getResponse(int responseID, Information &matInfo)
 {
-  static Vector stressStrain(2);
+  thread_local Vector stressStrain(2);
 
   switch (responseID) {
   case 1:
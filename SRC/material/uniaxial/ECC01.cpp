@@ -749,7 +749,7 @@ UniaxialMaterial* ECC01::getCopy ()
 {
    int res = 0;
    //static Vector data(11);
-   static Vector data(23);
+   Vector data(23);
    data(0) = this->getTag();
 
    // Material properties
@@ -791,7 +791,7 @@ int ECC01::recvSelf (int commitTag, Channel& theChannel,
                                  FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(23);
+   Vector data(23);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
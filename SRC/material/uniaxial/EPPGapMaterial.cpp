@@ -292,7 +292,7 @@ int
 EPPGapMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(11);
+  Vector data(11);
   data(0) = this->getTag();
   data(1) = E;
   data(2) = fy;
@@ -317,7 +317,7 @@ EPPGapMaterial::recvSelf(int cTag, Channel &theChannel,
 				 FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(11);
+  Vector data(11);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0)
     opserr << "EPPGapMaterial::recvSelf() - failed to recv data\n";
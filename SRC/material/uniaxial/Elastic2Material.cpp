@@ -165,7 +165,7 @@ int
 Elastic2Material::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(4);
+  Vector data(4);
   data(0) = this->getTag();
   data(1) = E;
   data(2) = eta;
@@ -183,7 +183,7 @@ Elastic2Material::recvSelf(int cTag, Channel &theChannel,
 			       FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(4);
+  Vector data(4);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
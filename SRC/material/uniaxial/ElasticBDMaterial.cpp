@@ -127,7 +127,7 @@ int
 ElasticBDMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(3);
+  Vector data(3);
   data(0) = this->getTag();
   data(1) = E;
   data(2) = eta;
@@ -144,7 +144,7 @@ ElasticBDMaterial::recvSelf(int cTag, Channel &theChannel,
 			  FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(3);
+  Vector data(3);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
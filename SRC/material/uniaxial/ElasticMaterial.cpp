@@ -232,7 +232,7 @@ int
 ElasticMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(6);
+  Vector data(6);
   data(0) = this->getTag();
   data(1) = Epos;
   data(2) = Eneg;
@@ -252,7 +252,7 @@ ElasticMaterial::recvSelf(int cTag, Channel &theChannel,
 			  FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(6);
+  Vector data(6);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
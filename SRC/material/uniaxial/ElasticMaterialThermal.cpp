@@ -107,8 +107,8 @@ void * OPS_ADD_RUNTIME_VPV(OPS_ElasticMaterialThermal)
 }
 
 
-double ElasticMaterialThermal::SteelRedFactors[12] = { 1.0, 0.9, 0.8 ,0.7, 0.6 ,0.31, 0.13, 0.09, 0.0675, 0.045, 0.0225 , 0.0 };
-double ElasticMaterialThermal::ConcRedFactors[12] = { 0.625, 0.4318 ,0.3036, 0.1875 ,0.1, 0.045, 0.03, 0.015, 0.008 , 0.004,0.001,0.0 };
+const double ElasticMaterialThermal::SteelRedFactors[12] = { 1.0, 0.9, 0.8 ,0.7, 0.6 ,0.31, 0.13, 0.09, 0.0675, 0.045, 0.0225 , 0.0 };
+const double ElasticMaterialThermal::ConcRedFactors[12] = { 0.625, 0.4318 ,0.3036, 0.1875 ,0.1, 0.045, 0.03, 0.015, 0.008 , 0.004,0.001,0.0 };
 
 ElasticMaterialThermal::ElasticMaterialThermal(int tag, double e, double alpha, double et, double eneg, int softindex)
 :UniaxialMaterial(tag,MAT_TAG_ElasticMaterialThermal),
@@ -249,7 +249,7 @@ int
 ElasticMaterialThermal::sendSelf(int cTag, Channel &theChannel)
 {
 	int res = 0;
-	static Vector data(6);
+	Vector data(6);
 	data(0) = this->getTag();
 	data(1) = Epos;
 	data(2) = Eneg;
@@ -269,7 +269,7 @@ ElasticMaterialThermal::recvSelf(int cTag, Channel &theChannel,
 	FEM_ObjectBroker &theBroker)
 {
 	int res = 0;
-	static Vector data(6);
+	Vector data(6);
 	res = theChannel.recvVector(this->getDbTag(), cTag, data);
 
 	if (res < 0) {
@@ -420,7 +420,7 @@ ElasticMaterialThermal::getElongTangent(double TempT, double& ET, double& Elong,
   Temp = TempT;
   if (softIndex != 0) {
 
-    double *redfactors = 0;
+    const double *redfactors = 0;
     if (softIndex == 1)
       redfactors = SteelRedFactors;
     if (softIndex == 2)
@@ -106,8 +106,8 @@ class ElasticMaterialThermal : public UniaxialMaterial
     int parameterID;
     // AddingSensitivity:END ///////////////////////////////////////////
 
-    static double ConcRedFactors[12];
-    static double SteelRedFactors[12];
+    static const double ConcRedFactors[12];
+    static const double SteelRedFactors[12];
 };
 
 
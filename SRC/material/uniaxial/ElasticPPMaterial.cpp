@@ -264,7 +264,7 @@ int
 ElasticPPMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(9);
+  Vector data(9);
   data(0) = this->getTag();
   data(1) = ep;
   data(2) = E;
@@ -287,7 +287,7 @@ ElasticPPMaterial::recvSelf(int cTag, Channel &theChannel,
                          FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(9);
+  Vector data(9);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) 
     opserr << "ElasticPPMaterial::recvSelf() - failed to recv data\n";
@@ -226,7 +226,7 @@ UniaxialMaterial *ElasticPowerFunc::getCopy()
 int ElasticPowerFunc::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
-    static Vector data(4);
+    Vector data(4);
     data(0) = this->getTag();
     data(1) = numTerms;
     data(2) = initTangent;
@@ -246,7 +246,7 @@ int ElasticPowerFunc::recvSelf(int cTag, Channel &theChannel,
     FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static Vector data(4);
+    Vector data(4);
     res = theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0) 
         opserr << "ElasticPowerFunc::recvSelf() - failed to recv data.\n";
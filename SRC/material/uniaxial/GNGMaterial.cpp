@@ -412,7 +412,7 @@ GNGMaterial::sendSelf(int cTag, Channel &theChannel)
 	//we place all the data needed to define the material and its state
 	//into a vector object
   int res = 0;
-  static Vector data(12);
+  Vector data(12);
   data(0) = this->getTag();
   data(1) = commitStrain;
   data(2) = E;
@@ -441,7 +441,7 @@ GNGMaterial::recvSelf(int cTag, Channel &theChannel,
 	//receive the vector object from the channel which defines material
 	//parameters and state
   int res = 0;
-  static Vector data(12);
+  Vector data(12);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0)
     opserr << "GNGMaterial::recvSelf() - failed to recv data\n";
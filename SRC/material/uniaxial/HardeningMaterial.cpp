@@ -245,7 +245,7 @@ HardeningMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(11);
+  Vector data(11);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -272,7 +272,7 @@ HardeningMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(11);
+  Vector data(11);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -267,7 +267,7 @@ int
 Hertzdamp::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(13);
+  Vector data(13);
   data(0)  = this->getTag();
   data(1)  = Kh;
   data(2)  = xiNorm;
@@ -293,7 +293,7 @@ Hertzdamp::recvSelf(int cTag, Channel &theChannel,
 			  FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(13);
+  Vector data(13);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0)
     opserr << "Hertzdamp::recvSelf() - failed to recv data\n";
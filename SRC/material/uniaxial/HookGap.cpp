@@ -196,7 +196,7 @@ int
 HookGap::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(4);
+  Vector data(4);
   data(0) = this->getTag();
   data(1) = E;
   data(2) = gapN;
@@ -214,7 +214,7 @@ HookGap::recvSelf(int cTag, Channel &theChannel,
 			  FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(4);
+  Vector data(4);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
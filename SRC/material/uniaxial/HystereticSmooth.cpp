@@ -274,7 +274,7 @@ UniaxialMaterial* HystereticSmooth::getCopy()
 int HystereticSmooth::sendSelf(int commitTag, Channel& theChannel)
 {
 	int res = 0;
-	static Vector data(9);
+	Vector data(9);
 	data(0) = this->getTag();
 
 	// Material properties
@@ -305,7 +305,7 @@ int HystereticSmooth::recvSelf(int commitTag, Channel& theChannel,
 	FEM_ObjectBroker& theBroker)
 {
 	int res = 0;
-	static Vector data(9);
+	Vector data(9);
 	res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
 	if (res < 0) {
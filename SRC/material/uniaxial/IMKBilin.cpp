@@ -501,7 +501,7 @@ int IMKBilin::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(57);
+    Vector data(57);
     data(0) = this->getTag();
 // 21 Fixed Input Material Parameters 1-25
     data(1)  	= Ke;
@@ -607,7 +607,7 @@ int IMKBilin::sendSelf(int cTag, Channel &theChannel)
 int IMKBilin::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static Vector data(57);
+    Vector data(57);
     res = theChannel.recvVector(this->getDbTag(), cTag, data);
 
     if (res < 0) {
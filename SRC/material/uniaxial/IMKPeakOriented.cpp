@@ -722,7 +722,7 @@ int IMKPeakOriented::sendSelf(int cTag, Channel &theChannel)
 int IMKPeakOriented::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static Vector data(70);
+    Vector data(70);
     res = theChannel.recvVector(this->getDbTag(), cTag, data);
 
     if (res < 0) {
@@ -792,7 +792,7 @@ int IMKPinching::sendSelf(int cTag, Channel &theChannel)
 int IMKPinching::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static Vector data(137);
+    Vector data(137);
     res = theChannel.recvVector(this->getDbTag(), cTag, data);
 
     if (res < 0) {
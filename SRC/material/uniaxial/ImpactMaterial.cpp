@@ -222,7 +222,7 @@ int
 ImpactMaterial::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
-    static Vector data(8);
+    Vector data(8);
     data(0) = this->getTag();
     data(1) = K1;
     data(2) = K2;
@@ -242,7 +242,7 @@ ImpactMaterial::recvSelf(int cTag, Channel &theChannel,
     FEM_ObjectBroker &theBroker)
 {
     int res = 0;
-    static Vector data(8);
+    Vector data(8);
     res = theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0)
         opserr << "ImpactMaterial::recvSelf() - failed to recv data\n";
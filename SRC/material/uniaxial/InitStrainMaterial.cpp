@@ -215,7 +215,7 @@ InitStrainMaterial::sendSelf(int cTag, Channel &theChannel)
   
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -229,7 +229,7 @@ InitStrainMaterial::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dataVec(2);
+  Vector dataVec(2);
   dataVec(0) = epsInit;
   dataVec(1) = localStrain;
   
@@ -252,7 +252,7 @@ InitStrainMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << "InitStrainMaterial::recvSelf() - failed to get the ID\n";
     return -1;
@@ -271,7 +271,7 @@ InitStrainMaterial::recvSelf(int cTag, Channel &theChannel,
   }
   theMaterial->setDbTag(dataID(2));
 
-  static Vector dataVec(2);
+  Vector dataVec(2);
   if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
     opserr << "InitStrainMaterial::recvSelf() - failed to get the Vector\n";
     return -3;
@@ -459,7 +459,7 @@ Masonry::getCopy(void)
  int 
  Masonry::sendSelf(int commitTag, Channel &theChannel) 
  { 
-   static Vector data(51); 
+   Vector data(51); 
    data(0)   = this->getTag(); 
    data(1)   = Fm; 
    data(2)   = Ft; 
@@ -524,7 +524,7 @@ return 0;
  Masonry::recvSelf(int commitTag, Channel &theChannel,  
                          FEM_ObjectBroker &theBroker) 
  { 
-   static Vector data(51); 
+   Vector data(51); 
    if (theChannel.recvVector(this->getDbTag(), commitTag, data)<0) 
    { 
      opserr << "Masonry::recvSelf() - failed to recvSelf\n"; 
@@ -480,7 +480,7 @@ Masonry::getCopy(void)
 int
 Masonry::sendSelf(int commitTag, Channel &theChannel)
 {
-	static Vector data(53);
+	Vector data(53);
 	data(0) = this->getTag();
 	data(1) = Fm;
 	data(2) = Ft;
@@ -548,7 +548,7 @@ int
 Masonry::recvSelf(int commitTag, Channel &theChannel,
 	FEM_ObjectBroker &theBroker)
 {
-	static Vector data(53);
+	Vector data(53);
 	if (theChannel.recvVector(this->getDbTag(), commitTag, data)<0)
 	{
 		opserr << "Masonry::recvSelf() - failed to recvSelf\n";
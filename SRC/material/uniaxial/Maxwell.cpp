@@ -254,7 +254,7 @@ int
 Maxwell::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(9);
+  Vector data(9);
   data(0) = this->getTag();
   data(8) = returnD;
 
@@ -281,7 +281,7 @@ Maxwell::recvSelf(int cTag, Channel &theChannel,
 			       FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(9);
+  Vector data(9);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
 
   
@@ -260,7 +260,7 @@ MinMaxMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -274,7 +274,7 @@ MinMaxMaterial::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dataVec(3);
+  Vector dataVec(3);
   dataVec(0) = minStrain;
   dataVec(1) = maxStrain;
   if (Cfailed == true)
@@ -301,7 +301,7 @@ MinMaxMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << "MinMaxMaterial::recvSelf() - failed to get the ID\n";
     return -1;
@@ -320,7 +320,7 @@ MinMaxMaterial::recvSelf(int cTag, Channel &theChannel,
   }
   theMaterial->setDbTag(dataID(2));
 
-  static Vector dataVec(3);
+  Vector dataVec(3);
   if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
     opserr << "MinMaxMaterial::recvSelf() - failed to get the Vector\n";
     return -3;
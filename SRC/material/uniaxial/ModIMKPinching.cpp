@@ -1268,7 +1268,7 @@ int
 ModIMKPinching::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(74);			// Updated: Filipe Ribeiro and Andre Barbosa
+  Vector data(74);			// Updated: Filipe Ribeiro and Andre Barbosa
   data(0) = this->getTag();
  
   // Material properties
@@ -1377,7 +1377,7 @@ ModIMKPinching::recvSelf(int cTag, Channel &theChannel,
                          FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(74);			// Updated: Filipe Ribeiro and Andre Barbosa
+  Vector data(74);			// Updated: Filipe Ribeiro and Andre Barbosa
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
  
   if (res < 0) {
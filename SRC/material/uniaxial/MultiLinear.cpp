@@ -334,7 +334,7 @@ int
 MultiLinear::sendSelf(int cTag, Channel& theChannel)
 {
     int res = 0;
-    static ID iData(2);
+    ID iData(2);
     iData(0) = this->getTag();
     iData(1) = numSlope;
     
@@ -356,7 +356,7 @@ MultiLinear::recvSelf(int cTag, Channel& theChannel,
     FEM_ObjectBroker& theBroker)
 {
     int res = 0;
-    static ID iData(2);
+    ID iData(2);
     res = theChannel.recvID(this->getDbTag(), cTag, iData);
     if (res < 0) {
         opserr << "ElasticMaterial::recvSelf() - failed to recv data\n";
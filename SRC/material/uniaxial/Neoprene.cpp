@@ -187,7 +187,7 @@ int
 Neoprene::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(6);
+  Vector data(6);
   data(0) = this->getTag();
   data(1) = commitStrain;
   data(2) = E;
@@ -207,7 +207,7 @@ Neoprene::recvSelf(int cTag, Channel &theChannel,
 				 FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(6);
+  Vector data(6);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0)
     opserr << "Neoprene::recvSelf() - failed to recv data\n";
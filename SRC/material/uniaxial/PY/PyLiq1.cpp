@@ -73,7 +73,7 @@
 
 int PyLiq1::loadStage = 0;
 int PyConstructorType = 1;
-Vector PyLiq1::stressV3(3);
+thread_local Vector PyLiq1::stressV3(3);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_PyLiq1)
 {
@@ -690,7 +690,7 @@ PyLiq1::sendSelf(int cTag, Channel &theChannel)
 	//
 	int res =0;
 
-	static Vector data(16);
+	Vector data(16);
 
 	PySimple1::sendSelf(cTag, theChannel);
 
@@ -732,7 +732,7 @@ PyLiq1::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(16);
+  Vector data(16);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
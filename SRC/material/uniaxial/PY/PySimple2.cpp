@@ -755,7 +755,7 @@ PySimple2::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(39);
+  Vector data(39);
   
   data(0) = this->getTag();
   data(1) = soilType;
@@ -818,7 +818,7 @@ PySimple2::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(39);
+  Vector data(39);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -790,7 +790,7 @@ PySimple3::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(18);
+  Vector data(18);
   
   data(0) = this->getTag();
   data(1) = pult;
@@ -827,7 +827,7 @@ PySimple3::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(18);
+  Vector data(18);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -109,7 +109,7 @@ class TzLiq1 : public TzSimple1 {
 	// Function for obtaining effective stresses from adjoining solid soil elements
 	double getEffectiveStress(void);
 	double getEffectiveStress(TimeSeries *theSeries);
-	static Vector stressV3;
+	static thread_local Vector stressV3;
 	
 };
 
@@ -201,7 +201,7 @@ PathIndependentMaterial::sendSelf(int cTag, Channel &theChannel)
   
 	int res = 0;
 
-	static ID classTags(3);
+	ID classTags(3);
 
 	int clTag = theMaterial->getClassTag();
 	int dbTag = theMaterial->getDbTag();
@@ -238,7 +238,7 @@ PathIndependentMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID classTags(3);
+  ID classTags(3);
 
   int dbTag = this->getDbTag();
 
@@ -282,7 +282,7 @@ int
 Ratchet::sendSelf(int cTag, Channel& theChannel)
 {
 	int res = 0;
-	static Vector data(8);
+	Vector data(8);
 	data(0) = this->getTag();
 	data(1) = E;
 	data(2) = freeTravel;
@@ -303,7 +303,7 @@ Ratchet::recvSelf(int cTag, Channel& theChannel,
 	FEM_ObjectBroker& theBroker)
 {
 	int res = 0;
-	static Vector data(8);
+	Vector data(8);
 	res = theChannel.recvVector(this->getDbTag(), cTag, data);
 
 	if (res < 0) {
@@ -1259,7 +1259,7 @@ SAWSMaterial::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector dataVec(28);
+  Vector dataVec(28);
   
   dataVec(0) = this->getTag();
   dataVec(1) = F0;
@@ -1306,7 +1306,7 @@ SAWSMaterial::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector dataVec(28);
+  Vector dataVec(28);
   res = theChannel.recvVector(this->getDbTag(), commitTag, dataVec);
   
   if (res < 0) {
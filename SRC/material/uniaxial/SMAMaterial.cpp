@@ -378,7 +378,7 @@ SMAMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(11);
+  Vector data(11);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -405,7 +405,7 @@ SMAMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(11);
+  Vector data(11);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
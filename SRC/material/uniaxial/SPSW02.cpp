@@ -676,7 +676,7 @@ int SPSW02::sendSelf(int commitTag, Channel & theChannel)
 {
 				
 	int res = 0;
-	static Vector data(38);
+	Vector data(38);
 	data(0)  = this->getTag();
 	data(1)  = t			;
 	data(2)  = hs			;
@@ -729,7 +729,7 @@ int SPSW02::sendSelf(int commitTag, Channel & theChannel)
 int SPSW02::recvSelf(int commitTag, Channel & theChannel, FEM_ObjectBroker & theBroker)
 {
     int res = 0;
-    static Vector data(38);
+    Vector data(38);
     res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
     if (res < 0) {
@@ -387,7 +387,7 @@ SelfCenteringMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(26);
+  Vector data(26);
   
   data(0) = this->getTag();
   data(1) = k1;
@@ -429,7 +429,7 @@ SelfCenteringMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(26);
+  Vector data(26);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -325,7 +325,7 @@ SimpleFractureMaterial::sendSelf(int cTag, Channel &theChannel)
     
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
 
@@ -340,7 +340,7 @@ SimpleFractureMaterial::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dataVec(6);
+  Vector dataVec(6);
   dataVec(0) = maxStrain;
   dataVec(1) = Cfailed ? 1.0 : 0.0;
   dataVec(2) = Cstress;
@@ -368,7 +368,7 @@ SimpleFractureMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << "SimpleFractureMaterial::recvSelf() - failed to get the ID" << endln;
     return -1;
@@ -388,7 +388,7 @@ SimpleFractureMaterial::recvSelf(int cTag, Channel &theChannel,
   theMaterial->setDbTag(dataID(2));
 
 
-  static Vector dataVec(6);
+  Vector dataVec(6);
   if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
     opserr << "SimpleFractureMaterial::recvSelf() - failed to get the Vector" << endln;
     return -3;
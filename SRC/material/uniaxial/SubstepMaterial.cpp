@@ -0,0 +1,470 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SubstepMaterial wraps a UniaxialMaterial and integrates
+// each strain increment in substeps under an embedded error estimate.
+//
+// The increment is split into n equal substeps, each taken once in full
+// and once in two halves. The halves are accepted when the two stresses
+// agree to the tolerance, else n is doubled and the increment is
+// integrated again from the last committed state.
+//
+// Cost: the wrapped material is committed at the midpoint of every
+// substep, so every trial strain after the first one of a step, i.e. every
+// global Newton iteration, starts with a getCopy of the wrapped material
+// at the last commit (a delete and a heap allocation per material). Trials
+// at the committed strain and the first trial after a commit or revert
+// need no copy. commitState follows the substeps of the last trial with a
+// second instance of the material.
+//
+// Usage: uniaxialMaterial Substep $tag $otherTag <-tol $tol> <-maxSub $maxSub>
+//
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <SubstepMaterial.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <MaterialResponse.h>
+#include <Information.h>
+
+#include <OPS_Globals.h>
+
+#include <elementAPI.h>
+#define OPS_Export
+
+OPS_Export void * OPS_ADD_RUNTIME_VPV(OPS_SubstepMaterial)
+{
+  UniaxialMaterial *theMaterial = 0;
+  UniaxialMaterial *theOtherMaterial = 0;
+  double tolerance = 1.0e-4;
+  int maxSubsteps = 64;
+  int    iData[2];
+
+  int argc = OPS_GetNumRemainingInputArgs();
+  if (argc < 2) {
+    opserr << "WARNING invalid uniaxialMaterial Substep $tag $otherTag <-tol $tol> <-maxSub $maxSub>" << endln;
+    return 0;
+  }
+
+  int numData = 2;
+  if (OPS_GetIntInput(&numData, iData) != 0) {
+    opserr << "WARNING invalid uniaxialMaterial Substep $tag $otherTag" << endln;
+    return 0;
+  }
+
+  theOtherMaterial = OPS_GetUniaxialMaterial(iData[1]);
+  if (theOtherMaterial == 0) {
+    opserr << "WARNING invalid otherTag uniaxialMaterial Substep tag: " << iData[0] << endln;
+    return 0;
+  }
+
+  argc = OPS_GetNumRemainingInputArgs();
+  while (argc > 1) {
+    const char *argvLoc = OPS_GetString();
+    numData = 1;
+
+    if (strcmp(argvLoc, "-tol") == 0) {
+      if (OPS_GetDouble(&numData, &tolerance) != 0 || tolerance <= 0.0) {
+        opserr << "WARNING invalid tol value uniaxialMaterial Substep tag: " << iData[0] << endln;
+        return 0;
+      }
+    } else if (strcmp(argvLoc, "-maxSub") == 0) {
+      if (OPS_GetIntInput(&numData, &maxSubsteps) != 0 || maxSubsteps < 1) {
+        opserr << "WARNING invalid maxSub value uniaxialMaterial Substep tag: " << iData[0] << endln;
+        return 0;
+      }
+    } else {
+      opserr << "WARNING invalid option:" << argvLoc << " uniaxialMaterial Substep tag: " << iData[0] << endln;
+      return 0;
+    }
+
+    argc = OPS_GetNumRemainingInputArgs();
+  }
+
+  theMaterial = new SubstepMaterial(iData[0], *theOtherMaterial, tolerance, maxSubsteps);
+
+  if (theMaterial == 0) {
+    opserr << "WARNING could not create uniaxialMaterial of type SubstepMaterial\n";
+    return 0;
+  }
+
+  return theMaterial;
+}
+
+SubstepMaterial::SubstepMaterial(int tag, UniaxialMaterial &material,
+                                 double tol, int maxSub)
+  :UniaxialMaterial(tag,MAT_TAG_Substep), theMaterial(0), theCommitted(0),
+   tolerance(tol), maxSubsteps(maxSub),
+   Tstrain(0.0), Cstrain(0.0), TstrainRate(0.0),
+   dirty(false), numSubsteps(1)
+{
+  theMaterial  = material.getCopy();
+  theCommitted = material.getCopy();
+
+  if (theMaterial == 0 || theCommitted == 0) {
+    opserr <<  "SubstepMaterial::SubstepMaterial -- failed to get copy of material\n";
+    exit(-1);
+  }
+
+  Cstrain = Tstrain = theMaterial->getStrain();
+}
+
+SubstepMaterial::SubstepMaterial()
+  :UniaxialMaterial(0,MAT_TAG_Substep), theMaterial(0), theCommitted(0),
+   tolerance(0.0), maxSubsteps(1),
+   Tstrain(0.0), Cstrain(0.0), TstrainRate(0.0),
+   dirty(false), numSubsteps(1)
+{
+
+}
+
+SubstepMaterial::~SubstepMaterial()
+{
+  if (theMaterial)
+    delete theMaterial;
+  if (theCommitted)
+    delete theCommitted;
+}
+
+void
+SubstepMaterial::restore(void)
+{
+  // a material committed at a substep cannot be reverted past it
+  if (dirty) {
+    delete theMaterial;
+    theMaterial = theCommitted->getCopy();
+    dirty = false;
+  }
+  else
+    theMaterial->revertToLastCommit();
+
+  substeps.clear();
+}
+
+double
+SubstepMaterial::integrate(int n, double strainRate)
+{
+  const double dStrain = (Tstrain - Cstrain)/n;
+  const double scale = fabs(theMaterial->getInitialTangent()*(Tstrain - Cstrain));
+
+  double maxError = 0.0;
+  double e0 = Cstrain;
+  for (int k = 0; k < n; k++) {
+    double e1 = (k == n - 1) ? Tstrain : Cstrain + (k + 1)*dStrain;
+
+    // full substep
+    if (theMaterial->setTrialStrain(e1, strainRate) != 0)
+      return -1.0;
+    double fullStress = theMaterial->getStress();
+
+    // two half substeps
+    if (theMaterial->setTrialStrain(0.5*(e0 + e1), strainRate) != 0)
+      return -1.0;
+    theMaterial->commitState();
+    substeps.push_back(0.5*(e0 + e1));
+    dirty = true;
+    if (theMaterial->setTrialStrain(e1, strainRate) != 0)
+      return -1.0;
+    double halfStress = theMaterial->getStress();
+
+    double norm = fabs(halfStress) > scale ? fabs(halfStress) : scale;
+    double error = norm > 0.0 ? fabs(halfStress - fullStress)/norm : 0.0;
+    if (error > maxError)
+      maxError = error;
+
+    // no use in going on unless this is the finest subdivision
+    if (maxError > tolerance && n < maxSubsteps)
+      return maxError;
+
+    if (k < n - 1) {
+      theMaterial->commitState();
+      substeps.push_back(e1);
+    }
+    e0 = e1;
+  }
+
+  return maxError;
+}
+
+int
+SubstepMaterial::setTrialStrain(double strain, double strainRate)
+{
+  Tstrain = strain;
+  TstrainRate = strainRate;
+
+  // start over from the last committed state
+  if (dirty)
+    this->restore();
+
+  // no increment to integrate, so no substep is committed and the next
+  // trial needs no copy of the committed material
+  if (Tstrain == Cstrain) {
+    numSubsteps = 0;
+    return theMaterial->setTrialStrain(Tstrain, strainRate);
+  }
+
+  for (int n = 1; ; n *= 2) {
+    if (n > maxSubsteps)
+      n = maxSubsteps;
+
+    double error = this->integrate(n, strainRate);
+    numSubsteps = n;
+
+    if (error >= 0.0 && error <= tolerance)
+      return 0;
+
+    if (n == maxSubsteps) {
+      if (error >= 0.0)
+        opserr << "WARNING SubstepMaterial::setTrialStrain() - material " << this->getTag()
+               << " error " << error << " above the tolerance with " << maxSubsteps << " substeps\n";
+      return -1;
+    }
+
+    this->restore();
+  }
+}
+
+double
+SubstepMaterial::getStress(void)
+{
+  return theMaterial->getStress();
+}
+
+double
+SubstepMaterial::getTangent(void)
+{
+  return theMaterial->getTangent();
+}
+
+double
+SubstepMaterial::getDampTangent(void)
+{
+  return theMaterial->getDampTangent();
+}
+
+double
+SubstepMaterial::getStrain(void)
+{
+  return Tstrain;
+}
+
+double
+SubstepMaterial::getStrainRate(void)
+{
+  return theMaterial->getStrainRate();
+}
+
+int
+SubstepMaterial::commitState(void)
+{
+  Cstrain = Tstrain;
+
+  int res = theMaterial->commitState();
+
+  // take the committed material along the substeps of the working one
+  int replay = 0;
+  for (double strain : substeps)
+    if (theCommitted->setTrialStrain(strain, TstrainRate) != 0 ||
+        theCommitted->commitState() != 0)
+      replay = -1;
+  if (theCommitted->setTrialStrain(Tstrain, TstrainRate) != 0 ||
+      theCommitted->commitState() != 0)
+    replay = -1;
+
+  // start over from a copy of the working material, which carries the
+  // committed state
+  if (replay != 0) {
+    opserr << "WARNING SubstepMaterial::commitState() - material " << this->getTag()
+           << " failed to follow the substeps of the committed state\n";
+    delete theCommitted;
+    theCommitted = theMaterial->getCopy();
+    res = -1;
+  }
+
+  substeps.clear();
+  dirty = false;
+
+  return res;
+}
+
+int
+SubstepMaterial::revertToLastCommit(void)
+{
+  Tstrain = Cstrain;
+
+  this->restore();
+  return 0;
+}
+
+int
+SubstepMaterial::revertToStart(void)
+{
+  substeps.clear();
+  dirty = false;
+  numSubsteps = 1;
+
+  int res = theMaterial->revertToStart();
+  if (theCommitted->revertToStart() != 0)
+    res = -1;
+
+  Cstrain = Tstrain = theMaterial->getStrain();
+
+  return res;
+}
+
+UniaxialMaterial *
+SubstepMaterial::getCopy(void)
+{
+  SubstepMaterial *theCopy =
+    new SubstepMaterial(this->getTag(), *theCommitted, tolerance, maxSubsteps);
+
+  theCopy->Tstrain  = Cstrain;
+  theCopy->Cstrain  = Cstrain;
+  theCopy->numSubsteps = numSubsteps;
+
+  return theCopy;
+}
+
+int
+SubstepMaterial::sendSelf(int cTag, Channel &theChannel)
+{
+  int dbTag = this->getDbTag();
+
+  UniaxialMaterial *committed = theCommitted;
+
+  ID dataID(3);
+  dataID(0) = this->getTag();
+  dataID(1) = committed->getClassTag();
+  int matDbTag = committed->getDbTag();
+  if ( matDbTag == 0) {
+    matDbTag = theChannel.getDbTag();
+    committed->setDbTag(matDbTag);
+  }
+  dataID(2) = matDbTag;
+  if (theChannel.sendID(dbTag, cTag, dataID) < 0) {
+    opserr << "SubstepMaterial::sendSelf() - failed to send the ID\n";
+    return -1;
+  }
+
+  Vector dataVec(3);
+  dataVec(0) = tolerance;
+  dataVec(1) = maxSubsteps;
+  dataVec(2) = Cstrain;
+
+  if (theChannel.sendVector(dbTag, cTag, dataVec) < 0) {
+    opserr << "SubstepMaterial::sendSelf() - failed to send the Vector\n";
+    return -2;
+  }
+
+  if (committed->sendSelf(cTag, theChannel) < 0) {
+    opserr << "SubstepMaterial::sendSelf() - failed to send the Material\n";
+    return -3;
+  }
+
+  return 0;
+}
+
+int
+SubstepMaterial::recvSelf(int cTag, Channel &theChannel,
+                          FEM_ObjectBroker &theBroker)
+{
+  int dbTag = this->getDbTag();
+
+  ID dataID(3);
+  if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
+    opserr << "SubstepMaterial::recvSelf() - failed to get the ID\n";
+    return -1;
+  }
+  this->setTag(int(dataID(0)));
+
+  if (theMaterial == 0) {
+    int matClassTag = int(dataID(1));
+    theMaterial = theBroker.getNewUniaxialMaterial(matClassTag);
+    if (theMaterial == 0) {
+      opserr << "SubstepMaterial::recvSelf() - failed to create Material with classTag "
+             << dataID(1) << endln;
+      return -2;
+    }
+  }
+  theMaterial->setDbTag(dataID(2));
+
+  Vector dataVec(3);
+  if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
+    opserr << "SubstepMaterial::recvSelf() - failed to get the Vector\n";
+    return -3;
+  }
+
+  tolerance   = dataVec(0);
+  maxSubsteps = int(dataVec(1));
+  Cstrain     = dataVec(2);
+  Tstrain     = Cstrain;
+
+  substeps.clear();
+  dirty = false;
+
+  if (theMaterial->recvSelf(cTag, theChannel, theBroker) < 0) {
+    opserr << "SubstepMaterial::recvSelf() - failed to get the Material\n";
+    return -4;
+  }
+
+  if (theCommitted != 0)
+    delete theCommitted;
+  theCommitted = theMaterial->getCopy();
+
+  return 0;
+}
+
+void
+SubstepMaterial::Print(OPS_Stream &s, int flag)
+{
+  if (flag == OPS_PRINT_PRINTMODEL_MATERIAL) {
+    s << "SubstepMaterial, tag: " << this->getTag() << endln;
+    s << "  material: " << theMaterial->getTag() << endln;
+    s << "  tolerance: " << tolerance << endln;
+    s << "  max substeps: " << maxSubsteps << endln;
+  }
+
+  if (flag == OPS_PRINT_PRINTMODEL_JSON) {
+    s << "\t\t\t{";
+    s << "\"name\": \"" << this->getTag() << "\", ";
+    s << "\"type\": \"SubstepMaterial\", ";
+    s << "\"material\": \"" << theMaterial->getTag() << "\", ";
+    s << "\"tol\": " << tolerance << ", ";
+    s << "\"maxSub\": " << maxSubsteps << "}";
+  }
+}
+
+Response *
+SubstepMaterial::setResponse(const char **argv, int argc, OPS_Stream &theOutput)
+{
+  if (argc > 0 && strcmp(argv[0], "substeps") == 0) {
+    theOutput.tag("UniaxialMaterialOutput");
+    theOutput.attr("matType", this->getClassType());
+    theOutput.attr("matTag", this->getTag());
+    theOutput.tag("ResponseType", "substeps");
+    theOutput.endTag();
+
+    return new MaterialResponse(this, 100, 0.0);
+  }
+
+  return UniaxialMaterial::setResponse(argv, argc, theOutput);
+}
+
+int
+SubstepMaterial::getResponse(int responseID, Information &info)
+{
+  switch (responseID) {
+  case 100:
+    return info.setDouble(numSubsteps);
+
+  default:
+    return this->UniaxialMaterial::getResponse(responseID, info);
+  }
+}
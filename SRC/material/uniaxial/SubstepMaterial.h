@@ -0,0 +1,87 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SubstepMaterial wraps a UniaxialMaterial and integrates
+// each strain increment from the last committed state in substeps. The
+// size of the substeps is controlled by the difference between the stress
+// of a full substep and that of two half substeps.
+//
+// Two instances of the wrapped material are kept: the working one, which
+// is committed at the substeps, and one in the last committed state to
+// start over from, which follows the working one through the substeps on
+// commitState. The getCopy of the wrapped material has to carry its
+// committed state. Since the working material is committed at the
+// substeps, each trial after the first one of a step copies the committed
+// material; see SubstepMaterial.cpp.
+//
+#ifndef SubstepMaterial_h
+#define SubstepMaterial_h
+
+#define MAT_TAG_Substep 1991
+
+#include <vector>
+#include <UniaxialMaterial.h>
+
+class SubstepMaterial : public UniaxialMaterial
+{
+  public:
+    SubstepMaterial(int tag, UniaxialMaterial &material,
+                    double tolerance, int maxSubsteps);
+    SubstepMaterial();
+    ~SubstepMaterial();
+
+    const char *getClassType(void) const {return "SubstepMaterial";};
+
+    int setTrialStrain(double strain, double strainRate = 0.0);
+    double getStrain(void);
+    double getStrainRate(void);
+    double getStress(void);
+    double getTangent(void);
+    double getDampTangent(void);
+    double getInitialTangent(void) {return theMaterial->getInitialTangent();}
+
+    int commitState(void);
+    int revertToLastCommit(void);
+    int revertToStart(void);
+
+    UniaxialMaterial *getCopy(void);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+                 FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag =0);
+
+    Response *setResponse(const char **argv, int argc, OPS_Stream &theOutput);
+    int getResponse(int responseID, Information &matInformation);
+
+  private:
+    // integrate the increment in n equal substeps, returns the largest
+    // relative error of the substeps or a negative value if the material
+    // failed
+    double integrate(int n, double strainRate);
+
+    // take the working material back to the last committed state
+    void restore(void);
+
+    UniaxialMaterial *theMaterial;    // working material
+    UniaxialMaterial *theCommitted;   // material at the last commit
+
+    double tolerance;
+    int maxSubsteps;
+
+    double Tstrain;
+    double Cstrain;
+    double TstrainRate;
+
+    bool dirty;           // substeps committed since the last commit
+    int numSubsteps;      // substeps of the last trial
+
+    std::vector<double> substeps;   // strains of the substep commits
+};
+
+
+#endif
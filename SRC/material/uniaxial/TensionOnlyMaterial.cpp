@@ -195,7 +195,7 @@ TensionOnlyMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -223,7 +223,7 @@ TensionOnlyMaterial::recvSelf(int cTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << "TensionOnlyMaterial::recvSelf() - failed to get the ID\n";
     return -1;
@@ -669,7 +669,7 @@ Trilinwp::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(30);
+  Vector data(30);
   
   data(0) = this->getTag();
   data(1) = mom1p;
@@ -716,7 +716,7 @@ Trilinwp::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(30);
+  Vector data(30);
   res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
@@ -693,7 +693,7 @@ Trilinwp2::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(32);
+  Vector data(32);
   
   data(0) = this->getTag();
   data(1) = mom1p;
@@ -742,7 +742,7 @@ Trilinwp2::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(32);
+  Vector data(32);
   res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
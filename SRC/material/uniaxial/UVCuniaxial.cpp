@@ -470,7 +470,7 @@ UniaxialMaterial* UVCuniaxial::getCopy() {
  */
 int UVCuniaxial::sendSelf(int commitTag, Channel& theChannel) {
 
-  static Vector data(15 + 2*MAX_BACKSTRESSES);  // enough space for 8 backstresses
+  Vector data(15 + 2*MAX_BACKSTRESSES);  // enough space for 8 backstresses
   // Material properties
   data(0) = elasticModulus;
   data(1) = yieldStress;
@@ -519,7 +519,7 @@ int UVCuniaxial::sendSelf(int commitTag, Channel& theChannel) {
  */
 int UVCuniaxial::recvSelf(int commitTag, Channel& theChannel,
   FEM_ObjectBroker& theBroker) {
-  static Vector data(15 + 2*MAX_BACKSTRESSES);
+  Vector data(15 + 2*MAX_BACKSTRESSES);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "UVCuniaxial::recvSelf() - failed to recvSelf\n";
@@ -240,7 +240,7 @@ UniaxialJ2Plasticity::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(12);
+  Vector data(12);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -269,7 +269,7 @@ UniaxialJ2Plasticity::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(12);
+  Vector data(12);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -156,7 +156,7 @@ ArctangentBackbone::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(5);
+  Vector data(5);
   
   data(0) = this->getTag();
   data(1) = K1;
@@ -180,7 +180,7 @@ ArctangentBackbone::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(5);
+  Vector data(5);
   
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
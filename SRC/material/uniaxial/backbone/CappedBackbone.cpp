@@ -188,7 +188,7 @@ int
 CappedBackbone::sendSelf(int cTag, Channel &theChannel)
 {
   // Create and send Vector with CappedBackbone data
-  static Vector data(2);
+  Vector data(2);
   data(0) = this->getTag();
   data(1) = eCap;
   
@@ -200,7 +200,7 @@ CappedBackbone::sendSelf(int cTag, Channel &theChannel)
   }
   
   // Send backbone and cap class tags
-  static ID classTags(4);
+  ID classTags(4);
   classTags(0) = theBackbone->getClassTag();
   classTags(1) = theCap->getClassTag();
   
@@ -257,7 +257,7 @@ CappedBackbone::recvSelf(int cTag, Channel &theChannel,
 			 FEM_ObjectBroker &theBroker)
 {
   // Create a Vector and receive CappedBackbone data
-  static Vector data(2);
+  Vector data(2);
   int res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
     opserr << "CappedBackbone::recvSelf -- could not receive Vector" << endln;
@@ -269,7 +269,7 @@ CappedBackbone::recvSelf(int cTag, Channel &theChannel,
   eCap = data(1);
   
   // Receive the classTags for the backbone and cap
-  static ID classTags(4);
+  ID classTags(4);
   res += theChannel.recvID(this->getDbTag(), cTag, classTags);
   if (res < 0) {
     opserr << "CappedBackbone::recvSelf -- could not receive ID" << endln;
@@ -136,7 +136,7 @@ ReeseStiffClayBelowWS::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(5);
+  Vector data(5);
   
   data(0) = this->getTag();
   data(1) = Esi;
@@ -160,7 +160,7 @@ ReeseStiffClayBelowWS::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(5);
+  Vector data(5);
   
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -0,0 +1,440 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// TabulatedBackbone.
+//
+#include <TabulatedBackbone.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <OPS_Globals.h>
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+// coefficients of the cubic in u = strain - x0 that interpolates the
+// stresses s and tangents m at the ends of [x0, x1]
+static void
+hermite(double x0, double x1, double s0, double s1, double m0, double m1,
+        double *c)
+{
+  const double h = x1 - x0;
+  const double slope = (s1 - s0)/h;
+  c[0] = s0;
+  c[1] = m0;
+  c[2] = (3.0*slope - 2.0*m0 - m1)/h;
+  c[3] = (m0 + m1 - 2.0*slope)/(h*h);
+}
+
+// an interval of the table while it is refined
+struct TabulatedInterval {
+  double x0, x1, s0, s1, m0, m1;
+  double stressError;     // largest at the test points
+  double tangentError;
+
+  bool operator<(const TabulatedInterval &other) const {
+    return stressError < other.stressError;
+  }
+};
+
+// error of the interpolant at the quarter points of an interval
+static void
+measure(HystereticBackbone &backbone, TabulatedInterval &a)
+{
+  double c[4];
+  hermite(a.x0, a.x1, a.s0, a.s1, a.m0, a.m1, c);
+  const double h = a.x1 - a.x0;
+
+  a.stressError = 0.0;
+  a.tangentError = 0.0;
+  for (int j = 1; j <= 3; j++) {
+    const double u = 0.25*j*h;
+    a.stressError = fmax(a.stressError, fabs(c[0] + u*(c[1] + u*(c[2] + u*c[3]))
+                                             - backbone.getStress(a.x0 + u)));
+    a.tangentError = fmax(a.tangentError, fabs(c[1] + u*(2.0*c[2] + u*3.0*c[3])
+                                               - backbone.getTangent(a.x0 + u)));
+  }
+}
+
+TabulatedBackbone::TabulatedBackbone(int tag, HystereticBackbone &backbone,
+                                     double emax, double tol, int nmax):
+  HystereticBackbone(tag,BACKBONE_TAG_Tabulated), theBackbone(0),
+  strainMax(emax), tolerance(tol), maxPoints(nmax)
+{
+  theBackbone = backbone.getCopy();
+
+  if (theBackbone == 0) {
+    opserr << "TabulatedBackbone::TabulatedBackbone -- failed to get copy of backbone" << endln;
+    return;
+  }
+
+  this->tabulate();
+}
+
+TabulatedBackbone::TabulatedBackbone():
+  HystereticBackbone(0,BACKBONE_TAG_Tabulated), theBackbone(0),
+  strainMax(0.0), tolerance(0.0), maxPoints(0)
+{
+
+}
+
+TabulatedBackbone::~TabulatedBackbone()
+{
+  if (theBackbone)
+    delete theBackbone;
+}
+
+void
+TabulatedBackbone::tabulate(void)
+{
+  table.reset();
+
+  if (strainMax <= 0.0 || maxPoints < 2)
+    return;
+
+  // Start from a uniform grid that has a knot at zero strain
+  int numInitial = 16;
+  if (numInitial > maxPoints - 1)
+    numInitial = 2*((maxPoints - 1)/2);
+  if (numInitial < 1)
+    numInitial = 1;
+
+  std::vector<double> x(numInitial+1), s(numInitial+1), m(numInitial+1);
+  double stressScale = 0.0;
+  double tangentScale = 0.0;
+  for (int i = 0; i <= numInitial; i++) {
+    x[i] = (i == numInitial) ? strainMax : -strainMax + 2.0*strainMax*i/numInitial;
+    s[i] = theBackbone->getStress(x[i]);
+    m[i] = theBackbone->getTangent(x[i]);
+    stressScale = fmax(stressScale, fabs(s[i]));
+    tangentScale = fmax(tangentScale, fabs(m[i]));
+  }
+  if (stressScale == 0.0)
+    stressScale = 1.0;
+  if (tangentScale == 0.0)
+    tangentScale = 1.0;
+
+  const double allowed = tolerance*stressScale;
+  const double hmin = 1.0e-12*strainMax;
+
+  std::vector<TabulatedInterval> heap(numInitial);
+  for (int i = 0; i < numInitial; i++) {
+    TabulatedInterval &a = heap[i];
+    a.x0 = x[i]; a.x1 = x[i+1];
+    a.s0 = s[i]; a.s1 = s[i+1];
+    a.m0 = m[i]; a.m1 = m[i+1];
+    measure(*theBackbone, a);
+  }
+  std::make_heap(heap.begin(), heap.end());
+
+  // Bisect the worst interval until all meet the tolerance or the
+  // table is full
+  int numPoints = numInitial + 1;
+  while (numPoints < maxPoints) {
+    TabulatedInterval a = heap.front();
+    if (a.stressError <= allowed || a.x1 - a.x0 <= hmin)
+      break;
+    std::pop_heap(heap.begin(), heap.end());
+    heap.pop_back();
+
+    TabulatedInterval b = a;
+    const double xm = 0.5*(a.x0 + a.x1);
+    a.x1 = b.x0 = xm;
+    a.s1 = b.s0 = theBackbone->getStress(xm);
+    a.m1 = b.m0 = theBackbone->getTangent(xm);
+    measure(*theBackbone, a);
+    measure(*theBackbone, b);
+
+    heap.push_back(a);
+    std::push_heap(heap.begin(), heap.end());
+    heap.push_back(b);
+    std::push_heap(heap.begin(), heap.end());
+    numPoints++;
+  }
+
+  std::sort(heap.begin(), heap.end(),
+            [](const TabulatedInterval &a, const TabulatedInterval &b) {
+              return a.x0 < b.x0;
+            });
+
+  std::shared_ptr<Table> theTable = std::make_shared<Table>();
+
+  const int numIntervals = (int)heap.size();
+  double stressError = 0.0;
+  double tangentError = 0.0;
+  theTable->strain.resize(numIntervals+1);
+  theTable->coef.resize(4*numIntervals);
+  for (int i = 0; i < numIntervals; i++) {
+    const TabulatedInterval &a = heap[i];
+    theTable->strain[i] = a.x0;
+    hermite(a.x0, a.x1, a.s0, a.s1, a.m0, a.m1, &theTable->coef[4*i]);
+    stressError = fmax(stressError, a.stressError);
+    tangentError = fmax(tangentError, a.tangentError);
+  }
+  theTable->strain[numIntervals] = heap[numIntervals-1].x1;
+
+  // Uniform buckets over the range, each pointing at the interval that
+  // holds its left end, so a lookup is a short forward scan
+  const std::vector<double> &xt = theTable->strain;
+  theTable->bucket.resize(numIntervals);
+  theTable->invBucket = numIntervals/(xt[numIntervals] - xt[0]);
+  for (int k = 0, i = 0; k < numIntervals; k++) {
+    const double xk = xt[0] + k/theTable->invBucket;
+    while (i < numIntervals - 1 && xt[i+1] <= xk)
+      i++;
+    theTable->bucket[k] = i;
+  }
+
+  theTable->stressError = stressError/stressScale;
+  theTable->tangentError = tangentError/tangentScale;
+
+  table = theTable;
+}
+
+int
+TabulatedBackbone::locate(double strain) const
+{
+  const std::vector<double> &x = table->strain;
+  const int numIntervals = (int)table->bucket.size();
+
+  int k = (int)((strain - x[0])*table->invBucket);
+  if (k >= numIntervals)
+    k = numIntervals - 1;
+
+  int i = table->bucket[k];
+  while (i < numIntervals - 1 && strain > x[i+1])
+    i++;
+
+  return i;
+}
+
+double
+TabulatedBackbone::getStress(double strain)
+{
+  if (table == nullptr || !(strain >= -strainMax && strain <= strainMax))
+    return theBackbone->getStress(strain);
+
+  const int i = this->locate(strain);
+  const double *c = &table->coef[4*i];
+  const double u = strain - table->strain[i];
+
+  return c[0] + u*(c[1] + u*(c[2] + u*c[3]));
+}
+
+double
+TabulatedBackbone::getTangent(double strain)
+{
+  if (table == nullptr || !(strain >= -strainMax && strain <= strainMax))
+    return theBackbone->getTangent(strain);
+
+  const int i = this->locate(strain);
+  const double *c = &table->coef[4*i];
+  const double u = strain - table->strain[i];
+
+  return c[1] + u*(2.0*c[2] + u*3.0*c[3]);
+}
+
+void
+TabulatedBackbone::getStresses(int n, const double *strain, double *stress,
+                               double *tangent)
+{
+  for (int j = 0; j < n; j++) {
+    const double e = strain[j];
+    if (table == nullptr || !(e >= -strainMax && e <= strainMax)) {
+      stress[j] = theBackbone->getStress(e);
+      tangent[j] = theBackbone->getTangent(e);
+      continue;
+    }
+
+    const int i = this->locate(e);
+    const double *c = &table->coef[4*i];
+    const double u = e - table->strain[i];
+    stress[j] = c[0] + u*(c[1] + u*(c[2] + u*c[3]));
+    tangent[j] = c[1] + u*(2.0*c[2] + u*3.0*c[3]);
+  }
+}
+
+double
+TabulatedBackbone::getEnergy(double strain)
+{
+  return theBackbone->getEnergy(strain);
+}
+
+double
+TabulatedBackbone::getYieldStrain(void)
+{
+  return theBackbone->getYieldStrain();
+}
+
+double
+TabulatedBackbone::getStressError(void) const
+{
+  return (table != nullptr) ? table->stressError : 0.0;
+}
+
+double
+TabulatedBackbone::getTangentError(void) const
+{
+  return (table != nullptr) ? table->tangentError : 0.0;
+}
+
+int
+TabulatedBackbone::getNumPoints(void) const
+{
+  return (table != nullptr) ? (int)table->strain.size() : 0;
+}
+
+HystereticBackbone*
+TabulatedBackbone::getCopy(void)
+{
+  TabulatedBackbone *theCopy = new TabulatedBackbone();
+
+  theCopy->setTag(this->getTag());
+  theCopy->theBackbone = theBackbone->getCopy();
+  theCopy->table = table;
+  theCopy->strainMax = strainMax;
+  theCopy->tolerance = tolerance;
+  theCopy->maxPoints = maxPoints;
+
+  return theCopy;
+}
+
+void
+TabulatedBackbone::Print(OPS_Stream &s, int flag)
+{
+  s << "TabulatedBackbone, tag: " << this->getTag() << endln;
+  s << "\tBackbone: " << theBackbone->getTag() << endln;
+  s << "\tstrainMax: " << strainMax << endln;
+  s << "\ttolerance: " << tolerance << endln;
+  s << "\tpoints: " << this->getNumPoints() << endln;
+  s << "\tstress error: " << this->getStressError() << endln;
+  s << "\ttangent error: " << this->getTangentError() << endln;
+}
+
+int
+TabulatedBackbone::setVariable (char *argv)
+{
+  if (strcmp(argv,"stressError") == 0)
+    return 1;
+  else if (strcmp(argv,"tangentError") == 0)
+    return 2;
+  else if (strcmp(argv,"numPoints") == 0)
+    return 3;
+  else
+    return -1;
+}
+
+int
+TabulatedBackbone::getVariable (int varID, double &theValue)
+{
+  switch (varID) {
+  case 1:
+    theValue = this->getStressError();
+    return 1;
+  case 2:
+    theValue = this->getTangentError();
+    return 2;
+  case 3:
+    theValue = this->getNumPoints();
+    return 3;
+  default:
+    return -1;
+  }
+}
+
+int
+TabulatedBackbone::sendSelf(int cTag, Channel &theChannel)
+{
+  Vector data(4);
+  data(0) = this->getTag();
+  data(1) = strainMax;
+  data(2) = tolerance;
+  data(3) = maxPoints;
+
+  int res = theChannel.sendVector(this->getDbTag(), cTag, data);
+  if (res < 0) {
+    opserr << "TabulatedBackbone::sendSelf -- could not send Vector" << endln;
+    return res;
+  }
+
+  ID classTags(2);
+  classTags(0) = theBackbone->getClassTag();
+
+  int dbTag = theBackbone->getDbTag();
+  if (dbTag == 0) {
+    dbTag = theChannel.getDbTag();
+    if (dbTag != 0)
+      theBackbone->setDbTag(dbTag);
+  }
+  classTags(1) = dbTag;
+
+  res += theChannel.sendID(this->getDbTag(), cTag, classTags);
+  if (res < 0) {
+    opserr << "TabulatedBackbone::sendSelf -- could not send ID" << endln;
+    return res;
+  }
+
+  res += theBackbone->sendSelf(cTag, theChannel);
+  if (res < 0) {
+    opserr << "TabulatedBackbone::sendSelf -- could not send HystereticBackbone" << endln;
+    return res;
+  }
+
+  return res;
+}
+
+int
+TabulatedBackbone::recvSelf(int cTag, Channel &theChannel,
+                            FEM_ObjectBroker &theBroker)
+{
+  Vector data(4);
+  int res = theChannel.recvVector(this->getDbTag(), cTag, data);
+  if (res < 0) {
+    opserr << "TabulatedBackbone::recvSelf -- could not receive Vector" << endln;
+    return res;
+  }
+
+  this->setTag((int)data(0));
+  strainMax = data(1);
+  tolerance = data(2);
+  maxPoints = (int)data(3);
+
+  ID classTags(2);
+  res += theChannel.recvID(this->getDbTag(), cTag, classTags);
+  if (res < 0) {
+    opserr << "TabulatedBackbone::recvSelf -- could not receive ID" << endln;
+    return res;
+  }
+
+  // Check that the backbone is of the right type; if not, delete
+  // the current one and get a new one of the right type
+  if (theBackbone != 0 && theBackbone->getClassTag() != classTags(0)) {
+    delete theBackbone;
+    theBackbone = 0;
+  }
+  if (theBackbone == 0) {
+    //theBackbone = theBroker.getNewHystereticBackbone(classTags(0));
+    if (theBackbone == 0) {
+      opserr << "TabulatedBackbone::recvSelf -- could not get a HystereticBackbone" << endln;
+      return -1;
+    }
+  }
+
+  theBackbone->setDbTag(classTags(1));
+  res += theBackbone->recvSelf(cTag, theChannel, theBroker);
+  if (res < 0) {
+    opserr << "TabulatedBackbone::recvSelf -- could not receive HystereticBackbone" << endln;
+    return res;
+  }
+
+  // The table is not sent, sample the received backbone again
+  this->tabulate();
+
+  return res;
+}
@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: TabulatedBackbone samples another backbone once over
+// [-strainMax, strainMax] and answers stress and tangent queries in that
+// range with a piecewise cubic Hermite interpolant of the sampled stresses
+// and tangents. The strains of the table increase monotonically and the
+// interval with the largest stress error is bisected until the error is
+// below tolerance times the largest sampled stress or the table is full.
+// Outside the range the wrapped backbone is evaluated.
+//
+// The table is shared by the copies, so a backbone that is copied into
+// many materials is sampled once.
+//
+#ifndef TabulatedBackbone_h
+#define TabulatedBackbone_h
+
+#define BACKBONE_TAG_Tabulated 30
+
+#include <memory>
+#include <vector>
+#include <HystereticBackbone.h>
+
+class TabulatedBackbone : public HystereticBackbone
+{
+ public:
+  TabulatedBackbone(int tag, HystereticBackbone &backbone, double strainMax,
+                    double tolerance, int maxPoints);
+  TabulatedBackbone();
+  ~TabulatedBackbone();
+
+  double getStress(double strain);
+  double getTangent(double strain);
+  double getEnergy(double strain);
+
+  double getYieldStrain(void);
+
+  // Evaluate the stresses and tangents at n strains
+  void getStresses(int n, const double *strain, double *stress, double *tangent);
+
+  // Largest errors found at the test points of the table, the stress error
+  // relative to the largest sampled stress and the tangent error relative
+  // to the largest sampled tangent
+  double getStressError(void) const;
+  double getTangentError(void) const;
+  int getNumPoints(void) const;
+
+  HystereticBackbone *getCopy(void);
+
+  void Print(OPS_Stream &s, int flag = 0);
+
+  int setVariable(char *argv);
+  int getVariable(int varID, double &theValue);
+
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel,
+               FEM_ObjectBroker &theBroker);
+
+ protected:
+
+ private:
+  struct Table {
+    std::vector<double> strain;       // knots, increasing
+    std::vector<double> coef;         // a + b*u + c*u^2 + d*u^3 per interval
+    std::vector<int> bucket;          // first interval of each uniform bucket
+    double invBucket;
+    double stressError;
+    double tangentError;
+  };
+
+  // sample theBackbone and build the table
+  void tabulate(void);
+
+  // interval of a strain inside the table
+  int locate(double strain) const;
+
+  HystereticBackbone *theBackbone;
+  std::shared_ptr<const Table> table;
+
+  double strainMax;
+  double tolerance;
+  int maxPoints;
+};
+
+#endif
@@ -258,7 +258,7 @@ TrilinearBackbone::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(10);
+  Vector data(10);
   
   data(0) = this->getTag();
   data(1) = e1;
@@ -286,7 +286,7 @@ TrilinearBackbone::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(10);
+  Vector data(10);
   
   res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -153,7 +153,7 @@ int VuggyLimestone::getVariable(int varID, double &theValue) { return -1; }
 int VuggyLimestone::sendSelf(int commitTag, Channel &theChannel) {
   int res = 0;
 
-  static Vector data(3);
+  thread_local Vector data(3);
 
   data(0) = this->getTag();
   data(1) = diameter;
@@ -173,7 +173,7 @@ int VuggyLimestone::recvSelf(int commitTag, Channel &theChannel,
                              FEM_ObjectBroker &theBroker) {
   int res = 0;
 
-  static Vector data(3);
+  Vector data(3);
 
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -477,7 +477,7 @@ UniaxialMaterial* Concrete01::getCopy ()
 int Concrete01::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(11);
+   Vector data(11);
    data(0) = this->getTag();
 
    // Material properties
@@ -510,7 +510,7 @@ int Concrete01::recvSelf (int commitTag, Channel& theChannel,
                                  FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(11);
+   Vector data(11);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
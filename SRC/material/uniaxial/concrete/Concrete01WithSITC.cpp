@@ -649,7 +649,7 @@ UniaxialMaterial* Concrete01WithSITC::getCopy ()
 int Concrete01WithSITC::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(16);
+   Vector data(16);
    data(0) = this->getTag();
 
    // Material properties
@@ -689,7 +689,7 @@ int Concrete01WithSITC::recvSelf (int commitTag, Channel& theChannel,
                                  FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(16);
+   Vector data(16);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
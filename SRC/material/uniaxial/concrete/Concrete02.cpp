@@ -339,7 +339,7 @@ Concrete02::revertToStart(void)
 int 
 Concrete02::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(13);
+  Vector data(13);
   data(0) =fc;    
   data(1) =epsc0; 
   data(2) =fcu;   
@@ -366,7 +366,7 @@ Concrete02::recvSelf(int commitTag, Channel &theChannel,
 	     FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(13);
+  Vector data(13);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Concrete02::recvSelf() - failed to recvSelf\n";
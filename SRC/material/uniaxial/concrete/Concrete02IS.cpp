@@ -322,7 +322,7 @@ Concrete02IS::revertToStart(void)
 int 
 Concrete02IS::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(14);
+  Vector data(14);
   data(0) =E0;    
   data(1) =fc;    
   data(2) =epsc0; 
@@ -350,7 +350,7 @@ Concrete02IS::recvSelf(int commitTag, Channel &theChannel,
 	     FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(14);
+  Vector data(14);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Concrete02IS::recvSelf() - failed to recvSelf\n";
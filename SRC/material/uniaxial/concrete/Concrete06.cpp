@@ -393,7 +393,7 @@ UniaxialMaterial* Concrete06::getCopy ()
 int Concrete06::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(24);
+   Vector data(24);
    data(0) = this->getTag();
 
    // Material properties
@@ -442,7 +442,7 @@ int Concrete06::recvSelf (int commitTag, Channel& theChannel,
                                  FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(24);
+   Vector data(24);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
@@ -373,7 +373,7 @@ int
 ConcreteD::sendSelf(int cTag, Channel &theChannel)
 {
 int res		= 0;
-static		Vector data(12);
+Vector data(12);
 data(0)		=   this->getTag();
 data(1)		=	CLoadState;
 data(2)		=	CDc;
@@ -399,7 +399,7 @@ ConcreteD::recvSelf(int cTag, Channel &theChannel,
 				 FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(12);
+  Vector data(12);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) 
     opserr << "ConcreteD::recvSelf() - failed to recv data\n";
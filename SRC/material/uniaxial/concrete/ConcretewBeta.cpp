@@ -350,7 +350,7 @@ UniaxialMaterial * ConcretewBeta::getCopy(void)
 int ConcretewBeta::sendSelf(int commitTag, Channel &theChannel)
 {
 	int res = 0;
-	static Vector data(40);
+	Vector data(40);
 	data(0) = this->getTag();
 
 	data(1) = fpc;
@@ -403,7 +403,7 @@ int ConcretewBeta::sendSelf(int commitTag, Channel &theChannel)
 int ConcretewBeta::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker) 
 {
 	int res = 0;
-	static Vector data(40);
+	Vector data(40);
 	res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
 	if (res < 0) {
@@ -912,8 +912,8 @@ Response*
 int 
 	ConcretewBeta::getResponse(int responseID, Information &matInfo)
 {
-	static Vector stressStrain(2);
-	static Vector stressStrainTangent(3);
+	thread_local Vector stressStrain(2);
+	thread_local Vector stressStrainTangent(3);
 	// each subclass must implement its own stuff   
 
 	// added for sensitivity recorder. Quan 2009
@@ -949,7 +949,7 @@ UniaxialMaterial* FRCC::getCopy()
 int FRCC::sendSelf(int commitTag, Channel& theChannel)
 {
 	int res = 0;
-	static Vector data(67);
+	Vector data(67);
 	data(0) = this->getTag();
 
 	// Input varibles
@@ -1033,7 +1033,7 @@ int FRCC::recvSelf(int commitTag, Channel& theChannel,
 	FEM_ObjectBroker& theBroker)
 {
 	int res = 0;
-	static Vector data(67);
+	Vector data(67);
 	res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
 	if (res < 0) {
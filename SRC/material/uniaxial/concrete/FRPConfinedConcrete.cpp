@@ -40,7 +40,6 @@
 #include <algorithm>
 #include <cctype>
 
-static double fpc,Ec, Ec1, Ec2, R, A, Rcore, Acore, Acover, beta1, beta2, Ash, rs, eyh;
 static const double pi = 3.1415926;
 static double min(double a, double b);
 static int numFRPConfinedConcrete = 0;
@@ -157,29 +156,7 @@ Es = Steel's Elastic modulus, vo = Poisson's coefficient for concrete, k = reduc
   useBuck = useBuck_;
 
    double Ec0;
-   R=D/2.;
-   A=pi*pow(R,2);
-   //Regions
-   //Core Region
-   Rcore=R-c;
-   Acore=pi*pow(Rcore,2);
-   //Cover Region
-   Acover=A-Acore;
-
-   //Concrete
-   fpc  = (Acore/A)*fpc1 + (Acover/A)*fpc2;
-   beta1= 5700.0/(sqrt(fpc1))-500;
-   beta2= 5700.0/ (sqrt(fpc2))-500;
-
-   //Steel
-   Ash = pi*pow(dtrans,2)/4;
-   rs  = (4*Ash)/(S*2*Rcore);
-   eyh = fyh/Es;
-  
-   // Initial tangent
-   Ec1 = 5700*sqrt(fpc1);
-   Ec2 = 5700*sqrt(fpc2);
-   Ec  = (Acore/A)*Ec1 + (Acover/A)*Ec2;
+   this->setSectionProperties();
    Ec0 = Ec;
    Ctangent = Ec0;
    CunloadSlope = Ec0;
@@ -199,6 +176,8 @@ Es = Steel's Elastic modulus, vo = Poisson's coefficient for concrete, k = reduc
 
 FRPConfinedConcrete::FRPConfinedConcrete():UniaxialMaterial(0, MAT_TAG_FRPConfinedConcrete),
  fpc1(0.0),fpc2(0.0), epsc0(0.0),
+ fpc(0.0), Ec(0.0), Ec1(0.0), Ec2(0.0), R(0.0), A(0.0), Rcore(0.0), Acore(0.0), Acover(0.0),
+ beta1(0.0), beta2(0.0), Ash(0.0), rs(0.0), eyh(0.0),
  CminStrain(0.0), CunloadSlope(0.0), CendStrain(0.0),
  Cstrain(0.0), Cstress(0.0),CaLatstress(0.0) ,CbLatstress(0.00001),CLatStrain(0.0) ,CConvFlag(true) ,CConfRat(1.0),CConfStrain(epsc0),CLBuck(0.0)
 {
@@ -217,6 +196,33 @@ FRPConfinedConcrete::~FRPConfinedConcrete()
 	  delete SHVs;
 }
 
+void FRPConfinedConcrete::setSectionProperties(void)
+{
+   R=D/2.;
+   A=pi*pow(R,2);
+   //Regions
+   //Core Region
+   Rcore=R-c;
+   Acore=pi*pow(Rcore,2);
+   //Cover Region
+   Acover=A-Acore;
+
+   //Concrete
+   fpc  = (Acore/A)*fpc1 + (Acover/A)*fpc2;
+   beta1= 5700.0/(sqrt(fpc1))-500;
+   beta2= 5700.0/ (sqrt(fpc2))-500;
+
+   //Steel
+   Ash = pi*pow(dtrans,2)/4;
+   rs  = (4*Ash)/(S*2*Rcore);
+   eyh = fyh/Es;
+  
+   // Initial tangent
+   Ec1 = 5700*sqrt(fpc1);
+   Ec2 = 5700*sqrt(fpc2);
+   Ec  = (Acore/A)*Ec1 + (Acover/A)*Ec2;
+}
+
 double FRPConfinedConcrete::getInitialTangent( ) {return Ec;}
 
 int FRPConfinedConcrete::setTrialStrain (double strain, double strainRate)
@@ -879,7 +885,7 @@ UniaxialMaterial* FRPConfinedConcrete::getCopy()
 int FRPConfinedConcrete::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(31);
+   Vector data(31);
    data(0) = this->getTag();
 
    // Material properties
@@ -932,7 +938,7 @@ int FRPConfinedConcrete::recvSelf (int commitTag, Channel& theChannel,
                                  FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(31);
+   Vector data(31);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
@@ -984,6 +990,8 @@ int FRPConfinedConcrete::recvSelf (int commitTag, Channel& theChannel,
      Ttangent = Ctangent;
    TLatStrain = CLatStrain;
    TaLatstress = CaLatstress;
+
+   this->setSectionProperties();
    }
 
    return res;
@@ -93,6 +93,9 @@ class FRPConfinedConcrete : public UniaxialMaterial
   double k;
   double useBuck; //practically boolean but declared as double to maintain input uniformity
 
+  // Section properties derived from the input
+  double fpc, Ec, Ec1, Ec2, R, A, Rcore, Acore, Acover, beta1, beta2, Ash, rs, eyh;
+
 // History variables from last converged state (Past)
   double CminStrain;
   double CunloadSlope;
@@ -133,6 +136,7 @@ class FRPConfinedConcrete : public UniaxialMaterial
   void   unload (void);
   void envelope (void);
   void flat (double flcover_n, double arrayLat[6]);
+  void setSectionProperties (void);
 
   // AddingSensitivity:BEGIN //////////////////////////////////////////
   int parameterID;
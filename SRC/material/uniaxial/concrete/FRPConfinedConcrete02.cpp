@@ -742,7 +742,7 @@ int
 FRPConfinedConcrete02::sendSelf(int cTag, Channel &theChannel)
 {
 	int res = 0;
-	static Vector data(49);
+	Vector data(49);
 	data(0) = this->getTag();
 	data(1) = m_fc0;
 	data(2) = m_Ec;
@@ -816,7 +816,7 @@ FRPConfinedConcrete02::recvSelf(int cTag, Channel &theChannel,
 								FEM_ObjectBroker &theBroker)
 {
 	int res = 0;
-	static Vector data(49);
+	Vector data(49);
 	res = theChannel.recvVector(this->getDbTag(), cTag, data);
 	if (res < 0) 
 		opserr << "FRPConfinedConcrete02::recvSelf() - failed to recv data\n";
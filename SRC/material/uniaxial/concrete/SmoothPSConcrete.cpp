@@ -515,7 +515,7 @@ UniaxialMaterial* SmoothPSConcrete::getCopy (void)
 int SmoothPSConcrete::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(20);
+   Vector data(20);
    data(0) = this->getTag();
 
    // Material properties
@@ -557,7 +557,7 @@ int SmoothPSConcrete::recvSelf (int commitTag, Channel& theChannel,
                                  FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(20);
+   Vector data(20);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
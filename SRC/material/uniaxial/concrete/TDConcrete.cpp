@@ -553,7 +553,7 @@ TDConcrete::revertToStart(void)
 int 
 TDConcrete::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(14);
+  Vector data(14);
   data(0) =ft;    
   data(1) =Ec; 
   data(2) =beta;   
@@ -581,7 +581,7 @@ TDConcrete::recvSelf(int commitTag, Channel &theChannel,
 	     FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(14);
+  Vector data(14);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "TDConcrete::recvSelf() - failed to recvSelf\n";
@@ -770,9 +770,9 @@ TDConcrete::setResponse(const char **argv, int argc,
 int 
 TDConcrete::getResponse(int responseID, Information &matInfo)
 {
-	static Vector stressStrain(2);
-	static Vector stressStrainTangent(3);
-	static Vector CreepStressStrainTangent(6); //Added by AMK
+	thread_local Vector stressStrain(2);
+	thread_local Vector stressStrainTangent(3);
+	thread_local Vector CreepStressStrainTangent(6); //Added by AMK
 	// each subclass must implement its own stuff   
 	
 	// added for sensitivity recorder. Quan 2009
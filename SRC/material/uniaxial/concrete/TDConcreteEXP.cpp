@@ -528,7 +528,7 @@ TDConcreteEXP::revertToStart(void)
 int
 TDConcreteEXP::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(11);
+  Vector data(11);
   data(0)  = ft;
   data(1)  = Ec;
   data(2)  = beta;
@@ -556,7 +556,7 @@ TDConcreteEXP::recvSelf(int commitTag, Channel &theChannel,
                         FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(14);
+  Vector data(14);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "TDConcreteEXP::recvSelf() - failed to recvSelf\n";
@@ -710,9 +710,9 @@ TDConcreteEXP::setResponse(const char **argv, int argc, OPS_Stream &theOutput)
 int
 TDConcreteEXP::getResponse(int responseID, Information &matInfo)
 {
-  static Vector stressStrain(2);
-  static Vector stressStrainTangent(3);
-  static Vector CreepStressStrainTangent(6); //Added by AMK
+  thread_local Vector stressStrain(2);
+  thread_local Vector stressStrainTangent(3);
+  thread_local Vector CreepStressStrainTangent(6); //Added by AMK
   // each subclass must implement its own stuff
 
   // added for sensitivity recorder. Quan 2009
@@ -653,7 +653,7 @@ TDConcreteMC10::revertToStart(void)
 int
 TDConcreteMC10::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(21); //ntosic
+  Vector data(21); //ntosic
   data(0)  = ft;
   data(1)  = Ec;
   data(2)  = Ecm; //ntosic
@@ -691,7 +691,7 @@ TDConcreteMC10::recvSelf(int commitTag, Channel &theChannel,
                          FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(24); //ntosic
+  Vector data(24); //ntosic
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "TDConcreteMC10::recvSelf() - failed to recvSelf\n";
@@ -885,9 +885,9 @@ TDConcreteMC10::setResponse(const char **argv, int argc, OPS_Stream &theOutput)
 int
 TDConcreteMC10::getResponse(int responseID, Information &matInfo)
 {
-  static Vector stressStrain(2);
-  static Vector stressStrainTangent(3);
-  static Vector CreepStressStrainTangent(
+  thread_local Vector stressStrain(2);
+  thread_local Vector stressStrainTangent(3);
+  thread_local Vector CreepStressStrainTangent(
       8); //Added by AMK //ntosic: modified number
   // each subclass must implement its own stuff
 
@@ -625,7 +625,7 @@ TDConcreteMC10NL::revertToStart(void)
 int 
 TDConcreteMC10NL::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(26); //ntosic
+  Vector data(26); //ntosic
   data(0) =fc;
   data(1) =fcu;
   data(2) = epscu;
@@ -665,7 +665,7 @@ TDConcreteMC10NL::recvSelf(int commitTag, Channel &theChannel,
 	     FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(26); //ntosic
+  Vector data(26); //ntosic
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "TDConcreteMC10NL::recvSelf() - failed to recvSelf\n";
@@ -906,9 +906,9 @@ TDConcreteMC10NL::setResponse(const char **argv, int argc,
 int 
 TDConcreteMC10NL::getResponse(int responseID, Information &matInfo)
 {
-	static Vector stressStrain(2);
-	static Vector stressStrainTangent(3);
-	static Vector CreepStressStrainTangent(8); //Added by AMK //ntosic: modified number
+	thread_local Vector stressStrain(2);
+	thread_local Vector stressStrainTangent(3);
+	thread_local Vector CreepStressStrainTangent(8); //Added by AMK //ntosic: modified number
 	// each subclass must implement its own stuff   
 	
 	// added for sensitivity recorder. Quan 2009
@@ -561,7 +561,7 @@ TDConcreteNL::revertToStart(void)
 int 
 TDConcreteNL::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(16);
+  Vector data(16);
   data(0) =ft;    
   data(1) =Ec; 
   data(2) =beta;   
@@ -591,7 +591,7 @@ TDConcreteNL::recvSelf(int commitTag, Channel &theChannel,
 	     FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(16);
+  Vector data(16);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "TDConcreteNL::recvSelf() - failed to recvSelf\n";
@@ -821,9 +821,9 @@ TDConcreteNL::setResponse(const char **argv, int argc,
 int 
 TDConcreteNL::getResponse(int responseID, Information &matInfo)
 {
-	static Vector stressStrain(2);
-	static Vector stressStrainTangent(3);
-	static Vector CreepStressStrainTangent(6); //Added by AMK
+	thread_local Vector stressStrain(2);
+	thread_local Vector stressStrainTangent(3);
+	thread_local Vector CreepStressStrainTangent(6); //Added by AMK
 	// each subclass must implement its own stuff   
 	
 	// added for sensitivity recorder. Quan 2009
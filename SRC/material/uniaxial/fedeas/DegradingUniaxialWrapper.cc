@@ -193,7 +193,7 @@ DegradingUniaxialWrapper::sendSelf(int cTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   dataID(0) = this->getTag();
   dataID(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -207,7 +207,7 @@ DegradingUniaxialWrapper::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dataVec(3);
+  Vector dataVec(3);
   dataVec(0) = minStrain;
   dataVec(1) = maxStrain;
   dataVec(2) = 0.0;
@@ -233,7 +233,7 @@ DegradingUniaxialWrapper::recvSelf(int cTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static ID dataID(3);
+  ID dataID(3);
   if (theChannel.recvID(dbTag, cTag, dataID) < 0) {
     opserr << "DegradingUniaxialWrapper::recvSelf() - failed to get the ID\n";
     return -1;
@@ -253,7 +253,7 @@ DegradingUniaxialWrapper::recvSelf(int cTag, Channel &theChannel,
   }
   theMaterial->setDbTag(dataID(2));
 
-  static Vector dataVec(3);
+  Vector dataVec(3);
   if (theChannel.recvVector(dbTag, cTag, dataVec) < 0) {
     opserr
         << "DegradingUniaxialWrapper::recvSelf() - failed to get the Vector\n";
@@ -253,7 +253,7 @@ int
 int 
 	OriginCentered::sendSelf(int commitTag, Channel &theChannel)
 {
-	static Vector data(15);
+	Vector data(15);
 	data(0) = f1;
 	data(1) = e1;
 	data(2) = f2;
@@ -280,7 +280,7 @@ int
 OriginCentered::recvSelf(int commitTag, Channel &theChannel, 
                          FEM_ObjectBroker &theBroker)
 {
-	static Vector data(34);
+	Vector data(34);
 
 	if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
 		opserr << "OriginCentered::recvSelf() - failed to recvSelf\n";
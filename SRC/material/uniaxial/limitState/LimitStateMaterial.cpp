@@ -989,7 +989,7 @@ LimitStateMaterial::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(27);
+  Vector data(27);
   
   data(0) = this->getTag();
   data(1) = mom1p;
@@ -1033,7 +1033,7 @@ LimitStateMaterial::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(27);
+  Vector data(27);
   res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
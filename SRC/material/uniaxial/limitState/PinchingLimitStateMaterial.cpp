@@ -801,7 +801,7 @@ int
 PinchingLimitStateMaterial::sendSelf(int cTag, Channel &theChannel)
 {
 	int res = 0;
-	static Vector data(6);
+	Vector data(6);
 	data(0) = this->getTag();
 	data(1) = E1;
 	data(2) = dmgElastic1;
@@ -837,7 +837,7 @@ PinchingLimitStateMaterial::recvSelf(int cTag, Channel &theChannel,
 				 FEM_ObjectBroker &theBroker)
 {
 	int res = 0;
-	static Vector data(6);
+	Vector data(6);
 	res = theChannel.recvVector(this->getDbTag(), cTag, data);
 	if (res < 0) 
 		opserr << "PinchingLimitStateMaterial::recvSelf() - failed to recv data\n";
@@ -229,7 +229,7 @@ AxialCurve::getCopy(void)
 int
 AxialCurve::checkElementState(double springForce)
 {
-  static DummyStream dummy;
+  thread_local DummyStream dummy;
 	// Terje
 	// Count the number of times this method is called 
 	// (this is equal to the number of loadsteps)
@@ -416,7 +416,7 @@ pyUCLA::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(13);
+  Vector data(13);
   
   data(0)  = this->getTag();
   data(1)  = soilType;
@@ -457,7 +457,7 @@ pyUCLA::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(13);
+  Vector data(13);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -222,7 +222,7 @@ int Clough::recvSelf(int cTag, Channel &theChannel,
 {
 
   int res = 0;
-  static Vector inp(40);
+  Vector inp(40);
 
   res = theChannel.recvVector(this->getDbTag(), cTag, inp);
   
@@ -259,7 +259,7 @@ int Clough::recvSelf(int cTag, Channel &theChannel,
 int Clough::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector inp(40);
+  Vector inp(40);
 	
   inp[0]  = 	elstk;
   inp[1]  =  	fyieldPos;
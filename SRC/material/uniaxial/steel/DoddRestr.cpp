@@ -714,7 +714,7 @@ UniaxialMaterial* DoddRestr::getCopy ()
 int DoddRestr::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(46);
+   Vector data(46);
    data(0) = this->getTag();
 
    // Material properties
@@ -784,7 +784,7 @@ int DoddRestr::recvSelf (int commitTag, Channel& theChannel,
                                 FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(46);
+   Vector data(46);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
    if (res < 0) {
@@ -409,7 +409,7 @@ UniaxialMaterial* Steel01::getCopy ()
 int Steel01::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(16);
+   Vector data(16);
    data(0) = this->getTag();
 
    // Material properties
@@ -447,7 +447,7 @@ int Steel01::recvSelf (int commitTag, Channel& theChannel,
                                 FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(16);
+   Vector data(16);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
    if (res < 0) {
@@ -882,7 +882,7 @@ UniaxialMaterial* Steel01Thermal::getCopy ()
 int Steel01Thermal::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(16);
+   Vector data(16);
    data(0) = this->getTag();
 
    // Material properties
@@ -920,7 +920,7 @@ int Steel01Thermal::recvSelf (int commitTag, Channel& theChannel,
                                 FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(16);
+   Vector data(16);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
    if (res < 0) {
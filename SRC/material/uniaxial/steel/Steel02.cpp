@@ -425,7 +425,7 @@ Steel02::revertToLastCommit(void)
 int 
 Steel02::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(23);
+  Vector data(23);
   data(0)  = Fy;
   data(1)  = E0;
   data(2)  = b;
@@ -461,7 +461,7 @@ int
 Steel02::recvSelf(int commitTag, Channel &theChannel, 
        FEM_ObjectBroker &theBroker)
 {
-  static Vector data(23);
+  Vector data(23);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Steel02::recvSelf() - failed to recvSelf\n";
@@ -1163,7 +1163,7 @@ Steel02Fatigue::revertToStart(void) // Add Fatigue
 int 
 Steel02Fatigue::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(23);
+  Vector data(23);
   data(0) = Fy;
   data(1) = E0;
   data(2) = b;
@@ -1199,7 +1199,7 @@ int
 Steel02Fatigue::recvSelf(int commitTag, Channel &theChannel,
 	     FEM_ObjectBroker &theBroker)
 {
-  static Vector data(23);
+  Vector data(23);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Steel02Fatigue::recvSelf() - failed to recvSelf\n";
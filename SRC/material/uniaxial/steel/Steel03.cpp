@@ -482,7 +482,7 @@ UniaxialMaterial* Steel03::getCopy ()
 int Steel03::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(25);
+   Vector data(25);
    data(0) = this->getTag();
 
    // Material properties
@@ -529,7 +529,7 @@ int Steel03::recvSelf (int commitTag, Channel& theChannel,
                                 FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(25);
+   Vector data(25);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
    if (res < 0) {
@@ -597,7 +597,7 @@ int
 int 
 	Steel2::sendSelf(int commitTag, Channel &theChannel)
 {
-	static Vector data(34);
+	Vector data(34);
 	data(0) = Fy;
 	data(1) = E0;
 	data(2) = b;
@@ -647,7 +647,7 @@ int
 	Steel2::recvSelf(int commitTag, Channel &theChannel, 
 	FEM_ObjectBroker &theBroker)
 {
-	static Vector data(34);
+	Vector data(34);
 
 	if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
 		opserr << "Steel2::recvSelf() - failed to recvSelf\n";
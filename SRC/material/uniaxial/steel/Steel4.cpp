@@ -803,11 +803,11 @@ int Steel4::sendSelf(int commitTag, Channel &theChannel) {
   vecSize += numPrevHalfCycles * 11;   // Vector variables
 
   // Instantiate a Vector to store the relevant class attributes
-  static Vector data(vecSize);
+  Vector data(vecSize);
 
   // Instantiate a Vector to store the number of previous half-cycles
   // So that `recvSelf` can determine the size of the data vector to receive
-  static ID dataCycl(1);
+  ID dataCycl(1);
   dataCycl(0) = numPrevHalfCycles;
 
   // Fill the data Vector with class attributes.
@@ -943,7 +943,7 @@ int Steel4::recvSelf(int commitTag, Channel &theChannel,
                      FEM_ObjectBroker &theBroker) {
 
   // First retrieve the size vector to determine the size of the data vector
-  static ID dataCycl(1);
+  ID dataCycl(1);
   
   int res = theChannel.recvID(this->getDbTag(), commitTag, dataCycl);
   if (res < 0) {
@@ -959,7 +959,7 @@ int Steel4::recvSelf(int commitTag, Channel &theChannel,
   
   
   // Instantiate a Vector to store the relevant class attributes
-  static Vector data(vecSize);
+  Vector data(vecSize);
 
   res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
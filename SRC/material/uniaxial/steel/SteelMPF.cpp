@@ -1119,7 +1119,7 @@ UniaxialMaterial* SteelMPF::getCopy()
 int SteelMPF::sendSelf (int commitTag, Channel& theChannel)
 {
 	int res = 0;
-	static Vector data(42);
+	Vector data(42);
 
 	data(0) = this->getTag();
 
@@ -1195,7 +1195,7 @@ int SteelMPF::recvSelf (int commitTag, Channel& theChannel, FEM_ObjectBroker& th
 {
 	int res = 0;
 
-	static Vector data(42);
+	Vector data(42);
 	res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
 	if (res < 0) {
@@ -189,7 +189,7 @@ PincheiraStiffnessDegradation::getCopy(void)
 int
 PincheiraStiffnessDegradation::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(7);
+  Vector data(7);
   
   data(0) = this->getTag();
   data(1) = alpha;
@@ -211,7 +211,7 @@ int
 PincheiraStiffnessDegradation::recvSelf(int commitTag, Channel &theChannel, 
 					FEM_ObjectBroker &theBroker)
 {
-  static Vector data(7);
+  Vector data(7);
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
@@ -148,7 +148,7 @@ ConstantStrengthDegradation::getCopy(void)
 int
 ConstantStrengthDegradation::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(4);
+  Vector data(4);
   
   data(0) = this->getTag();
   data(1) = alpha;
@@ -167,7 +167,7 @@ int
 ConstantStrengthDegradation::recvSelf(int commitTag, Channel &theChannel, 
 				      FEM_ObjectBroker &theBroker)
 {
-  static Vector data(4);
+  Vector data(4);
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
@@ -168,7 +168,7 @@ EnergyStrengthDegradation::getCopy(void)
 int
 EnergyStrengthDegradation::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(5);
+  Vector data(5);
   
   data(0) = this->getTag();
   data(1) = Et;
@@ -188,7 +188,7 @@ int
 EnergyStrengthDegradation::recvSelf(int commitTag, Channel &theChannel, 
 				    FEM_ObjectBroker &theBroker)
 {
-  static Vector data(5);
+  Vector data(5);
   
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
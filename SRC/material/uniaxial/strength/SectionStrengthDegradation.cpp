@@ -160,7 +160,7 @@ SectionStrengthDegradation::getCopy(void)
 int
 SectionStrengthDegradation::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(6);
+  Vector data(6);
   
   data(0) = this->getTag();
   data(1) = e1;
@@ -181,7 +181,7 @@ int
 SectionStrengthDegradation::recvSelf(int commitTag, Channel &theChannel, 
 				     FEM_ObjectBroker &theBroker)
 {
-  static Vector data(6);
+  Vector data(6);
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
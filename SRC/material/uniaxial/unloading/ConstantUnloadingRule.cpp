@@ -149,7 +149,7 @@ ConstantUnloadingRule::getCopy(void)
 int
 ConstantUnloadingRule::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(4);
+  Vector data(4);
   
   data(0) = this->getTag();
   data(1) = alpha;
@@ -168,7 +168,7 @@ int
 ConstantUnloadingRule::recvSelf(int commitTag, Channel &theChannel, 
 				FEM_ObjectBroker &theBroker)
 {
-  static Vector data(4);
+  Vector data(4);
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
   if (res < 0) {
@@ -164,7 +164,7 @@ EnergyUnloadingRule::getCopy(void)
 int
 EnergyUnloadingRule::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(5);
+  Vector data(5);
   
   data(0) = this->getTag();
   data(1) = Et;
@@ -184,7 +184,7 @@ int
 EnergyUnloadingRule::recvSelf(int commitTag, Channel &theChannel, 
 			      FEM_ObjectBroker &theBroker)
 {
-  static Vector data(5);
+  Vector data(5);
   
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
@@ -172,10 +172,10 @@ ContinuumUniaxial::setTrialStrain(double strain, double strainRate)
   strain11 = strain;
 
   double norm;
-  static Vector condensedStress(5);
-  static Vector strainIncrement(5);
-  static Vector threeDstrain(6);
-  static Matrix dd22(5,5);
+  thread_local Vector condensedStress(5);
+  thread_local Vector strainIncrement(5);
+  thread_local Vector threeDstrain(6);
+  thread_local Matrix dd22(5,5);
 
   //newton loop to solve for out-of-plane strains
   do {
@@ -243,11 +243,11 @@ ContinuumUniaxial::getStress()
 double
 ContinuumUniaxial::getTangent()
 {
-  static Matrix dd11(1,1);
-  static Matrix dd12(1,5);
-  static Matrix dd21(5,1);
-  static Matrix dd22(5,5);
-  static Matrix dd22invdd21(5,1);
+  thread_local Matrix dd11(1,1);
+  thread_local Matrix dd12(1,5);
+  thread_local Matrix dd21(5,1);
+  thread_local Matrix dd22(5,5);
+  thread_local Matrix dd22invdd21(5,1);
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
@@ -290,7 +290,7 @@ ContinuumUniaxial::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and associated materials class and database tags into an id and send it
-  static ID idData(3);
+  ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -307,7 +307,7 @@ ContinuumUniaxial::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(6);
+  Vector vecData(6);
   vecData(0) = Cstrain22;
   vecData(1) = Cstrain33;
   vecData(2) = Cgamma12;
@@ -336,7 +336,7 @@ ContinuumUniaxial::recvSelf(int commitTag, Channel &theChannel,
   int res = 0;
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  ID idData(3);
   res = theChannel.recvID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "ContinuumUniaxial::sendSelf() - failed to send id data" << endln;
@@ -360,7 +360,7 @@ ContinuumUniaxial::recvSelf(int commitTag, Channel &theChannel,
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(6);
+  Vector vecData(6);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     opserr << "ContinuumUniaxial::sendSelf() - failed to send vector data" << endln;
@@ -404,14 +404,14 @@ ContinuumUniaxial::getStressSensitivity(int gradIndex, bool conditional)
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Vector dd12(5);
+  thread_local Vector dd12(5);
   dd12(0) = threeDtangent(0,1);
   dd12(1) = threeDtangent(0,2);
   dd12(2) = threeDtangent(0,3);
   dd12(3) = threeDtangent(0,4);
   dd12(4) = threeDtangent(0,5);
 
-  static Matrix dd22(5,5);
+  thread_local Matrix dd22(5,5);
   dd22(0,0) = threeDtangent(1,1);
   dd22(1,0) = threeDtangent(2,1);
   dd22(2,0) = threeDtangent(3,1);
@@ -442,14 +442,14 @@ ContinuumUniaxial::getStressSensitivity(int gradIndex, bool conditional)
   dd22(3,4) = threeDtangent(4,5);
   dd22(4,4) = threeDtangent(5,5);
 
-  static Vector sigma2(5);
+  thread_local Vector sigma2(5);
   sigma2(0) = threeDstress(1);
   sigma2(1) = threeDstress(2);
   sigma2(2) = threeDstress(3);
   sigma2(3) = threeDstress(4);
   sigma2(4) = threeDstress(5);
 
-  static Vector dd22sigma2(5);
+  thread_local Vector dd22sigma2(5);
   dd22.Solve(sigma2,dd22sigma2);
 
   stress -= dd12^ dd22sigma2;
@@ -460,11 +460,11 @@ ContinuumUniaxial::getStressSensitivity(int gradIndex, bool conditional)
 int 
 ContinuumUniaxial::commitSensitivity(double depsdh, int gradIndex, int numGrads)
 {
-  static Vector dstraindh(6);
+  thread_local Vector dstraindh(6);
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd22(5,5);
+  thread_local Matrix dd22(5,5);
   dd22(0,0) = threeDtangent(1,1);
   dd22(1,0) = threeDtangent(2,1);
   dd22(2,0) = threeDtangent(3,1);
@@ -495,14 +495,14 @@ ContinuumUniaxial::commitSensitivity(double depsdh, int gradIndex, int numGrads)
   dd22(3,4) = threeDtangent(4,5);
   dd22(4,4) = threeDtangent(5,5);
 
-  static Vector dd21(5);
+  thread_local Vector dd21(5);
   dd21(0) = threeDtangent(1,0);
   dd21(1) = threeDtangent(2,0);
   dd21(2) = threeDtangent(3,0);
   dd21(3) = threeDtangent(4,0);
   dd21(4) = threeDtangent(5,0);
   
-  static Vector sigma2(5);
+  thread_local Vector sigma2(5);
   sigma2.addVector(0.0, dd21, -depsdh);
 
   const Vector &threeDstress = theMaterial->getStressSensitivity(gradIndex, true);
@@ -520,7 +520,7 @@ ContinuumUniaxial::commitSensitivity(double depsdh, int gradIndex, int numGrads)
   //sigma2(3) += threeDstress2(5);
 
 
-  static Vector strain2(5);
+  thread_local Vector strain2(5);
   dd22.Solve(sigma2,strain2);
 
 
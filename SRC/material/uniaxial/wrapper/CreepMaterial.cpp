@@ -653,7 +653,7 @@ CreepMaterial::sendSelf(int commitTag, Channel &theChannel)
 
   int dbTag = this->getDbTag();
 
-  static ID classTags(4);
+  ID classTags(4);
 
   classTags(0) = wrappedMaterial->getClassTag();
 
@@ -749,7 +749,7 @@ CreepMaterial::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID idata(4);
+  ID idata(4);
   int dbTag = this->getDbTag();
 
   res = theChannel.recvID(dbTag, commitTag, idata);
@@ -969,9 +969,9 @@ CreepMaterial::setResponse(const char **argv, int argc,
 int 
 CreepMaterial::getResponse(int responseID, Information &matInfo)
 {
-  static Vector stressStrain(2);
-  static Vector stressStrainTangent(3);
-  static Vector CreepStressStrainTangent(6); //Added by AMK
+  thread_local Vector stressStrain(2);
+  thread_local Vector stressStrainTangent(3);
+  thread_local Vector CreepStressStrainTangent(6); //Added by AMK
   // each subclass must implement its own stuff   
   
   // added for sensitivity recorder. Quan 2009
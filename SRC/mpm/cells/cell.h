@@ -84,7 +84,7 @@ class Cell {
   bool status() const { return particles_.size(); }
 
   //! Return particles_
-  std::vector<Index> particles() const { return particles_; }
+  const std::vector<Index>& particles() const { return particles_; }
 
   //! Number of nodes
   unsigned nnodes() const { return nodes_.size(); }
@@ -131,7 +131,7 @@ class Cell {
   unsigned nneighbours() const { return neighbours_.size(); }
 
   //! Return neighbour ids
-  std::set<mpm::Index> neighbours() const { return neighbours_; }
+  const std::set<mpm::Index>& neighbours() const { return neighbours_; }
 
   //! Add an id of a particle in the cell
   //! \param[in] id Global id of a particle
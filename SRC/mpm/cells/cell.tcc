@@ -984,7 +984,8 @@ bool mpm::Cell<Tdim>::initialiase_nonlocal(
       this->element_->initialise_lme_connectivity_properties(
           nonlocal_properties.at("beta"),
           nonlocal_properties.at("support_radius"),
-          nonlocal_properties.at("anisotropy"), this->nodal_coordinates_);
+          nonlocal_properties.at("anisotropy"),
+          nonlocal_properties.at("skip_tolerance"), this->nodal_coordinates_);
     } else
       throw std::runtime_error(
           "Initialise nonlocal cell failed! Element type is not compatible.");
@@ -35,18 +35,21 @@ inline void mpm::ContactFriction<Tdim>::compute_contact_forces() {
       &mpm::ParticleBase<Tdim>::map_multimaterial_domain_gradients_to_nodes,
       std::placeholders::_1));
 
-  // Compute multimaterial change in momentum
-  mesh_->iterate_over_nodes(
+  // Compute multimaterial change in momentum at active nodes
+  mesh_->iterate_over_nodes_predicate(
       std::bind(&mpm::NodeBase<Tdim>::compute_multimaterial_change_in_momentum,
-                std::placeholders::_1));
+                std::placeholders::_1),
+      std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
 
   // Compute multimaterial separation vector
-  mesh_->iterate_over_nodes(
+  mesh_->iterate_over_nodes_predicate(
       std::bind(&mpm::NodeBase<Tdim>::compute_multimaterial_separation_vector,
-                std::placeholders::_1));
+                std::placeholders::_1),
+      std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
 
   // Compute multimaterial normal unit vector
-  mesh_->iterate_over_nodes(
+  mesh_->iterate_over_nodes_predicate(
       std::bind(&mpm::NodeBase<Tdim>::compute_multimaterial_normal_unit_vector,
-                std::placeholders::_1));
+                std::placeholders::_1),
+      std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
 }
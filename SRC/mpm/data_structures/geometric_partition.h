@@ -0,0 +1,60 @@
+#ifndef MPM_GEOMETRIC_PARTITION_H_
+#define MPM_GEOMETRIC_PARTITION_H_
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "cell.h"
+#include "data_types.h"
+#include "vector.h"
+
+namespace mpm {
+
+//! Geometric partition class
+//! \brief Partitions cells across MPI ranks by recursive coordinate bisection
+//! \details Cells are weighted by the number of particles across all ranks
+//! and bisected along the longest extent of their centroids. The partition is
+//! computed redundantly on every rank from the same data, so no communication
+//! or graph partitioning library is needed.
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class GeometricPartition {
+ public:
+  //! Constructor with cells
+  //! \param[in] cells Vector of cells
+  explicit GeometricPartition(Vector<Cell<Tdim>> cells);
+
+  //! Create partitions and assign the rank of cells
+  //! \details Requires the global number of particles of each cell
+  //! \param[in] mpi_size # of MPI tasks
+  //! \retval exchange_cells Cells with particles whose rank has changed
+  std::vector<mpm::Index> create_partitions(int mpi_size);
+
+ private:
+  //! Bisect a range of cells recursively
+  //! \param[in] begin Begin of the range of cell indices
+  //! \param[in] end End of the range of cell indices
+  //! \param[in] rank First rank of the range
+  //! \param[in] nparts Number of partitions of the range
+  void bisect(std::vector<mpm::Index>::iterator begin,
+              std::vector<mpm::Index>::iterator end, unsigned rank,
+              unsigned nparts);
+
+  // Vector of cells
+  Vector<Cell<Tdim>> cells_;
+  // Centroids of cells
+  std::vector<Eigen::Matrix<double, Tdim, 1>> centroids_;
+  // Weights of cells
+  std::vector<double> weights_;
+  // Partition ids
+  std::vector<unsigned> part_;
+};  // GeometricPartition class
+}  // namespace mpm
+
+#include "geometric_partition.tcc"
+
+#endif  // MPM_GEOMETRIC_PARTITION_H_
@@ -0,0 +1,98 @@
+//! Constructor with cells
+template <unsigned Tdim>
+mpm::GeometricPartition<Tdim>::GeometricPartition(Vector<Cell<Tdim>> cells) {
+  this->cells_ = cells;
+}
+
+//! Create partitions and assign the rank of cells
+template <unsigned Tdim>
+std::vector<mpm::Index> mpm::GeometricPartition<Tdim>::create_partitions(
+    int mpi_size) {
+  const mpm::Index ncells = cells_.size();
+  centroids_.resize(ncells);
+  weights_.resize(ncells);
+  part_.assign(ncells, 0);
+
+  // Centroids and particle weights in the order of the cells
+  mpm::Index i = 0;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr, ++i) {
+    centroids_[i] = (*citr)->centroid();
+    weights_[i] = (*citr)->nglobal_particles();
+  }
+
+  // Bisect all cells
+  std::vector<mpm::Index> indices(ncells);
+  std::iota(indices.begin(), indices.end(), 0);
+  if (mpi_size > 0)
+    this->bisect(indices.begin(), indices.end(), 0,
+                 static_cast<unsigned>(mpi_size));
+
+  // ID of cells, which should transfer particles
+  std::vector<mpm::Index> exchange_cells;
+  i = 0;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr, ++i) {
+    // If the current rank is different from cell rank
+    if (part_[i] != (*citr)->rank()) {
+      // Assign current MPI rank
+      (*citr)->rank(part_[i]);
+      // Add cell id to list of cells to transfer particles if there are
+      // particles
+      if ((*citr)->nglobal_particles() > 0)
+        exchange_cells.emplace_back((*citr)->id());
+    }
+  }
+  return exchange_cells;
+}
+
+//! Bisect a range of cells recursively
+template <unsigned Tdim>
+void mpm::GeometricPartition<Tdim>::bisect(
+    std::vector<mpm::Index>::iterator begin,
+    std::vector<mpm::Index>::iterator end, unsigned rank, unsigned nparts) {
+  if (begin == end) return;
+
+  // Single partition
+  if (nparts == 1) {
+    for (auto itr = begin; itr != end; ++itr) part_[*itr] = rank;
+    return;
+  }
+
+  // Split along the longest extent of the centroids
+  Eigen::Matrix<double, Tdim, 1> min = centroids_[*begin];
+  Eigen::Matrix<double, Tdim, 1> max = centroids_[*begin];
+  for (auto itr = begin; itr != end; ++itr) {
+    min = min.cwiseMin(centroids_[*itr]);
+    max = max.cwiseMax(centroids_[*itr]);
+  }
+  Eigen::Index dir = 0;
+  (max - min).maxCoeff(&dir);
+
+  // Sort along the direction, ties are broken by index to be deterministic
+  std::sort(begin, end, [this, dir](mpm::Index a, mpm::Index b) {
+    if (centroids_[a](dir) != centroids_[b](dir))
+      return centroids_[a](dir) < centroids_[b](dir);
+    return a < b;
+  });
+
+  // Weight of the range, cells are counted when there are no particles
+  const unsigned nleft = nparts / 2;
+  double total = 0.;
+  for (auto itr = begin; itr != end; ++itr) total += weights_[*itr];
+  const bool unweighted = (total <= 0.);
+  if (unweighted) total = static_cast<double>(std::distance(begin, end));
+
+  // Split at the weighted fraction of the left partitions
+  const double target = total * nleft / nparts;
+  double sum = 0.;
+  auto split = begin;
+  while (split != end) {
+    const double weight = unweighted ? 1. : weights_[*split];
+    // Stop at the cell closest to the target
+    if (sum + 0.5 * weight > target) break;
+    sum += weight;
+    ++split;
+  }
+
+  this->bisect(begin, split, rank, nleft);
+  this->bisect(split, end, rank + nleft, nparts - nleft);
+}
@@ -0,0 +1,83 @@
+#ifndef MPM_NEIGHBOUR_LIST_H_
+#define MPM_NEIGHBOUR_LIST_H_
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "data_types.h"
+
+namespace mpm {
+
+//! Neighbour list class
+//! \brief Compressed lists of the neighbour particles of cells
+//! \details Each bin holds the particle ids of a cell. The neighbour list of
+//! a target bin concatenates the particles of the bins around it, and is
+//! shared by all particles of the target. Lists are stored in compressed
+//! sparse row format, and an update only gathers again the lists of targets
+//! whose bins have changed since the previous update.
+class NeighbourList {
+ public:
+  //! Range of neighbour particle ids
+  struct Range {
+    //! Begin of the range
+    const mpm::Index* begin() const { return first; }
+    //! End of the range
+    const mpm::Index* end() const { return last; }
+    //! Number of particles in the range
+    std::size_t size() const { return last - first; }
+    //! First particle id
+    const mpm::Index* first{nullptr};
+    //! End of the particle ids
+    const mpm::Index* last{nullptr};
+  };
+
+  //! Update the neighbour lists
+  //! \param[in] bins Particle ids of each bin, the first ntargets bins are the
+  //! targets and targets without particles have no neighbours
+  //! \param[in] ntargets Number of target bins
+  //! \param[in] offsets Offsets of the neighbour bins of each target (ntargets
+  //! + 1)
+  //! \param[in] neighbour_bins Bins around each target, including the target
+  void update(const std::vector<const std::vector<mpm::Index>*>& bins,
+              std::size_t ntargets, const std::vector<std::size_t>& offsets,
+              const std::vector<std::size_t>& neighbour_bins);
+
+  //! Neighbour particles of a target bin
+  //! \param[in] target Index of the target bin
+  Range neighbours(std::size_t target) const {
+    return {particles_.data() + offsets_[target],
+            particles_.data() + offsets_[target + 1]};
+  }
+
+  //! Number of target bins
+  std::size_t ntargets() const {
+    return offsets_.empty() ? 0 : offsets_.size() - 1;
+  }
+
+  //! Number of targets gathered again by the last update
+  std::size_t nupdated() const { return nupdated_; }
+
+ private:
+  //! Signature of the particle ids of a bin
+  //! \param[in] particles Particle ids
+  static uint64_t signature(const std::vector<mpm::Index>& particles);
+
+  //! Offsets of the neighbour particles of each target
+  std::vector<std::size_t> offsets_;
+  //! Neighbour particles of all targets
+  std::vector<mpm::Index> particles_;
+  //! Signatures of the bins at the last update
+  std::vector<uint64_t> signatures_;
+  //! Offsets of the neighbour bins at the last update
+  std::vector<std::size_t> bin_offsets_;
+  //! Neighbour bins at the last update
+  std::vector<std::size_t> neighbour_bins_;
+  //! Number of targets gathered again by the last update
+  std::size_t nupdated_{0};
+};
+}  // namespace mpm
+
+#include "neighbour_list.tcc"
+
+#endif  // MPM_NEIGHBOUR_LIST_H_
@@ -0,0 +1,96 @@
+//! Signature of the particle ids of a bin
+inline uint64_t mpm::NeighbourList::signature(
+    const std::vector<mpm::Index>& particles) {
+  // FNV-1a over the ids, the order of particles is part of the signature
+  uint64_t hash = 14695981039346656037ULL ^ particles.size();
+  for (const auto id : particles) {
+    hash ^= static_cast<uint64_t>(id);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+//! Update the neighbour lists
+inline void mpm::NeighbourList::update(
+    const std::vector<const std::vector<mpm::Index>*>& bins,
+    std::size_t ntargets, const std::vector<std::size_t>& offsets,
+    const std::vector<std::size_t>& neighbour_bins) {
+  const std::size_t nbins = bins.size();
+
+  // Bins whose particles have changed since the last update
+  std::vector<uint64_t> signatures(nbins);
+  std::vector<uint8_t> changed_bins(nbins, 1);
+  const bool same_bins = (signatures_.size() == nbins);
+#pragma omp parallel for schedule(runtime)
+  for (std::size_t i = 0; i < nbins; ++i) {
+    signatures[i] = signature(*bins[i]);
+    if (same_bins) changed_bins[i] = (signatures[i] != signatures_[i]);
+  }
+
+  // Every target is gathered again when the bins around targets change
+  const bool same_topology =
+      same_bins && (bin_offsets_ == offsets) &&
+      (neighbour_bins_ == neighbour_bins) && (this->ntargets() == ntargets);
+
+  // Targets around a changed bin and number of neighbour particles
+  std::vector<uint8_t> changed(ntargets, 1);
+  std::vector<std::size_t> counts(ntargets, 0);
+#pragma omp parallel for schedule(runtime)
+  for (std::size_t i = 0; i < ntargets; ++i) {
+    bool target_changed = !same_topology || changed_bins[i];
+    std::size_t count = 0;
+    // Targets without particles have no neighbours
+    if (!bins[i]->empty()) {
+      for (std::size_t j = offsets[i]; j < offsets[i + 1]; ++j) {
+        count += bins[neighbour_bins[j]]->size();
+        if (changed_bins[neighbour_bins[j]]) target_changed = true;
+      }
+    }
+    changed[i] = target_changed;
+    counts[i] = count;
+  }
+
+  // Offsets of the neighbour particles
+  std::vector<std::size_t> new_offsets(ntargets + 1, 0);
+  for (std::size_t i = 0; i < ntargets; ++i)
+    new_offsets[i + 1] = new_offsets[i] + counts[i];
+
+  // Unchanged targets keep their particles, which are moved only if the
+  // size of another target has changed
+  std::vector<mpm::Index> new_particles;
+  const bool same_offsets = same_topology && (new_offsets == offsets_);
+  if (!same_offsets) new_particles.resize(new_offsets[ntargets]);
+  mpm::Index* dst = same_offsets ? particles_.data() : new_particles.data();
+
+  std::size_t nupdated = 0;
+#pragma omp parallel for schedule(runtime) reduction(+ : nupdated)
+  for (std::size_t i = 0; i < ntargets; ++i) {
+    mpm::Index* target = dst + new_offsets[i];
+    if (!changed[i]) {
+      if (!same_offsets && counts[i] > 0)
+        std::memcpy(target, particles_.data() + offsets_[i],
+                    counts[i] * sizeof(mpm::Index));
+      continue;
+    }
+    if (counts[i] == 0) continue;
+    for (std::size_t j = offsets[i]; j < offsets[i + 1]; ++j) {
+      const auto& particles = *bins[neighbour_bins[j]];
+      if (particles.empty()) continue;
+      std::memcpy(target, particles.data(),
+                  particles.size() * sizeof(mpm::Index));
+      target += particles.size();
+    }
+    ++nupdated;
+  }
+
+  if (!same_offsets) {
+    particles_.swap(new_particles);
+    offsets_.swap(new_offsets);
+  }
+  signatures_.swap(signatures);
+  if (!same_topology) {
+    bin_offsets_ = offsets;
+    neighbour_bins_ = neighbour_bins;
+  }
+  nupdated_ = nupdated;
+}
@@ -6,6 +6,7 @@ void mpm::QuadrilateralBSplineElement<Tdim, Tpolynomial>::
         const std::vector<std::vector<unsigned>>& nodal_properties,
         bool kernel_correction) {
   assert(nodal_coordinates.rows() == nodal_properties.size());
+  assert(nodal_coordinates.rows() <= max_nconnectivity);
 
   this->nconnectivity_ = nodal_coordinates.rows();
   this->nodal_coordinates_ = nodal_coordinates;
@@ -15,6 +16,45 @@ void mpm::QuadrilateralBSplineElement<Tdim, Tpolynomial>::
   this->spacing_length_ =
       std::abs(nodal_coordinates(1, 0) - nodal_coordinates(0, 0));
 
+  //! Knot coordinates of the distinct nodal coordinates and node types in
+  //! each direction, nodes in a row share the basis in that direction
+  const double tolerance = 1.E-10 * this->spacing_length_;
+  for (unsigned i = 0; i < Tdim; ++i) this->axis_knots_[i].clear();
+  this->axis_index_.resize(this->nconnectivity_);
+  for (unsigned n = 0; n < this->nconnectivity_; ++n) {
+    for (unsigned i = 0; i < Tdim; ++i) {
+      const double coordinate = nodal_coordinates(n, i);
+      const unsigned type = this->node_type_[n][i];
+      auto& axis_knots = this->axis_knots_[i];
+      unsigned index = 0;
+      while (index < axis_knots.size() &&
+             !(axis_knots[index].type == type &&
+               std::abs(axis_knots[index].coordinate - coordinate) <
+                   tolerance))
+        ++index;
+
+      if (index == axis_knots.size()) {
+        AxisKnots knots;
+        knots.coordinate = coordinate;
+        knots.type = type;
+        // Lower and upper boundary nodes add the basis of a virtual node
+        const unsigned virtual_type = (type == 1) ? 5 : 6;
+        knots.virtual_node = (type == 1 || type == 4);
+        for (unsigned j = 0; j < Tpolynomial + 2; ++j) {
+          knots.knots[j] =
+              coordinate + this->spacing_length_ * BSplineKnotVector[type][j];
+          knots.virtual_knots[j] =
+              knots.virtual_node
+                  ? coordinate + this->spacing_length_ *
+                                     BSplineKnotVector[virtual_type][j]
+                  : 0.;
+        }
+        axis_knots.emplace_back(knots);
+      }
+      this->axis_index_[n][i] = index;
+    }
+  }
+
   //! Identify if element is at boundary to see if kernel correction is
   //! necessary
   if (kernel_correction) {
@@ -30,6 +70,46 @@ void mpm::QuadrilateralBSplineElement<Tdim, Tpolynomial>::
   }
 }
 
+//! Compute the B-Spline shape functions and gradients of the connected nodes
+template <unsigned Tdim, unsigned Tpolynomial>
+inline void mpm::QuadrilateralBSplineElement<Tdim, Tpolynomial>::nodal_basis(
+    const VectorDim& pcoord, NodalVector& shapefn,
+    NodalMatrix& grad_shapefn) const {
+  //! Basis and gradient of each distinct knot vector in each direction
+  Eigen::Matrix<double, max_nconnectivity, Tdim> basis, gradient;
+  for (unsigned i = 0; i < Tdim; ++i) {
+    for (unsigned k = 0; k < this->axis_knots_[i].size(); ++k) {
+      const auto& knots = this->axis_knots_[i][k];
+      mpm::kernels::bspline<Tpolynomial>(pcoord[i], knots.knots.data(),
+                                         &basis(k, i), &gradient(k, i));
+      if (knots.virtual_node) {
+        double virtual_basis, virtual_gradient;
+        mpm::kernels::bspline<Tpolynomial>(pcoord[i],
+                                           knots.virtual_knots.data(),
+                                           &virtual_basis, &virtual_gradient);
+        basis(k, i) += virtual_basis;
+        gradient(k, i) += virtual_gradient;
+      }
+    }
+  }
+
+  //! Combine the basis of each direction following a multiplicative rule
+  shapefn.resize(this->nconnectivity_);
+  grad_shapefn.resize(this->nconnectivity_, Tdim);
+  for (unsigned n = 0; n < this->nconnectivity_; ++n) {
+    const auto& index = this->axis_index_[n];
+    double N = 1.0;
+    for (unsigned i = 0; i < Tdim; ++i) N *= basis(index[i], i);
+    shapefn(n) = N;
+    for (unsigned i = 0; i < Tdim; ++i) {
+      double dN_dx = gradient(index[i], i);
+      for (unsigned j = 0; j < Tdim; ++j)
+        if (j != i) dN_dx *= basis(index[j], j);
+      grad_shapefn(n, i) = dN_dx;
+    }
+  }
+}
+
 //! Return shape functions of a Quadrilateral BSpline Element at a given
 //! local coordinate
 template <unsigned Tdim, unsigned Tpolynomial>
@@ -39,14 +119,13 @@ inline Eigen::VectorXd
         Eigen::Matrix<double, Tdim, 1>& particle_size,
         const Eigen::Matrix<double, Tdim, Tdim>& deformation_gradient) const {
 
-  //! To store shape functions
-  Eigen::VectorXd shapefn =
-      Eigen::VectorXd::Constant(this->nconnectivity_, 1.0);
-
   if (this->nconnectivity_ == 4)
     return mpm::QuadrilateralElement<Tdim, 4>::shapefn(xi, particle_size,
                                                        deformation_gradient);
 
+  //! To store shape functions
+  NodalVector shapefn = NodalVector::Constant(this->nconnectivity_, 1.0);
+
   try {
     //! Check if we need to apply kernel correction based on particle position
     //! with respective to local element nodes
@@ -65,25 +144,8 @@ inline Eigen::VectorXd
           local_shapefn(i) * nodal_coordinates_.row(i).transpose();
 
     //! Compute shape function following a multiplicative rule
-    for (unsigned n = 0; n < this->nconnectivity_; ++n) {
-      //! Loop over dimension
-      for (unsigned i = 0; i < Tdim; ++i) {
-        double N = this->kernel(pcoord[i], nodal_coordinates_.row(n)[i],
-                                this->node_type_[n][i], Tpolynomial);
-        switch (this->node_type_[n][i]) {
-          case 1:
-            N += this->kernel(pcoord[i], nodal_coordinates_.row(n)[i], 5,
-                              Tpolynomial);
-            break;
-          case 4:
-            N += this->kernel(pcoord[i], nodal_coordinates_.row(n)[i], 6,
-                              Tpolynomial);
-            break;
-        }
-
-        shapefn[n] = shapefn[n] * N;
-      }
-    }
+    NodalMatrix grad_shapefn;
+    this->nodal_basis(pcoord, shapefn, grad_shapefn);
 
     //! If kernel correction is needed
     if (apply_kernel_correction) {
@@ -122,13 +184,13 @@ inline Eigen::MatrixXd
         Eigen::Matrix<double, Tdim, 1>& particle_size,
         const Eigen::Matrix<double, Tdim, Tdim>& deformation_gradient) const {
 
-  //! To store grad shape functions
-  Eigen::MatrixXd grad_shapefn(this->nconnectivity_, Tdim);
-
   if (this->nconnectivity_ == 4)
     return mpm::QuadrilateralElement<Tdim, 4>::grad_shapefn(
         xi, particle_size, deformation_gradient);
 
+  //! To store grad shape functions
+  NodalMatrix grad_shapefn(this->nconnectivity_, Tdim);
+
   try {
     //! Check if we need to apply kernel correction based on particle position
     //! with respective to local element nodes
@@ -146,69 +208,12 @@ inline Eigen::MatrixXd
       pcoord.noalias() +=
           local_shapefn(i) * nodal_coordinates_.row(i).transpose();
 
-    if (!apply_kernel_correction) {
-      //! Compute the shape function gradient following a multiplicative rule
-      for (unsigned n = 0; n < this->nconnectivity_; ++n)
-        //! Loop over dimension
-        for (unsigned i = 0; i < Tdim; ++i) {
-          double dN_dx = this->gradient(pcoord[i], nodal_coordinates_.row(n)[i],
-                                        (this->node_type_[n])[i], Tpolynomial);
-          switch (this->node_type_[n][i]) {
-            case 1:
-              dN_dx += this->gradient(pcoord[i], nodal_coordinates_.row(n)[i],
-                                      5, Tpolynomial);
-              break;
-            case 4:
-              dN_dx += this->gradient(pcoord[i], nodal_coordinates_.row(n)[i],
-                                      6, Tpolynomial);
-              break;
-          }
-
-          for (unsigned j = 0; j < Tdim; ++j) {
-            if (j != i) {
-              double N = this->kernel(pcoord[j], nodal_coordinates_.row(n)[j],
-                                      this->node_type_[n][j], Tpolynomial);
-              switch (this->node_type_[n][j]) {
-                case 1:
-                  N += this->kernel(pcoord[j], nodal_coordinates_.row(n)[j], 5,
-                                    Tpolynomial);
-                  break;
-                case 4:
-                  N += this->kernel(pcoord[j], nodal_coordinates_.row(n)[j], 6,
-                                    Tpolynomial);
-                  break;
-              }
-              dN_dx = dN_dx * N;
-            }
-          }
-
-          grad_shapefn(n, i) = dN_dx;
-        }
-    } else {
-      Eigen::VectorXd shapefn =
-          Eigen::VectorXd::Constant(this->nconnectivity_, 1.0);
-
-      //! Compute shape function following a multiplicative rule
-      for (unsigned n = 0; n < this->nconnectivity_; ++n) {
-        //! Loop over dimension
-        for (unsigned i = 0; i < Tdim; ++i) {
-          double N = this->kernel(pcoord[i], nodal_coordinates_.row(n)[i],
-                                  this->node_type_[n][i], Tpolynomial);
-          switch (this->node_type_[n][i]) {
-            case 1:
-              N += this->kernel(pcoord[i], nodal_coordinates_.row(n)[i], 5,
-                                Tpolynomial);
-              break;
-            case 4:
-              N += this->kernel(pcoord[i], nodal_coordinates_.row(n)[i], 6,
-                                Tpolynomial);
-              break;
-          }
-
-          shapefn[n] = shapefn[n] * N;
-        }
-      }
+    //! Compute the shape function and its gradient following a
+    //! multiplicative rule
+    NodalVector shapefn;
+    this->nodal_basis(pcoord, shapefn, grad_shapefn);
 
+    if (apply_kernel_correction) {
       // Compute M inverse matrix
       Eigen::Matrix<double, Tdim + 1, Tdim + 1> M =
           Eigen::Matrix<double, Tdim + 1, Tdim + 1>::Zero();
@@ -363,77 +368,6 @@ inline Eigen::Matrix<double, Tdim, 1> mpm::QuadrilateralBSplineElement<
   return xi;
 }
 
-//! Compute B-Spline Basis Function using the recursive De Boor's algorithm
-//! for single direction
-template <unsigned Tdim, unsigned Tpolynomial>
-double mpm::QuadrilateralBSplineElement<Tdim, Tpolynomial>::kernel(
-    double point_coord, double nodal_coord, unsigned node_type,
-    unsigned poly_order, unsigned index) const {
-  double value = 0.0;
-  //! Compute knot coordinate
-  Eigen::VectorXd knot_vector = Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(
-      (this->knot(node_type)).data(), (this->knot(node_type)).size());
-  const Eigen::VectorXd one =
-      Eigen::VectorXd::Constant(knot_vector.size(), 1.0);
-  const Eigen::VectorXd knot_coord =
-      nodal_coord * one + spacing_length_ * knot_vector;
-
-  if (poly_order == 0) {
-    if (point_coord >= knot_coord[index] &&
-        point_coord < knot_coord[index + 1]) {
-      value = 1.0;
-    } else {
-      value = 0.0;
-    }
-  } else {
-    const double den_a = (knot_coord[index + poly_order] - knot_coord[index]);
-    double a = (point_coord - knot_coord(index)) / den_a;
-    if (den_a < std::numeric_limits<double>::epsilon()) a = 0;
-
-    const double den_b =
-        (knot_coord[index + poly_order + 1] - knot_coord[index + 1]);
-    double b = (knot_coord[index + poly_order + 1] - point_coord) / den_b;
-    if (den_b < std::numeric_limits<double>::epsilon()) b = 0;
-
-    value = a * this->kernel(point_coord, nodal_coord, node_type,
-                             poly_order - 1, index) +
-            b * this->kernel(point_coord, nodal_coord, node_type,
-                             poly_order - 1, index + 1);
-  }
-  return value;
-}
-
-//! Compute B-Spline Basis Function Gradient using the recursive De Boor's
-//! algorithm for single direction
-template <unsigned Tdim, unsigned Tpolynomial>
-double mpm::QuadrilateralBSplineElement<Tdim, Tpolynomial>::gradient(
-    double point_coord, double nodal_coord, unsigned node_type,
-    unsigned poly_order, unsigned index) const {
-  double value = 0;
-  Eigen::VectorXd knot_vector = Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(
-      (this->knot(node_type)).data(), (this->knot(node_type)).size());
-  const Eigen::VectorXd one =
-      Eigen::VectorXd::Constant(knot_vector.size(), 1.0);
-  const Eigen::VectorXd knot_coord =
-      nodal_coord * one + spacing_length_ * knot_vector;
-
-  const double den_a = (knot_coord[index + poly_order] - knot_coord[index]);
-  double a = poly_order / den_a;
-  if (den_a < std::numeric_limits<double>::epsilon()) a = 0;
-
-  const double den_b =
-      (knot_coord[index + poly_order + 1] - knot_coord[index + 1]);
-  double b = poly_order / den_b;
-  if (den_b < std::numeric_limits<double>::epsilon()) b = 0;
-
-  value = a * this->kernel(point_coord, nodal_coord, node_type, poly_order - 1,
-                           index) -
-          b * this->kernel(point_coord, nodal_coord, node_type, poly_order - 1,
-                           index + 1);
-
-  return value;
-}
-
 //! Function to check if particle is lying on the region where kernel
 //! correction is necessary
 template <unsigned Tdim, unsigned Tpolynomial>
@@ -1,7 +1,10 @@
 #ifndef MPM_GIMP_ELEMENT_H_
 #define MPM_GIMP_ELEMENT_H_
 
+#include <array>
+
 #include "quadrilateral_element.h"
+#include "shapefn_kernels.h"
 
 namespace mpm {
 
@@ -140,6 +143,21 @@ class QuadrilateralGIMPElement : public QuadrilateralElement<2, 4> {
   //! Return natural nodal coordinates
   Eigen::MatrixXd natural_nodal_coordinates() const;
 
+  //! Evaluate the GIMP basis functions and gradients in each direction at the
+  //! natural nodal positions -3, -1, 1 and 3
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[out] basis Basis functions at the nodal positions
+  //! \param[out] gradient Gradient of basis functions at the nodal positions
+  void axis_basis(const Eigen::Matrix<double, Tdim, 1>& xi,
+                  const Eigen::Matrix<double, Tdim, 1>& particle_size,
+                  Eigen::Matrix<double, 4, Tdim>& basis,
+                  Eigen::Matrix<double, 4, Tdim>& gradient) const;
+
+  //! Return the index of the nodal position of each node in each direction
+  const std::array<std::array<unsigned, Tdim>, Tnfunctions>& axis_index()
+      const;
+
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
 };
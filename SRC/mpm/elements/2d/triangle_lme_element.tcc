@@ -1,13 +1,14 @@
 //! Assign nodal connectivity property for LME elements
 template <unsigned Tdim>
 void mpm::TriangleLMEElement<Tdim>::initialise_lme_connectivity_properties(
-    double beta, double radius, bool anisotropy,
+    double beta, double radius, bool anisotropy, double skip_tolerance,
     const Eigen::MatrixXd& nodal_coordinates) {
   this->nconnectivity_ = nodal_coordinates.rows();
   this->nodal_coordinates_ = nodal_coordinates;
   this->beta_ = beta;
   this->anisotropy_ = anisotropy;
   this->support_radius_ = radius;
+  this->skip_tolerance_ = skip_tolerance;
 
   //! Uniform spacing length in 2D
   const double spacing_length =
@@ -43,7 +44,7 @@ inline Eigen::VectorXd mpm::TriangleLMEElement<Tdim>::shapefn(
           local_shapefn(i) * nodal_coordinates_.row(i).transpose();
 
     //! Create relative coordinate vector
-    const auto& rel_coordinates =
+    const Eigen::Matrix<double, Tdim, Eigen::Dynamic> rel_coordinates =
         (-nodal_coordinates_.transpose()).colwise() + pcoord;
 
     //! Create metric tensor
@@ -65,23 +66,17 @@ inline Eigen::VectorXd mpm::TriangleLMEElement<Tdim>::shapefn(
                               (metric * rel_coordinates.col(n)));
     }
 
-    //! Compute functional f in each connectivity
-    Eigen::VectorXd f = Eigen::VectorXd::Constant(this->nconnectivity_, 0.0);
+    //! Compute p in each connectivity from the exponential of functional f
+    Eigen::VectorXd p = Eigen::VectorXd::Constant(this->nconnectivity_, 0.0);
     double sum_exp_f = 0.;
     for (unsigned n = 0; n < this->nconnectivity_; ++n) {
       if (distance(n) < this->support_radius_) {
-        f(n) = -beta_ * distance(n) * distance(n) +
-               lambda.dot(rel_coordinates.col(n));
-        sum_exp_f += std::exp(f(n));
+        p(n) = std::exp(-beta_ * distance(n) * distance(n) +
+                        lambda.dot(rel_coordinates.col(n)));
+        sum_exp_f += p(n);
       }
     }
-
-    //! Compute p in each connectivity
-    Eigen::VectorXd p = Eigen::VectorXd::Constant(this->nconnectivity_, 0.0);
-    for (unsigned n = 0; n < this->nconnectivity_; ++n) {
-      if (distance(n) < this->support_radius_)
-        p(n) = std::exp(f(n)) / sum_exp_f;
-    }
+    p /= sum_exp_f;
 
     //! Compute vector r
     VectorDim r = VectorDim::Zero();
@@ -97,7 +92,7 @@ inline Eigen::VectorXd mpm::TriangleLMEElement<Tdim>::shapefn(
       const unsigned max_it = 100;
       while (!convergence) {
         //! Compute matrix J
-        Eigen::Matrix2d J = -r * r.transpose();
+        MatrixDim J = -r * r.transpose();
         for (unsigned n = 0; n < this->nconnectivity_; ++n) {
           J.noalias() += p(n) * ((rel_coordinates.col(n)) *
                                  (rel_coordinates.col(n)).transpose());
@@ -106,27 +101,20 @@ inline Eigen::VectorXd mpm::TriangleLMEElement<Tdim>::shapefn(
         //! Add preconditioner for J (Mathieu Foca, PhD Thesis)
         if (this->preconditioner_) J.diagonal().array() += r.norm();
 
-        //! Compute Delta lambda
-        const auto olambda = lambda;
-        const auto& dlambda = J.inverse() * (-r);
-        lambda = lambda + dlambda;
+        //! Compute Delta lambda with the closed-form inverse of J
+        const VectorDim olambda = lambda;
+        lambda.noalias() -= mpm::math::symmetric_inverse<Tdim>(J) * r;
 
-        //! Reevaluate f, p, and r
-        //! Compute functional f in each connectivity
+        //! Reevaluate p and r
         sum_exp_f = 0.;
         for (unsigned n = 0; n < this->nconnectivity_; ++n) {
           if (distance(n) < this->support_radius_) {
-            f(n) = -beta_ * distance(n) * distance(n) +
-                   lambda.dot(rel_coordinates.col(n));
-            sum_exp_f += std::exp(f(n));
+            p(n) = std::exp(-beta_ * distance(n) * distance(n) +
+                            lambda.dot(rel_coordinates.col(n)));
+            sum_exp_f += p(n);
           }
         }
-
-        //! Compute p in each connectivity
-        for (unsigned n = 0; n < this->nconnectivity_; ++n) {
-          if (distance(n) < this->support_radius_)
-            p(n) = std::exp(f(n)) / sum_exp_f;
-        }
+        p /= sum_exp_f;
 
         //! Compute vector r
         r.setZero();
@@ -194,7 +182,7 @@ inline Eigen::MatrixXd mpm::TriangleLMEElement<Tdim>::grad_shapefn(
           local_shapefn(i) * nodal_coordinates_.row(i).transpose();
 
     //! Create relative coordinate vector
-    const auto& rel_coordinates =
+    const Eigen::Matrix<double, Tdim, Eigen::Dynamic> rel_coordinates =
         (-nodal_coordinates_.transpose()).colwise() + pcoord;
 
     //! Create metric tensor
@@ -216,23 +204,17 @@ inline Eigen::MatrixXd mpm::TriangleLMEElement<Tdim>::grad_shapefn(
                               (metric * rel_coordinates.col(n)));
     }
 
-    //! Compute functional f in each connectivity
-    Eigen::VectorXd f = Eigen::VectorXd::Constant(this->nconnectivity_, 0.0);
+    //! Compute p in each connectivity from the exponential of functional f
+    Eigen::VectorXd p = Eigen::VectorXd::Constant(this->nconnectivity_, 0.0);
     double sum_exp_f = 0.;
     for (unsigned n = 0; n < this->nconnectivity_; ++n) {
       if (distance(n) < this->support_radius_) {
-        f(n) = -beta_ * distance(n) * distance(n) +
-               lambda.dot(rel_coordinates.col(n));
-        sum_exp_f += std::exp(f(n));
+        p(n) = std::exp(-beta_ * distance(n) * distance(n) +
+                        lambda.dot(rel_coordinates.col(n)));
+        sum_exp_f += p(n);
       }
     }
-
-    //! Compute p in each connectivity
-    Eigen::VectorXd p = Eigen::VectorXd::Constant(this->nconnectivity_, 0.0);
-    for (unsigned n = 0; n < this->nconnectivity_; ++n) {
-      if (distance(n) < this->support_radius_)
-        p(n) = std::exp(f(n)) / sum_exp_f;
-    }
+    p /= sum_exp_f;
 
     //! Compute vector r
     VectorDim r = VectorDim::Zero();
@@ -241,7 +223,7 @@ inline Eigen::MatrixXd mpm::TriangleLMEElement<Tdim>::grad_shapefn(
     }
 
     //! Compute matrix J
-    Eigen::Matrix2d J = -r * r.transpose();
+    MatrixDim J = -r * r.transpose();
     for (unsigned n = 0; n < this->nconnectivity_; ++n) {
       J.noalias() += p(n) * ((rel_coordinates.col(n)) *
                              (rel_coordinates.col(n)).transpose());
@@ -257,27 +239,20 @@ inline Eigen::MatrixXd mpm::TriangleLMEElement<Tdim>::grad_shapefn(
       unsigned it = 1;
       unsigned max_it = 100;
       while (!convergence) {
-        //! Compute Delta lambda
-        const auto olambda = lambda;
-        const auto& dlambda = J.inverse() * (-r);
-        lambda = lambda + dlambda;
+        //! Compute Delta lambda with the closed-form inverse of J
+        const VectorDim olambda = lambda;
+        lambda.noalias() -= mpm::math::symmetric_inverse<Tdim>(J) * r;
 
-        //! Reevaluate f, p, and r
-        //! Compute functional f in each connectivity
+        //! Reevaluate p and r
         sum_exp_f = 0.;
         for (unsigned n = 0; n < this->nconnectivity_; ++n) {
           if (distance(n) < this->support_radius_) {
-            f(n) = -beta_ * distance(n) * distance(n) +
-                   lambda.dot(rel_coordinates.col(n));
-            sum_exp_f += std::exp(f(n));
+            p(n) = std::exp(-beta_ * distance(n) * distance(n) +
+                            lambda.dot(rel_coordinates.col(n)));
+            sum_exp_f += p(n);
           }
         }
-
-        //! Compute p in each connectivity
-        for (unsigned n = 0; n < this->nconnectivity_; ++n) {
-          if (distance(n) < this->support_radius_)
-            p(n) = std::exp(f(n)) / sum_exp_f;
-        }
+        p /= sum_exp_f;
 
         //! Compute vector r
         r.setZero();
@@ -322,8 +297,9 @@ inline Eigen::MatrixXd mpm::TriangleLMEElement<Tdim>::grad_shapefn(
     }
 
     // Compute shape function gradient
+    const MatrixDim J_inverse = mpm::math::symmetric_inverse<Tdim>(J);
     for (unsigned n = 0; n < this->nconnectivity_; ++n) {
-      const VectorDim grad_p = -p(n) * J.inverse() * (rel_coordinates.col(n));
+      const VectorDim grad_p = -p(n) * (J_inverse * rel_coordinates.col(n));
       grad_shapefn.row(n) = grad_p.transpose();
     }
 
@@ -1,7 +1,10 @@
 #ifndef MPM_BSPLINE_HEX_ELEMENT_H_
 #define MPM_BSPLINE_HEX_ELEMENT_H_
 
+#include <array>
+
 #include "hexahedron_element.h"
+#include "shapefn_kernels.h"
 
 namespace mpm {
 
@@ -147,39 +150,40 @@ class HexahedronBSplineElement : public HexahedronElement<3, 8> {
   };
 
  private:
-  //! Compute B-Spline Basis Function using the recursive De Boor's algorithm
-  //! for single direction
-  //! \param[in] point_coord point coordinate in one direction
-  //! \param[in] nodal_coord nodal coordinate in one direction
-  //! dimension
-  //! \param[in] node_type Node type associated with direction
-  //! \param[in] poly_order Polynomial degree
-  //! \param[in] index Index associated to local BSplineKnotVector
-  double kernel(double point_coord, double nodal_coord, unsigned node_type,
-                unsigned poly_order, unsigned index = 0) const;
-
-  //! Compute B-Spline Basis Function Gradient using the recursive De Boor's
-  //! algorithm for single direction
-  //! \param[in] point_coord point coordinate in one direction
-  //! \param[in] nodal_coord nodal coordinate in one direction dimension
-  //! \param[in] node_type Node type associated with direction
-  //! \param[in] poly_order Polynomial degree
-  //! \param[in] index Index associated to local BSplineKnotVector
-  double gradient(double point_coord, double nodal_coord, unsigned node_type,
-                  unsigned poly_order, unsigned index = 0) const;
-
-  //! Function that returns BSpline knot vector
-  //! The order of the vectors are:
-  //! Regular = 0,
-  //! LowerBoundary = 1,
-  //! LowerIntermediate = 2,
-  //! UpperIntermediate = 3
-  //! UpperBoundary = 4,
-  //! LowerBoundaryVirtual = 5, (automatically defined)
-  //! UpperBoundaryVirtual = 6 (automatically defined)
-  std::vector<double> knot(unsigned node_type) const {
-    return BSplineKnotVector[node_type];
-  }
+  //! Maximum number of connected nodes
+  static constexpr unsigned max_nconnectivity = 64;
+
+  //! Shape functions of the connected nodes, sized at compile time
+  using NodalVector =
+      Eigen::Matrix<double, Eigen::Dynamic, 1, 0, max_nconnectivity, 1>;
+
+  //! Gradient of shape functions of the connected nodes
+  using NodalMatrix = Eigen::Matrix<double, Eigen::Dynamic, Tdim,
+                                    Eigen::ColMajor, max_nconnectivity, Tdim>;
+
+  //! Knot coordinates of a distinct nodal coordinate and node type in one
+  //! direction
+  struct AxisKnots {
+    //! Nodal coordinate
+    double coordinate;
+    //! Node type
+    unsigned type;
+    //! Knot coordinates of the node
+    std::array<double, Tpolynomial + 2> knots;
+    //! Knot coordinates of the virtual node of a boundary node
+    std::array<double, Tpolynomial + 2> virtual_knots;
+    //! Add the basis of the virtual node
+    bool virtual_node{false};
+  };
+
+  //! Compute the B-Spline shape functions and gradients of the connected
+  //! nodes, the basis of each distinct knot vector is evaluated once per
+  //! direction and combined by the multiplicative rule
+  //! \param[in] pcoord Point coordinates
+  //! \param[out] shapefn Shape functions of the connected nodes
+  //! \param[out] grad_shapefn Gradient of shape functions
+  void nodal_basis(const VectorDim& pcoord, NodalVector& shapefn,
+                   NodalMatrix& grad_shapefn) const;
 
   //! Function to check if particle is lying on the region where kernel
   //! correction is necessary
@@ -197,7 +201,19 @@ class HexahedronBSplineElement : public HexahedronElement<3, 8> {
   //! Nodal type matrix (n_connectivity_ x Tdim)
   std::vector<std::vector<unsigned>> node_type_;
   //! BSpline knot vector for different node type
+  //! The order of the vectors are:
+  //! Regular = 0,
+  //! LowerBoundary = 1,
+  //! LowerIntermediate = 2,
+  //! UpperIntermediate = 3
+  //! UpperBoundary = 4,
+  //! LowerBoundaryVirtual = 5, (automatically defined)
+  //! UpperBoundaryVirtual = 6 (automatically defined)
   std::vector<std::vector<double>> BSplineKnotVector;
+  //! Distinct knot coordinates in each direction
+  std::array<std::vector<AxisKnots>, Tdim> axis_knots_;
+  //! Index of the knot coordinates of each node in each direction
+  std::vector<std::array<unsigned, Tdim>> axis_index_;
   //! Boolean to identify kernel correction
   bool kernel_correction_{false};
 };
@@ -275,9 +275,11 @@ class HexahedronElement : public Element<Tdim> {
   //! \param[in] beta Coldness function of the system in the range of [0,inf)
   //! \param[in] radius Support radius of the kernel
   //! \param[in] anisotropy Shape function anisotropy (F^{-T}F^{-1})
+  //! \param[in] skip_tolerance Particle displacement below which shape
+  //! functions are not recomputed
   //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
   void initialise_lme_connectivity_properties(
-      double beta, double radius, bool anisotropy,
+      double beta, double radius, bool anisotropy, double skip_tolerance,
       const Eigen::MatrixXd& nodal_coordinates) override;
 
  private:
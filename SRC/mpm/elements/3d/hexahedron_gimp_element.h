@@ -1,7 +1,10 @@
 #ifndef MPM_GIMP_HEX_ELEMENT_H_
 #define MPM_GIMP_HEX_ELEMENT_H_
 
+#include <array>
+
 #include "hexahedron_element.h"
+#include "shapefn_kernels.h"
 
 namespace mpm {
 
@@ -108,6 +111,21 @@ class HexahedronGIMPElement : public HexahedronElement<3, 8> {
   //! Return natural nodal coordinates
   Eigen::MatrixXd natural_nodal_coordinates() const;
 
+  //! Evaluate the GIMP basis functions and gradients in each direction at the
+  //! natural nodal positions -3, -1, 1 and 3
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[out] basis Basis functions at the nodal positions
+  //! \param[out] gradient Gradient of basis functions at the nodal positions
+  void axis_basis(const Eigen::Matrix<double, Tdim, 1>& xi,
+                  const Eigen::Matrix<double, Tdim, 1>& particle_size,
+                  Eigen::Matrix<double, 4, Tdim>& basis,
+                  Eigen::Matrix<double, 4, Tdim>& gradient) const;
+
+  //! Return the index of the nodal position of each node in each direction
+  const std::array<std::array<unsigned, Tdim>, Tnfunctions>& axis_index()
+      const;
+
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
 };
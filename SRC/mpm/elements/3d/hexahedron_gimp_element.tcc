@@ -28,51 +28,20 @@ inline Eigen::VectorXd mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::shapefn(
     Eigen::Matrix<double, Tdim, 1>& particle_size,
     const Eigen::Matrix<double, Tdim, Tdim>& deformation_gradient) const {
 
-  //! length of element in local coordinate
-  const double element_length = 2.;
-  //! Natural nodal coordinates
-  const Eigen::Matrix<double, Tnfunctions, Tdim> local_nodes =
-      this->natural_nodal_coordinates();
   //! To store shape functions
   Eigen::Matrix<double, Tnfunctions, 1> shapefn;
 
   try {
+    //! local shape function at the nodal positions in each direction
+    Eigen::Matrix<double, 4, Tdim> sni, dni;
+    this->axis_basis(xi, particle_size, sni, dni);
+    const auto& index = this->axis_index();
+
     //! loop to iterate over nodes
     for (unsigned n = 0; n < Tnfunctions; ++n) {
-      //! local shape function in current plane (x, y or z)
-      Eigen::Matrix<double, Tdim, 1> sni;
-      //! loop to iterate over dimensions
-      for (unsigned i = 0; i < Tdim; ++i) {
-        double lp = particle_size(i) * 0.5;
-        double ni = local_nodes(n, i);
-        double npni = xi(i) - ni;  // local particle  - local node
-        //! Conditional shape function statement see: Bardenhagen 2004
-        if (npni <= (-element_length - lp)) {
-          sni(i) = 0.;
-        } else if ((-element_length - lp) < npni &&
-                   npni <= (-element_length + lp)) {
-          sni(i) = std::pow(element_length + lp + npni, 2.) /
-                   (4. * (element_length * lp));
-        } else if ((-element_length + lp) < npni && npni <= -lp) {
-          sni(i) = 1. + (npni / element_length);
-        } else if (-lp < npni && npni <= lp) {
-          sni(i) =
-              1. - (((npni * npni) + (lp * lp)) / (2. * element_length * lp));
-        } else if (lp < npni && npni <= (element_length - lp)) {
-          sni(i) = 1. - (npni / element_length);
-        } else if ((element_length - lp) < npni &&
-                   npni <= element_length + lp) {
-          sni(i) = std::pow(element_length + lp - npni, 2.) /
-                   (4. * element_length * lp);
-        } else if ((element_length + lp) < npni) {
-          sni(i) = 0.;
-        } else {
-          throw std::runtime_error(
-              "GIMP shapefn: Point location outside area of influence");
-        }
-      }
-      shapefn(n) =
-          sni(0) * sni(1) * sni(2);  // See: Pruijn, N.S., 2016. Eq(4.30)
+      const auto& k = index[n];
+      // See: Pruijn, N.S., 2016. Eq(4.30)
+      shapefn(n) = sni(k[0], 0) * sni(k[1], 1) * sni(k[2], 2);
     }
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
@@ -90,63 +59,22 @@ inline Eigen::MatrixXd
         Eigen::Matrix<double, Tdim, 1>& particle_size,
         const Eigen::Matrix<double, Tdim, Tdim>& deformation_gradient) const {
 
-  //! length of element in local coordinate
-  const double element_length = 2.;
-  //! Natural nodal coordinates
-  const Eigen::Matrix<double, Tnfunctions, Tdim> local_nodes =
-      this->natural_nodal_coordinates();
   //! To store grad shape functions
   Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn;
   try {
+    //! local shape function and its gradient at the nodal positions in each
+    //! direction
+    Eigen::Matrix<double, 4, Tdim> sni, dni;
+    this->axis_basis(xi, particle_size, sni, dni);
+    const auto& index = this->axis_index();
+
     //! loop to iterate over nodes
     for (unsigned n = 0; n < Tnfunctions; ++n) {
-      //! local shape function in current plane (x, y or z)
-      Eigen::Matrix<double, Tdim, 1> sni;
-      //! local grad shape function in current plane (x, y or z)
-      Eigen::Matrix<double, Tdim, 1> dni;
-      //! loop to iterate over dimensions
-      for (unsigned i = 0; i < Tdim; ++i) {
-        double lp = particle_size(i) * 0.5;
-        double ni = local_nodes(n, i);
-        double npni = xi(i) - ni;  // local particle  - local node
-        //! Conditional shape function statement
-        // see: Pruijn, N.S., 2016. Eq(4.30)
-        if (npni <= (-element_length - lp)) {
-          sni(i) = 0.;
-          dni(i) = 0.;
-        } else if ((-element_length - lp) < npni &&
-                   npni <= (-element_length + lp)) {
-
-          sni(i) = std::pow(element_length + lp + npni, 2.) /
-                   (4. * (element_length * lp));
-          dni(i) = (element_length + lp + npni) / (2. * element_length * lp);
-        } else if ((-element_length + lp) < npni && npni <= -lp) {
-          sni(i) = 1. + (npni / element_length);
-          dni(i) = 1. / element_length;
-        } else if (-lp < npni && npni <= lp) {
-          sni(i) =
-              1. - (((npni * npni) + (lp * lp)) / (2. * element_length * lp));
-          dni(i) = -(npni / (element_length * lp));
-        } else if (lp < npni && npni <= (element_length - lp)) {
-          sni(i) = 1. - (npni / element_length);
-          dni(i) = -(1. / element_length);
-        } else if ((element_length - lp) < npni &&
-                   npni <= (element_length + lp)) {
-          sni(i) = std::pow(element_length + lp - npni, 2.) /
-                   (4. * element_length * lp);
-          dni(i) = -((element_length + lp - npni) / (2. * element_length * lp));
-        } else if ((element_length + lp) < npni) {
-          sni(i) = 0.;
-          dni(i) = 0.;
-        } else {
-          throw std::runtime_error(
-              "GIMP grad shapefn: Point location outside area of influence");
-        }
-      }
+      const auto& k = index[n];
       // see: Pruijn, N.S., 2016. Eq(4.32)
-      grad_shapefn(n, 0) = dni(0) * sni(1) * sni(2);
-      grad_shapefn(n, 1) = sni(0) * dni(1) * sni(2);
-      grad_shapefn(n, 2) = sni(0) * sni(1) * dni(2);
+      grad_shapefn(n, 0) = dni(k[0], 0) * sni(k[1], 1) * sni(k[2], 2);
+      grad_shapefn(n, 1) = sni(k[0], 0) * dni(k[1], 1) * sni(k[2], 2);
+      grad_shapefn(n, 2) = sni(k[0], 0) * sni(k[1], 1) * dni(k[2], 2);
     }
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
@@ -155,6 +83,45 @@ inline Eigen::MatrixXd
   return grad_shapefn;
 }
 
+//! Evaluate the GIMP basis functions and gradients in each direction at the
+//! natural nodal positions -3, -1, 1 and 3
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::axis_basis(
+    const Eigen::Matrix<double, Tdim, 1>& xi,
+    const Eigen::Matrix<double, Tdim, 1>& particle_size,
+    Eigen::Matrix<double, 4, Tdim>& basis,
+    Eigen::Matrix<double, 4, Tdim>& gradient) const {
+  //! length of element in local coordinate
+  const double element_length = 2.;
+  for (unsigned i = 0; i < Tdim; ++i) {
+    const double lp = particle_size(i) * 0.5;
+    for (unsigned k = 0; k < 4; ++k) {
+      const double ni = 2. * k - 3.;
+      // local particle - local node
+      mpm::kernels::gimp(xi(i) - ni, lp, element_length, &basis(k, i),
+                         &gradient(k, i));
+    }
+  }
+}
+
+//! Return the index of the nodal position of each node in each direction
+template <unsigned Tdim, unsigned Tnfunctions>
+inline const std::array<std::array<unsigned, Tdim>, Tnfunctions>&
+    mpm::HexahedronGIMPElement<Tdim, Tnfunctions>::axis_index() const {
+  static const std::array<std::array<unsigned, Tdim>, Tnfunctions> index =
+      [this]() {
+        const Eigen::Matrix<double, Tnfunctions, Tdim> local_nodes =
+            this->natural_nodal_coordinates();
+        std::array<std::array<unsigned, Tdim>, Tnfunctions> index;
+        for (unsigned n = 0; n < Tnfunctions; ++n)
+          for (unsigned i = 0; i < Tdim; ++i)
+            index[n][i] = static_cast<unsigned>(
+                std::lround((local_nodes(n, i) + 3.) / 2.));
+        return index;
+      }();
+  return index;
+}
+
 //! Return local shape functions of a GIMP Hexahedron Element at a given
 //! Return local shape functions of a Hexahedron Element at a given local
 //! coordinate, with particle size and deformation gradient
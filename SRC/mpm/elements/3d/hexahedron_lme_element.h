@@ -2,6 +2,7 @@
 #define MPM_LME_HEX_ELEMENT_H_
 
 #include "hexahedron_element.h"
+#include "math_utility.h"
 
 namespace mpm {
 
@@ -123,11 +124,20 @@ class HexahedronLMEElement : public HexahedronElement<3, 8> {
   //! \param[in] beta Coldness function of the system in the range of [0,inf)
   //! \param[in] radius Support radius of the kernel
   //! \param[in] anisotropy Shape function anisotropy (F^{-T}F^{-1})
+  //! \param[in] skip_tolerance Particle displacement below which shape
+  //! functions are not recomputed
   //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
   void initialise_lme_connectivity_properties(
-      double beta, double radius, bool anisotropy,
+      double beta, double radius, bool anisotropy, double skip_tolerance,
       const Eigen::MatrixXd& nodal_coordinates) override;
 
+  //! Return the particle displacement below which shape functions are reused
+  //! \details Anisotropic shape functions depend on the deformation gradient
+  //! and are always recomputed
+  double shapefn_skip_tolerance() const override {
+    return (anisotropy_) ? 0. : skip_tolerance_;
+  }
+
   //! Return the degree of shape function
   mpm::ElementDegree degree() const override {
     return mpm::ElementDegree::Infinity;
@@ -143,6 +153,8 @@ class HexahedronLMEElement : public HexahedronElement<3, 8> {
   double support_radius_;
   //! Anisotropy parameter
   bool anisotropy_{false};
+  //! Particle displacement below which shape functions are reused
+  double skip_tolerance_{0.};
   //! Apply preconditioner
   bool preconditioner_{false};
   //! Nodal coordinates vector (n_connectivity_ x Tdim)
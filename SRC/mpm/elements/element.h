@@ -134,6 +134,10 @@ class Element {
   //! Return the shapefn type of element
   virtual mpm::ShapefnType shapefn_type() const = 0;
 
+  //! Return the particle displacement below which shape functions of a
+  //! particle staying in the same cell are reused, zero to always recompute
+  virtual double shapefn_skip_tolerance() const { return 0.; }
+
   //! Return nodal coordinates of a unit cell
   virtual Eigen::MatrixXd unit_cell_coordinates() const = 0;
 
@@ -190,9 +194,11 @@ class Element {
   //! \param[in] beta Coldness function of the system in the range of [0,inf)
   //! \param[in] radius Support radius of the kernel
   //! \param[in] anisotropy Shape function anisotropy (F^{-T}F^{-1})
+  //! \param[in] skip_tolerance Particle displacement below which shape
+  //! functions are not recomputed
   //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
   virtual void initialise_lme_connectivity_properties(
-      double beta, double radius, bool anisotropy,
+      double beta, double radius, bool anisotropy, double skip_tolerance,
       const Eigen::MatrixXd& nodal_coordinates) = 0;
 };
 
@@ -0,0 +1,35 @@
+#ifndef MPM_SHAPEFN_KERNELS_H_
+#define MPM_SHAPEFN_KERNELS_H_
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace mpm {
+namespace kernels {
+//! Evaluate a B-Spline basis function and its gradient in one direction,
+//! with the Cox-de Boor recursion unrolled over a fixed-size table
+//! \tparam Tpolynomial Degree of BSpline Polynomial
+//! \param[in] point_coord Point coordinate in one direction
+//! \param[in] knot_coord Tpolynomial + 2 knot coordinates of the basis
+//! \param[out] basis Value of the basis function
+//! \param[out] gradient Gradient of the basis function
+template <unsigned Tpolynomial>
+inline void bspline(double point_coord, const double* knot_coord,
+                    double* basis, double* gradient);
+
+//! Evaluate a GIMP basis function and its gradient in one direction
+//! See: Bardenhagen 2004 and Pruijn, N.S., 2016. Eq(4.30)
+//! \param[in] npni Local particle coordinate relative to the node
+//! \param[in] lp Half of the particle size in local coordinates
+//! \param[in] element_length Length of element in local coordinates
+//! \param[out] basis Value of the basis function
+//! \param[out] gradient Gradient of the basis function
+inline void gimp(double npni, double lp, double element_length, double* basis,
+                 double* gradient);
+}  // namespace kernels
+}  // namespace mpm
+
+#include "shapefn_kernels.tcc"
+
+#endif  // MPM_SHAPEFN_KERNELS_H_
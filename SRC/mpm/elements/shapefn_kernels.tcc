@@ -0,0 +1,75 @@
+//! Evaluate a B-Spline basis function and its gradient in one direction
+template <unsigned Tpolynomial>
+inline void mpm::kernels::bspline(double point_coord, const double* knot_coord,
+                                  double* basis, double* gradient) {
+  static_assert(Tpolynomial > 0, "BSpline polynomial degree is zero");
+  const double epsilon = std::numeric_limits<double>::epsilon();
+
+  // Basis functions of degree zero over each knot span
+  double values[Tpolynomial + 1];
+  for (unsigned j = 0; j <= Tpolynomial; ++j)
+    values[j] =
+        (point_coord >= knot_coord[j] && point_coord < knot_coord[j + 1]) ? 1.0
+                                                                          : 0.0;
+
+  // Raise the degree up to Tpolynomial - 1, and keep these values for the
+  // gradient
+  for (unsigned degree = 1; degree < Tpolynomial; ++degree) {
+    for (unsigned j = 0; j <= Tpolynomial - degree; ++j) {
+      const double den_a = knot_coord[j + degree] - knot_coord[j];
+      const double a =
+          (den_a < epsilon) ? 0. : (point_coord - knot_coord[j]) / den_a;
+      const double den_b = knot_coord[j + degree + 1] - knot_coord[j + 1];
+      const double b = (den_b < epsilon)
+                           ? 0.
+                           : (knot_coord[j + degree + 1] - point_coord) / den_b;
+      values[j] = a * values[j] + b * values[j + 1];
+    }
+  }
+
+  // Basis of degree Tpolynomial and its gradient
+  const double den_a = knot_coord[Tpolynomial] - knot_coord[0];
+  const double den_b = knot_coord[Tpolynomial + 1] - knot_coord[1];
+  const double a =
+      (den_a < epsilon) ? 0. : (point_coord - knot_coord[0]) / den_a;
+  const double b = (den_b < epsilon)
+                       ? 0.
+                       : (knot_coord[Tpolynomial + 1] - point_coord) / den_b;
+  const double da = (den_a < epsilon) ? 0. : Tpolynomial / den_a;
+  const double db = (den_b < epsilon) ? 0. : Tpolynomial / den_b;
+  *basis = a * values[0] + b * values[1];
+  *gradient = da * values[0] - db * values[1];
+}
+
+//! Evaluate a GIMP basis function and its gradient in one direction
+inline void mpm::kernels::gimp(double npni, double lp, double element_length,
+                               double* basis, double* gradient) {
+  //! Conditional shape function statement see: Bardenhagen 2004
+  if (npni <= (-element_length - lp)) {
+    *basis = 0.;
+    *gradient = 0.;
+  } else if ((-element_length - lp) < npni && npni <= (-element_length + lp)) {
+    *basis = (element_length + lp + npni) * (element_length + lp + npni) /
+             (4. * (element_length * lp));
+    *gradient = (element_length + lp + npni) / (2. * element_length * lp);
+  } else if ((-element_length + lp) < npni && npni <= -lp) {
+    *basis = 1. + (npni / element_length);
+    *gradient = 1. / element_length;
+  } else if (-lp < npni && npni <= lp) {
+    *basis = 1. - (((npni * npni) + (lp * lp)) / (2. * element_length * lp));
+    *gradient = -(npni / (element_length * lp));
+  } else if (lp < npni && npni <= (element_length - lp)) {
+    *basis = 1. - (npni / element_length);
+    *gradient = -(1. / element_length);
+  } else if ((element_length - lp) < npni && npni <= (element_length + lp)) {
+    *basis = (element_length + lp - npni) * (element_length + lp - npni) /
+             (4. * element_length * lp);
+    *gradient = -((element_length + lp - npni) / (2. * element_length * lp));
+  } else if ((element_length + lp) < npni) {
+    *basis = 0.;
+    *gradient = 0.;
+  } else {
+    throw std::runtime_error(
+        "GIMP shapefn: Point location outside area of influence");
+  }
+}
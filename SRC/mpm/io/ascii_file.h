@@ -0,0 +1,92 @@
+#ifndef MPM_ASCII_FILE_H_
+#define MPM_ASCII_FILE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <omp.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "data_types.h"
+
+namespace mpm {
+
+//! AsciiFile class
+//! \brief Memory mapped ASCII input file with a fast number scanner
+//! \details The file is mapped into memory and its data lines are indexed in
+//! chunks by all threads. Comment lines (containing # or !) and blank lines
+//! are skipped. Data lines are independent, so they can be parsed in
+//! parallel with the scanners that read numbers in place.
+class AsciiFile {
+ public:
+  //! Constructor maps the file and indexes its data lines
+  //! \param[in] filename Input file
+  explicit AsciiFile(const std::string& filename);
+
+  //! Destructor unmaps the file
+  ~AsciiFile();
+
+  //! Delete copy constructor
+  AsciiFile(const AsciiFile&) = delete;
+
+  //! Delete assignement operator
+  AsciiFile& operator=(const AsciiFile&) = delete;
+
+  //! Number of data lines
+  std::size_t nlines() const { return begin_.size(); }
+
+  //! Return the first character of a data line
+  //! \param[in] line Index of the data line
+  const char* begin(std::size_t line) const { return data_ + begin_[line]; }
+
+  //! Return the end of a data line
+  //! \param[in] line Index of the data line
+  const char* end(std::size_t line) const { return data_ + end_[line]; }
+
+  //! Scan a floating point number and advance past it
+  //! \param[in,out] ptr Current position
+  //! \param[in] end End of the line
+  //! \param[out] value Value read
+  //! \retval status Return false if there is no number
+  static bool scan(const char*& ptr, const char* end, double* value);
+
+  //! Scan an unsigned integer and advance past it
+  //! \param[in,out] ptr Current position
+  //! \param[in] end End of the line
+  //! \param[out] value Value read
+  //! \retval status Return false if there is no integer
+  static bool scan(const char*& ptr, const char* end, mpm::Index* value);
+
+ private:
+  //! Index data lines of the file in parallel chunks
+  void index_lines();
+
+  //! Return true for blank characters separating numbers
+  static bool blank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+  }
+
+  //! File contents
+  const char* data_{nullptr};
+  //! File size
+  std::size_t size_{0};
+  //! Mapped memory, nullptr if the file was empty
+  void* map_{nullptr};
+  //! Offsets of the first character of data lines
+  std::vector<std::size_t> begin_;
+  //! Offsets of the end of data lines
+  std::vector<std::size_t> end_;
+};
+}  // namespace mpm
+
+#include "ascii_file.tcc"
+
+#endif  // MPM_ASCII_FILE_H_
@@ -0,0 +1,181 @@
+//! Map the file and index its data lines
+inline mpm::AsciiFile::AsciiFile(const std::string& filename) {
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("File not open or not good!");
+
+  struct stat status;
+  if (::fstat(fd, &status) != 0) {
+    ::close(fd);
+    throw std::runtime_error("File not open or not good!");
+  }
+  size_ = status.st_size;
+
+  if (size_ > 0) {
+    map_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map_ == MAP_FAILED) {
+      map_ = nullptr;
+      ::close(fd);
+      throw std::runtime_error("Unable to map file: " + filename);
+    }
+    ::madvise(map_, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(map_);
+  }
+  // Mapping is kept after the file is closed
+  ::close(fd);
+
+  this->index_lines();
+}
+
+//! Unmap the file
+inline mpm::AsciiFile::~AsciiFile() {
+  if (map_ != nullptr) ::munmap(map_, size_);
+}
+
+//! Index data lines in parallel chunks
+inline void mpm::AsciiFile::index_lines() {
+  begin_.clear();
+  end_.clear();
+  if (size_ == 0) return;
+
+  // Chunks start after a line break, so that no line is split
+  const unsigned nchunks = std::max(1, omp_get_max_threads());
+  std::vector<std::size_t> chunks(nchunks + 1, size_);
+  chunks[0] = 0;
+  for (unsigned i = 1; i < nchunks; ++i) {
+    std::size_t offset = std::max(chunks[i - 1], size_ / nchunks * i);
+    const void* newline =
+        (offset < size_) ? std::memchr(data_ + offset, '\n', size_ - offset)
+                         : nullptr;
+    chunks[i] = (newline != nullptr)
+                    ? static_cast<const char*>(newline) - data_ + 1
+                    : size_;
+  }
+
+  // Data lines of each chunk
+  std::vector<std::vector<std::size_t>> chunk_begin(nchunks);
+  std::vector<std::vector<std::size_t>> chunk_end(nchunks);
+#pragma omp parallel for schedule(static)
+  for (unsigned i = 0; i < nchunks; ++i) {
+    std::size_t line = chunks[i];
+    while (line < chunks[i + 1]) {
+      const void* newline =
+          std::memchr(data_ + line, '\n', chunks[i + 1] - line);
+      const std::size_t line_end =
+          (newline != nullptr) ? static_cast<const char*>(newline) - data_
+                               : chunks[i + 1];
+      // Ignore comment lines (# or !) or blank lines
+      bool data = false, comment = false;
+      for (std::size_t c = line; c < line_end && !comment; ++c) {
+        comment = (data_[c] == '#' || data_[c] == '!');
+        data = data || !blank(data_[c]);
+      }
+      if (data && !comment) {
+        chunk_begin[i].emplace_back(line);
+        chunk_end[i].emplace_back(line_end);
+      }
+      line = line_end + 1;
+    }
+  }
+
+  // Concatenate chunks in order
+  std::size_t nlines = 0;
+  for (const auto& chunk : chunk_begin) nlines += chunk.size();
+  begin_.reserve(nlines);
+  end_.reserve(nlines);
+  for (unsigned i = 0; i < nchunks; ++i) {
+    begin_.insert(begin_.end(), chunk_begin[i].begin(), chunk_begin[i].end());
+    end_.insert(end_.end(), chunk_end[i].begin(), chunk_end[i].end());
+  }
+}
+
+//! Scan a floating point number
+inline bool mpm::AsciiFile::scan(const char*& ptr, const char* end,
+                                 double* value) {
+  // Powers of ten exactly representable as double
+  static constexpr double powers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                      1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                      1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                      1e18, 1e19, 1e20, 1e21, 1e22};
+  while (ptr != end && blank(*ptr)) ++ptr;
+  if (ptr == end) return false;
+
+  const char* start = ptr;
+  const char* p = ptr;
+  const bool negative = (*p == '-');
+  if (*p == '-' || *p == '+') ++p;
+
+  // Significant digits in an integer mantissa
+  std::uint64_t mantissa = 0;
+  int ndigits = 0, exponent = 0;
+  bool digits = false, exact = true;
+  auto digit = [&](char c, bool fraction) {
+    digits = true;
+    if (mantissa == 0 && c == '0') {
+      if (fraction) --exponent;
+      return;
+    }
+    if (ndigits < 19) {
+      mantissa = mantissa * 10 + (c - '0');
+      ++ndigits;
+      if (fraction) --exponent;
+    } else {
+      exact = false;
+      if (!fraction) ++exponent;
+    }
+  };
+  while (p != end && *p >= '0' && *p <= '9') digit(*p++, false);
+  if (p != end && *p == '.') {
+    ++p;
+    while (p != end && *p >= '0' && *p <= '9') digit(*p++, true);
+  }
+  if (digits && p != end && (*p == 'e' || *p == 'E')) {
+    const char* e = p + 1;
+    const bool negative_exponent = (e != end && *e == '-');
+    if (e != end && (*e == '-' || *e == '+')) ++e;
+    if (e != end && *e >= '0' && *e <= '9') {
+      int exp10 = 0;
+      while (e != end && *e >= '0' && *e <= '9') {
+        if (exp10 < 100000) exp10 = exp10 * 10 + (*e - '0');
+        ++e;
+      }
+      exponent += negative_exponent ? -exp10 : exp10;
+      p = e;
+    }
+  }
+
+  // Exact conversion when mantissa and power of ten are exact doubles
+  if (digits && exact && (p == end || blank(*p)) &&
+      mantissa <= (std::uint64_t(1) << 53) && exponent >= -22 &&
+      exponent <= 22) {
+    double result = static_cast<double>(mantissa);
+    result = (exponent < 0) ? result / powers[-exponent]
+                            : result * powers[exponent];
+    *value = negative ? -result : result;
+    ptr = p;
+    return true;
+  }
+
+  // Other numbers (long mantissas, large exponents, nan, inf) by strtod
+  const char* token_end = start;
+  while (token_end != end && !blank(*token_end)) ++token_end;
+  const std::string token(start, token_end);
+  char* parsed = nullptr;
+  const double result = std::strtod(token.c_str(), &parsed);
+  if (parsed == token.c_str()) return false;
+  *value = result;
+  ptr = start + (parsed - token.c_str());
+  return true;
+}
+
+//! Scan an unsigned integer
+inline bool mpm::AsciiFile::scan(const char*& ptr, const char* end,
+                                 mpm::Index* value) {
+  while (ptr != end && blank(*ptr)) ++ptr;
+  if (ptr != end && *ptr == '+') ++ptr;
+  if (ptr == end || *ptr < '0' || *ptr > '9') return false;
+  mpm::Index result = 0;
+  while (ptr != end && *ptr >= '0' && *ptr <= '9')
+    result = result * 10 + (*ptr++ - '0');
+  *value = result;
+  return true;
+}
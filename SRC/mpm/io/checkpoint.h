@@ -0,0 +1,210 @@
+#ifndef MPM_CHECKPOINT_H_
+#define MPM_CHECKPOINT_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "data_types.h"
+#include "logger.h"
+
+namespace mpm {
+
+//! Checkpoint class
+//! \brief Writes and reads compact binary restart snapshots of a rank
+//! \details Particles are stored as packed records of the fields of their POD
+//! structure. A delta checkpoint only stores the fields that differ from the
+//! last full checkpoint, so fields which change slowly (material ids,
+//! volumes, sizes, state variables) cost one bit per field. Files are written
+//! by a background thread, and only the last checkpoints and the full
+//! checkpoints they depend on are kept.
+class Checkpoint {
+ public:
+  //! Nodal velocity constraint (node id, direction, velocity)
+  using NodalConstraint = std::tuple<mpm::Index, unsigned, double>;
+
+  //! Field layout of a POD particle structure
+  struct Layout {
+    //! Number of fields, the first field is the particle id
+    unsigned nfields{0};
+    //! Offsets of the fields in the POD structure
+    const std::size_t* offsets{nullptr};
+    //! Sizes of the fields
+    const std::size_t* sizes{nullptr};
+  };
+
+  //! Checkpoint data of a rank
+  struct Snapshot {
+    //! Step
+    mpm::Index step{0};
+    //! Time
+    double time{0.};
+    //! Time step
+    double dt{0.};
+    //! Packed particle records of each POD type
+    std::map<std::string, std::vector<uint8_t>> particles;
+    //! Nodal velocity constraints
+    std::vector<NodalConstraint> constraints;
+  };
+
+  //! Constructor
+  //! \param[in] filename Returns the checkpoint file name of a step
+  //! \param[in] nretain Number of checkpoints to keep
+  //! \param[in] full_interval Number of checkpoints between full checkpoints,
+  //! 1 writes only full checkpoints
+  Checkpoint(const std::function<std::string(mpm::Index)>& filename,
+             unsigned nretain, unsigned full_interval)
+      : filename_{filename},
+        nretain_{std::max(nretain, 1u)},
+        full_interval_{std::max(full_interval, 1u)} {
+    //! Logger
+    console_ =
+        std::make_unique<spdlog::logger>("Checkpoint", mpm::stdout_sink);
+  }
+
+  //! Destructor waits for the pending write, its failure is only logged
+  ~Checkpoint() {
+    try {
+      this->wait();
+    } catch (std::exception& exception) {
+      console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    }
+  }
+
+  //! Delete copy constructor
+  Checkpoint(const Checkpoint&) = delete;
+
+  //! Delete assignement operator
+  Checkpoint& operator=(const Checkpoint&) = delete;
+
+  //! Start a new checkpoint, waits for the pending write to finish and
+  //! rethrows its failure
+  //! \param[in] step Step
+  //! \param[in] time Time
+  //! \param[in] dt Time step
+  //! \retval snapshot Snapshot to be filled
+  Snapshot& initialise(mpm::Index step, double time, double dt);
+
+  //! Pack POD particles into the current checkpoint
+  //! \param[in] name Name of the POD type
+  //! \param[in] layout Field layout of the POD type
+  //! \param[in] pods Array of POD particles
+  //! \param[in] npods Number of POD particles
+  //! \param[in] stride Size of a POD particle in bytes
+  void add_particles(const std::string& name, const Layout& layout,
+                     const void* pods, std::size_t npods, std::size_t stride);
+
+  //! Write the current checkpoint in a background thread, rethrows the
+  //! failure of the pending write
+  void write();
+
+  //! Wait for the pending write to finish
+  //! \details A failed write leaves no checkpoint file, its exception is
+  //! rethrown
+  void wait();
+
+  //! Register the checkpoints written before a restart, so that they are
+  //! removed once they are no longer retained
+  //! \details Checkpoint files in the directory of the checkpoint of the
+  //! restart step are identified by their header, later steps belong to the
+  //! abandoned run and are overwritten
+  //! \param[in] step Restart step
+  void resume(mpm::Index step);
+
+  //! Read a checkpoint, and the full checkpoint it depends on
+  //! \param[in] step Step of the checkpoint
+  //! \param[in] layouts Field layouts of the POD types
+  //! \retval snapshot Checkpoint data
+  Snapshot read(mpm::Index step,
+                const std::map<std::string, Layout>& layouts) const;
+
+  //! Unpack particle records into POD particles
+  //! \param[in] records Packed particle records
+  //! \param[in] layout Field layout of the POD type
+  //! \param[in,out] pods Array of default constructed POD particles
+  //! \param[in] stride Size of a POD particle in bytes
+  static void unpack(const std::vector<uint8_t>& records, const Layout& layout,
+                     void* pods, std::size_t stride);
+
+  //! Size of a packed particle record
+  //! \param[in] layout Field layout of the POD type
+  static std::size_t record_size(const Layout& layout);
+
+ private:
+  //! Header of a checkpoint file
+  struct Header {
+    //! Step
+    mpm::Index step{0};
+    //! Time
+    double time{0.};
+    //! Time step
+    double dt{0.};
+    //! Step of the full checkpoint of a delta checkpoint
+    mpm::Index base_step{0};
+    //! Delta checkpoint
+    bool delta{false};
+  };
+
+  //! Write the current checkpoint and remove old files, runs on the
+  //! background thread
+  //! \param[in] delta Write a delta checkpoint
+  void write_file(bool delta);
+
+  //! Encode the current checkpoint into a file
+  //! \param[in] file Checkpoint file
+  //! \param[in] delta Write a delta checkpoint
+  //! \param[in] base_step Step of the full checkpoint
+  void write_snapshot(std::ofstream& file, bool delta,
+                      mpm::Index base_step) const;
+
+  //! Remove checkpoints which are no longer retained
+  void remove_old_checkpoints();
+
+  //! Read the header of a checkpoint file
+  //! \param[in] file Checkpoint file
+  //! \param[in] filename Name of the checkpoint file
+  static Header read_header(std::ifstream& file, const std::string& filename);
+
+  //! Checkpoint file name of a step
+  std::function<std::string(mpm::Index)> filename_;
+  //! Number of checkpoints to keep
+  unsigned nretain_{2};
+  //! Number of checkpoints between full checkpoints
+  unsigned full_interval_{1};
+  //! Number of checkpoints since the last full checkpoint
+  unsigned ndeltas_{0};
+  //! Current checkpoint
+  Snapshot current_;
+  //! Field layouts of the POD types
+  std::map<std::string, Layout> layouts_;
+  //! Last full checkpoint, reference of the delta checkpoints
+  std::unique_ptr<Snapshot> base_{nullptr};
+  //! Index of the records of the full checkpoint by particle id
+  std::map<std::string, std::unordered_map<mpm::Index, std::size_t>>
+      base_index_;
+  //! Written checkpoints (step, step of the full checkpoint), oldest first
+  std::deque<std::pair<mpm::Index, mpm::Index>> written_;
+  //! Pending write
+  std::future<void> pending_;
+  //! Logger
+  std::unique_ptr<spdlog::logger> console_;
+};
+}  // namespace mpm
+
+#include "checkpoint.tcc"
+
+#endif  // MPM_CHECKPOINT_H_
@@ -0,0 +1,457 @@
+//! Start a new checkpoint
+inline mpm::Checkpoint::Snapshot& mpm::Checkpoint::initialise(mpm::Index step,
+                                                              double time,
+                                                              double dt) {
+  // The current checkpoint is used by the pending write
+  this->wait();
+  current_ = Snapshot();
+  current_.step = step;
+  current_.time = time;
+  current_.dt = dt;
+  return current_;
+}
+
+//! Size of a packed particle record
+inline std::size_t mpm::Checkpoint::record_size(const Layout& layout) {
+  std::size_t size = 0;
+  for (unsigned i = 0; i < layout.nfields; ++i) size += layout.sizes[i];
+  return size;
+}
+
+//! Pack POD particles into the current checkpoint
+inline void mpm::Checkpoint::add_particles(const std::string& name,
+                                           const Layout& layout,
+                                           const void* pods, std::size_t npods,
+                                           std::size_t stride) {
+  if (layout.nfields == 0 || layout.sizes[0] != sizeof(mpm::Index))
+    throw std::runtime_error("The first POD field is not a particle id");
+  layouts_[name] = layout;
+
+  const std::size_t size = record_size(layout);
+  auto& records = current_.particles[name];
+  records.resize(npods * size);
+
+  const uint8_t* src = static_cast<const uint8_t*>(pods);
+#pragma omp parallel for schedule(runtime)
+  for (std::size_t i = 0; i < npods; ++i) {
+    uint8_t* record = records.data() + i * size;
+    for (unsigned j = 0; j < layout.nfields; ++j) {
+      std::memcpy(record, src + i * stride + layout.offsets[j],
+                  layout.sizes[j]);
+      record += layout.sizes[j];
+    }
+  }
+}
+
+//! Unpack particle records into POD particles
+inline void mpm::Checkpoint::unpack(const std::vector<uint8_t>& records,
+                                    const Layout& layout, void* pods,
+                                    std::size_t stride) {
+  const std::size_t size = record_size(layout);
+  const std::size_t nrecords = (size > 0) ? records.size() / size : 0;
+
+  uint8_t* dst = static_cast<uint8_t*>(pods);
+#pragma omp parallel for schedule(runtime)
+  for (std::size_t i = 0; i < nrecords; ++i) {
+    const uint8_t* record = records.data() + i * size;
+    for (unsigned j = 0; j < layout.nfields; ++j) {
+      std::memcpy(dst + i * stride + layout.offsets[j], record,
+                  layout.sizes[j]);
+      record += layout.sizes[j];
+    }
+  }
+}
+
+//! Write the current checkpoint in a background thread
+inline void mpm::Checkpoint::write() {
+  this->wait();
+  // Full checkpoints are written periodically to bound the delta chain
+  const bool delta = (base_ != nullptr && ndeltas_ + 1 < full_interval_);
+  ndeltas_ = delta ? ndeltas_ + 1 : 0;
+  pending_ = std::async(std::launch::async,
+                        [this, delta]() { this->write_file(delta); });
+}
+
+//! Wait for the pending write, rethrows its failure
+inline void mpm::Checkpoint::wait() {
+  if (pending_.valid()) pending_.get();
+}
+
+//! Register the checkpoints written before a restart
+inline void mpm::Checkpoint::resume(mpm::Index step) {
+  this->wait();
+  written_.clear();
+
+  const boost::filesystem::path restart_file(filename_(step));
+  boost::system::error_code error;
+  boost::filesystem::directory_iterator itr(restart_file.parent_path(), error);
+  if (error) return;
+
+  std::vector<std::pair<mpm::Index, mpm::Index>> found;
+  for (; itr != boost::filesystem::directory_iterator(); itr.increment(error)) {
+    if (error) break;
+    const boost::filesystem::path& path = itr->path();
+    if (!boost::filesystem::is_regular_file(path, error)) continue;
+    if (path.extension() != restart_file.extension()) continue;
+
+    std::ifstream file(path.string(), std::ios::in | std::ios::binary);
+    Header header;
+    try {
+      header = read_header(file, path.string());
+    } catch (std::exception&) {
+      continue;
+    }
+    // Only files named after the step in their header are checkpoints of
+    // this analysis
+    if (header.step > step ||
+        !boost::filesystem::equivalent(path, filename_(header.step), error))
+      continue;
+    found.emplace_back(header.step, header.base_step);
+  }
+
+  std::sort(found.begin(), found.end());
+  written_.assign(found.begin(), found.end());
+}
+
+//! Write the current checkpoint and remove old files
+inline void mpm::Checkpoint::write_file(bool delta) {
+  const std::string filename = filename_(current_.step);
+  const mpm::Index base_step = delta ? base_->step : current_.step;
+  {
+    std::ofstream file(filename, std::ios::out | std::ios::binary);
+    if (!file.is_open())
+      throw std::runtime_error("Unable to open checkpoint file: " + filename);
+
+    // A partial file would be read as a truncated checkpoint on resume
+    try {
+      this->write_snapshot(file, delta, base_step);
+      file.close();
+      if (!file.good())
+        throw std::runtime_error("Failed writing checkpoint file: " +
+                                 filename);
+    } catch (...) {
+      file.close();
+      std::remove(filename.c_str());
+      throw;
+    }
+  }
+
+  written_.emplace_back(current_.step, base_step);
+
+  // A full checkpoint becomes the reference of the next delta checkpoints
+  if (!delta) {
+    base_ = std::make_unique<Snapshot>(std::move(current_));
+    base_index_.clear();
+    for (const auto& particles : base_->particles) {
+      const std::size_t size = record_size(layouts_.at(particles.first));
+      const std::size_t nrecords = particles.second.size() / size;
+      auto& index = base_index_[particles.first];
+      index.reserve(nrecords);
+      for (std::size_t i = 0; i < nrecords; ++i) {
+        mpm::Index id;
+        std::memcpy(&id, particles.second.data() + i * size, sizeof(id));
+        index.emplace(id, i);
+      }
+    }
+  }
+
+  this->remove_old_checkpoints();
+}
+
+//! Encode the current checkpoint into a file
+inline void mpm::Checkpoint::write_snapshot(std::ofstream& file, bool delta,
+                                            mpm::Index base_step) const {
+  auto put = [&file](const void* data, std::size_t nbytes) {
+    file.write(reinterpret_cast<const char*>(data), nbytes);
+  };
+
+  // Header
+  const uint8_t delta_flag = delta;
+  file.write("MPMCKPT1", 8);
+  put(&current_.step, sizeof(current_.step));
+  put(&current_.time, sizeof(current_.time));
+  put(&current_.dt, sizeof(current_.dt));
+  put(&base_step, sizeof(base_step));
+  put(&delta_flag, sizeof(delta_flag));
+
+  // Particle records of each POD type
+  const uint32_t ntypes = current_.particles.size();
+  put(&ntypes, sizeof(ntypes));
+  std::vector<uint8_t> encoded;
+  for (const auto& particles : current_.particles) {
+    const std::string& name = particles.first;
+    const std::vector<uint8_t>& records = particles.second;
+    const Layout& layout = layouts_.at(name);
+    const std::size_t size = record_size(layout);
+    const uint64_t nrecords = records.size() / size;
+
+    const uint32_t name_size = name.size();
+    put(&name_size, sizeof(name_size));
+    put(name.data(), name_size);
+    const uint32_t nfields = layout.nfields;
+    put(&nfields, sizeof(nfields));
+    for (unsigned i = 0; i < nfields; ++i) {
+      const uint64_t field_size = layout.sizes[i];
+      put(&field_size, sizeof(field_size));
+    }
+    put(&nrecords, sizeof(nrecords));
+
+    if (!delta) {
+      const uint64_t nbytes = records.size();
+      put(&nbytes, sizeof(nbytes));
+      put(records.data(), nbytes);
+      continue;
+    }
+
+    // Delta records: a bit mask of the fields which differ from the record
+    // of the same particle in the full checkpoint, followed by these fields.
+    // The particle id is always stored.
+    const auto base_records = base_->particles.find(name);
+    const auto base_index = base_index_.find(name);
+    const bool has_base = (base_records != base_->particles.end() &&
+                           base_index != base_index_.end());
+    const std::size_t nmask = (nfields + 7) / 8;
+    std::vector<uint8_t> mask(nmask);
+    encoded.clear();
+    encoded.reserve(records.size() / 4);
+    for (uint64_t i = 0; i < nrecords; ++i) {
+      const uint8_t* record = records.data() + i * size;
+      mpm::Index id;
+      std::memcpy(&id, record, sizeof(id));
+
+      const uint8_t* reference = nullptr;
+      if (has_base) {
+        const auto itr = base_index->second.find(id);
+        if (itr != base_index->second.end())
+          reference = base_records->second.data() + itr->second * size;
+      }
+
+      std::fill(mask.begin(), mask.end(), 0);
+      std::size_t position = 0;
+      for (unsigned j = 0; j < nfields; ++j) {
+        if (j == 0 || reference == nullptr ||
+            std::memcmp(record + position, reference + position,
+                        layout.sizes[j]) != 0)
+          mask[j / 8] |= static_cast<uint8_t>(1u << (j % 8));
+        position += layout.sizes[j];
+      }
+
+      encoded.insert(encoded.end(), mask.begin(), mask.end());
+      position = 0;
+      for (unsigned j = 0; j < nfields; ++j) {
+        if (mask[j / 8] & (1u << (j % 8)))
+          encoded.insert(encoded.end(), record + position,
+                         record + position + layout.sizes[j]);
+        position += layout.sizes[j];
+      }
+    }
+    const uint64_t nbytes = encoded.size();
+    put(&nbytes, sizeof(nbytes));
+    put(encoded.data(), nbytes);
+  }
+
+  // Nodal velocity constraints, only stored by a delta checkpoint when they
+  // differ from the full checkpoint
+  const uint8_t has_constraints =
+      (!delta || current_.constraints != base_->constraints);
+  put(&has_constraints, sizeof(has_constraints));
+  if (has_constraints) {
+    const uint64_t nconstraints = current_.constraints.size();
+    put(&nconstraints, sizeof(nconstraints));
+    for (const auto& constraint : current_.constraints) {
+      const mpm::Index node = std::get<0>(constraint);
+      const uint32_t dir = std::get<1>(constraint);
+      const double velocity = std::get<2>(constraint);
+      put(&node, sizeof(node));
+      put(&dir, sizeof(dir));
+      put(&velocity, sizeof(velocity));
+    }
+  }
+}
+
+//! Remove checkpoints which are no longer retained
+inline void mpm::Checkpoint::remove_old_checkpoints() {
+  // Last checkpoints and the full checkpoints they depend on
+  std::set<mpm::Index> retained;
+  const std::size_t nwritten = written_.size();
+  const std::size_t first = (nwritten > nretain_) ? nwritten - nretain_ : 0;
+  for (std::size_t i = first; i < nwritten; ++i) {
+    retained.insert(written_[i].first);
+    retained.insert(written_[i].second);
+  }
+
+  for (auto itr = written_.begin(); itr != written_.end();) {
+    if (retained.find(itr->first) != retained.end()) {
+      ++itr;
+      continue;
+    }
+    const std::string filename = filename_(itr->first);
+    if (std::remove(filename.c_str()) != 0)
+      console_->warn("Unable to remove checkpoint file: {}", filename);
+    itr = written_.erase(itr);
+  }
+}
+
+//! Read the header of a checkpoint file
+inline mpm::Checkpoint::Header mpm::Checkpoint::read_header(
+    std::ifstream& file, const std::string& filename) {
+  char magic[8];
+  file.read(magic, 8);
+  if (!file || std::memcmp(magic, "MPMCKPT1", 8) != 0)
+    throw std::runtime_error("Invalid checkpoint file: " + filename);
+
+  Header header;
+  uint8_t delta_flag = 0;
+  file.read(reinterpret_cast<char*>(&header.step), sizeof(header.step));
+  file.read(reinterpret_cast<char*>(&header.time), sizeof(header.time));
+  file.read(reinterpret_cast<char*>(&header.dt), sizeof(header.dt));
+  file.read(reinterpret_cast<char*>(&header.base_step),
+            sizeof(header.base_step));
+  file.read(reinterpret_cast<char*>(&delta_flag), sizeof(delta_flag));
+  if (!file) throw std::runtime_error("Invalid checkpoint file: " + filename);
+  header.delta = (delta_flag != 0);
+  return header;
+}
+
+//! Read a checkpoint
+inline mpm::Checkpoint::Snapshot mpm::Checkpoint::read(
+    mpm::Index step, const std::map<std::string, Layout>& layouts) const {
+  const std::string filename = filename_(step);
+  std::ifstream file(filename, std::ios::in | std::ios::binary);
+  if (!file.is_open())
+    throw std::runtime_error("Checkpoint file is not found: " + filename);
+
+  auto get = [&file, &filename](void* data, std::size_t nbytes) {
+    file.read(reinterpret_cast<char*>(data), nbytes);
+    if (!file)
+      throw std::runtime_error("Truncated checkpoint file: " + filename);
+  };
+
+  const Header header = read_header(file, filename);
+  if (header.delta && header.base_step == step)
+    throw std::runtime_error("Invalid checkpoint file: " + filename);
+
+  // Full checkpoint of a delta checkpoint
+  Snapshot base;
+  if (header.delta) base = this->read(header.base_step, layouts);
+
+  Snapshot snapshot;
+  snapshot.step = header.step;
+  snapshot.time = header.time;
+  snapshot.dt = header.dt;
+
+  uint32_t ntypes = 0;
+  get(&ntypes, sizeof(ntypes));
+  std::vector<uint8_t> encoded;
+  for (uint32_t t = 0; t < ntypes; ++t) {
+    uint32_t name_size = 0;
+    get(&name_size, sizeof(name_size));
+    std::string name(name_size, '\0');
+    get(&name[0], name_size);
+
+    // Field layout must match the POD type of this build
+    if (layouts.find(name) == layouts.end())
+      throw std::runtime_error("Unknown particle type " + name +
+                               " in checkpoint file: " + filename);
+    const Layout& layout = layouts.at(name);
+    uint32_t nfields = 0;
+    get(&nfields, sizeof(nfields));
+    if (nfields != layout.nfields)
+      throw std::runtime_error("Incorrect number of particle fields in " +
+                               filename);
+    for (unsigned i = 0; i < nfields; ++i) {
+      uint64_t field_size = 0;
+      get(&field_size, sizeof(field_size));
+      if (field_size != layout.sizes[i])
+        throw std::runtime_error("Incorrect particle field size in " +
+                                 filename);
+    }
+    const std::size_t size = record_size(layout);
+
+    uint64_t nrecords = 0, nbytes = 0;
+    get(&nrecords, sizeof(nrecords));
+    get(&nbytes, sizeof(nbytes));
+    auto& records = snapshot.particles[name];
+
+    if (!header.delta) {
+      if (nbytes != nrecords * size)
+        throw std::runtime_error("Incorrect particle records in " + filename);
+      records.resize(nbytes);
+      get(records.data(), nbytes);
+      continue;
+    }
+
+    encoded.resize(nbytes);
+    get(encoded.data(), nbytes);
+
+    // Records of the full checkpoint by particle id
+    const std::vector<uint8_t>& base_records = base.particles[name];
+    std::unordered_map<mpm::Index, std::size_t> base_index;
+    base_index.reserve(base_records.size() / size);
+    for (std::size_t i = 0; i < base_records.size() / size; ++i) {
+      mpm::Index id;
+      std::memcpy(&id, base_records.data() + i * size, sizeof(id));
+      base_index.emplace(id, i);
+    }
+
+    const std::size_t nmask = (nfields + 7) / 8;
+    records.resize(nrecords * size);
+    std::size_t position = 0;
+    for (uint64_t i = 0; i < nrecords; ++i) {
+      if (position + nmask + sizeof(mpm::Index) > encoded.size() ||
+          !(encoded[position] & 1u))
+        throw std::runtime_error("Incorrect particle records in " + filename);
+      const uint8_t* mask = encoded.data() + position;
+      position += nmask;
+
+      // Particle id and its record in the full checkpoint
+      mpm::Index id;
+      std::memcpy(&id, encoded.data() + position, sizeof(id));
+      const auto itr = base_index.find(id);
+      const uint8_t* reference =
+          (itr != base_index.end()) ? base_records.data() + itr->second * size
+                                    : nullptr;
+
+      uint8_t* record = records.data() + i * size;
+      std::size_t offset = 0;
+      for (unsigned j = 0; j < nfields; ++j) {
+        const std::size_t field_size = layout.sizes[j];
+        if (mask[j / 8] & (1u << (j % 8))) {
+          if (position + field_size > encoded.size())
+            throw std::runtime_error("Incorrect particle records in " +
+                                     filename);
+          std::memcpy(record + offset, encoded.data() + position, field_size);
+          position += field_size;
+        } else {
+          if (reference == nullptr)
+            throw std::runtime_error("Particle " + std::to_string(id) +
+                                     " is not in the full checkpoint of " +
+                                     filename);
+          std::memcpy(record + offset, reference + offset, field_size);
+        }
+        offset += field_size;
+      }
+    }
+  }
+
+  // Nodal velocity constraints
+  uint8_t has_constraints = 0;
+  get(&has_constraints, sizeof(has_constraints));
+  if (has_constraints) {
+    uint64_t nconstraints = 0;
+    get(&nconstraints, sizeof(nconstraints));
+    snapshot.constraints.reserve(nconstraints);
+    for (uint64_t i = 0; i < nconstraints; ++i) {
+      mpm::Index node;
+      uint32_t dir;
+      double velocity;
+      get(&node, sizeof(node));
+      get(&dir, sizeof(dir));
+      get(&velocity, sizeof(velocity));
+      snapshot.constraints.emplace_back(node, dir, velocity);
+    }
+  } else {
+    snapshot.constraints = std::move(base.constraints);
+  }
+  return snapshot;
+}
@@ -1,10 +1,12 @@
 #ifndef MPM_IO_MESH_ASCII_H_
 #define MPM_IO_MESH_ASCII_H_
 
+#include <algorithm>
 #include <vector>
 
 #include "Eigen/Dense"
 
+#include "ascii_file.h"
 #include "io_mesh.h"
 
 //! MPM namespace
@@ -4,63 +4,29 @@ std::vector<Eigen::Matrix<double, Tdim, 1>>
     mpm::IOMeshAscii<Tdim>::read_mesh_nodes(const std::string& mesh) {
   // Nodal coordinates
   std::vector<VectorDim> coordinates;
-  coordinates.clear();
-
-  // input file stream
-  std::fstream file;
-  file.open(mesh.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      // bool to check firstline
-      bool read_first_line = false;
-      // Number of coordinate lines
-      unsigned nlines = 0;
-      // Coordinates
-      Eigen::Matrix<double, Tdim, 1> coords;
-      // # of nodes and cells
-      unsigned nnodes = 0, ncells = 0;
-      // ignore stream
-      double ignore;
-
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nnodes >> ncells;
-              coordinates.reserve(nnodes);
-              read_first_line = true;
-              break;
-            }
-            // Read until nodal information is present
-            if (nlines <= nnodes) {
-              // Read to coordinates
-              for (unsigned i = 0; i < Tdim; ++i) istream >> coords[i];
-              coordinates.emplace_back(coords);
-              break;
-
-            } else {
-              // Ignore stream
-              istream >> ignore;
-            }
-          }
-          ++nlines;
-        }
-      }
-    } else {
-      throw std::runtime_error("File not open or not good!");
+    // Memory mapped file
+    const mpm::AsciiFile file(mesh);
+    if (file.nlines() == 0) return coordinates;
+
+    // Read number of nodes and cells
+    mpm::Index nnodes = 0, ncells = 0;
+    const char* ptr = file.begin(0);
+    mpm::AsciiFile::scan(ptr, file.end(0), &nnodes);
+    mpm::AsciiFile::scan(ptr, file.end(0), &ncells);
+
+    // Nodal coordinates follow the first line
+    nnodes = std::min<mpm::Index>(nnodes, file.nlines() - 1);
+    coordinates.resize(nnodes, VectorDim::Zero());
+#pragma omp parallel for schedule(static)
+    for (mpm::Index n = 0; n < nnodes; ++n) {
+      const char* line = file.begin(n + 1);
+      for (unsigned i = 0; i < Tdim; ++i)
+        mpm::AsciiFile::scan(line, file.end(n + 1), &coordinates[n](i));
     }
-    file.close();
   } catch (std::exception& exception) {
     console_->error("Read mesh nodes: {}", exception.what());
-    file.close();
   }
 
   return coordinates;
@@ -72,67 +38,36 @@ std::vector<std::vector<mpm::Index>> mpm::IOMeshAscii<Tdim>::read_mesh_cells(
     const std::string& mesh) {
   // Indices of nodes
   std::vector<std::vector<mpm::Index>> cells;
-  cells.clear();
-
-  std::fstream file;
-  file.open(mesh.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      std::string line;
-      // bool to check firstline
-      bool read_first_line = false;
-      // Number of coordinate lines
-      unsigned nlines = 0;
-      // Coordinates
-      Eigen::Matrix<double, Tdim, 1> coords;
-      // # of nodes and cells
-      mpm::Index nnodes = 0, ncells = 0;
-      // ignore stream
-      double ignore;
-
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // Vector of node ids for a cell
-        std::vector<mpm::Index> nodes;
-        nodes.clear();
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nnodes >> ncells;
-              cells.reserve(ncells);
-              read_first_line = true;
-              break;
-            }
-            // Ignore nodal coordinates
-            if (nlines > nnodes) {
-              // Read node ids of each cell
-              mpm::Index nid;
-              istream >> nid;
-              nodes.emplace_back(nid);
-            } else {
-              // Ignore stream not related to node ids of cells
-              istream >> ignore;
-            }
-          }
-          ++nlines;
-          // Check if nodes is not empty, before adding to cell
-          if (!nodes.empty()) {
-            cells.emplace_back(nodes);
-          }
-        }
-      }
-    } else {
-      throw std::runtime_error("File not open or not good!");
+    // Memory mapped file
+    const mpm::AsciiFile file(mesh);
+    if (file.nlines() == 0) return cells;
+
+    // Read number of nodes and cells
+    mpm::Index nnodes = 0, ncells = 0;
+    const char* ptr = file.begin(0);
+    mpm::AsciiFile::scan(ptr, file.end(0), &nnodes);
+    mpm::AsciiFile::scan(ptr, file.end(0), &ncells);
+
+    // Node ids of cells follow the nodal coordinates
+    const mpm::Index first = std::min<mpm::Index>(nnodes + 1, file.nlines());
+    cells.resize(file.nlines() - first);
+#pragma omp parallel for schedule(static)
+    for (mpm::Index c = 0; c < cells.size(); ++c) {
+      const char* line = file.begin(first + c);
+      mpm::Index nid;
+      while (mpm::AsciiFile::scan(line, file.end(first + c), &nid))
+        cells[c].emplace_back(nid);
     }
-    file.close();
+    // Remove lines without node ids
+    cells.erase(std::remove_if(cells.begin(), cells.end(),
+                               [](const std::vector<mpm::Index>& nodes) {
+                                 return nodes.empty();
+                               }),
+                cells.end());
   } catch (std::exception& exception) {
     console_->error("Read mesh cells: {}", exception.what());
-    file.close();
   }
 
   return cells;
@@ -145,52 +80,21 @@ std::vector<Eigen::Matrix<double, Tdim, 1>>
 
   // Nodal coordinates
   std::vector<VectorDim> coordinates;
-  coordinates.clear();
-
-  // Expected number of particles
-  mpm::Index nparticles;
-
-  // bool to check firstline
-  bool read_first_line = false;
-
-  // input file stream
-  std::fstream file;
-  file.open(particles_file.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nparticles;
-              coordinates.reserve(nparticles);
-              read_first_line = true;
-              break;
-            }
-            // Coordinates
-            Eigen::Matrix<double, Tdim, 1> coords;
-            // Read to coordinates
-            for (unsigned i = 0; i < Tdim; ++i) istream >> coords[i];
-            coordinates.emplace_back(coords);
-            break;
-          }
-        }
-      }
-    } else {
-      throw std::runtime_error("File not open or not good!");
+    // Memory mapped file, the first line is the number of particles
+    const mpm::AsciiFile file(particles_file);
+    if (file.nlines() == 0) return coordinates;
+
+    coordinates.resize(file.nlines() - 1, VectorDim::Zero());
+#pragma omp parallel for schedule(static)
+    for (mpm::Index p = 0; p < coordinates.size(); ++p) {
+      const char* line = file.begin(p + 1);
+      for (unsigned i = 0; i < Tdim; ++i)
+        mpm::AsciiFile::scan(line, file.end(p + 1), &coordinates[p](i));
     }
-    file.close();
   } catch (std::exception& exception) {
     console_->error("Read particle coordinates: {}", exception.what());
-    file.close();
   }
 
   return coordinates;
@@ -204,52 +108,21 @@ std::vector<Eigen::Matrix<double, 6, 1>>
 
   // Nodal stresses
   std::vector<Eigen::Matrix<double, 6, 1>> stresses;
-  stresses.clear();
-
-  // Expected number of particles
-  mpm::Index nparticles;
-
-  // bool to check firstline
-  bool read_first_line = false;
-
-  // input file stream
-  std::fstream file;
-  file.open(particles_stresses.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nparticles;
-              stresses.reserve(nparticles);
-              read_first_line = true;
-              break;
-            }
-            // Stresses
-            Eigen::Matrix<double, 6, 1> stress;
-            // Read to stress
-            for (unsigned i = 0; i < stress.size(); ++i) istream >> stress[i];
-            stresses.emplace_back(stress);
-            break;
-          }
-        }
-      }
-    } else {
-      throw std::runtime_error("File not open or not good!");
+    // Memory mapped file, the first line is the number of particles
+    const mpm::AsciiFile file(particles_stresses);
+    if (file.nlines() == 0) return stresses;
+
+    stresses.resize(file.nlines() - 1, Eigen::Matrix<double, 6, 1>::Zero());
+#pragma omp parallel for schedule(static)
+    for (mpm::Index p = 0; p < stresses.size(); ++p) {
+      const char* line = file.begin(p + 1);
+      for (unsigned i = 0; i < 6; ++i)
+        mpm::AsciiFile::scan(line, file.end(p + 1), &stresses[p](i));
     }
-    file.close();
   } catch (std::exception& exception) {
     console_->error("Read particle stresses: {}", exception.what());
-    file.close();
   }
   return stresses;
 }
@@ -263,39 +136,20 @@ std::vector<std::tuple<mpm::Index, double>>
   // Particles scalar properties
   std::vector<std::tuple<mpm::Index, double>> scalar_properties;
 
-  // input file stream
-  std::fstream file;
-  file.open(scalar_file.c_str(), std::ios::in);
-
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          // ID
-          mpm::Index id;
-          // Scalar
-          double scalar;
-          while (istream.good()) {
-            // Read stream
-            istream >> id >> scalar;
-            scalar_properties.emplace_back(std::make_tuple(id, scalar));
-          }
-        }
-      }
-    } else {
-      throw std::runtime_error("File not open or not good!");
+    // Memory mapped file
+    const mpm::AsciiFile file(scalar_file);
+    scalar_properties.resize(file.nlines());
+#pragma omp parallel for schedule(static)
+    for (mpm::Index p = 0; p < scalar_properties.size(); ++p) {
+      auto& property = scalar_properties[p];
+      const char* line = file.begin(p);
+      mpm::AsciiFile::scan(line, file.end(p), &std::get<0>(property));
+      mpm::AsciiFile::scan(line, file.end(p), &std::get<1>(property));
     }
-    file.close();
   } catch (std::exception& exception) {
     console_->error("Read particle {} #{}: {}\n", __FILE__, __LINE__,
                     exception.what());
-    file.close();
   }
   return scalar_properties;
 }
@@ -399,40 +253,19 @@ std::vector<std::tuple<mpm::Index, double>>
 
   // particle volumes
   std::vector<std::tuple<mpm::Index, double>> volumes;
-  volumes.clear();
-
-  // input file stream
-  std::fstream file;
-  file.open(volume_file.c_str(), std::ios::in);
 
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          // ID
-          mpm::Index id;
-          // Volume
-          double volume;
-          while (istream.good()) {
-            // Read stream
-            istream >> id >> volume;
-            volumes.emplace_back(std::make_tuple(id, volume));
-          }
-        }
-      }
-    } else {
-      throw std::runtime_error("File not open or not good!");
+    // Memory mapped file
+    const mpm::AsciiFile file(volume_file);
+    volumes.resize(file.nlines());
+#pragma omp parallel for schedule(static)
+    for (mpm::Index p = 0; p < volumes.size(); ++p) {
+      const char* line = file.begin(p);
+      mpm::AsciiFile::scan(line, file.end(p), &std::get<0>(volumes[p]));
+      mpm::AsciiFile::scan(line, file.end(p), &std::get<1>(volumes[p]));
     }
-    file.close();
   } catch (std::exception& exception) {
     console_->error("Read volume : {}", exception.what());
-    file.close();
   }
   return volumes;
 }
@@ -0,0 +1,88 @@
+#ifndef MPM_IO_MESH_HDF5_H_
+#define MPM_IO_MESH_HDF5_H_
+
+#include <string>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "hdf5.h"
+#include "hdf5_hl.h"
+
+#include "io_mesh_ascii.h"
+
+//! MPM namespace
+namespace mpm {
+
+//! IOMeshHDF5 class
+//! \brief Derived class that reads mesh and particles from binary HDF5 files
+//! \details Mesh files (.h5) hold a dataset "nodes" of nodal coordinates
+//! (nnodes x Tdim, double) and a dataset "cells" of node ids (ncells x
+//! nnodes per cell, unsigned 64 bit). Particle files hold "coordinates"
+//! (nparticles x Tdim) or "stresses" (nparticles x 6). Files without the .h5
+//! extension, and all other inputs, are read as ASCII files.
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class IOMeshHDF5 : public IOMeshAscii<Tdim> {
+ public:
+  //! Define a vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! Constructor
+  IOMeshHDF5() : mpm::IOMeshAscii<Tdim>() {
+    //! Logger
+    console_ = std::make_unique<spdlog::logger>("IOMeshHDF5", mpm::stdout_sink);
+  }
+
+  //! Destructor
+  ~IOMeshHDF5() override = default;
+
+  //! Read mesh nodes file
+  //! \param[in] mesh file name with nodes and cells
+  //! \retval coordinates Vector of nodal coordinates
+  std::vector<VectorDim> read_mesh_nodes(const std::string& mesh) override;
+
+  //! Read mesh cells file
+  //! \param[in] mesh file name with nodes and cells
+  //! \retval cells Vector of nodal indices of cells
+  std::vector<std::vector<mpm::Index>> read_mesh_cells(
+      const std::string& mesh) override;
+
+  //! Read particles file
+  //! \param[in] particles_files file name with particle coordinates
+  //! \retval coordinates Vector of particle coordinates
+  std::vector<VectorDim> read_particles(
+      const std::string& particles_file) override;
+
+  //! Read particle stresses
+  //! \param[in] particles_stresses file name with particle stresses
+  //! \retval stresses Vector of particle stresses
+  std::vector<Eigen::Matrix<double, 6, 1>> read_particles_stresses(
+      const std::string& particles_stresses) override;
+
+ private:
+  //! Return true if the file has the HDF5 extension
+  //! \param[in] filename Input file
+  static bool is_hdf5(const std::string& filename);
+
+  //! Read a two dimensional dataset of a file
+  //! \param[in] filename Input file
+  //! \param[in] dataset Dataset name
+  //! \param[in] type HDF5 memory type of the values
+  //! \param[in] ncols Expected number of columns, any if zero
+  //! \param[out] nrows Number of rows
+  //! \param[out] cols Number of columns
+  //! \retval data Values in row major order
+  template <typename Ttype>
+  std::vector<Ttype> read_dataset(const std::string& filename,
+                                  const std::string& dataset, hid_t type,
+                                  hsize_t ncols, hsize_t* nrows,
+                                  hsize_t* cols) const;
+
+  //! Logger
+  std::unique_ptr<spdlog::logger> console_;
+};  // IOMeshHDF5 class
+}  // namespace mpm
+
+#include "io_mesh_hdf5.tcc"
+
+#endif  // MPM_IO_MESH_HDF5_H_
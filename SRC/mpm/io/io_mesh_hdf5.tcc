@@ -0,0 +1,146 @@
+//! Return true if the file has the HDF5 extension
+template <unsigned Tdim>
+bool mpm::IOMeshHDF5<Tdim>::is_hdf5(const std::string& filename) {
+  const std::string extension = ".h5";
+  return filename.size() >= extension.size() &&
+         filename.compare(filename.size() - extension.size(),
+                          extension.size(), extension) == 0;
+}
+
+//! Read a two dimensional dataset of a file
+template <unsigned Tdim>
+template <typename Ttype>
+std::vector<Ttype> mpm::IOMeshHDF5<Tdim>::read_dataset(
+    const std::string& filename, const std::string& dataset, hid_t type,
+    hsize_t ncols, hsize_t* nrows, hsize_t* cols) const {
+  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file_id < 0)
+    throw std::runtime_error("HDF5 file is not found: " + filename);
+
+  std::vector<Ttype> data;
+  try {
+    if (H5LTfind_dataset(file_id, dataset.c_str()) <= 0)
+      throw std::runtime_error("HDF5 dataset " + dataset + " is not found");
+
+    int rank = 0;
+    H5LTget_dataset_ndims(file_id, dataset.c_str(), &rank);
+    if (rank < 1 || rank > 2)
+      throw std::runtime_error("HDF5 dataset " + dataset +
+                               " is not two dimensional");
+
+    hsize_t dims[2] = {0, 1};
+    H5LTget_dataset_info(file_id, dataset.c_str(), dims, nullptr, nullptr);
+    if (ncols != 0 && dims[1] != ncols)
+      throw std::runtime_error("HDF5 dataset " + dataset +
+                               " has incorrect number of columns");
+
+    data.resize(dims[0] * dims[1]);
+    if (!data.empty() &&
+        H5LTread_dataset(file_id, dataset.c_str(), type, data.data()) < 0)
+      throw std::runtime_error("Failed reading HDF5 dataset " + dataset);
+
+    *nrows = dims[0];
+    *cols = dims[1];
+  } catch (std::exception& exception) {
+    H5Fclose(file_id);
+    throw;
+  }
+  H5Fclose(file_id);
+  return data;
+}
+
+//! Return coordinates of nodes in a mesh from input file
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, Tdim, 1>>
+    mpm::IOMeshHDF5<Tdim>::read_mesh_nodes(const std::string& mesh) {
+  if (!is_hdf5(mesh)) return mpm::IOMeshAscii<Tdim>::read_mesh_nodes(mesh);
+
+  // Nodal coordinates
+  std::vector<VectorDim> coordinates;
+  try {
+    hsize_t nnodes = 0, ncols = 0;
+    const auto data = this->read_dataset<double>(mesh, "nodes",
+                                                 H5T_NATIVE_DOUBLE, Tdim,
+                                                 &nnodes, &ncols);
+    coordinates.resize(nnodes);
+#pragma omp parallel for schedule(static)
+    for (hsize_t n = 0; n < nnodes; ++n)
+      coordinates[n] = Eigen::Map<const VectorDim>(data.data() + n * Tdim);
+  } catch (std::exception& exception) {
+    console_->error("Read mesh nodes: {}", exception.what());
+  }
+  return coordinates;
+}
+
+//! Return indices of nodes of cells in a mesh from input file
+template <unsigned Tdim>
+std::vector<std::vector<mpm::Index>> mpm::IOMeshHDF5<Tdim>::read_mesh_cells(
+    const std::string& mesh) {
+  if (!is_hdf5(mesh)) return mpm::IOMeshAscii<Tdim>::read_mesh_cells(mesh);
+
+  // Indices of nodes
+  std::vector<std::vector<mpm::Index>> cells;
+  try {
+    hsize_t ncells = 0, nnodes = 0;
+    const auto data = this->read_dataset<mpm::Index>(
+        mesh, "cells", H5T_NATIVE_ULLONG, 0, &ncells, &nnodes);
+    cells.resize(ncells);
+#pragma omp parallel for schedule(static)
+    for (hsize_t c = 0; c < ncells; ++c)
+      cells[c].assign(data.begin() + c * nnodes,
+                      data.begin() + (c + 1) * nnodes);
+  } catch (std::exception& exception) {
+    console_->error("Read mesh cells: {}", exception.what());
+  }
+  return cells;
+}
+
+//! Return coordinates of particles
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, Tdim, 1>>
+    mpm::IOMeshHDF5<Tdim>::read_particles(const std::string& particles_file) {
+  if (!is_hdf5(particles_file))
+    return mpm::IOMeshAscii<Tdim>::read_particles(particles_file);
+
+  // Particle coordinates
+  std::vector<VectorDim> coordinates;
+  try {
+    hsize_t nparticles = 0, ncols = 0;
+    const auto data = this->read_dataset<double>(
+        particles_file, "coordinates", H5T_NATIVE_DOUBLE, Tdim, &nparticles,
+        &ncols);
+    coordinates.resize(nparticles);
+#pragma omp parallel for schedule(static)
+    for (hsize_t p = 0; p < nparticles; ++p)
+      coordinates[p] = Eigen::Map<const VectorDim>(data.data() + p * Tdim);
+  } catch (std::exception& exception) {
+    console_->error("Read particle coordinates: {}", exception.what());
+  }
+  return coordinates;
+}
+
+//! Return stresses of particles
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, 6, 1>>
+    mpm::IOMeshHDF5<Tdim>::read_particles_stresses(
+        const std::string& particles_stresses) {
+  if (!is_hdf5(particles_stresses))
+    return mpm::IOMeshAscii<Tdim>::read_particles_stresses(particles_stresses);
+
+  // Particle stresses
+  std::vector<Eigen::Matrix<double, 6, 1>> stresses;
+  try {
+    hsize_t nparticles = 0, ncols = 0;
+    const auto data =
+        this->read_dataset<double>(particles_stresses, "stresses",
+                                   H5T_NATIVE_DOUBLE, 6, &nparticles, &ncols);
+    stresses.resize(nparticles);
+#pragma omp parallel for schedule(static)
+    for (hsize_t p = 0; p < nparticles; ++p)
+      stresses[p] = Eigen::Map<const Eigen::Matrix<double, 6, 1>>(data.data() +
+                                                                  p * 6);
+  } catch (std::exception& exception) {
+    console_->error("Read particle stresses: {}", exception.what());
+  }
+  return stresses;
+}
@@ -0,0 +1,101 @@
+#ifndef MPM_VTU_WRITER_H_
+#define MPM_VTU_WRITER_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "data_types.h"
+#include "logger.h"
+
+namespace mpm {
+
+//! VTU writer class
+//! \brief Writes particles as VTK XML unstructured grid of vertices with
+//! appended raw binary data
+//! \details Point data are gathered into buffers owned by the writer, which
+//! are kept between outputs. The file is written by a background thread so
+//! that the following steps are computed while the output goes to disk.
+class VtuWriter {
+ public:
+  //! Constructor
+  VtuWriter() {
+    //! Logger
+    console_ = std::make_unique<spdlog::logger>("VtuWriter", mpm::stdout_sink);
+  }
+
+  //! Destructor waits for the pending write
+  ~VtuWriter() { this->wait(); }
+
+  //! Delete copy constructor
+  VtuWriter(const VtuWriter&) = delete;
+
+  //! Delete assignement operator
+  VtuWriter& operator=(const VtuWriter&) = delete;
+
+  //! Start a new output, waits for the pending write to finish
+  //! \param[in] npoints Number of points
+  void initialise(mpm::Index npoints);
+
+  //! Return the buffer of point coordinates (npoints x 3)
+  double* points() { return points_.data(); }
+
+  //! Add a point data field to the current output
+  //! \param[in] name Field name
+  //! \param[in] ncomponents Number of components
+  //! \retval data Buffer of npoints x ncomponents values to be filled
+  double* add_point_data(const std::string& name, unsigned ncomponents);
+
+  //! Write the current output to a VTU file in a background thread
+  //! \param[in] filename Output VTU file
+  void write(const std::string& filename);
+
+  //! Write a parallel VTU index of the pieces written by each rank
+  //! \param[in] filename Output PVTU file
+  //! \param[in] pieces File names of the pieces relative to the index
+  void write_parallel_index(const std::string& filename,
+                            const std::vector<std::string>& pieces) const;
+
+  //! Wait for the pending write to finish
+  void wait();
+
+ private:
+  //! Point data field
+  struct Field {
+    //! Field name
+    std::string name;
+    //! Number of components
+    unsigned ncomponents{1};
+    //! Values (npoints x ncomponents)
+    std::vector<double> data;
+  };
+
+  //! Write the VTU file, runs on the background thread
+  //! \param[in] filename Output VTU file
+  void write_file(const std::string& filename) const;
+
+  //! Return the byte order of the machine in VTK notation
+  static std::string byte_order();
+
+  //! Number of points
+  mpm::Index npoints_{0};
+  //! Point coordinates (npoints x 3)
+  std::vector<double> points_;
+  //! Point data fields, kept between outputs to reuse the buffers
+  std::vector<Field> fields_;
+  //! Number of fields in the current output
+  unsigned nfields_{0};
+  //! Pending write
+  std::future<void> pending_;
+  //! Logger
+  std::unique_ptr<spdlog::logger> console_;
+};
+}  // namespace mpm
+
+#include "vtu_writer.tcc"
+
+#endif  // MPM_VTU_WRITER_H_
@@ -0,0 +1,165 @@
+//! Start a new output
+inline void mpm::VtuWriter::initialise(mpm::Index npoints) {
+  // Buffers are shared with the pending write
+  this->wait();
+  npoints_ = npoints;
+  points_.resize(npoints * 3);
+  nfields_ = 0;
+}
+
+//! Add a point data field
+inline double* mpm::VtuWriter::add_point_data(const std::string& name,
+                                              unsigned ncomponents) {
+  if (nfields_ == fields_.size()) fields_.emplace_back();
+  Field& field = fields_[nfields_];
+  ++nfields_;
+  field.name = name;
+  field.ncomponents = ncomponents;
+  field.data.resize(npoints_ * ncomponents);
+  return field.data.data();
+}
+
+//! Write the current output in a background thread
+inline void mpm::VtuWriter::write(const std::string& filename) {
+  this->wait();
+  pending_ = std::async(std::launch::async,
+                        [this, filename]() { this->write_file(filename); });
+}
+
+//! Wait for the pending write
+inline void mpm::VtuWriter::wait() {
+  if (!pending_.valid()) return;
+  try {
+    pending_.get();
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+  }
+}
+
+//! Byte order of the machine
+inline std::string mpm::VtuWriter::byte_order() {
+  const std::uint16_t one = 1;
+  return (*reinterpret_cast<const std::uint8_t*>(&one) == 1) ? "LittleEndian"
+                                                             : "BigEndian";
+}
+
+//! Write the VTU file
+inline void mpm::VtuWriter::write_file(const std::string& filename) const {
+  std::ofstream file(filename, std::ios::out | std::ios::binary);
+  if (!file.is_open())
+    throw std::runtime_error("Unable to open VTU file: " + filename);
+
+  const std::uint64_t npoints = npoints_;
+  const std::uint64_t points_bytes = npoints * 3 * sizeof(double);
+  const std::uint64_t index_bytes = npoints * sizeof(std::int64_t);
+  const std::uint64_t types_bytes = npoints * sizeof(std::uint8_t);
+
+  // Offsets of the appended blocks, each block is preceded by its size
+  std::uint64_t offset = 0;
+  auto next_offset = [&offset](std::uint64_t nbytes) {
+    const std::uint64_t current = offset;
+    offset += sizeof(std::uint64_t) + nbytes;
+    return current;
+  };
+
+  // XML header
+  file << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+       << byte_order() << "\" header_type=\"UInt64\">\n"
+       << "  <UnstructuredGrid>\n"
+       << "    <Piece NumberOfPoints=\"" << npoints << "\" NumberOfCells=\""
+       << npoints << "\">\n"
+       << "      <Points>\n"
+       << "        <DataArray type=\"Float64\" NumberOfComponents=\"3\" "
+       << "format=\"appended\" offset=\"" << next_offset(points_bytes)
+       << "\"/>\n"
+       << "      </Points>\n"
+       << "      <PointData>\n";
+  for (unsigned i = 0; i < nfields_; ++i)
+    file << "        <DataArray type=\"Float64\" Name=\"" << fields_[i].name
+         << "\" NumberOfComponents=\"" << fields_[i].ncomponents
+         << "\" format=\"appended\" offset=\""
+         << next_offset(fields_[i].data.size() * sizeof(double)) << "\"/>\n";
+  file << "      </PointData>\n"
+       << "      <Cells>\n"
+       << "        <DataArray type=\"Int64\" Name=\"connectivity\" "
+       << "format=\"appended\" offset=\"" << next_offset(index_bytes)
+       << "\"/>\n"
+       << "        <DataArray type=\"Int64\" Name=\"offsets\" "
+       << "format=\"appended\" offset=\"" << next_offset(index_bytes)
+       << "\"/>\n"
+       << "        <DataArray type=\"UInt8\" Name=\"types\" "
+       << "format=\"appended\" offset=\"" << next_offset(types_bytes)
+       << "\"/>\n"
+       << "      </Cells>\n"
+       << "    </Piece>\n"
+       << "  </UnstructuredGrid>\n"
+       << "  <AppendedData encoding=\"raw\">\n_";
+
+  // Appended raw data
+  auto write_block = [&file](const void* data, std::uint64_t nbytes) {
+    file.write(reinterpret_cast<const char*>(&nbytes), sizeof(nbytes));
+    file.write(reinterpret_cast<const char*>(data), nbytes);
+  };
+  write_block(points_.data(), points_bytes);
+  for (unsigned i = 0; i < nfields_; ++i)
+    write_block(fields_[i].data.data(),
+                fields_[i].data.size() * sizeof(double));
+
+  // Every particle is a vertex cell, written in chunks
+  const std::uint64_t chunk = 4096;
+  std::vector<std::int64_t> index(chunk);
+  for (unsigned shift = 0; shift < 2; ++shift) {
+    file.write(reinterpret_cast<const char*>(&index_bytes),
+               sizeof(index_bytes));
+    for (std::uint64_t begin = 0; begin < npoints; begin += chunk) {
+      const std::uint64_t n = std::min(chunk, npoints - begin);
+      for (std::uint64_t i = 0; i < n; ++i) index[i] = begin + i + shift;
+      file.write(reinterpret_cast<const char*>(index.data()),
+                 n * sizeof(std::int64_t));
+    }
+  }
+  // VTK_VERTEX
+  const std::vector<std::uint8_t> types(std::min(chunk, npoints), 1);
+  file.write(reinterpret_cast<const char*>(&types_bytes), sizeof(types_bytes));
+  for (std::uint64_t begin = 0; begin < npoints; begin += chunk)
+    file.write(reinterpret_cast<const char*>(types.data()),
+               std::min(chunk, npoints - begin));
+
+  file << "\n  </AppendedData>\n</VTKFile>\n";
+  if (!file.good())
+    throw std::runtime_error("Failed writing VTU file: " + filename);
+}
+
+//! Write a parallel VTU index
+inline void mpm::VtuWriter::write_parallel_index(
+    const std::string& filename, const std::vector<std::string>& pieces) const {
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    console_->error("{} #{}: Unable to open PVTU file: {}\n", __FILE__,
+                    __LINE__, filename);
+    return;
+  }
+
+  file << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\""
+       << byte_order() << "\" header_type=\"UInt64\">\n"
+       << "  <PUnstructuredGrid GhostLevel=\"0\">\n"
+       << "    <PPoints>\n"
+       << "      <PDataArray type=\"Float64\" NumberOfComponents=\"3\"/>\n"
+       << "    </PPoints>\n"
+       << "    <PPointData>\n";
+  for (unsigned i = 0; i < nfields_; ++i)
+    file << "      <PDataArray type=\"Float64\" Name=\"" << fields_[i].name
+         << "\" NumberOfComponents=\"" << fields_[i].ncomponents << "\"/>\n";
+  file << "    </PPointData>\n"
+       << "    <PCells>\n"
+       << "      <PDataArray type=\"Int64\" Name=\"connectivity\"/>\n"
+       << "      <PDataArray type=\"Int64\" Name=\"offsets\"/>\n"
+       << "      <PDataArray type=\"UInt8\" Name=\"types\"/>\n"
+       << "    </PCells>\n";
+  for (const auto& piece : pieces)
+    file << "    <Piece Source=\"" << piece << "\"/>\n";
+  file << "  </PUnstructuredGrid>\n"
+       << "</VTKFile>\n";
+}
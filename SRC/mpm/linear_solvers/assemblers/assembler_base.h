@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <array>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -79,11 +80,17 @@ class AssemblerBase {
   }
 
   //! Create a pair between nodes and index in Matrix / Vector
+  //! \details Also checks whether the active node and cell sets have changed
+  //! since the last call, which invalidates cached sparsity patterns
   //! \param[in] nactive_node Number of active node in the current process
   //! \param[in] nglobal_active_node Number of active node in the all processes
   bool assign_global_node_indices(unsigned nactive_node,
                                   unsigned nglobal_active_node);
 
+  //! Return true if the sparsity pattern changed at the last assignment of
+  //! global node indices
+  bool sparsity_changed() const { return sparsity_changed_; }
+
   //! Null-space treatment of a sparse matrix given a coefficient matrix
   //! \param[in] coefficient_matrix Coefficient matrix of the linear systems of
   //! equations
@@ -329,6 +336,37 @@ class AssemblerBase {
   };
 
  protected:
+  //! Sparsity pattern of an assembled matrix
+  //! \details Offsets of each assembled entry in the compressed values of the
+  //! matrix, in the order the entries are visited during assembly
+  struct SparsityPattern {
+    //! Pattern version the offsets refer to
+    unsigned version{std::numeric_limits<unsigned>::max()};
+    //! Offsets of assembled entries in the matrix values
+    std::vector<Eigen::Index> offsets;
+  };
+
+  //! Assemble a global sparse matrix reusing its sparsity pattern
+  //! \details The pattern is rebuilt from the visited entries only when the
+  //! active node set has changed; otherwise values are scattered directly into
+  //! the existing compressed storage. Square matrices always carry their full
+  //! diagonal so that null-space and constraint treatments keep the pattern.
+  //! \tparam Tassemble Callable taking an add(row, col, value) functor, which
+  //! must visit the same entries in the same order while the pattern is valid
+  //! \param[in,out] matrix Global sparse matrix
+  //! \param[in,out] pattern Cached sparsity pattern of the matrix
+  //! \param[in] nrows Number of rows
+  //! \param[in] ncols Number of columns
+  //! \param[in] assemble Assembly callable
+  template <typename Tassemble>
+  void assemble_sparse_matrix(Eigen::SparseMatrix<double>& matrix,
+                              SparsityPattern& pattern, Eigen::Index nrows,
+                              Eigen::Index ncols, Tassemble assemble);
+
+  //! Return matrix indices of null-space nodes (nodes without mass)
+  //! \param[in] nblock Number of DOF per node
+  std::vector<mpm::Index> null_space_indices(unsigned nblock) const;
+
   //! Number of total active_dof
   unsigned active_dof_;
   //! Mesh object
@@ -343,6 +381,12 @@ class AssemblerBase {
   unsigned global_active_dof_;
   //! Rank to Global mapper
   std::vector<int> rank_global_mapper_;
+  //! Ids of active nodes at the last assignment of global node indices
+  std::vector<mpm::Index> active_node_ids_;
+  //! Sparsity pattern version, incremented when the active node set changes
+  unsigned sparsity_version_{0};
+  //! Sparsity pattern changed at the last assignment of global node indices
+  bool sparsity_changed_{true};
 };
 }  // namespace mpm
 
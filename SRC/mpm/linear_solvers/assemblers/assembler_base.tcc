@@ -6,7 +6,31 @@ bool mpm::AssemblerBase<Tdim>::assign_global_node_indices(
   try {
     // Total number of active node (in a rank) and (rank) node indices
     active_dof_ = nactive_node;
-    global_node_indices_ = mesh_->global_node_indices();
+    auto global_node_indices = mesh_->global_node_indices();
+
+    // Active node ids in matrix order
+    const auto& active_nodes = mesh_->active_nodes();
+    std::vector<mpm::Index> active_node_ids;
+    active_node_ids.reserve(active_nodes.size());
+    for (auto node = active_nodes.cbegin(); node != active_nodes.cend(); ++node)
+      active_node_ids.emplace_back((*node)->id());
+
+    // Sparsity is unchanged if the same nodes are active in the same order
+    // and the active cells connect the same matrix indices
+    sparsity_changed_ = (active_node_ids != active_node_ids_ ||
+                         global_node_indices.size() !=
+                             global_node_indices_.size());
+    for (unsigned i = 0; !sparsity_changed_ && i < global_node_indices.size();
+         ++i) {
+      const auto& nids = global_node_indices[i];
+      const auto& prev_nids = global_node_indices_[i];
+      sparsity_changed_ =
+          (nids.size() != prev_nids.size() || nids != prev_nids);
+    }
+    if (sparsity_changed_) ++sparsity_version_;
+
+    active_node_ids_ = std::move(active_node_ids);
+    global_node_indices_ = std::move(global_node_indices);
 
 #ifdef USE_MPI
     // Total number of active node (in all rank)
@@ -30,10 +54,10 @@ bool mpm::AssemblerBase<Tdim>::assign_global_node_indices(
   return status;
 }
 
-//! Null-space treatment of a sparse matrix given a coefficient matrix
+//! Return matrix indices of null-space nodes
 template <unsigned Tdim>
-void mpm::AssemblerBase<Tdim>::apply_null_space_treatment(
-    Eigen::SparseMatrix<double>& coefficient_matrix, unsigned nblock) {
+std::vector<mpm::Index> mpm::AssemblerBase<Tdim>::null_space_indices(
+    unsigned nblock) const {
   // Nodes container
   const auto& nodes = mesh_->active_nodes();
   std::vector<mpm::Index> null_space_node;
@@ -56,9 +80,15 @@ void mpm::AssemblerBase<Tdim>::apply_null_space_treatment(
                            std::make_move_iterator(ns_node.begin()),
                            std::make_move_iterator(ns_node.end()));
   }
+  return null_space_node;
+}
 
+//! Null-space treatment of a sparse matrix given a coefficient matrix
+template <unsigned Tdim>
+void mpm::AssemblerBase<Tdim>::apply_null_space_treatment(
+    Eigen::SparseMatrix<double>& coefficient_matrix, unsigned nblock) {
   // Modify coefficient matrix diagonal element
-  for (const auto index : null_space_node) {
+  for (const auto index : this->null_space_indices(nblock)) {
     // Assign 1 to diagonal element
     coefficient_matrix.coeffRef(index, index) = 1.0;
   }
@@ -69,33 +99,64 @@ template <unsigned Tdim>
 void mpm::AssemblerBase<Tdim>::apply_null_space_treatment(
     std::vector<Eigen::Triplet<double>>& coefficient_tripletList,
     unsigned nblock) {
-  // Nodes container
-  const auto& nodes = mesh_->active_nodes();
-  std::vector<mpm::Index> null_space_node;
-  // Iterate over nodes to check if any nodal mass is zero
-#pragma omp parallel
-  {
-    std::vector<mpm::Index> ns_node;
-#pragma omp for nowait
-    for (auto node = nodes.cbegin(); node != nodes.cend(); ++node) {
-      if ((*node)->mass(mpm::NodePhase::NSinglePhase) <
-          std::numeric_limits<double>::epsilon()) {
-        const auto n_id = (*node)->active_id();
-        for (unsigned nb = 0; nb < nblock; nb++)
-          ns_node.push_back(nb * active_dof_ + n_id);
-      }
-    }
-
-#pragma omp critical
-    null_space_node.insert(null_space_node.end(),
-                           std::make_move_iterator(ns_node.begin()),
-                           std::make_move_iterator(ns_node.end()));
-  }
-
   // Modify coefficient matrix diagonal element
-  for (const auto index : null_space_node) {
+  for (const auto index : this->null_space_indices(nblock)) {
     // Assign 1 to diagonal element
     coefficient_tripletList.emplace_back(
         Eigen::Triplet<double>(index, index, 1.0));
   }
-}
\ No newline at end of file
+}
+
+//! Assemble a global sparse matrix reusing its sparsity pattern
+template <unsigned Tdim>
+template <typename Tassemble>
+void mpm::AssemblerBase<Tdim>::assemble_sparse_matrix(
+    Eigen::SparseMatrix<double>& matrix, SparsityPattern& pattern,
+    Eigen::Index nrows, Eigen::Index ncols, Tassemble assemble) {
+  // Rebuild the pattern if the structure has changed
+  if (pattern.version != sparsity_version_ || matrix.rows() != nrows ||
+      matrix.cols() != ncols || !matrix.isCompressed()) {
+    // Collect visited entries
+    std::vector<std::pair<Eigen::Index, Eigen::Index>> entries;
+    entries.reserve(nrows * sparse_row_size_);
+    assemble([&entries](Eigen::Index row, Eigen::Index col, double value) {
+      entries.emplace_back(row, col);
+    });
+
+    // Build the pattern with explicit zeros
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(entries.size() + std::min(nrows, ncols));
+    for (const auto& entry : entries)
+      triplets.emplace_back(entry.first, entry.second, 0.);
+    if (nrows == ncols)
+      for (Eigen::Index i = 0; i < nrows; ++i) triplets.emplace_back(i, i, 0.);
+
+    matrix.resize(nrows, ncols);
+    matrix.setFromTriplets(triplets.begin(), triplets.end());
+    matrix.makeCompressed();
+
+    // Locate each entry in the compressed (column major) storage
+    const auto* outer = matrix.outerIndexPtr();
+    const auto* inner = matrix.innerIndexPtr();
+    pattern.offsets.resize(entries.size());
+#pragma omp parallel for schedule(runtime)
+    for (std::size_t k = 0; k < entries.size(); ++k) {
+      const auto col = entries[k].second;
+      pattern.offsets[k] =
+          std::lower_bound(inner + outer[col], inner + outer[col + 1],
+                           entries[k].first) -
+          inner;
+    }
+    pattern.version = sparsity_version_;
+  }
+
+  // Scatter values directly into the compressed storage
+  double* values = matrix.valuePtr();
+  std::fill(values, values + matrix.nonZeros(), 0.);
+  std::size_t position = 0;
+  const auto* offsets = pattern.offsets.data();
+  assemble([values, offsets, &position](Eigen::Index row, Eigen::Index col,
+                                        double value) {
+    values[offsets[position++]] += value;
+  });
+}
@@ -78,6 +78,8 @@ class AssemblerEigenImplicit : public AssemblerBase<Tdim> {
   std::unique_ptr<spdlog::logger> console_;
   //! Stiffness matrix
   Eigen::SparseMatrix<double> stiffness_matrix_;
+  //! Cached sparsity pattern of the stiffness matrix
+  typename AssemblerBase<Tdim>::SparsityPattern stiffness_pattern_;
   //! Residual force RHS vector
   Eigen::VectorXd residual_force_rhs_vector_;
   //! Displacement constraints
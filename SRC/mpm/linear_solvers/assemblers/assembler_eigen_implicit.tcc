@@ -13,14 +13,6 @@ template <unsigned Tdim>
 bool mpm::AssemblerEigenImplicit<Tdim>::assemble_stiffness_matrix() {
   bool status = true;
   try {
-    // Initialise stiffness matrix
-    stiffness_matrix_.resize(active_dof_ * Tdim, active_dof_ * Tdim);
-    stiffness_matrix_.setZero();
-
-    // Triplets and reserve storage for sparse matrix
-    std::vector<Eigen::Triplet<double>> tripletList;
-    tripletList.reserve(active_dof_ * Tdim * sparse_row_size_ * Tdim);
-
     // Cell pointer
     const auto& cells = mesh_->cells();
 
@@ -28,40 +20,36 @@ bool mpm::AssemblerEigenImplicit<Tdim>::assemble_stiffness_matrix() {
     const auto& active_nodes = mesh_->active_nodes();
     const unsigned nactive_node = active_nodes.size();
 
-    // Iterate over cells
-    mpm::Index cid = 0;
-    for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend(); ++cell_itr) {
-      if ((*cell_itr)->status()) {
-        // Node ids in each cell
-        const auto nids = global_node_indices_.at(cid);
-
-        // Element stiffness of cell
-        const auto cell_stiffness = (*cell_itr)->stiffness_matrix();
-
-        // Assemble global stiffness matrix
-        for (unsigned i = 0; i < nids.size(); ++i) {
-          for (unsigned j = 0; j < nids.size(); ++j) {
-            for (unsigned k = 0; k < Tdim; ++k) {
-              for (unsigned l = 0; l < Tdim; ++l) {
-                if (std::abs(cell_stiffness(Tdim * i + k, Tdim * j + l)) >
-                    std::numeric_limits<double>::epsilon())
-                  tripletList.emplace_back(Eigen::Triplet<double>(
-                      nactive_node * k + global_node_indices_.at(cid)(i),
-                      nactive_node * l + global_node_indices_.at(cid)(j),
-                      cell_stiffness(Tdim * i + k, Tdim * j + l)));
-              }
+    // Assemble global stiffness matrix, reusing the pattern if unchanged
+    this->assemble_sparse_matrix(
+        stiffness_matrix_, stiffness_pattern_, active_dof_ * Tdim,
+        active_dof_ * Tdim, [&](auto&& add) {
+          // Iterate over cells
+          mpm::Index cid = 0;
+          for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend();
+               ++cell_itr) {
+            if ((*cell_itr)->status()) {
+              // Node ids in each cell
+              const auto& nids = global_node_indices_.at(cid);
+
+              // Element stiffness of cell
+              const auto& cell_stiffness = (*cell_itr)->stiffness_matrix();
+
+              for (unsigned i = 0; i < nids.size(); ++i)
+                for (unsigned j = 0; j < nids.size(); ++j)
+                  for (unsigned k = 0; k < Tdim; ++k)
+                    for (unsigned l = 0; l < Tdim; ++l)
+                      add(nactive_node * k + nids(i),
+                          nactive_node * l + nids(j),
+                          cell_stiffness(Tdim * i + k, Tdim * j + l));
+              ++cid;
             }
           }
-        }
-        ++cid;
-      }
-    }
+        });
 
     // Apply null-space treatment
-    this->apply_null_space_treatment(tripletList, Tdim);
-
-    // Fast assembly from triplets
-    stiffness_matrix_.setFromTriplets(tripletList.begin(), tripletList.end());
+    for (const auto index : this->null_space_indices(Tdim))
+      stiffness_matrix_.coeffRef(index, index) += 1.0;
 
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
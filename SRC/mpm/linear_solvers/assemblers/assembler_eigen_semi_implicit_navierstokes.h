@@ -74,6 +74,12 @@ class AssemblerEigenSemiImplicitNavierStokes : public AssemblerBase<Tdim> {
   using AssemblerBase<Tdim>::global_node_indices_;
   //! Laplacian matrix
   Eigen::SparseMatrix<double> laplacian_matrix_;
+  //! Cached sparsity pattern of the laplacian matrix
+  typename AssemblerBase<Tdim>::SparsityPattern laplacian_pattern_;
+  //! Poisson RHS matrix
+  Eigen::SparseMatrix<double> poisson_right_matrix_;
+  //! Cached sparsity pattern of the poisson RHS matrix
+  typename AssemblerBase<Tdim>::SparsityPattern poisson_right_pattern_;
   //! Poisson RHS vector
   Eigen::VectorXd poisson_rhs_vector_;
   //! Free surface
@@ -84,6 +90,8 @@ class AssemblerEigenSemiImplicitNavierStokes : public AssemblerBase<Tdim> {
   Eigen::VectorXd pressure_increment_;
   //! correction_matrix
   Eigen::SparseMatrix<double> correction_matrix_;
+  //! Cached sparsity pattern of the correction matrix
+  typename AssemblerBase<Tdim>::SparsityPattern correction_pattern_;
 };
 }  // namespace mpm
 
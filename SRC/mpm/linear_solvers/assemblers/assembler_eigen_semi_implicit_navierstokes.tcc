@@ -14,39 +14,31 @@ bool mpm::AssemblerEigenSemiImplicitNavierStokes<
     Tdim>::assemble_laplacian_matrix(double dt) {
   bool status = true;
   try {
-    // Initialise Laplacian matrix
-    laplacian_matrix_.resize(active_dof_, active_dof_);
-    laplacian_matrix_.setZero();
-
-    // Reserve storage for sparse matrix
-    laplacian_matrix_.reserve(
-        Eigen::VectorXi::Constant(active_dof_, sparse_row_size_));
-
     // Cell pointer
     const auto& cells = mesh_->cells();
 
-    // Iterate over cells
-    mpm::Index cid = 0;
-    for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend(); ++cell_itr) {
-      if ((*cell_itr)->status()) {
-        // Node ids in each cell
-        const auto nids = global_node_indices_.at(cid);
-
-        // Laplacian element of cell
-        const auto cell_laplacian = (*cell_itr)->laplacian_matrix();
-
-        // Assemble global laplacian matrix
-        for (unsigned i = 0; i < nids.size(); ++i) {
-          for (unsigned j = 0; j < nids.size(); ++j) {
-            laplacian_matrix_.coeffRef(global_node_indices_.at(cid)(i),
-                                       global_node_indices_.at(cid)(j)) +=
-                cell_laplacian(i, j);
+    // Assemble global laplacian matrix, reusing the pattern if unchanged
+    this->assemble_sparse_matrix(
+        laplacian_matrix_, laplacian_pattern_, active_dof_, active_dof_,
+        [&](auto&& add) {
+          // Iterate over cells
+          mpm::Index cid = 0;
+          for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend();
+               ++cell_itr) {
+            if ((*cell_itr)->status()) {
+              // Node ids in each cell
+              const auto& nids = global_node_indices_.at(cid);
+
+              // Laplacian element of cell
+              const auto& cell_laplacian = (*cell_itr)->laplacian_matrix();
+
+              for (unsigned i = 0; i < nids.size(); ++i)
+                for (unsigned j = 0; j < nids.size(); ++j)
+                  add(nids(i), nids(j), cell_laplacian(i, j));
+              ++cid;
+            }
           }
-        }
-
-        ++cid;
-      }
-    }
+        });
 
     laplacian_matrix_ *= dt;
 
@@ -66,42 +58,34 @@ bool mpm::AssemblerEigenSemiImplicitNavierStokes<Tdim>::assemble_poisson_right(
     double dt) {
   bool status = true;
   try {
-    // Initialise Poisson RHS matrix
-    Eigen::SparseMatrix<double> poisson_right_matrix;
-    poisson_right_matrix.resize(active_dof_, active_dof_ * Tdim);
-    poisson_right_matrix.setZero();
-
-    // Reserve storage for sparse matrix
-    poisson_right_matrix.reserve(
-        Eigen::VectorXi::Constant(active_dof_ * Tdim, sparse_row_size_));
-
     // Cell pointer
     const auto& cells = mesh_->cells();
 
-    // Iterate over cells
-    mpm::Index cid = 0;
-    for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend(); ++cell_itr) {
-      if ((*cell_itr)->status()) {
-        // Node ids in each cell
-        const auto nids = global_node_indices_.at(cid);
-
-        // Local Poisson RHS matrix
-        auto cell_poisson_right = (*cell_itr)->poisson_right_matrix();
-
-        // Assemble global poisson RHS matrix
-        for (unsigned i = 0; i < nids.size(); ++i) {
-          for (unsigned j = 0; j < nids.size(); ++j) {
-            for (unsigned k = 0; k < Tdim; ++k) {
-              poisson_right_matrix.coeffRef(
-                  global_node_indices_.at(cid)(i),
-                  global_node_indices_.at(cid)(j) + k * active_dof_) +=
-                  cell_poisson_right(i, j + k * nids.size());
+    // Assemble global poisson RHS matrix, reusing the pattern if unchanged
+    this->assemble_sparse_matrix(
+        poisson_right_matrix_, poisson_right_pattern_, active_dof_,
+        active_dof_ * Tdim, [&](auto&& add) {
+          // Iterate over cells
+          mpm::Index cid = 0;
+          for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend();
+               ++cell_itr) {
+            if ((*cell_itr)->status()) {
+              // Node ids in each cell
+              const auto& nids = global_node_indices_.at(cid);
+
+              // Local Poisson RHS matrix
+              const auto& cell_poisson_right =
+                  (*cell_itr)->poisson_right_matrix();
+
+              for (unsigned i = 0; i < nids.size(); ++i)
+                for (unsigned j = 0; j < nids.size(); ++j)
+                  for (unsigned k = 0; k < Tdim; ++k)
+                    add(nids(i), nids(j) + k * active_dof_,
+                        cell_poisson_right(i, j + k * nids.size()));
+              ++cid;
             }
           }
-        }
-        cid++;
-      }
-    }
+        });
 
     // Resize poisson right vector
     poisson_rhs_vector_.resize(active_dof_);
@@ -128,7 +112,7 @@ bool mpm::AssemblerEigenSemiImplicitNavierStokes<Tdim>::assemble_poisson_right(
     fluid_velocity.resize(active_dof_ * Tdim, 1);
 
     // Compute poisson RHS vector
-    poisson_rhs_vector_ = -poisson_right_matrix * fluid_velocity;
+    poisson_rhs_vector_ = -poisson_right_matrix_ * fluid_velocity;
 
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
@@ -143,37 +127,32 @@ bool mpm::AssemblerEigenSemiImplicitNavierStokes<
     Tdim>::assemble_corrector_right(double dt) {
   bool status = true;
   try {
-    // Resize correction matrix
-    correction_matrix_.resize(active_dof_, active_dof_ * Tdim);
-    correction_matrix_.setZero();
-
-    // Reserve storage for sparse matrix
-    correction_matrix_.reserve(
-        Eigen::VectorXi::Constant(active_dof_ * Tdim, sparse_row_size_));
-
     // Cell pointer
     const auto& cells = mesh_->cells();
 
-    // Iterate over cells
-    unsigned cid = 0;
-    for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend(); ++cell_itr) {
-      if ((*cell_itr)->status()) {
-        unsigned nnodes_per_cell = global_node_indices_.at(cid).size();
-        auto cell_correction_matrix = (*cell_itr)->correction_matrix();
-        for (unsigned k = 0; k < Tdim; k++) {
-          for (unsigned i = 0; i < nnodes_per_cell; i++) {
-            for (unsigned j = 0; j < nnodes_per_cell; j++) {
-              // Fluid
-              correction_matrix_.coeffRef(
-                  global_node_indices_.at(cid)(i),
-                  k * active_dof_ + global_node_indices_.at(cid)(j)) +=
-                  cell_correction_matrix(i, j + k * nnodes_per_cell);
+    // Assemble correction matrix, reusing the pattern if unchanged
+    this->assemble_sparse_matrix(
+        correction_matrix_, correction_pattern_, active_dof_,
+        active_dof_ * Tdim, [&](auto&& add) {
+          // Iterate over cells
+          unsigned cid = 0;
+          for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend();
+               ++cell_itr) {
+            if ((*cell_itr)->status()) {
+              const auto& nids = global_node_indices_.at(cid);
+              const unsigned nnodes_per_cell = nids.size();
+              const auto& cell_correction_matrix =
+                  (*cell_itr)->correction_matrix();
+              for (unsigned k = 0; k < Tdim; k++)
+                for (unsigned i = 0; i < nnodes_per_cell; i++)
+                  for (unsigned j = 0; j < nnodes_per_cell; j++)
+                    // Fluid
+                    add(nids(i), k * active_dof_ + nids(j),
+                        cell_correction_matrix(i, j + k * nnodes_per_cell));
+              cid++;
             }
           }
-        }
-        cid++;
-      }
-    }
+        });
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
     status = false;
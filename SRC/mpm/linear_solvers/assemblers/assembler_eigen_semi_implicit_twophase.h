@@ -75,10 +75,23 @@ class AssemblerEigenSemiImplicitTwoPhase
   using AssemblerEigenSemiImplicitNavierStokes<Tdim>::pressure_constraints_;
   //! Correction_matrix
   using AssemblerEigenSemiImplicitNavierStokes<Tdim>::correction_matrix_;
+  //! Cached sparsity pattern of the correction matrix
+  using AssemblerEigenSemiImplicitNavierStokes<Tdim>::correction_pattern_;
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
   //! Coefficient matrix for two-phase predictor
   std::map<unsigned, Eigen::SparseMatrix<double>> predictor_lhs_matrix_;
+  //! Cached sparsity patterns of the two-phase predictor matrices
+  std::map<unsigned, typename AssemblerBase<Tdim>::SparsityPattern>
+      predictor_lhs_patterns_;
+  //! Poisson RHS matrix for solid
+  Eigen::SparseMatrix<double> solid_poisson_right_matrix_;
+  //! Cached sparsity pattern of the solid poisson RHS matrix
+  typename AssemblerBase<Tdim>::SparsityPattern solid_poisson_right_pattern_;
+  //! Poisson RHS matrix for liquid
+  Eigen::SparseMatrix<double> liquid_poisson_right_matrix_;
+  //! Cached sparsity pattern of the liquid poisson RHS matrix
+  typename AssemblerBase<Tdim>::SparsityPattern liquid_poisson_right_pattern_;
   //! RHS vector for two-phase predictor
   Eigen::MatrixXd predictor_rhs_vector_;
   //! Intermediate acceleration vector (each column represent one direction)
@@ -14,74 +14,58 @@ bool mpm::AssemblerEigenSemiImplicitTwoPhase<Tdim>::assemble_predictor_left(
     double dt) {
   bool status = true;
   try {
+    // Cell pointer
+    const auto& cells = mesh_->cells();
+    // Active nodes pointer
+    const auto& nodes = mesh_->active_nodes();
+
     // Loop over three direction
     for (unsigned dir = 0; dir < Tdim; dir++) {
-      // Initialise coefficient_matrix
-      Eigen::SparseMatrix<double> coefficient_matrix;
-      coefficient_matrix.setZero();
-
-      // Resize coefficient matrix
-      coefficient_matrix.resize(2 * active_dof_, 2 * active_dof_);
-
-      // Reserve storage for sparse matrix
-      coefficient_matrix.reserve(
-          Eigen::VectorXi::Constant(2 * active_dof_, 2 * sparse_row_size_));
-
-      // Cell pointer
-      const auto& cells = mesh_->cells();
-
-      // Iterate over cells for drag force coefficient
-      mpm::Index cid = 0;
-      for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend();
-           ++cell_itr) {
-        if ((*cell_itr)->status()) {
-          // Node ids in each cell
-          const auto nids = global_node_indices_.at(cid);
-          // Local drag matrix
-          auto cell_drag_matrix = (*cell_itr)->drag_matrix(dir);
-          // Assemble global coefficient matrix
-          for (unsigned i = 0; i < nids.size(); ++i) {
-            for (unsigned j = 0; j < nids.size(); ++j) {
-              coefficient_matrix.coeffRef(nids(i) + active_dof_, nids(j)) +=
-                  -cell_drag_matrix(i, j) * dt;
-              coefficient_matrix.coeffRef(nids(i) + active_dof_,
-                                          nids(j) + active_dof_) +=
-                  cell_drag_matrix(i, j) * dt;
+      // Coefficient matrix, reusing the pattern if unchanged
+      auto& coefficient_matrix = predictor_lhs_matrix_[dir];
+      this->assemble_sparse_matrix(
+          coefficient_matrix, predictor_lhs_patterns_[dir], 2 * active_dof_,
+          2 * active_dof_, [&](auto&& add) {
+            // Iterate over cells for drag force coefficient
+            mpm::Index cid = 0;
+            for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend();
+                 ++cell_itr) {
+              if ((*cell_itr)->status()) {
+                // Node ids in each cell
+                const auto& nids = global_node_indices_.at(cid);
+                // Local drag matrix
+                const auto& cell_drag_matrix = (*cell_itr)->drag_matrix(dir);
+                // Assemble global coefficient matrix
+                for (unsigned i = 0; i < nids.size(); ++i) {
+                  for (unsigned j = 0; j < nids.size(); ++j) {
+                    add(nids(i) + active_dof_, nids(j),
+                        -cell_drag_matrix(i, j) * dt);
+                    add(nids(i) + active_dof_, nids(j) + active_dof_,
+                        cell_drag_matrix(i, j) * dt);
+                  }
+                }
+                ++cid;
+              }
             }
-          }
-          ++cid;
-        }
-      }
 
-      // Active nodes pointer
-      const auto& nodes = mesh_->active_nodes();
-      // Iterate over cells for mass coefficient
-      for (auto node_itr = nodes.cbegin(); node_itr != nodes.cend();
-           ++node_itr) {
-        // Id for active node
-        auto active_id = (*node_itr)->active_id();
-        // Assemble global coefficient matrix for solid mass
-        coefficient_matrix.coeffRef(active_id, active_id) +=
-            (*node_itr)->mass(mpm::NodePhase::NSolid);
-        // Assemble global coefficient matrix for liquid mass
-        coefficient_matrix.coeffRef(active_id + active_dof_,
-                                    active_id + active_dof_) +=
-            (*node_itr)->mass(mpm::NodePhase::NLiquid);
-        coefficient_matrix.coeffRef(active_id, active_id + active_dof_) +=
-            (*node_itr)->mass(mpm::NodePhase::NLiquid);
-      }
+            // Iterate over nodes for mass coefficient
+            for (auto node_itr = nodes.cbegin(); node_itr != nodes.cend();
+                 ++node_itr) {
+              // Id for active node
+              const auto active_id = (*node_itr)->active_id();
+              // Assemble global coefficient matrix for solid mass
+              add(active_id, active_id,
+                  (*node_itr)->mass(mpm::NodePhase::NSolid));
+              // Assemble global coefficient matrix for liquid mass
+              add(active_id + active_dof_, active_id + active_dof_,
+                  (*node_itr)->mass(mpm::NodePhase::NLiquid));
+              add(active_id, active_id + active_dof_,
+                  (*node_itr)->mass(mpm::NodePhase::NLiquid));
+            }
+          });
 
       // Apply null-space treatment
       this->apply_null_space_treatment(coefficient_matrix, 2);
-
-      // Add coefficient matrix to map
-      if (predictor_lhs_matrix_.find(dir) != predictor_lhs_matrix_.end())
-        predictor_lhs_matrix_.erase(dir);
-
-      predictor_lhs_matrix_.insert(
-          std::make_pair<unsigned, Eigen::SparseMatrix<double>>(
-              static_cast<unsigned>(dir),
-              static_cast<Eigen::SparseMatrix<double>>(coefficient_matrix)));
     }
 
   } catch (std::exception& exception) {
@@ -142,58 +126,41 @@ bool mpm::AssemblerEigenSemiImplicitTwoPhase<Tdim>::assemble_poisson_right(
     double dt) {
   bool status = true;
   try {
-    // Initialise Poisson RHS matrix
-    Eigen::SparseMatrix<double> solid_poisson_right_matrix,
-        liquid_poisson_right_matrix;
-
-    // Resize poisson right matrix for solid
-    solid_poisson_right_matrix.resize(active_dof_, active_dof_ * Tdim);
-    solid_poisson_right_matrix.setZero();
-    // Resize poisson right matrix for liquid
-    liquid_poisson_right_matrix.resize(active_dof_, active_dof_ * Tdim);
-    liquid_poisson_right_matrix.setZero();
-
-    // Reserve storage for sparse matrix
-    solid_poisson_right_matrix.reserve(
-        Eigen::VectorXi::Constant(active_dof_ * Tdim, sparse_row_size_));
-    liquid_poisson_right_matrix.reserve(
-        Eigen::VectorXi::Constant(active_dof_ * Tdim, sparse_row_size_));
-
     // Cell pointer
     const auto& cells = mesh_->cells();
 
-    // Iterate over cells
-    mpm::Index cid = 0;
-    for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend(); ++cell_itr) {
-      if ((*cell_itr)->status()) {
-        // Node ids in each cell
-        const auto nids = global_node_indices_.at(cid);
-
-        // Local Poisson RHS matrix for solid
-        auto cell_poisson_right_solid =
-            (*cell_itr)->poisson_right_matrix(mpm::NodePhase::NSolid);
-        // Local Poisson RHS matrix for liquid
-        auto cell_poisson_right_liquid =
-            (*cell_itr)->poisson_right_matrix(mpm::NodePhase::NLiquid);
-
-        // Assemble global poisson RHS matrix
-        for (unsigned i = 0; i < nids.size(); ++i) {
-          for (unsigned j = 0; j < nids.size(); ++j) {
-            for (unsigned k = 0; k < Tdim; ++k) {
-              solid_poisson_right_matrix.coeffRef(
-                  global_node_indices_.at(cid)(i),
-                  global_node_indices_.at(cid)(j) + k * active_dof_) +=
-                  cell_poisson_right_solid(i, j + k * nids.size());
-              liquid_poisson_right_matrix.coeffRef(
-                  global_node_indices_.at(cid)(i),
-                  global_node_indices_.at(cid)(j) + k * active_dof_) +=
-                  cell_poisson_right_liquid(i, j + k * nids.size());
-            }
+    // Assemble global poisson RHS matrix of a phase, reusing the pattern if
+    // unchanged
+    const auto assemble_poisson_right_phase = [&](unsigned phase) {
+      return [&, phase](auto&& add) {
+        // Iterate over cells
+        mpm::Index cid = 0;
+        for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend();
+             ++cell_itr) {
+          if ((*cell_itr)->status()) {
+            // Node ids in each cell
+            const auto& nids = global_node_indices_.at(cid);
+            // Local Poisson RHS matrix of the phase
+            const auto& cell_poisson_right =
+                (*cell_itr)->poisson_right_matrix(phase);
+            for (unsigned i = 0; i < nids.size(); ++i)
+              for (unsigned j = 0; j < nids.size(); ++j)
+                for (unsigned k = 0; k < Tdim; ++k)
+                  add(nids(i), nids(j) + k * active_dof_,
+                      cell_poisson_right(i, j + k * nids.size()));
+            cid++;
           }
         }
-        cid++;
-      }
-    }
+      };
+    };
+    this->assemble_sparse_matrix(
+        solid_poisson_right_matrix_, solid_poisson_right_pattern_, active_dof_,
+        active_dof_ * Tdim,
+        assemble_poisson_right_phase(mpm::NodePhase::NSolid));
+    this->assemble_sparse_matrix(
+        liquid_poisson_right_matrix_, liquid_poisson_right_pattern_,
+        active_dof_, active_dof_ * Tdim,
+        assemble_poisson_right_phase(mpm::NodePhase::NLiquid));
 
     // Resize poisson right vector
     poisson_rhs_vector_.resize(active_dof_);
@@ -225,8 +192,8 @@ bool mpm::AssemblerEigenSemiImplicitTwoPhase<Tdim>::assemble_poisson_right(
     liquid_velocity.resize(active_dof_ * Tdim, 1);
 
     // Compute poisson RHS vector
-    poisson_rhs_vector_ = -(solid_poisson_right_matrix * solid_velocity) -
-                          (liquid_poisson_right_matrix * liquid_velocity);
+    poisson_rhs_vector_ = -(solid_poisson_right_matrix_ * solid_velocity) -
+                          (liquid_poisson_right_matrix_ * liquid_velocity);
 
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
@@ -241,48 +208,43 @@ bool mpm::AssemblerEigenSemiImplicitTwoPhase<Tdim>::assemble_corrector_right(
     double dt) {
   bool status = true;
   try {
-    // Resize correction matrix
-    correction_matrix_.resize(2 * active_dof_, active_dof_ * Tdim);
-    correction_matrix_.setZero();
-
-    // Reserve storage for sparse matrix
-    correction_matrix_.reserve(
-        Eigen::VectorXi::Constant(active_dof_ * Tdim, 2 * sparse_row_size_));
-
     // Cell pointer
     const auto& cells = mesh_->cells();
 
-    // Iterate over cells
-    unsigned cid = 0;
-    for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend(); ++cell_itr) {
-      if ((*cell_itr)->status()) {
-        // Number of nodes in cell
-        unsigned nnodes_per_cell = global_node_indices_.at(cid).size();
-        // Local correction matrix for solid
-        auto correction_matrix_solid =
-            (*cell_itr)->correction_matrix(mpm::NodePhase::NSolid);
-        // Local correction matrix for liquid
-        auto coefficient_matrix_liquid =
-            (*cell_itr)->correction_matrix(mpm::NodePhase::NLiquid);
-        for (unsigned k = 0; k < Tdim; k++) {
-          for (unsigned i = 0; i < nnodes_per_cell; i++) {
-            for (unsigned j = 0; j < nnodes_per_cell; j++) {
-              // Solid phase
-              correction_matrix_.coeffRef(
-                  global_node_indices_.at(cid)(i),
-                  k * active_dof_ + global_node_indices_.at(cid)(j)) +=
-                  correction_matrix_solid(i, j + k * nnodes_per_cell);
-              // Liquid phase
-              correction_matrix_.coeffRef(
-                  global_node_indices_.at(cid)(i) + active_dof_,
-                  k * active_dof_ + global_node_indices_.at(cid)(j)) +=
-                  coefficient_matrix_liquid(i, j + k * nnodes_per_cell);
+    // Assemble correction matrix, reusing the pattern if unchanged
+    this->assemble_sparse_matrix(
+        correction_matrix_, correction_pattern_, 2 * active_dof_,
+        active_dof_ * Tdim, [&](auto&& add) {
+          // Iterate over cells
+          unsigned cid = 0;
+          for (auto cell_itr = cells.cbegin(); cell_itr != cells.cend();
+               ++cell_itr) {
+            if ((*cell_itr)->status()) {
+              const auto& nids = global_node_indices_.at(cid);
+              // Number of nodes in cell
+              const unsigned nnodes_per_cell = nids.size();
+              // Local correction matrix for solid
+              const auto& correction_matrix_solid =
+                  (*cell_itr)->correction_matrix(mpm::NodePhase::NSolid);
+              // Local correction matrix for liquid
+              const auto& correction_matrix_liquid =
+                  (*cell_itr)->correction_matrix(mpm::NodePhase::NLiquid);
+              for (unsigned k = 0; k < Tdim; k++) {
+                for (unsigned i = 0; i < nnodes_per_cell; i++) {
+                  for (unsigned j = 0; j < nnodes_per_cell; j++) {
+                    // Solid phase
+                    add(nids(i), k * active_dof_ + nids(j),
+                        correction_matrix_solid(i, j + k * nnodes_per_cell));
+                    // Liquid phase
+                    add(nids(i) + active_dof_, k * active_dof_ + nids(j),
+                        correction_matrix_liquid(i, j + k * nnodes_per_cell));
+                  }
+                }
+              }
+              cid++;
             }
           }
-        }
-        cid++;
-      }
-    }
+        });
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
     status = false;
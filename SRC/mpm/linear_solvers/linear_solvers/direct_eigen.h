@@ -1,7 +1,9 @@
 #ifndef MPM_DIRECT_EIGEN_H_
 #define MPM_DIRECT_EIGEN_H_
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "factory.h"
 #include "solver_base.h"
@@ -44,12 +46,27 @@ class DirectEigen : public SolverBase<Traits> {
       const std::vector<int>& rank_global_mapper) override {}
 
  protected:
+  //! Return true if the pattern of A differs from the analysed pattern, and
+  //! store the pattern of A
+  //! \param[in] A Coefficient matrix
+  bool pattern_changed(const Eigen::SparseMatrix<double>& A);
+
   //! Solver type
   using SolverBase<Traits>::sub_solver_type_;
   //! Verbosity
   using SolverBase<Traits>::verbosity_;
   //! Logger
   using SolverBase<Traits>::console_;
+  //! LU solver, keeps the symbolic analysis between solves
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> lu_solver_;
+  //! LDLT solver, keeps the symbolic analysis between solves
+  Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt_solver_;
+  //! Sub solver type of the stored symbolic analysis
+  std::string analysed_solver_type_;
+  //! Outer indices of the analysed pattern
+  std::vector<Eigen::SparseMatrix<double>::StorageIndex> analysed_outer_;
+  //! Inner indices of the analysed pattern
+  std::vector<Eigen::SparseMatrix<double>::StorageIndex> analysed_inner_;
 };
 }  // namespace mpm
 
@@ -15,26 +15,27 @@ Eigen::VectorXd mpm::DirectEigen<Traits>::solve(
       std::cout << "RHS Vector b: " << b << std::endl;
     }
 
-    if (sub_solver_type_ == "lu") {
-      Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
+    // Symbolic analysis is only redone if the sparsity pattern has changed
+    const bool analyse = this->pattern_changed(A);
 
-      solver.analyzePattern(A);
-      solver.factorize(A);
+    if (sub_solver_type_ == "lu") {
+      if (analyse) lu_solver_.analyzePattern(A);
+      lu_solver_.factorize(A);
 
-      x = solver.solve(b);
+      x = lu_solver_.solve(b);
 
-      if (solver.info() != Eigen::Success) {
+      if (lu_solver_.info() != Eigen::Success) {
+        analysed_solver_type_.clear();
         throw std::runtime_error("Fail to solve linear systems!\n");
       }
     } else if (sub_solver_type_ == "ldlt") {
-      Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver;
-
-      solver.analyzePattern(A);
-      solver.factorize(A);
+      if (analyse) ldlt_solver_.analyzePattern(A);
+      ldlt_solver_.factorize(A);
 
-      x = solver.solve(b);
+      x = ldlt_solver_.solve(b);
 
-      if (solver.info() != Eigen::Success) {
+      if (ldlt_solver_.info() != Eigen::Success) {
+        analysed_solver_type_.clear();
         throw std::runtime_error("Fail to solve linear systems!\n");
       }
     } else {
@@ -55,4 +56,35 @@ Eigen::VectorXd mpm::DirectEigen<Traits>::solve(
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
   return x;
-}
\ No newline at end of file
+}
+
+//! Check if the pattern of A differs from the analysed pattern
+template <typename Traits>
+bool mpm::DirectEigen<Traits>::pattern_changed(
+    const Eigen::SparseMatrix<double>& A) {
+  // Compressed storage is required to compare patterns
+  const bool compressed = A.isCompressed();
+  const auto nouter = A.outerSize() + 1;
+  const auto ninner = A.nonZeros();
+  const auto* outer = A.outerIndexPtr();
+  const auto* inner = A.innerIndexPtr();
+
+  bool changed = !compressed || analysed_solver_type_ != sub_solver_type_ ||
+                 analysed_outer_.size() != static_cast<std::size_t>(nouter) ||
+                 analysed_inner_.size() != static_cast<std::size_t>(ninner) ||
+                 !std::equal(outer, outer + nouter, analysed_outer_.begin()) ||
+                 !std::equal(inner, inner + ninner, analysed_inner_.begin());
+
+  if (changed) {
+    if (compressed) {
+      analysed_outer_.assign(outer, outer + nouter);
+      analysed_inner_.assign(inner, inner + ninner);
+      analysed_solver_type_ = sub_solver_type_;
+    } else {
+      analysed_outer_.clear();
+      analysed_inner_.clear();
+      analysed_solver_type_.clear();
+    }
+  }
+  return changed;
+}
@@ -0,0 +1,182 @@
+#ifndef MPM_MULTIGRID_EIGEN_H_
+#define MPM_MULTIGRID_EIGEN_H_
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "factory.h"
+#include "solver_base.h"
+#include <Eigen/Sparse>
+#include <Eigen/SparseLU>
+
+namespace mpm {
+
+//! MPM Multigrid Eigen solver class
+//! \brief Krylov solver preconditioned by an aggregation multigrid V-cycle
+//! \details The multigrid hierarchy is built from the connectivity of the
+//! background grid stored in the coefficient matrix, and is kept between
+//! solves as long as the sparsity pattern does not change. Krylov iterations,
+//! smoothers and grid transfers are OpenMP parallel and do not need PETSc.
+template <typename Traits>
+class MultigridEigen : public SolverBase<Traits> {
+ public:
+  //! Constructor
+  //! \param[in] max_iter Maximum number of iterations
+  //! \param[in] tolerance Tolerance for solver to achieve convergence
+  MultigridEigen(unsigned max_iter, double tolerance)
+      : mpm::SolverBase<Traits>(max_iter, tolerance) {
+    //! Logger
+    std::string logger = "EigenMultigridSolver::";
+    console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
+    //! Default sub solver type
+    sub_solver_type_ = "cg";
+    //! Default preconditioner type
+    preconditioner_type_ = "multigrid";
+  };
+
+  //! Destructor
+  ~MultigridEigen(){};
+
+  //! Matrix solver with default initial guess
+  Eigen::VectorXd solve(const Eigen::SparseMatrix<double>& A,
+                        const Eigen::VectorXd& b) override;
+
+  //! Return the type of solver
+  std::string solver_type() const { return "EigenMultigrid"; }
+
+  //! Assign global active dof
+  void assign_global_active_dof(unsigned global_active_dof) override {}
+
+  //! Assign rank to global mapper
+  void assign_rank_global_mapper(
+      const std::vector<int>& rank_global_mapper) override {}
+
+ protected:
+  //! Row major sparse matrix used by the parallel kernels
+  using RowMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
+  //! Multigrid level
+  struct Level {
+    //! Coefficient matrix
+    RowMatrix A;
+    //! Prolongation from the next coarser level
+    RowMatrix P;
+    //! Restriction to the next coarser level
+    RowMatrix R;
+    //! Inverse of the diagonal
+    Eigen::VectorXd inv_diag;
+    //! Damping of the Jacobi smoother
+    double omega{2. / 3.};
+    //! Solution, right hand side and residual workspace
+    Eigen::VectorXd x, b, r;
+  };
+
+  //! Return true if the pattern of A differs from the analysed pattern, and
+  //! store the pattern of A
+  //! \param[in] A Coefficient matrix
+  bool pattern_changed(const Eigen::SparseMatrix<double>& A);
+
+  //! Build aggregates, prolongations and coarse operators
+  //! \param[in] A Coefficient matrix
+  void setup_hierarchy(const Eigen::SparseMatrix<double>& A);
+
+  //! Recompute coarse operators of the stored hierarchy for new values of A
+  //! \param[in] A Coefficient matrix with the analysed pattern
+  void update_hierarchy(const Eigen::SparseMatrix<double>& A);
+
+  //! Compute inverse diagonal and Jacobi damping of a level
+  //! \param[in] level Multigrid level
+  void update_smoother(Level& level) const;
+
+  //! Group strongly connected nodes into aggregates
+  //! \param[in] A Coefficient matrix
+  //! \param[out] naggregates Number of aggregates
+  //! \retval aggregates Aggregate of each row, -1 for isolated rows
+  std::vector<Eigen::Index> aggregate(const RowMatrix& A,
+                                      Eigen::Index* naggregates) const;
+
+  //! Smoothed aggregation prolongation
+  //! \param[in] level Fine level
+  //! \param[in] aggregates Aggregate of each row
+  //! \param[in] naggregates Number of aggregates
+  RowMatrix prolongation(const Level& level,
+                         const std::vector<Eigen::Index>& aggregates,
+                         Eigen::Index naggregates) const;
+
+  //! Apply the preconditioner z = M^-1 r
+  //! \param[in] r Residual
+  //! \param[out] z Preconditioned residual
+  void precondition(const Eigen::VectorXd& r, Eigen::VectorXd& z);
+
+  //! Multigrid V-cycle starting at a level
+  //! \param[in] l Level index
+  void vcycle(unsigned l);
+
+  //! Weighted Jacobi sweeps on a level
+  //! \param[in] level Multigrid level
+  void smooth(Level& level) const;
+
+  //! Preconditioned conjugate gradient
+  //! \param[in] A Coefficient matrix
+  //! \param[in] b Right hand side vector
+  //! \param[in,out] x Solution, zero initial guess
+  //! \param[out] niterations Number of iterations
+  //! \retval converged Convergence status
+  bool cg(const RowMatrix& A, const Eigen::VectorXd& b, Eigen::VectorXd& x,
+          unsigned* niterations);
+
+  //! Right preconditioned BiCGSTAB
+  //! \param[in] A Coefficient matrix
+  //! \param[in] b Right hand side vector
+  //! \param[in,out] x Solution, zero initial guess
+  //! \param[out] niterations Number of iterations
+  //! \retval converged Convergence status
+  bool bicgstab(const RowMatrix& A, const Eigen::VectorXd& b,
+                Eigen::VectorXd& x, unsigned* niterations);
+
+  //! Parallel sparse matrix vector product y = A x
+  static void multiply(const RowMatrix& A, const Eigen::VectorXd& x,
+                       Eigen::VectorXd& y);
+
+  //! Parallel residual r = b - A x
+  static void residual(const RowMatrix& A, const Eigen::VectorXd& x,
+                       const Eigen::VectorXd& b, Eigen::VectorXd& r);
+
+  //! Parallel dot product
+  static double dot(const Eigen::VectorXd& a, const Eigen::VectorXd& b);
+
+  //! Solver type
+  using SolverBase<Traits>::sub_solver_type_;
+  //! Preconditioner type
+  using SolverBase<Traits>::preconditioner_type_;
+  //! Maximum number of iterations
+  using SolverBase<Traits>::max_iter_;
+  //! Tolerance
+  using SolverBase<Traits>::tolerance_;
+  //! Verbosity
+  using SolverBase<Traits>::verbosity_;
+  //! Logger
+  std::unique_ptr<spdlog::logger> console_;
+  //! Multigrid levels, finest first
+  std::vector<Level> levels_;
+  //! Direct solver of the coarsest level
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> coarse_solver_;
+  //! Outer indices of the analysed pattern
+  std::vector<Eigen::SparseMatrix<double>::StorageIndex> analysed_outer_;
+  //! Inner indices of the analysed pattern
+  std::vector<Eigen::SparseMatrix<double>::StorageIndex> analysed_inner_;
+  //! Maximum number of levels
+  unsigned max_levels_{10};
+  //! Size below which a level is solved directly
+  Eigen::Index coarse_size_{500};
+  //! Number of pre and post smoothing sweeps
+  unsigned nsweeps_{2};
+  //! Strength of connection threshold
+  double strength_threshold_{0.08};
+};
+}  // namespace mpm
+
+#include "multigrid_eigen.tcc"
+
+#endif  // MPM_MULTIGRID_EIGEN_H_
@@ -0,0 +1,474 @@
+//! Multigrid preconditioned Krylov solver with default initial guess
+template <typename Traits>
+Eigen::VectorXd mpm::MultigridEigen<Traits>::solve(
+    const Eigen::SparseMatrix<double>& A, const Eigen::VectorXd& b) {
+  Eigen::VectorXd x;
+  try {
+
+    // Solver start
+    auto solver_begin = std::chrono::steady_clock::now();
+    if (verbosity_ > 0)
+      console_->info("Type: \"{}\", Preconditioner: \"{}\", Begin!",
+                     sub_solver_type_, preconditioner_type_);
+
+    if (verbosity_ == 3) {
+      std::cout << "Coefficient Matrix A: " << A << std::endl;
+      std::cout << "RHS Vector b: " << b << std::endl;
+    }
+
+    if (preconditioner_type_ != "multigrid" &&
+        preconditioner_type_ != "jacobi" && preconditioner_type_ != "none")
+      throw std::runtime_error(
+          "Preconditioner type is not available! Available preconditioner "
+          "type implemented in MultigridEigen class are: \"multigrid\", "
+          "\"jacobi\", and \"none\".\n");
+
+    // Hierarchy is rebuilt only when the sparsity pattern changes
+    if (this->pattern_changed(A) || levels_.empty())
+      this->setup_hierarchy(A);
+    else
+      this->update_hierarchy(A);
+
+    if (verbosity_ >= 1)
+      std::cout << "#levels:         " << levels_.size() << std::endl;
+
+    x.setZero(A.cols());
+    unsigned niterations = 0;
+    bool converged = false;
+    if (sub_solver_type_ == "cg")
+      converged = this->cg(levels_.front().A, b, x, &niterations);
+    else if (sub_solver_type_ == "bicgstab")
+      converged = this->bicgstab(levels_.front().A, b, x, &niterations);
+    else
+      throw std::runtime_error(
+          "Sub solver type is not available! Available sub solver type "
+          "implemented in MultigridEigen class are: \"cg\" and "
+          "\"bicgstab\".\n");
+
+    if (verbosity_ >= 1)
+      std::cout << "#iterations:     " << niterations << std::endl;
+
+    if (!converged) throw std::runtime_error("Fail to solve linear systems!\n");
+
+    // Solver End
+    auto solver_end = std::chrono::steady_clock::now();
+    if (verbosity_ > 0)
+      console_->info(
+          "Type: \"{}\", Preconditioner: \"{}\", End! Duration: {} ms.",
+          sub_solver_type_, preconditioner_type_,
+          std::chrono::duration_cast<std::chrono::milliseconds>(solver_end -
+                                                                solver_begin)
+              .count());
+
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+  }
+  return x;
+}
+
+//! Check and store the sparsity pattern of the coefficient matrix
+template <typename Traits>
+bool mpm::MultigridEigen<Traits>::pattern_changed(
+    const Eigen::SparseMatrix<double>& A) {
+  // Compressed storage is required to compare patterns
+  const bool compressed = A.isCompressed();
+  const auto nouter = A.outerSize() + 1;
+  const auto ninner = A.nonZeros();
+  const auto* outer = A.outerIndexPtr();
+  const auto* inner = A.innerIndexPtr();
+
+  bool changed = !compressed ||
+                 analysed_outer_.size() != static_cast<std::size_t>(nouter) ||
+                 analysed_inner_.size() != static_cast<std::size_t>(ninner) ||
+                 !std::equal(outer, outer + nouter, analysed_outer_.begin()) ||
+                 !std::equal(inner, inner + ninner, analysed_inner_.begin());
+
+  if (changed) {
+    if (compressed) {
+      analysed_outer_.assign(outer, outer + nouter);
+      analysed_inner_.assign(inner, inner + ninner);
+    } else {
+      analysed_outer_.clear();
+      analysed_inner_.clear();
+    }
+  }
+  return changed;
+}
+
+//! Build the multigrid hierarchy
+template <typename Traits>
+void mpm::MultigridEigen<Traits>::setup_hierarchy(
+    const Eigen::SparseMatrix<double>& A) {
+  levels_.clear();
+  levels_.emplace_back();
+  levels_.back().A = A;
+
+  while (true) {
+    Level& fine = levels_.back();
+    this->update_smoother(fine);
+
+    // Only the finest level is needed without multigrid
+    if (preconditioner_type_ != "multigrid") break;
+    if (fine.A.rows() <= coarse_size_ || levels_.size() >= max_levels_) break;
+
+    Eigen::Index naggregates = 0;
+    const auto aggregates = this->aggregate(fine.A, &naggregates);
+    // Stop when coarsening stagnates
+    if (naggregates == 0 || 10 * naggregates > 9 * fine.A.rows()) break;
+
+    fine.P = this->prolongation(fine, aggregates, naggregates);
+    fine.R = fine.P.transpose();
+
+    RowMatrix coarse_A = fine.R * fine.A * fine.P;
+    levels_.emplace_back();
+    levels_.back().A = std::move(coarse_A);
+  }
+
+  // Workspace
+  for (auto& level : levels_) {
+    level.x.resize(level.A.rows());
+    level.b.resize(level.A.rows());
+    level.r.resize(level.A.rows());
+  }
+
+  if (preconditioner_type_ == "multigrid") {
+    coarse_solver_.compute(Eigen::SparseMatrix<double>(levels_.back().A));
+    if (coarse_solver_.info() != Eigen::Success)
+      throw std::runtime_error("Fail to factorize the coarsest level!\n");
+  }
+
+  if (verbosity_ >= 2)
+    for (unsigned l = 0; l < levels_.size(); ++l)
+      console_->info("Level {}: {} rows, {} nonzeros", l, levels_[l].A.rows(),
+                     levels_[l].A.nonZeros());
+}
+
+//! Update coarse operators of the stored hierarchy
+template <typename Traits>
+void mpm::MultigridEigen<Traits>::update_hierarchy(
+    const Eigen::SparseMatrix<double>& A) {
+  // Prolongations are kept from the setup, only the Galerkin products are
+  // recomputed with the new coefficients
+  levels_.front().A = A;
+  for (unsigned l = 0; l < levels_.size(); ++l) {
+    this->update_smoother(levels_[l]);
+    if (l + 1 < levels_.size())
+      levels_[l + 1].A = levels_[l].R * levels_[l].A * levels_[l].P;
+  }
+
+  if (preconditioner_type_ == "multigrid") {
+    coarse_solver_.compute(Eigen::SparseMatrix<double>(levels_.back().A));
+    if (coarse_solver_.info() != Eigen::Success)
+      throw std::runtime_error("Fail to factorize the coarsest level!\n");
+  }
+}
+
+//! Inverse diagonal and Jacobi damping
+template <typename Traits>
+void mpm::MultigridEigen<Traits>::update_smoother(Level& level) const {
+  const Eigen::Index nrows = level.A.rows();
+  level.inv_diag.setZero(nrows);
+#pragma omp parallel for schedule(runtime)
+  for (Eigen::Index i = 0; i < nrows; ++i) {
+    for (typename RowMatrix::InnerIterator it(level.A, i); it; ++it) {
+      if (it.index() == i && it.value() != 0.) {
+        level.inv_diag[i] = 1. / it.value();
+        break;
+      }
+    }
+  }
+
+  // Estimate the spectral radius of D^-1 A by power iterations, damping is
+  // 4 / (3 rho) which gives 2/3 for the Laplacian
+  Eigen::VectorXd v(nrows), w(nrows);
+  for (Eigen::Index i = 0; i < nrows; ++i) v[i] = 1. + (i % 7) / 7.;
+  double rho = 0.;
+  for (unsigned iter = 0; iter < 10; ++iter) {
+    const double vnorm = std::sqrt(dot(v, v));
+    if (vnorm == 0.) break;
+    v /= vnorm;
+    multiply(level.A, v, w);
+    w.array() *= level.inv_diag.array();
+    rho = std::sqrt(dot(w, w));
+    v.swap(w);
+  }
+  level.omega = (rho > 0.) ? 4. / (3. * rho) : 2. / 3.;
+}
+
+//! Aggregation of strongly connected rows
+template <typename Traits>
+std::vector<Eigen::Index> mpm::MultigridEigen<Traits>::aggregate(
+    const RowMatrix& A, Eigen::Index* naggregates) const {
+  const Eigen::Index nrows = A.rows();
+  const Eigen::Index isolated = -1;
+  const Eigen::Index unassigned = -2;
+
+  Eigen::VectorXd diag = A.diagonal();
+  const double theta2 = strength_threshold_ * strength_threshold_;
+  auto strong = [&](Eigen::Index i, Eigen::Index j, double value) {
+    return i != j && value * value >= theta2 * std::abs(diag[i] * diag[j]);
+  };
+
+  // Rows without strong connections are solved by the smoother alone
+  std::vector<Eigen::Index> aggregates(nrows, isolated);
+  for (Eigen::Index i = 0; i < nrows; ++i)
+    for (typename RowMatrix::InnerIterator it(A, i); it; ++it)
+      if (strong(i, it.index(), it.value())) {
+        aggregates[i] = unassigned;
+        break;
+      }
+
+  Eigen::Index nagg = 0;
+  // Seed aggregates with rows whose strong neighbours are all free, on a
+  // structured grid this groups neighbouring nodes as a geometric coarsening
+  for (Eigen::Index i = 0; i < nrows; ++i) {
+    if (aggregates[i] != unassigned) continue;
+    bool free = true;
+    for (typename RowMatrix::InnerIterator it(A, i); it && free; ++it)
+      if (strong(i, it.index(), it.value()) &&
+          aggregates[it.index()] != unassigned)
+        free = false;
+    if (!free) continue;
+    aggregates[i] = nagg;
+    for (typename RowMatrix::InnerIterator it(A, i); it; ++it)
+      if (strong(i, it.index(), it.value())) aggregates[it.index()] = nagg;
+    ++nagg;
+  }
+
+  // Attach remaining rows to a neighbouring aggregate
+  std::vector<Eigen::Index> seeded(aggregates);
+  for (Eigen::Index i = 0; i < nrows; ++i) {
+    if (aggregates[i] != unassigned) continue;
+    for (typename RowMatrix::InnerIterator it(A, i); it; ++it)
+      if (strong(i, it.index(), it.value()) && seeded[it.index()] >= 0) {
+        aggregates[i] = seeded[it.index()];
+        break;
+      }
+  }
+
+  // Group whatever is left with its free neighbours
+  for (Eigen::Index i = 0; i < nrows; ++i) {
+    if (aggregates[i] != unassigned) continue;
+    aggregates[i] = nagg;
+    for (typename RowMatrix::InnerIterator it(A, i); it; ++it)
+      if (strong(i, it.index(), it.value()) &&
+          aggregates[it.index()] == unassigned)
+        aggregates[it.index()] = nagg;
+    ++nagg;
+  }
+
+  *naggregates = nagg;
+  return aggregates;
+}
+
+//! Smoothed aggregation prolongation P = (I - omega D^-1 A) P0
+template <typename Traits>
+typename mpm::MultigridEigen<Traits>::RowMatrix
+    mpm::MultigridEigen<Traits>::prolongation(
+        const Level& level, const std::vector<Eigen::Index>& aggregates,
+        Eigen::Index naggregates) const {
+  const Eigen::Index nrows = level.A.rows();
+
+  // Tentative piecewise constant prolongation
+  RowMatrix tentative(nrows, naggregates);
+  tentative.reserve(Eigen::VectorXi::Ones(nrows));
+  for (Eigen::Index i = 0; i < nrows; ++i)
+    if (aggregates[i] >= 0) tentative.insert(i, aggregates[i]) = 1.;
+  tentative.makeCompressed();
+
+  RowMatrix smoother = level.inv_diag.asDiagonal() * level.A;
+  RowMatrix smoothed = smoother * tentative;
+  RowMatrix P = tentative - level.omega * smoothed;
+  P.prune(0.);
+  return P;
+}
+
+//! Preconditioner
+template <typename Traits>
+void mpm::MultigridEigen<Traits>::precondition(const Eigen::VectorXd& r,
+                                               Eigen::VectorXd& z) {
+  Level& fine = levels_.front();
+  const Eigen::Index nrows = r.size();
+  if (preconditioner_type_ == "multigrid") {
+    fine.b = r;
+    this->vcycle(0);
+    z = fine.x;
+  } else if (preconditioner_type_ == "jacobi") {
+    z.resize(nrows);
+#pragma omp parallel for schedule(runtime)
+    for (Eigen::Index i = 0; i < nrows; ++i)
+      z[i] = (fine.inv_diag[i] != 0.) ? fine.inv_diag[i] * r[i] : r[i];
+  } else {
+    z = r;
+  }
+}
+
+//! V-cycle
+template <typename Traits>
+void mpm::MultigridEigen<Traits>::vcycle(unsigned l) {
+  Level& level = levels_[l];
+  if (l + 1 == levels_.size()) {
+    level.x = coarse_solver_.solve(level.b);
+    return;
+  }
+
+  // Pre smoothing
+  level.x.setZero();
+  this->smooth(level);
+
+  // Coarse grid correction
+  Level& coarse = levels_[l + 1];
+  residual(level.A, level.x, level.b, level.r);
+  multiply(level.R, level.r, coarse.b);
+  this->vcycle(l + 1);
+  multiply(level.P, coarse.x, level.r);
+  const Eigen::Index nrows = level.x.size();
+#pragma omp parallel for schedule(runtime)
+  for (Eigen::Index i = 0; i < nrows; ++i) level.x[i] += level.r[i];
+
+  // Post smoothing
+  this->smooth(level);
+}
+
+//! Weighted Jacobi smoother
+template <typename Traits>
+void mpm::MultigridEigen<Traits>::smooth(Level& level) const {
+  const Eigen::Index nrows = level.x.size();
+  for (unsigned sweep = 0; sweep < nsweeps_; ++sweep) {
+    residual(level.A, level.x, level.b, level.r);
+#pragma omp parallel for schedule(runtime)
+    for (Eigen::Index i = 0; i < nrows; ++i)
+      level.x[i] += level.omega * level.inv_diag[i] * level.r[i];
+  }
+}
+
+//! Preconditioned conjugate gradient
+template <typename Traits>
+bool mpm::MultigridEigen<Traits>::cg(const RowMatrix& A,
+                                     const Eigen::VectorXd& b,
+                                     Eigen::VectorXd& x,
+                                     unsigned* niterations) {
+  const Eigen::Index nrows = b.size();
+  const double bnorm = std::sqrt(dot(b, b));
+  *niterations = 0;
+  if (bnorm == 0.) return true;
+
+  Eigen::VectorXd r = b, z(nrows), p(nrows), q(nrows);
+  this->precondition(r, z);
+  p = z;
+  double rz = dot(r, z);
+
+  for (unsigned iter = 0; iter < max_iter_; ++iter) {
+    multiply(A, p, q);
+    const double alpha = rz / dot(p, q);
+#pragma omp parallel for schedule(runtime)
+    for (Eigen::Index i = 0; i < nrows; ++i) {
+      x[i] += alpha * p[i];
+      r[i] -= alpha * q[i];
+    }
+    *niterations = iter + 1;
+    if (std::sqrt(dot(r, r)) <= tolerance_ * bnorm) return true;
+
+    this->precondition(r, z);
+    const double rz_new = dot(r, z);
+    const double beta = rz_new / rz;
+    rz = rz_new;
+#pragma omp parallel for schedule(runtime)
+    for (Eigen::Index i = 0; i < nrows; ++i) p[i] = z[i] + beta * p[i];
+  }
+  return false;
+}
+
+//! Right preconditioned BiCGSTAB
+template <typename Traits>
+bool mpm::MultigridEigen<Traits>::bicgstab(const RowMatrix& A,
+                                           const Eigen::VectorXd& b,
+                                           Eigen::VectorXd& x,
+                                           unsigned* niterations) {
+  const Eigen::Index nrows = b.size();
+  const double bnorm = std::sqrt(dot(b, b));
+  *niterations = 0;
+  if (bnorm == 0.) return true;
+
+  Eigen::VectorXd r = b, r0 = b, p = Eigen::VectorXd::Zero(nrows),
+                  v = Eigen::VectorXd::Zero(nrows), y(nrows), s(nrows),
+                  z(nrows), t(nrows);
+  double rho = 1., alpha = 1., omega = 1.;
+
+  for (unsigned iter = 0; iter < max_iter_; ++iter) {
+    *niterations = iter + 1;
+    const double rho_new = dot(r0, r);
+    if (rho_new == 0.) return false;
+    const double beta = (rho_new / rho) * (alpha / omega);
+    rho = rho_new;
+#pragma omp parallel for schedule(runtime)
+    for (Eigen::Index i = 0; i < nrows; ++i)
+      p[i] = r[i] + beta * (p[i] - omega * v[i]);
+
+    this->precondition(p, y);
+    multiply(A, y, v);
+    alpha = rho / dot(r0, v);
+#pragma omp parallel for schedule(runtime)
+    for (Eigen::Index i = 0; i < nrows; ++i) s[i] = r[i] - alpha * v[i];
+    if (std::sqrt(dot(s, s)) <= tolerance_ * bnorm) {
+      x += alpha * y;
+      return true;
+    }
+
+    this->precondition(s, z);
+    multiply(A, z, t);
+    omega = dot(t, s) / dot(t, t);
+#pragma omp parallel for schedule(runtime)
+    for (Eigen::Index i = 0; i < nrows; ++i) {
+      x[i] += alpha * y[i] + omega * z[i];
+      r[i] = s[i] - omega * t[i];
+    }
+    if (std::sqrt(dot(r, r)) <= tolerance_ * bnorm) return true;
+    if (omega == 0.) return false;
+  }
+  return false;
+}
+
+//! Parallel sparse matrix vector product
+template <typename Traits>
+void mpm::MultigridEigen<Traits>::multiply(const RowMatrix& A,
+                                           const Eigen::VectorXd& x,
+                                           Eigen::VectorXd& y) {
+  const Eigen::Index nrows = A.rows();
+  y.resize(nrows);
+#pragma omp parallel for schedule(runtime)
+  for (Eigen::Index i = 0; i < nrows; ++i) {
+    double sum = 0.;
+    for (typename RowMatrix::InnerIterator it(A, i); it; ++it)
+      sum += it.value() * x[it.index()];
+    y[i] = sum;
+  }
+}
+
+//! Parallel residual
+template <typename Traits>
+void mpm::MultigridEigen<Traits>::residual(const RowMatrix& A,
+                                           const Eigen::VectorXd& x,
+                                           const Eigen::VectorXd& b,
+                                           Eigen::VectorXd& r) {
+  const Eigen::Index nrows = A.rows();
+  r.resize(nrows);
+#pragma omp parallel for schedule(runtime)
+  for (Eigen::Index i = 0; i < nrows; ++i) {
+    double sum = b[i];
+    for (typename RowMatrix::InnerIterator it(A, i); it; ++it)
+      sum -= it.value() * x[it.index()];
+    r[i] = sum;
+  }
+}
+
+//! Parallel dot product
+template <typename Traits>
+double mpm::MultigridEigen<Traits>::dot(const Eigen::VectorXd& a,
+                                        const Eigen::VectorXd& b) {
+  const Eigen::Index nrows = a.size();
+  double sum = 0.;
+#pragma omp parallel for schedule(runtime) reduction(+ : sum)
+  for (Eigen::Index i = 0; i < nrows; ++i) sum += a[i] * b[i];
+  return sum;
+}
@@ -64,6 +64,22 @@ Eigen::Matrix<double, 6, 1> mpm::LinearElastic<Tdim>::compute_stress(
   return (stress + dstress);
 }
 
+//! Compute stress of a batch of particles
+template <unsigned Tdim>
+void mpm::LinearElastic<Tdim>::compute_stress(
+    unsigned nparticles, Vector6d* stresses, const Vector6d* dstrains,
+    const ParticleBase<Tdim>* const* ptrs, mpm::dense_map* const* state_vars) {
+  static_assert(sizeof(Vector6d) == 6 * sizeof(double),
+                "Batched stresses must be stored contiguously");
+  // View the batch as 6 x n column-major blocks and update in a single
+  // matrix product: sigma += De * dstrain
+  Eigen::Map<Eigen::Matrix<double, 6, Eigen::Dynamic>> stress_block(
+      stresses->data(), 6, nparticles);
+  const Eigen::Map<const Eigen::Matrix<double, 6, Eigen::Dynamic>>
+      dstrain_block(dstrains->data(), 6, nparticles);
+  stress_block.noalias() += this->de_ * dstrain_block;
+}
+
 //! Compute consistent tangent matrix
 template <unsigned Tdim>
 Eigen::Matrix<double, 6, 6>
@@ -64,6 +64,17 @@ class ModifiedCamClay : public InfinitesimalElastoPlastic<Tdim> {
                           const ParticleBase<Tdim>* ptr,
                           mpm::dense_map* state_vars) override;
 
+  //! Compute stress of a batch of particles
+  //! \param[in] nparticles Number of particles in the batch
+  //! \param[in,out] stresses Stresses, replaced by the updated stresses
+  //! \param[in] dstrains Strain increments
+  //! \param[in] ptrs Constant pointers to particle base
+  //! \param[in] state_vars History-dependent state variables of each particle
+  void compute_stress(unsigned nparticles, Vector6d* stresses,
+                      const Vector6d* dstrains,
+                      const ParticleBase<Tdim>* const* ptrs,
+                      mpm::dense_map* const* state_vars) override;
+
   //! Compute stress invariants (j3, q, theta, and epsilon)
   //! \param[in] stress Stress
   //! \param[in] state_vars History-dependent state variables
@@ -703,3 +703,16 @@ Eigen::Matrix<double, 6, 1> mpm::ModifiedCamClay<Tdim>::compute_stress(
 
   return updated_stress;
 }
+
+//! Compute stress of a batch of particles
+template <unsigned Tdim>
+void mpm::ModifiedCamClay<Tdim>::compute_stress(
+    unsigned nparticles, Vector6d* stresses, const Vector6d* dstrains,
+    const ParticleBase<Tdim>* const* ptrs, mpm::dense_map* const* state_vars) {
+  // The elastic tensor is pressure dependent, so each particle runs its own
+  // predictor-corrector; the statically bound call allows inlining
+#pragma omp parallel for schedule(runtime)
+  for (unsigned i = 0; i < nparticles; ++i)
+    stresses[i] = mpm::ModifiedCamClay<Tdim>::compute_stress(
+        stresses[i], dstrains[i], ptrs[i], state_vars[i]);
+}
@@ -65,6 +65,17 @@ class MohrCoulomb : public InfinitesimalElastoPlastic<Tdim> {
                           const ParticleBase<Tdim>* ptr,
                           mpm::dense_map* state_vars) override;
 
+  //! Compute stress of a batch of particles
+  //! \param[in] nparticles Number of particles in the batch
+  //! \param[in,out] stresses Stresses, replaced by the updated stresses
+  //! \param[in] dstrains Strain increments
+  //! \param[in] ptrs Constant pointers to particle base
+  //! \param[in] state_vars History-dependent state variables of each particle
+  void compute_stress(unsigned nparticles, Vector6d* stresses,
+                      const Vector6d* dstrains,
+                      const ParticleBase<Tdim>* const* ptrs,
+                      mpm::dense_map* const* state_vars) override;
+
   //! Compute stress invariants (j2, j3, rho, theta, and epsilon)
   //! \param[in] stress Stress
   //! \param[in] state_vars History-dependent state variables
@@ -105,6 +116,17 @@ class MohrCoulomb : public InfinitesimalElastoPlastic<Tdim> {
   //! \param[in] state_vars History-dependent state variables
   Matrix6x6 compute_elastic_tensor(mpm::dense_map* state_vars);
 
+  //! Compute stress given the elastic trial stress
+  //! \param[in] stress Stress
+  //! \param[in] trial_stress Elastic trial stress
+  //! \param[in] dstrain Strain
+  //! \param[in] state_vars History-dependent state variables
+  //! \retval updated_stress Updated value of stress
+  Vector6d compute_stress_from_trial(const Vector6d& stress,
+                                     const Vector6d& trial_stress,
+                                     const Vector6d& dstrain,
+                                     mpm::dense_map* state_vars);
+
   //! Compute constitutive relations matrix for elasto-plastic material
   //! \param[in] stress Stress
   //! \param[in] dstrain Strain
@@ -318,8 +318,43 @@ template <unsigned Tdim>
 Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
     const Vector6d& stress, const Vector6d& dstrain,
     const ParticleBase<Tdim>* ptr, mpm::dense_map* state_vars) {
-  // Get previous time step state variable
-  const auto prev_state_vars = (*state_vars);
+  // Elastic-predictor stage: compute the trial stress
+  const Vector6d trial_stress =
+      stress + (this->compute_elastic_tensor(state_vars) * dstrain);
+  return this->compute_stress_from_trial(stress, trial_stress, dstrain,
+                                         state_vars);
+}
+
+//! Compute stress of a batch of particles
+template <unsigned Tdim>
+void mpm::MohrCoulomb<Tdim>::compute_stress(
+    unsigned nparticles, Vector6d* stresses, const Vector6d* dstrains,
+    const ParticleBase<Tdim>* const* ptrs, mpm::dense_map* const* state_vars) {
+  static_assert(sizeof(Vector6d) == 6 * sizeof(double),
+                "Batched stresses must be stored contiguously");
+  if (nparticles == 0) return;
+  // Elastic-predictor stage for the whole batch: the elastic tensor does not
+  // depend on the state, so trial stresses are a single matrix product
+  std::vector<Vector6d> trial_stresses(stresses, stresses + nparticles);
+  Eigen::Map<Eigen::Matrix<double, 6, Eigen::Dynamic>> trial_block(
+      trial_stresses.data()->data(), 6, nparticles);
+  const Eigen::Map<const Eigen::Matrix<double, 6, Eigen::Dynamic>>
+      dstrain_block(dstrains->data(), 6, nparticles);
+  trial_block.noalias() +=
+      this->compute_elastic_tensor(state_vars[0]) * dstrain_block;
+
+  // Plastic-corrector stage per particle
+#pragma omp parallel for schedule(runtime)
+  for (unsigned i = 0; i < nparticles; ++i)
+    stresses[i] = this->compute_stress_from_trial(
+        stresses[i], trial_stresses[i], dstrains[i], state_vars[i]);
+}
+
+//! Compute stress from the elastic trial stress
+template <unsigned Tdim>
+Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress_from_trial(
+    const Vector6d& stress, const Vector6d& trial_stress,
+    const Vector6d& dstrain, mpm::dense_map* state_vars) {
   const double pdstrain = (*state_vars).at("pdstrain");
   // Update MC parameters using a linear softening rule
   if (softening_ && pdstrain > pdstrain_peak_) {
@@ -348,10 +383,9 @@ Eigen::Matrix<double, 6, 1> mpm::MohrCoulomb<Tdim>::compute_stress(
       (*state_vars).at("tension_cutoff") = check_low(apex);
   }
   //-------------------------------------------------------------------------
-  // Elastic-predictor stage: compute the trial stress
+  // Check the elastic trial stress
   (*state_vars).at("yield_state") = 0;
   Matrix6x6 de = this->compute_elastic_tensor(state_vars);
-  Vector6d trial_stress = stress + (de * dstrain);
   // Compute stress invariants based on trial stress
   this->compute_stress_invariants(trial_stress, state_vars);
   // Compute yield function based on the trial stress
@@ -61,6 +61,13 @@ class Material {
   template <typename Ttype>
   Ttype property(const std::string& key);
 
+  //! Compressional wave velocity to estimate the critical time step
+  //! \details Uses the property pwave_velocity if defined, otherwise the
+  //! constrained modulus from Young's modulus and Poisson's ratio, or from
+  //! bulk and shear moduli, and the density
+  //! \retval pwave_velocity Compressional wave velocity
+  virtual double pwave_velocity() const;
+
   //! Initialise history variables
   virtual mpm::dense_map initialise_state_variables() = 0;
 
@@ -115,6 +122,24 @@ class Material {
         "in Material:: illegal operation!");
     return error;
   };
+
+  //! Compute stress of a batch of particles sharing this material
+  //! \ingroup InfinitesimalStrain
+  //! \details Default implementation loops over the single particle update
+  //! \param[in] nparticles Number of particles in the batch
+  //! \param[in,out] stresses Stresses, replaced by the updated stresses
+  //! \param[in] dstrains Strain increments
+  //! \param[in] ptrs Constant pointers to particle base
+  //! \param[in] state_vars History-dependent state variables of each particle
+  virtual void compute_stress(unsigned nparticles, Vector6d* stresses,
+                              const Vector6d* dstrains,
+                              const ParticleBase<Tdim>* const* ptrs,
+                              mpm::dense_map* const* state_vars) {
+#pragma omp parallel for schedule(runtime)
+    for (unsigned i = 0; i < nparticles; ++i)
+      stresses[i] = this->compute_stress(stresses[i], dstrains[i], ptrs[i],
+                                         state_vars[i]);
+  };
   /**@}*/
 
   /**
@@ -10,4 +10,35 @@ Ttype mpm::Material<Tdim>::property(const std::string& key) {
     throw std::runtime_error(
         "Property call to material parameter not found or invalid type");
   }
-}
\ No newline at end of file
+}
+
+//! Compressional wave velocity
+template <unsigned Tdim>
+double mpm::Material<Tdim>::pwave_velocity() const {
+  if (properties_.contains("pwave_velocity"))
+    return properties_.at("pwave_velocity").template get<double>();
+
+  // Constrained modulus
+  double modulus = 0.;
+  if (properties_.contains("youngs_modulus") &&
+      properties_.contains("poisson_ratio")) {
+    const double youngs_modulus =
+        properties_.at("youngs_modulus").template get<double>();
+    const double poisson_ratio =
+        properties_.at("poisson_ratio").template get<double>();
+    modulus = youngs_modulus * (1. - poisson_ratio) /
+              ((1. + poisson_ratio) * (1. - 2. * poisson_ratio));
+  } else if (properties_.contains("bulk_modulus")) {
+    modulus = properties_.at("bulk_modulus").template get<double>();
+    if (properties_.contains("shear_modulus"))
+      modulus +=
+          4. / 3. * properties_.at("shear_modulus").template get<double>();
+  } else
+    throw std::runtime_error(
+        "Material " + std::to_string(id_) +
+        " has no elastic moduli to compute the wave velocity, define "
+        "pwave_velocity in the material properties");
+
+  const double density = properties_.at("density").template get<double>();
+  return std::sqrt(modulus / density);
+}
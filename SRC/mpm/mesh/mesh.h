@@ -3,9 +3,13 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <set>
+#include <tuple>
 #include <vector>
 
 // Eigen
@@ -37,6 +41,7 @@ using Json = nlohmann::json;
 #include "io_mesh.h"
 #include "logger.h"
 #include "material.h"
+#include "neighbour_list.h"
 #include "nodal_properties.h"
 #include "node.h"
 #include "particle.h"
@@ -190,6 +195,20 @@ class Mesh {
   //! Compute average cell size
   double compute_average_cell_size() const;
 
+  //! Compute critical time step from particle wave speeds
+  //! \details The wave speed of a particle is the compressional wave velocity
+  //! of its materials plus the particle speed. Reduced across MPI ranks.
+  //! Throws on all ranks if a particle uses a material without a wave
+  //! velocity.
+  //! \param[in] cell_size Characteristic cell size
+  //! \param[in] pwave_velocities Compressional wave velocities indexed by
+  //! material id, NaN for materials without elastic moduli
+  //! \param[in] nphases Number of material phases of particles
+  //! \retval dt Critical time step, maximum double without particle motion
+  double critical_time_step(double cell_size,
+                            const std::vector<double>& pwave_velocities,
+                            unsigned nphases = 1) const;
+
   //! Iterate over cells
   //! \tparam Toper Callable object typically a baseclass functor
   template <typename Toper>
@@ -283,6 +302,15 @@ class Mesh {
   template <typename Toper>
   void iterate_over_particle_set(int set_id, Toper oper);
 
+  //! Compute stress of all particles, batched by material
+  //! \details Particles are grouped by their solid phase material id and each
+  //! material updates its batch in a single call. Particles that do not
+  //! support batched updates compute their stress individually.
+  //! \param[in] dt Analysis time step
+  //! \param[in] stress_rate Use Cauchy or Jaumann rate of stress
+  void compute_particle_stresses(
+      double dt, mpm::StressRate stress_rate = mpm::StressRate::None);
+
   //! Return coordinates of particles
   std::vector<Eigen::Matrix<double, 3, 1>> particle_coordinates();
 
@@ -304,6 +332,16 @@ class Mesh {
   std::vector<Eigen::Matrix<double, Tsize, 1>> particles_tensor_data(
       const std::string& attribute) const;
 
+  //! Gather particle data into a contiguous buffer
+  //! \tparam Tgather Callable taking a particle pointer and a pointer to the
+  //! ncomponents values of the particle in the buffer
+  //! \param[in] ncomponents Number of values per particle
+  //! \param[in] gather Function writing the values of a particle
+  //! \param[out] data Buffer of nparticles x ncomponents values
+  template <typename Tgather>
+  void gather_particles_data(unsigned ncomponents, Tgather gather,
+                             double* data) const;
+
   //! Return particles state variable data
   //! \param[in] attribute Name of the state variable attribute
   //! \param[in] phase Index corresponding to the phase
@@ -408,12 +446,16 @@ class Mesh {
   }
 
   //! Find particle neighbours
-  //! \param[in] cell of interest
+  //! \details Updates the compressed neighbour lists of all cells, which are
+  //! read with particle_neighbours
   void find_particle_neighbours();
 
-  //! Find particle neighbours
-  //! \param[in] cell of interest
-  void find_particle_neighbours(const std::shared_ptr<mpm::Cell<Tdim>>& cell);
+  //! Neighbour particles of a particle found by find_particle_neighbours
+  //! \param[in] particle Particle of interest
+  //! \retval neighbours Range of the neighbour particle ids, including the
+  //! particles of the cell of the particle
+  mpm::NeighbourList::Range particle_neighbours(
+      const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) const;
 
   //! Add a neighbour mesh, using the local id for the new mesh and a mesh
   //! pointer
@@ -431,13 +473,17 @@ class Mesh {
 
   //! Write HDF5 particles
   //! \param[in] filename Name of HDF5 file to write particles data
+  //! \param[in] compress Compress the chunks of the particle table
   //! \retval status Status of writing HDF5 output
-  bool write_particles_hdf5(const std::string& filename);
+  bool write_particles_hdf5(const std::string& filename,
+                            bool compress = false);
 
   //! Write HDF5 particles for two-phase-one-point particle
   //! \param[in] filename Name of HDF5 file to write particles data
+  //! \param[in] compress Compress the chunks of the particle table
   //! \retval status Status of writing HDF5 output
-  bool write_particles_hdf5_twophase(const std::string& filename);
+  bool write_particles_hdf5_twophase(const std::string& filename,
+                                     bool compress = false);
 
   //! Read HDF5 particles with type name
   //! \param[in] filename Name of HDF5 file to write particles data
@@ -466,6 +512,34 @@ class Mesh {
   //! \retval particles_hdf5 Vector of HDF5 particles
   std::vector<mpm::PODParticle> particles_hdf5() const;
 
+  //! Return POD particles of a particle type
+  //! \tparam Tpod POD particle type
+  //! \param[in] particle_type Particle type
+  //! \retval pods Vector of POD particles
+  template <typename Tpod>
+  std::vector<Tpod> pod_particles(const std::string& particle_type) const;
+
+  //! Create particles from POD particles
+  //! \tparam Tpod POD particle type
+  //! \param[in] pods POD particles
+  //! \param[in] particle_type Particle type to be generated
+  template <typename Tpod>
+  void create_pod_particles(const std::vector<Tpod>& pods,
+                            const std::string& particle_type);
+
+  //! Return nodal velocity constraints
+  //! \retval constraints Nodal velocity constraints (node id, direction,
+  //! velocity)
+  std::vector<std::tuple<mpm::Index, unsigned, double>>
+      nodal_velocity_constraints() const;
+
+  //! Assign nodal velocity constraints
+  //! \param[in] constraints Nodal velocity constraints (node id, direction,
+  //! velocity)
+  void assign_nodal_velocity_constraints(
+      const std::vector<std::tuple<mpm::Index, unsigned, double>>&
+          constraints);
+
   //! Return nodal coordinates
   std::vector<Eigen::Matrix<double, 3, 1>> nodal_coordinates() const;
 
@@ -676,6 +750,34 @@ class Mesh {
   bool locate_particle_cells(
       const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle);
 
+  //! Send particles to other ranks and add the particles received
+  //! \details Particles for each destination rank are serialized into a single
+  //! buffer, exchanged with nonblocking point to point messages. Sent
+  //! particles are removed while the messages are in flight, and received
+  //! buffers are unpacked as they arrive. Collective over all ranks.
+  //! \param[in] send_pids Ids of particles to be sent to each rank
+  void exchange_particles(
+      const std::vector<std::vector<mpm::Index>>& send_pids);
+
+  //! Add particles from a buffer of serialized particles
+  //! \param[in] buffer Packed records of size and serialized particle
+  void add_serialized_particles(const std::vector<uint8_t>& buffer);
+
+  //! Materials of a POD particle
+  //! \param[in] pod POD particle
+  std::vector<std::shared_ptr<mpm::Material<Tdim>>> pod_materials(
+      const mpm::PODParticle& pod) const;
+
+  //! Materials of a two-phase POD particle
+  //! \param[in] pod Two-phase POD particle
+  std::vector<std::shared_ptr<mpm::Material<Tdim>>> pod_materials(
+      const mpm::PODParticleTwoPhase& pod) const;
+
+  //! Exchange particle ids of cells neighbouring cells of other ranks
+  //! \details Ids are aggregated into one message per neighbour rank and
+  //! stored in halo_cell_particles_. Collective over all ranks.
+  void exchange_neighbour_particle_ids();
+
  private:
   //! mesh id
   unsigned id_{std::numeric_limits<unsigned>::max()};
@@ -715,6 +817,12 @@ class Mesh {
   tsl::robin_map<unsigned, Vector<Cell<Tdim>>> cell_sets_;
   //! Map of ghost cells to the neighbours ranks
   std::map<unsigned, std::vector<unsigned>> ghost_cells_neighbour_ranks_;
+  //! Particle ids of cells in other ranks neighbouring local cells
+  std::map<mpm::Index, std::vector<mpm::Index>> halo_cell_particles_;
+  //! Compressed neighbour particles of cells
+  mpm::NeighbourList neighbour_list_;
+  //! Index of cells in the neighbour list
+  tsl::robin_map<mpm::Index, std::size_t> neighbour_list_cells_;
   //! Faces and cells
   std::multimap<std::vector<mpm::Index>, mpm::Index> faces_cells_;
   //! Materials
@@ -315,92 +315,219 @@ double mpm::Mesh<Tdim>::compute_average_cell_size() const {
   return mesh_size;
 }
 
+//! Compute critical time step from particle wave speeds
+template <unsigned Tdim>
+double mpm::Mesh<Tdim>::critical_time_step(
+    double cell_size, const std::vector<double>& pwave_velocities,
+    unsigned nphases) const {
+  const unsigned nmaterials = pwave_velocities.size();
+
+  // Maximum wave speed of particles, and particles of materials without a
+  // wave velocity
+  double max_speed = 0.;
+  int unknown = 0;
+#pragma omp parallel for schedule(runtime) reduction(max : max_speed) \
+    reduction(| : unknown)
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
+    double pwave_velocity = 0.;
+    for (unsigned phase = 0; phase < nphases; ++phase) {
+      const unsigned material_id = (*pitr)->material_id(phase);
+      if (material_id >= nmaterials) continue;
+      if (std::isnan(pwave_velocities[material_id]))
+        unknown = 1;
+      else
+        pwave_velocity =
+            std::max(pwave_velocity, pwave_velocities[material_id]);
+    }
+    const double speed = pwave_velocity + (*pitr)->velocity().norm();
+    max_speed = std::max(max_speed, speed);
+  }
+
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &max_speed, 1, MPI_DOUBLE, MPI_MAX,
+                MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &unknown, 1, MPI_INT, MPI_BOR, MPI_COMM_WORLD);
+#endif
+
+  if (unknown)
+    throw std::runtime_error(
+        "Particles of a material without elastic moduli, unable to compute "
+        "the critical time step");
+
+  return (max_speed > 0.) ? cell_size / max_speed
+                          : std::numeric_limits<double>::max();
+}
+
 //! Find global number of particles across MPI ranks / cell
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::find_nglobal_particles_cells() {
   int mpi_rank = 0;
 #ifdef USE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
-  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
-    int nparticles;
-    // Determine the rank of the broadcast emitter process
-    if ((*citr)->rank() == mpi_rank) nparticles = (*citr)->nparticles();
-    MPI_Bcast(&nparticles, 1, MPI_INT, (*citr)->rank(), MPI_COMM_WORLD);
-    // Receive broadcast and update on all ranks
-    (*citr)->nglobal_particles(nparticles);
-  }
+  // Number of particles in cells of the current rank, zero elsewhere
+  std::vector<int> nparticles(cells_.size(), 0);
+  mpm::Index i = 0;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr, ++i)
+    if ((*citr)->rank() == mpi_rank) nparticles[i] = (*citr)->nparticles();
+  // Reduce counts of all cells in a single message
+  MPI_Allreduce(MPI_IN_PLACE, nparticles.data(), nparticles.size(), MPI_INT,
+                MPI_SUM, MPI_COMM_WORLD);
+  // Update on all ranks
+  i = 0;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr, ++i)
+    (*citr)->nglobal_particles(nparticles[i]);
 #endif
 }
 
 //! Find particle neighbours for all particle
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::find_particle_neighbours() {
-  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
-    this->find_particle_neighbours(*citr);
-}
-
-//! Find particle neighbours for specific cell particle
-template <unsigned Tdim>
-void mpm::Mesh<Tdim>::find_particle_neighbours(
-    const std::shared_ptr<mpm::Cell<Tdim>>& cell) {
   int mpi_rank = 0;
 #ifdef USE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
 #endif
 
-  // Particles in current cell
-  std::vector<mpm::Index> neighbour_particles = cell->particles();
-  // Loop over all neighboring cells, and append particle ids from each cell
-  for (const auto& neighbour_cell_id : cell->neighbours()) {
-    // Get the MPI rank of the neighbour cell
-    int neighbour_cell_rank = map_cells_[neighbour_cell_id]->rank();
-    if (neighbour_cell_rank != cell->rank()) {
+  // Particle ids of neighbour cells in other ranks
+  this->exchange_neighbour_particle_ids();
+
+  // Bins of the neighbour list are the cells, followed by the cells of other
+  // ranks neighbouring local cells
+  const std::size_t ncells = cells_.size();
+  std::vector<const std::vector<mpm::Index>*> bins;
+  bins.reserve(ncells + halo_cell_particles_.size());
+  neighbour_list_cells_.clear();
+  neighbour_list_cells_.reserve(ncells);
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+    neighbour_list_cells_.emplace((*citr)->id(), bins.size());
+    bins.emplace_back(&(*citr)->particles());
+  }
+  std::map<mpm::Index, std::size_t> halo_bins;
+  for (const auto& halo_cell : halo_cell_particles_) {
+    halo_bins.emplace(halo_cell.first, bins.size());
+    bins.emplace_back(&halo_cell.second);
+  }
+
+  // Bins around each cell
+  std::vector<std::size_t> offsets;
+  offsets.reserve(ncells + 1);
+  offsets.emplace_back(0);
+  std::vector<std::size_t> neighbour_bins;
+  std::size_t index = 0;
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr, ++index) {
+    neighbour_bins.emplace_back(index);
+    for (const auto& neighbour_cell_id : (*citr)->neighbours()) {
+      if (map_cells_[neighbour_cell_id]->rank() == (*citr)->rank()) {
+        neighbour_bins.emplace_back(
+            neighbour_list_cells_.at(neighbour_cell_id));
+      } else if ((*citr)->rank() == mpi_rank) {
+        // Particle ids received by exchange_neighbour_particle_ids
+        const auto hitr = halo_bins.find(neighbour_cell_id);
+        if (hitr != halo_bins.end()) neighbour_bins.emplace_back(hitr->second);
+      }
+    }
+    offsets.emplace_back(neighbour_bins.size());
+  }
+
+  // Only cells around moved particles are gathered again
+  neighbour_list_.update(bins, ncells, offsets, neighbour_bins);
+}
+
+//! Neighbour particles of a particle
+template <unsigned Tdim>
+mpm::NeighbourList::Range mpm::Mesh<Tdim>::particle_neighbours(
+    const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) const {
+  const auto itr = neighbour_list_cells_.find(particle->cell_id());
+  if (itr == neighbour_list_cells_.end()) return mpm::NeighbourList::Range();
+  return neighbour_list_.neighbours(itr->second);
+}
+
+//! Exchange particle ids of cells neighbouring cells of other ranks
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::exchange_neighbour_particle_ids() {
+  halo_cell_particles_.clear();
 #ifdef USE_MPI
-      // Send particle ids
-      if (neighbour_cell_rank == mpi_rank) {
-        // Get particle ids from each cell
-        auto send_particle_ids = map_cells_[neighbour_cell_id]->particles();
-        // Get size of the particle ids
-        int pid_size = send_particle_ids.size();
-        // Send the size of the particles in cell
-        MPI_Send(&pid_size, 1, MPI_INT, cell->rank(), neighbour_cell_id,
+  // Get number of MPI ranks
+  int mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  int mpi_rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+  if (mpi_size > 1) {
+    // Local cells neighbouring cells of each other rank
+    std::vector<std::set<mpm::Index>> send_cells(mpi_size);
+    for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+      const int cell_rank = (*citr)->rank();
+      if (cell_rank == mpi_rank) continue;
+      for (const auto& neighbour_cell_id : (*citr)->neighbours())
+        if (map_cells_[neighbour_cell_id]->rank() == mpi_rank)
+          send_cells[cell_rank].insert(neighbour_cell_id);
+    }
+
+    // Pack records of cell id, number of particles and particle ids
+    std::vector<std::vector<mpm::Index>> send_buffers(mpi_size);
+    std::vector<int> send_sizes(mpi_size, 0);
+    for (int rank = 0; rank < mpi_size; ++rank) {
+      auto& buffer = send_buffers[rank];
+      for (const auto cell_id : send_cells[rank]) {
+        const auto& particle_ids = map_cells_[cell_id]->particles();
+        buffer.emplace_back(cell_id);
+        buffer.emplace_back(particle_ids.size());
+        buffer.insert(buffer.end(), particle_ids.begin(), particle_ids.end());
+      }
+      send_sizes[rank] = buffer.size();
+    }
+
+    // Exchange sizes of the buffers
+    std::vector<int> recv_sizes(mpi_size, 0);
+    MPI_Alltoall(send_sizes.data(), 1, MPI_INT, recv_sizes.data(), 1, MPI_INT,
                  MPI_COMM_WORLD);
 
-        // Send particle ids if it is not empty
-        if (pid_size > 0)
-          MPI_Send(send_particle_ids.data(), pid_size, MPI_UNSIGNED_LONG_LONG,
-                   cell->rank(), neighbour_cell_id, MPI_COMM_WORLD);
+    // Post receives and sends of nonempty buffers
+    std::vector<std::vector<mpm::Index>> recv_buffers(mpi_size);
+    std::vector<MPI_Request> recv_requests;
+    recv_requests.reserve(mpi_size);
+    std::vector<int> recv_ranks;
+    recv_ranks.reserve(mpi_size);
+    std::vector<MPI_Request> send_requests;
+    send_requests.reserve(mpi_size);
+    for (int rank = 0; rank < mpi_size; ++rank) {
+      if (recv_sizes[rank] > 0) {
+        recv_buffers[rank].resize(recv_sizes[rank]);
+        recv_requests.emplace_back();
+        recv_ranks.emplace_back(rank);
+        MPI_Irecv(recv_buffers[rank].data(), recv_sizes[rank],
+                  MPI_UNSIGNED_LONG_LONG, rank, 0, MPI_COMM_WORLD,
+                  &recv_requests.back());
       }
-      // Receive particle ids in the current MPI rank
-      if (cell->rank() == mpi_rank) {
-        // Particle ids at local cell MPI rank
-        std::vector<mpm::Index> received_particle_ids;
-        int nparticles = 0;
-        MPI_Recv(&nparticles, 1, MPI_INT, neighbour_cell_rank,
-                 neighbour_cell_id, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-        if (nparticles > 0) {
-          received_particle_ids.resize(nparticles);
-          MPI_Recv(received_particle_ids.data(), nparticles,
-                   MPI_UNSIGNED_LONG_LONG, neighbour_cell_rank,
-                   neighbour_cell_id, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-        }
+      if (send_sizes[rank] > 0) {
+        send_requests.emplace_back();
+        MPI_Isend(send_buffers[rank].data(), send_sizes[rank],
+                  MPI_UNSIGNED_LONG_LONG, rank, 0, MPI_COMM_WORLD,
+                  &send_requests.back());
+      }
+    }
 
-        neighbour_particles.insert(neighbour_particles.end(),
-                                   received_particle_ids.begin(),
-                                   received_particle_ids.end());
+    // Unpack particle ids in the order the buffers arrive
+    for (unsigned i = 0; i < recv_requests.size(); ++i) {
+      int index;
+      MPI_Waitany(recv_requests.size(), recv_requests.data(), &index,
+                  MPI_STATUS_IGNORE);
+      const auto& buffer = recv_buffers[recv_ranks[index]];
+      for (std::size_t j = 0; j + 1 < buffer.size();) {
+        const mpm::Index cell_id = buffer[j];
+        const mpm::Index nparticles = buffer[j + 1];
+        j += 2;
+        halo_cell_particles_[cell_id].assign(buffer.begin() + j,
+                                             buffer.begin() + j + nparticles);
+        j += nparticles;
       }
-#endif
-    } else {
-      const auto& particle_ids = map_cells_[neighbour_cell_id]->particles();
-      neighbour_particles.insert(neighbour_particles.end(),
-                                 particle_ids.begin(), particle_ids.end());
     }
-  }
 
-  // Assign neighbouring particle ids to particles in the current cell
-  for (auto particle_id : cell->particles())
-    map_particles_[particle_id]->assign_neighbours(neighbour_particles);
+    // Send complete
+    MPI_Waitall(send_requests.size(), send_requests.data(),
+                MPI_STATUSES_IGNORE);
+  }
+#endif
 }
 
 //! Find ghost cell neighbours
@@ -738,121 +865,20 @@ void mpm::Mesh<Tdim>::transfer_halo_particles() {
   // Get number of MPI ranks
   int mpi_size;
   MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
-  int mpi_rank;
-  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
 
   if (mpi_size > 1) {
-    std::vector<MPI_Request> send_requests;
-    send_requests.reserve(ghost_cells_.size());
-
-    unsigned i = 0;
-    unsigned np = 0;
-    std::vector<mpm::Index> remove_pids;
-    // Iterate through the ghost cells and send particles
+    // Particles in ghost cells are sent to the rank of the cell
+    std::vector<std::vector<mpm::Index>> send_pids(mpi_size);
     for (auto citr = this->ghost_cells_.cbegin();
-         citr != this->ghost_cells_.cend(); ++citr, ++i) {
-
-      // Send number of particles to receiver rank
-      auto particle_ids = (*citr)->particles();
-      unsigned nparticles = particle_ids.size();
-      MPI_Isend(&nparticles, 1, MPI_UNSIGNED, (*citr)->rank(), 1,
-                MPI_COMM_WORLD, &send_requests[i]);
-    }
-
-    // Iterate through the ghost cells and send particles
-    for (auto citr = this->ghost_cells_.cbegin();
-         citr != this->ghost_cells_.cend(); ++citr, ++i) {
-      // Send number of particles to receiver rank
-      auto particle_ids = (*citr)->particles();
-      for (auto& id : particle_ids) {
-        // Create a vector of serialized particle
-        std::vector<uint8_t> buffer = map_particles_[id]->serialize();
-        MPI_Send(buffer.data(), buffer.size(), MPI_UINT8_T, (*citr)->rank(), 0,
-                 MPI_COMM_WORLD);
-        ++np;
-        // Particles to be removed from the current rank
-        remove_pids.emplace_back(id);
-      }
+         citr != this->ghost_cells_.cend(); ++citr) {
+      const auto& particle_ids = (*citr)->particles();
+      auto& rank_pids = send_pids[(*citr)->rank()];
+      rank_pids.insert(rank_pids.end(), particle_ids.begin(),
+                       particle_ids.end());
       (*citr)->clear_particle_ids();
     }
-    // Remove all sent particles
-    this->remove_particles(remove_pids);
-    // Send complete
-    for (unsigned i = 0; i < this->ghost_cells_.size(); ++i)
-      MPI_Wait(&send_requests[i], MPI_STATUS_IGNORE);
-
-    // Particle id
-    mpm::Index pid = 0;
-    // Initial particle coordinates
-    Eigen::Matrix<double, Tdim, 1> pcoordinates =
-        Eigen::Matrix<double, Tdim, 1>::Zero();
-
-    // Iterate through the local ghost cells and receive particles
-    for (auto citr = this->local_ghost_cells_.cbegin();
-         citr != this->local_ghost_cells_.cend(); ++citr) {
-      std::vector<unsigned> neighbour_ranks =
-          ghost_cells_neighbour_ranks_[(*citr)->id()];
-      // Total number of particles
-      std::vector<unsigned> nrank_particles(neighbour_ranks.size(), 0);
-      for (unsigned i = 0; i < neighbour_ranks.size(); ++i)
-        MPI_Recv(&nrank_particles[i], 1, MPI_UNSIGNED, neighbour_ranks[i], 1,
-                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-      // Receive number of particles
-      unsigned nrecv_particles =
-          std::accumulate(nrank_particles.begin(), nrank_particles.end(), 0);
-
-      for (unsigned j = 0; j < nrecv_particles; ++j) {
-        // Retrieve information about the incoming message
-        MPI_Status status;
-        MPI_Probe(MPI_ANY_SOURCE, 0, MPI_COMM_WORLD, &status);
-
-        // Get buffer size
-        int size;
-        MPI_Get_count(&status, MPI_UINT8_T, &size);
-
-        // Allocate the buffer now that we know how many elements there are
-        std::vector<uint8_t> buffer;
-        buffer.resize(size);
-
-        // Finally receive the message
-        MPI_Recv(buffer.data(), size, MPI_UINT8_T, MPI_ANY_SOURCE, 0,
-                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-        uint8_t* bufptr = const_cast<uint8_t*>(&buffer[0]);
-        int position = 0;
-
-        // Get particle type
-        int ptype;
-        MPI_Unpack(bufptr, buffer.size(), &position, &ptype, 1, MPI_INT,
-                   MPI_COMM_WORLD);
-        std::string particle_type = mpm::ParticleTypeName.at(ptype);
-
-        // Get materials material id
-        int nmaterials = 0;
-        MPI_Unpack(bufptr, buffer.size(), &position, &nmaterials, 1,
-                   MPI_UNSIGNED, MPI_COMM_WORLD);
-        // Vector of materials
-        std::vector<std::shared_ptr<mpm::Material<Tdim>>> materials;
-        materials.reserve(nmaterials);
-        for (unsigned k = 0; k < nmaterials; ++k) {
-          int mat_id;
-          MPI_Unpack(bufptr, buffer.size(), &position, &mat_id, 1, MPI_UNSIGNED,
-                     MPI_COMM_WORLD);
-          materials.emplace_back(materials_.at(mat_id));
-        }
-
-        // Create particle
-        auto particle =
-            Factory<mpm::ParticleBase<Tdim>, mpm::Index,
-                    const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                ->create(particle_type, static_cast<mpm::Index>(pid),
-                         pcoordinates);
-        particle->deserialize(buffer, materials);
-        // Add particle to mesh
-        this->add_particle(particle, true);
-      }
-    }
+    // Send and receive particles
+    this->exchange_particles(send_pids);
   }
 #endif
 }
@@ -869,121 +895,153 @@ void mpm::Mesh<Tdim>::transfer_nonrank_particles(
   MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
 
   if (mpi_size > 1) {
-    std::vector<MPI_Request> send_requests;
-    send_requests.reserve(exchange_cells.size());
-    std::vector<MPI_Request> send_particle_requests;
-    send_particle_requests.reserve(exchange_cells.size() * 100);
-    unsigned nsend_requests = 0;
-    unsigned np = 0;
-    std::vector<mpm::Index> remove_pids;
-    // Iterate through the ghost cells and send particles
+    // If the previous rank of cell is the current MPI rank, then send all
+    // particles to the new rank of the cell
+    std::vector<std::vector<mpm::Index>> send_pids(mpi_size);
     for (auto cid : exchange_cells) {
       // Get cell pointer
       auto cell = map_cells_[cid];
-      // If the previous rank of cell is the current MPI rank,
-      // then send all particles
       if ((cell->rank() != cell->previous_mpirank()) &&
           (cell->previous_mpirank() == mpi_rank)) {
-
-        // Send number of particles to receiver rank
-        unsigned nparticles = cell->nparticles();
-        MPI_Ibsend(&nparticles, 1, MPI_UNSIGNED, cell->rank(), 0,
-                   MPI_COMM_WORLD, &send_requests[nsend_requests]);
-
-        auto particle_ids = cell->particles();
-        for (auto& id : particle_ids) {
-          // Create a vector of serialized particle
-          std::vector<uint8_t> buffer = map_particles_[id]->serialize();
-          MPI_Ibsend(buffer.data(), buffer.size(), MPI_UINT8_T, cell->rank(), 0,
-                     MPI_COMM_WORLD, &send_particle_requests[np]);
-          ++np;
-
-          // Particles to be removed from the current rank
-          remove_pids.emplace_back(id);
-        }
+        const auto& particle_ids = cell->particles();
+        auto& rank_pids = send_pids[cell->rank()];
+        rank_pids.insert(rank_pids.end(), particle_ids.begin(),
+                         particle_ids.end());
         cell->clear_particle_ids();
-        ++nsend_requests;
       }
     }
-    // Remove all sent particles
-    this->remove_particles(remove_pids);
-    // Send complete iterate only upto valid send requests
-    for (unsigned i = 0; i < nsend_requests; ++i)
-      MPI_Wait(&send_requests[i], MPI_STATUS_IGNORE);
-    // Send particles complete
-    for (unsigned i = 0; i < np; ++i)
-      MPI_Wait(&send_particle_requests[i], MPI_STATUS_IGNORE);
+    // Send and receive particles
+    this->exchange_particles(send_pids);
+  }
+#endif
+}
 
-    // Particle id
-    mpm::Index pid = 0;
-    // Initial particle coordinates
-    Eigen::Matrix<double, Tdim, 1> pcoordinates =
-        Eigen::Matrix<double, Tdim, 1>::Zero();
+//! Send particles to other ranks and add the particles received
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::exchange_particles(
+    const std::vector<std::vector<mpm::Index>>& send_pids) {
+#ifdef USE_MPI
+  // Get number of MPI ranks
+  int mpi_size;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
 
-    // Iterate through the ghost cells and receive particles
-    for (auto cid : exchange_cells) {
-      // Get cell pointer
-      auto cell = map_cells_[cid];
-      // If the current rank is the MPI rank receive particles
-      if ((cell->rank() != cell->previous_mpirank()) &&
-          (cell->rank() == mpi_rank)) {
-        // Receive number of particles
-        unsigned nrecv_particles;
-        MPI_Recv(&nrecv_particles, 1, MPI_UNSIGNED, cell->previous_mpirank(), 0,
-                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-        for (unsigned j = 0; j < nrecv_particles; ++j) {
-          // Retrieve information about the incoming message
-          MPI_Status status;
-          MPI_Probe(cell->previous_mpirank(), 0, MPI_COMM_WORLD, &status);
-
-          // Get buffer size
-          int size;
-          MPI_Get_count(&status, MPI_UINT8_T, &size);
-
-          // Allocate the buffer now that we know how many elements there are
-          std::vector<uint8_t> buffer;
-          buffer.resize(size);
-
-          // Finally receive the message
-          MPI_Recv(buffer.data(), size, MPI_UINT8_T, cell->previous_mpirank(),
-                   0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-          uint8_t* bufptr = const_cast<uint8_t*>(&buffer[0]);
-          int position = 0;
-
-          // Get particle type
-          int ptype;
-          MPI_Unpack(bufptr, buffer.size(), &position, &ptype, 1, MPI_INT,
-                     MPI_COMM_WORLD);
-          std::string particle_type = mpm::ParticleTypeName.at(ptype);
-
-          // Get materials material id
-          int nmaterials = 0;
-          MPI_Unpack(bufptr, buffer.size(), &position, &nmaterials, 1,
-                     MPI_UNSIGNED, MPI_COMM_WORLD);
-          std::vector<std::shared_ptr<mpm::Material<Tdim>>> materials;
-          materials.reserve(nmaterials);
-          for (unsigned k = 0; k < nmaterials; ++k) {
-            int mat_id;
-            MPI_Unpack(bufptr, buffer.size(), &position, &mat_id, 1,
-                       MPI_UNSIGNED, MPI_COMM_WORLD);
-            // Get material
-            materials.emplace_back(materials_.at(mat_id));
-          }
+  // Pack particles of each destination rank as records of size and data
+  std::vector<std::vector<uint8_t>> send_buffers(mpi_size);
+  std::vector<int> send_sizes(mpi_size, 0);
+  std::vector<mpm::Index> remove_pids;
+  for (int rank = 0; rank < mpi_size; ++rank) {
+    auto& buffer = send_buffers[rank];
+    for (auto id : send_pids[rank]) {
+      const std::vector<uint8_t> record = map_particles_[id]->serialize();
+      const int record_size = record.size();
+      if (buffer.empty())
+        buffer.reserve(send_pids[rank].size() * (sizeof(int) + record_size));
+      const auto* size_ptr = reinterpret_cast<const uint8_t*>(&record_size);
+      buffer.insert(buffer.end(), size_ptr, size_ptr + sizeof(int));
+      buffer.insert(buffer.end(), record.begin(), record.end());
+      // Particles to be removed from the current rank
+      remove_pids.emplace_back(id);
+    }
+    send_sizes[rank] = buffer.size();
+  }
 
-          // Create particle
-          auto particle =
-              Factory<mpm::ParticleBase<Tdim>, mpm::Index,
-                      const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                  ->create(particle_type, static_cast<mpm::Index>(pid),
-                           pcoordinates);
-          particle->deserialize(buffer, materials);
-          // Add particle to mesh
-          this->add_particle(particle, true);
-        }
-      }
+  // Exchange sizes of the buffers
+  std::vector<int> recv_sizes(mpi_size, 0);
+  MPI_Alltoall(send_sizes.data(), 1, MPI_INT, recv_sizes.data(), 1, MPI_INT,
+               MPI_COMM_WORLD);
+
+  // Post receives and sends of nonempty buffers
+  std::vector<std::vector<uint8_t>> recv_buffers(mpi_size);
+  std::vector<MPI_Request> recv_requests;
+  recv_requests.reserve(mpi_size);
+  std::vector<int> recv_ranks;
+  recv_ranks.reserve(mpi_size);
+  std::vector<MPI_Request> send_requests;
+  send_requests.reserve(mpi_size);
+  for (int rank = 0; rank < mpi_size; ++rank) {
+    if (recv_sizes[rank] > 0) {
+      recv_buffers[rank].resize(recv_sizes[rank]);
+      recv_requests.emplace_back();
+      recv_ranks.emplace_back(rank);
+      MPI_Irecv(recv_buffers[rank].data(), recv_sizes[rank], MPI_UINT8_T, rank,
+                0, MPI_COMM_WORLD, &recv_requests.back());
     }
+    if (send_sizes[rank] > 0) {
+      send_requests.emplace_back();
+      MPI_Isend(send_buffers[rank].data(), send_sizes[rank], MPI_UINT8_T, rank,
+                0, MPI_COMM_WORLD, &send_requests.back());
+    }
+  }
+
+  // Remove all sent particles while the messages are in flight
+  this->remove_particles(remove_pids);
+
+  // Add received particles in the order the buffers arrive
+  for (unsigned i = 0; i < recv_requests.size(); ++i) {
+    int index;
+    MPI_Waitany(recv_requests.size(), recv_requests.data(), &index,
+                MPI_STATUS_IGNORE);
+    this->add_serialized_particles(recv_buffers[recv_ranks[index]]);
+  }
+
+  // Send complete
+  MPI_Waitall(send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE);
+#endif
+}
+
+//! Add particles from a buffer of serialized particles
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::add_serialized_particles(
+    const std::vector<uint8_t>& buffer) {
+#ifdef USE_MPI
+  // Particle id
+  mpm::Index pid = 0;
+  // Initial particle coordinates
+  const Eigen::Matrix<double, Tdim, 1> pcoordinates =
+      Eigen::Matrix<double, Tdim, 1>::Zero();
+
+  // Serialized particle, reused for all records
+  std::vector<uint8_t> record;
+  std::size_t offset = 0;
+  while (offset + sizeof(int) <= buffer.size()) {
+    int record_size;
+    std::memcpy(&record_size, buffer.data() + offset, sizeof(int));
+    offset += sizeof(int);
+    record.assign(buffer.begin() + offset,
+                  buffer.begin() + offset + record_size);
+    offset += record_size;
+
+    uint8_t* bufptr = record.data();
+    int position = 0;
+
+    // Get particle type
+    int ptype;
+    MPI_Unpack(bufptr, record.size(), &position, &ptype, 1, MPI_INT,
+               MPI_COMM_WORLD);
+    std::string particle_type = mpm::ParticleTypeName.at(ptype);
+
+    // Get materials material id
+    unsigned nmaterials = 0;
+    MPI_Unpack(bufptr, record.size(), &position, &nmaterials, 1, MPI_UNSIGNED,
+               MPI_COMM_WORLD);
+    // Vector of materials
+    std::vector<std::shared_ptr<mpm::Material<Tdim>>> materials;
+    materials.reserve(nmaterials);
+    for (unsigned k = 0; k < nmaterials; ++k) {
+      unsigned mat_id;
+      MPI_Unpack(bufptr, record.size(), &position, &mat_id, 1, MPI_UNSIGNED,
+                 MPI_COMM_WORLD);
+      materials.emplace_back(materials_.at(mat_id));
+    }
+
+    // Create particle
+    auto particle =
+        Factory<mpm::ParticleBase<Tdim>, mpm::Index,
+                const Eigen::Matrix<double, Tdim, 1>&>::instance()
+            ->create(particle_type, static_cast<mpm::Index>(pid), pcoordinates);
+    particle->deserialize(record, materials);
+    // Add particle to mesh
+    this->add_particle(particle, true);
   }
 #endif
 }
@@ -1187,6 +1245,58 @@ void mpm::Mesh<Tdim>::iterate_over_particle_set(int set_id, Toper oper) {
   }
 }
 
+//! Compute stress of all particles, batched by material
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::compute_particle_stresses(double dt,
+                                                mpm::StressRate stress_rate) {
+  //! Particles sharing a material and their gathered stress update inputs
+  struct MaterialBatch {
+    std::vector<mpm::ParticleBase<Tdim>*> particles;
+    std::vector<Eigen::Matrix<double, 6, 1>> stresses;
+    std::vector<Eigen::Matrix<double, 6, 1>> dstrains;
+    std::vector<mpm::dense_map*> state_vars;
+  };
+  std::map<unsigned, MaterialBatch> batches;
+  // Particles which update their stress by themselves
+  std::vector<mpm::ParticleBase<Tdim>*> unbatched;
+
+  // Bucket particles by material id and gather inputs contiguously
+  Eigen::Matrix<double, 6, 1> stress, dstrain;
+  mpm::dense_map* state_vars = nullptr;
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
+    if (!(*pitr)->stress_update_inputs(&stress, &dstrain, &state_vars)) {
+      unbatched.emplace_back((*pitr).get());
+      continue;
+    }
+    auto& batch = batches[(*pitr)->material_id(mpm::ParticlePhase::Solid)];
+    batch.particles.emplace_back((*pitr).get());
+    batch.stresses.emplace_back(stress);
+    batch.dstrains.emplace_back(dstrain);
+    batch.state_vars.emplace_back(state_vars);
+  }
+
+  // Stream each batch through its material
+  for (auto& [material_id, batch] : batches) {
+    const unsigned nparticles = batch.particles.size();
+    batch.particles.front()
+        ->material(mpm::ParticlePhase::Solid)
+        ->compute_stress(nparticles, batch.stresses.data(),
+                         batch.dstrains.data(), batch.particles.data(),
+                         batch.state_vars.data());
+
+    // Scatter updated stresses back to particles
+#pragma omp parallel for schedule(runtime)
+    for (unsigned i = 0; i < nparticles; ++i)
+      batch.particles[i]->update_material_stress(batch.stresses[i], dt,
+                                                 stress_rate);
+  }
+
+  // Remaining particles
+#pragma omp parallel for schedule(runtime)
+  for (auto pitr = unbatched.cbegin(); pitr != unbatched.cend(); ++pitr)
+    (*pitr)->compute_stress(dt, stress_rate);
+}
+
 //! Add a neighbour mesh, using the local id of the mesh and a mesh pointer
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::add_neighbour(
@@ -1272,6 +1382,18 @@ std::vector<Eigen::Matrix<double, Tsize, 1>>
   return tensor_data;
 }
 
+//! Gather particle data into a contiguous buffer
+template <unsigned Tdim>
+template <typename Tgather>
+void mpm::Mesh<Tdim>::gather_particles_data(unsigned ncomponents,
+                                            Tgather gather,
+                                            double* data) const {
+  const auto begin = particles_.cbegin();
+#pragma omp parallel for schedule(runtime)
+  for (auto pitr = begin; pitr != particles_.cend(); ++pitr)
+    gather(*pitr, data + (pitr - begin) * ncomponents);
+}
+
 //! Return particle state variable data
 template <unsigned Tdim>
 std::vector<double> mpm::Mesh<Tdim>::particles_statevars_data(
@@ -1569,7 +1691,8 @@ std::vector<std::array<mpm::Index, 2>> mpm::Mesh<Tdim>::particles_cells()
 
 //! Write particles to HDF5
 template <unsigned Tdim>
-bool mpm::Mesh<Tdim>::write_particles_hdf5(const std::string& filename) {
+bool mpm::Mesh<Tdim>::write_particles_hdf5(const std::string& filename,
+                                           bool compress) {
   const unsigned nparticles = this->nparticles();
 
   std::vector<PODParticle> particle_data;
@@ -1585,9 +1708,10 @@ bool mpm::Mesh<Tdim>::write_particles_hdf5(const std::string& filename) {
   const hsize_t NFIELDS = mpm::pod::particle::NFIELDS;
 
   hid_t file_id;
-  hsize_t chunk_size = 10000;
+  // Chunks are bounded by the number of particles, and compressed on request
+  const hsize_t chunk_size =
+      std::max<hsize_t>(1, std::min<hsize_t>(NRECORDS, 65536));
   int* fill_data = NULL;
-  int compress = 0;
 
   // Create a new file using default properties.
   file_id =
@@ -1597,7 +1721,8 @@ bool mpm::Mesh<Tdim>::write_particles_hdf5(const std::string& filename) {
   H5TBmake_table("Table Title", file_id, "table", NFIELDS, NRECORDS,
                  mpm::pod::particle::dst_size, mpm::pod::particle::field_names,
                  mpm::pod::particle::dst_offset, mpm::pod::particle::field_type,
-                 chunk_size, fill_data, compress, particle_data.data());
+                 chunk_size, fill_data, static_cast<int>(compress),
+                 particle_data.data());
 
   H5Fclose(file_id);
   return true;
@@ -1606,7 +1731,7 @@ bool mpm::Mesh<Tdim>::write_particles_hdf5(const std::string& filename) {
 //! Write particles to HDF5 for two-phase particle
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::write_particles_hdf5_twophase(
-    const std::string& filename) {
+    const std::string& filename, bool compress) {
   const unsigned nparticles = this->nparticles();
 
   std::vector<PODParticleTwoPhase> particle_data;
@@ -1623,9 +1748,10 @@ bool mpm::Mesh<Tdim>::write_particles_hdf5_twophase(
   const hsize_t NFIELDS = mpm::pod::particletwophase::NFIELDS;
 
   hid_t file_id;
-  hsize_t chunk_size = 10000;
+  // Chunks are bounded by the number of particles, and compressed on request
+  const hsize_t chunk_size =
+      std::max<hsize_t>(1, std::min<hsize_t>(NRECORDS, 65536));
   int* fill_data = NULL;
-  int compress = 0;
 
   // Create a new file using default properties.
   file_id =
@@ -1637,7 +1763,7 @@ bool mpm::Mesh<Tdim>::write_particles_hdf5_twophase(
                  mpm::pod::particletwophase::field_names,
                  mpm::pod::particletwophase::dst_offset,
                  mpm::pod::particletwophase::field_type, chunk_size, fill_data,
-                 compress, particle_data.data());
+                 static_cast<int>(compress), particle_data.data());
 
   H5Fclose(file_id);
   return true;
@@ -1791,6 +1917,87 @@ std::vector<mpm::PODParticle> mpm::Mesh<Tdim>::particles_hdf5() const {
   return particles_hdf5;
 }
 
+//! POD particles of a particle type
+template <unsigned Tdim>
+template <typename Tpod>
+std::vector<Tpod> mpm::Mesh<Tdim>::pod_particles(
+    const std::string& particle_type) const {
+  std::vector<Tpod> pods;
+  pods.reserve(this->nparticles());
+
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
+    if ((*pitr)->type() != particle_type) continue;
+    auto pod = std::static_pointer_cast<Tpod>((*pitr)->pod());
+    pods.emplace_back(*pod);
+  }
+  return pods;
+}
+
+//! Create particles from POD particles
+template <unsigned Tdim>
+template <typename Tpod>
+void mpm::Mesh<Tdim>::create_pod_particles(const std::vector<Tpod>& pods,
+                                           const std::string& particle_type) {
+  // Coordinates are initialised from the POD particle
+  const Eigen::Matrix<double, Tdim, 1> coords =
+      Eigen::Matrix<double, Tdim, 1>::Zero();
+
+  for (const auto& pod : pods) {
+    auto particle =
+        Factory<mpm::ParticleBase<Tdim>, mpm::Index,
+                const Eigen::Matrix<double, Tdim, 1>&>::instance()
+            ->create(particle_type, static_cast<mpm::Index>(pod.id), coords);
+
+    // Initialise particle with the POD data
+    Tpod pod_particle = pod;
+    particle->initialise_particle(pod_particle, this->pod_materials(pod));
+
+    if (!this->add_particle(particle, false))
+      throw std::runtime_error("Addition of particle to mesh failed!");
+  }
+}
+
+//! Materials of a POD particle
+template <unsigned Tdim>
+std::vector<std::shared_ptr<mpm::Material<Tdim>>>
+    mpm::Mesh<Tdim>::pod_materials(const mpm::PODParticle& pod) const {
+  return {materials_.at(pod.material_id)};
+}
+
+//! Materials of a two-phase POD particle
+template <unsigned Tdim>
+std::vector<std::shared_ptr<mpm::Material<Tdim>>>
+    mpm::Mesh<Tdim>::pod_materials(const mpm::PODParticleTwoPhase& pod) const {
+  return {materials_.at(pod.material_id),
+          materials_.at(pod.liquid_material_id)};
+}
+
+//! Nodal velocity constraints
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, unsigned, double>>
+    mpm::Mesh<Tdim>::nodal_velocity_constraints() const {
+  std::vector<std::tuple<mpm::Index, unsigned, double>> constraints;
+  for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr)
+    for (const auto& constraint : (*nitr)->velocity_constraints())
+      constraints.emplace_back((*nitr)->id(), constraint.first,
+                               constraint.second);
+  return constraints;
+}
+
+//! Assign nodal velocity constraints
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::assign_nodal_velocity_constraints(
+    const std::vector<std::tuple<mpm::Index, unsigned, double>>&
+        constraints) {
+  for (const auto& constraint : constraints) {
+    const mpm::Index nid = std::get<0>(constraint);
+    if (map_nodes_.find(nid) == map_nodes_.end()) continue;
+    if (!map_nodes_[nid]->assign_velocity_constraint(std::get<1>(constraint),
+                                                     std::get<2>(constraint)))
+      throw std::runtime_error("Nodal velocity constraint is not assigned");
+  }
+}
+
 //! Nodal coordinates
 template <unsigned Tdim>
 std::vector<Eigen::Matrix<double, 3, 1>> mpm::Mesh<Tdim>::nodal_coordinates()
@@ -2188,32 +2395,42 @@ void mpm::Mesh<Tdim>::create_nodal_properties() {
   // Check if nodes_ and materials_is empty and throw runtime error if they
   // are
   if (nodes_.size() != 0 && materials_.size() != 0) {
-    // Compute number of rows in nodal properties for vector entities
-    const unsigned nrows = nodes_.size() * Tdim;
-    // Create pool data for each property in the nodal properties struct
-    // object. Properties must be named in the plural form
-    nodal_properties_->create_property("masses", nodes_.size(),
-                                       materials_.size());
-    nodal_properties_->create_property("momenta", nrows, materials_.size());
-    nodal_properties_->create_property("change_in_momenta", nrows,
-                                       materials_.size());
-    nodal_properties_->create_property("displacements", nrows,
-                                       materials_.size());
-    nodal_properties_->create_property("separation_vectors", nrows,
-                                       materials_.size());
-    nodal_properties_->create_property("domain_gradients", nrows,
-                                       materials_.size());
-    nodal_properties_->create_property("normal_unit_vectors", nrows,
-                                       materials_.size());
-    nodal_properties_->create_property("wave_velocities", nrows,
-                                       materials_.size());
-    nodal_properties_->create_property("density", nodes_.size(),
-                                       materials_.size());
+    // Handles of the properties, their names and number of components.
+    // Properties must be named in the plural form
+    const std::vector<std::tuple<mpm::nodal_property::Handle, std::string,
+                                 unsigned>>
+        properties = {
+            {mpm::nodal_property::Masses, "masses", 1},
+            {mpm::nodal_property::Momenta, "momenta", Tdim},
+            {mpm::nodal_property::ChangeInMomenta, "change_in_momenta", Tdim},
+            {mpm::nodal_property::Displacements, "displacements", Tdim},
+            {mpm::nodal_property::SeparationVectors, "separation_vectors",
+             Tdim},
+            {mpm::nodal_property::DomainGradients, "domain_gradients", Tdim},
+            {mpm::nodal_property::NormalUnitVectors, "normal_unit_vectors",
+             Tdim},
+            {mpm::nodal_property::WaveVelocities, "wave_velocities", 2},
+            {mpm::nodal_property::Density, "density", 1}};
+    // Material ids index the materials of the property data
+    unsigned nmaterials = 0;
+    for (const auto& material : materials_)
+      nmaterials = std::max(nmaterials, material.first + 1);
+    // The values are read by handle, so every property has to be created
+    // with the handle it is registered with
+    for (const auto& property : properties) {
+      const unsigned handle = nodal_properties_->create_property(
+          std::get<1>(property), nodes_.size(), nmaterials,
+          std::get<2>(property));
+      if (handle != std::get<0>(property))
+        throw std::runtime_error("Nodal property " + std::get<1>(property) +
+                                 " is not created with its handle");
+    }
 
     // Iterate over all nodes to initialise the property handle in each node
-    // and assign its node id as the prop id in the nodal property data pool
-    for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr)
-      (*nitr)->initialise_property_handle((*nitr)->id(), nodal_properties_);
+    // and assign its index as the prop id in the nodal property data pool
+    unsigned prop_id = 0;
+    for (auto nitr = nodes_.cbegin(); nitr != nodes_.cend(); ++nitr, ++prop_id)
+      (*nitr)->initialise_property_handle(prop_id, nodal_properties_);
   } else {
     throw std::runtime_error("Number of nodes or number of materials is zero");
   }
@@ -112,10 +112,10 @@ bool mpm::Mesh<Tdim>::compute_free_surface_by_geometry(
     }
   }
 
-  // Compute particle neighbours for particles at candidate cells
+  // Compute particle neighbours, read for particles at candidate cells
   std::vector<mpm::Index> free_surface_candidate_particles_first;
+  this->find_particle_neighbours();
   for (const auto cell_id : free_surface_candidate_cells) {
-    this->find_particle_neighbours(map_cells_[cell_id]);
     const auto& particle_ids = map_cells_[cell_id]->particles();
     free_surface_candidate_particles_first.insert(
         free_surface_candidate_particles_first.end(), particle_ids.begin(),
@@ -148,7 +148,7 @@ bool mpm::Mesh<Tdim>::compute_free_surface_by_geometry(
     // Loop over neighbours
     const auto& particle = map_particles_[p_id];
     const auto& p_coord = particle->coordinates();
-    const auto& neighbour_particles = particle->neighbours();
+    const auto neighbour_particles = this->particle_neighbours(particle);
     const double smoothing_length = 1.33 * particle->diameter();
     for (const auto neighbour_particle_id : neighbour_particles) {
       const auto& n_coord =
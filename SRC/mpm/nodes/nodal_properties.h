@@ -2,7 +2,11 @@
 #define MPM_NODAL_PROPERTIES_H_
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace mpm {
 
@@ -10,20 +14,91 @@ namespace mpm {
 typedef Eigen::Matrix<double, Eigen::Dynamic, 1> MatrixProperty;
 typedef Eigen::Map<const MatrixProperty> MapProperty;
 
+//! Handles of the multimaterial contact properties. Mesh::create_nodal_properties
+//! registers every property with its handle and throws if the handle returned
+//! by create_property differs
+namespace nodal_property {
+enum Handle : unsigned {
+  Masses = 0,
+  Momenta = 1,
+  ChangeInMomenta = 2,
+  Displacements = 3,
+  SeparationVectors = 4,
+  DomainGradients = 5,
+  NormalUnitVectors = 6,
+  WaveVelocities = 7,
+  Density = 8
+};
+}  // namespace nodal_property
+
 // \brief Multimaterial parameters on each node
+// \details Properties are created once and identified by integer handles.
+// Values are stored contiguously for each property, node and material, so
+// that the values of all materials of a node are adjacent in memory.
 struct NodalProperties {
 
-  //! Function to create new property with given name and size (rows x cols)
+  //! Function to create new property with given name and size
+  //! \param[in] property Property name
+  //! \param[in] nnodes Number of nodes
+  //! \param[in] nmaterials Number of materials
+  //! \param[in] ncomponents Number of components (1 if scalar, Tdim if
+  //! vector)
+  //! \retval handle Handle of the property
+  unsigned create_property(const std::string& property, unsigned nnodes,
+                           unsigned nmaterials, unsigned ncomponents = 1);
+
+  //! Return the handle of a property
   //! \param[in] property Property name
-  //! \param[in] rows Number of nodes times the number of the dimension of the
-  //! property (1 if scalar, Tdim if vector)
-  //! \param[in] columns Number of materials
-  bool create_property(const std::string& property, unsigned rows,
-                       unsigned columns);
+  unsigned handle(const std::string& property) const;
 
   //! Initialise all the nodal values for all properties in the property pool
   void initialise_nodal_properties();
 
+  //! Return the values of a property at a node for a material
+  //! \param[in] handle Property handle
+  //! \param[in] node_id Id of the node within the property data
+  //! \param[in] mat_id Id of the material within the property data
+  double* values(unsigned handle, unsigned node_id, unsigned mat_id) {
+    return data_.data() + offsets_[handle] +
+           (static_cast<std::size_t>(node_id) * nmaterials_[handle] + mat_id) *
+               ncomponents_[handle];
+  }
+
+  //! Return the values of a property at a node for a material
+  //! \param[in] handle Property handle
+  //! \param[in] node_id Id of the node within the property data
+  //! \param[in] mat_id Id of the material within the property data
+  const double* values(unsigned handle, unsigned node_id,
+                       unsigned mat_id) const {
+    return data_.data() + offsets_[handle] +
+           (static_cast<std::size_t>(node_id) * nmaterials_[handle] + mat_id) *
+               ncomponents_[handle];
+  }
+
+  //! Assign property values to a pair of node and material
+  //! \param[in] handle Property handle
+  //! \param[in] node_id Id of the node within the property data
+  //! \param[in] mat_id Id of the material within the property data
+  //! \param[in] property_value Property values to be assigned
+  //! \param[in] nprops Dimension of property (1 if scalar, Tdim if vector)
+  void assign_property(unsigned handle, unsigned node_id, unsigned mat_id,
+                       const double* property_value, unsigned nprops = 1) {
+    std::copy(property_value, property_value + nprops,
+              this->values(handle, node_id, mat_id));
+  }
+
+  //! Add property values to a pair of node and material
+  //! \param[in] handle Property handle
+  //! \param[in] node_id Id of the node within the property data
+  //! \param[in] mat_id Id of the material within the property data
+  //! \param[in] property_value Property values to be added
+  //! \param[in] nprops Dimension of property (1 if scalar, Tdim if vector)
+  void update_property(unsigned handle, unsigned node_id, unsigned mat_id,
+                       const double* property_value, unsigned nprops = 1) {
+    double* values = this->values(handle, node_id, mat_id);
+    for (unsigned i = 0; i < nprops; ++i) values[i] += property_value[i];
+  }
+
   // Return data in the nodal properties map at a specific index
   // \param[in] property Property name
   // \param[in] node_id Id of the node within the property data
@@ -52,9 +127,19 @@ struct NodalProperties {
                        unsigned mat_id, const Eigen::MatrixXd& property_value,
                        unsigned nprops = 1);
 
-  // Map of properties and their nodal values
-  std::map<std::string, Eigen::MatrixXd> properties_;
+  // Handles of the properties
+  std::map<std::string, unsigned> handles_;
+  // Offsets of the values of each property
+  std::vector<std::size_t> offsets_;
+  // Number of materials of each property
+  std::vector<unsigned> nmaterials_;
+  // Number of components of each property
+  std::vector<unsigned> ncomponents_;
+  // Values of all properties [property][node][material][component]
+  std::vector<double> data_;
 };  // NodalProperties struct
 }  // namespace mpm
 
+#include "nodal_properties.tcc"
+
 #endif  // MPM_NODAL_PROPERTIES_H_
@@ -0,0 +1,59 @@
+//! Create a new property with given name and size
+inline unsigned mpm::NodalProperties::create_property(
+    const std::string& property, unsigned nnodes, unsigned nmaterials,
+    unsigned ncomponents) {
+  // Existing properties keep their handle
+  const auto itr = handles_.find(property);
+  if (itr != handles_.end()) return itr->second;
+
+  const unsigned handle = offsets_.size();
+  handles_.emplace(property, handle);
+  offsets_.emplace_back(data_.size());
+  nmaterials_.emplace_back(nmaterials);
+  ncomponents_.emplace_back(ncomponents);
+  data_.resize(data_.size() + static_cast<std::size_t>(nnodes) * nmaterials *
+                                  ncomponents,
+               0.);
+  return handle;
+}
+
+//! Return the handle of a property
+inline unsigned mpm::NodalProperties::handle(
+    const std::string& property) const {
+  const auto itr = handles_.find(property);
+  if (itr == handles_.end())
+    throw std::runtime_error("Nodal property " + property + " is not found");
+  return itr->second;
+}
+
+//! Initialise all the nodal values for all properties
+inline void mpm::NodalProperties::initialise_nodal_properties() {
+  const std::size_t size = data_.size();
+  double* data = data_.data();
+#pragma omp parallel for schedule(static)
+  for (std::size_t i = 0; i < size; ++i) data[i] = 0.;
+}
+
+//! Return data of a property at a node for a material
+inline Eigen::MatrixXd mpm::NodalProperties::property(
+    const std::string& property, unsigned node_id, unsigned mat_id,
+    unsigned nprops) const {
+  return MapProperty(this->values(this->handle(property), node_id, mat_id),
+                     nprops);
+}
+
+//! Assign property value to a pair of node and material
+inline void mpm::NodalProperties::assign_property(
+    const std::string& property, unsigned node_id, unsigned mat_id,
+    const Eigen::MatrixXd& property_value, unsigned nprops) {
+  this->assign_property(this->handle(property), node_id, mat_id,
+                        property_value.data(), nprops);
+}
+
+//! Update property value of a pair of node and material
+inline void mpm::NodalProperties::update_property(
+    const std::string& property, unsigned node_id, unsigned mat_id,
+    const Eigen::MatrixXd& property_value, unsigned nprops) {
+  this->update_property(this->handle(property), node_id, mat_id,
+                        property_value.data(), nprops);
+}
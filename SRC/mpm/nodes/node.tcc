@@ -891,15 +891,16 @@ bool mpm::Node<Tdim, Tdof, Tnphases>::apply_absorbing_constraint(
       auto mat_id = material_ids_.begin();
 
       // Extract material properties and displacements
-      double pwave_v = this->property_handle_->property(
-          "wave_velocities", prop_id_, *mat_id, 2)(0);
-      double swave_v = this->property_handle_->property(
-          "wave_velocities", prop_id_, *mat_id, 2)(1);
-      double density =
-          this->property_handle_->property("density", prop_id_, *mat_id)(0);
+      const double* wave_velocities = this->property_handle_->values(
+          mpm::nodal_property::WaveVelocities, prop_id_, *mat_id);
+      double pwave_v = wave_velocities[0];
+      double swave_v = wave_velocities[1];
+      double density = *this->property_handle_->values(
+          mpm::nodal_property::Density, prop_id_, *mat_id);
       Eigen::Matrix<double, Tdim, 1> material_displacement =
-          this->property_handle_->property("displacements", prop_id_, *mat_id,
-                                           Tdim);
+          Eigen::Map<const Eigen::Matrix<double, Tdim, 1>>(
+              this->property_handle_->values(
+                  mpm::nodal_property::Displacements, prop_id_, *mat_id));
 
       // Update quantities based on nodal mass
       pwave_v /= this->mass(*mat_id);
@@ -998,6 +999,22 @@ void mpm::Node<Tdim, Tdof, Tnphases>::update_property(
   node_mutex_.unlock();
 }
 
+//! Update nodal property at the nodes from particle
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+void mpm::Node<Tdim, Tdof, Tnphases>::update_property(
+    bool update, unsigned handle, const double* property_value,
+    unsigned mat_id, unsigned nprops) noexcept {
+  // Update/assign property
+  node_mutex_.lock();
+  if (update)
+    property_handle_->update_property(handle, prop_id_, mat_id, property_value,
+                                      nprops);
+  else
+    property_handle_->assign_property(handle, prop_id_, mat_id, property_value,
+                                      nprops);
+  node_mutex_.unlock();
+}
+
 //! Compute multimaterial change in momentum
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 void mpm::Node<Tdim, Tdof,
@@ -1005,15 +1022,15 @@ void mpm::Node<Tdim, Tdof,
   // iterate over all materials in the material_ids set and update the change
   // in momentum
   node_mutex_.lock();
-  for (auto mitr = material_ids_.begin(); mitr != material_ids_.end(); ++mitr) {
-    const Eigen::Matrix<double, 1, 1> mass =
-        property_handle_->property("masses", prop_id_, *mitr);
-    const Eigen::Matrix<double, Tdim, 1> momentum =
-        property_handle_->property("momenta", prop_id_, *mitr, Tdim);
-    const Eigen::Matrix<double, Tdim, 1> change_in_momenta =
-        velocity_.col(mpm::NodePhase::NSolid) * mass - momentum;
-    property_handle_->update_property("change_in_momenta", prop_id_, *mitr,
-                                      change_in_momenta, Tdim);
+  const VectorDim velocity = velocity_.col(mpm::NodePhase::NSolid);
+  for (const auto mat_id : material_ids_) {
+    const double mass = *property_handle_->values(mpm::nodal_property::Masses,
+                                                  prop_id_, mat_id);
+    const Eigen::Map<const VectorDim> momentum(property_handle_->values(
+        mpm::nodal_property::Momenta, prop_id_, mat_id));
+    Eigen::Map<VectorDim> change_in_momentum(property_handle_->values(
+        mpm::nodal_property::ChangeInMomenta, prop_id_, mat_id));
+    change_in_momentum.noalias() += velocity * mass - momentum;
   }
   node_mutex_.unlock();
 }
@@ -1026,35 +1043,34 @@ void mpm::Node<Tdim, Tdof,
   // displacements and calculate the displacement of the center of mass for
   // this node
   node_mutex_.lock();
-  for (auto mitr = material_ids_.begin(); mitr != material_ids_.end(); ++mitr) {
-    const auto& material_displacement =
-        property_handle_->property("displacements", prop_id_, *mitr, Tdim);
-    const auto& material_mass =
-        property_handle_->property("masses", prop_id_, *mitr);
+  for (const auto mat_id : material_ids_) {
+    Eigen::Map<VectorDim> material_displacement(property_handle_->values(
+        mpm::nodal_property::Displacements, prop_id_, mat_id));
+    const double material_mass = *property_handle_->values(
+        mpm::nodal_property::Masses, prop_id_, mat_id);
 
     // displacement of the center of mass
     contact_displacement_.noalias() += material_displacement / mass_(0, 0);
     // assign nodal-multimaterial displacement by dividing it by this
     // material's mass
-    property_handle_->assign_property(
-        "displacements", prop_id_, *mitr,
-        material_displacement / material_mass(0, 0), Tdim);
+    material_displacement /= material_mass;
   }
 
   // iterate over all materials in the material_ids to compute the separation
   // vector
-  for (auto mitr = material_ids_.begin(); mitr != material_ids_.end(); ++mitr) {
-    const Eigen::Matrix<double, Tdim, 1> material_displacement =
-        property_handle_->property("displacements", prop_id_, *mitr, Tdim);
-    const Eigen::Matrix<double, 1, 1> material_mass =
-        property_handle_->property("masses", prop_id_, *mitr);
+  for (const auto mat_id : material_ids_) {
+    const Eigen::Map<const VectorDim> material_displacement(
+        property_handle_->values(mpm::nodal_property::Displacements, prop_id_,
+                                 mat_id));
+    const double material_mass = *property_handle_->values(
+        mpm::nodal_property::Masses, prop_id_, mat_id);
 
     // Update the separation vector property
-    const auto& separation_vector =
+    Eigen::Map<VectorDim> separation_vector(property_handle_->values(
+        mpm::nodal_property::SeparationVectors, prop_id_, mat_id));
+    separation_vector.noalias() +=
         (contact_displacement_ - material_displacement) * mass_(0, 0) /
-        (mass_(0, 0) - material_mass(0, 0));
-    property_handle_->update_property("separation_vectors", prop_id_, *mitr,
-                                      separation_vector, Tdim);
+        (mass_(0, 0) - material_mass);
   }
   node_mutex_.unlock();
 }
@@ -1065,17 +1081,17 @@ void mpm::Node<Tdim, Tdof,
                Tnphases>::compute_multimaterial_normal_unit_vector() {
   // Iterate over all materials in the material_ids set
   node_mutex_.lock();
-  for (auto mitr = material_ids_.begin(); mitr != material_ids_.end(); ++mitr) {
+  for (const auto mat_id : material_ids_) {
     // calculte the normal unit vector
-    VectorDim domain_gradient =
-        property_handle_->property("domain_gradients", prop_id_, *mitr, Tdim);
-    VectorDim normal_unit_vector = VectorDim::Zero();
+    const Eigen::Map<const VectorDim> domain_gradient(property_handle_->values(
+        mpm::nodal_property::DomainGradients, prop_id_, mat_id));
+    Eigen::Map<VectorDim> normal_unit_vector(property_handle_->values(
+        mpm::nodal_property::NormalUnitVectors, prop_id_, mat_id));
+    // assign nodal-multimaterial normal unit vector to property pool
     if (domain_gradient.norm() > std::numeric_limits<double>::epsilon())
       normal_unit_vector = domain_gradient.normalized();
-
-    // assign nodal-multimaterial normal unit vector to property pool
-    property_handle_->assign_property("normal_unit_vectors", prop_id_, *mitr,
-                                      normal_unit_vector, Tdim);
+    else
+      normal_unit_vector.setZero();
   }
   node_mutex_.unlock();
 }
@@ -317,6 +317,16 @@ class NodeBase {
                                const Eigen::MatrixXd& property_value,
                                unsigned mat_id, unsigned nprops) noexcept = 0;
 
+  //! Update nodal property at the nodes from particle
+  //! \param[in] update A boolean to update (true) or assign (false)
+  //! \param[in] handle Property handle
+  //! \param[in] property_value Property values from the particles in the cell
+  //! \param[in] mat_id Id of the material within the property data
+  //! \param[in] nprops Dimension of property (1 if scalar, Tdim if vector)
+  virtual void update_property(bool update, unsigned handle,
+                               const double* property_value, unsigned mat_id,
+                               unsigned nprops) noexcept = 0;
+
   //! Compute multimaterial change in momentum
   virtual void compute_multimaterial_change_in_momentum() = 0;
 
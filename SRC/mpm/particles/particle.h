@@ -204,6 +204,29 @@ class Particle : public ParticleBase<Tdim> {
   void compute_stress(double dt, mpm::StressRate stress_rate =
                                      mpm::StressRate::None) noexcept override;
 
+  //! Return inputs of a material-batched stress update
+  //! \param[out] stress Stress at the start of the update
+  //! \param[out] dstrain Strain increment
+  //! \param[out] state_vars Solid phase history-dependent state variables
+  //! \retval status Always true for infinitesimal strain particles
+  bool stress_update_inputs(Eigen::Matrix<double, 6, 1>* stress,
+                            Eigen::Matrix<double, 6, 1>* dstrain,
+                            mpm::dense_map** state_vars) noexcept override {
+    *stress = stress_;
+    *dstrain = dstrain_;
+    *state_vars = &state_variables_[mpm::ParticlePhase::Solid];
+    return true;
+  }
+
+  //! Update stress from the material part of a stress update
+  //! \param[in] material_stress Stress returned by the material
+  //! \param[in] dt Analysis time step
+  //! \param[in] stress_rate Use Cauchy or Jaumann rate of stress
+  void update_material_stress(
+      const Eigen::Matrix<double, 6, 1>& material_stress, double dt,
+      mpm::StressRate stress_rate =
+          mpm::StressRate::None) noexcept override;
+
   //! Return stress of the particle
   Eigen::Matrix<double, 6, 1> stress() const override { return stress_; }
 
@@ -348,17 +371,6 @@ class Particle : public ParticleBase<Tdim> {
   //! Return normal vector
   VectorDim normal() const override { return normal_; };
 
-  //! Return the number of neighbour particles
-  unsigned nneighbours() const override { return neighbours_.size(); };
-
-  //! Assign neighbour particles
-  //! \param[in] neighbours set of id of the neighbouring particles
-  //! \retval insertion_status Return the successful addition of a node
-  void assign_neighbours(const std::vector<mpm::Index>& neighbours) override;
-
-  //! Return neighbour ids
-  std::vector<mpm::Index> neighbours() const override { return neighbours_; }
-
   //! Type of particle
   std::string type() const override { return (Tdim == 2) ? "P2D" : "P3D"; }
 
@@ -593,7 +605,6 @@ class Particle : public ParticleBase<Tdim> {
   //! State variables
   using ParticleBase<Tdim>::state_variables_;
   //! Neighbour particles
-  using ParticleBase<Tdim>::neighbours_;
   //! Volumetric mass density (mass / volume)
   double mass_density_{0.};
   //! Mass
@@ -604,6 +615,12 @@ class Particle : public ParticleBase<Tdim> {
   Eigen::Matrix<double, Tdim, 1> size_;
   //! Size of particle in natural coordinates
   Eigen::Matrix<double, Tdim, 1> natural_size_;
+  //! Converged Lagrange multiplier of LME shape functions
+  Eigen::Matrix<double, Tdim, 1> lme_lambda_;
+  //! Coordinates at which shape functions were last computed
+  Eigen::Matrix<double, Tdim, 1> shapefn_coordinates_;
+  //! Cell id in which shape functions were last computed
+  Index shapefn_cell_id_{std::numeric_limits<Index>::max()};
   //! Stresses
   Eigen::Matrix<double, 6, 1> stress_;
   //! Strains
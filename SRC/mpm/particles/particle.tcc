@@ -312,6 +312,8 @@ void mpm::Particle<Tdim>::initialise() {
   dstrain_.setZero();
   mass_ = 0.;
   natural_size_.setZero();
+  lme_lambda_.setZero();
+  shapefn_cell_id_ = std::numeric_limits<Index>::max();
   set_traction_ = false;
   size_.setZero();
   strain_rate_.setZero();
@@ -535,16 +537,35 @@ void mpm::Particle<Tdim>::compute_shapefn() noexcept {
   // Get element ptr of a cell
   const auto element = cell_->element_ptr();
 
+  // Reuse shape functions if the particle moved less than the skip tolerance
+  // of the element within the same cell
+  const double skip_tolerance = element->shapefn_skip_tolerance();
+  if (skip_tolerance > 0. && shapefn_cell_id_ == cell_id_ &&
+      static_cast<unsigned>(shapefn_.size()) == element->nfunctions() &&
+      (coordinates_ - shapefn_coordinates_).norm() < skip_tolerance)
+    return;
+
   // Deformation Gradient
   const Eigen::Matrix<double, Tdim, Tdim> def_grad =
       this->deformation_gradient_.block(0, 0, Tdim, Tdim);
 
+  // LME shape functions are warm started from the converged Lagrange
+  // multiplier of the previous step, other elements take the particle size
+  const auto sf_type = element->shapefn_type();
+  auto& shapefn_parameter = (sf_type == mpm::ShapefnType::LME ||
+                             sf_type == mpm::ShapefnType::ALME)
+                                ? this->lme_lambda_
+                                : this->natural_size_;
+
   // Compute shape function of the particle
-  shapefn_ = element->shapefn(this->xi_, this->natural_size_, def_grad);
+  shapefn_ = element->shapefn(this->xi_, shapefn_parameter, def_grad);
 
   // Compute dN/dx
   dn_dx_ = element->dn_dx(this->xi_, cell_->nodal_coordinates(),
-                          this->natural_size_, def_grad);
+                          shapefn_parameter, def_grad);
+
+  shapefn_cell_id_ = cell_id_;
+  shapefn_coordinates_ = coordinates_;
 }
 
 // Assign volume to the particle
@@ -721,16 +742,15 @@ void mpm::Particle<Tdim>::map_multimaterial_mass_momentum_to_nodes() noexcept {
   // Check if particle mass is set
   assert(mass_ != std::numeric_limits<double>::max());
 
-  // Unit 1x1 Eigen matrix to be used with scalar quantities
-  Eigen::Matrix<double, 1, 1> nodal_mass;
-
   // Map mass and momentum to nodal property taking into account the material id
   for (unsigned i = 0; i < nodes_.size(); ++i) {
-    nodal_mass(0, 0) = mass_ * shapefn_[i];
-    nodes_[i]->update_property(true, "masses", nodal_mass, this->material_id(),
-                               1);
-    nodes_[i]->update_property(true, "momenta", velocity_ * nodal_mass,
-                               this->material_id(), Tdim);
+    const double nodal_mass = mass_ * shapefn_[i];
+    const VectorDim nodal_momentum = velocity_ * nodal_mass;
+    nodes_[i]->update_property(true, mpm::nodal_property::Masses, &nodal_mass,
+                               this->material_id(), 1);
+    nodes_[i]->update_property(true, mpm::nodal_property::Momenta,
+                               nodal_momentum.data(), this->material_id(),
+                               Tdim);
   }
 }
 
@@ -743,9 +763,9 @@ void mpm::Particle<Tdim>::map_multimaterial_displacements_to_nodes() noexcept {
   // Map displacements to nodal property and divide it by the respective
   // nodal-material mass
   for (unsigned i = 0; i < nodes_.size(); ++i) {
-    const auto& displacement = mass_ * shapefn_[i] * displacement_;
-    nodes_[i]->update_property(true, "displacements", displacement,
-                               this->material_id(), Tdim);
+    const VectorDim displacement = mass_ * shapefn_[i] * displacement_;
+    nodes_[i]->update_property(true, mpm::nodal_property::Displacements,
+                               displacement.data(), this->material_id(), Tdim);
   }
 }
 
@@ -761,17 +781,14 @@ void mpm::Particle<
   for (unsigned i = 0; i < nodes_.size(); ++i) {
     Eigen::Matrix<double, Tdim, 1> gradient;
     for (unsigned j = 0; j < Tdim; ++j) gradient[j] = volume_ * dn_dx_(i, j);
-    nodes_[i]->update_property(true, "domain_gradients", gradient,
-                               this->material_id(), Tdim);
+    nodes_[i]->update_property(true, mpm::nodal_property::DomainGradients,
+                               gradient.data(), this->material_id(), Tdim);
   }
 }
 
 //! Map linear elastic wave velocities to nodes
 template <unsigned Tdim>
 void mpm::Particle<Tdim>::map_wave_velocities_to_nodes() noexcept {
-  // Unit 1x1 Eigen matrix to store scalar quantities
-  Eigen::Matrix<double, 1, 1> density;
-
   // 2x1 Eigen matrix to store pressure and shear wave velocities
   Eigen::Matrix<double, 2, 1> wave_velocities;
   const double pwave =
@@ -785,11 +802,11 @@ void mpm::Particle<Tdim>::map_wave_velocities_to_nodes() noexcept {
   for (unsigned i = 0; i < nodes_.size(); ++i) {
     wave_velocities(0) = pwave * mass_ * shapefn_[i];
     wave_velocities(1) = swave * mass_ * shapefn_[i];
-    density(0) = this->mass_density_ * mass_ * shapefn_[i];
-    nodes_[i]->update_property(true, "wave_velocities", wave_velocities,
-                               this->material_id(), 2);
-    nodes_[i]->update_property(true, "density", density, this->material_id(),
-                               1);
+    const double density = this->mass_density_ * mass_ * shapefn_[i];
+    nodes_[i]->update_property(true, mpm::nodal_property::WaveVelocities,
+                               wave_velocities.data(), this->material_id(), 2);
+    nodes_[i]->update_property(true, mpm::nodal_property::Density, &density,
+                               this->material_id(), 1);
   }
 }
 
@@ -883,6 +900,14 @@ void mpm::Particle<Tdim>::compute_stress(double dt,
           ->compute_stress(stress_, dstrain_, this,
                            &state_variables_[mpm::ParticlePhase::Solid]);
 
+  this->update_material_stress(material_part_voigt, dt, stress_rate);
+}
+
+// Update stress from the material part of a stress update
+template <unsigned Tdim>
+void mpm::Particle<Tdim>::update_material_stress(
+    const Eigen::Matrix<double, 6, 1>& material_part_voigt, double dt,
+    mpm::StressRate stress_rate) noexcept {
   switch (stress_rate) {
     case mpm::StressRate::None:
       // Update stress
@@ -1122,8 +1147,9 @@ void mpm::Particle<Tdim>::compute_updated_position_asflip(
   // Compute particle ASFLIP beta parameter
   const double beta = this->compute_asflip_beta(dt);
 
-  // Update particle velocity from interpolated nodal acceleration
-  const auto flip_velocity = this->velocity_ + nodal_acceleration * dt;
+  // Update particle velocity from interpolated nodal acceleration, evaluated
+  // before the particle velocity is overwritten
+  const VectorDim flip_velocity = this->velocity_ + nodal_acceleration * dt;
   // If intermediate scheme is considered
   this->velocity_ =
       blending_ratio * flip_velocity + (1.0 - blending_ratio) * nodal_velocity;
@@ -1282,15 +1308,6 @@ bool mpm::Particle<Tdim>::compute_free_surface_by_density(
   return status;
 };
 
-//! Assign neighbour particles
-template <unsigned Tdim>
-void mpm::Particle<Tdim>::assign_neighbours(
-    const std::vector<mpm::Index>& neighbours) {
-  neighbours_ = neighbours;
-  neighbours_.erase(std::remove(neighbours_.begin(), neighbours_.end(), id_),
-                    neighbours_.end());
-}
-
 //! Compute size of serialized particle data
 template <unsigned Tdim>
 int mpm::Particle<Tdim>::compute_pack_size() const {
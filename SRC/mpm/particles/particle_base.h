@@ -259,6 +259,25 @@ class ParticleBase {
       double dt,
       mpm::StressRate stress_rate = mpm::StressRate::None) noexcept = 0;
 
+  //! Return inputs of a material-batched stress update
+  //! \param[out] stress Stress at the start of the update
+  //! \param[out] dstrain Strain increment
+  //! \param[out] state_vars Solid phase history-dependent state variables
+  //! \retval status False if the particle updates its stress by itself
+  virtual bool stress_update_inputs(Eigen::Matrix<double, 6, 1>* stress,
+                                    Eigen::Matrix<double, 6, 1>* dstrain,
+                                    mpm::dense_map** state_vars) noexcept {
+    return false;
+  }
+
+  //! Update stress from the material part of a stress update
+  //! \param[in] material_stress Stress returned by the material
+  //! \param[in] dt Analysis time step
+  //! \param[in] stress_rate Use Cauchy or Jaumann rate of stress
+  virtual void update_material_stress(
+      const Eigen::Matrix<double, 6, 1>& material_stress, double dt,
+      mpm::StressRate stress_rate = mpm::StressRate::None) noexcept {}
+
   //! Return stress
   virtual Eigen::Matrix<double, 6, 1> stress() const = 0;
 
@@ -340,17 +359,6 @@ class ParticleBase {
   //! Return normal vector
   virtual VectorDim normal() const = 0;
 
-  //! Return the number of neighbour particles
-  virtual unsigned nneighbours() const = 0;
-
-  //! Assign neighbour particles
-  //! \param[in] neighbours set of id of the neighbouring particles
-  //! \retval insertion_status Return the successful addition of a node
-  virtual void assign_neighbours(const std::vector<mpm::Index>& neighbours) = 0;
-
-  //! Return neighbour ids
-  virtual std::vector<mpm::Index> neighbours() const = 0;
-
   //! Type of particle
   virtual std::string type() const = 0;
 
@@ -621,8 +629,6 @@ class ParticleBase {
   std::vector<unsigned> material_id_;
   //! Material state history variables
   std::vector<mpm::dense_map> state_variables_;
-  //! Vector of particle neighbour ids
-  std::vector<mpm::Index> neighbours_;
 };  // ParticleBase class
 }  // namespace mpm
 
@@ -83,6 +83,14 @@ class ParticleFiniteStrain : public mpm::Particle<Tdim> {
   void compute_stress(double dt, mpm::StressRate stress_rate =
                                      mpm::StressRate::None) noexcept override;
 
+  //! Finite strain particles update their stress by themselves
+  //! \retval status Always false
+  bool stress_update_inputs(Eigen::Matrix<double, 6, 1>* stress,
+                            Eigen::Matrix<double, 6, 1>* dstrain,
+                            mpm::dense_map** state_vars) noexcept override {
+    return false;
+  }
+
   /**
    * \defgroup Implicit Functions dealing with implicit MPM
    */
@@ -35,11 +35,14 @@ class FluidParticle : public mpm::Particle<Tdim> {
   //! Delete assignment operator
   FluidParticle& operator=(const FluidParticle<Tdim>&) = delete;
 
-  //! Compute stress
+  //! Update stress from the material part of a stress update
+  //! \param[in] material_stress Stress returned by the material
   //! \param[in] dt Analysis time step
-  //! \param[in] stress_rate Use Cauchy or Jaumann rate of stress
-  void compute_stress(double dt, mpm::StressRate stress_rate =
-                                     mpm::StressRate::None) noexcept override;
+  //! \param[in] stress_rate Unused, fluid stress is not rotated
+  void update_material_stress(
+      const Eigen::Matrix<double, 6, 1>& material_stress, double dt,
+      mpm::StressRate stress_rate =
+          mpm::StressRate::None) noexcept override;
 
   //! Map internal force
   inline void map_internal_force() noexcept override;
@@ -9,12 +9,13 @@ mpm::FluidParticle<Tdim>::FluidParticle(Index id, const VectorDim& coord)
   console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
 }
 
-// Compute stress
+// Update stress from the material part of a stress update
 template <unsigned Tdim>
-void mpm::FluidParticle<Tdim>::compute_stress(
-    double dt, mpm::StressRate stress_rate) noexcept {
-  // Run particle compute stress
-  mpm::Particle<Tdim>::compute_stress(dt);
+void mpm::FluidParticle<Tdim>::update_material_stress(
+    const Eigen::Matrix<double, 6, 1>& material_stress, double dt,
+    mpm::StressRate stress_rate) noexcept {
+  // Assign material stress
+  mpm::Particle<Tdim>::update_material_stress(material_stress, dt);
 
   // Calculate fluid turbulent stress
   this->stress_.noalias() += this->compute_turbulent_stress();
@@ -10,10 +10,12 @@
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
+#include "checkpoint.h"
 #include "io.h"
 #include "io_mesh.h"
 #include "io_mesh_ascii.h"
 #include "mesh.h"
+#include "vtu_writer.h"
 
 #ifdef USE_VTK
 #include "vtk_writer.h"
@@ -76,6 +78,9 @@ class MPM {
   //! Write HDF5 files
   virtual void write_hdf5(mpm::Index step, mpm::Index max_steps) = 0;
 
+  //! Write binary VTU files
+  virtual void write_vtu(mpm::Index step, mpm::Index max_steps) = 0;
+
 #ifdef USE_VTK
   //! Write VTK files
   virtual void write_vtk(mpm::Index step, mpm::Index max_steps) = 0;
@@ -92,6 +97,8 @@ class MPM {
   double dt_{std::numeric_limits<double>::max()};
   //! Current step
   mpm::Index step_{0};
+  //! Current time
+  double time_{0.};
   //! Number of steps
   mpm::Index nsteps_{std::numeric_limits<mpm::Index>::max()};
   //! Output steps
@@ -3,6 +3,8 @@
 
 #include <numeric>
 
+#include <omp.h>
+
 #include <boost/lexical_cast.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
@@ -18,6 +20,8 @@
 
 #ifdef USE_GRAPH_PARTITIONING
 #include "graph.h"
+#else
+#include "geometric_partition.h"
 #endif
 
 #include "constraints.h"
@@ -30,6 +34,7 @@
 #include "mpm_scheme_usf.h"
 #include "mpm_scheme_usl.h"
 #include "particle.h"
+#include "phase_timer.h"
 #include "solver_base.h"
 #include "vector.h"
 
@@ -84,6 +89,23 @@ class MPMBase : public MPM {
   //! \param[in] initial_step Start of simulation or later steps
   void mpi_domain_decompose(bool initial_step = false) override;
 
+  //! Compute the time step size from the CFL condition in adaptive mode
+  //! \details Clamped to the minimum and maximum time step, and shortened to
+  //! reach the next output time and the final time exactly. Throws if a
+  //! particle uses a material without elastic moduli.
+  //! \param[in] nphases Number of material phases of particles
+  void update_time_step(unsigned nphases = 1);
+
+  //! Return true if there are steps left within the number of steps and the
+  //! final time
+  bool steps_remaining() const {
+    return (step_ < nsteps_) && (time_ < final_time_ * (1. - 1.E-12));
+  }
+
+  //! Particle load imbalance across MPI ranks
+  //! \retval imbalance Maximum over mean number of particles per rank minus 1
+  double load_imbalance() const;
+
   //! Output results
   //! \param[in] step Time step
   void write_outputs(mpm::Index step) override;
@@ -116,6 +138,24 @@ class MPMBase : public MPM {
   //! Write HDF5 files
   void write_hdf5(mpm::Index step, mpm::Index max_steps) override;
 
+  //! Write binary VTU files
+  void write_vtu(mpm::Index step, mpm::Index max_steps) override;
+
+  //! Write a binary checkpoint in the background
+  //! \param[in] step Current step
+  void write_checkpoint(mpm::Index step);
+
+  //! Restore particles, nodal constraints and time from a binary checkpoint
+  //! \param[in] step Step of the checkpoint
+  void read_checkpoint(mpm::Index step);
+
+  //! Field layouts of the POD particles of each particle type
+  std::map<std::string, mpm::Checkpoint::Layout> checkpoint_layouts() const;
+
+  //! Report the time spent in each phase of the steps, and write the
+  //! timings as JSON if phase timings are enabled
+  void write_phase_timings();
+
 #ifdef USE_VTK
   //! Write VTK files
   void write_vtk(mpm::Index step, mpm::Index max_steps) override;
@@ -239,6 +279,8 @@ class MPMBase : public MPM {
   using mpm::MPM::dt_;
   //! Current step
   using mpm::MPM::step_;
+  //! Current time
+  using mpm::MPM::time_;
   //! Number of steps
   using mpm::MPM::nsteps_;
   //! Output steps
@@ -282,6 +324,40 @@ class MPMBase : public MPM {
   tsl::robin_map<mpm::VariableType, std::vector<std::string>> vtk_vars_;
   //! VTK state variables
   tsl::robin_map<unsigned, std::vector<std::string>> vtk_statevars_;
+  //! Write VTK outputs as binary VTU files
+  bool vtu_output_{false};
+  //! VTU writer, keeps buffers and writes in the background
+  std::unique_ptr<mpm::VtuWriter> vtu_writer_{nullptr};
+  //! Compress HDF5 outputs
+  bool hdf5_compression_{false};
+  //! Number of steps between checkpoints
+  mpm::Index checkpoint_steps_{0};
+  //! Checkpoint writer, keeps the last checkpoints
+  std::unique_ptr<mpm::Checkpoint> checkpoint_{nullptr};
+  //! Timer of the phases of steps, shared with the stress update scheme
+  std::shared_ptr<mpm::PhaseTimer> phase_timer_{
+      std::make_shared<mpm::PhaseTimer>()};
+  //! Write the timings of the phases of steps as JSON
+  bool phase_timings_{false};
+  //! Adaptive time step from the CFL condition
+  bool adaptive_time_step_{false};
+  //! Safety factor (Courant number) of the adaptive time step
+  double cfl_safety_factor_{0.5};
+  //! Minimum adaptive time step
+  double min_dt_{0.};
+  //! Maximum adaptive time step
+  double max_dt_{std::numeric_limits<double>::max()};
+  //! Average cell size for the CFL condition
+  double cell_size_{0.};
+  //! Compressional wave velocities of the materials by material id, NaN for
+  //! materials without elastic moduli
+  std::vector<double> pwave_velocities_;
+  //! Final time of the analysis
+  double final_time_{std::numeric_limits<double>::max()};
+  //! Time interval between outputs, outputs every output_steps_ if zero
+  double output_time_interval_{0.};
+  //! Time of the next output
+  double next_output_time_{0.};
   //! Set node concentrated force
   bool set_node_concentrated_force_{false};
   //! Damping type
@@ -305,9 +381,14 @@ class MPMBase : public MPM {
   unsigned node_neighbourhood_{1};
   /**@}*/
 
+  // Particle load imbalance (max / mean - 1) to trigger load balancing
+  double load_imbalance_tolerance_{0.};
 #ifdef USE_GRAPH_PARTITIONING
   // graph pass the address of the container of cell
   std::shared_ptr<Graph<Tdim>> graph_{nullptr};
+#else
+  // Geometric partition of cells when graph partitioning is unavailable
+  std::shared_ptr<GeometricPartition<Tdim>> partition_{nullptr};
 #endif
 };  // MPMBase class
 }  // namespace mpm
@@ -42,11 +42,29 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
     // Number of time steps
     nsteps_ = analysis_["nsteps"].template get<mpm::Index>();
 
+    // Final time, limits the analysis together with the number of steps
+    if (analysis_.contains("final_time"))
+      final_time_ = analysis_["final_time"].template get<double>();
+
+    // Adaptive time step, dt is the maximum time step unless specified
+    if (analysis_.contains("adaptive_time_step")) {
+      const auto& adaptive = analysis_["adaptive_time_step"];
+      adaptive_time_step_ = true;
+      cfl_safety_factor_ = adaptive.value("safety_factor", cfl_safety_factor_);
+      min_dt_ = adaptive.value("min_dt", min_dt_);
+      max_dt_ = adaptive.value("max_dt", dt_);
+    }
+
     // nload balance
     if (analysis_.find("nload_balance_steps") != analysis_.end())
       nload_balance_steps_ =
           analysis_["nload_balance_steps"].template get<mpm::Index>();
 
+    // Load imbalance to trigger load balancing
+    if (analysis_.find("load_imbalance_tolerance") != analysis_.end())
+      load_imbalance_tolerance_ =
+          analysis_["load_imbalance_tolerance"].template get<double>();
+
     // Locate particles
     if (analysis_.find("locate_particles") != analysis_.end())
       locate_particles_ = analysis_["locate_particles"].template get<bool>();
@@ -139,6 +157,10 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
     post_process_ = io_->post_processing();
     // Output steps
     output_steps_ = post_process_["output_steps"].template get<mpm::Index>();
+    // Output time interval
+    if (post_process_.contains("output_time_interval"))
+      output_time_interval_ =
+          post_process_["output_time_interval"].template get<double>();
 
   } catch (std::domain_error& domain_error) {
     console_->error("{} {} Get analysis object: {}", __FILE__, __LINE__,
@@ -206,6 +228,35 @@ mpm::MPMBase<Tdim>::MPMBase(const std::shared_ptr<IO>& io) : mpm::MPM(io) {
     console_->warn(
         "{} #{}: No VTK statevariable were specified, none will be generated",
         __FILE__, __LINE__);
+
+  // VTK output format, "vtu" writes binary VTU files in the background
+  if (post_process_.contains("vtk_format") &&
+      post_process_.at("vtk_format").template get<std::string>() == "vtu") {
+    vtu_output_ = true;
+    vtu_writer_ = std::make_unique<mpm::VtuWriter>();
+  }
+
+  // Compression of HDF5 outputs
+  if (post_process_.contains("hdf5_compression"))
+    hdf5_compression_ =
+        post_process_.at("hdf5_compression").template get<bool>();
+
+  // Binary checkpoints for restarts, keeps the last checkpoints and writes
+  // delta checkpoints between full checkpoints
+  if (post_process_.contains("checkpoint")) {
+    const auto& checkpoint = post_process_.at("checkpoint");
+    checkpoint_steps_ = checkpoint.value("steps", output_steps_);
+    checkpoint_ = std::make_unique<mpm::Checkpoint>(
+        [this](mpm::Index step) {
+          return io_->output_file("checkpoint", ".ckpt", uuid_, step, nsteps_)
+              .string();
+        },
+        checkpoint.value("retain", 2u), checkpoint.value("full_interval", 1u));
+  }
+
+  // Timings of the phases of steps
+  if (post_process_.contains("phase_timings"))
+    phase_timings_ = post_process_.at("phase_timings").template get<bool>();
 }
 
 // Initialise mesh
@@ -499,6 +550,23 @@ void mpm::MPMBase<Tdim>::initialise_materials() {
           "mpm::base::init_materials(): New material cannot be added, "
           "insertion failed");
   }
+
+  // Wave velocities of the adaptive time step, materials without elastic
+  // moduli are skipped and may not be used by particles
+  if (adaptive_time_step_) {
+    pwave_velocities_.clear();
+    for (const auto& material : materials_) {
+      if (material.first >= pwave_velocities_.size())
+        pwave_velocities_.resize(material.first + 1, 0.);
+      try {
+        pwave_velocities_[material.first] = material.second->pwave_velocity();
+      } catch (std::exception& exception) {
+        console_->warn("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+        pwave_velocities_[material.first] =
+            std::numeric_limits<double>::quiet_NaN();
+      }
+    }
+  }
   // Copy materials to mesh
   mesh_->initialise_material_models(this->materials_);
 }
@@ -506,6 +574,13 @@ void mpm::MPMBase<Tdim>::initialise_materials() {
 //! Checkpoint resume
 template <unsigned Tdim>
 bool mpm::MPMBase<Tdim>::checkpoint_resume() {
+  // A binary checkpoint cannot be read without its settings, and the HDF5
+  // particles of the step may not exist
+  if (analysis_.contains("resume") &&
+      analysis_["resume"].value("checkpoint", false) && !checkpoint_)
+    throw std::runtime_error(
+        "Resume from a checkpoint requires post_processing checkpoint");
+
   bool checkpoint = true;
   try {
     int mpi_rank = 0;
@@ -523,20 +598,34 @@ bool mpm::MPMBase<Tdim>::checkpoint_resume() {
     this->uuid_ = analysis_["resume"]["uuid"].template get<std::string>();
     // Get step
     this->step_ = analysis_["resume"]["step"].template get<mpm::Index>();
+    // Time at the checkpoint, required to resume adaptive time steps
+    this->time_ = analysis_["resume"].value("time", this->step_ * this->dt_);
 
-    // Input particle h5 file for resume
-    for (const auto ptype : particle_types_) {
-      std::string attribute = mpm::ParticlePODTypeName.at(ptype);
-      std::string extension = ".h5";
+    if (analysis_["resume"].value("checkpoint", false)) {
+      // Restore from the binary checkpoint
+      this->read_checkpoint(step_);
+    } else {
+      // Input particle h5 file for resume
+      for (const auto ptype : particle_types_) {
+        std::string attribute = mpm::ParticlePODTypeName.at(ptype);
+        std::string extension = ".h5";
 
-      auto particles_file =
-          io_->output_file(attribute, extension, uuid_, step_, this->nsteps_)
-              .string();
+        auto particles_file =
+            io_->output_file(attribute, extension, uuid_, step_, this->nsteps_)
+                .string();
 
-      // Load particle information from file
-      mesh_->read_particles_hdf5(particles_file, attribute, ptype);
+        // Load particle information from file
+        mesh_->read_particles_hdf5(particles_file, attribute, ptype);
+      }
     }
 
+    // Checkpoints of the earlier run are pruned as new ones are written
+    if (checkpoint_) checkpoint_->resume(step_);
+
+    if (output_time_interval_ > 0.)
+      next_output_time_ =
+          std::ceil(time_ / output_time_interval_) * output_time_interval_;
+
     // Clear all particle ids
     mesh_->iterate_over_cells(
         std::bind(&mpm::Cell<Tdim>::clear_particle_ids, std::placeholders::_1));
@@ -572,12 +661,193 @@ void mpm::MPMBase<Tdim>::write_hdf5(mpm::Index step, mpm::Index max_steps) {
 
     // Load particle information from file
     if (attribute == "particles" || attribute == "fluid_particles")
-      mesh_->write_particles_hdf5(particles_file);
+      mesh_->write_particles_hdf5(particles_file, hdf5_compression_);
     else if (attribute == "twophase_particles")
-      mesh_->write_particles_hdf5_twophase(particles_file);
+      mesh_->write_particles_hdf5_twophase(particles_file, hdf5_compression_);
   }
 }
 
+//! Field layouts of the POD particles of each particle type
+template <unsigned Tdim>
+std::map<std::string, mpm::Checkpoint::Layout>
+    mpm::MPMBase<Tdim>::checkpoint_layouts() const {
+  std::map<std::string, mpm::Checkpoint::Layout> layouts;
+  for (const auto& ptype : particle_types_) {
+    if (mpm::ParticlePODTypeName.at(ptype) == "twophase_particles")
+      layouts[ptype] = {mpm::pod::particletwophase::NFIELDS,
+                        mpm::pod::particletwophase::dst_offset,
+                        mpm::pod::particletwophase::dst_sizes};
+    else
+      layouts[ptype] = {mpm::pod::particle::NFIELDS,
+                        mpm::pod::particle::dst_offset,
+                        mpm::pod::particle::dst_sizes};
+  }
+  return layouts;
+}
+
+//! Write a binary checkpoint
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::write_checkpoint(mpm::Index step) {
+  // Waits for the previous checkpoint before its buffers are reused
+  auto& snapshot = checkpoint_->initialise(step, time_, dt_);
+
+  const auto layouts = this->checkpoint_layouts();
+  for (const auto& ptype : particle_types_) {
+    if (mpm::ParticlePODTypeName.at(ptype) == "twophase_particles") {
+      const auto pods =
+          mesh_->template pod_particles<mpm::PODParticleTwoPhase>(ptype);
+      checkpoint_->add_particles(ptype, layouts.at(ptype), pods.data(),
+                                 pods.size(),
+                                 sizeof(mpm::PODParticleTwoPhase));
+    } else {
+      const auto pods = mesh_->template pod_particles<mpm::PODParticle>(ptype);
+      checkpoint_->add_particles(ptype, layouts.at(ptype), pods.data(),
+                                 pods.size(), sizeof(mpm::PODParticle));
+    }
+  }
+  snapshot.constraints = mesh_->nodal_velocity_constraints();
+
+  // Encoding and writing run in the background
+  checkpoint_->write();
+}
+
+//! Restore from a binary checkpoint
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::read_checkpoint(mpm::Index step) {
+  const auto layouts = this->checkpoint_layouts();
+  const auto snapshot = checkpoint_->read(step, layouts);
+
+  for (const auto& particles : snapshot.particles) {
+    const std::string& ptype = particles.first;
+    const auto& layout = layouts.at(ptype);
+    const std::size_t nrecords =
+        particles.second.size() / mpm::Checkpoint::record_size(layout);
+    if (mpm::ParticlePODTypeName.at(ptype) == "twophase_particles") {
+      std::vector<mpm::PODParticleTwoPhase> pods(nrecords);
+      mpm::Checkpoint::unpack(particles.second, layout, pods.data(),
+                              sizeof(mpm::PODParticleTwoPhase));
+      mesh_->create_pod_particles(pods, ptype);
+    } else {
+      std::vector<mpm::PODParticle> pods(nrecords);
+      mpm::Checkpoint::unpack(particles.second, layout, pods.data(),
+                              sizeof(mpm::PODParticle));
+      mesh_->create_pod_particles(pods, ptype);
+    }
+  }
+
+  // Nodal velocity constraints at the checkpoint
+  mesh_->assign_nodal_velocity_constraints(snapshot.constraints);
+
+  this->time_ = snapshot.time;
+  this->dt_ = snapshot.dt;
+}
+
+//! Write binary VTU files
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::write_vtu(mpm::Index step, mpm::Index max_steps) {
+  // Waits for the previous output before its buffers are reused
+  vtu_writer_->initialise(mesh_->nparticles());
+
+  // Coordinates padded to three components
+  mesh_->gather_particles_data(
+      3,
+      [](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+         double* data) {
+        const auto coordinates = particle->coordinates();
+        for (unsigned i = 0; i < 3; ++i)
+          data[i] = (i < Tdim) ? coordinates(i) : 0.;
+      },
+      vtu_writer_->points());
+
+  //! Scalar variables
+  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Scalar))
+    mesh_->gather_particles_data(
+        1,
+        [&attribute](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+                     double* data) {
+          data[0] = particle->scalar_data(attribute);
+        },
+        vtu_writer_->add_point_data(attribute, 1));
+
+  //! Vector variables padded to three components
+  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Vector))
+    mesh_->gather_particles_data(
+        3,
+        [&attribute](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+                     double* data) {
+          const auto vector = particle->vector_data(attribute);
+          for (Eigen::Index i = 0; i < 3; ++i)
+            data[i] = (i < vector.size()) ? vector(i) : 0.;
+        },
+        vtu_writer_->add_point_data(attribute, 3));
+
+  //! Tensor variables in Voigt notation
+  for (const auto& attribute : vtk_vars_.at(mpm::VariableType::Tensor))
+    mesh_->gather_particles_data(
+        6,
+        [&attribute](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+                     double* data) {
+          const auto tensor = particle->tensor_data(attribute);
+          for (Eigen::Index i = 0; i < 6; ++i)
+            data[i] = (i < tensor.size()) ? tensor(i) : 0.;
+        },
+        vtu_writer_->add_point_data(attribute, 6));
+
+  //! State variables
+  for (const auto& vtk_statevar : vtk_statevars_) {
+    const unsigned phase_id = vtk_statevar.first;
+    for (const auto& attribute : vtk_statevar.second)
+      mesh_->gather_particles_data(
+          1,
+          [&attribute, phase_id](
+              const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle,
+              double* data) {
+            data[0] = particle->state_variable(attribute, phase_id);
+          },
+          vtu_writer_->add_point_data(
+              "phase" + std::to_string(phase_id) + attribute, 1));
+  }
+
+  // One piece per rank, written while the next steps are computed
+  const auto file = io_->output_file("particles", ".vtu", uuid_, step,
+                                     max_steps);
+  vtu_writer_->write(file.string());
+
+#ifdef USE_MPI
+  int mpi_rank = 0;
+  int mpi_size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+  if (mpi_size > 1) {
+    // Gather the file names of the pieces on rank 0
+    const std::string piece = file.filename().string();
+    int length = piece.size();
+    std::vector<int> lengths(mpi_size, 0);
+    MPI_Gather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0,
+               MPI_COMM_WORLD);
+    std::vector<int> displacements(mpi_size, 0);
+    for (int i = 1; i < mpi_size; ++i)
+      displacements[i] = displacements[i - 1] + lengths[i - 1];
+    std::vector<char> names(displacements.back() + lengths.back());
+    MPI_Gatherv(piece.data(), length, MPI_CHAR, names.data(), lengths.data(),
+                displacements.data(), MPI_CHAR, 0, MPI_COMM_WORLD);
+
+    if (mpi_rank == 0) {
+      std::vector<std::string> pieces;
+      for (int i = 0; i < mpi_size; ++i)
+        pieces.emplace_back(names.data() + displacements[i], lengths[i]);
+      const bool write_mpi_rank = false;
+      vtu_writer_->write_parallel_index(
+          io_->output_file("particles", ".pvtu", uuid_, step, max_steps,
+                           write_mpi_rank)
+              .string(),
+          pieces);
+    }
+  }
+#endif
+}
+
 #ifdef USE_VTK
 //! Write VTK files
 template <unsigned Tdim>
@@ -733,18 +1003,74 @@ void mpm::MPMBase<Tdim>::write_partio(mpm::Index step, mpm::Index max_steps) {
 //! Output results
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::write_outputs(mpm::Index step) {
-  if (step % this->output_steps_ == 0) {
+  bool output = (step % this->output_steps_ == 0);
+  // Outputs at time intervals
+  if (output_time_interval_ > 0.) {
+    const double tolerance = 1.E-9 * output_time_interval_;
+    output = (time_ + tolerance >= next_output_time_);
+    while (next_output_time_ <= time_ + tolerance)
+      next_output_time_ += output_time_interval_;
+  }
+
+  if (output) {
     // HDF5 outputs
     this->write_hdf5(step, this->nsteps_);
+    // VTK outputs, as binary VTU files or through the VTK library
+    if (vtu_output_) this->write_vtu(step, this->nsteps_);
 #ifdef USE_VTK
-    // VTK outputs
-    this->write_vtk(step, this->nsteps_);
+    else
+      this->write_vtk(step, this->nsteps_);
 #endif
 #ifdef USE_PARTIO
     // Partio outputs
     this->write_partio(step, this->nsteps_);
 #endif
   }
+
+  // Binary checkpoints
+  if (checkpoint_ && checkpoint_steps_ > 0 && step % checkpoint_steps_ == 0)
+    this->write_checkpoint(step);
+}
+
+//! Report and write the timings of the phases of steps
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::write_phase_timings() {
+  int mpi_rank = 0;
+#ifdef USE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+#endif
+
+  // Throughput of each phase in particles times steps per second
+  for (unsigned i = 0; i < mpm::PhaseTimer::nphases; ++i) {
+    const auto phase = static_cast<mpm::SchemePhase>(i);
+    if (phase_timer_->seconds(phase) > 0.)
+      console_->info("Rank {}, {}: {:.3f} s, {:.4g} particle-steps/s",
+                     mpi_rank, mpm::PhaseTimer::name(phase),
+                     phase_timer_->seconds(phase),
+                     phase_timer_->throughput(phase));
+  }
+
+  if (!phase_timings_) return;
+
+  Json timings;
+  timings["analysis"] = io_->analysis_type();
+  timings["scheme"] = mpm_scheme_ ? mpm_scheme_->scheme() : stress_update_;
+  timings["dimension"] = Tdim;
+  timings["nthreads"] = omp_get_max_threads();
+  timings["mpi_rank"] = mpi_rank;
+  timings["nparticles"] = mesh_->nparticles();
+  timings["nnodes"] = mesh_->nnodes();
+  timings["ncells"] = mesh_->ncells();
+  timings["timings"] = phase_timer_->json();
+
+  const auto file =
+      io_->output_file("phase_timings", ".json", uuid_, 0, 0).string();
+  std::ofstream json_file(file);
+  if (json_file.is_open())
+    json_file << timings.dump(2) << "\n";
+  else
+    console_->error("{} #{}: Failed to write phase timings to {}\n", __FILE__,
+                    __LINE__, file);
 }
 
 //! Return if a mesh is isoparametric
@@ -1695,14 +2021,26 @@ void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
     auto mpi_domain_begin = std::chrono::steady_clock::now();
     console_->info("Rank {}, Domain decomposition started\n", mpi_rank);
 
+    // Find number of particles in each cell across MPI ranks
+    mesh_->find_nglobal_particles_cells();
+
+    // Skip load balancing while the particle load is balanced
+    if (!initial_step && load_imbalance_tolerance_ > 0.) {
+      const double imbalance = this->load_imbalance();
+      if (imbalance <= load_imbalance_tolerance_) {
+        if (mpi_rank == 0)
+          console_->info("Load imbalance {} within tolerance {}", imbalance,
+                         load_imbalance_tolerance_);
+        MPI_Comm_free(&comm);
+        return;
+      }
+    }
+
 #ifdef USE_GRAPH_PARTITIONING
     // Create graph object if empty
     if (initial_step || graph_ == nullptr)
       graph_ = std::make_shared<Graph<Tdim>>(mesh_->cells());
 
-    // Find number of particles in each cell across MPI ranks
-    mesh_->find_nglobal_particles_cells();
-
     // Construct a weighted DAG
     graph_->construct_graph(mpi_size, mpi_rank);
 
@@ -1712,6 +2050,14 @@ void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
     graph_->create_partitions(&comm, mode);
     // Collect the partitions
     auto exchange_cells = graph_->collect_partitions(mpi_size, mpi_rank, &comm);
+#else
+    // Create geometric partition object if empty
+    if (initial_step || partition_ == nullptr)
+      partition_ = std::make_shared<GeometricPartition<Tdim>>(mesh_->cells());
+
+    // Recursive coordinate bisection weighted by particles
+    auto exchange_cells = partition_->create_partitions(mpi_size);
+#endif
 
     // Identify shared nodes across MPI domains
     mesh_->find_domain_shared_nodes();
@@ -1724,7 +2070,7 @@ void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
     else
       mesh_->transfer_nonrank_particles(exchange_cells);
 
-#endif
+    MPI_Comm_free(&comm);
     auto mpi_domain_end = std::chrono::steady_clock::now();
     console_->info("Rank {}, Domain decomposition: {} ms", mpi_rank,
                    std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -1734,6 +2080,52 @@ void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
 #endif  // MPI
 }
 
+//! Compute the time step size from the CFL condition
+template <unsigned Tdim>
+void mpm::MPMBase<Tdim>::update_time_step(unsigned nphases) {
+  if (!adaptive_time_step_) return;
+
+  // Background mesh is fixed
+  if (cell_size_ <= 0.) cell_size_ = mesh_->compute_average_cell_size();
+
+  // A time step above the stable one is never taken, the analysis stops
+  // when the critical time step is unknown
+  double dt = cfl_safety_factor_ *
+              mesh_->critical_time_step(cell_size_, pwave_velocities_, nphases);
+  dt = std::min(std::max(dt, min_dt_), max_dt_);
+
+  // Reach the next output time and the final time exactly
+  if (output_time_interval_ > 0. && next_output_time_ > time_)
+    dt = std::min(dt, next_output_time_ - time_);
+  if (final_time_ > time_) dt = std::min(dt, final_time_ - time_);
+
+  dt_ = dt;
+}
+
+//! Particle load imbalance across MPI ranks
+template <unsigned Tdim>
+double mpm::MPMBase<Tdim>::load_imbalance() const {
+  double imbalance = 0.;
+#ifdef USE_MPI
+  // Get number of MPI ranks
+  int mpi_size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+  const unsigned long long nparticles = mesh_->nparticles();
+  unsigned long long max_nparticles = 0;
+  unsigned long long total_nparticles = 0;
+  MPI_Allreduce(&nparticles, &max_nparticles, 1, MPI_UNSIGNED_LONG_LONG,
+                MPI_MAX, MPI_COMM_WORLD);
+  MPI_Allreduce(&nparticles, &total_nparticles, 1, MPI_UNSIGNED_LONG_LONG,
+                MPI_SUM, MPI_COMM_WORLD);
+  // Mean number of particles per rank
+  const double mean_nparticles =
+      static_cast<double>(total_nparticles) / mpi_size;
+  if (mean_nparticles > 0.) imbalance = max_nparticles / mean_nparticles - 1.;
+#endif
+  return imbalance;
+}
+
 //! MPM pressure smoothing
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::pressure_smoothing(unsigned phase) {
@@ -1916,6 +2308,15 @@ void mpm::MPMBase<Tdim>::initialise_nonlocal_mesh(const Json& mesh_props) {
         nonlocal_properties.insert(
             std::pair<std::string, bool>("anisotropy", anisotropy));
 
+        // Particle displacement below which shape functions are reused
+        double skip_tolerance = 0.;
+        if (mesh_props["nonlocal_mesh_properties"].contains("skip_tolerance"))
+          skip_tolerance =
+              mesh_props["nonlocal_mesh_properties"]["skip_tolerance"]
+                  .template get<double>();
+        nonlocal_properties.insert(
+            std::pair<std::string, double>("skip_tolerance", skip_tolerance));
+
         // Calculate beta
         const double beta = gamma / (h * h);
         nonlocal_properties.insert(
@@ -29,6 +29,8 @@ class MPMExplicit : public MPMBase<Tdim> {
   using mpm::MPMBase<Tdim>::dt_;
   //! Current step
   using mpm::MPMBase<Tdim>::step_;
+  //! Current time
+  using mpm::MPMBase<Tdim>::time_;
   //! Number of steps
   using mpm::MPMBase<Tdim>::nsteps_;
   //! Number of steps
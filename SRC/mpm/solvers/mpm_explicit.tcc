@@ -11,6 +11,7 @@ mpm::MPMExplicit<Tdim>::MPMExplicit(const std::shared_ptr<IO>& io)
     mpm_scheme_ = std::make_shared<mpm::MPMSchemeMUSL<Tdim>>(mesh_, dt_);
   else
     mpm_scheme_ = std::make_shared<mpm::MPMSchemeUSF<Tdim>>(mesh_, dt_);
+  mpm_scheme_->assign_phase_timer(this->phase_timer_);
 
   //! Interface scheme
   if (this->interface_)
@@ -78,9 +79,7 @@ bool mpm::MPMExplicit<Tdim>::solve() {
     } else {
       mesh_->resume_domain_cell_ranks();
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
       MPI_Barrier(MPI_COMM_WORLD);
-#endif
 #endif
     }
     //! Particle entity sets and velocity constraints
@@ -109,20 +108,22 @@ bool mpm::MPMExplicit<Tdim>::solve() {
 
   auto solver_begin = std::chrono::steady_clock::now();
   // Main loop
-  for (; step_ < nsteps_; ++step_) {
+  for (; this->steps_remaining(); ++step_) {
 
     if (mpi_rank == 0) console_->info("Step: {} of {}.\n", step_, nsteps_);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
     // Run load balancer at a specified frequency
     if (step_ % nload_balance_steps_ == 0 && step_ != 0)
       this->mpi_domain_decompose(false);
 #endif
-#endif
+
+    // Time step size from the CFL condition in adaptive mode
+    this->update_time_step();
+    mpm_scheme_->assign_time_step(dt_, time_);
 
     // Inject particles
-    mesh_->inject_particles(step_ * dt_);
+    mesh_->inject_particles(time_);
 
     // Initialise nodes, cells and shape functions
     mpm_scheme_->initialise();
@@ -166,11 +167,12 @@ bool mpm::MPMExplicit<Tdim>::solve() {
     mpm_scheme_->locate_particles(this->locate_particles_);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
     mesh_->transfer_halo_particles();
     MPI_Barrier(MPI_COMM_WORLD);
 #endif
-#endif
+
+    // Advance time
+    time_ += dt_;
 
     // Write outputs
     this->write_outputs(this->step_ + 1);
@@ -181,6 +183,7 @@ bool mpm::MPMExplicit<Tdim>::solve() {
                  std::chrono::duration_cast<std::chrono::milliseconds>(
                      solver_end - solver_begin)
                      .count());
+  this->write_phase_timings();
 
   return status;
 }
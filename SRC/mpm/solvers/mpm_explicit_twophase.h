@@ -32,6 +32,8 @@ class MPMExplicitTwoPhase : public MPMBase<Tdim> {
   using mpm::MPMBase<Tdim>::dt_;
   //! Current step
   using mpm::MPMBase<Tdim>::step_;
+  //! Current time
+  using mpm::MPMBase<Tdim>::time_;
   //! Number of steps
   using mpm::MPMBase<Tdim>::nsteps_;
   //! Number of steps
@@ -17,9 +17,7 @@ void mpm::MPMExplicitTwoPhase<Tdim>::compute_stress_strain() {
   mesh_->iterate_over_particles(std::bind(
       &mpm::ParticleBase<Tdim>::update_volume, std::placeholders::_1));
   // Iterate over each particle to compute stress of soil skeleton
-  mesh_->iterate_over_particles(
-      std::bind(&mpm::ParticleBase<Tdim>::compute_stress, std::placeholders::_1,
-                dt_, mpm::StressRate::None));
+  mesh_->compute_particle_stresses(dt_, mpm::StressRate::None);
   // Pressure smoothing
   if (pressure_smoothing_) this->pressure_smoothing(mpm::ParticlePhase::Solid);
 
@@ -121,9 +119,7 @@ bool mpm::MPMExplicitTwoPhase<Tdim>::solve() {
     } else {
       mesh_->resume_domain_cell_ranks();
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
       MPI_Barrier(MPI_COMM_WORLD);
-#endif
 #endif
     }
     //! Particle entity sets and velocity constraints
@@ -157,20 +153,26 @@ bool mpm::MPMExplicitTwoPhase<Tdim>::solve() {
 
   auto solver_begin = std::chrono::steady_clock::now();
   // Main loop
-  for (; step_ < nsteps_; ++step_) {
+  for (; this->steps_remaining(); ++step_) {
 
     if (mpi_rank == 0) console_->info("Step: {} of {}.\n", step_, nsteps_);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
     // Run load balancer at a specified frequency
     if (step_ % nload_balance_steps_ == 0 && step_ != 0)
       this->mpi_domain_decompose(false);
 #endif
-#endif
+
+    // Time step size from the CFL condition of solid and liquid phases in
+    // adaptive mode
+    this->update_time_step(2);
 
     // Inject particles
-    mesh_->inject_particles(this->step_ * this->dt_);
+    mesh_->inject_particles(this->time_);
+
+    // Time the phases of the step
+    this->phase_timer_->add_step(mesh_->nparticles());
+    this->phase_timer_->start(mpm::SchemePhase::Initialise);
 
 #pragma omp parallel sections
     {
@@ -193,6 +195,8 @@ bool mpm::MPMExplicitTwoPhase<Tdim>::solve() {
       }
     }  // Wait to complete
 
+    this->phase_timer_->start(mpm::SchemePhase::NodalKinematics);
+
     // Assign mass and momentum to nodes
     mesh_->iterate_over_particles(
         std::bind(&mpm::ParticleBase<Tdim>::map_mass_momentum_to_nodes,
@@ -258,7 +262,12 @@ bool mpm::MPMExplicitTwoPhase<Tdim>::solve() {
         std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
 
     // Update stress first
-    if (this->stress_update_ == "usf") this->compute_stress_strain();
+    if (this->stress_update_ == "usf") {
+      this->phase_timer_->start(mpm::SchemePhase::StressStrain);
+      this->compute_stress_strain();
+    }
+
+    this->phase_timer_->start(mpm::SchemePhase::Forces);
 
       // Spawn a task for external force
 #pragma omp parallel sections
@@ -271,7 +280,7 @@ bool mpm::MPMExplicitTwoPhase<Tdim>::solve() {
                       std::placeholders::_1, this->gravity_));
 
         // Apply particle traction and map to nodes
-        mesh_->apply_traction_on_particles(this->step_ * this->dt_);
+        mesh_->apply_traction_on_particles(this->time_);
 
         // Iterate over each node to add concentrated node force to external
         // force
@@ -279,7 +288,7 @@ bool mpm::MPMExplicitTwoPhase<Tdim>::solve() {
           mesh_->iterate_over_nodes(
               std::bind(&mpm::NodeBase<Tdim>::apply_concentrated_force,
                         std::placeholders::_1, mpm::ParticlePhase::Solid,
-                        (this->step_ * this->dt_)));
+                        this->time_));
       }
 
 #pragma omp section
@@ -342,6 +351,8 @@ bool mpm::MPMExplicitTwoPhase<Tdim>::solve() {
     }
 #endif
 
+    this->phase_timer_->start(mpm::SchemePhase::Integrate);
+
     // Check if damping has been specified and accordingly Iterate over
     // active nodes to compute acceleratation and velocity
     if (damping_type_ == mpm::Damping::Cundall)
@@ -357,6 +368,8 @@ bool mpm::MPMExplicitTwoPhase<Tdim>::solve() {
                     std::placeholders::_1, this->dt_),
           std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
 
+    this->phase_timer_->start(mpm::SchemePhase::ParticleUpdate);
+
     // Update particle position and kinematics
     mesh_->iterate_over_particles(std::bind(
         &mpm::ParticleBase<Tdim>::compute_updated_position,
@@ -366,9 +379,13 @@ bool mpm::MPMExplicitTwoPhase<Tdim>::solve() {
     mesh_->apply_particle_velocity_constraints();
 
     // Update Stress Last
-    if (this->stress_update_ == "usl") this->compute_stress_strain();
+    if (this->stress_update_ == "usl") {
+      this->phase_timer_->start(mpm::SchemePhase::StressStrain);
+      this->compute_stress_strain();
+    }
 
     // Locate particles
+    this->phase_timer_->start(mpm::SchemePhase::Locate);
     auto unlocatable_particles = mesh_->locate_particles_mesh();
 
     if (!unlocatable_particles.empty() && this->locate_particles_)
@@ -379,11 +396,13 @@ bool mpm::MPMExplicitTwoPhase<Tdim>::solve() {
         mesh_->remove_particle(remove_particle);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
     mesh_->transfer_halo_particles();
     MPI_Barrier(MPI_COMM_WORLD);
 #endif
-#endif
+    this->phase_timer_->stop();
+
+    // Advance time
+    this->time_ += this->dt_;
 
     // Write outputs
     this->write_outputs(this->step_ + 1);
@@ -394,6 +413,7 @@ bool mpm::MPMExplicitTwoPhase<Tdim>::solve() {
                  std::chrono::duration_cast<std::chrono::milliseconds>(
                      solver_end - solver_begin)
                      .count());
+  this->write_phase_timings();
 
   return status;
 }
\ No newline at end of file
@@ -75,6 +75,8 @@ class MPMImplicit : public MPMBase<Tdim> {
   using mpm::MPMBase<Tdim>::dt_;
   //! Current step
   using mpm::MPMBase<Tdim>::step_;
+  //! Current time
+  using mpm::MPMBase<Tdim>::time_;
   //! Number of steps
   using mpm::MPMBase<Tdim>::nsteps_;
   //! Number of steps
@@ -20,6 +20,7 @@ mpm::MPMImplicit<Tdim>::MPMImplicit(const std::shared_ptr<IO>& io)
   double relative_residual_tolerance = 1.0e-6;
   if (stress_update_ == "newmark") {
     mpm_scheme_ = std::make_shared<mpm::MPMSchemeNewmark<Tdim>>(mesh_, dt_);
+    mpm_scheme_->assign_phase_timer(this->phase_timer_);
     if (analysis_.contains("scheme_settings")) {
       // Read boolean of nonlinear analysis
       if (analysis_["scheme_settings"].contains("nonlinear"))
@@ -126,9 +127,7 @@ bool mpm::MPMImplicit<Tdim>::solve() {
     } else {
       mesh_->resume_domain_cell_ranks();
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
       MPI_Barrier(MPI_COMM_WORLD);
-#endif
 #endif
     }
     //! Particle entity sets and velocity constraints
@@ -165,15 +164,16 @@ bool mpm::MPMImplicit<Tdim>::solve() {
     if (mpi_rank == 0) console_->info("Step: {} of {}.\n", step_, nsteps_);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
     // Run load balancer at a specified frequency
     if (step_ % nload_balance_steps_ == 0 && step_ != 0)
       this->mpi_domain_decompose(false);
 #endif
-#endif
+
+    // Assign time step size and current time
+    mpm_scheme_->assign_time_step(dt_, time_);
 
     // Inject particles
-    mesh_->inject_particles(step_ * dt_);
+    mesh_->inject_particles(time_);
 
     // Initialise nodes, cells and shape functions
     mpm_scheme_->initialise();
@@ -236,11 +236,12 @@ bool mpm::MPMImplicit<Tdim>::solve() {
     mpm_scheme_->locate_particles(this->locate_particles_);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
     mesh_->transfer_halo_particles();
     MPI_Barrier(MPI_COMM_WORLD);
 #endif
-#endif
+
+    // Advance time
+    time_ += dt_;
 
     // Write outputs
     this->write_outputs(this->step_ + 1);
@@ -251,6 +252,7 @@ bool mpm::MPMImplicit<Tdim>::solve() {
                  std::chrono::duration_cast<std::chrono::milliseconds>(
                      solver_end - solver_begin)
                      .count());
+  this->write_phase_timings();
 
   return status;
 }
@@ -353,7 +355,7 @@ bool mpm::MPMImplicit<Tdim>::reinitialise_matrix() {
     assembler_->assign_global_node_indices(nactive_node, nglobal_active_node);
 
     // Assign displacement constraints
-    assembler_->assign_displacement_constraints(this->step_ * this->dt_);
+    assembler_->assign_displacement_constraints(this->time_);
 
     // Initialise element matrix
     mesh_->iterate_over_cells(
@@ -446,6 +448,9 @@ bool mpm::MPMImplicit<Tdim>::assemble_system_equation() {
 template <unsigned Tdim>
 bool mpm::MPMImplicit<Tdim>::solve_system_equation() {
   bool status = true;
+  // Linear solves are part of the time integration
+  const auto timer =
+      this->phase_timer_->measure(mpm::SchemePhase::Integrate);
   try {
     // Solve matrix equation and assign solution to assembler
     assembler_->assign_displacement_increment(
@@ -6,6 +6,7 @@
 #endif
 
 #include "mesh.h"
+#include "phase_timer.h"
 
 namespace mpm {
 
@@ -18,6 +19,23 @@ class MPMScheme {
   //! Default constructor with mesh class
   MPMScheme(const std::shared_ptr<mpm::Mesh<Tdim>>& mesh, double dt);
 
+  //! Assign time step size and current time
+  //! \param[in] dt Time step size
+  //! \param[in] time Time at the beginning of the step
+  void assign_time_step(double dt, double time) {
+    dt_ = dt;
+    time_ = time;
+  }
+
+  //! Assign the timer of the phases of steps
+  //! \param[in] timer Phase timer shared with the solver
+  void assign_phase_timer(const std::shared_ptr<mpm::PhaseTimer>& timer) {
+    timer_ = timer;
+  }
+
+  //! Return the timer of the phases of steps
+  std::shared_ptr<mpm::PhaseTimer> phase_timer() const { return timer_; }
+
   //! Intialize
   virtual inline void initialise();
 
@@ -140,6 +158,10 @@ class MPMScheme {
   std::shared_ptr<mpm::Mesh<Tdim>> mesh_;
   //! Time increment
   double dt_;
+  //! Time at the beginning of the step
+  double time_{0.};
+  //! Timer of the phases of steps
+  std::shared_ptr<mpm::PhaseTimer> timer_{std::make_shared<mpm::PhaseTimer>()};
   //! MPI Size
   int mpi_size_ = 1;
   //! MPI rank
@@ -17,6 +17,9 @@ mpm::MPMScheme<Tdim>::MPMScheme(const std::shared_ptr<mpm::Mesh<Tdim>>& mesh,
 //! Initialize nodes, cells and shape functions
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::initialise() {
+  const auto timer = timer_->measure(mpm::SchemePhase::Initialise);
+  timer_->add_step(mesh_->nparticles());
+
 #pragma omp parallel sections
   {
     // Spawn a task for initialising nodes and cells
@@ -43,6 +46,8 @@ inline void mpm::MPMScheme<Tdim>::initialise() {
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_nodal_kinematics(
     mpm::VelocityUpdate velocity_update, unsigned phase) {
+  const auto timer = timer_->measure(mpm::SchemePhase::NodalKinematics);
+
   // Assign mass and momentum to nodes
   mesh_->iterate_over_particles(
       std::bind(&mpm::ParticleBase<Tdim>::map_mass_momentum_to_nodes,
@@ -74,6 +79,7 @@ inline void mpm::MPMScheme<Tdim>::compute_nodal_kinematics(
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_stress_strain(
     unsigned phase, bool pressure_smoothing, mpm::StressRate stress_rate) {
+  const auto timer = timer_->measure(mpm::SchemePhase::StressStrain);
 
   // Iterate over each particle to calculate strain
   mesh_->iterate_over_particles(std::bind(
@@ -86,10 +92,8 @@ inline void mpm::MPMScheme<Tdim>::compute_stress_strain(
   // Pressure smoothing
   if (pressure_smoothing) this->pressure_smoothing(phase);
 
-  // Iterate over each particle to compute stress
-  mesh_->iterate_over_particles(
-      std::bind(&mpm::ParticleBase<Tdim>::compute_stress, std::placeholders::_1,
-                dt_, stress_rate));
+  // Compute stress of particles, batched by material
+  mesh_->compute_particle_stresses(dt_, stress_rate);
 }
 
 //! Pressure smoothing
@@ -121,6 +125,8 @@ template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_forces(
     const Eigen::Matrix<double, Tdim, 1>& gravity, unsigned phase,
     unsigned step, bool concentrated_nodal_forces) {
+  const auto timer = timer_->measure(mpm::SchemePhase::Forces);
+
   // Spawn a task for external force
 #pragma omp parallel sections
   {
@@ -132,14 +138,14 @@ inline void mpm::MPMScheme<Tdim>::compute_forces(
                     std::placeholders::_1, gravity));
 
       // Apply particle traction and map to nodes
-      mesh_->apply_traction_on_particles(step * dt_);
+      mesh_->apply_traction_on_particles(time_);
 
       // Iterate over each node to add concentrated node force to external
       // force
       if (concentrated_nodal_forces)
         mesh_->iterate_over_nodes(
             std::bind(&mpm::NodeBase<Tdim>::apply_concentrated_force,
-                      std::placeholders::_1, phase, (step * dt_)));
+                      std::placeholders::_1, phase, time_));
     }
 
 #pragma omp section
@@ -196,9 +202,10 @@ inline void mpm::MPMScheme<Tdim>::compute_particle_kinematics(
     mpm::VelocityUpdate velocity_update, double blending_ratio, unsigned phase,
     const std::string& damping_type, double damping_factor, unsigned step,
     bool update_defgrad) {
+  timer_->start(mpm::SchemePhase::Integrate);
 
   // Update nodal acceleration constraints
-  mesh_->update_nodal_acceleration_constraints(step * dt_);
+  mesh_->update_nodal_acceleration_constraints(time_);
 
   // Check if damping has been specified and accordingly Iterate over
   // active nodes to compute acceleratation and velocity
@@ -213,6 +220,8 @@ inline void mpm::MPMScheme<Tdim>::compute_particle_kinematics(
                   std::placeholders::_1, phase, dt_),
         std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
 
+  timer_->start(mpm::SchemePhase::ParticleUpdate);
+
   // Iterate over each particle to compute updated position
   mesh_->iterate_over_particles(
       std::bind(&mpm::ParticleBase<Tdim>::compute_updated_position,
@@ -226,11 +235,14 @@ inline void mpm::MPMScheme<Tdim>::compute_particle_kinematics(
 
   // Apply particle velocity constraints
   mesh_->apply_particle_velocity_constraints();
+
+  timer_->stop();
 }
 
 // Locate particles
 template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::locate_particles(bool locate_particles) {
+  const auto timer = timer_->measure(mpm::SchemePhase::Locate);
 
   auto unlocatable_particles = mesh_->locate_particles_mesh();
 
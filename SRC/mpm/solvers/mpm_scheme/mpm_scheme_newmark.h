@@ -110,6 +110,10 @@ class MPMSchemeNewmark : public MPMScheme<Tdim> {
   using mpm::MPMScheme<Tdim>::mpi_rank_;
   //! Time increment
   using mpm::MPMScheme<Tdim>::dt_;
+  //! Time at the beginning of the step
+  using mpm::MPMScheme<Tdim>::time_;
+  //! Timer of the phases of steps
+  using mpm::MPMScheme<Tdim>::timer_;
 
 };  // MPMSchemeNewmark class
 }  // namespace mpm
@@ -7,6 +7,9 @@ mpm::MPMSchemeNewmark<Tdim>::MPMSchemeNewmark(
 //! Initialize nodes, cells and shape functions
 template <unsigned Tdim>
 inline void mpm::MPMSchemeNewmark<Tdim>::initialise() {
+  const auto timer = timer_->measure(mpm::SchemePhase::Initialise);
+  timer_->add_step(mesh_->nparticles());
+
 #pragma omp parallel sections
   {
     // Spawn a task for initialising nodes and cells
@@ -38,6 +41,8 @@ inline void mpm::MPMSchemeNewmark<Tdim>::initialise() {
 template <unsigned Tdim>
 inline void mpm::MPMSchemeNewmark<Tdim>::compute_nodal_kinematics(
     mpm::VelocityUpdate velocity_update, unsigned phase) {
+  const auto timer = timer_->measure(mpm::SchemePhase::NodalKinematics);
+
   // Assign mass, momentum and inertia to nodes
   mesh_->iterate_over_particles(
       std::bind(&mpm::ParticleBase<Tdim>::map_mass_momentum_inertia_to_nodes,
@@ -75,6 +80,7 @@ inline void mpm::MPMSchemeNewmark<Tdim>::compute_nodal_kinematics(
 template <unsigned Tdim>
 inline void mpm::MPMSchemeNewmark<Tdim>::update_nodal_kinematics_newmark(
     unsigned phase, double newmark_beta, double newmark_gamma) {
+  const auto timer = timer_->measure(mpm::SchemePhase::Integrate);
 
   // Update nodal velocity and acceleration
   mesh_->iterate_over_nodes_predicate(
@@ -87,6 +93,7 @@ inline void mpm::MPMSchemeNewmark<Tdim>::update_nodal_kinematics_newmark(
 template <unsigned Tdim>
 inline void mpm::MPMSchemeNewmark<Tdim>::compute_stress_strain(
     unsigned phase, bool pressure_smoothing, mpm::StressRate stress_rate) {
+  const auto timer = timer_->measure(mpm::SchemePhase::StressStrain);
 
   // Iterate over each particle to calculate strain and volume using nodal
   // displacement
@@ -119,6 +126,8 @@ template <unsigned Tdim>
 inline void mpm::MPMSchemeNewmark<Tdim>::compute_forces(
     const Eigen::Matrix<double, Tdim, 1>& gravity, unsigned phase,
     unsigned step, bool concentrated_nodal_forces, bool quasi_static) {
+  const auto timer = timer_->measure(mpm::SchemePhase::Forces);
+
   // Spawn a task for external force
 #pragma omp parallel sections
   {
@@ -136,14 +145,14 @@ inline void mpm::MPMSchemeNewmark<Tdim>::compute_forces(
                       std::placeholders::_1));
 
       // Apply particle traction and map to nodes
-      mesh_->apply_traction_on_particles(step * dt_);
+      mesh_->apply_traction_on_particles(time_);
 
       // Iterate over each node to add concentrated node force to external
       // force
       if (concentrated_nodal_forces)
         mesh_->iterate_over_nodes(
             std::bind(&mpm::NodeBase<Tdim>::apply_concentrated_force,
-                      std::placeholders::_1, phase, (step * dt_)));
+                      std::placeholders::_1, phase, time_));
     }
 
 #pragma omp section
@@ -162,6 +171,7 @@ inline void mpm::MPMSchemeNewmark<Tdim>::compute_particle_kinematics(
     mpm::VelocityUpdate velocity_update, double blending_ratio, unsigned phase,
     const std::string& damping_type, double damping_factor, unsigned step,
     bool update_defgrad) {
+  const auto timer = timer_->measure(mpm::SchemePhase::ParticleUpdate);
 
   // Iterate over each particle to compute updated position
   mesh_->iterate_over_particles(
@@ -179,6 +189,8 @@ inline void mpm::MPMSchemeNewmark<Tdim>::compute_particle_kinematics(
 template <unsigned Tdim>
 inline void
     mpm::MPMSchemeNewmark<Tdim>::update_particle_stress_strain_volume() {
+  const auto timer = timer_->measure(mpm::SchemePhase::StressStrain);
+
   // Iterate over each particle to update particle stress and strain
   mesh_->iterate_over_particles(std::bind(
       &mpm::ParticleBase<Tdim>::update_stress_strain, std::placeholders::_1));
@@ -72,9 +72,7 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
     } else {
       mesh_->resume_domain_cell_ranks();
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
       MPI_Barrier(MPI_COMM_WORLD);
-#endif
 #endif
     }
 
@@ -114,16 +112,18 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
 
   auto solver_begin = std::chrono::steady_clock::now();
   // Main loop
-  for (; step_ < nsteps_; ++step_) {
+  for (; this->steps_remaining(); ++step_) {
     if (mpi_rank == 0) console_->info("Step: {} of {}.\n", step_, nsteps_);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
     // Run load balancer at a specified frequency
     if (step_ % nload_balance_steps_ == 0 && step_ != 0)
       this->mpi_domain_decompose(false);
 #endif
-#endif
+
+    // Time the phases of the step
+    this->phase_timer_->add_step(mesh_->nparticles());
+    this->phase_timer_->start(mpm::SchemePhase::Initialise);
 
 #pragma omp parallel sections
     {
@@ -146,6 +146,8 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
       }
     }  // Wait to complete
 
+    this->phase_timer_->start(mpm::SchemePhase::NodalKinematics);
+
     // Assign mass and momentum to nodes
     mesh_->iterate_over_particles(
         std::bind(&mpm::ParticleBase<Tdim>::map_mass_momentum_to_nodes,
@@ -195,14 +197,16 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
                   std::placeholders::_1),
         std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
 
+    this->phase_timer_->start(mpm::SchemePhase::StressStrain);
+
     // Iterate over each particle to compute strain rate
     mesh_->iterate_over_particles(std::bind(
         &mpm::ParticleBase<Tdim>::compute_strain, std::placeholders::_1, dt_));
 
     // Iterate over each particle to compute shear (deviatoric) stress
-    mesh_->iterate_over_particles(
-        std::bind(&mpm::ParticleBase<Tdim>::compute_stress,
-                  std::placeholders::_1, dt_, mpm::StressRate::None));
+    mesh_->compute_particle_stresses(dt_, mpm::StressRate::None);
+
+    this->phase_timer_->start(mpm::SchemePhase::Forces);
 
     // Spawn a task for external force
 #pragma omp parallel sections
@@ -215,7 +219,7 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
                       std::placeholders::_1, this->gravity_));
 
         // Apply particle traction and map to nodes
-        mesh_->apply_traction_on_particles(this->step_ * this->dt_);
+        mesh_->apply_traction_on_particles(this->time_);
       }
 
 #pragma omp section
@@ -248,6 +252,8 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
     }
 #endif
 
+    this->phase_timer_->start(mpm::SchemePhase::Integrate);
+
     // Compute intermediate velocity
     mesh_->iterate_over_nodes_predicate(
         std::bind(&mpm::NodeBase<Tdim>::compute_acceleration_velocity,
@@ -268,7 +274,7 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
     mesh_->iterate_over_nodes_predicate(
         std::bind(&mpm::NodeBase<Tdim>::update_pressure_increment,
                   std::placeholders::_1, assembler_->pressure_increment(),
-                  fluid, this->step_ * this->dt_),
+                  fluid, this->time_),
         std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
 
     // Use nodal pressure to update particle pressure
@@ -300,6 +306,8 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
             std::placeholders::_1, fluid, this->dt_),
         std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
 
+    this->phase_timer_->start(mpm::SchemePhase::ParticleUpdate);
+
     // Update particle position and kinematics
     mesh_->iterate_over_particles(std::bind(
         &mpm::ParticleBase<Tdim>::compute_updated_position,
@@ -312,6 +320,7 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
     if (pressure_smoothing_) this->pressure_smoothing(fluid);
 
     // Locate particle
+    this->phase_timer_->start(mpm::SchemePhase::Locate);
     auto unlocatable_particles = mesh_->locate_particles_mesh();
 
     if (!unlocatable_particles.empty() && this->locate_particles_)
@@ -322,11 +331,13 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
         mesh_->remove_particle(remove_particle);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
     mesh_->transfer_halo_particles();
     MPI_Barrier(MPI_COMM_WORLD);
 #endif
-#endif
+    this->phase_timer_->stop();
+
+    // Advance time
+    this->time_ += this->dt_;
 
     // Write outputs
     this->write_outputs(this->step_ + 1);
@@ -337,6 +348,7 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
                  std::chrono::duration_cast<std::chrono::milliseconds>(
                      solver_end - solver_begin)
                      .count());
+  this->write_phase_timings();
 
   return status;
 }
@@ -472,7 +484,7 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::reinitialise_matrix() {
 
     // Assign pressure constraints
     assembler_->assign_pressure_constraints(this->beta_,
-                                            this->step_ * this->dt_);
+                                            this->time_);
 
     // Initialise element matrix
     mesh_->iterate_over_cells(std::bind(
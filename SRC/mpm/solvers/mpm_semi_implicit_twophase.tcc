@@ -20,9 +20,7 @@ void mpm::MPMSemiImplicitTwoPhase<Tdim>::compute_stress_strain() {
   mesh_->iterate_over_particles(std::bind(
       &mpm::ParticleBase<Tdim>::update_porosity, std::placeholders::_1, dt_));
   // Iterate over each particle to compute stress of soil skeleton
-  mesh_->iterate_over_particles(
-      std::bind(&mpm::ParticleBase<Tdim>::compute_stress, std::placeholders::_1,
-                dt_, mpm::StressRate::None));
+  mesh_->compute_particle_stresses(dt_, mpm::StressRate::None);
   // Pressure smoothing
   if (pressure_smoothing_) this->pressure_smoothing(mpm::ParticlePhase::Solid);
   // Pore pressure smoothing
@@ -97,9 +95,7 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
     } else {
       mesh_->resume_domain_cell_ranks();
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
       MPI_Barrier(MPI_COMM_WORLD);
-#endif
 #endif
     }
     //! Particle entity sets and velocity constraints
@@ -145,16 +141,18 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
 
   auto solver_begin = std::chrono::steady_clock::now();
   // Main loop
-  for (; step_ < nsteps_; ++step_) {
+  for (; this->steps_remaining(); ++step_) {
     if (mpi_rank == 0) console_->info("Step: {} of {}.\n", step_, nsteps_);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
     // Run load balancer at a specified frequency
     if (step_ % nload_balance_steps_ == 0 && step_ != 0)
       this->mpi_domain_decompose(false);
 #endif
-#endif
+
+    // Time the phases of the step
+    this->phase_timer_->add_step(mesh_->nparticles());
+    this->phase_timer_->start(mpm::SchemePhase::Initialise);
 
 #pragma omp parallel sections
     {
@@ -177,6 +175,8 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
       }
     }  // Wait to complete
 
+    this->phase_timer_->start(mpm::SchemePhase::NodalKinematics);
+
     // Assign mass and momentum to nodes
     mesh_->iterate_over_particles(
         std::bind(&mpm::ParticleBase<Tdim>::map_mass_momentum_to_nodes,
@@ -242,7 +242,12 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
         std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
 
     // Update stress first
-    if (this->stress_update_ == "usf") this->compute_stress_strain();
+    if (this->stress_update_ == "usf") {
+      this->phase_timer_->start(mpm::SchemePhase::StressStrain);
+      this->compute_stress_strain();
+    }
+
+    this->phase_timer_->start(mpm::SchemePhase::Forces);
 
       // Spawn a task for external force
 #pragma omp parallel sections
@@ -255,7 +260,7 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
                       std::placeholders::_1, this->gravity_));
 
         // Apply particle traction and map to nodes
-        mesh_->apply_traction_on_particles(this->step_ * this->dt_);
+        mesh_->apply_traction_on_particles(this->time_);
 
         // Iterate over each node to add concentrated node force to external
         // force
@@ -263,7 +268,7 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
           mesh_->iterate_over_nodes(
               std::bind(&mpm::NodeBase<Tdim>::apply_concentrated_force,
                         std::placeholders::_1, mpm::ParticlePhase::Solid,
-                        (this->step_ * this->dt_)));
+                        this->time_));
       }
 
 #pragma omp section
@@ -326,6 +331,8 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
     }
 #endif
 
+    this->phase_timer_->start(mpm::SchemePhase::Integrate);
+
     // Reinitialise system matrices to solve predictor equation and PPE
     bool matrix_reinitialization_status = this->reinitialise_matrix();
     if (!matrix_reinitialization_status) {
@@ -343,7 +350,7 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
     mesh_->iterate_over_nodes_predicate(
         std::bind(&mpm::NodeBase<Tdim>::update_pressure_increment,
                   std::placeholders::_1, assembler_->pressure_increment(),
-                  mpm::NodePhase::NLiquid, this->step_ * this->dt_),
+                  mpm::NodePhase::NLiquid, this->time_),
         std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
 
     // Use nodal pressure to update particle pressure
@@ -408,6 +415,8 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
           std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
     }
 
+    this->phase_timer_->start(mpm::SchemePhase::ParticleUpdate);
+
     // Update particle position and kinematics
     mesh_->iterate_over_particles(std::bind(
         &mpm::ParticleBase<Tdim>::compute_updated_position,
@@ -417,9 +426,13 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
     mesh_->apply_particle_velocity_constraints();
 
     // Update stress first
-    if (this->stress_update_ == "usl") this->compute_stress_strain();
+    if (this->stress_update_ == "usl") {
+      this->phase_timer_->start(mpm::SchemePhase::StressStrain);
+      this->compute_stress_strain();
+    }
 
     // Locate particle
+    this->phase_timer_->start(mpm::SchemePhase::Locate);
     auto unlocatable_particles = mesh_->locate_particles_mesh();
 
     if (!unlocatable_particles.empty() && this->locate_particles_)
@@ -431,11 +444,13 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
         mesh_->remove_particle(remove_particle);
 
 #ifdef USE_MPI
-#ifdef USE_GRAPH_PARTITIONING
     mesh_->transfer_halo_particles();
     MPI_Barrier(MPI_COMM_WORLD);
 #endif
-#endif
+    this->phase_timer_->stop();
+
+    // Advance time
+    this->time_ += this->dt_;
 
     // Write outputs
     this->write_outputs(this->step_ + 1);
@@ -446,6 +461,7 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
                  std::chrono::duration_cast<std::chrono::milliseconds>(
                      solver_end - solver_begin)
                      .count());
+  this->write_phase_timings();
 
   return status;
 }
@@ -599,7 +615,7 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::reinitialise_matrix() {
 
     // Assign pressure constraints
     assembler_->assign_pressure_constraints(this->beta_,
-                                            this->step_ * this->dt_);
+                                            this->time_);
 
     // Assign velocity constraints
     assembler_->assign_velocity_constraints();
@@ -61,6 +61,14 @@ inline const Eigen::Matrix<double, 3, 1> principal_tensor(
     const Eigen::Matrix<double, 6, 1>& voigt_tensor,
     Eigen::Matrix<double, 3, 3>& directors);
 
+//! Compute the inverse of a symmetric matrix in closed form
+//! \tparam Tdim Dimension, 2 or 3
+//! \param[in] matrix Symmetric matrix
+//! \retval inverse Inverse from the adjugate and determinant
+template <unsigned Tdim>
+inline const Eigen::Matrix<double, Tdim, Tdim> symmetric_inverse(
+    const Eigen::Matrix<double, Tdim, Tdim>& matrix);
+
 }  // namespace math
 }  // namespace mpm
 
@@ -134,4 +134,42 @@ inline const Eigen::Matrix<double, 3, 1> mpm::math::principal_tensor(
   const auto& principal_tensor =
       mpm::math::principal_tensor(matrix_tensor, directors);
   return principal_tensor;
-}
\ No newline at end of file
+}
+
+//! Compute the inverse of a 2x2 symmetric matrix in closed form
+template <>
+inline const Eigen::Matrix<double, 2, 2> mpm::math::symmetric_inverse<2>(
+    const Eigen::Matrix<double, 2, 2>& matrix) {
+  const double inv_det =
+      1. / (matrix(0, 0) * matrix(1, 1) - matrix(0, 1) * matrix(0, 1));
+  Eigen::Matrix<double, 2, 2> inverse;
+  inverse(0, 0) = matrix(1, 1) * inv_det;
+  inverse(1, 1) = matrix(0, 0) * inv_det;
+  inverse(0, 1) = -matrix(0, 1) * inv_det;
+  inverse(1, 0) = inverse(0, 1);
+  return inverse;
+}
+
+//! Compute the inverse of a 3x3 symmetric matrix in closed form
+template <>
+inline const Eigen::Matrix<double, 3, 3> mpm::math::symmetric_inverse<3>(
+    const Eigen::Matrix<double, 3, 3>& matrix) {
+  // Cofactors
+  const double c00 = matrix(1, 1) * matrix(2, 2) - matrix(1, 2) * matrix(1, 2);
+  const double c01 = matrix(0, 2) * matrix(1, 2) - matrix(0, 1) * matrix(2, 2);
+  const double c02 = matrix(0, 1) * matrix(1, 2) - matrix(0, 2) * matrix(1, 1);
+  const double c11 = matrix(0, 0) * matrix(2, 2) - matrix(0, 2) * matrix(0, 2);
+  const double c12 = matrix(0, 1) * matrix(0, 2) - matrix(0, 0) * matrix(1, 2);
+  const double c22 = matrix(0, 0) * matrix(1, 1) - matrix(0, 1) * matrix(0, 1);
+  const double inv_det =
+      1. / (matrix(0, 0) * c00 + matrix(0, 1) * c01 + matrix(0, 2) * c02);
+
+  Eigen::Matrix<double, 3, 3> inverse;
+  inverse(0, 0) = c00 * inv_det;
+  inverse(1, 1) = c11 * inv_det;
+  inverse(2, 2) = c22 * inv_det;
+  inverse(0, 1) = inverse(1, 0) = c01 * inv_det;
+  inverse(0, 2) = inverse(2, 0) = c02 * inv_det;
+  inverse(1, 2) = inverse(2, 1) = c12 * inv_det;
+  return inverse;
+}
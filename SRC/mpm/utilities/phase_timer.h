@@ -0,0 +1,130 @@
+#ifndef MPM_PHASE_TIMER_H_
+#define MPM_PHASE_TIMER_H_
+
+#include <array>
+#include <chrono>
+#include <string>
+
+//! Alias for JSON
+#include "json.hpp"
+using Json = nlohmann::json;
+
+namespace mpm {
+
+//! Phases of a step of the MPM scheme
+enum class SchemePhase : unsigned {
+  Initialise = 0,
+  NodalKinematics = 1,
+  StressStrain = 2,
+  Forces = 3,
+  Integrate = 4,
+  ParticleUpdate = 5,
+  Locate = 6
+};
+
+//! PhaseTimer class
+//! \brief Accumulates the wall time spent in each phase of the MPM steps
+//! \details Phases are measured either by a scope, which adds its duration
+//! when it is destroyed, or by start and stop calls, where starting a phase
+//! stops the running one. Throughputs are reported as particles times steps
+//! per second of each phase.
+class PhaseTimer {
+ public:
+  //! Number of phases
+  static constexpr unsigned nphases = 7;
+  //! Clock
+  using Clock = std::chrono::steady_clock;
+
+  //! Scope measuring a phase until it is destroyed
+  class Scope {
+   public:
+    //! Constructor with timer and phase
+    Scope(mpm::PhaseTimer* timer, mpm::SchemePhase phase)
+        : timer_{timer}, phase_{phase}, begin_{Clock::now()} {}
+
+    //! Destructor adds the duration of the scope to the phase
+    ~Scope() {
+      timer_->add(phase_,
+                  std::chrono::duration<double>(Clock::now() - begin_).count());
+    }
+
+    //! Deleted copy constructor and assignment
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    //! Timer
+    mpm::PhaseTimer* timer_;
+    //! Measured phase
+    mpm::SchemePhase phase_;
+    //! Begin of the scope
+    Clock::time_point begin_;
+  };
+
+  //! Measure a phase until the returned scope is destroyed
+  //! \param[in] phase Phase of the step
+  Scope measure(mpm::SchemePhase phase) { return Scope(this, phase); }
+
+  //! Start measuring a phase, stops the running phase
+  //! \param[in] phase Phase of the step
+  void start(mpm::SchemePhase phase);
+
+  //! Stop measuring the running phase
+  void stop();
+
+  //! Add a duration to a phase
+  //! \param[in] phase Phase of the step
+  //! \param[in] seconds Duration in seconds
+  void add(mpm::SchemePhase phase, double seconds);
+
+  //! Count a step of a number of particles
+  //! \param[in] nparticles Number of particles in the step
+  void add_step(std::size_t nparticles);
+
+  //! Reset all timings
+  void reset();
+
+  //! Number of steps
+  std::size_t nsteps() const { return nsteps_; }
+
+  //! Sum of the number of particles over steps
+  std::size_t particle_steps() const { return particle_steps_; }
+
+  //! Time spent in a phase in seconds
+  //! \param[in] phase Phase of the step
+  double seconds(mpm::SchemePhase phase) const {
+    return seconds_[static_cast<unsigned>(phase)];
+  }
+
+  //! Throughput of a phase in particles times steps per second
+  //! \param[in] phase Phase of the step
+  double throughput(mpm::SchemePhase phase) const;
+
+  //! Name of a phase
+  //! \param[in] phase Phase of the step
+  static std::string name(mpm::SchemePhase phase);
+
+  //! Timings of the phases as a JSON object
+  Json json() const;
+
+ private:
+  //! Time spent in each phase in seconds
+  std::array<double, nphases> seconds_{};
+  //! Number of measurements of each phase
+  std::array<std::size_t, nphases> calls_{};
+  //! Number of steps
+  std::size_t nsteps_{0};
+  //! Sum of the number of particles over steps
+  std::size_t particle_steps_{0};
+  //! Running phase of start and stop calls
+  bool running_{false};
+  //! Phase being measured
+  mpm::SchemePhase phase_{mpm::SchemePhase::Initialise};
+  //! Start of the running phase
+  Clock::time_point begin_;
+};
+}  // namespace mpm
+
+#include "phase_timer.tcc"
+
+#endif  // MPM_PHASE_TIMER_H_
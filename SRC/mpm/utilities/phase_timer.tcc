@@ -0,0 +1,86 @@
+//! Start measuring a phase
+inline void mpm::PhaseTimer::start(mpm::SchemePhase phase) {
+  const auto now = Clock::now();
+  if (running_)
+    this->add(phase_, std::chrono::duration<double>(now - begin_).count());
+  running_ = true;
+  phase_ = phase;
+  begin_ = now;
+}
+
+//! Stop measuring the running phase
+inline void mpm::PhaseTimer::stop() {
+  if (!running_) return;
+  this->add(phase_,
+            std::chrono::duration<double>(Clock::now() - begin_).count());
+  running_ = false;
+}
+
+//! Add a duration to a phase
+inline void mpm::PhaseTimer::add(mpm::SchemePhase phase, double seconds) {
+  seconds_[static_cast<unsigned>(phase)] += seconds;
+  ++calls_[static_cast<unsigned>(phase)];
+}
+
+//! Count a step
+inline void mpm::PhaseTimer::add_step(std::size_t nparticles) {
+  ++nsteps_;
+  particle_steps_ += nparticles;
+}
+
+//! Reset all timings
+inline void mpm::PhaseTimer::reset() {
+  seconds_.fill(0.);
+  calls_.fill(0);
+  nsteps_ = 0;
+  particle_steps_ = 0;
+  running_ = false;
+}
+
+//! Throughput of a phase in particles times steps per second
+inline double mpm::PhaseTimer::throughput(mpm::SchemePhase phase) const {
+  const double seconds = this->seconds(phase);
+  return (seconds > 0.) ? particle_steps_ / seconds : 0.;
+}
+
+//! Name of a phase
+inline std::string mpm::PhaseTimer::name(mpm::SchemePhase phase) {
+  switch (phase) {
+    case mpm::SchemePhase::Initialise:
+      return "initialise";
+    case mpm::SchemePhase::NodalKinematics:
+      return "nodal_kinematics";
+    case mpm::SchemePhase::StressStrain:
+      return "stress_strain";
+    case mpm::SchemePhase::Forces:
+      return "forces";
+    case mpm::SchemePhase::Integrate:
+      return "integrate";
+    case mpm::SchemePhase::ParticleUpdate:
+      return "particle_update";
+    case mpm::SchemePhase::Locate:
+      return "locate";
+  }
+  return "unknown";
+}
+
+//! Timings of the phases as a JSON object
+inline Json mpm::PhaseTimer::json() const {
+  Json timings;
+  timings["nsteps"] = nsteps_;
+  timings["particle_steps"] = particle_steps_;
+  double total = 0.;
+  for (unsigned i = 0; i < nphases; ++i) {
+    const auto phase = static_cast<mpm::SchemePhase>(i);
+    Json json_phase;
+    json_phase["seconds"] = seconds_[i];
+    json_phase["calls"] = calls_[i];
+    json_phase["particle_steps_per_second"] = this->throughput(phase);
+    timings["phases"][name(phase)] = json_phase;
+    total += seconds_[i];
+  }
+  timings["seconds"] = total;
+  timings["particle_steps_per_second"] =
+      (total > 0.) ? particle_steps_ / total : 0.;
+  return timings;
+}
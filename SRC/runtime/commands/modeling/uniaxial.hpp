@@ -81,6 +81,7 @@ extern OPS_Routine OPS_Masonry;
 extern OPS_Routine OPS_Masonryt;
 extern OPS_Routine OPS_Maxwell;
 extern OPS_Routine OPS_MinMaxMaterial;
+extern OPS_Routine OPS_SubstepMaterial;
 extern OPS_Routine OPS_ModIMKPeakOriented02;
 extern OPS_Routine OPS_ModIMKPeakOriented;
 extern OPS_Routine OPS_ModIMKPinching;
@@ -256,6 +257,8 @@ std::unordered_map<std::string, Tcl_CmdProc*> uniaxial_dispatch {
     {"MinMaxMaterial",         dispatch<OPS_MinMaxMaterial>            },
     {"MinMax",                 dispatch<OPS_MinMaxMaterial>            },
 
+    {"Substep",                dispatch<OPS_SubstepMaterial>           },
+
     {"Series",                 dispatch<OPS_SeriesMaterial>            },
 
 // Steels
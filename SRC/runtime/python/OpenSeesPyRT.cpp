@@ -25,6 +25,7 @@ namespace py = pybind11;
 #include <NDMaterial.h>
 #include <HystereticBackbone.h>
 #include <ManderBackbone.h>
+#include <TabulatedBackbone.h>
 
 // 
 // ANALYSIS
@@ -398,7 +399,8 @@ init_obj_module(py::module &m)
   ;
 
   py::class_<HystereticBackbone,   PyHystereticBackbone>(m, "HystereticBackbone")
-    .def("getStress", &HystereticBackbone::getStress);
+    .def("getStress", &HystereticBackbone::getStress)
+    .def("getTangent", &HystereticBackbone::getTangent)
   ;
 
   py::class_<ManderBackbone, HystereticBackbone>(m, "PopovicsBackbone")
@@ -408,6 +410,12 @@ init_obj_module(py::module &m)
     .def("getStress", &ManderBackbone::getStress)
   ;
 
+  py::class_<TabulatedBackbone, HystereticBackbone>(m, "TabulatedBackbone")
+    .def("getStressError",  &TabulatedBackbone::getStressError)
+    .def("getTangentError", &TabulatedBackbone::getTangentError)
+    .def("getNumPoints",    &TabulatedBackbone::getNumPoints)
+  ;
+
   //
   // Loading
   //
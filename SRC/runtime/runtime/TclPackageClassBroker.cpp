@@ -78,6 +78,7 @@ using namespace OpenSees::Hash::literals;
 #include "CableMaterial.h"
 #include "ENTMaterial.h"
 #include "MinMaxMaterial.h"
+#include "SubstepMaterial.h"
 #include "ModIMKPeakOriented.h"
 #include "snap/Clough.h"
 #include "limitState/LimitStateMaterial.h"
@@ -1120,6 +1121,9 @@ TclPackageClassBroker::getNewUniaxialMaterial(int classTag)
   case MAT_TAG_MinMax:
     return new MinMaxMaterial();
 
+  case MAT_TAG_Substep:
+    return new SubstepMaterial();
+
   case MAT_TAG_InitStrain:
     return new InitStrainMaterial();
 
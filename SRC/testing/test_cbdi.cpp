@@ -0,0 +1,206 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Compares the CBDI influence matrices of the barycentric integration with
+// the explicit Vandermonde formulation, l * G^-1 * L^2, for 2 to 10 uniform
+// and non-uniform integration points, and vandermonde_inverse with the
+// inverse of the Vandermonde matrix. Several threads then read the cached
+// matrices at once, and the cache has to be cleared at 1024 point sets.
+//
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Matrix.h>
+#include "cbdi.h"
+
+namespace {
+
+int failed = 0;
+
+void check(bool condition, const std::string& message) {
+  if (!condition) {
+    std::cerr << "FAILED: " << message << "\n";
+    ++failed;
+  }
+}
+
+// Largest difference of two matrices relative to the largest entry of b
+double difference(const Matrix& a, const Matrix& b) {
+  double error = 0.0, scale = 0.0;
+  for (int i = 0; i < b.noRows(); i++)
+    for (int j = 0; j < b.noCols(); j++) {
+      error = std::fmax(error, std::fabs(a(i, j) - b(i, j)));
+      scale = std::fmax(scale, std::fabs(b(i, j)));
+    }
+  return error / scale;
+}
+
+// Influence matrix of the explicit Vandermonde formulation
+void explicitInfluence(int nPts, const double* pts, int n, const double* xi,
+                       double L, Matrix& ls) {
+  Matrix G(n, n), Ginv(n, n), l(nPts, n);
+  for (int j = 1; j <= n; j++) {
+    for (int i = 0; i < n; i++)
+      G(i, j - 1) = std::pow(xi[i], j - 1);
+    for (int i = 0; i < nPts; i++)
+      l(i, j - 1) = (std::pow(pts[i], j + 1) - pts[i]) / (j * (j + 1));
+  }
+  G.Invert(Ginv);
+  ls.addMatrixProduct(0.0, l, Ginv, L * L);
+}
+
+// Integration points on (0, 1): uniform, clustered at the ends as the
+// Gauss-Lobatto-like rules, and irregular
+std::vector<double> integrationPoints(int n, int kind) {
+  std::vector<double> xi(n);
+  for (int i = 0; i < n; i++) {
+    const double t = (i + 0.5) / n;
+    if (kind == 0)
+      xi[i] = t;
+    else if (kind == 1)
+      xi[i] = 0.5 - 0.5 * std::cos(M_PI * t);
+    else
+      xi[i] = t + 0.3 / n * std::sin(7.0 * i + 1.0);
+  }
+  return xi;
+}
+
+// Point sets of the threads, half of them shared by all threads and the
+// others new
+std::vector<double> threadPoints(int thread, int repeat) {
+  std::vector<double> xi = integrationPoints(2 + (thread + repeat) % 9, 2);
+  if (repeat % 2 == 1)
+    for (double& x : xi)
+      x *= 1.0 - 1.0e-3 * (thread + 1) / (repeat + 1);
+  return xi;
+}
+
+}  // namespace
+
+int main() {
+  const double L = 2.5;
+  const char* kinds[3] = {"uniform", "clustered", "irregular"};
+
+  for (int kind = 0; kind < 3; kind++)
+    for (int n = 2; n <= 10; n++) {
+      const std::vector<double> xi = integrationPoints(n, kind);
+      const std::string name =
+          std::string(kinds[kind]) + " points, n = " + std::to_string(n);
+
+      // The explicit formulation loses accuracy with the conditioning of G
+      const double tol = 1.0e-13 * std::pow(10.0, 0.5 * n + 0.5);
+
+      Matrix ls(n, n), lsMatrix(n, n), lsOld(n, n), xiPt(n, 1);
+      for (int i = 0; i < n; i++)
+        xiPt(i, 0) = xi[i];
+      explicitInfluence(n, xi.data(), n, xi.data(), L, lsOld);
+      getCBDIinfluenceMatrix(n, xi.data(), L, ls);
+      getCBDIinfluenceMatrix(n, xiPt, L, lsMatrix);
+      check(difference(ls, lsOld) <= tol, "influence matrix, " + name);
+      check(difference(lsMatrix, ls) == 0.0, "influence matrix of a Matrix, " + name);
+
+      // Deflections at other points, including the ends
+      std::vector<double> pts = xi;
+      pts.push_back(0.0);
+      pts.push_back(1.0);
+      pts.push_back(0.37);
+      const int nPts = pts.size();
+      Matrix lp(nPts, n), lpOld(nPts, n);
+      explicitInfluence(nPts, pts.data(), n, xi.data(), L, lpOld);
+      getCBDIinfluenceMatrix(nPts, pts.data(), n, xi.data(), L, lp);
+      check(difference(lp, lpOld) <= tol, "influence matrix at other points, " + name);
+      for (int j = 0; j < n; j++)
+        check(lp(n, j) == 0.0 && std::fabs(lp(n + 1, j)) <= 1.0e-15,
+              "deflection at the ends, " + name);
+
+      // Exact deflections (x^(m+2) - x) L^2/((m+1)(m+2)) for the
+      // curvatures x^m of degree below n
+      for (int m = 0; m < n; m++) {
+        double error = 0.0;
+        for (int i = 0; i < nPts; i++) {
+          double w = 0.0;
+          for (int j = 0; j < n; j++)
+            w += lp(i, j) * std::pow(xi[j], m);
+          const double exact = (std::pow(pts[i], m + 2) - pts[i]) * L * L / ((m + 1) * (m + 2));
+          error = std::fmax(error, std::fabs(w - exact));
+        }
+        check(error <= 1.0e-13 * L * L, "deflection of x^" + std::to_string(m) + ", " + name);
+      }
+
+      // vandermonde_inverse is the inverse of vandermonde
+      Matrix G(n, n), Ginv(n, n), GinvOld(n, n), I(n, n);
+      vandermonde(n, xi.data(), G);
+      vandermonde_inverse(n, xi.data(), Ginv);
+      G.Invert(GinvOld);
+      check(difference(Ginv, GinvOld) <= tol, "vandermonde_inverse, " + name);
+      I.addMatrixProduct(0.0, G, Ginv, 1.0);
+      for (int i = 0; i < n; i++)
+        I(i, i) -= 1.0;
+      check(I.Norm() <= tol, "G * Ginv, " + name);
+    }
+
+  // Threads reading and adding cached matrices at once get the matrices of
+  // a single thread
+  {
+    const int nThreads = 8;
+    const int nRepeats = 200;
+    std::vector<std::vector<Matrix>> results(nThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nThreads; t++)
+      threads.emplace_back([t, L, &results]() {
+        for (int repeat = 0; repeat < nRepeats; repeat++) {
+          const std::vector<double> xi = threadPoints(t, repeat);
+          const int n = xi.size();
+          results[t].emplace_back(n, n);
+          getCBDIinfluenceMatrix(n, xi.data(), L, results[t].back());
+        }
+      });
+    for (std::thread& thread : threads)
+      thread.join();
+
+    for (int t = 0; t < nThreads; t++) {
+      int mismatches = 0;
+      for (int repeat = 0; repeat < nRepeats; repeat++) {
+        const std::vector<double> xi = threadPoints(t, repeat);
+        const int n = xi.size();
+        Matrix ls(n, n);
+        getCBDIinfluenceMatrix(n, xi.data(), L, ls);
+        if (difference(results[t][repeat], ls) != 0.0)
+          mismatches++;
+      }
+      check(mismatches == 0, "influence matrices of thread " + std::to_string(t));
+    }
+  }
+
+  // The cache is cleared when a new point set would exceed 1024 of them,
+  // and point sets in the cache do not count again
+  {
+    const int maxCached = 1024;
+    check(getCBDIinfluenceCacheSize() <= maxCached, "size of the cache");
+    double xi[3] = {0.1, 0.5, 0.9};
+    Matrix ls(3, 3), lsOld(3, 3);
+    for (int set = 0; set < 2 * maxCached && getCBDIinfluenceCacheSize() < maxCached; set++) {
+      xi[1] = 0.5 + 1.0e-4 * set;
+      getCBDIinfluenceMatrix(3, xi, L, ls);
+    }
+    getCBDIinfluenceMatrix(3, xi, L, ls);
+    check(getCBDIinfluenceCacheSize() == maxCached, "size of the full cache");
+
+    xi[1] = 0.25;
+    getCBDIinfluenceMatrix(3, xi, L, ls);
+    check(getCBDIinfluenceCacheSize() == 1, "size of the cache after clearing");
+    explicitInfluence(3, xi, 3, xi, L, lsOld);
+    check(difference(ls, lsOld) <= 1.0e-13, "influence matrix after clearing");
+  }
+
+  if (failed == 0)
+    std::cout << "CBDI influence matrices passed\n";
+
+  return failed == 0 ? 0 : 1;
+}
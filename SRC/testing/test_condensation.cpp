@@ -0,0 +1,157 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Counts the three dimensional evaluations of the PlateFiberMaterial,
+// PlaneStressMaterial and BeamFiberMaterial wrappers of a linear material.
+// After the first converged step the condensed strains are predicted
+// exactly, so every step has to converge with a single evaluation, also
+// after a revertToLastCommit and in a copy, and revertToStart has to start
+// the prediction over. The stresses are compared with those of a wrapper
+// driven to the same strains from its initial state.
+//
+#include <cmath>
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+
+#include <NDMaterial.h>
+#include <ElasticIsotropicThreeDimensional.h>
+#include <PlateFiberMaterial.h>
+#include <PlaneStressMaterial.h>
+#include <BeamFiberMaterial.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+#undef opserr
+#define opserr sserr
+
+// Linear material counting the evaluations of all its copies
+class CountingMaterial : public ElasticIsotropicThreeDimensional {
+public:
+  CountingMaterial(int tag, double E, double nu, int *count)
+    : ElasticIsotropicThreeDimensional(tag, E, nu, 0.0), E(E), nu(nu), count(count)
+  {
+  }
+
+  int
+  setTrialStrain(const Vector &v)
+  {
+    (*count)++;
+    return ElasticIsotropicThreeDimensional::setTrialStrain(v);
+  }
+
+  NDMaterial *
+  getCopy(void)
+  {
+    return new CountingMaterial(this->getTag(), E, nu, count);
+  }
+
+  NDMaterial *
+  getCopy(const char *type)
+  {
+    return this->getCopy();
+  }
+
+private:
+  double E, nu;
+  int *count;
+};
+
+static int failed = 0;
+
+static void
+check(bool condition, const char *what, const char *name, int step)
+{
+  if (!condition) {
+    opserr << "FAILED: " << what << " of " << name << " at step " << step << endln;
+    failed++;
+  }
+}
+
+// Evaluations of the wrapper for the strain e, whose stress has to match
+// that of a wrapper taken to e from its initial state
+static int
+evaluate(NDMaterial &wrapper, NDMaterial &prototype, int &count, const Vector &e,
+         const char *name, int step)
+{
+  NDMaterial *fresh = prototype.getCopy();
+  fresh->setTrialStrain(e);
+  const Vector &s0 = fresh->getStress();
+
+  count = 0;
+  check(wrapper.setTrialStrain(e) == 0, "setTrialStrain", name, step);
+  const int evaluations = count;
+
+  const Vector &s = wrapper.getStress();
+  double error = 0.0, scale = 0.0;
+  for (int i = 0; i < e.Size(); i++) {
+    error = fmax(error, fabs(s(i) - s0(i)));
+    scale = fmax(scale, fabs(s0(i)));
+  }
+  check(error <= 1.0e-10*(1.0 + scale), "stress", name, step);
+
+  delete fresh;
+  return evaluations;
+}
+
+static void
+run(NDMaterial &prototype, int &count, int order, const char *name)
+{
+  NDMaterial *wrapper = prototype.getCopy();
+
+  Vector e(order);
+  for (int step = 0; step < 40; step++) {
+    for (int i = 0; i < order; i++)
+      e(i) = 1.0e-3*sin(0.3*step*(1 + 0.2*i) + 0.5*i);
+
+    // Only the first step starts without a sensitivity
+    const int evaluations = evaluate(*wrapper, prototype, count, e, name, step);
+    check(evaluations == (step == 0 ? 2 : 1), "evaluations", name, step);
+
+    // Every fourth step is abandoned and taken again
+    if (step % 4 == 3) {
+      wrapper->revertToLastCommit();
+      check(evaluate(*wrapper, prototype, count, e, name, step) == 1,
+            "evaluations after revertToLastCommit", name, step);
+    }
+    wrapper->commitState();
+  }
+
+  // A copy predicts with the sensitivity of the original
+  NDMaterial *copy = wrapper->getCopy();
+  e(0) += 1.0e-3;
+  check(evaluate(*copy, prototype, count, e, name, 40) == 1,
+        "evaluations of a copy", name, 40);
+  delete copy;
+
+  wrapper->revertToStart();
+  check(evaluate(*wrapper, prototype, count, e, name, 40) == 2,
+        "evaluations after revertToStart", name, 40);
+
+  delete wrapper;
+}
+
+int main()
+{
+  int count = 0;
+  CountingMaterial material(1, 1.2e4, 0.2, &count);
+
+  PlateFiberMaterial plateFiber(2, material);
+  run(plateFiber, count, 5, "PlateFiberMaterial");
+
+  PlaneStressMaterial planeStress(3, material);
+  run(planeStress, count, 3, "PlaneStressMaterial");
+
+  BeamFiberMaterial beamFiber(4, material);
+  run(beamFiber, count, 3, "BeamFiberMaterial");
+
+  if (failed == 0)
+    opserr << "Condensed strain predictions converge in one evaluation\n";
+
+  return failed == 0 ? 0 : 1;
+}
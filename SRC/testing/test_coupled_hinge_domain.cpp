@@ -0,0 +1,175 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Compares the indexed My-Mz lookup of ASDCoupledHinge3DDomainData with a
+// brute force scan of the sectors of the domain, as the lookup did before
+// it was indexed, at random axial loads and directions. The domains turn
+// once around the origin counterclockwise or clockwise, which are searched
+// by bisection, or turn back and forth, which are scanned. Every axial
+// load is queried several times in a row, as in the iterations of a step,
+// and again after other loads.
+//
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+
+#include <ASDCoupledHinge3D.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+#undef opserr
+#define opserr sserr
+
+static const int numberAxial = 7;
+static const int numberTheta = 24;
+
+static int failed = 0;
+
+static void
+check(bool condition, const std::string &what)
+{
+  if (!condition) {
+    opserr << "FAILED: " << what.c_str() << endln;
+    failed++;
+  }
+}
+
+// Domain points (N, My, Mz) of slice i and point j; kind 0 turns
+// counterclockwise, 1 clockwise and 2 back and forth. The slices at Nmin
+// and Nmax are at the origin.
+static void
+domainPoint(int kind, int i, int j, double point[3])
+{
+  const double N = -1000.0 + 2000.0*i/(numberAxial - 1);
+  double angle = 2*M_PI*j/numberTheta + 0.1*sin(3.0*j + i);
+  if (kind == 1)
+    angle = -angle;
+  else if (kind == 2 && j % 4 == 2)
+    angle -= 3*M_PI/numberTheta;
+  const double s = 2.0*i/(numberAxial - 1) - 1.0;
+  const double r = (1.0 - s*s)*(100.0 + 40.0*cos(2*angle) + 5.0*i);
+  point[0] = N;
+  point[1] = r*cos(angle);
+  point[2] = r*sin(angle);
+}
+
+// The lookup before the domain was indexed: the first sector, at N
+// interpolated between the slices around it, that holds the direction
+static int
+scan(const std::vector<double> &points, double N, double theta, double &My, double &Mz)
+{
+  auto value = [&points](int i, int j, int k) {
+    return points[(i*numberTheta + j)*3 + k];
+  };
+  while (theta > 2*M_PI)
+    theta -= 2*M_PI;
+  const double dy = cos(theta);
+  const double dz = sin(theta);
+
+  if (N <= value(0, 0, 0) || N >= value(numberAxial - 1, 0, 0)) {
+    My = Mz = 0.0;
+    return 0;
+  }
+  int i1 = 0;
+  while (value(i1 + 1, 0, 0) <= N)
+    i1++;
+  const double N1 = value(i1, 0, 0);
+  const double N2 = value(i1 + 1, 0, 0);
+
+  for (int j = 0; j < numberTheta; j++) {
+    const int jp1 = (j + 1) % numberTheta;
+    double m[2][2];
+    for (int p = 0; p < 2; p++)
+      for (int k = 0; k < 2; k++) {
+        const int jj = p == 0 ? j : jp1;
+        const double v1 = value(i1, jj, k + 1);
+        const double v2 = value(i1 + 1, jj, k + 1);
+        m[p][k] = (v2 - v1)/(N2 - N1)*(N - N1) + v1;
+      }
+    const double n0 = sqrt(m[0][0]*m[0][0] + m[0][1]*m[0][1]);
+    const double n1 = sqrt(m[1][0]*m[1][0] + m[1][1]*m[1][1]);
+    const double d0[2] = {m[0][0]/n0, m[0][1]/n0};
+    const double d1[2] = {m[1][0]/n1, m[1][1]/n1};
+    const double jXjp1 = d0[0]*d1[1] - d0[1]*d1[0];
+    const double jXdirection = d0[0]*dz - d0[1]*dy;
+    const double directionXjp1 = dy*d1[1] - dz*d1[0];
+    if ((jXjp1*jXdirection >= 0) && (directionXjp1*jXjp1 >= 0)) {
+      double alfa = jXdirection/jXjp1;
+      double beta = directionXjp1/jXjp1;
+      const double sum = alfa + beta;
+      alfa /= sum;
+      beta /= sum;
+      My = m[0][0]*beta + m[1][0]*alfa;
+      Mz = m[0][1]*beta + m[1][1]*alfa;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+static void
+compare(int kind, const char *name)
+{
+  ASDCoupledHinge3DDomainData domain(numberAxial, numberTheta, 3);
+  std::vector<double> points(numberAxial*numberTheta*3);
+  for (int i = 0; i < numberAxial; i++)
+    for (int j = 0; j < numberTheta; j++) {
+      double *point = &points[(i*numberTheta + j)*3];
+      domainPoint(kind, i, j, point);
+      for (int k = 0; k < 3; k++)
+        domain.setValue(i, j, k, point[k]);
+    }
+
+  std::mt19937 generator(kind + 1);
+  std::uniform_real_distribution<double> axial(-1100.0, 1100.0);
+  std::uniform_real_distribution<double> direction(0.0, 2.5*M_PI);
+
+  std::vector<double> loads;
+  int mismatches = 0, failures = 0;
+  for (int q = 0; q < 2000; q++) {
+    // a new axial load, or one of the earlier ones
+    double N = axial(generator);
+    if (q % 5 == 4)
+      N = loads[q % loads.size()];
+    loads.push_back(N);
+
+    // iterations at the same axial load, turning the direction a little
+    double theta = direction(generator);
+    for (int iteration = 0; iteration < 4; iteration++) {
+      double My, Mz, MyScan, MzScan;
+      const int res = domain.getMyMzForNAndDirection(N, theta, My, Mz);
+      const int resScan = scan(points, N, theta, MyScan, MzScan);
+      if (res != 0 || resScan != 0)
+        failures++;
+      else if (fabs(My - MyScan) > 1.0e-10*(1.0 + fabs(MyScan)) ||
+               fabs(Mz - MzScan) > 1.0e-10*(1.0 + fabs(MzScan)))
+        mismatches++;
+      theta += iteration % 2 == 0 ? 1.0e-3 : -0.4;
+    }
+  }
+  check(failures == 0, std::string("lookup failures, ") + name);
+  check(mismatches == 0, std::string("My and Mz of the lookup, ") + name);
+}
+
+int main()
+{
+  compare(0, "counterclockwise domain");
+  compare(1, "clockwise domain");
+  compare(2, "non-monotone domain");
+
+  if (failed == 0)
+    opserr << "ASDCoupledHinge3D domain lookup matches the scan\n";
+
+  return failed == 0 ? 0 : 1;
+}
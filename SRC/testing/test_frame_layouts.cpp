@@ -0,0 +1,236 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Drives copies of a FrameFiberSection3d specialized for the common element
+// layouts through the FrameSection templates, and compares their
+// resultants, tangents and sensitivities with those of a generic copy whose
+// resultants are matched against getType(), along a cyclic history with
+// commits and reverts. The specialized copies have to order their
+// resultants by the layout, also in the sensitivity methods.
+//
+#include <cmath>
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+
+#include <UniaxialMaterial.h>
+#include <FrameFiberSection3d.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+#undef opserr
+#define opserr sserr
+
+// Softening material whose stress sensitivity depends on its committed
+// strain sensitivity
+class SensitiveMaterial : public UniaxialMaterial {
+public:
+  SensitiveMaterial(int tag, double E, double eps0)
+    : UniaxialMaterial(tag, 0), E(E), eps0(eps0),
+      Tstrain(0.0), Tstress(0.0), Ttangent(E), Cstrain(0.0), Csens(0.0)
+  {
+  }
+
+  int
+  setTrialStrain(double strain, double strainRate = 0.0)
+  {
+    Tstrain  = strain;
+    const double r = 1.0 + fabs(strain)/eps0;
+    Tstress  = E*strain/r;
+    Ttangent = E/(r*r);
+    return 0;
+  }
+
+  double getStrain(void) {return Tstrain;}
+  double getStress(void) {return Tstress;}
+  double getTangent(void) {return Ttangent;}
+  double getInitialTangent(void) {return E;}
+
+  int commitState(void) {Cstrain = Tstrain; return 0;}
+  int revertToLastCommit(void) {return this->setTrialStrain(Cstrain);}
+  int revertToStart(void) {Cstrain = Csens = 0.0; return this->setTrialStrain(0.0);}
+
+  UniaxialMaterial *
+  getCopy(void)
+  {
+    SensitiveMaterial *theCopy = new SensitiveMaterial(this->getTag(), E, eps0);
+    theCopy->Cstrain = Cstrain;
+    theCopy->Csens   = Csens;
+    theCopy->setTrialStrain(Tstrain);
+    return theCopy;
+  }
+
+  double
+  getStressSensitivity(int gradIndex, bool conditional)
+  {
+    return Ttangent*Csens + gradIndex*Tstress/E;
+  }
+
+  double getTangentSensitivity(int gradIndex) {return gradIndex*Ttangent/E;}
+
+  int
+  commitSensitivity(double strainGradient, int gradIndex, int numGrads)
+  {
+    Csens = strainGradient;
+    return 0;
+  }
+
+  int sendSelf(int commitTag, Channel &theChannel) {return -1;}
+  int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker) {return -1;}
+  void Print(OPS_Stream &s, int flag = 0) {}
+
+private:
+  double E, eps0;
+  double Tstrain, Tstress, Ttangent;
+  double Cstrain, Csens;
+};
+
+// Layouts of the elements, declared apart from FrameLayouts so that the
+// templates have to recognize them by their contents
+static constexpr FrameStressLayout nmm {
+  FrameStress::N, FrameStress::Mz, FrameStress::My
+};
+static constexpr FrameStressLayout nmmt {
+  FrameStress::N, FrameStress::Mz, FrameStress::My, FrameStress::T
+};
+static constexpr FrameStressLayout nmmvvt {
+  FrameStress::N,  FrameStress::Mz, FrameStress::My,
+  FrameStress::Vy, FrameStress::Vz, FrameStress::T
+};
+static constexpr FrameStressLayout nmmtb {
+  FrameStress::N, FrameStress::Mz, FrameStress::My, FrameStress::T,
+  FrameStress::Bimoment, FrameStress::Bishear
+};
+// not a common layout, matched against getType()
+static constexpr FrameStressLayout mnm {
+  FrameStress::My, FrameStress::N, FrameStress::Mz
+};
+
+static int failed = 0;
+
+static void
+check(double error, double scale, const char *what, const char *name, int step)
+{
+  if (!(error <= 1.0e-12*(1.0 + scale))) {
+    opserr << "FAILED: " << what << " of " << name << " at step " << step
+           << ", error " << error << endln;
+    failed++;
+  }
+}
+
+template <const FrameStressLayout& scheme>
+static void
+run(FrameFiberSection3d &section, bool specialized, const char *name)
+{
+  constexpr int n = LayoutSize(scheme);
+
+  FrameSection *layout  = section.getFrameCopy(scheme);
+  FrameSection *generic = section.getFrameCopy();
+
+  if (specialized && layout->getOrder() != n) {
+    opserr << "FAILED: copy of " << name << " is not ordered by the layout\n";
+    failed++;
+  }
+
+  OpenSees::VectorND<n> e;
+  for (int step = 0; step < 60; step++) {
+    for (int i = 0; i < n; i++)
+      e[i] = 0.004*sin(0.11*step*(1 + 0.2*i) + 0.7*i)/(1 + 0.3*i);
+
+    layout->setTrialState<n,scheme>(e);
+    generic->setTrialState<n,scheme>(e);
+
+    // Resultants and tangents through the templates
+    OpenSees::VectorND<n> s  = layout->getResultant<n,scheme>(),
+                          s0 = generic->getResultant<n,scheme>();
+    double error = 0.0, scale = 0.0;
+    for (int i = 0; i < n; i++) {
+      error = fmax(error, fabs(s[i] - s0[i]));
+      scale = fmax(scale, fabs(s0[i]));
+    }
+    check(error, scale, "resultant", name, step);
+
+    for (State state : {State::Pres, State::Init}) {
+      OpenSees::MatrixND<n,n> k  = layout->getTangent<n,scheme>(state),
+                              k0 = generic->getTangent<n,scheme>(state);
+      error = scale = 0.0;
+      for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++) {
+          error = fmax(error, fabs(k(i,j) - k0(i,j)));
+          scale = fmax(scale, fabs(k0(i,j)));
+        }
+      check(error, scale, state == State::Init ? "initial tangent" : "tangent", name, step);
+    }
+
+    // Sensitivities of the copy in the order of its getType(), those of
+    // the generic copy as N-Mz-My-T
+    const ID &type = layout->getType();
+    const int m = layout->getOrder();
+    const Vector &ds  = layout->getStressResultantSensitivity(1, true);
+    const Vector &ds0 = generic->getStressResultantSensitivity(1, true);
+    const Matrix &dk  = layout->getSectionTangentSensitivity(1);
+    const Matrix &dk0 = generic->getSectionTangentSensitivity(1);
+    error = scale = 0.0;
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < m; j++)
+        if (type(j) == nmmt[i]) {
+          error = fmax(error, fabs(ds(j) - ds0(i)));
+          for (int k = 0; k < m; k++)
+            if (type(k) == nmmt[i])
+              error = fmax(error, fabs(dk(j,k) - dk0(i,i)));
+        }
+      scale = fmax(scale, fabs(ds0(i)));
+    }
+    check(error, scale, "sensitivity", name, step);
+
+    // Every fifth step is abandoned
+    if (step % 5 == 4) {
+      layout->revertToLastCommit();
+      generic->revertToLastCommit();
+      continue;
+    }
+
+    layout->commitState();
+    generic->commitState();
+
+    Vector de(m), de0(4);
+    for (int j = 0; j < m; j++)
+      de(j) = 0.5*e[j] + 1.0e-3*j;
+    for (int i = 0; i < 4; i++)
+      for (int j = 0; j < m; j++)
+        if (type(j) == nmmt[i])
+          de0(i) = de(j);
+    layout->commitSensitivity(de, 1, 1);
+    generic->commitSensitivity(de0, 1, 1);
+  }
+
+  delete layout;
+  delete generic;
+}
+
+int main()
+{
+  SensitiveMaterial steel(1, 2.0e5, 0.002);
+  SensitiveMaterial torsion(2, 8.0e4, 0.01);
+
+  FrameFiberSection3d section(3, 16, torsion, true, 0.0, false);
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 4; j++)
+      section.addFiber(steel, 1.0e-4*(1 + 0.1*i*j), 0.05*i - 0.04, 0.03*j + 0.01*i);
+
+  run<nmm>   (section, true,  "N-Mz-My");
+  run<nmmt>  (section, false, "N-Mz-My-T");
+  run<nmmvvt>(section, true,  "N-Mz-My-Vy-Vz-T");
+  run<nmmtb> (section, true,  "N-Mz-My-T-B-W");
+  run<mnm>   (section, false, "My-N-Mz");
+
+  if (failed == 0)
+    opserr << "FrameFiberSection3d layouts match the generic section\n";
+
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,165 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Compares the stress resultants and tangent of a LayeredShellFiberSection,
+// whose layers are evaluated in batches by material class, with those
+// assembled from copies of the layers driven one at a time through
+// setTrialStrain, along a cyclic history with commits and reverts.
+//
+#include <vector>
+#include <cmath>
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+
+#include <NDMaterial.h>
+#include <J2ThreeDimensional.h>
+#include <PlateFiberMaterial.h>
+#include <ElasticIsotropicPlateFiber.h>
+#include <LayeredShellFiberSection.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+#undef opserr
+#define opserr sserr
+
+static constexpr int numLayers = 5;
+
+// Layers of the section driven one at a time
+struct Reference {
+  NDMaterial *layer[numLayers];
+  double z[numLayers];
+  double weight[numLayers];
+
+  Reference(NDMaterial **fibers, const double *thickness)
+  {
+    double h = 0.0;
+    for (int i = 0; i < numLayers; i++)
+      h += thickness[i];
+
+    double bottom = -0.5*h;
+    for (int i = 0; i < numLayers; i++) {
+      layer[i] = fibers[i]->getCopy("PlateFiber");
+      z[i] = bottom + 0.5*thickness[i];
+      weight[i] = thickness[i];
+      bottom += thickness[i];
+    }
+  }
+
+  ~Reference()
+  {
+    for (int i = 0; i < numLayers; i++)
+      delete layer[i];
+  }
+
+  // Layer strains from the section strains, and the resultants and tangent
+  // sum weight*Asig^T*stress and sum weight*Asig^T*dd*Aeps from the layer
+  // stresses
+  void
+  resultants(const Vector &e, Vector &s, Matrix &k, bool set)
+  {
+    s.Zero();
+    k.Zero();
+    for (int i = 0; i < numLayers; i++) {
+      Matrix Aeps(5,8), Asig(5,8);
+      for (int j = 0; j < 3; j++) {
+        Aeps(j,j) = Asig(j,j) = 1.0;
+        Aeps(j,j+3) = -z[i];
+        Asig(j,j+3) = z[i];
+      }
+      Aeps(3,6) = Asig(3,6) = 1.0;
+      Aeps(4,7) = Asig(4,7) = 1.0;
+
+      if (set) {
+        Vector strain(5);
+        strain.addMatrixVector(0.0, Aeps, e, 1.0);
+        layer[i]->setTrialStrain(strain);
+      }
+
+      s.addMatrixTransposeVector(1.0, Asig, layer[i]->getStress(), weight[i]);
+      k.addMatrixTripleProduct(1.0, Asig, layer[i]->getTangent(), Aeps, weight[i]);
+    }
+  }
+};
+
+static int failed = 0;
+
+static void
+check(SectionForceDeformation &section, Reference &reference, const Vector &e,
+      bool set, const char *what, int step)
+{
+  Vector s(8);
+  Matrix k(8,8);
+  reference.resultants(e, s, k, set);
+
+  const Vector &ss = section.getStressResultant();
+  const Matrix &ks = section.getSectionTangent();
+
+  double sMax = 0.0, kMax = 0.0, sErr = 0.0, kErr = 0.0;
+  for (int i = 0; i < 8; i++) {
+    sMax = fmax(sMax, fabs(s(i)));
+    sErr = fmax(sErr, fabs(ss(i) - s(i)));
+    for (int j = 0; j < 8; j++) {
+      kMax = fmax(kMax, fabs(k(i,j)));
+      kErr = fmax(kErr, fabs(ks(i,j) - k(i,j)));
+    }
+  }
+
+  if (sErr > 1.0e-12*(1.0 + sMax) || kErr > 1.0e-12*(1.0 + kMax)) {
+    opserr << "FAILED: " << what << " at step " << step
+           << ", stress error " << sErr << ", tangent error " << kErr << endln;
+    failed++;
+  }
+}
+
+int main()
+{
+  J2ThreeDimensional j2(1, 1.0e4, 5.0e3, 10.0, 20.0, 10.0, 100.0);
+  PlateFiberMaterial plateFiber(10, j2);
+  ElasticIsotropicPlateFiber elastic(11, 1.2e4, 0.2, 0.0);
+
+  // Alternate the classes so that the batches reorder the layers
+  NDMaterial *fibers[numLayers] = {&plateFiber, &elastic, &plateFiber, &elastic, &plateFiber};
+  double thickness[numLayers] = {0.04, 0.06, 0.1, 0.03, 0.05};
+
+  LayeredShellFiberSection section(20, numLayers, thickness, fibers);
+  Reference reference(fibers, thickness);
+
+  Vector e(8);
+  for (int step = 0; step < 200; step++) {
+    for (int i = 0; i < 8; i++)
+      e(i) = 0.01*sin(0.07*step*(1 + 0.15*i) + 0.4*i)/(1 + 0.5*i);
+
+    section.setTrialSectionDeformation(e);
+    check(section, reference, e, true, "trial state", step);
+
+    // Every fifth step is abandoned and the section reverted
+    if (step % 5 == 4) {
+      section.revertToLastCommit();
+      for (int i = 0; i < numLayers; i++)
+        reference.layer[i]->revertToLastCommit();
+      check(section, reference, e, false, "reverted state", step);
+      continue;
+    }
+
+    section.commitState();
+    for (int i = 0; i < numLayers; i++)
+      reference.layer[i]->commitState();
+    check(section, reference, e, false, "committed state", step);
+  }
+
+  section.revertToStart();
+  for (int i = 0; i < numLayers; i++)
+    reference.layer[i]->revertToStart();
+  check(section, reference, e, false, "initial state", 200);
+
+  if (failed == 0)
+    opserr << "LayeredShellFiberSection batches match the layers\n";
+
+  return failed == 0 ? 0 : 1;
+}
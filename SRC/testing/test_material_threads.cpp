@@ -0,0 +1,216 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Drives independent copies of the condensation wrappers and of the beam
+// and shell sections from several threads at once and checks that every
+// thread reproduces the stresses and tangents of a serial run. Copies of a
+// material must not share workspaces, so any static Vector or Matrix left
+// in these paths shows up as a mismatch.
+//
+#include <thread>
+#include <vector>
+#include <string>
+#include <functional>
+#include <cmath>
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+
+#include <NDMaterial.h>
+#include <SectionForceDeformation.h>
+#include <J2ThreeDimensional.h>
+#include <ElasticIsotropicThreeDimensional.h>
+#include <PlateFiberMaterial.h>
+#include <PlaneStressMaterial.h>
+#include <PlaneStrainMaterial.h>
+#include <BeamFiberMaterial.h>
+#include <LayeredShellFiberSection.h>
+#include <MembranePlateFiberSection.h>
+#include <UniaxialMaterial.h>
+#include <Steel01.h>
+#include <ElasticMaterial.h>
+#include <FiberSection2d.h>
+#include <FiberSection3d.h>
+#include <ElasticSection3d.h>
+#include <SectionAggregator.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+#undef opserr
+#define opserr sserr
+
+static constexpr int numSteps   = 400;
+static constexpr int numThreads = 8;
+
+// Cyclic strain history, shifted by a seed so that every thread follows a
+// different path
+static void
+strainHistory(int step, int seed, Vector &strain)
+{
+  double amplitude = 0.004*(1.0 + 0.25*seed);
+  for (int i = 0; i < strain.Size(); i++)
+    strain(i) = amplitude*sin(0.05*step*(1 + 0.1*i) + 0.3*seed)/(1 + i);
+}
+
+// Record the response of a material copy along the history of a seed,
+// with the initial tangent, which J2Plasticity rebuilds on every read
+static std::vector<double>
+driveMaterial(NDMaterial &material, int seed)
+{
+  std::vector<double> response;
+  Vector strain(material.getOrder());
+
+  for (int step = 0; step < numSteps; step++) {
+    strainHistory(step, seed, strain);
+    material.setTrialStrain(strain);
+
+    const Vector &stress = material.getStress();
+    for (int i = 0; i < stress.Size(); i++)
+      response.push_back(stress(i));
+
+    const Matrix &tangent = material.getTangent();
+    for (int i = 0; i < tangent.noRows(); i++)
+      for (int j = 0; j < tangent.noCols(); j++)
+        response.push_back(tangent(i,j));
+
+    const Matrix &initialTangent = material.getInitialTangent();
+    for (int i = 0; i < initialTangent.noRows(); i++)
+      for (int j = 0; j < initialTangent.noCols(); j++)
+        response.push_back(initialTangent(i,j));
+
+    material.commitState();
+  }
+  return response;
+}
+
+// Record the response of a section copy along the history of a seed
+static std::vector<double>
+driveSection(SectionForceDeformation &section, int seed)
+{
+  std::vector<double> response;
+  Vector strain(section.getOrder());
+
+  for (int step = 0; step < numSteps; step++) {
+    strainHistory(step, seed, strain);
+    section.setTrialSectionDeformation(strain);
+
+    const Vector &stress = section.getStressResultant();
+    for (int i = 0; i < stress.Size(); i++)
+      response.push_back(stress(i));
+
+    const Matrix &tangent = section.getSectionTangent();
+    for (int i = 0; i < tangent.noRows(); i++)
+      for (int j = 0; j < tangent.noCols(); j++)
+        response.push_back(tangent(i,j));
+
+    section.commitState();
+  }
+  return response;
+}
+
+// Run the copies made by a case serially, then concurrently, and compare
+static int
+check(const std::string &name, std::function<std::vector<double>(int)> run)
+{
+  std::vector<std::vector<double>> serial(numThreads);
+  for (int seed = 0; seed < numThreads; seed++)
+    serial[seed] = run(seed);
+
+  std::vector<std::vector<double>> parallel(numThreads);
+  std::vector<std::thread> threads;
+  for (int seed = 0; seed < numThreads; seed++)
+    threads.emplace_back([&, seed]() { parallel[seed] = run(seed); });
+  for (std::thread &thread : threads)
+    thread.join();
+
+  int failed = 0;
+  for (int seed = 0; seed < numThreads; seed++)
+    if (parallel[seed] != serial[seed])
+      failed++;
+
+  opserr << name.c_str() << ": ";
+  if (failed)
+    opserr << failed << " of " << numThreads << " threads differ from the serial run\n";
+  else
+    opserr << "ok\n";
+
+  return failed;
+}
+
+int main()
+{
+  J2ThreeDimensional j2(1, 1.0e4, 5.0e3, 10.0, 20.0, 10.0, 100.0);
+  ElasticIsotropicThreeDimensional elastic(2, 1.2e4, 0.2, 0.0);
+
+  PlateFiberMaterial  plateFiber(10, j2);
+  PlaneStressMaterial planeStress(11, j2);
+  PlaneStrainMaterial planeStrain(12, j2);
+  BeamFiberMaterial   beamFiber(13, j2);
+  PlateFiberMaterial  elasticPlateFiber(14, elastic);
+
+  NDMaterial *fibers[3] = {&plateFiber, &elasticPlateFiber, &plateFiber};
+  double thickness[3] = {0.05, 0.1, 0.05};
+  LayeredShellFiberSection shell(20, 3, thickness, fibers);
+  MembranePlateFiberSection plate(21, 0.2, plateFiber);
+
+  // Beam sections of steel fibers over the depth and the width
+  Steel01 steel(30, 60.0, 29000.0, 0.02);
+  ElasticMaterial torsion(31, 1.0e4);
+  ElasticMaterial shear(32, 5.0e3);
+
+  FiberSection2d fiber2d(40, 10);
+  FiberSection3d fiber3d(41, 20, torsion);
+  for (int i = 0; i < 10; i++) {
+    fiber2d.addFiber(steel, 0.5, -4.5 + i);
+    fiber3d.addFiber(steel, 0.5, -4.5 + i, -1.0);
+    fiber3d.addFiber(steel, 0.5, -4.5 + i, 1.0);
+  }
+  SectionAggregator aggregator(42, fiber2d, shear, SECTION_RESPONSE_VY);
+  ElasticSection3d elastic3d(43, 29000.0, 10.0, 100.0, 50.0, 11000.0, 20.0);
+
+  std::vector<std::pair<std::string, NDMaterial*>> materials = {
+    {"J2ThreeDimensional",  &j2},
+    {"ElasticIsotropicThreeDimensional", &elastic},
+    {"PlateFiberMaterial",  &plateFiber},
+    {"PlaneStressMaterial", &planeStress},
+    {"PlaneStrainMaterial", &planeStrain},
+    {"BeamFiberMaterial",   &beamFiber},
+  };
+
+  int failed = 0;
+  for (auto &material : materials) {
+    NDMaterial *prototype = material.second;
+    failed += check(material.first, [prototype](int seed) {
+      NDMaterial *copy = prototype->getCopy();
+      std::vector<double> response = driveMaterial(*copy, seed);
+      delete copy;
+      return response;
+    });
+  }
+
+  std::vector<std::pair<std::string, SectionForceDeformation*>> sections = {
+    {"LayeredShellFiberSection",  &shell},
+    {"MembranePlateFiberSection", &plate},
+    {"FiberSection2d",    &fiber2d},
+    {"FiberSection3d",    &fiber3d},
+    {"SectionAggregator", &aggregator},
+    {"ElasticSection3d",  &elastic3d},
+  };
+
+  for (auto &section : sections) {
+    SectionForceDeformation *prototype = section.second;
+    failed += check(section.first, [prototype](int seed) {
+      SectionForceDeformation *copy = prototype->getCopy();
+      std::vector<double> response = driveSection(*copy, seed);
+      delete copy;
+      return response;
+    });
+  }
+
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,184 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Writes full and delta MPM checkpoints of a changing set of particles,
+// reads every one of them back and compares it with what was written. A
+// second checkpoint object then resumes from an earlier step and has to
+// prune the files of the first run as it writes new ones. A write that
+// fails has to remove its partial file and fail the next checkpoint.
+//
+#include <csignal>
+#include <cstddef>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#if defined(__unix__)
+#include <sys/resource.h>
+#endif
+
+#include "checkpoint.h"
+
+namespace {
+
+struct Particle {
+  mpm::Index id;
+  double mass;
+  unsigned material;
+  double stress[3];
+};
+
+const std::size_t offsets[4] = {offsetof(Particle, id),
+                                offsetof(Particle, mass),
+                                offsetof(Particle, material),
+                                offsetof(Particle, stress)};
+const std::size_t sizes[4] = {sizeof(mpm::Index), sizeof(double),
+                              sizeof(unsigned), 3 * sizeof(double)};
+const mpm::Checkpoint::Layout layout{4, offsets, sizes};
+
+int failed = 0;
+
+void check(bool condition, const std::string& message) {
+  if (!condition) {
+    std::cerr << "FAILED: " << message << "\n";
+    ++failed;
+  }
+}
+
+// Steps with a checkpoint file in the directory
+std::set<mpm::Index> files(const boost::filesystem::path& directory) {
+  std::set<mpm::Index> steps;
+  for (boost::filesystem::directory_iterator itr(directory);
+       itr != boost::filesystem::directory_iterator(); ++itr)
+    steps.insert(std::stoul(itr->path().stem().string().substr(5)));
+  return steps;
+}
+
+// Particles at a step, one particle leaves and the mass of one changes
+std::vector<Particle> particles(mpm::Index step) {
+  std::vector<Particle> pods;
+  for (unsigned i = 0; i < 100; ++i) {
+    if (i == step) continue;
+    Particle pod{10 * i, 1. + i, i % 3, {0.5 * i, -0.5 * i, 0.}};
+    if (i == step + 1) pod.mass += step;
+    if (step % 2 == 0) pod.stress[2] = step;
+    pods.push_back(pod);
+  }
+  return pods;
+}
+
+// Write the checkpoint of a step and read it back
+void round_trip(mpm::Checkpoint& checkpoint, mpm::Index step) {
+  const std::vector<Particle> pods = particles(step);
+  const std::vector<mpm::Checkpoint::NodalConstraint> constraints{
+      {3, 0, 0.}, {7, 1, step < 4 ? 0. : 1.}};
+
+  auto& snapshot = checkpoint.initialise(step, 0.25 * step, 0.25);
+  checkpoint.add_particles("P2D", layout, pods.data(), pods.size(),
+                           sizeof(Particle));
+  snapshot.constraints = constraints;
+  checkpoint.write();
+  checkpoint.wait();
+
+  const auto read = checkpoint.read(step, {{"P2D", layout}});
+  const std::string at = " at step " + std::to_string(step);
+  check(read.step == step, "step" + at);
+  check(read.time == 0.25 * step && read.dt == 0.25, "time" + at);
+  check(read.constraints == constraints, "constraints" + at);
+
+  const auto& records = read.particles.at("P2D");
+  std::vector<Particle> back(records.size() /
+                             mpm::Checkpoint::record_size(layout));
+  mpm::Checkpoint::unpack(records, layout, back.data(), sizeof(Particle));
+  check(back.size() == pods.size(), "number of particles" + at);
+  for (std::size_t i = 0; i < back.size() && i < pods.size(); ++i) {
+    bool same = back[i].id == pods[i].id && back[i].mass == pods[i].mass &&
+                back[i].material == pods[i].material;
+    for (unsigned j = 0; j < 3; ++j)
+      same = same && back[i].stress[j] == pods[i].stress[j];
+    if (!same) {
+      check(false, "particle " + std::to_string(i) + at);
+      break;
+    }
+  }
+}
+
+}  // namespace
+
+int main() {
+  const boost::filesystem::path directory =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("mpm-checkpoint-%%%%-%%%%");
+  boost::filesystem::create_directories(directory);
+  auto filename = [&directory](mpm::Index step) {
+    return (directory / ("ckpt-" + std::to_string(step) + ".ckpt")).string();
+  };
+
+  // Full checkpoints at steps 0, 3 and 6, delta checkpoints in between
+  {
+    mpm::Checkpoint checkpoint(filename, 2, 3);
+    for (mpm::Index step = 0; step < 8; ++step) round_trip(checkpoint, step);
+  }
+  check(files(directory) == std::set<mpm::Index>{6, 7},
+        "retained checkpoints of the first run");
+
+  // Restart from step 4 of a run that kept its checkpoints up to step 5
+  boost::filesystem::remove_all(directory);
+  boost::filesystem::create_directories(directory);
+  {
+    mpm::Checkpoint checkpoint(filename, 10, 3);
+    for (mpm::Index step = 0; step < 6; ++step) round_trip(checkpoint, step);
+  }
+  {
+    mpm::Checkpoint checkpoint(filename, 2, 3);
+    checkpoint.resume(4);
+    check(checkpoint.read(4, {{"P2D", layout}}).step == 4,
+          "restart checkpoint");
+    for (mpm::Index step = 5; step < 9; ++step) round_trip(checkpoint, step);
+  }
+  check(files(directory) == std::set<mpm::Index>{5, 7, 8},
+        "checkpoints written before the restart are pruned");
+
+  // A write that fails half way leaves no file and fails the next
+  // checkpoint. The file size limit makes the write fail after the header.
+  boost::filesystem::remove_all(directory);
+  boost::filesystem::create_directories(directory);
+#if defined(__unix__)
+  {
+    struct rlimit limit;
+    getrlimit(RLIMIT_FSIZE, &limit);
+    const rlim_t size = limit.rlim_cur;
+    std::signal(SIGXFSZ, SIG_IGN);
+    limit.rlim_cur = 512;
+    setrlimit(RLIMIT_FSIZE, &limit);
+
+    mpm::Checkpoint checkpoint(filename, 2, 1);
+    const std::vector<Particle> pods = particles(0);
+    checkpoint.initialise(0, 0., 0.25);
+    checkpoint.add_particles("P2D", layout, pods.data(), pods.size(),
+                             sizeof(Particle));
+    checkpoint.write();
+    bool rethrown = false;
+    try {
+      checkpoint.initialise(1, 0.25, 0.25);
+    } catch (std::exception&) {
+      rethrown = true;
+    }
+    check(rethrown, "failed write is rethrown");
+    check(files(directory).empty(), "failed write leaves no file");
+
+    limit.rlim_cur = size;
+    setrlimit(RLIMIT_FSIZE, &limit);
+  }
+#endif
+
+  boost::filesystem::remove_all(directory);
+
+  if (failed == 0) std::cout << "MPM checkpoint round trip passed\n";
+  return failed == 0 ? 0 : 1;
+}
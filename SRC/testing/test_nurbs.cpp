@@ -0,0 +1,143 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Compares the fixed degree B-spline kernels of nurbs.tpp with the Vector
+// and Matrix entry points of nurbs.cpp, and the derivatives of both with
+// those of the single function algorithm of dersOneBasisFuns, on knot
+// vectors with repeated interior knots. Derivatives above the degree have
+// to be zero, and a BasisTable has to hold the values of DersBasisFuns at
+// the mapped quadrature points of every span of non-zero length.
+//
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <Vector.h>
+#include <Matrix.h>
+#include "nurbs.h"
+
+using namespace OpenSees;
+
+namespace {
+
+int failed = 0;
+
+void check(bool condition, const std::string& message) {
+  if (!condition) {
+    std::cerr << "FAILED: " << message << "\n";
+    ++failed;
+  }
+}
+
+bool close(double a, double b) {
+  return std::fabs(a - b) <= 1.0e-10 * (1.0 + std::fabs(b));
+}
+
+// Open knot vector of degree p on [0, 4] with interior knots 1, 2 of
+// multiplicity p and 3 of multiplicity 1
+std::vector<double> knots(int p) {
+  std::vector<double> U(p + 1, 0.0);
+  for (int k = 0; k < p; k++) U.push_back(1.0);
+  for (int k = 0; k < p; k++) U.push_back(2.0);
+  U.push_back(3.0);
+  for (int k = 0; k <= p; k++) U.push_back(4.0);
+  return U;
+}
+
+template <int p, int order>
+void compare() {
+  const std::vector<double> U = knots(p);
+  const int m = int(U.size()) - 1;
+  const int n = m - p - 1;
+  const std::string degree = "degree " + std::to_string(p) + ", order " +
+                             std::to_string(order);
+
+  Vector knot(m + 1);
+  for (int k = 0; k <= m; k++) knot(k) = U[k];
+
+  for (int s = 0; s <= 80; s++) {
+    const double u = 4.0 * s / 80;
+    const std::string at = degree + " at u = " + std::to_string(u);
+
+    const int span = Nurbs::FindSpan<p>(n, u, U.data());
+    check(span == FindSpan(n, p, u, knot), "span of " + at);
+    check(U[span] <= u && (u < U[span + 1] || (span == n && u == U[n + 1])) &&
+              U[span] < U[span + 1],
+          "span of " + at + " holds u");
+
+    double N[p + 1];
+    Nurbs::BasisFuns<p>(span, u, U.data(), N);
+    Vector N1(p + 1);
+    BasisFuns(span, u, p, knot, N1);
+
+    double ders[order + 1][p + 1];
+    Nurbs::DersBasisFuns<p, order>(span, u, U.data(), ders);
+    Matrix ders1(order + 1, p + 1);
+    dersBasisFuns(span, u, p, order, knot, ders1);
+
+    bool same = true;
+    double sum = 0.0;
+    for (int j = 0; j <= p; j++) {
+      same = same && N[j] == N1(j) && close(N[j], ders[0][j]);
+      sum += N[j];
+      for (int k = 0; k <= order; k++)
+        same = same && ders[k][j] == ders1(k, j);
+      for (int k = p + 1; k <= order; k++)
+        same = same && ders[k][j] == 0.0;
+    }
+    check(same, "basis functions of " + at);
+    check(close(sum, 1.0), "partition of unity " + at);
+
+    // Single function algorithm, up to the degree and inside the range it
+    // takes as half open
+    if (u < U[m]) {
+      const int top = order < p ? order : p;
+      double one[order + 1];
+      same = true;
+      for (int j = 0; j <= p; j++) {
+        dersOneBasisFuns(p, m, knot, span - p + j, u, top, one);
+        for (int k = 0; k <= top; k++) same = same && close(ders[k][j], one[k]);
+      }
+      check(same, "derivatives of " + at + " against dersOneBasisFuns");
+    }
+  }
+
+  // Three point Gauss rule on every span
+  const double xi[3] = {-std::sqrt(0.6), 0.0, std::sqrt(0.6)};
+  Nurbs::BasisTable<p, order, 3> table(m + 1, U.data(), xi);
+  check(table.numSpans() == 4, "spans of the table of " + degree);
+
+  bool same = true;
+  for (int e = 0; e < table.numSpans(); e++) {
+    const auto& span = table[e];
+    const int i = span.index;
+    same = same && U[i] < U[i + 1] &&
+           close(span.jacobian, 0.5 * (U[i + 1] - U[i]));
+    for (int q = 0; q < 3; q++) {
+      same = same && close(span.u[q], 0.5 * (U[i + 1] + U[i]) + span.jacobian * xi[q]);
+      double ders[order + 1][p + 1];
+      Nurbs::DersBasisFuns<p, order>(i, span.u[q], U.data(), ders);
+      for (int k = 0; k <= order; k++)
+        for (int j = 0; j <= p; j++) same = same && span.ders[q][k][j] == ders[k][j];
+    }
+  }
+  check(same, "table of " + degree);
+}
+
+}  // namespace
+
+int main() {
+  compare<1, 1>();
+  compare<1, 3>();
+  compare<2, 2>();
+  compare<2, 4>();
+  compare<3, 2>();
+  compare<3, 5>();
+
+  if (failed == 0) std::cout << "NURBS basis functions passed\n";
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Compares the batched brick Jacobians of shp3d(table, ...) with the single
+// point shp3d for distorted 8-node bricks, on tables built by shp3d and by
+// brcshl. A 20-node table is checked against the legacy brcshl arrays and,
+// on an affine element, against the exact Jacobian.
+//
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "shp3dv.h"
+
+namespace {
+
+int failed = 0;
+
+void check(bool condition, const std::string& message) {
+  if (!condition) {
+    std::cerr << "FAILED: " << message << "\n";
+    ++failed;
+  }
+}
+
+bool close(double a, double b) {
+  return std::fabs(a - b) <= 1.0e-12 * (1.0 + std::fabs(b));
+}
+
+// Natural coordinates of the corners, in the node order of shp3d
+const double corner[8][3] = {{-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+                             {-1, -1, 1},  {1, -1, 1},  {1, 1, 1},  {-1, 1, 1}};
+
+// Nodal coordinates of numElements distorted 8-node bricks, in the layout
+// of the batched shp3d
+std::vector<double> bricks(int numElements) {
+  std::vector<double> xl(numElements * 3 * 8);
+  for (int e = 0; e < numElements; e++)
+    for (int a = 0; a < 8; a++)
+      for (int i = 0; i < 3; i++)
+        xl[e * 24 + i * 8 + a] = (1.0 + 0.1 * e) * corner[a][i] + 0.3 * i +
+                                 0.05 * std::sin(1.0 + e + 3 * a + 7 * i);
+  return xl;
+}
+
+// Batched Jacobians of the bricks at the points xi of the table against
+// the single point shp3d
+void compare(const Shp3dTable& table, const double xi[][3],
+             const std::string& name) {
+  const int numElements = 13;
+  const int nip = table.nip;
+  const std::vector<double> xl = bricks(numElements);
+  std::vector<double> xsj(numElements * nip);
+  std::vector<double> shp(numElements * nip * 4 * 8);
+  shp3d(table, numElements, xl.data(), xsj.data(), shp.data());
+
+  for (int e = 0; e < numElements; e++) {
+    double xe[3][8];
+    for (int i = 0; i < 3; i++)
+      for (int a = 0; a < 8; a++) xe[i][a] = xl[e * 24 + i * 8 + a];
+
+    for (int ip = 0; ip < nip; ip++) {
+      const std::string at = name + ", element " + std::to_string(e) +
+                             ", point " + std::to_string(ip);
+      double xsj1, shp1[4][8];
+      shp3d(xi[ip], xsj1, shp1, xe);
+      check(close(xsj[e * nip + ip], xsj1), "determinant of " + at);
+
+      bool same = true;
+      for (int i = 0; i < 4; i++)
+        for (int a = 0; a < 8; a++)
+          same = same && close(shp[((e * nip + ip) * 4 + i) * 8 + a], shp1[i][a]);
+      check(same, "shape functions of " + at);
+    }
+  }
+}
+
+}  // namespace
+
+int main() {
+  // 8-node table from shp3d at the 2x2x2 Gauss rule
+  const double g = 1.0 / std::sqrt(3.0);
+  double xi[8][3], w[8];
+  for (int ip = 0; ip < 8; ip++) {
+    for (int i = 0; i < 3; i++) xi[ip][i] = g * corner[ip][i];
+    w[ip] = 1.0;
+  }
+  Shp3dTable table;
+  shp3d(8, xi, w, table);
+  compare(table, xi, "shp3d table");
+
+  // The 8 point rule of brcshl has its points in the order of the corners
+  Shp3dTable brick;
+  check(brcshl(brick, 8, 8) == 0, "8-node brcshl table");
+  compare(brick, xi, "brcshl table");
+
+  // 20-node table against the legacy arrays, which have no room for more
+  // than 20 nodes
+  double shl[4][20][27], w20[27];
+  Shp3dTable table20;
+  check(brcshl(shl, w20, 27, 20) == 0 && brcshl(table20, 27, 20) == 0,
+        "20-node brcshl");
+  bool same = table20.nen == 20 && table20.nip == 27;
+  for (int ip = 0; ip < 27; ip++) {
+    same = same && table20.w[ip] == w20[ip];
+    for (int i = 0; i < 4; i++)
+      for (int a = 0; a < 20; a++)
+        same = same && table20.shl[ip][i][a] == shl[i][a][ip];
+  }
+  check(same, "20-node table against the legacy brcshl");
+  check(brcshl(shl, w20, 27, 27) != 0, "27 nodes rejected by the legacy brcshl");
+
+  // On the affine element x = A X + c the Jacobian is A at every point
+  const double A[3][3] = {{2.0, 0.3, 0.1}, {-0.2, 1.5, 0.4}, {0.1, -0.3, 0.8}};
+  const double detA = A[0][0] * (A[1][1] * A[2][2] - A[1][2] * A[2][1]) -
+                      A[0][1] * (A[1][0] * A[2][2] - A[1][2] * A[2][0]) +
+                      A[0][2] * (A[1][0] * A[2][1] - A[1][1] * A[2][0]);
+  double Ainv[3][3];
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      Ainv[j][i] = (A[(i + 1) % 3][(j + 1) % 3] * A[(i + 2) % 3][(j + 2) % 3] -
+                    A[(i + 1) % 3][(j + 2) % 3] * A[(i + 2) % 3][(j + 1) % 3]) /
+                   detA;
+
+  // Natural coordinates of the nodes of shap3dv, in the order of its
+  // L, M, N tables
+  const int L[20] = {3, 1, 1, 3, 3, 1, 1, 3, 2, 1, 2, 3, 2, 1, 2, 3, 3, 1, 1, 3},
+            M[20] = {3, 3, 1, 1, 3, 3, 1, 1, 3, 2, 1, 2, 3, 2, 1, 2, 3, 3, 1, 1},
+            N[20] = {3, 3, 3, 3, 1, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 1, 2, 2, 2, 2};
+  std::vector<double> xl20(3 * 20);
+  for (int a = 0; a < 20; a++) {
+    const double X[3] = {2.0 - L[a], 2.0 - M[a], 2.0 - N[a]};
+    for (int i = 0; i < 3; i++)
+      xl20[i * 20 + a] = A[i][0] * X[0] + A[i][1] * X[1] + A[i][2] * X[2] + i;
+  }
+  std::vector<double> xsj20(27), shp20(27 * 4 * 20);
+  shp3d(table20, 1, xl20.data(), xsj20.data(), shp20.data());
+
+  same = true;
+  for (int ip = 0; ip < 27; ip++) {
+    same = same && close(xsj20[ip], detA);
+    for (int a = 0; a < 20; a++) {
+      for (int j = 0; j < 3; j++) {
+        double dN = 0.0;
+        for (int i = 0; i < 3; i++) dN += table20.shl[ip][i][a] * Ainv[i][j];
+        same = same && close(shp20[(ip * 4 + j) * 20 + a], dN);
+      }
+      same = same && shp20[(ip * 4 + 3) * 20 + a] == table20.shl[ip][3][a];
+    }
+  }
+  check(same, "20-node batched Jacobian of an affine element");
+
+  if (failed == 0) std::cout << "shp3d tables passed\n";
+  return failed == 0 ? 0 : 1;
+}
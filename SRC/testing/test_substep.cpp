@@ -0,0 +1,214 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Drives a SubstepMaterial around a material that integrates its hardening
+// law with a single explicit step per trial, so that its stress depends on
+// the size of the increments. The substepped stress has to follow the
+// exact solution, repeated trials and revertToLastCommit have to start
+// over from the committed state, and committing or trials without an
+// increment must not copy the wrapped material. When the tolerance cannot be met within the limit on the
+// substeps the trial has to fail.
+//
+#include <cmath>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+
+#include <UniaxialMaterial.h>
+#include <SubstepMaterial.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+#undef opserr
+#define opserr sserr
+
+static constexpr double E      = 30000.0;
+static constexpr double sigma0 = 30.0;     // end of the linear branch
+static constexpr double sigmaY = 60.0;     // saturation stress
+
+// Linear up to sigma0, then hardening as dsigma/deps = E (sigmaY - sigma)
+// / (sigmaY - sigma0) on loading, with an explicit step from the committed
+// stress. Counts the copies of all its instances.
+class ExplicitMaterial : public UniaxialMaterial {
+public:
+  ExplicitMaterial(int tag)
+    : UniaxialMaterial(tag, 0),
+      Tstrain(0.0), Tstress(0.0), Ttangent(E),
+      Cstrain(0.0), Cstress(0.0)
+  {
+  }
+
+  int
+  setTrialStrain(double strain, double strainRate = 0.0)
+  {
+    Tstrain = strain;
+    const double dStrain = Tstrain - Cstrain;
+    Ttangent = (dStrain > 0.0 && Cstress >= sigma0)
+             ? E*(sigmaY - Cstress)/(sigmaY - sigma0) : E;
+    Tstress = Cstress + Ttangent*dStrain;
+    return 0;
+  }
+
+  double getStrain(void) {return Tstrain;}
+  double getStress(void) {return Tstress;}
+  double getTangent(void) {return Ttangent;}
+  double getInitialTangent(void) {return E;}
+
+  int
+  commitState(void)
+  {
+    Cstrain = Tstrain;
+    Cstress = Tstress;
+    return 0;
+  }
+
+  int
+  revertToLastCommit(void)
+  {
+    return this->setTrialStrain(Cstrain);
+  }
+
+  int
+  revertToStart(void)
+  {
+    Cstrain = Cstress = 0.0;
+    return this->setTrialStrain(0.0);
+  }
+
+  UniaxialMaterial *
+  getCopy(void)
+  {
+    copies++;
+    ExplicitMaterial *theCopy = new ExplicitMaterial(this->getTag());
+    theCopy->Cstrain = Cstrain;
+    theCopy->Cstress = Cstress;
+    theCopy->setTrialStrain(Cstrain);
+    return theCopy;
+  }
+
+  int sendSelf(int commitTag, Channel &theChannel) {return -1;}
+  int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker) {return -1;}
+  void Print(OPS_Stream &s, int flag = 0) {}
+
+  static int copies;
+
+private:
+  double Tstrain, Tstress, Ttangent;
+  double Cstrain, Cstress;
+};
+
+int ExplicitMaterial::copies = 0;
+
+// Stress of the hardening law on monotonic loading
+static double
+exact(double strain)
+{
+  const double strain0 = sigma0/E;
+  if (strain <= strain0)
+    return E*strain;
+  return sigmaY - (sigmaY - sigma0)*exp(-E*(strain - strain0)/(sigmaY - sigma0));
+}
+
+static int failed = 0;
+
+static void
+check(bool condition, const char *what, int step)
+{
+  if (!condition) {
+    opserr << "FAILED: " << what << " at step " << step << endln;
+    failed++;
+  }
+}
+
+int main()
+{
+  const double tol = 1.0e-4;
+  ExplicitMaterial material(1);
+  SubstepMaterial substep(2, material, tol, 4096);
+
+  // Steps taken with a single trial, and reverts right after a commit,
+  // need no copy of the wrapped material
+  ExplicitMaterial::copies = 0;
+  const double strain0 = sigma0/E;
+  for (int step = 1; step <= 4; step++) {
+    const double strain = 0.2*step*strain0;
+    check(substep.setTrialStrain(strain) == 0, "linear trial", step);
+    check(fabs(substep.getStress() - E*strain) <= 1.0e-12*E*strain, "linear stress", step);
+    substep.commitState();
+    check(substep.revertToLastCommit() == 0, "revert after a commit", step);
+  }
+  check(ExplicitMaterial::copies == 0, "copies on commit", 4);
+
+  // Trials at the committed strain integrate nothing, so repeating them
+  // needs no copy either
+  for (int i = 0; i < 3; i++) {
+    check(substep.setTrialStrain(0.8*strain0) == 0, "trial without increment", i);
+    check(substep.getStress() == E*0.8*strain0, "stress without increment", i);
+  }
+  check(ExplicitMaterial::copies == 0, "copies without increment", 3);
+
+  // Large increments into the hardening branch follow the exact solution,
+  // also when each is preceded by abandoned trials and a revert
+  double strain = 0.8*strain0;
+  for (int step = 0; step < 10; step++) {
+    const double committedStress = substep.getStress();
+    const double target = strain + 0.5*strain0;
+
+    check(substep.setTrialStrain(target + 0.3*strain0) == 0, "abandoned trial", step);
+    check(substep.setTrialStrain(strain - 0.2*strain0) == 0, "abandoned unloading", step);
+    check(substep.revertToLastCommit() == 0, "revertToLastCommit", step);
+    check(substep.getStress() == committedStress, "reverted stress", step);
+
+    check(substep.setTrialStrain(target) == 0, "trial", step);
+    const double stress = substep.getStress();
+    check(fabs(stress - exact(target)) <= 2.0e-3*sigmaY, "substepped stress", step);
+
+    // The same trial again gives the same stress
+    check(substep.setTrialStrain(strain + 0.1*strain0) == 0, "other trial", step);
+    check(substep.setTrialStrain(target) == 0, "repeated trial", step);
+    check(substep.getStress() == stress, "repeated stress", step);
+
+    substep.commitState();
+    strain = target;
+
+    // A copy starts from the committed state of the original
+    UniaxialMaterial *theCopy = substep.getCopy();
+    check(theCopy->getStress() == stress, "stress of a copy", step);
+    theCopy->setTrialStrain(target + 0.5*strain0);
+    substep.setTrialStrain(target + 0.5*strain0);
+    check(theCopy->getStress() == substep.getStress(), "trial of a copy", step);
+    substep.revertToLastCommit();
+    delete theCopy;
+  }
+
+  // The error of a coarse integration is larger than that of the wrapper
+  {
+    ExplicitMaterial coarse(3);
+    coarse.setTrialStrain(1.5*strain0);
+    coarse.commitState();
+    coarse.setTrialStrain(2.5*strain0);
+    SubstepMaterial fine(4, material, tol, 4096);
+    fine.setTrialStrain(1.5*strain0);
+    fine.commitState();
+    fine.setTrialStrain(2.5*strain0);
+    check(fabs(fine.getStress() - exact(2.5*strain0))
+          < fabs(coarse.getStress() - exact(2.5*strain0)), "error against a single step", 0);
+  }
+
+  // The tolerance cannot be met with two substeps
+  SubstepMaterial limited(5, material, tol, 2);
+  limited.setTrialStrain(strain0);
+  limited.commitState();
+  check(limited.setTrialStrain(3.0*strain0) < 0, "failure above the tolerance", 0);
+
+  substep.revertToStart();
+  check(substep.getStress() == 0.0 && substep.getStrain() == 0.0, "revertToStart", 0);
+
+  if (failed == 0)
+    opserr << "SubstepMaterial error control passed\n";
+
+  return failed == 0 ? 0 : 1;
+}
@@ -1,4 +1,5 @@
 from opensees.lib import backbone
+from opensees.tcl import TclRuntime
 from numpy import linspace
 
 fc = 4e3
@@ -8,3 +9,42 @@ strain = linspace(-0.003, 0.003, 100)
 with backbone.Popovics(1, fc, epsc, Ec) as b:
     print([b.getStress(e) for e in strain])
 
+# A Tabulated backbone has to reproduce the backbone it wraps within the
+# errors it reports, also at the ends of its range, and evaluate the
+# wrapped backbone outside of it. The Mander tangent jumps at zero strain,
+# so the errors between the knots are compared on the compression side
+fc = 4.0
+Ec = 3600.0
+epsc = 0.002
+strainMax = 0.006
+tol = 1e-4
+rt = TclRuntime(1, 1)
+rt.eval(f"hystereticBackbone Mander 1 {fc} {epsc} {Ec}")
+rt.eval(f"hystereticBackbone Tabulated 2 1 {strainMax} -tol {tol} -maxPoints 200")
+wrapped = rt.lift("backbone", 1)
+table = rt.lift("backbone", 2)
+
+strain = linspace(-strainMax, 0.0, 2001)
+stress = [wrapped.getStress(e) for e in strain]
+tangent = [wrapped.getTangent(e) for e in strain]
+stressScale = max(abs(s) for s in stress)
+tangentScale = max(abs(m) for m in tangent)
+
+stressError = max(abs(table.getStress(e) - s) for e, s in zip(strain, stress))/stressScale
+tangentError = max(abs(table.getTangent(e) - m) for e, m in zip(strain, tangent))/tangentScale
+
+print(table.getNumPoints(), table.getStressError(), table.getTangentError())
+print(stressError, tangentError)
+
+assert table.getNumPoints() <= 200
+assert table.getStressError() <= tol
+assert stressError <= 1.1*table.getStressError()
+assert tangentError <= 1.1*table.getTangentError()
+
+for e in (-strainMax, 0.0, strainMax):
+    assert abs(table.getStress(e) - wrapped.getStress(e)) <= 1e-12*stressScale
+    assert abs(table.getTangent(e) - wrapped.getTangent(e)) <= 1e-12*tangentScale
+
+for e in (-2*strainMax, 1.5*strainMax):
+    assert table.getStress(e) == wrapped.getStress(e)
+    assert table.getTangent(e) == wrapped.getTangent(e)
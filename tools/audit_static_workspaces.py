@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""Audit of static workspaces in the material library.
+
+Function local, file scope and class static Vector, Matrix, ID and tensor
+objects, and static double or int arrays without an initializer, are
+shared by every instance of a material, so two threads driving different
+copies of the same material overwrite each other's stresses and tangents.
+New code should keep workspaces on the stack, in per-instance members, or
+declare them thread_local. Constants declared static const and arrays
+initialized with their values are accepted.
+
+The remaining static workspaces are counted per file and compared with a
+baseline. The audit fails when a file gains static workspaces, and reports
+the files that dropped below the baseline so that it can be tightened with
+--update.
+
+Usage:
+    python3 audit_static_workspaces.py [--root SRC/material]
+        [--baseline tools/static_workspaces.txt] [--update] [--verbose]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+
+# Declarations of static workspaces, const and thread_local ones are
+# accepted. Functions returning one of these types are not workspaces.
+STATIC_WORKSPACE = re.compile(
+    r"^\s*static\s+"
+    r"(?:OpenSees::)?(?:Vector|Matrix|ID|Vector3D|Matrix3D|VectorND\s*<[^>]*>|"
+    r"MatrixND\s*<[^>]*>|VoigtVector|VoigtMatrix|T2Vector)"
+    r"\s+[A-Za-z_]\w*\s*"
+    r"(?:[;,=\[{]|\((?!\s*\)|\s*(?:void|const|int|double|bool|char)\b))")
+
+# Static arrays of numbers sized but not initialized, such as the fiber
+# location buffers the fiber sections used to have
+STATIC_ARRAY = re.compile(
+    r"^\s*static\s+(?:double|float|int)\s+[A-Za-z_]\w*\s*\[[^\]]*\]\s*;")
+
+SOURCE_EXTENSIONS = (".cpp", ".cc", ".h", ".hpp", ".tpp")
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(TOOLS_DIR)
+
+
+def strip_comments(text):
+    """Remove block and line comments, preserving line numbers."""
+    text = re.sub(r"/\*.*?\*/",
+                  lambda match: "\n" * match.group(0).count("\n"),
+                  text, flags=re.DOTALL)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def strip_disabled(lines):
+    """Blank the lines of #if 0 blocks, preserving line numbers."""
+    disabled = []
+    for number, line in enumerate(lines):
+        directive = line.strip()
+        if re.match(r"#\s*if", directive):
+            disabled.append(re.match(r"#\s*if\s+0\b", directive) is not None)
+        elif re.match(r"#\s*else", directive) and disabled:
+            disabled[-1] = not disabled[-1]
+        elif re.match(r"#\s*endif", directive) and disabled:
+            disabled.pop()
+        elif any(disabled):
+            lines[number] = ""
+    return lines
+
+
+def scan_file(path):
+    """Line numbers of the static workspaces declared in a file."""
+    with open(path, errors="replace") as source:
+        lines = strip_disabled(strip_comments(source.read()).split("\n"))
+    return [number + 1 for number, line in enumerate(lines)
+            if STATIC_WORKSPACE.match(line) or STATIC_ARRAY.match(line)]
+
+
+def scan(root):
+    """Static workspaces of each source file under root, keyed by the
+    path relative to the repository."""
+    found = {}
+    for directory, _, files in os.walk(root):
+        for name in sorted(files):
+            if not name.endswith(SOURCE_EXTENSIONS):
+                continue
+            path = os.path.join(directory, name)
+            if not os.path.isfile(path):
+                continue
+            lines = scan_file(path)
+            if lines:
+                found[os.path.relpath(path, REPO_DIR)] = lines
+    return found
+
+
+def read_baseline(path):
+    """Per-file counts of the baseline."""
+    baseline = {}
+    if not os.path.exists(path):
+        return baseline
+    with open(path) as lines:
+        for line in lines:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            count, name = line.split(None, 1)
+            baseline[name] = int(count)
+    return baseline
+
+
+def write_baseline(path, found):
+    """Write the per-file counts as the new baseline."""
+    with open(path, "w") as baseline:
+        baseline.write("# Static workspaces remaining per file,\n"
+                       "# regenerate with tools/audit_static_workspaces.py "
+                       "--update\n")
+        for name in sorted(found):
+            baseline.write("{} {}\n".format(len(found[name]), name))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+    parser.add_argument("--root",
+                        default=os.path.join(REPO_DIR, "SRC", "material"),
+                        help="directory to audit")
+    parser.add_argument("--baseline",
+                        default=os.path.join(TOOLS_DIR,
+                                             "static_workspaces.txt"),
+                        help="per-file counts of accepted workspaces")
+    parser.add_argument("--update", action="store_true",
+                        help="write the current counts as the baseline")
+    parser.add_argument("--verbose", action="store_true",
+                        help="list every remaining static workspace")
+    args = parser.parse_args()
+
+    found = scan(args.root)
+    total = sum(len(lines) for lines in found.values())
+
+    if args.update:
+        write_baseline(args.baseline, found)
+        print("{} static workspaces in {} files written to {}".format(
+            total, len(found), args.baseline))
+        return 0
+
+    baseline = read_baseline(args.baseline)
+    failures = []
+    for name in sorted(found):
+        lines = found[name]
+        if args.verbose:
+            for line in lines:
+                print("{}:{}".format(name, line))
+        if len(lines) > baseline.get(name, 0):
+            failures.append((name, lines))
+
+    for name, lines in failures:
+        print("{}: {} static workspaces, baseline {} (lines {})".format(
+            name, len(lines), baseline.get(name, 0),
+            ", ".join(str(line) for line in lines)), file=sys.stderr)
+
+    reduced = [name for name, count in baseline.items()
+               if len(found.get(name, [])) < count]
+    if reduced:
+        print("{} files are below the baseline, tighten it with "
+              "--update".format(len(reduced)))
+
+    print("{} static workspaces remaining in {} files".format(
+        total, len(found)))
+    if failures:
+        print("Use stack, per-instance or thread_local workspaces instead "
+              "of static ones", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,383 @@
+#!/usr/bin/env python3
+"""Throughput benchmarks of the MPM solvers.
+
+Generates canonical MPM problems procedurally, runs them with an MPM
+executable at several problem sizes and thread counts, and collects the
+per-phase timings written by the solvers with post-processing
+"phase_timings". Results are written as JSON lines, one record per run,
+with the throughput of each phase in particles times steps per second.
+
+Usage:
+    python3 mpm_benchmark.py --mpm /path/to/mpm \\
+        --problems column2d slope --sizes 1 2 4 --threads 1 2 4 8 \\
+        --output benchmark.jsonl
+
+Problems:
+    column2d       Granular column collapse in 2D (Mohr-Coulomb, explicit)
+    column3d       Granular column collapse in 3D (Mohr-Coulomb, explicit)
+    slope          Slope under gravity in 2D (Mohr-Coulomb, explicit)
+    consolidation  Two-phase consolidation column in 2D (explicit)
+    dambreak       Dam break in 2D (Newtonian, semi-implicit Navier-Stokes)
+"""
+
+import argparse
+import glob
+import itertools
+import json
+import os
+import subprocess
+import sys
+import time
+
+
+# Base resolution in cells per unit length, scaled by the problem size
+CELLS_PER_LENGTH = 10
+# Particles per direction in each filled cell
+PARTICLES_PER_DIR = 2
+
+
+def grid(lengths, ncells):
+    """Structured grid of a box, returns nodes and cells.
+
+    Nodes are numbered along x first, then y and z. Cells are quadrilaterals
+    in 2D and hexahedra in 3D with the node ordering of ED2Q4 and ED3H8.
+    """
+    dim = len(lengths)
+    npoints = [n + 1 for n in ncells]
+    spacing = [l / n for l, n in zip(lengths, ncells)]
+
+    def node_id(index):
+        nid = 0
+        stride = 1
+        for i in range(dim):
+            nid += index[i] * stride
+            stride *= npoints[i]
+        return nid
+
+    nodes = []
+    for index in itertools.product(*[range(n) for n in reversed(npoints)]):
+        index = tuple(reversed(index))
+        nodes.append([index[i] * spacing[i] for i in range(dim)])
+
+    if dim == 2:
+        corners = [(0, 0), (1, 0), (1, 1), (0, 1)]
+    else:
+        corners = [(0, 0, 0), (1, 0, 0), (1, 1, 0), (0, 1, 0),
+                   (0, 0, 1), (1, 0, 1), (1, 1, 1), (0, 1, 1)]
+
+    cells = []
+    for index in itertools.product(*[range(n) for n in reversed(ncells)]):
+        index = tuple(reversed(index))
+        cells.append([node_id([index[i] + c[i] for i in range(dim)])
+                      for c in corners])
+    return nodes, cells, npoints, spacing
+
+
+def particles_in(region, spacing, inside=None):
+    """Particles at regular positions in the cells of a box region.
+
+    region is a list of (min, max) bounds per direction, inside an optional
+    predicate on particle coordinates to carve the region.
+    """
+    dim = len(region)
+    axes = []
+    for i in range(dim):
+        step = spacing[i] / PARTICLES_PER_DIR
+        n = int(round((region[i][1] - region[i][0]) / step))
+        axes.append([region[i][0] + (j + 0.5) * step for j in range(n)])
+    points = []
+    for point in itertools.product(*axes):
+        if inside is None or inside(point):
+            points.append(list(point))
+    return points
+
+
+def box_constraints(nodes, lengths, nphases=1):
+    """Zero normal velocity on the sides and base of a box domain."""
+    dim = len(lengths)
+    tolerance = 1.e-9 * max(lengths)
+    constraints = []
+    for nid, x in enumerate(nodes):
+        for i in range(dim):
+            # The top of the domain is free
+            if i == dim - 1:
+                fixed = x[i] < tolerance
+            else:
+                fixed = x[i] < tolerance or x[i] > lengths[i] - tolerance
+            if fixed:
+                for phase in range(nphases):
+                    constraints.append((nid, i + phase * dim, 0.))
+    return constraints
+
+
+def write_lines(filename, header, rows):
+    with open(filename, "w") as f:
+        if header is not None:
+            f.write(header + "\n")
+        for row in rows:
+            f.write(" ".join(repr(v) if isinstance(v, float) else str(v)
+                             for v in row) + "\n")
+
+
+def mohr_coulomb(dim, friction, cohesion):
+    return {
+        "id": 0,
+        "type": "MohrCoulomb{}D".format(dim),
+        "density": 1800.,
+        "youngs_modulus": 1.0E+7,
+        "poisson_ratio": 0.3,
+        "softening": False,
+        "friction": friction,
+        "dilation": 0.,
+        "cohesion": cohesion,
+        "residual_friction": friction,
+        "residual_dilation": 0.,
+        "residual_cohesion": cohesion,
+        "peak_pdstrain": 0.,
+        "residual_pdstrain": 0.,
+        "tension_cutoff": 0.,
+    }
+
+
+def problem(name, size):
+    """Geometry, particles, materials and analysis of a problem."""
+    n = CELLS_PER_LENGTH * size
+    if name in ("column2d", "column3d"):
+        dim = 2 if name == "column2d" else 3
+        lengths = [4.] + [1.] * (dim - 2) + [1.]
+        ncells = [4 * n] + [n] * (dim - 2) + [n]
+        nodes, cells, _, spacing = grid(lengths, ncells)
+        region = [(0., 1.)] + [(0., 1.)] * (dim - 2) + [(0., 0.8)]
+        points = particles_in(region, spacing)
+        materials = [mohr_coulomb(dim, 30., 0.)]
+        analysis = {"type": "MPMExplicit{}D".format(dim), "mpm_scheme": "usf"}
+        particle_type = "P{}D".format(dim)
+        material_id = 0
+        constraints = box_constraints(nodes, lengths)
+        dt = 0.1 * spacing[0] / 100.
+    elif name == "slope":
+        dim = 2
+        lengths = [4., 2.]
+        ncells = [2 * n, n]
+        nodes, cells, _, spacing = grid(lengths, ncells)
+        points = particles_in(
+            [(0., 4.), (0., 1.6)], spacing,
+            lambda x: x[1] < 0.4 or x[1] < 0.4 + 1.2 * (3. - x[0]) / 2.)
+        materials = [mohr_coulomb(dim, 25., 5000.)]
+        analysis = {"type": "MPMExplicit2D", "mpm_scheme": "musl"}
+        particle_type = "P2D"
+        material_id = 0
+        constraints = box_constraints(nodes, lengths)
+        dt = 0.1 * spacing[0] / 100.
+    elif name == "consolidation":
+        dim = 2
+        lengths = [0.25, 1.]
+        ncells = [max(1, n // 4), n]
+        nodes, cells, _, spacing = grid(lengths, ncells)
+        points = particles_in([(0., 0.25), (0., 1.)], spacing)
+        solid = {
+            "id": 0,
+            "type": "LinearElastic2D",
+            "density": 2650.,
+            "youngs_modulus": 1.0E+7,
+            "poisson_ratio": 0.,
+            "porosity": 0.3,
+            "k_x": 1.0E-3,
+            "k_y": 1.0E-3,
+        }
+        liquid = {
+            "id": 1,
+            "type": "Newtonian2D",
+            "density": 1000.,
+            "bulk_modulus": 1.0E+8,
+            "dynamic_viscosity": 0.,
+        }
+        materials = [solid, liquid]
+        analysis = {"type": "MPMExplicitTwoPhase2D", "mpm_scheme": "usf"}
+        particle_type = "P2D2PHASE"
+        material_id = [0, 1]
+        constraints = box_constraints(nodes, lengths, nphases=2)
+        dt = 0.1 * spacing[1] / 400.
+    elif name == "dambreak":
+        dim = 2
+        lengths = [4., 2.]
+        ncells = [2 * n, n]
+        nodes, cells, _, spacing = grid(lengths, ncells)
+        points = particles_in([(0., 1.), (0., 1.)], spacing)
+        materials = [{
+            "id": 0,
+            "type": "Newtonian2D",
+            "density": 1000.,
+            "bulk_modulus": 2.0E+6,
+            "dynamic_viscosity": 1.0E-3,
+            "incompressible": True,
+        }]
+        analysis = {
+            "type": "MPMSemiImplicitNavierStokes2D",
+            "mpm_scheme": "usl",
+            "scheme_settings": {"beta": 1},
+            "free_surface_detection": {
+                "type": "density",
+                "volume_tolerance": 0.25,
+            },
+            "linear_solver": {
+                "assembler_type": "EigenSemiImplicitNavierStokes2D",
+                "solver_type": "IterativeEigen",
+                "max_iter": 1000,
+                "tolerance": 1.0E-9,
+            },
+        }
+        particle_type = "P2DFLUID"
+        material_id = 0
+        constraints = box_constraints(nodes, lengths)
+        dt = 0.1 * spacing[0] / 10.
+    else:
+        raise ValueError("Unknown problem {}".format(name))
+
+    return {
+        "dim": dim,
+        "nodes": nodes,
+        "cells": cells,
+        "points": points,
+        "materials": materials,
+        "analysis": analysis,
+        "particle_type": particle_type,
+        "material_id": material_id,
+        "constraints": constraints,
+        "dt": dt,
+    }
+
+
+def write_problem(directory, name, size, nsteps):
+    """Write the input files of a problem, returns the number of particles."""
+    os.makedirs(directory, exist_ok=True)
+    p = problem(name, size)
+    dim = p["dim"]
+
+    write_lines(os.path.join(directory, "mesh.txt"),
+                "{} {}".format(len(p["nodes"]), len(p["cells"])),
+                p["nodes"] + p["cells"])
+    write_lines(os.path.join(directory, "particles.txt"),
+                str(len(p["points"])), p["points"])
+    write_lines(os.path.join(directory, "velocity_constraints.txt"), None,
+                p["constraints"])
+
+    analysis = dict(p["analysis"])
+    analysis.update({
+        "locate_particles": False,
+        "dt": p["dt"],
+        "nsteps": nsteps,
+        "velocity_update": False,
+        "uuid": "{}-{}".format(name, size),
+        "resume": {"resume": False},
+    })
+
+    config = {
+        "title": "Benchmark {} size {}".format(name, size),
+        "mesh": {
+            "mesh": "mesh.txt",
+            "io_type": "Ascii{}D".format(dim),
+            "check_duplicates": False,
+            "isoparametric": False,
+            "node_type": "N{}D".format(dim)
+                         + ("2P" if name == "consolidation" else ""),
+            "cell_type": "ED2Q4" if dim == 2 else "ED3H8",
+            "boundary_conditions": {
+                "velocity_constraints": [{"file": "velocity_constraints.txt"}]
+            },
+        },
+        "particles": [{
+            "generator": {
+                "type": "file",
+                "location": "particles.txt",
+                "io_type": "Ascii{}D".format(dim),
+                "check_duplicates": False,
+                "particle_type": p["particle_type"],
+                "material_id": p["material_id"],
+                "pset_id": 0,
+            }
+        }],
+        "materials": p["materials"],
+        "external_loading_conditions": {
+            "gravity": [0.] * (dim - 1) + [-9.81]
+        },
+        "analysis": analysis,
+        "post_processing": {
+            "path": "results/",
+            "output_steps": nsteps,
+            "phase_timings": True,
+        },
+    }
+    with open(os.path.join(directory, "mpm.json"), "w") as f:
+        json.dump(config, f, indent=2)
+    return len(p["points"])
+
+
+def run(mpm, directory, threads):
+    """Run a problem, returns the phase timings and the wall time."""
+    for old in glob.glob(os.path.join(directory, "results", "**",
+                                      "phase_timings*.json"), recursive=True):
+        os.remove(old)
+    env = dict(os.environ, OMP_NUM_THREADS=str(threads))
+    begin = time.perf_counter()
+    result = subprocess.run(
+        [mpm, "-f", os.path.abspath(directory) + "/", "-i", "mpm.json",
+         "-p", str(threads)],
+        env=env, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE,
+        universal_newlines=True)
+    wall = time.perf_counter() - begin
+    if result.returncode != 0:
+        lines = result.stderr.strip().splitlines()
+        raise RuntimeError(lines[-1] if lines else
+                           "exit status {}".format(result.returncode))
+    files = glob.glob(os.path.join(directory, "results", "**",
+                                   "phase_timings*.json"), recursive=True)
+    if not files:
+        raise RuntimeError("no phase timings written")
+    with open(files[0]) as f:
+        return json.load(f), wall
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+    parser.add_argument("--mpm", required=True, help="MPM executable")
+    parser.add_argument("--problems", nargs="+",
+                        default=["column2d", "column3d", "slope",
+                                 "consolidation", "dambreak"])
+    parser.add_argument("--sizes", nargs="+", type=int, default=[1, 2, 4],
+                        help="refinement factors of the base resolution")
+    parser.add_argument("--threads", nargs="+", type=int,
+                        default=[1, 2, 4, 8])
+    parser.add_argument("--steps", type=int, default=100)
+    parser.add_argument("--workdir", default="mpm_benchmark")
+    parser.add_argument("--output", default="-",
+                        help="JSON lines output, '-' for standard output")
+    args = parser.parse_args()
+
+    output = sys.stdout if args.output == "-" else open(args.output, "w")
+    for name, size in itertools.product(args.problems, args.sizes):
+        directory = os.path.join(args.workdir, "{}-{}".format(name, size))
+        nparticles = write_problem(directory, name, size, args.steps)
+        for threads in args.threads:
+            record = {
+                "problem": name,
+                "size": size,
+                "threads": threads,
+                "nparticles": nparticles,
+                "nsteps": args.steps,
+            }
+            try:
+                timings, wall = run(args.mpm, directory, threads)
+                record["wall_seconds"] = wall
+                record["timings"] = timings["timings"]
+            except (RuntimeError, OSError) as error:
+                record["error"] = str(error)
+            output.write(json.dumps(record) + "\n")
+            output.flush()
+    if output is not sys.stdout:
+        output.close()
+
+
+if __name__ == "__main__":
+    main()